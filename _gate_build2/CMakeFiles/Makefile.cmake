@@ -0,0 +1,231 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/CreateResource.cmake"
+  "/root/repo/cmake/PkgConfig.cmake"
+  "/root/repo/python/CMakeLists.txt"
+  "/root/repo/python/rti1516/CMakeLists.txt"
+  "/root/repo/python/rti1516e/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/OpenRTI/CMakeLists.txt"
+  "/root/repo/src/OpenRTI/OpenRTIConfig.h.in"
+  "/root/repo/src/RTI13/CMakeLists.txt"
+  "/root/repo/src/rti1516/CMakeLists.txt"
+  "/root/repo/src/rti1516e/CMakeLists.txt"
+  "/root/repo/src/rtinode/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/bench/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/delta/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/encodedmessage/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/fomcompiled/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/fommodulecache/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/fragment/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/lanes/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/metrics/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/network/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/threads/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/timestamporderqueue/CMakeLists.txt"
+  "/root/repo/tests/OpenRTI/trace/CMakeLists.txt"
+  "/root/repo/tests/RTI13/CMakeLists.txt"
+  "/root/repo/tests/RTI13/fddget/CMakeLists.txt"
+  "/root/repo/tests/RTI13/link/CMakeLists.txt"
+  "/root/repo/tests/RTI13/time/CMakeLists.txt"
+  "/root/repo/tests/RTI13/valueset/CMakeLists.txt"
+  "/root/repo/tests/python/CMakeLists.txt"
+  "/root/repo/tests/python/rti1516e/CMakeLists.txt"
+  "/root/repo/tests/rti1516/CMakeLists.txt"
+  "/root/repo/tests/rti1516/connect/CMakeLists.txt"
+  "/root/repo/tests/rti1516/create/CMakeLists.txt"
+  "/root/repo/tests/rti1516/fddget/CMakeLists.txt"
+  "/root/repo/tests/rti1516/interaction/CMakeLists.txt"
+  "/root/repo/tests/rti1516/join/CMakeLists.txt"
+  "/root/repo/tests/rti1516/link/CMakeLists.txt"
+  "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt"
+  "/root/repo/tests/rti1516/save/CMakeLists.txt"
+  "/root/repo/tests/rti1516/sync/CMakeLists.txt"
+  "/root/repo/tests/rti1516/time/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/attributecache/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/datatypes/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/decode/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/encode/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/fddget/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/link/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/modules/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/time/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/transportation/CMakeLists.txt"
+  "/root/repo/tests/rti1516e/updaterate/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindEXPAT.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/OpenRTI/OpenRTIConfig.h"
+  "src/OpenRTI/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/rtinode/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/RTI13/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/rti1516/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/rti1516e/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "python/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "python/rti1516/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "python/rti1516e/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/bench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/delta/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/encodedmessage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/fomcompiled/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/fommodulecache/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/fragment/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/lanes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/metrics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/network/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/threads/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/timestamporderqueue/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/OpenRTI/trace/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/RTI13/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/RTI13/link/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/RTI13/fddget/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/RTI13/time/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/RTI13/valueset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/link/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/connect/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/create/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/join/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/fddget/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/sync/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/time/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/interaction/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/objectinstance/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516/save/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/link/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/encode/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/decode/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/datatypes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/fddget/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/time/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/updaterate/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/transportation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/rti1516e/attributecache/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/python/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/python/rti1516e/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  "src/rtinode/CMakeFiles/rtinode.dir/DependInfo.cmake"
+  "src/rtinode/CMakeFiles/fomcompile.dir/DependInfo.cmake"
+  "src/RTI13/CMakeFiles/RTI-NG.dir/DependInfo.cmake"
+  "src/RTI13/CMakeFiles/FedTime.dir/DependInfo.cmake"
+  "src/rti1516/CMakeFiles/rti1516.dir/DependInfo.cmake"
+  "src/rti1516/CMakeFiles/fedtime1516.dir/DependInfo.cmake"
+  "src/rti1516e/CMakeFiles/rti1516e.dir/DependInfo.cmake"
+  "src/rti1516e/CMakeFiles/fedtime1516e.dir/DependInfo.cmake"
+  "python/rti1516/CMakeFiles/rti1516_py.dir/DependInfo.cmake"
+  "python/rti1516e/CMakeFiles/rti1516e_py.dir/DependInfo.cmake"
+  "tests/OpenRTI/bench/CMakeFiles/bench-encoding.dir/DependInfo.cmake"
+  "tests/OpenRTI/bench/CMakeFiles/bench-stream.dir/DependInfo.cmake"
+  "tests/OpenRTI/bench/CMakeFiles/bench-queue.dir/DependInfo.cmake"
+  "tests/OpenRTI/bench/CMakeFiles/bench-servernode.dir/DependInfo.cmake"
+  "tests/OpenRTI/bench/CMakeFiles/bench-latency.dir/DependInfo.cmake"
+  "tests/OpenRTI/delta/CMakeFiles/delta.dir/DependInfo.cmake"
+  "tests/OpenRTI/encodedmessage/CMakeFiles/encodedmessage.dir/DependInfo.cmake"
+  "tests/OpenRTI/fomcompiled/CMakeFiles/fomcompiled.dir/DependInfo.cmake"
+  "tests/OpenRTI/fommodulecache/CMakeFiles/fommodulecache.dir/DependInfo.cmake"
+  "tests/OpenRTI/fragment/CMakeFiles/fragment.dir/DependInfo.cmake"
+  "tests/OpenRTI/lanes/CMakeFiles/lanes.dir/DependInfo.cmake"
+  "tests/OpenRTI/metrics/CMakeFiles/metrics.dir/DependInfo.cmake"
+  "tests/OpenRTI/network/CMakeFiles/socketaddress.dir/DependInfo.cmake"
+  "tests/OpenRTI/network/CMakeFiles/url.dir/DependInfo.cmake"
+  "tests/OpenRTI/threads/CMakeFiles/threads.dir/DependInfo.cmake"
+  "tests/OpenRTI/timestamporderqueue/CMakeFiles/timestamporderqueue.dir/DependInfo.cmake"
+  "tests/OpenRTI/trace/CMakeFiles/trace.dir/DependInfo.cmake"
+  "tests/RTI13/link/CMakeFiles/link-13.dir/DependInfo.cmake"
+  "tests/RTI13/fddget/CMakeFiles/fddget-13.dir/DependInfo.cmake"
+  "tests/RTI13/time/CMakeFiles/logical-time-13.dir/DependInfo.cmake"
+  "tests/RTI13/valueset/CMakeFiles/valueset-13.dir/DependInfo.cmake"
+  "tests/rti1516/link/CMakeFiles/link-1516.dir/DependInfo.cmake"
+  "tests/rti1516/connect/CMakeFiles/connect-1516.dir/DependInfo.cmake"
+  "tests/rti1516/create/CMakeFiles/create-1516.dir/DependInfo.cmake"
+  "tests/rti1516/create/CMakeFiles/concurrent-create-1516.dir/DependInfo.cmake"
+  "tests/rti1516/join/CMakeFiles/join-1516.dir/DependInfo.cmake"
+  "tests/rti1516/join/CMakeFiles/concurrent-join-1516.dir/DependInfo.cmake"
+  "tests/rti1516/fddget/CMakeFiles/fddget-1516.dir/DependInfo.cmake"
+  "tests/rti1516/sync/CMakeFiles/sync-1516.dir/DependInfo.cmake"
+  "tests/rti1516/time/CMakeFiles/logical-time-1516.dir/DependInfo.cmake"
+  "tests/rti1516/time/CMakeFiles/concurrent-time-1516.dir/DependInfo.cmake"
+  "tests/rti1516/time/CMakeFiles/pipeline-time-1516.dir/DependInfo.cmake"
+  "tests/rti1516/time/CMakeFiles/retraction-time-1516.dir/DependInfo.cmake"
+  "tests/rti1516/interaction/CMakeFiles/interaction-1516.dir/DependInfo.cmake"
+  "tests/rti1516/objectinstance/CMakeFiles/objectname-1516.dir/DependInfo.cmake"
+  "tests/rti1516/objectinstance/CMakeFiles/objectinstance-1516.dir/DependInfo.cmake"
+  "tests/rti1516/objectinstance/CMakeFiles/latesubscribe-1516.dir/DependInfo.cmake"
+  "tests/rti1516/save/CMakeFiles/save-restore-1516.dir/DependInfo.cmake"
+  "tests/rti1516e/link/CMakeFiles/link-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/encode/CMakeFiles/encode-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/decode/CMakeFiles/decode-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/datatypes/CMakeFiles/datatypes-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/fddget/CMakeFiles/fddget-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/time/CMakeFiles/logical-time-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/modules/CMakeFiles/modules-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/updaterate/CMakeFiles/updaterate-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/transportation/CMakeFiles/transportation-1516e.dir/DependInfo.cmake"
+  "tests/rti1516e/attributecache/CMakeFiles/attributecache-1516e.dir/DependInfo.cmake"
+  )
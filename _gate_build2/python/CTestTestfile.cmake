@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/python
+# Build directory: /root/repo/_gate_build2/python
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("rti1516")
+subdirs("rti1516e")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/python3.11/site-packages/rti1516.pdb"
+  "../../lib/python3.11/site-packages/rti1516.so"
+  "CMakeFiles/rti1516_py.dir/Module.cpp.o"
+  "CMakeFiles/rti1516_py.dir/Module.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rti1516_py.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
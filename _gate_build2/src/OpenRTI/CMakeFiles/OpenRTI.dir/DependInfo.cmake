@@ -0,0 +1,96 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/OpenRTI/AbstractMessage.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractMessage.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractMessage.cpp.o.d"
+  "/root/repo/src/OpenRTI/AbstractMessageEncoding.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractMessageEncoding.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractMessageEncoding.cpp.o.d"
+  "/root/repo/src/OpenRTI/AbstractMessageSender.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractMessageSender.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractMessageSender.cpp.o.d"
+  "/root/repo/src/OpenRTI/AbstractProtocolLayer.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractProtocolLayer.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractProtocolLayer.cpp.o.d"
+  "/root/repo/src/OpenRTI/AbstractProtocolSocket.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractProtocolSocket.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractProtocolSocket.cpp.o.d"
+  "/root/repo/src/OpenRTI/AbstractServer.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractServer.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractServer.cpp.o.d"
+  "/root/repo/src/OpenRTI/AbstractServerNode.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractServerNode.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractServerNode.cpp.o.d"
+  "/root/repo/src/OpenRTI/AbstractSocketEvent.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractSocketEvent.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AbstractSocketEvent.cpp.o.d"
+  "/root/repo/src/OpenRTI/AttributeCache.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AttributeCache.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/AttributeCache.cpp.o.d"
+  "/root/repo/src/OpenRTI/Attributes.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Attributes.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Attributes.cpp.o.d"
+  "/root/repo/src/OpenRTI/ContentHandler.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ContentHandler.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ContentHandler.cpp.o.d"
+  "/root/repo/src/OpenRTI/DefaultErrorHandler.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/DefaultErrorHandler.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/DefaultErrorHandler.cpp.o.d"
+  "/root/repo/src/OpenRTI/DeltaCompression.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/DeltaCompression.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/DeltaCompression.cpp.o.d"
+  "/root/repo/src/OpenRTI/ErrorHandler.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ErrorHandler.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ErrorHandler.cpp.o.d"
+  "/root/repo/src/OpenRTI/Exception.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Exception.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Exception.cpp.o.d"
+  "/root/repo/src/OpenRTI/ExpatXMLReader.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ExpatXMLReader.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ExpatXMLReader.cpp.o.d"
+  "/root/repo/src/OpenRTI/FDD1516EFileReader.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FDD1516EFileReader.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FDD1516EFileReader.cpp.o.d"
+  "/root/repo/src/OpenRTI/FDD1516FileReader.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FDD1516FileReader.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FDD1516FileReader.cpp.o.d"
+  "/root/repo/src/OpenRTI/FEDFileReader.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FEDFileReader.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FEDFileReader.cpp.o.d"
+  "/root/repo/src/OpenRTI/FOMModuleCache.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FOMModuleCache.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FOMModuleCache.cpp.o.d"
+  "/root/repo/src/OpenRTI/Federate.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Federate.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Federate.cpp.o.d"
+  "/root/repo/src/OpenRTI/FederationSnapshot.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FederationSnapshot.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/FederationSnapshot.cpp.o.d"
+  "/root/repo/src/OpenRTI/InitialClientStreamProtocol.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InitialClientStreamProtocol.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InitialClientStreamProtocol.cpp.o.d"
+  "/root/repo/src/OpenRTI/InitialServerStreamProtocol.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InitialServerStreamProtocol.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InitialServerStreamProtocol.cpp.o.d"
+  "/root/repo/src/OpenRTI/InitialStreamProtocol.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InitialStreamProtocol.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InitialStreamProtocol.cpp.o.d"
+  "/root/repo/src/OpenRTI/InternalAmbassador.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InternalAmbassador.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InternalAmbassador.cpp.o.d"
+  "/root/repo/src/OpenRTI/InternalTimeManagement.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InternalTimeManagement.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/InternalTimeManagement.cpp.o.d"
+  "/root/repo/src/OpenRTI/LeafServerThread.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/LeafServerThread.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/LeafServerThread.cpp.o.d"
+  "/root/repo/src/OpenRTI/LogStream.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/LogStream.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/LogStream.cpp.o.d"
+  "/root/repo/src/OpenRTI/Message.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Message.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Message.cpp.o.d"
+  "/root/repo/src/OpenRTI/MessageEncodingRegistry.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/MessageEncodingRegistry.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/MessageEncodingRegistry.cpp.o.d"
+  "/root/repo/src/OpenRTI/MessageTrace.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/MessageTrace.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/MessageTrace.cpp.o.d"
+  "/root/repo/src/OpenRTI/Metrics.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Metrics.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Metrics.cpp.o.d"
+  "/root/repo/src/OpenRTI/NestedProtocolLayer.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/NestedProtocolLayer.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/NestedProtocolLayer.cpp.o.d"
+  "/root/repo/src/OpenRTI/NetworkServer.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/NetworkServer.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/NetworkServer.cpp.o.d"
+  "/root/repo/src/OpenRTI/Options.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Options.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/Options.cpp.o.d"
+  "/root/repo/src/OpenRTI/ParenthesesReader.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ParenthesesReader.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ParenthesesReader.cpp.o.d"
+  "/root/repo/src/OpenRTI/ProtocolSocketEvent.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ProtocolSocketEvent.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ProtocolSocketEvent.cpp.o.d"
+  "/root/repo/src/OpenRTI/RegionSet.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/RegionSet.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/RegionSet.cpp.o.d"
+  "/root/repo/src/OpenRTI/ServerConfigContentHandler.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ServerConfigContentHandler.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ServerConfigContentHandler.cpp.o.d"
+  "/root/repo/src/OpenRTI/ServerModel.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ServerModel.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ServerModel.cpp.o.d"
+  "/root/repo/src/OpenRTI/ServerNode.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ServerNode.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ServerNode.cpp.o.d"
+  "/root/repo/src/OpenRTI/SocketEventDispatcher.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/SocketEventDispatcher.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/SocketEventDispatcher.cpp.o.d"
+  "/root/repo/src/OpenRTI/SocketServerAcceptEvent.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/SocketServerAcceptEvent.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/SocketServerAcceptEvent.cpp.o.d"
+  "/root/repo/src/OpenRTI/StreamBufferProtocol.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/StreamBufferProtocol.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/StreamBufferProtocol.cpp.o.d"
+  "/root/repo/src/OpenRTI/StringUtils.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/StringUtils.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/StringUtils.cpp.o.d"
+  "/root/repo/src/OpenRTI/ThreadServer.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ThreadServer.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ThreadServer.cpp.o.d"
+  "/root/repo/src/OpenRTI/TightBE1MessageEncoding.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/TightBE1MessageEncoding.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/TightBE1MessageEncoding.cpp.o.d"
+  "/root/repo/src/OpenRTI/URL.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/URL.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/URL.cpp.o.d"
+  "/root/repo/src/OpenRTI/WeakReferenced.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/WeakReferenced.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/WeakReferenced.cpp.o.d"
+  "/root/repo/src/OpenRTI/XMLReader.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/XMLReader.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/XMLReader.cpp.o.d"
+  "/root/repo/src/OpenRTI/ZLibProtocolLayer.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ZLibProtocolLayer.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/ZLibProtocolLayer.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/AtomicPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/AtomicPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/AtomicPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/ClockPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/ClockPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/ClockPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/ConditionPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/ConditionPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/ConditionPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/DynamicModulePosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/DynamicModulePosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/DynamicModulePosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/MutexPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/MutexPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/MutexPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketAddressPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketAddressPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketAddressPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketDataPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketDataPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketDataPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketEventDispatcherPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketEventDispatcherPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketEventDispatcherPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketPacketPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketPacketPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketPacketPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketPipePosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketPipePosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketPipePosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketServerPipePosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketServerPipePosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketServerPipePosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketServerPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketServerPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketServerPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketServerTCPPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketServerTCPPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketServerTCPPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketStreamPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketStreamPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketStreamPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketTCPPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketTCPPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketTCPPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/SocketUDPPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketUDPPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/SocketUDPPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/ThreadLocalPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/ThreadLocalPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/ThreadLocalPosix.cpp.o.d"
+  "/root/repo/src/OpenRTI/posix/ThreadPosix.cpp" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/ThreadPosix.cpp.o" "gcc" "src/OpenRTI/CMakeFiles/OpenRTI.dir/posix/ThreadPosix.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build2/lib/libOpenRTI.so" "/root/repo/_gate_build2/lib/libOpenRTI.so.1.0.0"
+  "/root/repo/_gate_build2/lib/libOpenRTI.so.1" "/root/repo/_gate_build2/lib/libOpenRTI.so.1.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,153 @@
+file(REMOVE_RECURSE
+  "../../lib/libOpenRTI.pdb"
+  "../../lib/libOpenRTI.so"
+  "../../lib/libOpenRTI.so.1"
+  "../../lib/libOpenRTI.so.1.0.0"
+  "CMakeFiles/OpenRTI.dir/AbstractMessage.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AbstractMessage.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/AbstractMessageEncoding.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AbstractMessageEncoding.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/AbstractMessageSender.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AbstractMessageSender.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/AbstractProtocolLayer.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AbstractProtocolLayer.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/AbstractProtocolSocket.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AbstractProtocolSocket.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/AbstractServer.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AbstractServer.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/AbstractServerNode.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AbstractServerNode.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/AbstractSocketEvent.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AbstractSocketEvent.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/AttributeCache.cpp.o"
+  "CMakeFiles/OpenRTI.dir/AttributeCache.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/Attributes.cpp.o"
+  "CMakeFiles/OpenRTI.dir/Attributes.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ContentHandler.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ContentHandler.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/DefaultErrorHandler.cpp.o"
+  "CMakeFiles/OpenRTI.dir/DefaultErrorHandler.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/DeltaCompression.cpp.o"
+  "CMakeFiles/OpenRTI.dir/DeltaCompression.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ErrorHandler.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ErrorHandler.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/Exception.cpp.o"
+  "CMakeFiles/OpenRTI.dir/Exception.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ExpatXMLReader.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ExpatXMLReader.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/FDD1516EFileReader.cpp.o"
+  "CMakeFiles/OpenRTI.dir/FDD1516EFileReader.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/FDD1516FileReader.cpp.o"
+  "CMakeFiles/OpenRTI.dir/FDD1516FileReader.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/FEDFileReader.cpp.o"
+  "CMakeFiles/OpenRTI.dir/FEDFileReader.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/FOMModuleCache.cpp.o"
+  "CMakeFiles/OpenRTI.dir/FOMModuleCache.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/Federate.cpp.o"
+  "CMakeFiles/OpenRTI.dir/Federate.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/FederationSnapshot.cpp.o"
+  "CMakeFiles/OpenRTI.dir/FederationSnapshot.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/InitialClientStreamProtocol.cpp.o"
+  "CMakeFiles/OpenRTI.dir/InitialClientStreamProtocol.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/InitialServerStreamProtocol.cpp.o"
+  "CMakeFiles/OpenRTI.dir/InitialServerStreamProtocol.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/InitialStreamProtocol.cpp.o"
+  "CMakeFiles/OpenRTI.dir/InitialStreamProtocol.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/InternalAmbassador.cpp.o"
+  "CMakeFiles/OpenRTI.dir/InternalAmbassador.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/InternalTimeManagement.cpp.o"
+  "CMakeFiles/OpenRTI.dir/InternalTimeManagement.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/LeafServerThread.cpp.o"
+  "CMakeFiles/OpenRTI.dir/LeafServerThread.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/LogStream.cpp.o"
+  "CMakeFiles/OpenRTI.dir/LogStream.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/Message.cpp.o"
+  "CMakeFiles/OpenRTI.dir/Message.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/MessageEncodingRegistry.cpp.o"
+  "CMakeFiles/OpenRTI.dir/MessageEncodingRegistry.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/MessageTrace.cpp.o"
+  "CMakeFiles/OpenRTI.dir/MessageTrace.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/Metrics.cpp.o"
+  "CMakeFiles/OpenRTI.dir/Metrics.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/NestedProtocolLayer.cpp.o"
+  "CMakeFiles/OpenRTI.dir/NestedProtocolLayer.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/NetworkServer.cpp.o"
+  "CMakeFiles/OpenRTI.dir/NetworkServer.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/Options.cpp.o"
+  "CMakeFiles/OpenRTI.dir/Options.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ParenthesesReader.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ParenthesesReader.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ProtocolSocketEvent.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ProtocolSocketEvent.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/RegionSet.cpp.o"
+  "CMakeFiles/OpenRTI.dir/RegionSet.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ServerConfigContentHandler.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ServerConfigContentHandler.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ServerModel.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ServerModel.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ServerNode.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ServerNode.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/SocketEventDispatcher.cpp.o"
+  "CMakeFiles/OpenRTI.dir/SocketEventDispatcher.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/SocketServerAcceptEvent.cpp.o"
+  "CMakeFiles/OpenRTI.dir/SocketServerAcceptEvent.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/StreamBufferProtocol.cpp.o"
+  "CMakeFiles/OpenRTI.dir/StreamBufferProtocol.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/StringUtils.cpp.o"
+  "CMakeFiles/OpenRTI.dir/StringUtils.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ThreadServer.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ThreadServer.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/TightBE1MessageEncoding.cpp.o"
+  "CMakeFiles/OpenRTI.dir/TightBE1MessageEncoding.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/URL.cpp.o"
+  "CMakeFiles/OpenRTI.dir/URL.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/WeakReferenced.cpp.o"
+  "CMakeFiles/OpenRTI.dir/WeakReferenced.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/XMLReader.cpp.o"
+  "CMakeFiles/OpenRTI.dir/XMLReader.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/ZLibProtocolLayer.cpp.o"
+  "CMakeFiles/OpenRTI.dir/ZLibProtocolLayer.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/AtomicPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/AtomicPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/ClockPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/ClockPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/ConditionPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/ConditionPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/DynamicModulePosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/DynamicModulePosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/MutexPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/MutexPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketAddressPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketAddressPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketDataPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketDataPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketEventDispatcherPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketEventDispatcherPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketPacketPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketPacketPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketPipePosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketPipePosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketServerPipePosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketServerPipePosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketServerPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketServerPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketServerTCPPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketServerTCPPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketStreamPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketStreamPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketTCPPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketTCPPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/SocketUDPPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/SocketUDPPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/ThreadLocalPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/ThreadLocalPosix.cpp.o.d"
+  "CMakeFiles/OpenRTI.dir/posix/ThreadPosix.cpp.o"
+  "CMakeFiles/OpenRTI.dir/posix/ThreadPosix.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenRTI.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
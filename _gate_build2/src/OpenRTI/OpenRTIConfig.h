@@ -0,0 +1,95 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2004-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_OpenRTIConfig_h
+#define OpenRTI_OpenRTIConfig_h
+
+#define OpenRTI_VERSION_STRING "1.0"
+
+// Defaults for server connects
+#define OpenRTI_DEFAULT_HOST_STRING "localhost"
+// Just a free port from my /etc/services ...
+#define OpenRTI_DEFAULT_PORT_STRING "14321"
+#define OpenRTI_DEFAULT_PIPE_PATH ".OpenRTI"
+
+#define OpenRTI_VERSION_CHECK(REQ_MAJ, REQ_MIN, AVAIL_MAJ, AVAIL_MIN) \
+  ((((REQ_MAJ) == (AVAIL_MAJ)) && ((REQ_MIN) <= (AVAIL_MIN))) || ((REQ_MAJ) < (AVAIL_MAJ)))
+
+#if defined(__GNUC__) && (((4 <= __GNUC__) && (1 <= __GNUC_MINOR__)) || (5 <= __GNUC__))
+#define OpenRTI_DEPRECATED __attribute__ ((deprecated))
+#else
+#define OpenRTI_DEPRECATED
+#endif
+
+#if 201103L <= __cplusplus
+// In any case this is the best choice as this provides a reliable api for any future
+# define OpenRTI_ATOMIC_USE_STD_ATOMIC
+#else
+# if defined(__GNUC__) && OpenRTI_VERSION_CHECK(4, 7, __GNUC__, __GNUC_MINOR__)
+// No need to include something. Is a Compiler API ...
+#  define OpenRTI_ATOMIC_USE_GCC47_BUILTINS
+# elif defined(__clang__) && OpenRTI_VERSION_CHECK(3, 3, __clang_major__, __clang_minor__)
+// No need to include something. Is a Compiler API. Note that clang aims to be gcc compatible ...
+#  define OpenRTI_ATOMIC_USE_GCC47_BUILTINS
+# elif defined _WIN32
+// Neat old Win32 functions
+#  define OpenRTI_ATOMIC_USE_WIN32_INTERLOCKED
+# elif defined(__GNUC__) && OpenRTI_VERSION_CHECK(4, 1, __GNUC__, __GNUC_MINOR__) && defined(__x86_64__)
+// No need to include something. Is a Compiler API ...
+#  define OpenRTI_ATOMIC_USE_GCC4_BUILTINS
+# elif defined(__GNUC__) && defined(__i386)
+#  define OpenRTI_ATOMIC_USE_GCC_ASM
+# elif defined(__sgi) && defined(_COMPILER_VERSION) && (_COMPILER_VERSION>=730)
+// No need to include something. Is a Compiler API ...
+#  define OpenRTI_ATOMIC_USE_MIPSPRO_BUILTINS
+// FIXME
+// #elif defined(__sun)
+// # define OpenRTI_ATOMIC_USE_SUN
+# elif defined(__APPLE__)
+#  define OpenRTI_ATOMIC_USE_BSD
+# else
+// The sledge hammer ...
+#  define OpenRTI_ATOMIC_USE_MUTEX
+# endif
+#endif
+
+#if __cplusplus < 201103L
+#define OpenRTI_NOEXCEPT throw()
+#else
+#define OpenRTI_NOEXCEPT noexcept
+#endif
+
+#if __cplusplus < 201703L
+#define OpenRTI_MOVE(p) p
+#else
+#define OpenRTI_MOVE(p) std::move(p)
+#endif
+
+/* #undef OpenRTI_HAVE_CSTDINT */
+#define OpenRTI_HAVE_STDINT_H
+#define OpenRTI_HAVE_INTTYPES_H
+
+/* #undef OpenRTI_HOST_IS_BIG_ENDIAN */
+#define OpenRTI_HOST_IS_LITTLE_ENDIAN
+
+#define OpenRTI_HAVE_ALLOCA
+#define OpenRTI_HAVE_DLADDR
+#define OPENRTI_DATAROOTDIR "/usr/local/share/OpenRTI"
+
+#endif
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libFedTime.pdb"
+  "../../lib/libFedTime.so"
+  "../../lib/libFedTime.so.1"
+  "../../lib/libFedTime.so.1.3.0"
+  "CMakeFiles/FedTime.dir/RTIfedTime.cpp.o"
+  "CMakeFiles/FedTime.dir/RTIfedTime.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FedTime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
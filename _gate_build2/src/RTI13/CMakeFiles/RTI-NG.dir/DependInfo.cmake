@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/RTI13/AttributeHandleSetCallback.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/AttributeHandleSetCallback.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/AttributeHandleSetCallback.cpp.o.d"
+  "/root/repo/src/RTI13/AttributeHandleSetImplementation.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/AttributeHandleSetImplementation.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/AttributeHandleSetImplementation.cpp.o.d"
+  "/root/repo/src/RTI13/AttributeHandleValuePairSetCallback.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/AttributeHandleValuePairSetCallback.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/AttributeHandleValuePairSetCallback.cpp.o.d"
+  "/root/repo/src/RTI13/AttributeHandleValuePairSetImplementation.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/AttributeHandleValuePairSetImplementation.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/AttributeHandleValuePairSetImplementation.cpp.o.d"
+  "/root/repo/src/RTI13/Exception.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/Exception.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/Exception.cpp.o.d"
+  "/root/repo/src/RTI13/FederateHandleSetImplementation.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/FederateHandleSetImplementation.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/FederateHandleSetImplementation.cpp.o.d"
+  "/root/repo/src/RTI13/ParameterHandleValuePairSetCallback.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/ParameterHandleValuePairSetCallback.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/ParameterHandleValuePairSetCallback.cpp.o.d"
+  "/root/repo/src/RTI13/ParameterHandleValuePairSetImplementation.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/ParameterHandleValuePairSetImplementation.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/ParameterHandleValuePairSetImplementation.cpp.o.d"
+  "/root/repo/src/RTI13/RTI13LogicalTimeFactory.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/RTI13LogicalTimeFactory.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/RTI13LogicalTimeFactory.cpp.o.d"
+  "/root/repo/src/RTI13/RTIambPrivateRefs.cpp" "src/RTI13/CMakeFiles/RTI-NG.dir/RTIambPrivateRefs.cpp.o" "gcc" "src/RTI13/CMakeFiles/RTI-NG.dir/RTIambPrivateRefs.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build2/lib/libRTI-NG.so" "/root/repo/_gate_build2/lib/libRTI-NG.so.1.3.0"
+  "/root/repo/_gate_build2/lib/libRTI-NG.so.1" "/root/repo/_gate_build2/lib/libRTI-NG.so.1.3.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build2/src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../lib/libRTI-NG.pdb"
+  "../../lib/libRTI-NG.so"
+  "../../lib/libRTI-NG.so.1"
+  "../../lib/libRTI-NG.so.1.3.0"
+  "CMakeFiles/RTI-NG.dir/AttributeHandleSetCallback.cpp.o"
+  "CMakeFiles/RTI-NG.dir/AttributeHandleSetCallback.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/AttributeHandleSetImplementation.cpp.o"
+  "CMakeFiles/RTI-NG.dir/AttributeHandleSetImplementation.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/AttributeHandleValuePairSetCallback.cpp.o"
+  "CMakeFiles/RTI-NG.dir/AttributeHandleValuePairSetCallback.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/AttributeHandleValuePairSetImplementation.cpp.o"
+  "CMakeFiles/RTI-NG.dir/AttributeHandleValuePairSetImplementation.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/Exception.cpp.o"
+  "CMakeFiles/RTI-NG.dir/Exception.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/FederateHandleSetImplementation.cpp.o"
+  "CMakeFiles/RTI-NG.dir/FederateHandleSetImplementation.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/ParameterHandleValuePairSetCallback.cpp.o"
+  "CMakeFiles/RTI-NG.dir/ParameterHandleValuePairSetCallback.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/ParameterHandleValuePairSetImplementation.cpp.o"
+  "CMakeFiles/RTI-NG.dir/ParameterHandleValuePairSetImplementation.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/RTI13LogicalTimeFactory.cpp.o"
+  "CMakeFiles/RTI-NG.dir/RTI13LogicalTimeFactory.cpp.o.d"
+  "CMakeFiles/RTI-NG.dir/RTIambPrivateRefs.cpp.o"
+  "CMakeFiles/RTI-NG.dir/RTIambPrivateRefs.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RTI-NG.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
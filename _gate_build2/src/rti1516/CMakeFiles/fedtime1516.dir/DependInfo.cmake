@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/rti1516/HLAfloat64Interval.cpp" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAfloat64Interval.cpp.o" "gcc" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAfloat64Interval.cpp.o.d"
+  "/root/repo/src/rti1516/HLAfloat64Time.cpp" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAfloat64Time.cpp.o" "gcc" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAfloat64Time.cpp.o.d"
+  "/root/repo/src/rti1516/HLAfloat64TimeFactory.cpp" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAfloat64TimeFactory.cpp.o" "gcc" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAfloat64TimeFactory.cpp.o.d"
+  "/root/repo/src/rti1516/HLAinteger64Interval.cpp" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAinteger64Interval.cpp.o" "gcc" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAinteger64Interval.cpp.o.d"
+  "/root/repo/src/rti1516/HLAinteger64Time.cpp" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAinteger64Time.cpp.o" "gcc" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAinteger64Time.cpp.o.d"
+  "/root/repo/src/rti1516/HLAinteger64TimeFactory.cpp" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAinteger64TimeFactory.cpp.o" "gcc" "src/rti1516/CMakeFiles/fedtime1516.dir/HLAinteger64TimeFactory.cpp.o.d"
+  "/root/repo/src/rti1516/LogicalTimeFactoryFactory.cpp" "src/rti1516/CMakeFiles/fedtime1516.dir/LogicalTimeFactoryFactory.cpp.o" "gcc" "src/rti1516/CMakeFiles/fedtime1516.dir/LogicalTimeFactoryFactory.cpp.o.d"
+  "/root/repo/src/rti1516/RTI1516fedTime.cpp" "src/rti1516/CMakeFiles/fedtime1516.dir/RTI1516fedTime.cpp.o" "gcc" "src/rti1516/CMakeFiles/fedtime1516.dir/RTI1516fedTime.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build2/lib/libfedtime1516.so" "/root/repo/_gate_build2/lib/libfedtime1516.so.1.0.0"
+  "/root/repo/_gate_build2/lib/libfedtime1516.so.1" "/root/repo/_gate_build2/lib/libfedtime1516.so.1.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build2/src/rti1516/CMakeFiles/rti1516.dir/DependInfo.cmake"
+  "/root/repo/_gate_build2/src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../lib/libfedtime1516.pdb"
+  "../../lib/libfedtime1516.so"
+  "../../lib/libfedtime1516.so.1"
+  "../../lib/libfedtime1516.so.1.0.0"
+  "CMakeFiles/fedtime1516.dir/HLAfloat64Interval.cpp.o"
+  "CMakeFiles/fedtime1516.dir/HLAfloat64Interval.cpp.o.d"
+  "CMakeFiles/fedtime1516.dir/HLAfloat64Time.cpp.o"
+  "CMakeFiles/fedtime1516.dir/HLAfloat64Time.cpp.o.d"
+  "CMakeFiles/fedtime1516.dir/HLAfloat64TimeFactory.cpp.o"
+  "CMakeFiles/fedtime1516.dir/HLAfloat64TimeFactory.cpp.o.d"
+  "CMakeFiles/fedtime1516.dir/HLAinteger64Interval.cpp.o"
+  "CMakeFiles/fedtime1516.dir/HLAinteger64Interval.cpp.o.d"
+  "CMakeFiles/fedtime1516.dir/HLAinteger64Time.cpp.o"
+  "CMakeFiles/fedtime1516.dir/HLAinteger64Time.cpp.o.d"
+  "CMakeFiles/fedtime1516.dir/HLAinteger64TimeFactory.cpp.o"
+  "CMakeFiles/fedtime1516.dir/HLAinteger64TimeFactory.cpp.o.d"
+  "CMakeFiles/fedtime1516.dir/LogicalTimeFactoryFactory.cpp.o"
+  "CMakeFiles/fedtime1516.dir/LogicalTimeFactoryFactory.cpp.o.d"
+  "CMakeFiles/fedtime1516.dir/RTI1516fedTime.cpp.o"
+  "CMakeFiles/fedtime1516.dir/RTI1516fedTime.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fedtime1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/rti1516/Exception.cpp" "src/rti1516/CMakeFiles/rti1516.dir/Exception.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/Exception.cpp.o.d"
+  "/root/repo/src/rti1516/FederateAmbassador.cpp" "src/rti1516/CMakeFiles/rti1516.dir/FederateAmbassador.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/FederateAmbassador.cpp.o.d"
+  "/root/repo/src/rti1516/Handle.cpp" "src/rti1516/CMakeFiles/rti1516.dir/Handle.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/Handle.cpp.o.d"
+  "/root/repo/src/rti1516/LogicalTime.cpp" "src/rti1516/CMakeFiles/rti1516.dir/LogicalTime.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/LogicalTime.cpp.o.d"
+  "/root/repo/src/rti1516/LogicalTimeFactory.cpp" "src/rti1516/CMakeFiles/rti1516.dir/LogicalTimeFactory.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/LogicalTimeFactory.cpp.o.d"
+  "/root/repo/src/rti1516/LogicalTimeInterval.cpp" "src/rti1516/CMakeFiles/rti1516.dir/LogicalTimeInterval.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/LogicalTimeInterval.cpp.o.d"
+  "/root/repo/src/rti1516/NullFederateAmbassador.cpp" "src/rti1516/CMakeFiles/rti1516.dir/NullFederateAmbassador.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/NullFederateAmbassador.cpp.o.d"
+  "/root/repo/src/rti1516/RTI1516LogicalTimeFactory.cpp" "src/rti1516/CMakeFiles/rti1516.dir/RTI1516LogicalTimeFactory.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/RTI1516LogicalTimeFactory.cpp.o.d"
+  "/root/repo/src/rti1516/RTIambassador.cpp" "src/rti1516/CMakeFiles/rti1516.dir/RTIambassador.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/RTIambassador.cpp.o.d"
+  "/root/repo/src/rti1516/RTIambassadorFactory.cpp" "src/rti1516/CMakeFiles/rti1516.dir/RTIambassadorFactory.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/RTIambassadorFactory.cpp.o.d"
+  "/root/repo/src/rti1516/RTIambassadorImplementation.cpp" "src/rti1516/CMakeFiles/rti1516.dir/RTIambassadorImplementation.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/RTIambassadorImplementation.cpp.o.d"
+  "/root/repo/src/rti1516/RangeBounds.cpp" "src/rti1516/CMakeFiles/rti1516.dir/RangeBounds.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/RangeBounds.cpp.o.d"
+  "/root/repo/src/rti1516/VariableLengthData.cpp" "src/rti1516/CMakeFiles/rti1516.dir/VariableLengthData.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/VariableLengthData.cpp.o.d"
+  "/root/repo/src/rti1516/Version.cpp" "src/rti1516/CMakeFiles/rti1516.dir/Version.cpp.o" "gcc" "src/rti1516/CMakeFiles/rti1516.dir/Version.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build2/lib/librti1516.so" "/root/repo/_gate_build2/lib/librti1516.so.1.0.0"
+  "/root/repo/_gate_build2/lib/librti1516.so.1" "/root/repo/_gate_build2/lib/librti1516.so.1.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build2/src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "../../lib/librti1516.pdb"
+  "../../lib/librti1516.so"
+  "../../lib/librti1516.so.1"
+  "../../lib/librti1516.so.1.0.0"
+  "CMakeFiles/rti1516.dir/Exception.cpp.o"
+  "CMakeFiles/rti1516.dir/Exception.cpp.o.d"
+  "CMakeFiles/rti1516.dir/FederateAmbassador.cpp.o"
+  "CMakeFiles/rti1516.dir/FederateAmbassador.cpp.o.d"
+  "CMakeFiles/rti1516.dir/Handle.cpp.o"
+  "CMakeFiles/rti1516.dir/Handle.cpp.o.d"
+  "CMakeFiles/rti1516.dir/LogicalTime.cpp.o"
+  "CMakeFiles/rti1516.dir/LogicalTime.cpp.o.d"
+  "CMakeFiles/rti1516.dir/LogicalTimeFactory.cpp.o"
+  "CMakeFiles/rti1516.dir/LogicalTimeFactory.cpp.o.d"
+  "CMakeFiles/rti1516.dir/LogicalTimeInterval.cpp.o"
+  "CMakeFiles/rti1516.dir/LogicalTimeInterval.cpp.o.d"
+  "CMakeFiles/rti1516.dir/NullFederateAmbassador.cpp.o"
+  "CMakeFiles/rti1516.dir/NullFederateAmbassador.cpp.o.d"
+  "CMakeFiles/rti1516.dir/RTI1516LogicalTimeFactory.cpp.o"
+  "CMakeFiles/rti1516.dir/RTI1516LogicalTimeFactory.cpp.o.d"
+  "CMakeFiles/rti1516.dir/RTIambassador.cpp.o"
+  "CMakeFiles/rti1516.dir/RTIambassador.cpp.o.d"
+  "CMakeFiles/rti1516.dir/RTIambassadorFactory.cpp.o"
+  "CMakeFiles/rti1516.dir/RTIambassadorFactory.cpp.o.d"
+  "CMakeFiles/rti1516.dir/RTIambassadorImplementation.cpp.o"
+  "CMakeFiles/rti1516.dir/RTIambassadorImplementation.cpp.o.d"
+  "CMakeFiles/rti1516.dir/RangeBounds.cpp.o"
+  "CMakeFiles/rti1516.dir/RangeBounds.cpp.o.d"
+  "CMakeFiles/rti1516.dir/VariableLengthData.cpp.o"
+  "CMakeFiles/rti1516.dir/VariableLengthData.cpp.o.d"
+  "CMakeFiles/rti1516.dir/Version.cpp.o"
+  "CMakeFiles/rti1516.dir/Version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rti1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/rti1516e/LogicalTimeFactoryFactory.cpp" "src/rti1516e/CMakeFiles/fedtime1516e.dir/LogicalTimeFactoryFactory.cpp.o" "gcc" "src/rti1516e/CMakeFiles/fedtime1516e.dir/LogicalTimeFactoryFactory.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build2/lib/libfedtime1516e.so" "/root/repo/_gate_build2/lib/libfedtime1516e.so.1.0.0"
+  "/root/repo/_gate_build2/lib/libfedtime1516e.so.1" "/root/repo/_gate_build2/lib/libfedtime1516e.so.1.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build2/src/rti1516e/CMakeFiles/rti1516e.dir/DependInfo.cmake"
+  "/root/repo/_gate_build2/src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
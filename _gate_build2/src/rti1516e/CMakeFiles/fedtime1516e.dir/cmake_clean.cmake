@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libfedtime1516e.pdb"
+  "../../lib/libfedtime1516e.so"
+  "../../lib/libfedtime1516e.so.1"
+  "../../lib/libfedtime1516e.so.1.0.0"
+  "CMakeFiles/fedtime1516e.dir/LogicalTimeFactoryFactory.cpp.o"
+  "CMakeFiles/fedtime1516e.dir/LogicalTimeFactoryFactory.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fedtime1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
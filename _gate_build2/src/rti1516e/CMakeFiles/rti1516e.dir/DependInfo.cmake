@@ -0,0 +1,56 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/rti1516e/BasicDataElements.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/BasicDataElements.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/BasicDataElements.cpp.o.d"
+  "/root/repo/src/rti1516e/DataElement.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/DataElement.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/DataElement.cpp.o.d"
+  "/root/repo/src/rti1516e/EncodingExceptions.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/EncodingExceptions.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/EncodingExceptions.cpp.o.d"
+  "/root/repo/src/rti1516e/Exception.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/Exception.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/Exception.cpp.o.d"
+  "/root/repo/src/rti1516e/FederateAmbassador.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/FederateAmbassador.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/FederateAmbassador.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAfixedArray.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfixedArray.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfixedArray.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAfixedRecord.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfixedRecord.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfixedRecord.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAfloat64Interval.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfloat64Interval.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfloat64Interval.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAfloat64Time.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfloat64Time.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfloat64Time.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAfloat64TimeFactory.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfloat64TimeFactory.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAfloat64TimeFactory.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAinteger64Interval.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAinteger64Interval.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAinteger64Interval.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAinteger64Time.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAinteger64Time.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAinteger64Time.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAinteger64TimeFactory.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAinteger64TimeFactory.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAinteger64TimeFactory.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAlogicalTimeFactoryFactory.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAlogicalTimeFactoryFactory.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAlogicalTimeFactoryFactory.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAopaqueData.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAopaqueData.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAopaqueData.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAvariableArray.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAvariableArray.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAvariableArray.cpp.o.d"
+  "/root/repo/src/rti1516e/HLAvariantRecord.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAvariantRecord.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/HLAvariantRecord.cpp.o.d"
+  "/root/repo/src/rti1516e/Handle.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/Handle.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/Handle.cpp.o.d"
+  "/root/repo/src/rti1516e/LogicalTime.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/LogicalTime.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/LogicalTime.cpp.o.d"
+  "/root/repo/src/rti1516e/LogicalTimeFactory.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/LogicalTimeFactory.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/LogicalTimeFactory.cpp.o.d"
+  "/root/repo/src/rti1516e/LogicalTimeInterval.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/LogicalTimeInterval.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/LogicalTimeInterval.cpp.o.d"
+  "/root/repo/src/rti1516e/NullFederateAmbassador.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/NullFederateAmbassador.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/NullFederateAmbassador.cpp.o.d"
+  "/root/repo/src/rti1516e/RTI1516ELogicalTimeFactory.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/RTI1516ELogicalTimeFactory.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/RTI1516ELogicalTimeFactory.cpp.o.d"
+  "/root/repo/src/rti1516e/RTIambassador.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/RTIambassador.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/RTIambassador.cpp.o.d"
+  "/root/repo/src/rti1516e/RTIambassadorFactory.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/RTIambassadorFactory.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/RTIambassadorFactory.cpp.o.d"
+  "/root/repo/src/rti1516e/RTIambassadorImplementation.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/RTIambassadorImplementation.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/RTIambassadorImplementation.cpp.o.d"
+  "/root/repo/src/rti1516e/RangeBounds.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/RangeBounds.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/RangeBounds.cpp.o.d"
+  "/root/repo/src/rti1516e/Typedefs.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/Typedefs.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/Typedefs.cpp.o.d"
+  "/root/repo/src/rti1516e/VariableLengthData.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/VariableLengthData.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/VariableLengthData.cpp.o.d"
+  "/root/repo/src/rti1516e/Version.cpp" "src/rti1516e/CMakeFiles/rti1516e.dir/Version.cpp.o" "gcc" "src/rti1516e/CMakeFiles/rti1516e.dir/Version.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_build2/lib/librti1516e.so" "/root/repo/_gate_build2/lib/librti1516e.so.1.0.0"
+  "/root/repo/_gate_build2/lib/librti1516e.so.1" "/root/repo/_gate_build2/lib/librti1516e.so.1.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build2/src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
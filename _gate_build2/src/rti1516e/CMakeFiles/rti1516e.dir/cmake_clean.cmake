@@ -0,0 +1,71 @@
+file(REMOVE_RECURSE
+  "../../lib/librti1516e.pdb"
+  "../../lib/librti1516e.so"
+  "../../lib/librti1516e.so.1"
+  "../../lib/librti1516e.so.1.0.0"
+  "CMakeFiles/rti1516e.dir/BasicDataElements.cpp.o"
+  "CMakeFiles/rti1516e.dir/BasicDataElements.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/DataElement.cpp.o"
+  "CMakeFiles/rti1516e.dir/DataElement.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/EncodingExceptions.cpp.o"
+  "CMakeFiles/rti1516e.dir/EncodingExceptions.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/Exception.cpp.o"
+  "CMakeFiles/rti1516e.dir/Exception.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/FederateAmbassador.cpp.o"
+  "CMakeFiles/rti1516e.dir/FederateAmbassador.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAfixedArray.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAfixedArray.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAfixedRecord.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAfixedRecord.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAfloat64Interval.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAfloat64Interval.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAfloat64Time.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAfloat64Time.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAfloat64TimeFactory.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAfloat64TimeFactory.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAinteger64Interval.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAinteger64Interval.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAinteger64Time.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAinteger64Time.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAinteger64TimeFactory.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAinteger64TimeFactory.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAlogicalTimeFactoryFactory.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAlogicalTimeFactoryFactory.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAopaqueData.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAopaqueData.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAvariableArray.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAvariableArray.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/HLAvariantRecord.cpp.o"
+  "CMakeFiles/rti1516e.dir/HLAvariantRecord.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/Handle.cpp.o"
+  "CMakeFiles/rti1516e.dir/Handle.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/LogicalTime.cpp.o"
+  "CMakeFiles/rti1516e.dir/LogicalTime.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/LogicalTimeFactory.cpp.o"
+  "CMakeFiles/rti1516e.dir/LogicalTimeFactory.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/LogicalTimeInterval.cpp.o"
+  "CMakeFiles/rti1516e.dir/LogicalTimeInterval.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/NullFederateAmbassador.cpp.o"
+  "CMakeFiles/rti1516e.dir/NullFederateAmbassador.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/RTI1516ELogicalTimeFactory.cpp.o"
+  "CMakeFiles/rti1516e.dir/RTI1516ELogicalTimeFactory.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/RTIambassador.cpp.o"
+  "CMakeFiles/rti1516e.dir/RTIambassador.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/RTIambassadorFactory.cpp.o"
+  "CMakeFiles/rti1516e.dir/RTIambassadorFactory.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/RTIambassadorImplementation.cpp.o"
+  "CMakeFiles/rti1516e.dir/RTIambassadorImplementation.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/RangeBounds.cpp.o"
+  "CMakeFiles/rti1516e.dir/RangeBounds.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/Typedefs.cpp.o"
+  "CMakeFiles/rti1516e.dir/Typedefs.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/VariableLengthData.cpp.o"
+  "CMakeFiles/rti1516e.dir/VariableLengthData.cpp.o.d"
+  "CMakeFiles/rti1516e.dir/Version.cpp.o"
+  "CMakeFiles/rti1516e.dir/Version.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rti1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
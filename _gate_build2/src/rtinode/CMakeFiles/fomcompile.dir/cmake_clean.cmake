@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/fomcompile"
+  "../../bin/fomcompile.pdb"
+  "CMakeFiles/fomcompile.dir/fomcompile.cpp.o"
+  "CMakeFiles/fomcompile.dir/fomcompile.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fomcompile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/rtinode"
+  "../../bin/rtinode.pdb"
+  "CMakeFiles/rtinode.dir/rtinode.cpp.o"
+  "CMakeFiles/rtinode.dir/rtinode.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rtinode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
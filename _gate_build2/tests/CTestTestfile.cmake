@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_gate_build2/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("OpenRTI")
+subdirs("RTI13")
+subdirs("rti1516")
+subdirs("rti1516e")
+subdirs("python")
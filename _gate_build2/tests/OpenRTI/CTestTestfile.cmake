@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("bench")
+subdirs("delta")
+subdirs("encodedmessage")
+subdirs("fomcompiled")
+subdirs("fommodulecache")
+subdirs("fragment")
+subdirs("lanes")
+subdirs("metrics")
+subdirs("network")
+subdirs("threads")
+subdirs("timestamporderqueue")
+subdirs("trace")
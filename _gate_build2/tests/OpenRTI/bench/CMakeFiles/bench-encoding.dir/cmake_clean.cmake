@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bench-encoding"
+  "../../../bin/bench-encoding.pdb"
+  "CMakeFiles/bench-encoding.dir/encoding.cpp.o"
+  "CMakeFiles/bench-encoding.dir/encoding.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-encoding.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bench-latency"
+  "../../../bin/bench-latency.pdb"
+  "CMakeFiles/bench-latency.dir/latency.cpp.o"
+  "CMakeFiles/bench-latency.dir/latency.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-latency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bench-queue"
+  "../../../bin/bench-queue.pdb"
+  "CMakeFiles/bench-queue.dir/queue.cpp.o"
+  "CMakeFiles/bench-queue.dir/queue.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bench-servernode"
+  "../../../bin/bench-servernode.pdb"
+  "CMakeFiles/bench-servernode.dir/servernode.cpp.o"
+  "CMakeFiles/bench-servernode.dir/servernode.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-servernode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bench-stream"
+  "../../../bin/bench-stream.pdb"
+  "CMakeFiles/bench-stream.dir/stream.cpp.o"
+  "CMakeFiles/bench-stream.dir/stream.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
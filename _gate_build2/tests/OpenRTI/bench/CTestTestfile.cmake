@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/bench
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/bench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/bench-encoding "/root/repo/_gate_build2/bin/bench-encoding" "-o" "/root/repo/_gate_build2/tests/OpenRTI/bench/encoding.json")
+set_tests_properties(OpenRTI/bench-encoding PROPERTIES  LABELS "bench" _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/bench/CMakeLists.txt;12;add_test;/root/repo/tests/OpenRTI/bench/CMakeLists.txt;0;")
+add_test(OpenRTI/bench-stream "/root/repo/_gate_build2/bin/bench-stream" "-o" "/root/repo/_gate_build2/tests/OpenRTI/bench/stream.json")
+set_tests_properties(OpenRTI/bench-stream PROPERTIES  LABELS "bench" _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/bench/CMakeLists.txt;16;add_test;/root/repo/tests/OpenRTI/bench/CMakeLists.txt;0;")
+add_test(OpenRTI/bench-queue "/root/repo/_gate_build2/bin/bench-queue" "-o" "/root/repo/_gate_build2/tests/OpenRTI/bench/queue.json")
+set_tests_properties(OpenRTI/bench-queue PROPERTIES  LABELS "bench" _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/bench/CMakeLists.txt;20;add_test;/root/repo/tests/OpenRTI/bench/CMakeLists.txt;0;")
+add_test(OpenRTI/bench-servernode "/root/repo/_gate_build2/bin/bench-servernode" "-O" "/root/repo/tests/OpenRTI/bench/fdd.xml" "-o" "/root/repo/_gate_build2/tests/OpenRTI/bench/servernode.json")
+set_tests_properties(OpenRTI/bench-servernode PROPERTIES  LABELS "bench" _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/bench/CMakeLists.txt;24;add_test;/root/repo/tests/OpenRTI/bench/CMakeLists.txt;0;")
+add_test(OpenRTI/bench-latency-thread "/root/repo/_gate_build2/bin/bench-latency" "-P" "thread" "-O" "/root/repo/tests/OpenRTI/bench/fdd.xml" "-o" "/root/repo/_gate_build2/tests/OpenRTI/bench/latency-thread.json")
+set_tests_properties(OpenRTI/bench-latency-thread PROPERTIES  LABELS "bench" _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/bench/CMakeLists.txt;38;add_test;/root/repo/tests/OpenRTI/bench/CMakeLists.txt;0;")
+add_test(OpenRTI/bench-latency-rti "/root/repo/_gate_build2/bin/bench-latency" "-P" "rti" "-O" "/root/repo/tests/OpenRTI/bench/fdd.xml" "-o" "/root/repo/_gate_build2/tests/OpenRTI/bench/latency-rti.json")
+set_tests_properties(OpenRTI/bench-latency-rti PROPERTIES  LABELS "bench" _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/bench/CMakeLists.txt;39;add_test;/root/repo/tests/OpenRTI/bench/CMakeLists.txt;0;")
+add_test(OpenRTI/bench-latency-pipe "/root/repo/_gate_build2/bin/bench-latency" "-P" "pipe" "-O" "/root/repo/tests/OpenRTI/bench/fdd.xml" "-o" "/root/repo/_gate_build2/tests/OpenRTI/bench/latency-pipe.json")
+set_tests_properties(OpenRTI/bench-latency-pipe PROPERTIES  LABELS "bench" _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/bench/CMakeLists.txt;42;add_test;/root/repo/tests/OpenRTI/bench/CMakeLists.txt;0;")
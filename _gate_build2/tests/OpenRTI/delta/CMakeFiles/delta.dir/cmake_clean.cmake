@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/delta"
+  "../../../bin/delta.pdb"
+  "CMakeFiles/delta.dir/delta.cpp.o"
+  "CMakeFiles/delta.dir/delta.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/delta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/delta
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/delta
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/delta "/root/repo/_gate_build2/bin/delta")
+set_tests_properties(OpenRTI/delta PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/delta/CMakeLists.txt;12;add_test;/root/repo/tests/OpenRTI/delta/CMakeLists.txt;0;")
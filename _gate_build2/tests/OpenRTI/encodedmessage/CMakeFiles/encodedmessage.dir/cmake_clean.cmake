@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/encodedmessage"
+  "../../../bin/encodedmessage.pdb"
+  "CMakeFiles/encodedmessage.dir/encodedmessage.cpp.o"
+  "CMakeFiles/encodedmessage.dir/encodedmessage.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/encodedmessage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/encodedmessage
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/encodedmessage
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/encodedmessage "/root/repo/_gate_build2/bin/encodedmessage")
+set_tests_properties(OpenRTI/encodedmessage PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/encodedmessage/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/encodedmessage/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/fomcompiled"
+  "../../../bin/fomcompiled.pdb"
+  "CMakeFiles/fomcompiled.dir/fomcompiled.cpp.o"
+  "CMakeFiles/fomcompiled.dir/fomcompiled.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fomcompiled.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
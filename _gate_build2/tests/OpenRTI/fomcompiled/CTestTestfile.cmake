@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/fomcompiled
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/fomcompiled
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/fomcompiled "/root/repo/_gate_build2/bin/fomcompiled")
+set_tests_properties(OpenRTI/fomcompiled PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/fomcompiled/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/fomcompiled/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/fommodulecache"
+  "../../../bin/fommodulecache.pdb"
+  "CMakeFiles/fommodulecache.dir/fommodulecache.cpp.o"
+  "CMakeFiles/fommodulecache.dir/fommodulecache.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fommodulecache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
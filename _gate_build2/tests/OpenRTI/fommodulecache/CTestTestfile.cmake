@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/fommodulecache
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/fommodulecache
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/fommodulecache "/root/repo/_gate_build2/bin/fommodulecache")
+set_tests_properties(OpenRTI/fommodulecache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/fommodulecache/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/fommodulecache/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/fragment"
+  "../../../bin/fragment.pdb"
+  "CMakeFiles/fragment.dir/fragment.cpp.o"
+  "CMakeFiles/fragment.dir/fragment.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fragment.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/fragment
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/fragment
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/fragment "/root/repo/_gate_build2/bin/fragment")
+set_tests_properties(OpenRTI/fragment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/fragment/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/fragment/CMakeLists.txt;0;")
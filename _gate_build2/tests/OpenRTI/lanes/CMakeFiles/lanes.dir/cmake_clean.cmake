@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/lanes"
+  "../../../bin/lanes.pdb"
+  "CMakeFiles/lanes.dir/lanes.cpp.o"
+  "CMakeFiles/lanes.dir/lanes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lanes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
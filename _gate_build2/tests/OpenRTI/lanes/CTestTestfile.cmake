@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/lanes
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/lanes
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/lanes "/root/repo/_gate_build2/bin/lanes")
+set_tests_properties(OpenRTI/lanes PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/lanes/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/lanes/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/metrics"
+  "../../../bin/metrics.pdb"
+  "CMakeFiles/metrics.dir/metrics.cpp.o"
+  "CMakeFiles/metrics.dir/metrics.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metrics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/metrics
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/metrics
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/metrics "/root/repo/_gate_build2/bin/metrics")
+set_tests_properties(OpenRTI/metrics PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/metrics/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/metrics/CMakeLists.txt;0;")
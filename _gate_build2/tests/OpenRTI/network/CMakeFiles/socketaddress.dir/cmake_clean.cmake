@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/socketaddress"
+  "../../../bin/socketaddress.pdb"
+  "CMakeFiles/socketaddress.dir/socketaddress.cpp.o"
+  "CMakeFiles/socketaddress.dir/socketaddress.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/socketaddress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
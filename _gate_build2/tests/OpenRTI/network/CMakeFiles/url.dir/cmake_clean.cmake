@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/url"
+  "../../../bin/url.pdb"
+  "CMakeFiles/url.dir/url.cpp.o"
+  "CMakeFiles/url.dir/url.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/url.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
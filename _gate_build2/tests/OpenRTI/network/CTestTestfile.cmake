@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/network
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/network
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/socketaddress "/root/repo/_gate_build2/bin/socketaddress")
+set_tests_properties(OpenRTI/socketaddress PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/network/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/network/CMakeLists.txt;0;")
+add_test(OpenRTI/url "/root/repo/_gate_build2/bin/url")
+set_tests_properties(OpenRTI/url PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/network/CMakeLists.txt;12;add_test;/root/repo/tests/OpenRTI/network/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/threads"
+  "../../../bin/threads.pdb"
+  "CMakeFiles/threads.dir/threads.cpp.o"
+  "CMakeFiles/threads.dir/threads.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threads.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
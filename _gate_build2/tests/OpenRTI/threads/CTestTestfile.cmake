@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/threads
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/threads
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/threads-1 "/root/repo/_gate_build2/bin/threads")
+set_tests_properties(OpenRTI/threads-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/threads/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/threads/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/timestamporderqueue"
+  "../../../bin/timestamporderqueue.pdb"
+  "CMakeFiles/timestamporderqueue.dir/timestamporderqueue.cpp.o"
+  "CMakeFiles/timestamporderqueue.dir/timestamporderqueue.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timestamporderqueue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
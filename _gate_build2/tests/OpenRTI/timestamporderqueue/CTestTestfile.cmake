@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/timestamporderqueue
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/timestamporderqueue
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/timestamporderqueue "/root/repo/_gate_build2/bin/timestamporderqueue")
+set_tests_properties(OpenRTI/timestamporderqueue PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/timestamporderqueue/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/timestamporderqueue/CMakeLists.txt;0;")
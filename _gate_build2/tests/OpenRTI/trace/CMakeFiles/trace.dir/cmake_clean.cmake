@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/trace"
+  "../../../bin/trace.pdb"
+  "CMakeFiles/trace.dir/trace.cpp.o"
+  "CMakeFiles/trace.dir/trace.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trace.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
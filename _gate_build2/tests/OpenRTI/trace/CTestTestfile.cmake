@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/OpenRTI/trace
+# Build directory: /root/repo/_gate_build2/tests/OpenRTI/trace
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(OpenRTI/trace "/root/repo/_gate_build2/bin/trace")
+set_tests_properties(OpenRTI/trace PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/OpenRTI/trace/CMakeLists.txt;7;add_test;/root/repo/tests/OpenRTI/trace/CMakeLists.txt;0;")
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/RTI13
+# Build directory: /root/repo/_gate_build2/tests/RTI13
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("link")
+subdirs("fddget")
+subdirs("time")
+subdirs("valueset")
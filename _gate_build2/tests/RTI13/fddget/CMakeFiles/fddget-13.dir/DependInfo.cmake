@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/RTI13/fddget/fddget.cpp" "tests/RTI13/fddget/CMakeFiles/fddget-13.dir/fddget.cpp.o" "gcc" "tests/RTI13/fddget/CMakeFiles/fddget-13.dir/fddget.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build2/src/RTI13/CMakeFiles/FedTime.dir/DependInfo.cmake"
+  "/root/repo/_gate_build2/src/RTI13/CMakeFiles/RTI-NG.dir/DependInfo.cmake"
+  "/root/repo/_gate_build2/src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/fddget-13"
+  "../../../bin/fddget-13.pdb"
+  "CMakeFiles/fddget-13.dir/fddget.cpp.o"
+  "CMakeFiles/fddget-13.dir/fddget.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fddget-13.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/RTI13/fddget
+# Build directory: /root/repo/_gate_build2/tests/RTI13/fddget
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti13/fddget-13-1 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-1.fed" "-o" "objectRoot" "-a" "privilegeToDelete" "-i" "interactionRoot")
+set_tests_properties(rti13/fddget-13-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;9;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-2 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-1.fed" "-o" "ObjectClass1" "-a" "privilegeToDelete" "-a" "Attribute1" "-i" "InteractionClass1" "-p" "Parameter1")
+set_tests_properties(rti13/fddget-13-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;12;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-3 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-1.fed" "-o" "objectRoot.ObjectClass1" "-a" "privilegeToDelete" "-a" "objectRoot.ObjectClass1.Attribute1" "-i" "interactionRoot.InteractionClass1" "-p" "interactionRoot.InteractionClass1.Parameter1")
+set_tests_properties(rti13/fddget-13-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;15;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-4 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-1.fed" "-o" "ObjectClass2" "-a" "privilegeToDelete" "-a" "Attribute1" "-a" "Attribute2" "-i" "InteractionClass2" "-p" "Parameter1" "-p" "Parameter2")
+set_tests_properties(rti13/fddget-13-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;19;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-5 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-1.fed" "-o" "objectRoot.ObjectClass1.ObjectClass2" "-a" "privilegeToDelete" "-a" "objectRoot.ObjectClass1.Attribute1" "-a" "objectRoot.ObjectClass1.ObjectClass2.Attribute2" "-i" "interactionRoot.InteractionClass1.InteractionClass2" "-p" "interactionRoot.InteractionClass1.Parameter1" "-p" "interactionRoot.InteractionClass1.InteractionClass2.Parameter2")
+set_tests_properties(rti13/fddget-13-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;22;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-6 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-1.fed" "-o" "ObjectClass3" "-a" "privilegeToDelete" "-a" "Attribute3" "-i" "InteractionClass3" "-p" "Parameter3")
+set_tests_properties(rti13/fddget-13-6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;26;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-7 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-1.fed" "-o" "objectRoot.ObjectClass3" "-a" "privilegeToDelete" "-a" "objectRoot.ObjectClass3.Attribute3" "-i" "interactionRoot.InteractionClass3" "-p" "interactionRoot.InteractionClass3.Parameter3")
+set_tests_properties(rti13/fddget-13-7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;29;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-11 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-2.fed" "-o" "objectRoot" "-a" "privilegeToDelete" "-i" "interactionRoot")
+set_tests_properties(rti13/fddget-13-11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;34;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-12 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-2.fed" "-o" "ObjectClass1" "-a" "privilegeToDelete" "-a" "Attribute1" "-i" "InteractionClass1" "-p" "Parameter1")
+set_tests_properties(rti13/fddget-13-12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;37;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-13 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-2.fed" "-o" "ObjectClass1" "-a" "privilegeToDelete" "-a" "ObjectClass1.Attribute1" "-i" "InteractionClass1" "-p" "InteractionClass1.Parameter1")
+set_tests_properties(rti13/fddget-13-13 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;40;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-14 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-2.fed" "-o" "ObjectClass2" "-a" "privilegeToDelete" "-a" "Attribute1" "-a" "Attribute2" "-i" "InteractionClass2" "-p" "Parameter1" "-p" "Parameter2")
+set_tests_properties(rti13/fddget-13-14 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;44;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-15 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-2.fed" "-o" "ObjectClass1.ObjectClass2" "-a" "privilegeToDelete" "-a" "ObjectClass1.Attribute1" "-a" "ObjectClass1.ObjectClass2.Attribute2" "-i" "InteractionClass1.InteractionClass2" "-p" "InteractionClass1.Parameter1" "-p" "InteractionClass1.InteractionClass2.Parameter2")
+set_tests_properties(rti13/fddget-13-15 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;47;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-16 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-2.fed" "-o" "ObjectClass3" "-a" "privilegeToDelete" "-a" "Attribute3" "-i" "InteractionClass3" "-p" "Parameter3")
+set_tests_properties(rti13/fddget-13-16 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;51;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-17 "/root/repo/_gate_build2/bin/fddget-13" "-O" "/root/repo/tests/RTI13/fddget/fdd-2.fed" "-o" "ObjectClass3" "-a" "privilegeToDelete" "-a" "ObjectClass3.Attribute3" "-i" "InteractionClass3" "-p" "InteractionClass3.Parameter3")
+set_tests_properties(rti13/fddget-13-17 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;54;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
+add_test(rti13/fddget-13-20 "/root/repo/_gate_build2/bin/fddget-13" "-D" "-O" "/root/repo/tests/RTI13/fddget/fdd-2.fed" "-o" "ObjectClass3" "-a" "privilegeToDelete" "-a" "Attribute3" "-i" "InteractionClass3" "-p" "Parameter3")
+set_tests_properties(rti13/fddget-13-20 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/fddget/CMakeLists.txt;59;add_test;/root/repo/tests/RTI13/fddget/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/link-13"
+  "../../../bin/link-13.pdb"
+  "CMakeFiles/link-13.dir/link.cpp.o"
+  "CMakeFiles/link-13.dir/link.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/link-13.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
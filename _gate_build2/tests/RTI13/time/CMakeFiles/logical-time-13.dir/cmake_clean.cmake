@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logical-time-13"
+  "../../../bin/logical-time-13.pdb"
+  "CMakeFiles/logical-time-13.dir/logical-time.cpp.o"
+  "CMakeFiles/logical-time-13.dir/logical-time.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logical-time-13.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/valueset-13"
+  "../../../bin/valueset-13.pdb"
+  "CMakeFiles/valueset-13.dir/valueset.cpp.o"
+  "CMakeFiles/valueset-13.dir/valueset.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/valueset-13.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/RTI13/valueset
+# Build directory: /root/repo/_gate_build2/tests/RTI13/valueset
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti13/valueset-13-1 "/root/repo/_gate_build2/bin/valueset-13" "-O" "/root/repo/tests/RTI13/valueset/fdd.fed")
+set_tests_properties(rti13/valueset-13-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/RTI13/valueset/CMakeLists.txt;5;add_test;/root/repo/tests/RTI13/valueset/CMakeLists.txt;0;")
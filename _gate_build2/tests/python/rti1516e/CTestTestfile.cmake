@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/python/rti1516e
+# Build directory: /root/repo/_gate_build2/tests/python/rti1516e
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(python/rti1516e-callbacks-1 "/root/.pyenv/shims/python3" "/root/repo/tests/python/rti1516e/callbacks.py" "/root/repo/tests/python/rti1516e/fdd.xml")
+set_tests_properties(python/rti1516e-callbacks-1 PROPERTIES  ENVIRONMENT "PYTHONPATH=/root/repo/_gate_build2/lib/python3.11/site-packages" _BACKTRACE_TRIPLES "/root/repo/tests/python/rti1516e/CMakeLists.txt;2;add_test;/root/repo/tests/python/rti1516e/CMakeLists.txt;0;")
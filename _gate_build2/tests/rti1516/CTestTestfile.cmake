@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516
+# Build directory: /root/repo/_gate_build2/tests/rti1516
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("link")
+subdirs("connect")
+subdirs("create")
+subdirs("join")
+subdirs("fddget")
+subdirs("sync")
+subdirs("time")
+subdirs("interaction")
+subdirs("objectinstance")
+subdirs("save")
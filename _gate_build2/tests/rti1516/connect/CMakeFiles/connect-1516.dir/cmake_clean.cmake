@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/connect-1516"
+  "../../../bin/connect-1516.pdb"
+  "CMakeFiles/connect-1516.dir/connect.cpp.o"
+  "CMakeFiles/connect-1516.dir/connect.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/connect-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
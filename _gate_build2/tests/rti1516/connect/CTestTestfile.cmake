@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516/connect
+# Build directory: /root/repo/_gate_build2/tests/rti1516/connect
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516/connect-1516-1 "/root/repo/_gate_build2/bin/connect-1516" "-O" "/root/repo/tests/rti1516/fdd.xml")
+set_tests_properties(rti1516/connect-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/connect/CMakeLists.txt;6;add_test;/root/repo/tests/rti1516/connect/CMakeLists.txt;0;")
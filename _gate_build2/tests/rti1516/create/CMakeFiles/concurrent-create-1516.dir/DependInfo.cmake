@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/rti1516/create/concurrent-create.cpp" "tests/rti1516/create/CMakeFiles/concurrent-create-1516.dir/concurrent-create.cpp.o" "gcc" "tests/rti1516/create/CMakeFiles/concurrent-create-1516.dir/concurrent-create.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build2/src/rti1516/CMakeFiles/fedtime1516.dir/DependInfo.cmake"
+  "/root/repo/_gate_build2/src/rti1516/CMakeFiles/rti1516.dir/DependInfo.cmake"
+  "/root/repo/_gate_build2/src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/concurrent-create-1516"
+  "../../../bin/concurrent-create-1516.pdb"
+  "CMakeFiles/concurrent-create-1516.dir/concurrent-create.cpp.o"
+  "CMakeFiles/concurrent-create-1516.dir/concurrent-create.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrent-create-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
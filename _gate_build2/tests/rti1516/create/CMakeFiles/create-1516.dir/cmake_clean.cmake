@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/create-1516"
+  "../../../bin/create-1516.pdb"
+  "CMakeFiles/create-1516.dir/create.cpp.o"
+  "CMakeFiles/create-1516.dir/create.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/create-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/fddget-1516"
+  "../../../bin/fddget-1516.pdb"
+  "CMakeFiles/fddget-1516.dir/fddget.cpp.o"
+  "CMakeFiles/fddget-1516.dir/fddget.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fddget-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
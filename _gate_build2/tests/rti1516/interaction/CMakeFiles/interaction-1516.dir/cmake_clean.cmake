@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/interaction-1516"
+  "../../../bin/interaction-1516.pdb"
+  "CMakeFiles/interaction-1516.dir/interaction.cpp.o"
+  "CMakeFiles/interaction-1516.dir/interaction.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interaction-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516/interaction
+# Build directory: /root/repo/_gate_build2/tests/rti1516/interaction
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516/interaction-1516-1 "/root/repo/_gate_build2/bin/interaction-1516" "-S0" "-A1" "-O" "/root/repo/tests/rti1516/interaction/fdd.xml")
+set_tests_properties(rti1516/interaction-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/interaction/CMakeLists.txt;6;add_test;/root/repo/tests/rti1516/interaction/CMakeLists.txt;0;")
+add_test(rti1516/interaction-1516-2 "/root/repo/_gate_build2/bin/interaction-1516" "-S0" "-A10" "-O" "/root/repo/tests/rti1516/interaction/fdd.xml")
+set_tests_properties(rti1516/interaction-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/interaction/CMakeLists.txt;8;add_test;/root/repo/tests/rti1516/interaction/CMakeLists.txt;0;")
+add_test(rti1516/interaction-1516-3 "/root/repo/_gate_build2/bin/interaction-1516" "-S1" "-A1" "-J" "-O" "/root/repo/tests/rti1516/interaction/fdd.xml")
+set_tests_properties(rti1516/interaction-1516-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/interaction/CMakeLists.txt;10;add_test;/root/repo/tests/rti1516/interaction/CMakeLists.txt;0;")
+add_test(rti1516/interaction-1516-4 "/root/repo/_gate_build2/bin/interaction-1516" "-S1" "-A10" "-J" "-O" "/root/repo/tests/rti1516/interaction/fdd.xml")
+set_tests_properties(rti1516/interaction-1516-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/interaction/CMakeLists.txt;12;add_test;/root/repo/tests/rti1516/interaction/CMakeLists.txt;0;")
+add_test(rti1516/interaction-1516-5 "/root/repo/_gate_build2/bin/interaction-1516" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/interaction/fdd.xml")
+set_tests_properties(rti1516/interaction-1516-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/interaction/CMakeLists.txt;14;add_test;/root/repo/tests/rti1516/interaction/CMakeLists.txt;0;")
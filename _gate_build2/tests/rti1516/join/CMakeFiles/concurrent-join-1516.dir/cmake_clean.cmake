@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/concurrent-join-1516"
+  "../../../bin/concurrent-join-1516.pdb"
+  "CMakeFiles/concurrent-join-1516.dir/concurrent-join.cpp.o"
+  "CMakeFiles/concurrent-join-1516.dir/concurrent-join.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrent-join-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/join-1516"
+  "../../../bin/join-1516.pdb"
+  "CMakeFiles/join-1516.dir/join.cpp.o"
+  "CMakeFiles/join-1516.dir/join.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/join-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
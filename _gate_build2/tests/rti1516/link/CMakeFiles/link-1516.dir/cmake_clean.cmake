@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/link-1516"
+  "../../../bin/link-1516.pdb"
+  "CMakeFiles/link-1516.dir/link.cpp.o"
+  "CMakeFiles/link-1516.dir/link.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/link-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
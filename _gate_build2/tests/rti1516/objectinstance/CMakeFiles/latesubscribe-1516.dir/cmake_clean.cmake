@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/latesubscribe-1516"
+  "../../../bin/latesubscribe-1516.pdb"
+  "CMakeFiles/latesubscribe-1516.dir/latesubscribe.cpp.o"
+  "CMakeFiles/latesubscribe-1516.dir/latesubscribe.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/latesubscribe-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
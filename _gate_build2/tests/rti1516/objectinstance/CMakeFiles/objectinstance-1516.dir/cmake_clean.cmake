@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/objectinstance-1516"
+  "../../../bin/objectinstance-1516.pdb"
+  "CMakeFiles/objectinstance-1516.dir/objectinstance.cpp.o"
+  "CMakeFiles/objectinstance-1516.dir/objectinstance.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/objectinstance-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
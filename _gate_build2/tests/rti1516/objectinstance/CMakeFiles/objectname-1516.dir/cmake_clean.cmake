@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/objectname-1516"
+  "../../../bin/objectname-1516.pdb"
+  "CMakeFiles/objectname-1516.dir/objectname.cpp.o"
+  "CMakeFiles/objectname-1516.dir/objectname.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/objectname-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516/objectinstance
+# Build directory: /root/repo/_gate_build2/tests/rti1516/objectinstance
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516/objectname-1516-1 "/root/repo/_gate_build2/bin/objectname-1516" "-S0" "-A1" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectname-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;14;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectname-1516-2 "/root/repo/_gate_build2/bin/objectname-1516" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectname-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;16;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectname-1516-3 "/root/repo/_gate_build2/bin/objectname-1516" "-S1" "-A1" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectname-1516-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;18;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectname-1516-4 "/root/repo/_gate_build2/bin/objectname-1516" "-S1" "-A10" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectname-1516-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;20;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectname-1516-5 "/root/repo/_gate_build2/bin/objectname-1516" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectname-1516-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;22;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectinstance-1516-1 "/root/repo/_gate_build2/bin/objectinstance-1516" "-S0" "-A1" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectinstance-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;25;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectinstance-1516-2 "/root/repo/_gate_build2/bin/objectinstance-1516" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectinstance-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;27;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectinstance-1516-3 "/root/repo/_gate_build2/bin/objectinstance-1516" "-S1" "-A1" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectinstance-1516-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;29;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectinstance-1516-4 "/root/repo/_gate_build2/bin/objectinstance-1516" "-S1" "-A10" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectinstance-1516-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;31;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/objectinstance-1516-5 "/root/repo/_gate_build2/bin/objectinstance-1516" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/objectinstance-1516-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;33;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/latesubscribe-1516-1 "/root/repo/_gate_build2/bin/latesubscribe-1516" "-S0" "-A3" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/latesubscribe-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;36;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/latesubscribe-1516-2 "/root/repo/_gate_build2/bin/latesubscribe-1516" "-S1" "-A3" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/latesubscribe-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;38;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
+add_test(rti1516/latesubscribe-1516-3 "/root/repo/_gate_build2/bin/latesubscribe-1516" "-S5" "-A3" "-J" "-O" "/root/repo/tests/rti1516/objectinstance/fdd.xml")
+set_tests_properties(rti1516/latesubscribe-1516-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;40;add_test;/root/repo/tests/rti1516/objectinstance/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/save-restore-1516"
+  "../../../bin/save-restore-1516.pdb"
+  "CMakeFiles/save-restore-1516.dir/save-restore.cpp.o"
+  "CMakeFiles/save-restore-1516.dir/save-restore.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/save-restore-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516/save
+# Build directory: /root/repo/_gate_build2/tests/rti1516/save
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516/save-restore-1516-1 "/root/repo/_gate_build2/bin/save-restore-1516" "-S1" "-A3" "-J" "-F" "SaveRestore1" "-O" "/root/repo/tests/rti1516/save/fdd.xml")
+set_tests_properties(rti1516/save-restore-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/save/CMakeLists.txt;7;add_test;/root/repo/tests/rti1516/save/CMakeLists.txt;0;")
+add_test(rti1516/save-restore-1516-2 "/root/repo/_gate_build2/bin/save-restore-1516" "-S5" "-A5" "-J" "-F" "SaveRestore2" "-O" "/root/repo/tests/rti1516/save/fdd.xml")
+set_tests_properties(rti1516/save-restore-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/save/CMakeLists.txt;9;add_test;/root/repo/tests/rti1516/save/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/sync-1516"
+  "../../../bin/sync-1516.pdb"
+  "CMakeFiles/sync-1516.dir/sync.cpp.o"
+  "CMakeFiles/sync-1516.dir/sync.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sync-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
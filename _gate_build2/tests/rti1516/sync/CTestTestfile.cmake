@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516/sync
+# Build directory: /root/repo/_gate_build2/tests/rti1516/sync
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516/sync-1516-1 "/root/repo/_gate_build2/bin/sync-1516" "-S0" "-A1" "-O" "/root/repo/tests/rti1516/fdd.xml")
+set_tests_properties(rti1516/sync-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/sync/CMakeLists.txt;5;add_test;/root/repo/tests/rti1516/sync/CMakeLists.txt;0;")
+add_test(rti1516/sync-1516-2 "/root/repo/_gate_build2/bin/sync-1516" "-S0" "-A10" "-O" "/root/repo/tests/rti1516/fdd.xml")
+set_tests_properties(rti1516/sync-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/sync/CMakeLists.txt;7;add_test;/root/repo/tests/rti1516/sync/CMakeLists.txt;0;")
+add_test(rti1516/sync-1516-3 "/root/repo/_gate_build2/bin/sync-1516" "-S1" "-A1" "-O" "/root/repo/tests/rti1516/fdd.xml")
+set_tests_properties(rti1516/sync-1516-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/sync/CMakeLists.txt;9;add_test;/root/repo/tests/rti1516/sync/CMakeLists.txt;0;")
+add_test(rti1516/sync-1516-4 "/root/repo/_gate_build2/bin/sync-1516" "-S1" "-A10" "-O" "/root/repo/tests/rti1516/fdd.xml")
+set_tests_properties(rti1516/sync-1516-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/sync/CMakeLists.txt;11;add_test;/root/repo/tests/rti1516/sync/CMakeLists.txt;0;")
+add_test(rti1516/sync-1516-5 "/root/repo/_gate_build2/bin/sync-1516" "-S5" "-A10" "-O" "/root/repo/tests/rti1516/fdd.xml")
+set_tests_properties(rti1516/sync-1516-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/sync/CMakeLists.txt;13;add_test;/root/repo/tests/rti1516/sync/CMakeLists.txt;0;")
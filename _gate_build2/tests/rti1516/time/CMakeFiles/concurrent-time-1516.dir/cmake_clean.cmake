@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/concurrent-time-1516"
+  "../../../bin/concurrent-time-1516.pdb"
+  "CMakeFiles/concurrent-time-1516.dir/concurrent-time.cpp.o"
+  "CMakeFiles/concurrent-time-1516.dir/concurrent-time.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/concurrent-time-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
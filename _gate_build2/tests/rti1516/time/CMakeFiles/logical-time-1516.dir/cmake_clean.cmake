@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logical-time-1516"
+  "../../../bin/logical-time-1516.pdb"
+  "CMakeFiles/logical-time-1516.dir/logical-time.cpp.o"
+  "CMakeFiles/logical-time-1516.dir/logical-time.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logical-time-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/pipeline-time-1516"
+  "../../../bin/pipeline-time-1516.pdb"
+  "CMakeFiles/pipeline-time-1516.dir/pipeline-time.cpp.o"
+  "CMakeFiles/pipeline-time-1516.dir/pipeline-time.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pipeline-time-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
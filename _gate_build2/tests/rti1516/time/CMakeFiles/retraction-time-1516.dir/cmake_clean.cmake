@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/retraction-time-1516"
+  "../../../bin/retraction-time-1516.pdb"
+  "CMakeFiles/retraction-time-1516.dir/retraction-time.cpp.o"
+  "CMakeFiles/retraction-time-1516.dir/retraction-time.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/retraction-time-1516.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
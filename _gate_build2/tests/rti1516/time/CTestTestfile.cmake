@@ -0,0 +1,134 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516/time
+# Build directory: /root/repo/_gate_build2/tests/rti1516/time
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516/logical-time-1516-1 "/root/repo/_gate_build2/bin/logical-time-1516")
+set_tests_properties(rti1516/logical-time-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;5;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/logical-time-1516-2 "/root/repo/_gate_build2/bin/logical-time-1516" "-F" "HLAfloat64Time")
+set_tests_properties(rti1516/logical-time-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;6;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/logical-time-1516-3 "/root/repo/_gate_build2/bin/logical-time-1516" "-F" "HLAinteger64Time")
+set_tests_properties(rti1516/logical-time-1516-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;7;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/logical-time-1516-4 "/root/repo/_gate_build2/bin/logical-time-1516" "-F" "certiFedTime1516")
+set_tests_properties(rti1516/logical-time-1516-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;8;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/logical-time-1516-5 "/root/repo/_gate_build2/bin/logical-time-1516" "-F" "CERTI")
+set_tests_properties(rti1516/logical-time-1516-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;9;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/opaque-time-1516-1 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-S0" "-N0" "-A2" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml" "force-opaque-time")
+set_tests_properties(rti1516/opaque-time-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;16;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-2 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N0" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;21;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-5 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N0" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;27;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-7 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N0" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;32;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-10 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N0" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;38;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-12 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N1" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;43;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-15 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N1" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-15 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;49;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-17 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N1" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-17 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;54;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-20 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N1" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-20 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;60;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-22 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N2" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-22 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;65;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-25 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N2" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-25 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;71;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-27 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N2" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-27 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;76;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-30 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N2" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-30 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;82;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-32 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N3" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;87;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-35 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N3" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-35 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;93;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-37 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N3" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-37 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;98;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-40 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N3" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-40 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;104;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-42 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N4" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-42 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;109;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-45 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N4" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-45 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;115;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-47 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N4" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-47 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;120;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-50 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N4" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-50 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;126;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-52 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N5" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-52 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;132;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-55 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L0" "-N5" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-55 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;138;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-57 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N5" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-57 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;143;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/concurrent-time-1516-60 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N5" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/concurrent-time-1516-60 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;149;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-2 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N0" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;156;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-5 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N0" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;162;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-7 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N0" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;167;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-10 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N0" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;173;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-12 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N1" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;178;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-15 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N1" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-15 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;184;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-17 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N1" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-17 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;189;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-20 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N1" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-20 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;195;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-22 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N2" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-22 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;200;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-25 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N2" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-25 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;206;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-27 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N2" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-27 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;211;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-30 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N2" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-30 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;217;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-32 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N3" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;222;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-35 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N3" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-35 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;228;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-37 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N3" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-37 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;233;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-40 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N3" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-40 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;239;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-42 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N4" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-42 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;244;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-45 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N4" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-45 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;250;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-47 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N4" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-47 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;255;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-50 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N4" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-50 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;261;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-52 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N5" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-52 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;267;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-55 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N5" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-55 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;273;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-57 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N5" "-S0" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-57 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;278;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/messages-time-1516-60 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N5" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/messages-time-1516-60 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;284;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/barrier-time-1516-1 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N0" "-S1" "-A10" "-B" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/barrier-time-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;288;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/barrier-time-1516-2 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-I0" "-U0" "-L1" "-N0" "-S5" "-A10" "-B" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/barrier-time-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;290;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/barrier-time-1516-3 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N0" "-S5" "-A10" "-B" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/barrier-time-1516-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;292;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/barrier-time-1516-4 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L0" "-N5" "-S5" "-A10" "-B" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/barrier-time-1516-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;294;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/barrier-time-1516-5 "/root/repo/_gate_build2/bin/concurrent-time-1516" "-L1" "-N5" "-S5" "-A10" "-B" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/barrier-time-1516-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;295;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/pipeline-time-1516-1 "/root/repo/_gate_build2/bin/pipeline-time-1516" "-S1" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/pipeline-time-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;302;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/pipeline-time-1516-2 "/root/repo/_gate_build2/bin/pipeline-time-1516" "-S1" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml" "commitCoalescing=true")
+set_tests_properties(rti1516/pipeline-time-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;304;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/pipeline-time-1516-3 "/root/repo/_gate_build2/bin/pipeline-time-1516" "-S5" "-A10" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml" "commitCoalescing=true")
+set_tests_properties(rti1516/pipeline-time-1516-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;306;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/retraction-time-1516-1 "/root/repo/_gate_build2/bin/retraction-time-1516" "-S1" "-A5" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/retraction-time-1516-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;313;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
+add_test(rti1516/retraction-time-1516-2 "/root/repo/_gate_build2/bin/retraction-time-1516" "-S5" "-A5" "-J" "-O" "/root/repo/tests/rti1516/time/fdd.xml")
+set_tests_properties(rti1516/retraction-time-1516-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516/time/CMakeLists.txt;315;add_test;/root/repo/tests/rti1516/time/CMakeLists.txt;0;")
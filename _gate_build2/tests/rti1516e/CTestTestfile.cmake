@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516e
+# Build directory: /root/repo/_gate_build2/tests/rti1516e
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("link")
+subdirs("encode")
+subdirs("decode")
+subdirs("datatypes")
+subdirs("fddget")
+subdirs("time")
+subdirs("modules")
+subdirs("updaterate")
+subdirs("transportation")
+subdirs("attributecache")
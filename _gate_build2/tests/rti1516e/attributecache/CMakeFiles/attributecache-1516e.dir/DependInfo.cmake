@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/rti1516e/attributecache/attributecache.cpp" "tests/rti1516e/attributecache/CMakeFiles/attributecache-1516e.dir/attributecache.cpp.o" "gcc" "tests/rti1516e/attributecache/CMakeFiles/attributecache-1516e.dir/attributecache.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build2/src/rti1516e/CMakeFiles/fedtime1516e.dir/DependInfo.cmake"
+  "/root/repo/_gate_build2/src/rti1516e/CMakeFiles/rti1516e.dir/DependInfo.cmake"
+  "/root/repo/_gate_build2/src/OpenRTI/CMakeFiles/OpenRTI.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/attributecache-1516e"
+  "../../../bin/attributecache-1516e.pdb"
+  "CMakeFiles/attributecache-1516e.dir/attributecache.cpp.o"
+  "CMakeFiles/attributecache-1516e.dir/attributecache.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/attributecache-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/datatypes-1516e"
+  "../../../bin/datatypes-1516e.pdb"
+  "CMakeFiles/datatypes-1516e.dir/datatypes.cpp.o"
+  "CMakeFiles/datatypes-1516e.dir/datatypes.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/datatypes-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
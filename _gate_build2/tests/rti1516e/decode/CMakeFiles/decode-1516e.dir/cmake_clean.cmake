@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/decode-1516e"
+  "../../../bin/decode-1516e.pdb"
+  "CMakeFiles/decode-1516e.dir/decode.cpp.o"
+  "CMakeFiles/decode-1516e.dir/decode.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/decode-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516e/decode
+# Build directory: /root/repo/_gate_build2/tests/rti1516e/decode
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516e/decode-1516e "/root/repo/_gate_build2/bin/decode-1516e")
+set_tests_properties(rti1516e/decode-1516e PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/decode/CMakeLists.txt;4;add_test;/root/repo/tests/rti1516e/decode/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/encode-1516e"
+  "../../../bin/encode-1516e.pdb"
+  "CMakeFiles/encode-1516e.dir/encode.cpp.o"
+  "CMakeFiles/encode-1516e.dir/encode.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/encode-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
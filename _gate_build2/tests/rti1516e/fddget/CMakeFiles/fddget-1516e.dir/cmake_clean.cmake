@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/fddget-1516e"
+  "../../../bin/fddget-1516e.pdb"
+  "CMakeFiles/fddget-1516e.dir/fddget.cpp.o"
+  "CMakeFiles/fddget-1516e.dir/fddget.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fddget-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516e/fddget
+# Build directory: /root/repo/_gate_build2/tests/rti1516e/fddget
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516e/fddget-1516e-1 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-1.xml" "-o" "HLAobjectRoot" "-a" "HLAprivilegeToDeleteObject" "-i" "HLAinteractionRoot")
+set_tests_properties(rti1516e/fddget-1516e-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;9;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-2 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-1.xml" "-o" "ObjectClass1" "-a" "HLAprivilegeToDeleteObject" "-a" "Attribute1" "-i" "InteractionClass1" "-p" "Parameter1")
+set_tests_properties(rti1516e/fddget-1516e-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;12;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-3 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-1.xml" "-o" "HLAobjectRoot.ObjectClass1" "-a" "HLAprivilegeToDeleteObject" "-a" "HLAobjectRoot.ObjectClass1.Attribute1" "-i" "HLAinteractionRoot.InteractionClass1" "-p" "HLAinteractionRoot.InteractionClass1.Parameter1")
+set_tests_properties(rti1516e/fddget-1516e-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;15;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-4 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-1.xml" "-o" "ObjectClass2" "-a" "HLAprivilegeToDeleteObject" "-a" "Attribute1" "-a" "Attribute2" "-i" "InteractionClass2" "-p" "Parameter1" "-p" "Parameter2")
+set_tests_properties(rti1516e/fddget-1516e-4 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;19;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-5 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-1.xml" "-o" "HLAobjectRoot.ObjectClass1.ObjectClass2" "-a" "HLAprivilegeToDeleteObject" "-a" "HLAobjectRoot.ObjectClass1.Attribute1" "-a" "HLAobjectRoot.ObjectClass1.ObjectClass2.Attribute2" "-i" "HLAinteractionRoot.InteractionClass1.InteractionClass2" "-p" "HLAinteractionRoot.InteractionClass1.Parameter1" "-p" "HLAinteractionRoot.InteractionClass1.InteractionClass2.Parameter2")
+set_tests_properties(rti1516e/fddget-1516e-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;22;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-6 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-1.xml" "-o" "ObjectClass3" "-a" "HLAprivilegeToDeleteObject" "-a" "Attribute3" "-i" "InteractionClass3" "-p" "Parameter3")
+set_tests_properties(rti1516e/fddget-1516e-6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;26;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-7 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-1.xml" "-o" "HLAobjectRoot.ObjectClass3" "-a" "HLAprivilegeToDeleteObject" "-a" "HLAobjectRoot.ObjectClass3.Attribute3" "-i" "HLAinteractionRoot.InteractionClass3" "-p" "HLAinteractionRoot.InteractionClass3.Parameter3")
+set_tests_properties(rti1516e/fddget-1516e-7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;29;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-11 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-2.xml" "-o" "HLAobjectRoot" "-a" "HLAprivilegeToDeleteObject" "-i" "HLAinteractionRoot")
+set_tests_properties(rti1516e/fddget-1516e-11 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;34;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-12 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-2.xml" "-o" "ObjectClass1" "-a" "HLAprivilegeToDeleteObject" "-a" "Attribute1" "-i" "InteractionClass1" "-p" "Parameter1")
+set_tests_properties(rti1516e/fddget-1516e-12 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;37;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-13 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-2.xml" "-o" "ObjectClass1" "-a" "HLAprivilegeToDeleteObject" "-a" "ObjectClass1.Attribute1" "-i" "InteractionClass1" "-p" "InteractionClass1.Parameter1")
+set_tests_properties(rti1516e/fddget-1516e-13 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;40;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-14 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-2.xml" "-o" "ObjectClass2" "-a" "HLAprivilegeToDeleteObject" "-a" "Attribute1" "-a" "Attribute2" "-i" "InteractionClass2" "-p" "Parameter1" "-p" "Parameter2")
+set_tests_properties(rti1516e/fddget-1516e-14 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;44;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-15 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-2.xml" "-o" "ObjectClass1.ObjectClass2" "-a" "HLAprivilegeToDeleteObject" "-a" "ObjectClass1.Attribute1" "-a" "ObjectClass1.ObjectClass2.Attribute2" "-i" "InteractionClass1.InteractionClass2" "-p" "InteractionClass1.Parameter1" "-p" "InteractionClass1.InteractionClass2.Parameter2")
+set_tests_properties(rti1516e/fddget-1516e-15 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;47;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-16 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-2.xml" "-o" "ObjectClass3" "-a" "HLAprivilegeToDeleteObject" "-a" "Attribute3" "-i" "InteractionClass3" "-p" "Parameter3")
+set_tests_properties(rti1516e/fddget-1516e-16 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;51;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-17 "/root/repo/_gate_build2/bin/fddget-1516e" "-O" "/root/repo/tests/rti1516e/fddget/fdd-2.xml" "-o" "ObjectClass3" "-a" "HLAprivilegeToDeleteObject" "-a" "ObjectClass3.Attribute3" "-i" "InteractionClass3" "-p" "InteractionClass3.Parameter3")
+set_tests_properties(rti1516e/fddget-1516e-17 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;54;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
+add_test(rti1516e/fddget-1516e-20 "/root/repo/_gate_build2/bin/fddget-1516e" "-D" "-O" "/root/repo/tests/rti1516e/fddget/fdd-2.xml" "-o" "ObjectClass3" "-a" "HLAprivilegeToDeleteObject" "-a" "Attribute3" "-i" "InteractionClass3" "-p" "Parameter3")
+set_tests_properties(rti1516e/fddget-1516e-20 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/fddget/CMakeLists.txt;59;add_test;/root/repo/tests/rti1516e/fddget/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/link-1516e"
+  "../../../bin/link-1516e.pdb"
+  "CMakeFiles/link-1516e.dir/link.cpp.o"
+  "CMakeFiles/link-1516e.dir/link.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/link-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/modules-1516e"
+  "../../../bin/modules-1516e.pdb"
+  "CMakeFiles/modules-1516e.dir/modules.cpp.o"
+  "CMakeFiles/modules-1516e.dir/modules.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/modules-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516e/modules
+# Build directory: /root/repo/_gate_build2/tests/rti1516e/modules
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516e/modules-1516e-5 "/root/repo/_gate_build2/bin/modules-1516e" "-S5" "-A10" "-D" "-O" "/root/repo/tests/rti1516e/modules")
+set_tests_properties(rti1516e/modules-1516e-5 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/modules/CMakeLists.txt;13;add_test;/root/repo/tests/rti1516e/modules/CMakeLists.txt;0;")
+add_test(rti1516e/modules-1516e-6 "/root/repo/_gate_build2/bin/modules-1516e" "-S0" "-A1" "-O" "/root/repo/tests/rti1516e/modules")
+set_tests_properties(rti1516e/modules-1516e-6 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/modules/CMakeLists.txt;16;add_test;/root/repo/tests/rti1516e/modules/CMakeLists.txt;0;")
+add_test(rti1516e/modules-1516e-7 "/root/repo/_gate_build2/bin/modules-1516e" "-S0" "-A10" "-O" "/root/repo/tests/rti1516e/modules")
+set_tests_properties(rti1516e/modules-1516e-7 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/modules/CMakeLists.txt;18;add_test;/root/repo/tests/rti1516e/modules/CMakeLists.txt;0;")
+add_test(rti1516e/modules-1516e-8 "/root/repo/_gate_build2/bin/modules-1516e" "-S1" "-A1" "-O" "/root/repo/tests/rti1516e/modules")
+set_tests_properties(rti1516e/modules-1516e-8 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/modules/CMakeLists.txt;20;add_test;/root/repo/tests/rti1516e/modules/CMakeLists.txt;0;")
+add_test(rti1516e/modules-1516e-9 "/root/repo/_gate_build2/bin/modules-1516e" "-S1" "-A10" "-O" "/root/repo/tests/rti1516e/modules")
+set_tests_properties(rti1516e/modules-1516e-9 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/modules/CMakeLists.txt;22;add_test;/root/repo/tests/rti1516e/modules/CMakeLists.txt;0;")
+add_test(rti1516e/modules-1516e-10 "/root/repo/_gate_build2/bin/modules-1516e" "-S5" "-A10" "-O" "/root/repo/tests/rti1516e/modules")
+set_tests_properties(rti1516e/modules-1516e-10 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/modules/CMakeLists.txt;24;add_test;/root/repo/tests/rti1516e/modules/CMakeLists.txt;0;")
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516e/time
+# Build directory: /root/repo/_gate_build2/tests/rti1516e/time
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516e/logical-time-1516e-1 "/root/repo/_gate_build2/bin/logical-time-1516e")
+set_tests_properties(rti1516e/logical-time-1516e-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/time/CMakeLists.txt;5;add_test;/root/repo/tests/rti1516e/time/CMakeLists.txt;0;")
+add_test(rti1516e/logical-time-1516e-2 "/root/repo/_gate_build2/bin/logical-time-1516e" "-F" "HLAfloat64Time")
+set_tests_properties(rti1516e/logical-time-1516e-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/time/CMakeLists.txt;6;add_test;/root/repo/tests/rti1516e/time/CMakeLists.txt;0;")
+add_test(rti1516e/logical-time-1516e-3 "/root/repo/_gate_build2/bin/logical-time-1516e" "-F" "HLAinteger64Time")
+set_tests_properties(rti1516e/logical-time-1516e-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/time/CMakeLists.txt;7;add_test;/root/repo/tests/rti1516e/time/CMakeLists.txt;0;")
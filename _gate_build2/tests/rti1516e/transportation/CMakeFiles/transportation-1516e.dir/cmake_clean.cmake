@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/transportation-1516e"
+  "../../../bin/transportation-1516e.pdb"
+  "CMakeFiles/transportation-1516e.dir/transportation.cpp.o"
+  "CMakeFiles/transportation-1516e.dir/transportation.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transportation-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
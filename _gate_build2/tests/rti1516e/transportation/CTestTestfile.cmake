@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/rti1516e/transportation
+# Build directory: /root/repo/_gate_build2/tests/rti1516e/transportation
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(rti1516e/transportation-1516e-1 "/root/repo/_gate_build2/bin/transportation-1516e" "-S0" "-A1" "-O" "/root/repo/tests/rti1516e/transportation/fdd.xml")
+set_tests_properties(rti1516e/transportation-1516e-1 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/transportation/CMakeLists.txt;5;add_test;/root/repo/tests/rti1516e/transportation/CMakeLists.txt;0;")
+add_test(rti1516e/transportation-1516e-2 "/root/repo/_gate_build2/bin/transportation-1516e" "-S1" "-A1" "-O" "/root/repo/tests/rti1516e/transportation/fdd.xml")
+set_tests_properties(rti1516e/transportation-1516e-2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/transportation/CMakeLists.txt;7;add_test;/root/repo/tests/rti1516e/transportation/CMakeLists.txt;0;")
+add_test(rti1516e/transportation-1516e-3 "/root/repo/_gate_build2/bin/transportation-1516e" "-S5" "-A1" "-O" "/root/repo/tests/rti1516e/transportation/fdd.xml")
+set_tests_properties(rti1516e/transportation-1516e-3 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/rti1516e/transportation/CMakeLists.txt;9;add_test;/root/repo/tests/rti1516e/transportation/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/updaterate-1516e"
+  "../../../bin/updaterate-1516e.pdb"
+  "CMakeFiles/updaterate-1516e.dir/updaterate.cpp.o"
+  "CMakeFiles/updaterate-1516e.dir/updaterate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/updaterate-1516e.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
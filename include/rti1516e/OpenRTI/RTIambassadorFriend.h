@@ -0,0 +1,96 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_RTIambassadorFriend_h
+#define OpenRTI_RTIambassadorFriend_h
+
+#include <memory>
+#include <stdint.h>
+#include <RTI/RTIambassador.h>
+
+namespace OpenRTI {
+class AttributeCache;
+}
+
+namespace rti1516e
+{
+
+/// Read access to the OpenRTI attribute cache of an object class.
+/// The values are stored column wise, one column per cached attribute
+/// and one row per discovered object instance.
+/// A view is only valid until the next call into the ambassador that changes the cache.
+class RTI_EXPORT AttributeCacheView {
+public:
+  AttributeCacheView() : _attributeCache(0) { }
+  explicit AttributeCacheView(const OpenRTI::AttributeCache* attributeCache) : _attributeCache(attributeCache) { }
+
+  /// False if the object class has no attribute cache
+  bool isValid() const
+  { return _attributeCache != 0; }
+
+  /// Returns true if values of this attribute are stored in the cache
+  bool isColumnCached(AttributeHandle attributeHandle) const;
+
+  /// The number of object instances in the cache
+  size_t getNumRows() const;
+  /// The object instance handle of the row
+  ObjectInstanceHandle getObjectInstanceHandle(size_t row) const;
+  /// Get the row of the object instance, returns false if the instance is not cached
+  bool getRow(ObjectInstanceHandle objectInstanceHandle, size_t& row) const;
+
+  /// The serial of the last reflection stored in this cache
+  uint64_t getSerial() const;
+
+  /// The octet size of the rows in this column, zero for variable size columns
+  size_t getColumnOctetSize(AttributeHandle attributeHandle) const;
+  /// The getNumRows()*getColumnOctetSize() octets of a fixed size column,
+  /// zero if there are no rows or if the attribute is not cached in a fixed size column
+  const void* getColumnData(AttributeHandle attributeHandle) const;
+  /// The value of the attribute in the row for fixed and variable size columns,
+  /// zero if the attribute is not cached
+  const void* getValue(AttributeHandle attributeHandle, size_t row, size_t& size) const;
+  /// The getNumRows() serials of the reflections that last wrote the values in this column,
+  /// zero if never written
+  const uint64_t* getColumnSerials(AttributeHandle attributeHandle) const;
+
+private:
+  const OpenRTI::AttributeCache* _attributeCache;
+};
+
+/// OpenRTI extensions of an RTIambassador created by the RTIambassadorFactory of this library
+class RTI_EXPORT RTIambassadorFriend {
+public:
+  /// Store the reflected values of this attribute for the instances discovered as
+  /// this object class in the attribute cache of the object class.
+  /// Values of cached attributes are no longer passed to reflectAttributeValues.
+  /// An octetSize of zero caches values of any size.
+  static void
+  enableAttributeCache(RTIambassador& ambassador, ObjectClassHandle objectClassHandle,
+                       AttributeHandle attributeHandle, size_t octetSize);
+  /// Drop the attribute cache of the object class
+  static void
+  disableAttributeCache(RTIambassador& ambassador, ObjectClassHandle objectClassHandle);
+  /// The attribute cache of the object class, not valid if not enabled.
+  static AttributeCacheView
+  getAttributeCache(const RTIambassador& ambassador, ObjectClassHandle objectClassHandle);
+};
+
+}
+
+#endif // OpenRTI_RTIambassadorFriend_h
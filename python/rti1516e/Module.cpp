@@ -254,6 +254,100 @@ PyObject_GetVariableLengthData(rti1516e::VariableLengthData& variableLengthData,
   }
 }
 
+#if 3 <= PY_MAJOR_VERSION
+
+// Read only buffer exporter that just holds a reference to the decoded data.
+// The rti1516e::VariableLengthData copy is only a reference count increment,
+// so a memoryview on top of this is a zero copy view of the received message.
+struct PyVariableLengthData {
+  PyObject_HEAD
+  rti1516e::VariableLengthData ob_value;
+};
+
+static void
+PyVariableLengthData_dealloc(PyVariableLengthData *o)
+{
+  o->ob_value.~VariableLengthData();
+  Py_TYPE(o)->tp_free(o);
+}
+
+static Py_ssize_t
+PyVariableLengthData_length(PyVariableLengthData *o)
+{
+  return o->ob_value.size();
+}
+
+static int
+PyVariableLengthData_getbuffer(PyVariableLengthData *o, Py_buffer *view, int flags)
+{
+  return PyBuffer_FillInfo(view, (PyObject*)o, const_cast<void*>(o->ob_value.data()), o->ob_value.size(), 1, flags);
+}
+
+static PySequenceMethods PyVariableLengthData_as_sequence = {
+  (lenfunc)PyVariableLengthData_length, /* sq_length */
+};
+
+static PyBufferProcs PyVariableLengthData_as_buffer = {
+  (getbufferproc)PyVariableLengthData_getbuffer, /* bf_getbuffer */
+  0,                                /* bf_releasebuffer */
+};
+
+static PyTypeObject PyVariableLengthDataType = {
+  PyVarObject_HEAD_INIT(NULL, 0)
+  "VariableLengthData",             /* tp_name */
+  sizeof(PyVariableLengthData),     /* tp_basicsize */
+  0,                                /* tp_itemsize */
+  (destructor)PyVariableLengthData_dealloc, /* tp_dealloc */
+  0,                                /* tp_print */
+  0,                                /* tp_getattr */
+  0,                                /* tp_setattr */
+  0,                                /* tp_compare */
+  0,                                /* tp_repr */
+  0,                                /* tp_as_number */
+  &PyVariableLengthData_as_sequence, /* tp_as_sequence */
+  0,                                /* tp_as_mapping */
+  0,                                /* tp_hash */
+  0,                                /* tp_call */
+  0,                                /* tp_str */
+  0,                                /* tp_getattro */
+  0,                                /* tp_setattro */
+  &PyVariableLengthData_as_buffer,  /* tp_as_buffer */
+  Py_TPFLAGS_DEFAULT,               /* tp_flags */
+  "VariableLengthData",             /* tp_doc */
+};
+
+static PyObject*
+PyObject_NewVariableLengthDataView(const rti1516e::VariableLengthData& variableLengthData)
+{
+  PyVariableLengthData *self;
+  self = PyObject_New(PyVariableLengthData, &PyVariableLengthDataType);
+  if (!self)
+    return 0;
+  new (&self->ob_value) rti1516e::VariableLengthData(variableLengthData);
+  PyObject* view = PyMemoryView_FromObject((PyObject*)self);
+  Py_DecRef((PyObject*)self);
+  return view;
+}
+
+#else
+
+static PyObject*
+PyObject_NewVariableLengthDataView(const rti1516e::VariableLengthData& variableLengthData)
+{
+  return PyObject_NewVariableLengthData(variableLengthData);
+}
+
+#endif
+
+static PyObject*
+PyObject_NewVariableLengthData(const rti1516e::VariableLengthData& variableLengthData, bool view)
+{
+  if (view)
+    return PyObject_NewVariableLengthDataView(variableLengthData);
+  else
+    return PyObject_NewVariableLengthData(variableLengthData);
+}
+
 static bool
 PyObject_GetBool(bool& value, PyObject* o)
 {
@@ -1100,7 +1194,7 @@ PyObject_NewSupplementalRemoveInfo(const rti1516e::SupplementalRemoveInfo& suppl
 }
 
 static PyObject*
-PyObject_NewAttributeHandleValueMap(const rti1516e::AttributeHandleValueMap& attributeHandleValueMap)
+PyObject_NewAttributeHandleValueMap(const rti1516e::AttributeHandleValueMap& attributeHandleValueMap, bool view = false)
 {
   PyObject* dict = PyDict_New();
   rti1516e::AttributeHandleValueMap::const_iterator i;
@@ -1110,15 +1204,16 @@ PyObject_NewAttributeHandleValueMap(const rti1516e::AttributeHandleValueMap& att
       Py_DecRef(dict);
       return 0;
     }
-    PyObject *value = PyObject_NewVariableLengthData(i->second);
+    PyObject *value = PyObject_NewVariableLengthData(i->second, view);
     if (!value) {
       Py_DecRef(key);
       Py_DecRef(dict);
       return 0;
     }
-    if (PyDict_SetItem(dict, key, value)) {
-      Py_DecRef(value);
-      Py_DecRef(key);
+    int error = PyDict_SetItem(dict, key, value);
+    Py_DecRef(value);
+    Py_DecRef(key);
+    if (error) {
       Py_DecRef(dict);
       return 0;
     }
@@ -1176,7 +1271,7 @@ PyObject_GetAttributeHandleValueMap(rti1516e::AttributeHandleValueMap& attribute
 }
 
 static PyObject*
-PyObject_NewParameterHandleValueMap(const rti1516e::ParameterHandleValueMap& parameterHandleValueMap)
+PyObject_NewParameterHandleValueMap(const rti1516e::ParameterHandleValueMap& parameterHandleValueMap, bool view = false)
 {
   PyObject* dict = PyDict_New();
   rti1516e::ParameterHandleValueMap::const_iterator i;
@@ -1186,15 +1281,16 @@ PyObject_NewParameterHandleValueMap(const rti1516e::ParameterHandleValueMap& par
       Py_DecRef(dict);
       return 0;
     }
-    PyObject *value = PyObject_NewVariableLengthData(i->second);
+    PyObject *value = PyObject_NewVariableLengthData(i->second, view);
     if (!value) {
       Py_DecRef(key);
       Py_DecRef(dict);
       return 0;
     }
-    if (PyDict_SetItem(dict, key, value)) {
-      Py_DecRef(value);
-      Py_DecRef(key);
+    int error = PyDict_SetItem(dict, key, value);
+    Py_DecRef(value);
+    Py_DecRef(key);
+    if (error) {
       Py_DecRef(dict);
       return 0;
     }
@@ -1471,7 +1567,11 @@ static std::wstring PyErr_GetExceptionString()
 struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
   PyRTI1516EFederateAmbassador(PyObject* federateAmbassador = 0)
     RTI_THROW ((rti1516e::FederateInternalError)) :
-    ob_federateAmbassador(federateAmbassador)
+    ob_federateAmbassador(federateAmbassador),
+    _bufferViews(false),
+    _maxCallbackBatchSize(0),
+    _evokedCallbackModel(false),
+    _inEvoke(false)
   {
     if (ob_federateAmbassador)
       Py_IncRef(ob_federateAmbassador);
@@ -1484,6 +1584,128 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       Py_DecRef(ob_federateAmbassador);
   }
 
+  // A receive order reflection or interaction that is queued for batched delivery.
+  struct PendingCallback {
+    bool _interaction;
+    rti1516e::ObjectInstanceHandle _objectInstanceHandle;
+    rti1516e::AttributeHandleValueMap _attributeValues;
+    rti1516e::SupplementalReflectInfo _reflectInfo;
+    rti1516e::InteractionClassHandle _interactionClassHandle;
+    rti1516e::ParameterHandleValueMap _parameterValues;
+    rti1516e::SupplementalReceiveInfo _receiveInfo;
+    rti1516e::VariableLengthData _tag;
+    rti1516e::OrderType _sentOrder;
+    rti1516e::TransportationType _transportationType;
+  };
+  typedef std::vector<PendingCallback> PendingCallbackVector;
+
+  // Batching is only done from within evokeCallback/evokeMultipleCallbacks
+  // where all callbacks happen in the thread that holds the python object.
+  bool getBatchCallbacks() const
+  { return _evokedCallbackModel && _inEvoke && 0 < _maxCallbackBatchSize; }
+
+  PendingCallback& pushPendingCallback(bool interaction)
+  {
+    _pendingCallbacks.resize(_pendingCallbacks.size() + 1);
+    _pendingCallbacks.back()._interaction = interaction;
+    return _pendingCallbacks.back();
+  }
+
+  // Delivers the queued callbacks once the batch is full.
+  // Called after the callback is queued, so a failing batch does not lose it.
+  void flushFullCallbackBatch()
+  {
+    if (_pendingCallbacks.size() < _maxCallbackBatchSize)
+      return;
+    GILStateScope gilStateScope;
+    flushCallbackBatch();
+  }
+
+  PyObject* newPendingCallbackArgs(const PendingCallback& pendingCallback)
+  {
+    PyObject* arg0;
+    PyObject* arg1;
+    PyObject* arg8;
+    if (pendingCallback._interaction) {
+      arg0 = PyObject_NewInteractionClassHandle(pendingCallback._interactionClassHandle);
+      arg1 = PyObject_NewParameterHandleValueMap(pendingCallback._parameterValues, _bufferViews);
+      arg8 = PyObject_NewSupplementalReceiveInfo(pendingCallback._receiveInfo);
+    } else {
+      arg0 = PyObject_NewObjectInstanceHandle(pendingCallback._objectInstanceHandle);
+      arg1 = PyObject_NewAttributeHandleValueMap(pendingCallback._attributeValues, _bufferViews);
+      arg8 = PyObject_NewSupplementalReflectInfo(pendingCallback._reflectInfo);
+    }
+    PyObject* arg2 = PyObject_NewVariableLengthData(pendingCallback._tag, _bufferViews);
+    PyObject* arg3 = PyObject_NewOrderType(pendingCallback._sentOrder);
+    PyObject* arg4 = PyObject_NewTransportationType(pendingCallback._transportationType);
+    return Py_BuildValue("(NNNNNOOON)", arg0, arg1, arg2, arg3, arg4, Py_None, Py_None, Py_None, arg8);
+  }
+
+  // Delivers the queued callbacks, needs to be called with the GIL held.
+  // Consecutive callbacks of the same kind are handed over as a list of argument
+  // tuples to reflectAttributeValuesBatch/receiveInteractionBatch if the python
+  // federate ambassador implements these, otherwise the single callbacks are called.
+  // Returns false with the python error set on failure.
+  bool deliverCallbackBatch()
+  {
+    PendingCallbackVector pendingCallbacks;
+    pendingCallbacks.swap(_pendingCallbacks);
+    if (!ob_federateAmbassador)
+      return true;
+    PendingCallbackVector::const_iterator i = pendingCallbacks.begin();
+    while (i != pendingCallbacks.end()) {
+      bool interaction = i->_interaction;
+      const char* name = interaction ? "receiveInteraction" : "reflectAttributeValues";
+      const char* batchName = interaction ? "receiveInteractionBatch" : "reflectAttributeValuesBatch";
+
+      PyObject* list = PyList_New(0);
+      if (!list)
+        return false;
+      for (; i != pendingCallbacks.end() && i->_interaction == interaction; ++i) {
+        PyObject* args = newPendingCallbackArgs(*i);
+        if (!args || PyList_Append(list, args)) {
+          Py_XDECREF(args);
+          Py_DecRef(list);
+          return false;
+        }
+        Py_DecRef(args);
+      }
+
+      if (PyObject_HasAttrString(ob_federateAmbassador, batchName)) {
+        PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)batchName, (char*)"N", list);
+        if (!result)
+          return false;
+        Py_DecRef(result);
+      } else {
+        PyObject* method = PyObject_GetAttrString(ob_federateAmbassador, name);
+        if (!method) {
+          Py_DecRef(list);
+          return false;
+        }
+        for (Py_ssize_t j = 0; j < PyList_Size(list); ++j) {
+          PyObject* result = PyObject_CallObject(method, PyList_GetItem(list, j));
+          if (!result) {
+            Py_DecRef(method);
+            Py_DecRef(list);
+            return false;
+          }
+          Py_DecRef(result);
+        }
+        Py_DecRef(method);
+        Py_DecRef(list);
+      }
+    }
+    return true;
+  }
+
+  void flushCallbackBatch()
+  {
+    if (_pendingCallbacks.empty())
+      return;
+    if (!deliverCallbackBatch())
+      CATCH_PYTHON_EXCEPTION(exception);
+  }
+
   void setObject(PyObject* federateAmbassador = 0)
   {
     if (ob_federateAmbassador == federateAmbassador)
@@ -1495,6 +1717,26 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
     ob_federateAmbassador = federateAmbassador;
   }
 
+  // Marks the callbacks dispatched from evokeCallback/evokeMultipleCallbacks.
+  // If the dispatch is left by an exception, the callbacks queued so far are dropped,
+  // so that they do not show up out of order with a later evoke call.
+  struct EvokeScope {
+    EvokeScope(PyRTI1516EFederateAmbassador& federateAmbassador) :
+      _federateAmbassador(federateAmbassador),
+      _done(false)
+    { _federateAmbassador._inEvoke = true; }
+    ~EvokeScope()
+    {
+      _federateAmbassador._inEvoke = false;
+      if (!_done)
+        _federateAmbassador._pendingCallbacks.clear();
+    }
+    void done()
+    { _done = true; }
+    PyRTI1516EFederateAmbassador& _federateAmbassador;
+    bool _done;
+  };
+
   struct GILStateScope {
     GILStateScope() :
       _gstate(PyGILState_Ensure())
@@ -1511,6 +1753,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(faultDescription);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"connectionLost", (char*)"N", arg0);
@@ -1529,6 +1772,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewFederateHandleSaveStatusPairVector(federationExecutionInformationVector);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"reportFederationExecutions", (char*)"N", arg0);
@@ -1547,6 +1791,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"synchronizationPointRegistrationSucceeded", (char*)"N", arg0);
@@ -1566,6 +1811,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* arg1 = PyLong_FromLong(reason);
@@ -1586,6 +1832,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* arg1 = PyObject_NewVariableLengthData(theUserSuppliedTag);
@@ -1605,6 +1852,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* arg1 = PyObject_NewFederateHandleSet(failedToSyncSet);
@@ -1624,6 +1872,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"initiateFederateSave", (char*)"N", arg0);
@@ -1642,6 +1891,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* arg1 = PyObject_NewLogicalTime(theTime);
@@ -1661,6 +1911,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"federationSaved", 0);
     if (result) {
@@ -1678,6 +1929,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyLong_FromLong(theSaveFailureReason);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"federationNotSaved", (char*)"N", arg0);
@@ -1696,6 +1948,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewFederateHandleSaveStatusPairVector(theFederateStatusVector);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"federationSaveStatusResponse", (char*)"N", arg0);
@@ -1714,6 +1967,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"requestFederationRestoreSucceeded", (char*)"N", arg0);
@@ -1732,6 +1986,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"requestFederationRestoreFailed", (char*)"N", arg0);
@@ -1750,6 +2005,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"federationRestoreBegun", 0);
     if (result) {
@@ -1767,6 +2023,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(label);
     PyObject* arg1 = PyObject_NewString(federateName);
@@ -1787,6 +2044,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"federationRestored", 0);
     if (result) {
@@ -1804,6 +2062,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyLong_FromLong(theRestoreFailureReason);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"federationNotRestored", (char*)"N", arg0);
@@ -1822,6 +2081,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewFederateRestoreStatusVector(theFederateStatusVector);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"federationRestoreStatusResponse", (char*)"N", arg0);
@@ -1840,6 +2100,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectClassHandle(theClass);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"startRegistrationForObjectClass", (char*)"N", arg0);
@@ -1858,6 +2119,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectClassHandle(theClass);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"stopRegistrationForObjectClass", (char*)"N", arg0);
@@ -1876,6 +2138,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewInteractionClassHandle(theHandle);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"turnInteractionsOn", (char*)"N", arg0);
@@ -1894,6 +2157,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewInteractionClassHandle(theHandle);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"turnInteractionsOff", (char*)"N", arg0);
@@ -1912,6 +2176,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(theObjectInstanceName);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"objectInstanceNameReservationSucceeded", (char*)"N", arg0);
@@ -1930,6 +2195,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewString(theObjectInstanceName);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"objectInstanceNameReservationFailed", (char*)"N", arg0);
@@ -1948,6 +2214,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewStringSet(theObjectInstanceNames);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"multipleObjectInstanceNameReservationSucceeded", (char*)"N", arg0);
@@ -1966,6 +2233,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewStringSet(theObjectInstanceNames);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"multipleObjectInstanceNameReservationFailed", (char*)"N", arg0);
@@ -1985,6 +2253,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewObjectClassHandle(theObjectClass);
@@ -2006,6 +2275,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewObjectClassHandle(theObjectClass);
@@ -2028,11 +2298,24 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
     if (!ob_federateAmbassador)
       return;
 
+    if (getBatchCallbacks()) {
+      PendingCallback& pendingCallback = pushPendingCallback(false);
+      pendingCallback._objectInstanceHandle = theObject;
+      pendingCallback._attributeValues = theAttributeValues;
+      pendingCallback._tag = theUserSuppliedTag;
+      pendingCallback._sentOrder = sentOrder;
+      pendingCallback._transportationType = theType;
+      pendingCallback._reflectInfo = theReflectInfo;
+      flushFullCallbackBatch();
+      return;
+    }
+
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
-    PyObject* arg1 = PyObject_NewAttributeHandleValueMap(theAttributeValues);
-    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag);
+    PyObject* arg1 = PyObject_NewAttributeHandleValueMap(theAttributeValues, _bufferViews);
+    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag, _bufferViews);
     PyObject* arg3 = PyObject_NewOrderType(sentOrder);
     PyObject* arg4 = PyObject_NewTransportationType(theType);
     PyObject* arg5 = Py_None;
@@ -2058,10 +2341,11 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
-    PyObject* arg1 = PyObject_NewAttributeHandleValueMap(theAttributeValues);
-    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag);
+    PyObject* arg1 = PyObject_NewAttributeHandleValueMap(theAttributeValues, _bufferViews);
+    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag, _bufferViews);
     PyObject* arg3 = PyObject_NewOrderType(sentOrder);
     PyObject* arg4 = PyObject_NewTransportationType(theType);
     PyObject* arg5 = PyObject_NewLogicalTime(theTime);
@@ -2089,10 +2373,11 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
-    PyObject* arg1 = PyObject_NewAttributeHandleValueMap(theAttributeValues);
-    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag);
+    PyObject* arg1 = PyObject_NewAttributeHandleValueMap(theAttributeValues, _bufferViews);
+    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag, _bufferViews);
     PyObject* arg3 = PyObject_NewOrderType(sentOrder);
     PyObject* arg4 = PyObject_NewTransportationType(theType);
     PyObject* arg5 = PyObject_NewLogicalTime(theTime);
@@ -2117,11 +2402,24 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
     if (!ob_federateAmbassador)
       return;
 
+    if (getBatchCallbacks()) {
+      PendingCallback& pendingCallback = pushPendingCallback(true);
+      pendingCallback._interactionClassHandle = theInteraction;
+      pendingCallback._parameterValues = theParameterValues;
+      pendingCallback._tag = theUserSuppliedTag;
+      pendingCallback._sentOrder = sentOrder;
+      pendingCallback._transportationType = theType;
+      pendingCallback._receiveInfo = theReceiveInfo;
+      flushFullCallbackBatch();
+      return;
+    }
+
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewInteractionClassHandle(theInteraction);
-    PyObject* arg1 = PyObject_NewParameterHandleValueMap(theParameterValues);
-    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag);
+    PyObject* arg1 = PyObject_NewParameterHandleValueMap(theParameterValues, _bufferViews);
+    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag, _bufferViews);
     PyObject* arg3 = PyObject_NewOrderType(sentOrder);
     PyObject* arg4 = PyObject_NewTransportationType(theType);
     PyObject* arg5 = Py_None;
@@ -2148,10 +2446,11 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewInteractionClassHandle(theInteraction);
-    PyObject* arg1 = PyObject_NewParameterHandleValueMap(theParameterValues);
-    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag);
+    PyObject* arg1 = PyObject_NewParameterHandleValueMap(theParameterValues, _bufferViews);
+    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag, _bufferViews);
     PyObject* arg3 = PyObject_NewOrderType(sentOrder);
     PyObject* arg4 = PyObject_NewTransportationType(theType);
     PyObject* arg5 = PyObject_NewLogicalTime(theTime);
@@ -2181,10 +2480,11 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewInteractionClassHandle(theInteraction);
-    PyObject* arg1 = PyObject_NewParameterHandleValueMap(theParameterValues);
-    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag);
+    PyObject* arg1 = PyObject_NewParameterHandleValueMap(theParameterValues, _bufferViews);
+    PyObject* arg2 = PyObject_NewVariableLengthData(theUserSuppliedTag, _bufferViews);
     PyObject* arg3 = PyObject_NewOrderType(sentOrder);
     PyObject* arg4 = PyObject_NewTransportationType(theType);
     PyObject* arg5 = PyObject_NewLogicalTime(theTime);
@@ -2213,6 +2513,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewVariableLengthData(theUserSuppliedTag);
@@ -2244,6 +2545,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewVariableLengthData(theUserSuppliedTag);
@@ -2276,6 +2578,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewVariableLengthData(theUserSuppliedTag);
@@ -2304,6 +2607,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2326,6 +2630,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2347,6 +2652,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2367,6 +2673,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2387,6 +2694,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2407,6 +2715,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2428,6 +2737,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2450,6 +2760,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandle(theAttribute);
@@ -2471,6 +2782,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewInteractionClassHandle(theInteraction);
     PyObject* arg1 = PyObject_NewTransportationType(theTransportation);
@@ -2492,6 +2804,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewFederateHandle(federateHandle);
     PyObject* arg1 = PyObject_NewInteractionClassHandle(theInteraction);
@@ -2513,6 +2826,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(offeredAttributes);
@@ -2533,6 +2847,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(releasedAttributes);
@@ -2553,6 +2868,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(securedAttributes);
@@ -2573,6 +2889,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2593,6 +2910,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(candidateAttributes);
@@ -2614,6 +2932,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandleSet(theAttributes);
@@ -2634,6 +2953,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandle(theAttribute);
@@ -2654,6 +2974,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandle(theAttribute);
@@ -2673,6 +2994,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewObjectInstanceHandle(theObject);
     PyObject* arg1 = PyObject_NewAttributeHandle(theAttribute);
@@ -2692,6 +3014,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewLogicalTime(theFederateTime);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"timeRegulationEnabled", (char*)"N", arg0);
@@ -2711,6 +3034,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewLogicalTime(theFederateTime);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"timeConstrainedEnabled", (char*)"N", arg0);
@@ -2729,6 +3053,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewLogicalTime(theTime);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"timeAdvanceGrant", (char*)"N", arg0);
@@ -2747,6 +3072,7 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
       return;
 
     GILStateScope gilStateScope;
+    flushCallbackBatch();
 
     PyObject* arg0 = PyObject_NewMessageRetractionHandle(theHandle);
     PyObject* result = PyObject_CallMethod(ob_federateAmbassador, (char*)"requestRetraction", (char*)"N", arg0);
@@ -2759,6 +3085,14 @@ struct PyRTI1516EFederateAmbassador : public rti1516e::FederateAmbassador {
   }
 
   PyObject* ob_federateAmbassador;
+
+  // Deliver values as read only memoryviews instead of bytearray copies
+  bool _bufferViews;
+  // If nonzero, batch up to that many receive order callbacks per GIL acquisition
+  size_t _maxCallbackBatchSize;
+  bool _evokedCallbackModel;
+  bool _inEvoke;
+  PendingCallbackVector _pendingCallbacks;
 };
 
 struct PyRTIambassadorObject {
@@ -2797,6 +3131,7 @@ PyRTIambassador_connect(PyRTIambassadorObject *self, PyObject *args)
   try {
     self->ob_value->connect(self->_federateAmbassador, theCallbackModel, localSettingsDesignator);
     self->_federateAmbassador.setObject(arg1);
+    self->_federateAmbassador._evokedCallbackModel = (theCallbackModel == rti1516e::HLA_EVOKED);
 
     Py_IncRef(Py_None);
     return Py_None;
@@ -6750,10 +7085,18 @@ PyRTIambassador_evokeCallback(PyRTIambassadorObject *self, PyObject *args)
   _save = PyEval_SaveThread();
   try {
 
-    bool more = self->ob_value->evokeCallback(approximateMinimumTimeInSeconds);
+    bool more;
+    {
+      PyRTI1516EFederateAmbassador::EvokeScope evokeScope(self->_federateAmbassador);
+      more = self->ob_value->evokeCallback(approximateMinimumTimeInSeconds);
+      evokeScope.done();
+    }
 
     PyEval_RestoreThread(_save);
 
+    if (!self->_federateAmbassador.deliverCallbackBatch())
+      return 0;
+
     return PyBool_FromLong(more);
   }
   CATCH_C_EXCEPTION_THREADS(CallNotAllowedFromWithinCallback)
@@ -6783,11 +7126,19 @@ PyRTIambassador_evokeMultipleCallbacks(PyRTIambassadorObject *self, PyObject *ar
   _save = PyEval_SaveThread();
   try {
 
-    bool more = self->ob_value->evokeMultipleCallbacks(approximateMinimumTimeInSeconds,
-                                                       approximateMaximumTimeInSeconds);
+    bool more;
+    {
+      PyRTI1516EFederateAmbassador::EvokeScope evokeScope(self->_federateAmbassador);
+      more = self->ob_value->evokeMultipleCallbacks(approximateMinimumTimeInSeconds,
+                                                    approximateMaximumTimeInSeconds);
+      evokeScope.done();
+    }
 
     PyEval_RestoreThread(_save);
 
+    if (!self->_federateAmbassador.deliverCallbackBatch())
+      return 0;
+
     return PyBool_FromLong(more);
   }
   CATCH_C_EXCEPTION_THREADS(CallNotAllowedFromWithinCallback)
@@ -6828,6 +7179,72 @@ PyRTIambassador_disableCallbacks(PyRTIambassadorObject *self, PyObject *args)
   CATCH_C_EXCEPTION(RTIinternalError)
 }
 
+// OpenRTI extension: deliver reflected attribute values, interaction parameter values
+// and tags as read only memoryviews referencing the received data instead of copies.
+static PyObject *
+PyRTIambassador_enableBufferViews(PyRTIambassadorObject *self, PyObject *args)
+{
+  if (!PyArg_UnpackTuple(args, "enableBufferViews", 0, 0))
+    return 0;
+
+  self->_federateAmbassador._bufferViews = true;
+
+  Py_IncRef(Py_None);
+  return Py_None;
+}
+
+static PyObject *
+PyRTIambassador_disableBufferViews(PyRTIambassadorObject *self, PyObject *args)
+{
+  if (!PyArg_UnpackTuple(args, "disableBufferViews", 0, 0))
+    return 0;
+
+  self->_federateAmbassador._bufferViews = false;
+
+  Py_IncRef(Py_None);
+  return Py_None;
+}
+
+// OpenRTI extension: with the HLA_EVOKED callback model, collect up to maxBatchSize
+// receive order reflections and interactions during evokeCallback/evokeMultipleCallbacks
+// and deliver them with a single GIL acquisition.
+static PyObject *
+PyRTIambassador_enableCallbackBatching(PyRTIambassadorObject *self, PyObject *args)
+{
+  PyObject *arg1 = 0;
+  if (!PyArg_UnpackTuple(args, "enableCallbackBatching", 0, 1, &arg1))
+    return 0;
+
+  long maxBatchSize = 1024;
+  if (arg1 && !PyObject_GetInt(maxBatchSize, arg1)) {
+    PyErr_SetString(PyExc_TypeError, "maxBatchSize needs to be an integer!");
+    return 0;
+  }
+  if (maxBatchSize <= 0) {
+    PyErr_SetString(PyExc_ValueError, "maxBatchSize needs to be positive!");
+    return 0;
+  }
+
+  self->_federateAmbassador._maxCallbackBatchSize = maxBatchSize;
+
+  Py_IncRef(Py_None);
+  return Py_None;
+}
+
+static PyObject *
+PyRTIambassador_disableCallbackBatching(PyRTIambassadorObject *self, PyObject *args)
+{
+  if (!PyArg_UnpackTuple(args, "disableCallbackBatching", 0, 0))
+    return 0;
+
+  self->_federateAmbassador._maxCallbackBatchSize = 0;
+  if (!self->_federateAmbassador.deliverCallbackBatch())
+    return 0;
+
+  Py_IncRef(Py_None);
+  return Py_None;
+}
+
 static PyObject *
 PyRTIambassador_getTimeFactory(PyRTIambassadorObject *self, PyObject *args)
 {
@@ -7193,6 +7610,10 @@ static PyMethodDef PyRTIambassador_methods[] =
   {"enableCallbacks", (PyCFunction)PyRTIambassador_enableCallbacks, METH_VARARGS, ""},
   {"getTimeFactory", (PyCFunction)PyRTIambassador_getTimeFactory, METH_VARARGS, ""},
   {"disableCallbacks", (PyCFunction)PyRTIambassador_disableCallbacks, METH_VARARGS, ""},
+  {"enableBufferViews", (PyCFunction)PyRTIambassador_enableBufferViews, METH_VARARGS, ""},
+  {"disableBufferViews", (PyCFunction)PyRTIambassador_disableBufferViews, METH_VARARGS, ""},
+  {"enableCallbackBatching", (PyCFunction)PyRTIambassador_enableCallbackBatching, METH_VARARGS, ""},
+  {"disableCallbackBatching", (PyCFunction)PyRTIambassador_disableCallbackBatching, METH_VARARGS, ""},
   {"decodeFederateHandle", (PyCFunction)PyRTIambassador_decodeFederateHandle, METH_VARARGS, ""},
   {"decodeObjectClassHandle", (PyCFunction)PyRTIambassador_decodeObjectClassHandle, METH_VARARGS, ""},
   {"decodeInteractionClassHandle", (PyCFunction)PyRTIambassador_decodeInteractionClassHandle, METH_VARARGS, ""},
@@ -7343,6 +7764,10 @@ INITFUNCNAME(void)
     INITERROR;
   if (PyType_Ready(&PyRTIambassadorType) < 0)
     INITERROR;
+#if 3 <= PY_MAJOR_VERSION
+  if (PyType_Ready(&PyVariableLengthDataType) < 0)
+    INITERROR;
+#endif
 
 #if PY_MAJOR_VERSION >= 3
   PyObject* module = PyModule_Create(&moduledef);
@@ -7371,6 +7796,10 @@ INITFUNCNAME(void)
 
   Py_IncRef((PyObject*)&PyRTIambassadorType);
   PyModule_AddObject(module, "RTIambassador", (PyObject*)&PyRTIambassadorType);
+#if 3 <= PY_MAJOR_VERSION
+  Py_IncRef((PyObject*)&PyVariableLengthDataType);
+  PyModule_AddObject(module, "VariableLengthData", (PyObject*)&PyVariableLengthDataType);
+#endif
 
   // enum OrderType
   PyModule_AddIntConstant(module, "RECEIVE", rti1516e::RECEIVE);
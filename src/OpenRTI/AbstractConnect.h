@@ -24,6 +24,7 @@
 #include "AbstractMessageSender.h"
 #include "AbstractMessageReceiver.h"
 #include "Clock.h"
+#include "Metrics.h"
 #include "SharedPtr.h"
 
 namespace OpenRTI {
@@ -38,14 +39,21 @@ public:
 
   /// Convenience methods for obvious tasks
   void send(const SharedPtr<const AbstractMessage>& message)
-  { getMessageSender()->send(message); }
+  {
+    if (_connectMetrics.valid())
+      _connectMetrics->getMessagesIn().inc();
+    getMessageSender()->send(message);
+  }
 
   /// Returns the next message. Returns 0 if no new message arrives before abstime
   SharedPtr<const AbstractMessage> receive(const Clock& abstime)
-  { return getMessageReceiver()->receive(abstime); }
+  { return _countReceived(getMessageReceiver()->receive(abstime)); }
   /// Returns the next message if there is one.
   SharedPtr<const AbstractMessage> receive()
-  { return getMessageReceiver()->receive(); }
+  { return _countReceived(getMessageReceiver()->receive()); }
+  /// Returns the next message if it is a control message that may overtake bulk messages in transit.
+  SharedPtr<const AbstractMessage> receiveControl()
+  { return _countReceived(getMessageReceiver()->receiveControl()); }
 
   /// Close the message sender
   void close()
@@ -54,6 +62,22 @@ public:
   /// Return true if there is something ready to receive
   bool empty()
   { return getMessageReceiver()->empty(); }
+
+  /// Traffic counters of this connect, may be zero
+  ConnectMetrics* getConnectMetrics() const
+  { return _connectMetrics.get(); }
+  void setConnectMetrics(const SharedPtr<ConnectMetrics>& connectMetrics)
+  { _connectMetrics = connectMetrics; }
+
+private:
+  const SharedPtr<const AbstractMessage>& _countReceived(const SharedPtr<const AbstractMessage>& message)
+  {
+    if (_connectMetrics.valid() && message.valid())
+      _connectMetrics->getMessagesOut().inc();
+    return message;
+  }
+
+  SharedPtr<ConnectMetrics> _connectMetrics;
 };
 
 } // namespace OpenRTI
@@ -37,4 +37,16 @@ AbstractMessage::getObjectInstanceHandleForMessage() const
   return ObjectInstanceHandle();
 }
 
+MessageRetractionHandle
+AbstractMessage::getMessageRetractionHandleForMessage() const
+{
+  return MessageRetractionHandle();
+}
+
+AbstractMessage::Priority
+AbstractMessage::getPriority() const
+{
+  return NormalPriority;
+}
+
 } // namespace OpenRTI
@@ -22,9 +22,12 @@
 
 #include <iosfwd>
 #include <list>
+#include "EncodedMessage.h"
 #include "Export.h"
 #include "Handle.h"
+#include "MessageTrace.h"
 #include "Referenced.h"
+#include "SharedPtr.h"
 
 namespace OpenRTI {
 
@@ -35,9 +38,6 @@ class FunctorMessageDispatcher;
 template<typename F>
 class ConstFunctorMessageDispatcher;
 
-template<typename T>
-class SharedPtr;
-
 class OPENRTI_API AbstractMessage : public Referenced {
 public:
   virtual ~AbstractMessage();
@@ -67,6 +67,55 @@ public:
   // The default implementation returns an invalid handle.
   // This is used to throw out messages for object instances that are already deleted.
   virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
+
+  // Returns the retraction handle of a time stamp order message.
+  // The default implementation returns an invalid handle.
+  // This is used to throw out queued messages that are retracted.
+  virtual MessageRetractionHandle getMessageRetractionHandleForMessage() const;
+
+  // The scheduling class of a message on a network connect.
+  // Large bulk messages are sent in fragments if the peer can reassemble them.
+  // Only control messages may be sent in between these fragments, all
+  // other messages stay in order behind the bulk message.
+  enum Priority {
+    // Time management commits, must not overtake time stamp order messages
+    ControlPriority,
+    NormalPriority,
+    // Receive order data, may be overtaken by control messages
+    BulkPriority
+  };
+  // The default implementation returns NormalPriority.
+  virtual Priority getPriority() const;
+
+  // The latency trace attached to this message, zero if the message is not traced.
+  // Traces are attached to otherwise immutable messages on their way through the
+  // system, so these are const methods.
+  MessageTrace* getMessageTrace() const
+  { return _messageTrace.get(); }
+  void setMessageTrace(MessageTrace* messageTrace) const
+  { _messageTrace = messageTrace; }
+  void stampMessageTrace(MessageTrace::Point point) const
+  { if (_messageTrace.valid()) _messageTrace->stamp(point); }
+  // Used for messages built from an other message, the stamps so far are
+  // copied so that both can continue independently.
+  void copyMessageTrace(const AbstractMessage& message) const
+  { if (message._messageTrace.valid()) _messageTrace = new MessageTrace(*message._messageTrace); }
+  // Called when the message is handed out to the federate
+  void writeMessageTrace() const
+  { if (_messageTrace.valid()) MessageTrace::write(getTypeName(), *_messageTrace); }
+
+  // The encoded form of this message, zero if not yet encoded.
+  // Shared between all connects the message is sent to with the same encoding.
+  // Messages are encoded in the thread of the server sending them, so like the
+  // trace this is attached to an otherwise immutable message without locking.
+  const EncodedMessage* getEncodedMessage() const
+  { return _encodedMessage.get(); }
+  void setEncodedMessage(const EncodedMessage* encodedMessage) const
+  { _encodedMessage = encodedMessage; }
+
+private:
+  mutable SharedPtr<MessageTrace> _messageTrace;
+  mutable SharedPtr<const EncodedMessage> _encodedMessage;
 };
 
 inline std::ostream&
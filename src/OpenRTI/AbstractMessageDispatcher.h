@@ -34,6 +34,8 @@ class DestroyFederationExecutionRequestMessage;
 class DestroyFederationExecutionResponseMessage;
 class EnumerateFederationExecutionsRequestMessage;
 class EnumerateFederationExecutionsResponseMessage;
+class MetricsRequestMessage;
+class MetricsResponseMessage;
 class InsertFederationExecutionMessage;
 class ShutdownFederationExecutionMessage;
 class EraseFederationExecutionMessage;
@@ -51,10 +53,28 @@ class RegisterFederationSynchronizationPointResponseMessage;
 class AnnounceSynchronizationPointMessage;
 class SynchronizationPointAchievedMessage;
 class FederationSynchronizedMessage;
+class RequestFederationSaveMessage;
+class InitiateFederateSaveMessage;
+class FederateSaveBegunMessage;
+class FederateSaveCompleteMessage;
+class FederationSavedMessage;
+class AbortFederationSaveMessage;
+class QueryFederationSaveStatusRequestMessage;
+class QueryFederationSaveStatusResponseMessage;
+class RequestFederationRestoreMessage;
+class RequestFederationRestoreResponseMessage;
+class FederationRestoreBegunMessage;
+class InitiateFederateRestoreMessage;
+class FederateRestoreCompleteMessage;
+class FederationRestoredMessage;
+class AbortFederationRestoreMessage;
+class QueryFederationRestoreStatusRequestMessage;
+class QueryFederationRestoreStatusResponseMessage;
 class EnableTimeRegulationRequestMessage;
 class EnableTimeRegulationResponseMessage;
 class DisableTimeRegulationRequestMessage;
 class CommitLowerBoundTimeStampMessage;
+class CollectedCommitLowerBoundTimeStampMessage;
 class CommitLowerBoundTimeStampResponseMessage;
 class LockedByNextMessageRequestMessage;
 class TimeConstrainedEnabledMessage;
@@ -81,12 +101,22 @@ class ReserveObjectInstanceNameResponseMessage;
 class ReserveMultipleObjectInstanceNameRequestMessage;
 class ReserveMultipleObjectInstanceNameResponseMessage;
 class InsertObjectInstanceMessage;
+class InsertMultipleObjectInstancesMessage;
 class DeleteObjectInstanceMessage;
 class TimeStampedDeleteObjectInstanceMessage;
 class AttributeUpdateMessage;
 class TimeStampedAttributeUpdateMessage;
 class RequestAttributeUpdateMessage;
 class RequestClassAttributeUpdateMessage;
+class ChangeAttributeTransportationTypeRequestMessage;
+class ChangeAttributeTransportationTypeResponseMessage;
+class ChangeInteractionTransportationTypeRequestMessage;
+class ChangeInteractionTransportationTypeResponseMessage;
+class QueryAttributeTransportationTypeRequestMessage;
+class QueryAttributeTransportationTypeResponseMessage;
+class QueryInteractionTransportationTypeRequestMessage;
+class QueryInteractionTransportationTypeResponseMessage;
+class MessageRetractionMessage;
 
 class OPENRTI_LOCAL AbstractMessageDispatcher {
 public:
@@ -99,6 +129,8 @@ public:
   virtual void accept(const DestroyFederationExecutionResponseMessage&) const = 0;
   virtual void accept(const EnumerateFederationExecutionsRequestMessage&) const = 0;
   virtual void accept(const EnumerateFederationExecutionsResponseMessage&) const = 0;
+  virtual void accept(const MetricsRequestMessage&) const = 0;
+  virtual void accept(const MetricsResponseMessage&) const = 0;
   virtual void accept(const InsertFederationExecutionMessage&) const = 0;
   virtual void accept(const ShutdownFederationExecutionMessage&) const = 0;
   virtual void accept(const EraseFederationExecutionMessage&) const = 0;
@@ -116,10 +148,28 @@ public:
   virtual void accept(const AnnounceSynchronizationPointMessage&) const = 0;
   virtual void accept(const SynchronizationPointAchievedMessage&) const = 0;
   virtual void accept(const FederationSynchronizedMessage&) const = 0;
+  virtual void accept(const RequestFederationSaveMessage&) const = 0;
+  virtual void accept(const InitiateFederateSaveMessage&) const = 0;
+  virtual void accept(const FederateSaveBegunMessage&) const = 0;
+  virtual void accept(const FederateSaveCompleteMessage&) const = 0;
+  virtual void accept(const FederationSavedMessage&) const = 0;
+  virtual void accept(const AbortFederationSaveMessage&) const = 0;
+  virtual void accept(const QueryFederationSaveStatusRequestMessage&) const = 0;
+  virtual void accept(const QueryFederationSaveStatusResponseMessage&) const = 0;
+  virtual void accept(const RequestFederationRestoreMessage&) const = 0;
+  virtual void accept(const RequestFederationRestoreResponseMessage&) const = 0;
+  virtual void accept(const FederationRestoreBegunMessage&) const = 0;
+  virtual void accept(const InitiateFederateRestoreMessage&) const = 0;
+  virtual void accept(const FederateRestoreCompleteMessage&) const = 0;
+  virtual void accept(const FederationRestoredMessage&) const = 0;
+  virtual void accept(const AbortFederationRestoreMessage&) const = 0;
+  virtual void accept(const QueryFederationRestoreStatusRequestMessage&) const = 0;
+  virtual void accept(const QueryFederationRestoreStatusResponseMessage&) const = 0;
   virtual void accept(const EnableTimeRegulationRequestMessage&) const = 0;
   virtual void accept(const EnableTimeRegulationResponseMessage&) const = 0;
   virtual void accept(const DisableTimeRegulationRequestMessage&) const = 0;
   virtual void accept(const CommitLowerBoundTimeStampMessage&) const = 0;
+  virtual void accept(const CollectedCommitLowerBoundTimeStampMessage&) const = 0;
   virtual void accept(const CommitLowerBoundTimeStampResponseMessage&) const = 0;
   virtual void accept(const LockedByNextMessageRequestMessage&) const = 0;
   virtual void accept(const TimeConstrainedEnabledMessage&) const = 0;
@@ -146,12 +196,22 @@ public:
   virtual void accept(const ReserveMultipleObjectInstanceNameRequestMessage&) const = 0;
   virtual void accept(const ReserveMultipleObjectInstanceNameResponseMessage&) const = 0;
   virtual void accept(const InsertObjectInstanceMessage&) const = 0;
+  virtual void accept(const InsertMultipleObjectInstancesMessage&) const = 0;
   virtual void accept(const DeleteObjectInstanceMessage&) const = 0;
   virtual void accept(const TimeStampedDeleteObjectInstanceMessage&) const = 0;
   virtual void accept(const AttributeUpdateMessage&) const = 0;
   virtual void accept(const TimeStampedAttributeUpdateMessage&) const = 0;
   virtual void accept(const RequestAttributeUpdateMessage&) const = 0;
   virtual void accept(const RequestClassAttributeUpdateMessage&) const = 0;
+  virtual void accept(const ChangeAttributeTransportationTypeRequestMessage&) const = 0;
+  virtual void accept(const ChangeAttributeTransportationTypeResponseMessage&) const = 0;
+  virtual void accept(const ChangeInteractionTransportationTypeRequestMessage&) const = 0;
+  virtual void accept(const ChangeInteractionTransportationTypeResponseMessage&) const = 0;
+  virtual void accept(const QueryAttributeTransportationTypeRequestMessage&) const = 0;
+  virtual void accept(const QueryAttributeTransportationTypeResponseMessage&) const = 0;
+  virtual void accept(const QueryInteractionTransportationTypeRequestMessage&) const = 0;
+  virtual void accept(const QueryInteractionTransportationTypeResponseMessage&) const = 0;
+  virtual void accept(const MessageRetractionMessage&) const = 0;
 };
 
 template<typename T>
@@ -167,6 +227,8 @@ public:
   virtual void accept(const DestroyFederationExecutionResponseMessage& message) const { _t(message); }
   virtual void accept(const EnumerateFederationExecutionsRequestMessage& message) const { _t(message); }
   virtual void accept(const EnumerateFederationExecutionsResponseMessage& message) const { _t(message); }
+  virtual void accept(const MetricsRequestMessage& message) const { _t(message); }
+  virtual void accept(const MetricsResponseMessage& message) const { _t(message); }
   virtual void accept(const InsertFederationExecutionMessage& message) const { _t(message); }
   virtual void accept(const ShutdownFederationExecutionMessage& message) const { _t(message); }
   virtual void accept(const EraseFederationExecutionMessage& message) const { _t(message); }
@@ -184,10 +246,28 @@ public:
   virtual void accept(const AnnounceSynchronizationPointMessage& message) const { _t(message); }
   virtual void accept(const SynchronizationPointAchievedMessage& message) const { _t(message); }
   virtual void accept(const FederationSynchronizedMessage& message) const { _t(message); }
+  virtual void accept(const RequestFederationSaveMessage& message) const { _t(message); }
+  virtual void accept(const InitiateFederateSaveMessage& message) const { _t(message); }
+  virtual void accept(const FederateSaveBegunMessage& message) const { _t(message); }
+  virtual void accept(const FederateSaveCompleteMessage& message) const { _t(message); }
+  virtual void accept(const FederationSavedMessage& message) const { _t(message); }
+  virtual void accept(const AbortFederationSaveMessage& message) const { _t(message); }
+  virtual void accept(const QueryFederationSaveStatusRequestMessage& message) const { _t(message); }
+  virtual void accept(const QueryFederationSaveStatusResponseMessage& message) const { _t(message); }
+  virtual void accept(const RequestFederationRestoreMessage& message) const { _t(message); }
+  virtual void accept(const RequestFederationRestoreResponseMessage& message) const { _t(message); }
+  virtual void accept(const FederationRestoreBegunMessage& message) const { _t(message); }
+  virtual void accept(const InitiateFederateRestoreMessage& message) const { _t(message); }
+  virtual void accept(const FederateRestoreCompleteMessage& message) const { _t(message); }
+  virtual void accept(const FederationRestoredMessage& message) const { _t(message); }
+  virtual void accept(const AbortFederationRestoreMessage& message) const { _t(message); }
+  virtual void accept(const QueryFederationRestoreStatusRequestMessage& message) const { _t(message); }
+  virtual void accept(const QueryFederationRestoreStatusResponseMessage& message) const { _t(message); }
   virtual void accept(const EnableTimeRegulationRequestMessage& message) const { _t(message); }
   virtual void accept(const EnableTimeRegulationResponseMessage& message) const { _t(message); }
   virtual void accept(const DisableTimeRegulationRequestMessage& message) const { _t(message); }
   virtual void accept(const CommitLowerBoundTimeStampMessage& message) const { _t(message); }
+  virtual void accept(const CollectedCommitLowerBoundTimeStampMessage& message) const { _t(message); }
   virtual void accept(const CommitLowerBoundTimeStampResponseMessage& message) const { _t(message); }
   virtual void accept(const LockedByNextMessageRequestMessage& message) const { _t(message); }
   virtual void accept(const TimeConstrainedEnabledMessage& message) const { _t(message); }
@@ -214,12 +294,22 @@ public:
   virtual void accept(const ReserveMultipleObjectInstanceNameRequestMessage& message) const { _t(message); }
   virtual void accept(const ReserveMultipleObjectInstanceNameResponseMessage& message) const { _t(message); }
   virtual void accept(const InsertObjectInstanceMessage& message) const { _t(message); }
+  virtual void accept(const InsertMultipleObjectInstancesMessage& message) const { _t(message); }
   virtual void accept(const DeleteObjectInstanceMessage& message) const { _t(message); }
   virtual void accept(const TimeStampedDeleteObjectInstanceMessage& message) const { _t(message); }
   virtual void accept(const AttributeUpdateMessage& message) const { _t(message); }
   virtual void accept(const TimeStampedAttributeUpdateMessage& message) const { _t(message); }
   virtual void accept(const RequestAttributeUpdateMessage& message) const { _t(message); }
   virtual void accept(const RequestClassAttributeUpdateMessage& message) const { _t(message); }
+  virtual void accept(const ChangeAttributeTransportationTypeRequestMessage& message) const { _t(message); }
+  virtual void accept(const ChangeAttributeTransportationTypeResponseMessage& message) const { _t(message); }
+  virtual void accept(const ChangeInteractionTransportationTypeRequestMessage& message) const { _t(message); }
+  virtual void accept(const ChangeInteractionTransportationTypeResponseMessage& message) const { _t(message); }
+  virtual void accept(const QueryAttributeTransportationTypeRequestMessage& message) const { _t(message); }
+  virtual void accept(const QueryAttributeTransportationTypeResponseMessage& message) const { _t(message); }
+  virtual void accept(const QueryInteractionTransportationTypeRequestMessage& message) const { _t(message); }
+  virtual void accept(const QueryInteractionTransportationTypeResponseMessage& message) const { _t(message); }
+  virtual void accept(const MessageRetractionMessage& message) const { _t(message); }
 private:
   T& _t;
 };
@@ -237,6 +327,8 @@ public:
   virtual void accept(const DestroyFederationExecutionResponseMessage& message) const { _t(message); }
   virtual void accept(const EnumerateFederationExecutionsRequestMessage& message) const { _t(message); }
   virtual void accept(const EnumerateFederationExecutionsResponseMessage& message) const { _t(message); }
+  virtual void accept(const MetricsRequestMessage& message) const { _t(message); }
+  virtual void accept(const MetricsResponseMessage& message) const { _t(message); }
   virtual void accept(const InsertFederationExecutionMessage& message) const { _t(message); }
   virtual void accept(const ShutdownFederationExecutionMessage& message) const { _t(message); }
   virtual void accept(const EraseFederationExecutionMessage& message) const { _t(message); }
@@ -254,10 +346,28 @@ public:
   virtual void accept(const AnnounceSynchronizationPointMessage& message) const { _t(message); }
   virtual void accept(const SynchronizationPointAchievedMessage& message) const { _t(message); }
   virtual void accept(const FederationSynchronizedMessage& message) const { _t(message); }
+  virtual void accept(const RequestFederationSaveMessage& message) const { _t(message); }
+  virtual void accept(const InitiateFederateSaveMessage& message) const { _t(message); }
+  virtual void accept(const FederateSaveBegunMessage& message) const { _t(message); }
+  virtual void accept(const FederateSaveCompleteMessage& message) const { _t(message); }
+  virtual void accept(const FederationSavedMessage& message) const { _t(message); }
+  virtual void accept(const AbortFederationSaveMessage& message) const { _t(message); }
+  virtual void accept(const QueryFederationSaveStatusRequestMessage& message) const { _t(message); }
+  virtual void accept(const QueryFederationSaveStatusResponseMessage& message) const { _t(message); }
+  virtual void accept(const RequestFederationRestoreMessage& message) const { _t(message); }
+  virtual void accept(const RequestFederationRestoreResponseMessage& message) const { _t(message); }
+  virtual void accept(const FederationRestoreBegunMessage& message) const { _t(message); }
+  virtual void accept(const InitiateFederateRestoreMessage& message) const { _t(message); }
+  virtual void accept(const FederateRestoreCompleteMessage& message) const { _t(message); }
+  virtual void accept(const FederationRestoredMessage& message) const { _t(message); }
+  virtual void accept(const AbortFederationRestoreMessage& message) const { _t(message); }
+  virtual void accept(const QueryFederationRestoreStatusRequestMessage& message) const { _t(message); }
+  virtual void accept(const QueryFederationRestoreStatusResponseMessage& message) const { _t(message); }
   virtual void accept(const EnableTimeRegulationRequestMessage& message) const { _t(message); }
   virtual void accept(const EnableTimeRegulationResponseMessage& message) const { _t(message); }
   virtual void accept(const DisableTimeRegulationRequestMessage& message) const { _t(message); }
   virtual void accept(const CommitLowerBoundTimeStampMessage& message) const { _t(message); }
+  virtual void accept(const CollectedCommitLowerBoundTimeStampMessage& message) const { _t(message); }
   virtual void accept(const CommitLowerBoundTimeStampResponseMessage& message) const { _t(message); }
   virtual void accept(const LockedByNextMessageRequestMessage& message) const { _t(message); }
   virtual void accept(const TimeConstrainedEnabledMessage& message) const { _t(message); }
@@ -284,12 +394,22 @@ public:
   virtual void accept(const ReserveMultipleObjectInstanceNameRequestMessage& message) const { _t(message); }
   virtual void accept(const ReserveMultipleObjectInstanceNameResponseMessage& message) const { _t(message); }
   virtual void accept(const InsertObjectInstanceMessage& message) const { _t(message); }
+  virtual void accept(const InsertMultipleObjectInstancesMessage& message) const { _t(message); }
   virtual void accept(const DeleteObjectInstanceMessage& message) const { _t(message); }
   virtual void accept(const TimeStampedDeleteObjectInstanceMessage& message) const { _t(message); }
   virtual void accept(const AttributeUpdateMessage& message) const { _t(message); }
   virtual void accept(const TimeStampedAttributeUpdateMessage& message) const { _t(message); }
   virtual void accept(const RequestAttributeUpdateMessage& message) const { _t(message); }
   virtual void accept(const RequestClassAttributeUpdateMessage& message) const { _t(message); }
+  virtual void accept(const ChangeAttributeTransportationTypeRequestMessage& message) const { _t(message); }
+  virtual void accept(const ChangeAttributeTransportationTypeResponseMessage& message) const { _t(message); }
+  virtual void accept(const ChangeInteractionTransportationTypeRequestMessage& message) const { _t(message); }
+  virtual void accept(const ChangeInteractionTransportationTypeResponseMessage& message) const { _t(message); }
+  virtual void accept(const QueryAttributeTransportationTypeRequestMessage& message) const { _t(message); }
+  virtual void accept(const QueryAttributeTransportationTypeResponseMessage& message) const { _t(message); }
+  virtual void accept(const QueryInteractionTransportationTypeRequestMessage& message) const { _t(message); }
+  virtual void accept(const QueryInteractionTransportationTypeResponseMessage& message) const { _t(message); }
+  virtual void accept(const MessageRetractionMessage& message) const { _t(message); }
 private:
   const T& _t;
 };
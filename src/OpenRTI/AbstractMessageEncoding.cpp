@@ -19,11 +19,76 @@
 
 #include "AbstractMessageEncoding.h"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include "AbstractProtocolSocket.h"
+#include "DecodeDataStream.h"
+#include "EncodeDataStream.h"
 #include "Message.h"
+#include "MessageEncodingRegistry.h"
+#include "Metrics.h"
 
 namespace OpenRTI {
 
-AbstractMessageEncoding::AbstractMessageEncoding()
+// Feeds a reassembled message into the read path of an encoding
+class OPENRTI_LOCAL FragmentProtocolSocket : public AbstractProtocolSocket {
+public:
+  FragmentProtocolSocket(const VariableLengthData& variableLengthData) :
+    _variableLengthData(variableLengthData),
+    _offset(0)
+  { }
+
+  virtual ssize_t recv(const BufferRange& bufferRange, bool peek)
+  {
+    OpenRTIAssert(!peek);
+
+    // If we have nothing to read, return EAGAIN
+    if (_variableLengthData.size() <= _offset)
+      return -1;
+
+    ssize_t bytesRead = 0;
+    Buffer::byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second && _offset < _variableLengthData.size()) {
+      size_t size = std::min(i.chunk_size(bufferRange.second), _variableLengthData.size() - _offset);
+      std::memcpy(i.data(), _variableLengthData.charData(_offset), size);
+      _offset += size;
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesRead += size;
+    }
+    return bytesRead;
+  }
+  virtual ssize_t send(const ConstBufferRange&, bool)
+  { return 0; }
+  virtual void close()
+  { }
+  virtual void replaceProtocol(const SharedPtr<AbstractProtocolLayer>&)
+  { }
+
+  bool getComplete() const
+  { return _offset == _variableLengthData.size(); }
+
+private:
+  const VariableLengthData& _variableLengthData;
+  size_t _offset;
+};
+
+static uint64_t
+getBufferSize(const Buffer& buffer)
+{
+  uint64_t size = 0;
+  for (Buffer::const_iterator i = buffer.begin(); i != buffer.end(); ++i)
+    size += i->size();
+  return size;
+}
+
+AbstractMessageEncoding::AbstractMessageEncoding() :
+  _sampleCount(0),
+  _enableTraceExtension(false),
+  _enableFragmentExtension(false),
+  _fragmentOutputOffset(0)
 {
 }
 
@@ -31,6 +96,18 @@ AbstractMessageEncoding::~AbstractMessageEncoding()
 {
 }
 
+void
+AbstractMessageEncoding::setEnableDeltaCompression(bool enableDeltaCompression)
+{
+  if (enableDeltaCompression) {
+    _deltaCompressionEncoder = new DeltaCompressionEncoder;
+    _deltaCompressionDecoder = new DeltaCompressionDecoder;
+  } else {
+    _deltaCompressionEncoder.clear();
+    _deltaCompressionDecoder.clear();
+  }
+}
+
 bool
 AbstractMessageEncoding::getEnableRead() const
 {
@@ -40,15 +117,33 @@ AbstractMessageEncoding::getEnableRead() const
 void
 AbstractMessageEncoding::writePacket()
 {
+  // While a bulk message is in transit, only control messages may go in between its fragments
+  if (_fragmentOutputOffset < _fragmentOutput.size()) {
+    SharedPtr<const AbstractMessage> message = _connect->receiveControl();
+    if (message.valid())
+      writeEncodedMessage(*message);
+    else
+      writeMessageFragment();
+    return;
+  }
+
   SharedPtr<const AbstractMessage> message = _connect->receive();
   if (!message.valid())
     return;
-  writeMessage(*message);
+  writeEncodedMessage(*message);
+
+  if (!_enableFragmentExtension || message->getPriority() != AbstractMessage::BulkPriority)
+    return;
+  if (getBufferSize(getOutputBuffer()) <= MessageFragmentSize)
+    return;
+  takeOutputBuffer(_fragmentOutput);
+  _fragmentOutputOffset = 0;
+  writeMessageFragment();
 }
 
 bool AbstractMessageEncoding::getMoreToSend() const
 {
-  return !_connect->empty();
+  return _fragmentOutputOffset < _fragmentOutput.size() || !_connect->empty();
 }
 
 void
@@ -61,4 +156,185 @@ AbstractMessageEncoding::error(const Exception& e)
   _connect->close();
 }
 
+bool
+AbstractMessageEncoding::writeMessageTrace(const AbstractMessage& message)
+{
+  if (!_enableTraceExtension)
+    return false;
+  const MessageTrace* messageTrace = message.getMessageTrace();
+  if (!messageTrace)
+    return false;
+
+  // The message may be sent to several connects, so the encode stamp only goes to the wire
+  MessageTrace::StampVector stampVector = messageTrace->getStampVector();
+  stampVector.push_back(MessageTrace::Stamp(MessageTrace::EncodePoint, Clock::now().getNSec()));
+
+  EncodeDataStream headerStream(addScratchWriteBuffer());
+  EncodeDataStream encodeStream(addScratchWriteBuffer());
+  encodeStream.writeUInt16Compressed(MessageTraceOpcode);
+  encodeStream.writeUInt64Compressed(messageTrace->getTraceId());
+  encodeStream.writeUInt32Compressed(uint32_t(stampVector.size()));
+  for (MessageTrace::StampVector::const_iterator i = stampVector.begin(); i != stampVector.end(); ++i) {
+    encodeStream.writeUInt32Compressed(i->_point);
+    encodeStream.writeUInt64Compressed(i->_nsec);
+  }
+  headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  return true;
+}
+
+void
+AbstractMessageEncoding::readMessageTrace(DecodeDataStream& decodeStream)
+{
+  _messageTrace = new MessageTrace(decodeStream.readUInt64Compressed());
+  MessageTrace::StampVector stampVector(decodeStream.readUInt32Compressed());
+  for (MessageTrace::StampVector::iterator i = stampVector.begin(); i != stampVector.end(); ++i) {
+    i->_point = decodeStream.readUInt32Compressed();
+    i->_nsec = decodeStream.readUInt64Compressed();
+  }
+  _messageTrace->setStampVector(stampVector);
+}
+
+void
+AbstractMessageEncoding::attachMessageTrace(const AbstractMessage& message)
+{
+  if (!_messageTrace.valid())
+    return;
+  message.setMessageTrace(_messageTrace.get());
+  _messageTrace.clear();
+  message.stampMessageTrace(MessageTrace::DecodePoint);
+}
+
+void
+AbstractMessageEncoding::writeEncodedMessage(const AbstractMessage& message)
+{
+  // Delta packets depend on what was sent on this connect before
+  if (_deltaCompressionEncoder.valid()) {
+    const AttributeUpdateMessage* attributeUpdate = dynamic_cast<const AttributeUpdateMessage*>(&message);
+    if (attributeUpdate) {
+      writeMessageDelta(*attributeUpdate);
+      return;
+    }
+  }
+
+  const EncodedMessage* encodedMessage = message.getEncodedMessage();
+  if (encodedMessage && encodedMessage->isEncoding(getName())) {
+    writeMessageTrace(message);
+    for (VariableLengthDataList::const_iterator i = encodedMessage->getBufferList().begin();
+         i != encodedMessage->getBufferList().end(); ++i)
+      addWriteBuffer(*i);
+    writeMessageMetrics(encodedMessage->getOpcode(), message, getOutputBuffer());
+    return;
+  }
+
+  writeMessage(message);
+  // Nobody else will write this message
+  if (!Referenced::shared(&message))
+    return;
+
+  // Skip the trace packet, this one is written per connect
+  Buffer::const_iterator i = getOutputBuffer().begin();
+  if (_enableTraceExtension && message.getMessageTrace())
+    std::advance(i, 2);
+  Buffer::const_iterator body = i;
+  if (i == getOutputBuffer().end() || ++body == getOutputBuffer().end())
+    return;
+  DecodeDataStream decodeStream(*body);
+  SharedPtr<EncodedMessage> newEncodedMessage = new EncodedMessage(getName(), decodeStream.readUInt16Compressed());
+  // The header and the body are written into scratch buffers that are reused
+  // for the next packet, the payload buffers are already shared with the message.
+  for (unsigned j = 0; i != getOutputBuffer().end(); ++i, ++j) {
+    if (j < 2)
+      newEncodedMessage->getBufferList().push_back(VariableLengthData(i->data(), i->size()));
+    else
+      newEncodedMessage->getBufferList().push_back(*i);
+  }
+  message.setEncodedMessage(newEncodedMessage.get());
+}
+
+void
+AbstractMessageEncoding::writeMessageDelta(const AttributeUpdateMessage& message)
+{
+  writeMessageTrace(message);
+  EncodeDataStream headerStream(addScratchWriteBuffer());
+  EncodeDataStream encodeStream(addScratchWriteBuffer());
+  encodeStream.writeUInt16Compressed(MessageDeltaOpcode);
+  _deltaCompressionEncoder->encode(encodeStream, message);
+  headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  writeMessageMetrics(MessageDeltaOpcode, message, getOutputBuffer());
+}
+
+SharedPtr<AbstractMessage>
+AbstractMessageEncoding::readMessageDelta(DecodeDataStream& decodeStream)
+{
+  if (!_deltaCompressionDecoder.valid())
+    throw MessageError("Received delta compressed message without delta compression!");
+  return _deltaCompressionDecoder->decode(decodeStream);
+}
+
+void
+AbstractMessageEncoding::writeMessageFragment()
+{
+  size_t size = std::min(size_t(MessageFragmentSize), _fragmentOutput.size() - _fragmentOutputOffset);
+  bool last = _fragmentOutputOffset + size == _fragmentOutput.size();
+
+  EncodeDataStream headerStream(addScratchWriteBuffer());
+  VariableLengthData& body = addScratchWriteBuffer();
+  EncodeDataStream encodeStream(body);
+  encodeStream.writeUInt16Compressed(MessageFragmentOpcode);
+  encodeStream.writeUInt8BE(last);
+  size_t offset = body.size();
+  body.resize(offset + size);
+  std::memcpy(body.charData(offset), _fragmentOutput.charData(_fragmentOutputOffset), size);
+  headerStream.writeUInt32BE(uint32_t(body.size()));
+
+  _fragmentOutputOffset += size;
+  if (!last)
+    return;
+  _fragmentOutput.resize(0);
+  _fragmentOutputOffset = 0;
+}
+
+void
+AbstractMessageEncoding::readMessageFragment(DecodeDataStream& decodeStream, const VariableLengthData& variableLengthData)
+{
+  bool last = decodeStream.readUInt8BE();
+  size_t offset = decodeStream.offset();
+  size_t size = _fragmentInput.size();
+  _fragmentInput.resize(size + variableLengthData.size() - offset);
+  std::memcpy(_fragmentInput.charData(size), variableLengthData.charData(offset), variableLengthData.size() - offset);
+  if (!last)
+    return;
+
+  if (!_fragmentDecoder.valid()) {
+    _fragmentDecoder = MessageEncodingRegistry::instance().getEncoding(getName());
+    if (!_fragmentDecoder.valid())
+      throw MessageError("Cannot reassemble message fragments!");
+    _fragmentDecoder->setConnect(_connect);
+    _fragmentDecoder->_deltaCompressionDecoder = _deltaCompressionDecoder;
+  }
+  FragmentProtocolSocket protocolSocket(_fragmentInput);
+  _fragmentDecoder->read(protocolSocket);
+  if (!protocolSocket.getComplete())
+    throw MessageError("Trailing data in reassembled message fragments!");
+  _fragmentInput.resize(0);
+}
+
+void
+AbstractMessageEncoding::readMessageMetrics(unsigned opcode, const AbstractMessage& message, const Buffer& buffer)
+{
+  uint64_t size = getBufferSize(buffer);
+  Metrics::instance().readMessage(opcode, message.getTypeName(), size);
+  if (_connect.valid() && _connect->getConnectMetrics())
+    _connect->getConnectMetrics()->getBytesIn().add(size);
+}
+
+void
+AbstractMessageEncoding::writeMessageMetrics(unsigned opcode, const AbstractMessage& message, const Buffer& buffer)
+{
+  uint64_t size = getBufferSize(buffer);
+  Metrics::instance().writeMessage(opcode, message.getTypeName(), size);
+  if (_connect.valid() && _connect->getConnectMetrics())
+    _connect->getConnectMetrics()->getBytesOut().add(size);
+}
+
 } // namespace OpenRTI
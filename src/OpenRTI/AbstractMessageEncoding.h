@@ -21,10 +21,14 @@
 #define OpenRTI_AbstractMessageEncoding_h
 
 #include "AbstractConnect.h"
+#include "DeltaCompression.h"
+#include "MessageTrace.h"
 #include "StreamBufferProtocol.h"
 
 namespace OpenRTI {
 
+class DecodeDataStream;
+
 class OPENRTI_API AbstractMessageEncoding : public StreamBufferProtocol {
 public:
   AbstractMessageEncoding();
@@ -38,6 +42,27 @@ public:
   /// Should return the name of the encoding
   virtual const char* getName() const = 0;
 
+  /// If enabled, message traces are sent along with the traced messages.
+  /// Negotiated in the connect options, the peer must be able to skip the trace packets.
+  void setEnableTraceExtension(bool enableTraceExtension)
+  { _enableTraceExtension = enableTraceExtension; }
+  bool getEnableTraceExtension() const
+  { return _enableTraceExtension; }
+
+  /// If enabled, large bulk messages are sent in fragments and control
+  /// messages queued behind them are sent in between these fragments.
+  /// Negotiated in the connect options, the peer must be able to reassemble the fragments.
+  void setEnableFragmentExtension(bool enableFragmentExtension)
+  { _enableFragmentExtension = enableFragmentExtension; }
+  bool getEnableFragmentExtension() const
+  { return _enableFragmentExtension; }
+
+  /// If enabled, attribute updates are sent as the changes to the values
+  /// last sent on this connect. Negotiated in the connect options.
+  void setEnableDeltaCompression(bool enableDeltaCompression);
+  bool getEnableDeltaCompression() const
+  { return _deltaCompressionEncoder.valid(); }
+
   /// Still to be implemented in the actual encodings
   virtual void readPacket(const Buffer& buffer) = 0;
   virtual void writeMessage(const AbstractMessage& message) = 0;
@@ -49,7 +74,62 @@ public:
   virtual void error(const Exception& e);
 
 protected:
+  /// The opcode of the packet carrying the trace of the following message
+  enum { MessageTraceOpcode = 255 };
+  /// The opcode of the packet carrying a fragment of a bulk message
+  enum { MessageFragmentOpcode = 254 };
+  /// Bulk messages larger than that are sent in fragments of that size
+  enum { MessageFragmentSize = 64*1024 };
+  /// The opcode of the packet carrying a delta compressed attribute update
+  enum { MessageDeltaOpcode = 253 };
+
+  /// Write the trace packet in front of a traced message, returns true if written
+  bool writeMessageTrace(const AbstractMessage& message);
+  /// Read the trace packet and attach it to the next complete message
+  void readMessageTrace(DecodeDataStream& decodeStream);
+  void attachMessageTrace(const AbstractMessage& message);
+
+  /// Write a message that is sent to several connects, encodes that only on the first connect
+  void writeEncodedMessage(const AbstractMessage& message);
+
+  /// Write the next fragment of the bulk message in transit
+  void writeMessageFragment();
+  /// Read a fragment packet, decodes the reassembled message with the last fragment
+  void readMessageFragment(DecodeDataStream& decodeStream, const VariableLengthData& variableLengthData);
+
+  /// Write an attribute update as a delta packet
+  void writeMessageDelta(const AttributeUpdateMessage& message);
+  /// Read a delta packet, returns the reconstructed attribute update
+  SharedPtr<AbstractMessage> readMessageDelta(DecodeDataStream& decodeStream);
+
+  /// Encode and decode times are only sampled to keep the clock off the hot path
+  bool getSampleTime()
+  { return (++_sampleCount & 0xf) == 0; }
+
+  /// Account a completely read or written message in the metrics
+  void readMessageMetrics(unsigned opcode, const AbstractMessage& message, const Buffer& buffer);
+  void writeMessageMetrics(unsigned opcode, const AbstractMessage& message, const Buffer& buffer);
+
   SharedPtr<AbstractConnect> _connect;
+
+private:
+  unsigned _sampleCount;
+
+  bool _enableTraceExtension;
+  SharedPtr<MessageTrace> _messageTrace;
+
+  bool _enableFragmentExtension;
+  // The encoded bulk message in transit and the size of the fragments already written
+  VariableLengthData _fragmentOutput;
+  size_t _fragmentOutputOffset;
+  // The fragments received so far, decoded by a second encoding once complete
+  VariableLengthData _fragmentInput;
+  SharedPtr<AbstractMessageEncoding> _fragmentDecoder;
+
+  // The state of the delta compression in both directions, the
+  // decoder is shared with the fragment decoder.
+  SharedPtr<DeltaCompressionEncoder> _deltaCompressionEncoder;
+  SharedPtr<DeltaCompressionDecoder> _deltaCompressionDecoder;
 };
 
 } // namespace OpenRTI
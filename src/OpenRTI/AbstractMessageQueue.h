@@ -47,6 +47,7 @@ public:
 protected:
   // FIXME may be only have const messages in delivery???
   virtual void append(const SharedPtr<const AbstractMessage>& message) = 0;
+  virtual unsigned retract(const MessageRetractionHandle& messageRetractionHandle) = 0;
   virtual void close() = 0;
 
 private:
@@ -64,6 +65,12 @@ private:
         throw RTIinternalError("Trying to send message to a closed MessageSender");
       _messageQueue->append(message);
     }
+    virtual unsigned retract(const MessageRetractionHandle& messageRetractionHandle)
+    {
+      if (!_messageQueue.valid())
+        return 0;
+      return _messageQueue->retract(messageRetractionHandle);
+    }
     virtual void close()
     {
       if (!_messageQueue.valid())
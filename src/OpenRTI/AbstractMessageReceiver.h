@@ -33,6 +33,8 @@ public:
   virtual ~AbstractMessageReceiver() {}
   virtual SharedPtr<const AbstractMessage> receive() = 0;
   virtual SharedPtr<const AbstractMessage> receive(const Clock& timeout) = 0;
+  /// Returns the next message only if it is a control message
+  virtual SharedPtr<const AbstractMessage> receiveControl() = 0;
   virtual bool empty() const = 0;
   virtual bool isOpen() const = 0;
 };
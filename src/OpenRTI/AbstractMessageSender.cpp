@@ -29,4 +29,10 @@ AbstractMessageSender::~AbstractMessageSender()
 {
 }
 
+unsigned
+AbstractMessageSender::retract(const MessageRetractionHandle&)
+{
+  return 0;
+}
+
 } // namespace OpenRTI
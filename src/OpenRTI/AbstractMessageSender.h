@@ -26,6 +26,7 @@
 namespace OpenRTI {
 
 class AbstractMessage;
+class MessageRetractionHandle;
 
 class OPENRTI_API AbstractMessageSender : public Referenced {
 public:
@@ -35,6 +36,10 @@ public:
   virtual void send(const SharedPtr<const AbstractMessage>& message) = 0;
   virtual void close() = 0;
   // virtual bool isOpen() const = 0;
+
+  /// Remove the not yet delivered messages with this retraction handle.
+  /// Returns the number of removed messages, the default implementation cannot remove anything.
+  virtual unsigned retract(const MessageRetractionHandle& messageRetractionHandle);
 };
 
 } // namespace OpenRTI
@@ -44,6 +44,12 @@ AbstractServer::_Queue::empty() const
   return _messageConnectHandlePairList.empty();
 }
 
+size_t
+AbstractServer::_Queue::size() const
+{
+  return _messageConnectHandlePairList.size();
+}
+
 void
 AbstractServer::_Queue::send(AbstractServer& serverLoop)
 {
@@ -225,6 +231,81 @@ AbstractServer::_DoneOperation::operator()(AbstractServer& serverLoop)
   serverLoop._sendDone(true);
 }
 
+class OPENRTI_LOCAL AbstractServer::_ServerNodeOperation : public AbstractServer::_Operation {
+public:
+  _ServerNodeOperation(const SharedPtr<AbstractServerNode::Operation>& operation);
+  virtual ~_ServerNodeOperation();
+  virtual void operator()(AbstractServer& serverLoop);
+
+private:
+  SharedPtr<AbstractServerNode::Operation> _operation;
+};
+
+AbstractServer::_ServerNodeOperation::_ServerNodeOperation(const SharedPtr<AbstractServerNode::Operation>& operation) :
+  _operation(operation)
+{
+}
+
+AbstractServer::_ServerNodeOperation::~_ServerNodeOperation()
+{
+}
+
+void
+AbstractServer::_ServerNodeOperation::operator()(AbstractServer& serverLoop)
+{
+  (*_operation)();
+}
+
+class OPENRTI_LOCAL AbstractServer::_ServerLoop : public AbstractServerNode::ServerLoop {
+public:
+  _ServerLoop(AbstractServer& serverLoop);
+  virtual ~_ServerLoop();
+
+  virtual void setTimeout(const Clock& timeout);
+  virtual bool postOperation(const SharedPtr<AbstractServerNode::Operation>& operation);
+  void close();
+
+private:
+  // The server node may hold this past the lifetime of the server, so no reference here
+  Mutex _mutex;
+  AbstractServer* _serverLoop;
+};
+
+AbstractServer::_ServerLoop::_ServerLoop(AbstractServer& serverLoop) :
+  _serverLoop(&serverLoop)
+{
+}
+
+AbstractServer::_ServerLoop::~_ServerLoop()
+{
+}
+
+void
+AbstractServer::_ServerLoop::setTimeout(const Clock& timeout)
+{
+  ScopeLock scopeLock(_mutex);
+  if (!_serverLoop)
+    return;
+  _serverLoop->_setTimeout(timeout);
+}
+
+bool
+AbstractServer::_ServerLoop::postOperation(const SharedPtr<AbstractServerNode::Operation>& operation)
+{
+  ScopeLock scopeLock(_mutex);
+  if (!_serverLoop)
+    return false;
+  _serverLoop->_postOperation(new _ServerNodeOperation(operation));
+  return true;
+}
+
+void
+AbstractServer::_ServerLoop::close()
+{
+  ScopeLock scopeLock(_mutex);
+  _serverLoop = 0;
+}
+
 class OPENRTI_LOCAL AbstractServer::_PostingMessageSender : public AbstractMessageSender {
 public:
   _PostingMessageSender(const SharedPtr<AbstractServer>& serverLoop, const ConnectHandle& connectHandle);
@@ -311,13 +392,17 @@ AbstractServer::_SendingMessageSender::close()
 
 AbstractServer::AbstractServer(const SharedPtr<AbstractServerNode>& serverNode) :
   _serverNode(serverNode),
-  _done(false)
+  _serverLoop(new _ServerLoop(*this)),
+  _done(false),
+  _timeout(Clock::max())
 {
   OpenRTIAssert(_serverNode.valid());
+  _serverNode->_setServerLoop(_serverLoop);
 }
 
 AbstractServer::~AbstractServer()
 {
+  _closeServerLoop();
 }
 
 const AbstractServerNode&
@@ -341,19 +426,34 @@ AbstractServer::postConnect(const StringStringListMap& clientOptions)
     return 0;
   SharedPtr<AbstractMessageSender> messageSender;
   messageSender = new _PostingMessageSender(this, connectHandle);
-  return new _Connect(messageSender, messageQueue);
+  SharedPtr<AbstractConnect> connect = new _Connect(messageSender, messageQueue);
+  connect->setConnectMetrics(new ConnectMetrics(connectHandle.toString()));
+  return connect;
 }
 
 SharedPtr<AbstractConnect>
 AbstractServer::sendConnect(const StringStringListMap& optionMap, bool parent)
 {
-  SharedPtr<LocalMessageQueue> messageQueue = new LocalMessageQueue;
+  return _createSendConnect(SharedPtr<AbstractMessageQueue>(new LocalMessageQueue), optionMap, parent);
+}
+
+SharedPtr<AbstractConnect>
+AbstractServer::sendNetworkConnect(const StringStringListMap& optionMap, bool parent)
+{
+  return _createSendConnect(SharedPtr<AbstractMessageQueue>(new NetworkMessageQueue), optionMap, parent);
+}
+
+SharedPtr<AbstractConnect>
+AbstractServer::_createSendConnect(const SharedPtr<AbstractMessageQueue>& messageQueue, const StringStringListMap& optionMap, bool parent)
+{
   ConnectHandle connectHandle = _sendConnect(messageQueue->getMessageSender(), optionMap, parent);
   if (!connectHandle.valid())
     return 0;
   SharedPtr<AbstractMessageSender> messageSender;
   messageSender = new _SendingMessageSender(&getServerNode(), connectHandle);
-  return new _Connect(messageSender, messageQueue);
+  SharedPtr<AbstractConnect> connect = new _Connect(messageSender, messageQueue);
+  connect->setConnectMetrics(new ConnectMetrics(connectHandle.toString()));
+  return connect;
 }
 
 ConnectHandle
@@ -404,6 +504,32 @@ AbstractServer::_sendDone(bool done)
   _done = done;
 }
 
+void
+AbstractServer::_setTimeout(const Clock& timeout)
+{
+  if (timeout < _timeout)
+    _timeout = timeout;
+}
+
+void
+AbstractServer::_sendTimeout(const Clock& now)
+{
+  if (now < _timeout)
+    return;
+  _timeout = Clock::max();
+  getServerNode()._timeout(now);
+}
+
+void
+AbstractServer::_closeServerLoop()
+{
+  if (!_serverLoop.valid())
+    return;
+  _serverLoop->close();
+  _serverLoop.clear();
+  _serverNode->_setServerLoop(SharedPtr<AbstractServerNode::ServerLoop>());
+}
+
 ConnectHandle
 AbstractServer::_postConnect(const SharedPtr<AbstractMessageSender>& messageSender, const StringStringListMap& clientOptions)
 {
@@ -23,12 +23,15 @@
 #include "AbstractConnect.h"
 #include "AbstractMessage.h"
 #include "AbstractServerNode.h"
+#include "Clock.h"
 #include "Mutex.h"
 #include "Referenced.h"
 #include "URL.h"
 
 namespace OpenRTI {
 
+class AbstractMessageQueue;
+
 // The input is implemented by the actual network side server.
 // This one must make sure that it fits the threading model of the network server side.
 // The output is implemented by this current class, probably just someting that dispatches into
@@ -58,6 +61,8 @@ public:
   /// Connect to the server - independent of the actual implementation
   SharedPtr<AbstractConnect> postConnect(const StringStringListMap& clientOptions);
   SharedPtr<AbstractConnect> sendConnect(const StringStringListMap& clientOptions, bool parent);
+  /// Connect of a network peer, best effort messages to the peer go to a lane of their own
+  SharedPtr<AbstractConnect> sendNetworkConnect(const StringStringListMap& clientOptions, bool parent);
 
 protected:
   typedef std::pair<SharedPtr<const AbstractMessage>, ConnectHandle> _MessageConnectHandlePair;
@@ -72,6 +77,7 @@ protected:
 
   // Connect to the server from the local thread
   ConnectHandle _sendConnect(const SharedPtr<AbstractMessageSender>& messageSender, const StringStringListMap& clientOptions, bool parent);
+  SharedPtr<AbstractConnect> _createSendConnect(const SharedPtr<AbstractMessageQueue>& messageQueue, const StringStringListMap& clientOptions, bool parent);
   void _sendEraseConnect(const ConnectHandle& connectHandle);
   void _sendDisconnect(const ConnectHandle& connectHandle);
 
@@ -80,6 +86,17 @@ protected:
   void _sendOperation(_Operation& operation);
   virtual void _sendDone(bool done);
 
+  // The time the server node wants its timeout to be called, Clock::max() if it does not.
+  const Clock& _getTimeout() const
+  { return _timeout; }
+  virtual void _setTimeout(const Clock& timeout);
+  // Call the server nodes timeout if the time has come.
+  void _sendTimeout(const Clock& now);
+
+  // Stop posting server node operations to this server.
+  // Called from the destructors before this server cannot take them anymore.
+  void _closeServerLoop();
+
   // Use this to send something from a different thread to this server.
   virtual void _postMessage(const _MessageConnectHandlePair& messageConnectHandlePair) = 0;
   virtual void _postOperation(const SharedPtr<_Operation>& operation) = 0;
@@ -94,6 +111,7 @@ protected:
   public:
     void swap(_Queue& queue);
     bool empty() const;
+    size_t size() const;
 
     void send(AbstractServer& serverLoop);
 
@@ -114,12 +132,16 @@ private:
   class _ConnectOperation;
   class _DisconnectOperation;
   class _DoneOperation;
+  class _ServerNodeOperation;
+  class _ServerLoop;
   class _PostingMessageSender;
   class _SendingMessageSender;
 
   SharedPtr<AbstractServerNode> _serverNode;
+  SharedPtr<_ServerLoop> _serverLoop;
 
   bool _done;
+  Clock _timeout;
 };
 
 } // namespace OpenRTI
@@ -29,4 +29,22 @@ AbstractServerNode::~AbstractServerNode()
 {
 }
 
+AbstractServerNode::Operation::~Operation()
+{
+}
+
+AbstractServerNode::ServerLoop::~ServerLoop()
+{
+}
+
+void
+AbstractServerNode::_setServerLoop(const SharedPtr<ServerLoop>&)
+{
+}
+
+void
+AbstractServerNode::_timeout(const Clock&)
+{
+}
+
 } // namespace OpenRTI
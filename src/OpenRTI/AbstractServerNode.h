@@ -21,6 +21,7 @@
 #define OpenRTI_AbstractServerNode_h
 
 #include "AbstractMessage.h"
+#include "Clock.h"
 #include "Handle.h"
 #include "Referenced.h"
 #include "SharedPtr.h"
@@ -43,6 +44,26 @@ public:
   AbstractServerNode();
   virtual ~AbstractServerNode();
 
+  /// Work that is done within the event loop running the server node.
+  class OPENRTI_API Operation : public Referenced {
+  public:
+    virtual ~Operation();
+    virtual void operator()() = 0;
+  };
+
+  /// The event loop running the server node, implemented by the server.
+  /// This way the server node still does not need to know anything about threads.
+  class OPENRTI_API ServerLoop : public Referenced {
+  public:
+    virtual ~ServerLoop();
+    /// Have _timeout called from the event loop not before the given time.
+    /// Only called from within the event loop.
+    virtual void setTimeout(const Clock& timeout) = 0;
+    /// Queue the operation into the event loop, may be called from any thread.
+    /// Returns false if there is no event loop anymore that could run the operation.
+    virtual bool postOperation(const SharedPtr<Operation>& operation) = 0;
+  };
+
   /// Hmm, make that more callback based during connection setup, but for now ...
   virtual ServerOptions& getServerOptions() = 0;
   virtual const ServerOptions& getServerOptions() const = 0;
@@ -57,6 +78,11 @@ public:
   virtual void _eraseConnect(const ConnectHandle& connectHandle) = 0;
   virtual void _dispatchMessage(const AbstractMessage* message, const ConnectHandle& connectHandle) = 0;
 
+  /// Set by the server that runs this node, cleared when it stops running it
+  virtual void _setServerLoop(const SharedPtr<ServerLoop>& serverLoop);
+  /// Called from the event loop once the time requested with ServerLoop::setTimeout is reached
+  virtual void _timeout(const Clock& now);
+
 private:
   AbstractServerNode(const AbstractServerNode&);
   AbstractServerNode& operator=(const AbstractServerNode&);
@@ -25,6 +25,7 @@
 #include "Export.h"
 #include "OpenRTIConfig.h"
 #include "AbstractConnect.h"
+#include "AttributeCache.h"
 #include "InternalAmbassador.h"
 #include "Clock.h"
 #include "Exception.h"
@@ -199,12 +200,29 @@ public:
     request->setFederationExecution(federationExecutionName);
     request->setFederateType(federateType);
     request->setFederateName(federateName);
-    request->setFOMStringModuleList(fomModules);
+    // Offer the modules by their content hash, usually the root server knows them already
+    for (FOMStringModuleList::const_iterator i = fomModules.begin(); i != fomModules.end(); ++i) {
+      if (i->getContentHash().empty())
+        request->getFOMStringModuleList().push_back(*i);
+      else
+        request->getFOMModuleContentHashVector().push_back(i->getContentHash());
+    }
 
     // Send this message and wait for the response
     send(request);
     std::pair<JoinFederationExecutionResponseType, std::string> response;
     response = dispatchWaitJoinFederationExecutionResponse(abstime);
+    if (response.first == JoinFederationExecutionResponseMissingFOMModules) {
+      _federate = 0;
+      // The root server does not know all of them, so send the full modules
+      request = new JoinFederationExecutionRequestMessage;
+      request->setFederationExecution(federationExecutionName);
+      request->setFederateType(federateType);
+      request->setFederateName(federateName);
+      request->setFOMStringModuleList(fomModules);
+      send(request);
+      response = dispatchWaitJoinFederationExecutionResponse(abstime);
+    }
     switch (response.first) {
     case JoinFederationExecutionResponseFederateNameAlreadyInUse:
       _federate = 0;
@@ -344,10 +362,21 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
+
+    SharedPtr<RequestFederationSaveMessage> request;
+    request = new RequestFederationSaveMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setLabel(label);
+    request->setTimeStampValid(false);
+    send(request);
   }
 
-  void requestFederationSave(const std::string& label, const NativeLogicalTime& locicalTime)
+  void requestFederationSave(const std::string& label, const NativeLogicalTime& logicalTime)
     // throw (LogicalTimeAlreadyPassed,
     //        InvalidLogicalTime,
     //        FederateUnableToUseTime,
@@ -361,7 +390,23 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (!_timeManagement.valid())
+      throw FederateNotExecutionMember();
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
+    if (_timeManagement->isLogicalTimeInThePast(logicalTime))
+      throw LogicalTimeAlreadyPassed(_timeManagement->logicalTimeToString(logicalTime));
+
+    SharedPtr<RequestFederationSaveMessage> request;
+    request = new RequestFederationSaveMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setLabel(label);
+    request->setTimeStamp(_timeManagement->encodeLogicalTime(logicalTime));
+    request->setTimeStampValid(true);
+    send(request);
   }
 
   void federateSaveBegun()
@@ -375,7 +420,18 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
+    if (_federate->getSaveStatus() != FEDERATE_INSTRUCTED_TO_SAVE)
+      throw SaveNotInitiated();
+
+    _federate->setSaveStatus(FEDERATE_SAVING);
+
+    SharedPtr<FederateSaveBegunMessage> request;
+    request = new FederateSaveBegunMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    send(request);
   }
 
   void federateSaveComplete()
@@ -385,11 +441,7 @@ public:
     //        NotConnected,
     //        RTIinternalError)
   {
-    if (!isConnected())
-      throw NotConnected();
-    if (!_federate.valid())
-      throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    _federateSaveComplete(true);
   }
 
   void federateSaveNotComplete()
@@ -398,12 +450,33 @@ public:
     //        RestoreInProgress,
     //        NotConnected,
     //        RTIinternalError)
+  {
+    _federateSaveComplete(false);
+  }
+
+  void _federateSaveComplete(bool successful)
   {
     if (!isConnected())
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
+    if (_federate->getSaveStatus() != FEDERATE_SAVING)
+      throw FederateHasNotBegunSave();
+
+    // The federate has saved its own state, take the rti internal state now.
+    if (successful && _timeManagement.valid())
+      _timeManagement->saveState(_federate->getSaveLabel());
+    _federate->setSaveStatus(FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE);
+
+    SharedPtr<FederateSaveCompleteMessage> request;
+    request = new FederateSaveCompleteMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setSuccessful(successful);
+    request->setSaveFailureReason(FEDERATE_REPORTED_FAILURE_DURING_SAVE);
+    send(request);
   }
 
   void abortFederationSave()
@@ -416,7 +489,14 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getSaveStatus() == NO_SAVE_IN_PROGRESS)
+      throw SaveNotInProgress();
+
+    SharedPtr<AbortFederationSaveMessage> request;
+    request = new AbortFederationSaveMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    send(request);
   }
 
   void queryFederationSaveStatus()
@@ -429,7 +509,14 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
+
+    SharedPtr<QueryFederationSaveStatusRequestMessage> request;
+    request = new QueryFederationSaveStatusRequestMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    send(request);
   }
 
   void requestFederationRestore(const std::string& label)
@@ -443,7 +530,17 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
+
+    SharedPtr<RequestFederationRestoreMessage> request;
+    request = new RequestFederationRestoreMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setLabel(label);
+    send(request);
   }
 
   void federateRestoreComplete()
@@ -453,11 +550,7 @@ public:
     //        NotConnected,
     //        RTIinternalError)
   {
-    if (!isConnected())
-      throw NotConnected();
-    if (!_federate.valid())
-      throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    _federateRestoreComplete(true);
   }
 
   void federateRestoreNotComplete()
@@ -466,12 +559,30 @@ public:
     //        SaveInProgress,
     //        NotConnected,
     //        RTIinternalError)
+  {
+    _federateRestoreComplete(false);
+  }
+
+  void _federateRestoreComplete(bool successful)
   {
     if (!isConnected())
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != FEDERATE_RESTORING)
+      throw RestoreNotRequested();
+
+    _federate->setRestoreStatus(FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE);
+
+    // The restore only succeeds if the rti internal state could be restored as well
+    SharedPtr<FederateRestoreCompleteMessage> request;
+    request = new FederateRestoreCompleteMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setSuccessful(successful && _federate->getRestoreStateValid());
+    send(request);
   }
 
   void abortFederationRestore()
@@ -484,7 +595,14 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getRestoreStatus() == NO_RESTORE_IN_PROGRESS)
+      throw RestoreNotInProgress();
+
+    SharedPtr<AbortFederationRestoreMessage> request;
+    request = new AbortFederationRestoreMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    send(request);
   }
 
   void queryFederationRestoreStatus()
@@ -497,7 +615,14 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Save/Restore not implemented!");
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+
+    SharedPtr<QueryFederationRestoreStatusRequestMessage> request;
+    request = new QueryFederationRestoreStatusRequestMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    send(request);
   }
 
   // Note that the attributeHandleVector is consumed as if it could be with a lref in c++11
@@ -745,10 +870,12 @@ public:
     for (AttributeHandleVector::const_iterator i = attributeHandleVector.begin(); i != attributeHandleVector.end(); ++i)
       if (!objectClass->getAttribute(*i))
         throw AttributeNotDefined(i->toString());
-    if (!updateRateDesignator.empty() && _federate->getUpdateRateValue(updateRateDesignator) < 0)
-      throw InvalidUpdateRateDesignator(updateRateDesignator);
-    if (!updateRateDesignator.empty())
-      throw RTIinternalError("Non trvial update rate designators are not implemented yet!");
+    double updateRate = 0;
+    if (!updateRateDesignator.empty()) {
+      updateRate = _federate->getUpdateRateValue(updateRateDesignator);
+      if (updateRate < 0)
+        throw InvalidUpdateRateDesignator(updateRateDesignator);
+    }
 
     // now that we know not to throw, handle the request
     SubscriptionType subscriptionType;
@@ -774,8 +901,10 @@ public:
     }
     if (j != attributeHandleVector.end())
       attributeHandleVector.erase(j, attributeHandleVector.end());
+    // The server reduces the update rate, so it needs to know about a changed rate too
+    bool updateRateChanged = objectClass->setUpdateRate(updateRate);
     // If there has nothing changed, don't send anything.
-    if (attributeHandleVector.empty())
+    if (attributeHandleVector.empty() && !updateRateChanged)
       return;
 
     SharedPtr<ChangeObjectClassSubscriptionMessage> request = new ChangeObjectClassSubscriptionMessage;
@@ -783,6 +912,7 @@ public:
     request->setObjectClassHandle(objectClassHandle);
     request->getAttributeHandles().swap(attributeHandleVector);
     request->setSubscriptionType(subscriptionType);
+    request->setUpdateRate(updateRate);
     send(request);
   }
 
@@ -810,6 +940,7 @@ public:
     // Append this to the request if this subscription has changed
     if (objectClass->setSubscriptionType(Unsubscribed))
       attributeHandleVector.push_back(AttributeHandle(0));
+    objectClass->setUpdateRate(0);
     for (size_t i = 0; i < objectClass->getNumAttributes(); ++i) {
       // returns true if there is a change in the subscription state
       if (!objectClass->setAttributeSubscriptionType(AttributeHandle(i), Unsubscribed))
@@ -1325,6 +1456,9 @@ public:
 
     MessageRetractionHandle messageRetractionHandle = getNextMessageRetractionHandle();
     VariableLengthData timeStamp = getTimeManagement()->encodeLogicalTime(nativeLogicalTime);
+    // Only time stamp order messages can be retracted
+    if (!passels[0][TIMESTAMP].empty() || !passels[1][TIMESTAMP].empty())
+      getTimeManagement()->insertRetractableMessage(messageRetractionHandle, nativeLogicalTime);
 
     for (unsigned i = 0; i < 2; ++i) {
       for (unsigned j = 0; j < 2; ++j) {
@@ -1432,6 +1566,9 @@ public:
     request->getParameterValues().swap(parameterValues);
     send(request);
 
+    if (request->getOrderType() == TIMESTAMP)
+      getTimeManagement()->insertRetractableMessage(messageRetractionHandle, logicalTime);
+
     return messageRetractionHandle;
   }
 
@@ -1514,7 +1651,7 @@ public:
     _releaseObjectInstance(objectInstanceHandle);
 
     // FIXME: see above - make sure we do not hand a valid retraction handle
-    // over to the user until this is implemented.
+    // over to the user until the object instance release is delayed.
     // return messageRetractionHandle;
     return MessageRetractionHandle();
   }
@@ -1654,7 +1791,8 @@ public:
     send(request);
   }
 
-  void requestAttributeTransportationTypeChange(ObjectInstanceHandle, const AttributeHandleVector&, TransportationType)
+  void requestAttributeTransportationTypeChange(ObjectInstanceHandle objectInstanceHandle, const AttributeHandleVector& attributeHandleVector,
+                                                TransportationType transportationType)
     // throw (AttributeAlreadyBeingChanged,
     //        AttributeNotOwned,
     //        AttributeNotDefined,
@@ -1670,10 +1808,36 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Not implemented");
+    // Both standard transportation types are always available, even if the fom does not name them
+    if (transportationType != RELIABLE && transportationType != BEST_EFFORT)
+      throw InvalidTransportationType();
+    Federate::ObjectInstance* objectInstance = _federate->getObjectInstance(objectInstanceHandle);
+    if (!objectInstance)
+      throw ObjectInstanceNotKnown(objectInstanceHandle.toString());
+    for (AttributeHandleVector::const_iterator j = attributeHandleVector.begin(); j != attributeHandleVector.end(); ++j) {
+      const Federate::InstanceAttribute* attribute = objectInstance->getInstanceAttribute(j->getHandle());
+      if (!attribute)
+        throw AttributeNotDefined(j->toString());
+      if (!attribute->getIsOwnedByFederate())
+        throw AttributeNotOwned(j->toString());
+    }
+
+    // The following updates already go with the new transportation type,
+    // the root server confirms once the change is visible for queries.
+    for (AttributeHandleVector::const_iterator j = attributeHandleVector.begin(); j != attributeHandleVector.end(); ++j)
+      objectInstance->getInstanceAttribute(j->getHandle())->setTransportationType(transportationType);
+
+    SharedPtr<ChangeAttributeTransportationTypeRequestMessage> request;
+    request = new ChangeAttributeTransportationTypeRequestMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setObjectInstanceHandle(objectInstanceHandle);
+    request->setAttributeHandles(attributeHandleVector);
+    request->setTransportationType(transportationType);
+    send(request);
   }
 
-  void queryAttributeTransportationType(ObjectInstanceHandle, AttributeHandle)
+  void queryAttributeTransportationType(ObjectInstanceHandle objectInstanceHandle, AttributeHandle attributeHandle)
     // throw (AttributeNotDefined,
     //        ObjectInstanceNotKnown,
     //        SaveInProgress,
@@ -1686,10 +1850,22 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Not implemented");
+    Federate::ObjectInstance* objectInstance = _federate->getObjectInstance(objectInstanceHandle);
+    if (!objectInstance)
+      throw ObjectInstanceNotKnown(objectInstanceHandle.toString());
+    if (!objectInstance->getInstanceAttribute(attributeHandle.getHandle()))
+      throw AttributeNotDefined(attributeHandle.toString());
+
+    SharedPtr<QueryAttributeTransportationTypeRequestMessage> request;
+    request = new QueryAttributeTransportationTypeRequestMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setObjectInstanceHandle(objectInstanceHandle);
+    request->setAttributeHandle(attributeHandle);
+    send(request);
   }
 
-  void requestInteractionTransportationTypeChange(InteractionClassHandle, TransportationType)
+  void requestInteractionTransportationTypeChange(InteractionClassHandle interactionClassHandle, TransportationType transportationType)
     // throw (InteractionClassAlreadyBeingChanged,
     //        InteractionClassNotPublished,
     //        InteractionClassNotDefined,
@@ -1704,10 +1880,27 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Not implemented");
+    // Both standard transportation types are always available, even if the fom does not name them
+    if (transportationType != RELIABLE && transportationType != BEST_EFFORT)
+      throw InvalidTransportationType();
+    Federate::InteractionClass* interactionClass = _federate->getInteractionClass(interactionClassHandle);
+    if (!interactionClass)
+      throw InteractionClassNotDefined(interactionClassHandle.toString());
+    if (!interactionClass->isPublished())
+      throw InteractionClassNotPublished(interactionClass->getName());
+
+    interactionClass->setTransportationType(transportationType);
+
+    SharedPtr<ChangeInteractionTransportationTypeRequestMessage> request;
+    request = new ChangeInteractionTransportationTypeRequestMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setInteractionClassHandle(interactionClassHandle);
+    request->setTransportationType(transportationType);
+    send(request);
   }
 
-  void queryInteractionTransportationType(FederateHandle, InteractionClassHandle)
+  void queryInteractionTransportationType(FederateHandle federateHandle, InteractionClassHandle interactionClassHandle)
     // throw (InteractionClassNotDefined,
     //        SaveInProgress,
     //        RestoreInProgress,
@@ -1719,7 +1912,16 @@ public:
       throw NotConnected();
     if (!_federate.valid())
       throw FederateNotExecutionMember();
-    throw RTIinternalError("Not implemented");
+    if (!_federate->getInteractionClass(interactionClassHandle))
+      throw InteractionClassNotDefined(interactionClassHandle.toString());
+
+    SharedPtr<QueryInteractionTransportationTypeRequestMessage> request;
+    request = new QueryInteractionTransportationTypeRequestMessage;
+    request->setFederationHandle(getFederationHandle());
+    request->setFederateHandle(getFederateHandle());
+    request->setQueriedFederateHandle(federateHandle);
+    request->setInteractionClassHandle(interactionClassHandle);
+    send(request);
   }
 
   void unconditionalAttributeOwnershipDivestiture(ObjectInstanceHandle objectInstanceHandle, AttributeHandleVector& attributeHandleVector)
@@ -2057,6 +2259,10 @@ public:
       throw NotConnected();
     if (!_timeManagement.valid())
       throw FederateNotExecutionMember();
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
     if (_timeManagement->isLogicalTimeInThePast(logicalTime))
       throw LogicalTimeAlreadyPassed(_timeManagement->logicalTimeToString(logicalTime));
     if (_timeManagement->getTimeAdvancePending())
@@ -2084,6 +2290,10 @@ public:
       throw NotConnected();
     if (!_timeManagement.valid())
       throw FederateNotExecutionMember();
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
     if (_timeManagement->isLogicalTimeInThePast(logicalTime))
       throw LogicalTimeAlreadyPassed(_timeManagement->logicalTimeToString(logicalTime));
     if (_timeManagement->getTimeAdvancePending())
@@ -2111,6 +2321,10 @@ public:
       throw NotConnected();
     if (!_timeManagement.valid())
       throw FederateNotExecutionMember();
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
     if (_timeManagement->isLogicalTimeInThePast(logicalTime))
       throw LogicalTimeAlreadyPassed(_timeManagement->logicalTimeToString(logicalTime));
     if (_timeManagement->getTimeAdvancePending())
@@ -2138,6 +2352,10 @@ public:
       throw NotConnected();
     if (!_timeManagement.valid())
       throw FederateNotExecutionMember();
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
     if (_timeManagement->isLogicalTimeInThePast(logicalTime))
       throw LogicalTimeAlreadyPassed(_timeManagement->logicalTimeToString(logicalTime));
     if (_timeManagement->getTimeAdvancePending())
@@ -2165,6 +2383,10 @@ public:
       throw NotConnected();
     if (!_timeManagement.valid())
       throw FederateNotExecutionMember();
+    if (_federate->getSaveStatus() != NO_SAVE_IN_PROGRESS)
+      throw SaveInProgress();
+    if (_federate->getRestoreStatus() != NO_RESTORE_IN_PROGRESS)
+      throw RestoreInProgress();
     if (_timeManagement->isLogicalTimeInThePast(logicalTime))
       throw LogicalTimeAlreadyPassed(_timeManagement->logicalTimeToString(logicalTime));
     if (_timeManagement->getTimeAdvancePending())
@@ -2312,8 +2534,8 @@ public:
       throw InvalidMessageRetractionHandle(messageRetractionHandle.toString());
     if (!getTimeManagement()->getTimeRegulationEnabled())
       throw TimeRegulationIsNotEnabled();
-
-    throw RTIinternalError("Message retraction is not implemented!");
+    if (!getTimeManagement()->retract(*this, messageRetractionHandle))
+      throw MessageCanNoLongerBeRetracted(messageRetractionHandle.toString());
   }
 
   void changeAttributeOrderType(ObjectInstanceHandle objectInstanceHandle, const AttributeHandleVector& attributeHandleVector, OrderType orderType)
@@ -3531,6 +3753,79 @@ public:
     _callbacksEnabled = false;
   }
 
+  void enableAttributeCache(ObjectClassHandle objectClassHandle, AttributeHandle attributeHandle, size_t octetSize)
+    // throw (ObjectClassNotDefined,
+    //        AttributeNotDefined,
+    //        FederateNotExecutionMember,
+    //        NotConnected,
+    //        RTIinternalError)
+  {
+    if (!isConnected())
+      throw NotConnected();
+    if (!_federate.valid())
+      throw FederateNotExecutionMember();
+    Federate::ObjectClass* objectClass = _federate->getObjectClass(objectClassHandle);
+    if (!objectClass)
+      throw ObjectClassNotDefined(objectClassHandle.toString());
+    if (!objectClass->getAttribute(attributeHandle))
+      throw AttributeNotDefined(attributeHandle.toString());
+
+    // Instances already known get their row with the next reflection
+    if (!objectClass->getAttributeCache())
+      objectClass->setAttributeCache(new AttributeCache);
+    objectClass->getAttributeCache()->insertColumn(attributeHandle, octetSize);
+  }
+
+  void disableAttributeCache(ObjectClassHandle objectClassHandle)
+    // throw (ObjectClassNotDefined,
+    //        FederateNotExecutionMember,
+    //        NotConnected,
+    //        RTIinternalError)
+  {
+    if (!isConnected())
+      throw NotConnected();
+    if (!_federate.valid())
+      throw FederateNotExecutionMember();
+    Federate::ObjectClass* objectClass = _federate->getObjectClass(objectClassHandle);
+    if (!objectClass)
+      throw ObjectClassNotDefined(objectClassHandle.toString());
+    objectClass->setAttributeCache(SharedPtr<AttributeCache>());
+  }
+
+  const AttributeCache* getAttributeCache(ObjectClassHandle objectClassHandle) const
+    // throw (ObjectClassNotDefined,
+    //        FederateNotExecutionMember,
+    //        NotConnected,
+    //        RTIinternalError)
+  {
+    if (!isConnected())
+      throw NotConnected();
+    if (!_federate.valid())
+      throw FederateNotExecutionMember();
+    const Federate::ObjectClass* objectClass = _federate->getObjectClass(objectClassHandle);
+    if (!objectClass)
+      throw ObjectClassNotDefined(objectClassHandle.toString());
+    return objectClass->getAttributeCache();
+  }
+
+  // Store the values in the attribute cache of the object class if there is one.
+  // Returns the values that still need a reflect callback, zero if there are none left.
+  const AttributeValueVector* _cacheAttributeValues(const Federate::ObjectClass& objectClass, const ObjectInstanceHandle& objectInstanceHandle,
+                                                    const AttributeValueVector& attributeValueVector, AttributeValueVector& uncachedAttributeValueVector)
+  {
+    AttributeCache* attributeCache = objectClass.getAttributeCache();
+    if (!attributeCache)
+      return &attributeValueVector;
+    if (!attributeCache->reflectAttributeValues(objectInstanceHandle, attributeValueVector))
+      return 0;
+    for (AttributeValueVector::const_iterator i = attributeValueVector.begin(); i != attributeValueVector.end(); ++i) {
+      if (attributeCache->isValueCached(*i))
+        continue;
+      uncachedAttributeValueVector.push_back(*i);
+    }
+    return &uncachedAttributeValueVector;
+  }
+
   void _requestObjectInstanceHandles(unsigned count)
   {
     SharedPtr<ObjectInstanceHandlesRequestMessage> request;
@@ -3564,6 +3859,12 @@ public:
 
   void _releaseObjectInstance(const ObjectInstanceHandle& objectInstanceHandle)
   {
+    if (Federate::ObjectInstance* objectInstance = _federate->getObjectInstance(objectInstanceHandle)) {
+      Federate::ObjectClass* objectClass = _federate->getObjectClass(objectInstance->getObjectClassHandle());
+      if (objectClass && objectClass->getAttributeCache())
+        objectClass->getAttributeCache()->eraseRow(objectInstanceHandle);
+    }
+
     // Remove the instance from the object model
     _federate->eraseObjectInstance(objectInstanceHandle);
 
@@ -3640,6 +3941,91 @@ public:
     federationSynchronized(message.getLabel(), message.getFederateHandleBoolPairVector());
     _federate->eraseAnnouncedFederationSynchonizationLabel(message.getLabel());
   }
+  void acceptCallbackMessage(const InitiateFederateSaveMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    _federate->setSaveStatus(FEDERATE_INSTRUCTED_TO_SAVE);
+    _federate->setSaveLabel(message.getLabel());
+    if (message.getTimeStampValid() && _timeManagement.valid())
+      _timeManagement->acceptCallbackMessage(*this, message);
+    else
+      initiateFederateSave(message.getLabel());
+  }
+  void acceptCallbackMessage(const FederationSavedMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    _federate->setSaveStatus(NO_SAVE_IN_PROGRESS);
+    _federate->setSaveLabel(std::string());
+    if (message.getSuccessful())
+      federationSaved();
+    else
+      federationNotSaved(message.getSaveFailureReason());
+  }
+  void acceptCallbackMessage(const QueryFederationSaveStatusResponseMessage& message)
+  { federationSaveStatusResponse(message.getFederateHandleSaveStatusPairVector()); }
+  void acceptCallbackMessage(const ChangeAttributeTransportationTypeResponseMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    confirmAttributeTransportationTypeChange(message.getObjectInstanceHandle(), message.getAttributeHandles(), message.getTransportationType());
+  }
+  void acceptCallbackMessage(const ChangeInteractionTransportationTypeResponseMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    confirmInteractionTransportationTypeChange(message.getInteractionClassHandle(), message.getTransportationType());
+  }
+  void acceptCallbackMessage(const QueryAttributeTransportationTypeResponseMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    reportAttributeTransportationType(message.getObjectInstanceHandle(), message.getAttributeHandle(), message.getTransportationType());
+  }
+  void acceptCallbackMessage(const QueryInteractionTransportationTypeResponseMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    reportInteractionTransportationType(message.getQueriedFederateHandle(), message.getInteractionClassHandle(), message.getTransportationType());
+  }
+  void acceptCallbackMessage(const RequestFederationRestoreResponseMessage& message)
+  {
+    if (message.getSuccessful())
+      requestFederationRestoreSucceeded(message.getLabel());
+    else
+      requestFederationRestoreFailed(message.getLabel());
+  }
+  void acceptCallbackMessage(const FederationRestoreBegunMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    _federate->setRestoreStatus(FEDERATE_PREPARED_TO_RESTORE);
+    _federate->setRestoreLabel(message.getLabel());
+    federationRestoreBegun();
+  }
+  void acceptCallbackMessage(const InitiateFederateRestoreMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    _federate->setRestoreStatus(FEDERATE_RESTORING);
+    _federate->setRestoreLabel(message.getLabel());
+    initiateFederateRestore(message.getLabel(), message.getFederateName(), message.getFederateHandle());
+  }
+  void acceptCallbackMessage(const FederationRestoredMessage& message)
+  {
+    if (!_federate.valid())
+      return;
+    _federate->setRestoreStatus(NO_RESTORE_IN_PROGRESS);
+    _federate->setRestoreLabel(std::string());
+    _federate->setRestoreStateValid(false);
+    if (message.getSuccessful())
+      federationRestored();
+    else
+      federationNotRestored(message.getRestoreFailureReason());
+  }
+  void acceptCallbackMessage(const QueryFederationRestoreStatusResponseMessage& message)
+  { federationRestoreStatusResponse(message.getFederateHandleRestoreStatusPairVector()); }
   void acceptCallbackMessage(const RegistrationForObjectClassMessage& message)
   { registrationForObjectClass(message.getObjectClassHandle(), message.getStart()); }
   void acceptCallbackMessage(const AttributesInScopeMessage& message)
@@ -3706,6 +4092,8 @@ public:
     if (_federate->getObjectInstance(message.getObjectInstanceHandle()))
       return;
     _federate->insertObjectInstance(message.getObjectInstanceHandle(), message.getName(), objectClassHandle, false);
+    if (AttributeCache* attributeCache = objectClass->getAttributeCache())
+      attributeCache->insertRow(message.getObjectInstanceHandle());
     discoverObjectInstance(message.getObjectInstanceHandle(), objectClassHandle, message.getName());
   }
   void acceptCallbackMessage(const DeleteObjectInstanceMessage& message)
@@ -3754,7 +4142,12 @@ public:
     Federate::ObjectClass* objectClass = _federate->getObjectClass(objectInstance->getObjectClassHandle());
     if (!objectClass)
       return;
-    reflectAttributeValues(*objectClass, message.getObjectInstanceHandle(), message.getAttributeValues(), message.getTag(),
+    AttributeValueVector uncachedAttributeValueVector;
+    const AttributeValueVector* attributeValueVector;
+    attributeValueVector = _cacheAttributeValues(*objectClass, objectInstanceHandle, message.getAttributeValues(), uncachedAttributeValueVector);
+    if (!attributeValueVector)
+      return;
+    reflectAttributeValues(*objectClass, message.getObjectInstanceHandle(), *attributeValueVector, message.getTag(),
                            OpenRTI::RECEIVE, message.getTransportationType(), message.getFederateHandle());
   }
   void acceptCallbackMessage(const TimeStampedAttributeUpdateMessage& message)
@@ -3833,6 +4226,8 @@ public:
       return;
     _timeManagement->acceptCallbackMessage(*this, message);
   }
+  void acceptCallbackMessage(const MessageRetractionMessage& message)
+  { requestRetraction(message.getMessageRetractionHandle()); }
   void acceptCallbackMessage(const RequestAttributeUpdateMessage& message)
   {
     if (!_federate.valid())
@@ -3872,6 +4267,31 @@ public:
   virtual void federationSynchronized(const std::string& label, const FederateHandleBoolPairVector& federateHandleBoolPairVector)
     OpenRTI_NOEXCEPT = 0;
 
+  virtual void initiateFederateSave(const std::string& label)
+    OpenRTI_NOEXCEPT = 0;
+  virtual void initiateFederateSave(const std::string& label, const NativeLogicalTime& logicalTime)
+    OpenRTI_NOEXCEPT = 0;
+  virtual void federationSaved()
+    OpenRTI_NOEXCEPT = 0;
+  virtual void federationNotSaved(SaveFailureReason reason)
+    OpenRTI_NOEXCEPT = 0;
+  virtual void federationSaveStatusResponse(const FederateHandleSaveStatusPairVector& federateHandleSaveStatusPairVector)
+    OpenRTI_NOEXCEPT = 0;
+  virtual void requestFederationRestoreSucceeded(const std::string& label)
+    OpenRTI_NOEXCEPT = 0;
+  virtual void requestFederationRestoreFailed(const std::string& label)
+    OpenRTI_NOEXCEPT = 0;
+  virtual void federationRestoreBegun()
+    OpenRTI_NOEXCEPT = 0;
+  virtual void initiateFederateRestore(const std::string& label, const std::string& federateName, const FederateHandle& federateHandle)
+    OpenRTI_NOEXCEPT = 0;
+  virtual void federationRestored()
+    OpenRTI_NOEXCEPT = 0;
+  virtual void federationNotRestored(RestoreFailureReason reason)
+    OpenRTI_NOEXCEPT = 0;
+  virtual void federationRestoreStatusResponse(const FederateHandleRestoreStatusPairVector& federateHandleRestoreStatusPairVector)
+    OpenRTI_NOEXCEPT = 0;
+
   virtual void registrationForObjectClass(ObjectClassHandle objectClassHandle, bool start)
     OpenRTI_NOEXCEPT = 0;
 
@@ -3971,6 +4391,23 @@ public:
   virtual void attributeIsOwnedByRTI(ObjectInstanceHandle objectInstanceHandle, AttributeHandle attributeHandle)
     OpenRTI_NOEXCEPT = 0;
 
+  // Only the rti1516e api can request these
+  virtual void confirmAttributeTransportationTypeChange(ObjectInstanceHandle objectInstanceHandle, const AttributeHandleVector& attributeHandleVector,
+                                                        TransportationType transportationType)
+    OpenRTI_NOEXCEPT
+  { }
+  virtual void reportAttributeTransportationType(ObjectInstanceHandle objectInstanceHandle, AttributeHandle attributeHandle,
+                                                 TransportationType transportationType)
+    OpenRTI_NOEXCEPT
+  { }
+  virtual void confirmInteractionTransportationTypeChange(InteractionClassHandle interactionClassHandle, TransportationType transportationType)
+    OpenRTI_NOEXCEPT
+  { }
+  virtual void reportInteractionTransportationType(FederateHandle federateHandle, InteractionClassHandle interactionClassHandle,
+                                                   TransportationType transportationType)
+    OpenRTI_NOEXCEPT
+  { }
+
   virtual void timeRegulationEnabled(const NativeLogicalTime& logicalTime)
     OpenRTI_NOEXCEPT = 0;
   virtual void timeConstrainedEnabled(const NativeLogicalTime& logicalTime)
@@ -4004,6 +4441,12 @@ public:
       _federate->setPermitTimeRegulation(false);
 
     _timeManagement = createTimeManagement(*_federate);
+    _timeManagement->setTimeStampOrderQueueType(getTimeStampOrderQueueType());
+    _timeManagement->setCommitCoalescing(getCommitCoalescing());
+    // the root server may route all commits through itself
+    i = message.getConfigurationParameterMap().find("timeAdvanceBarrier");
+    if (i != message.getConfigurationParameterMap().end() && !i->second.empty() && i->second.front() == "true")
+      _timeManagement->setTimeAdvanceBarrier(true);
   }
 
  private:
@@ -0,0 +1,183 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "AttributeCache.h"
+
+#include <cstring>
+
+namespace OpenRTI {
+
+AttributeCache::AttributeCache() :
+  _serial(0)
+{
+}
+
+AttributeCache::~AttributeCache()
+{
+}
+
+void
+AttributeCache::insertColumn(const AttributeHandle& attributeHandle, size_t octetSize)
+{
+  OpenRTIAssert(attributeHandle.valid());
+  if (_columnVector.size() <= attributeHandle.getHandle())
+    _columnVector.resize(attributeHandle.getHandle() + 1);
+  Column& column = _columnVector[attributeHandle.getHandle()];
+  if (column._cached && column._octetSize == octetSize)
+    return;
+  // A changed octet size drops the values cached so far
+  column._cached = true;
+  column._octetSize = octetSize;
+  column._data.clear();
+  column._variableData.clear();
+  column._serials.clear();
+  _resizeColumn(column, _objectInstanceHandleVector.size());
+}
+
+bool
+AttributeCache::getRow(const ObjectInstanceHandle& objectInstanceHandle, size_t& row) const
+{
+  ObjectInstanceHandleRowMap::const_iterator i = _objectInstanceHandleRowMap.find(objectInstanceHandle);
+  if (i == _objectInstanceHandleRowMap.end())
+    return false;
+  row = i->second;
+  return true;
+}
+
+size_t
+AttributeCache::getColumnOctetSize(const AttributeHandle& attributeHandle) const
+{
+  const Column* column = _getColumn(attributeHandle);
+  if (!column)
+    return 0;
+  return column->_octetSize;
+}
+
+const void*
+AttributeCache::getColumnData(const AttributeHandle& attributeHandle) const
+{
+  const Column* column = _getColumn(attributeHandle);
+  if (!column || column->_data.empty())
+    return 0;
+  return &column->_data.front();
+}
+
+const VariableLengthData*
+AttributeCache::getVariableColumnData(const AttributeHandle& attributeHandle) const
+{
+  const Column* column = _getColumn(attributeHandle);
+  if (!column || column->_variableData.empty())
+    return 0;
+  return &column->_variableData.front();
+}
+
+const uint64_t*
+AttributeCache::getColumnSerials(const AttributeHandle& attributeHandle) const
+{
+  const Column* column = _getColumn(attributeHandle);
+  if (!column || column->_serials.empty())
+    return 0;
+  return &column->_serials.front();
+}
+
+size_t
+AttributeCache::insertRow(const ObjectInstanceHandle& objectInstanceHandle)
+{
+  size_t row = _objectInstanceHandleVector.size();
+  std::pair<ObjectInstanceHandleRowMap::iterator, bool> inserted;
+  inserted = _objectInstanceHandleRowMap.insert(ObjectInstanceHandleRowMap::value_type(objectInstanceHandle, row));
+  if (!inserted.second)
+    return inserted.first->second;
+  _objectInstanceHandleVector.push_back(objectInstanceHandle);
+  for (ColumnVector::iterator i = _columnVector.begin(); i != _columnVector.end(); ++i) {
+    if (!i->_cached)
+      continue;
+    _resizeColumn(*i, row + 1);
+  }
+  return row;
+}
+
+void
+AttributeCache::eraseRow(const ObjectInstanceHandle& objectInstanceHandle)
+{
+  ObjectInstanceHandleRowMap::iterator i = _objectInstanceHandleRowMap.find(objectInstanceHandle);
+  if (i == _objectInstanceHandleRowMap.end())
+    return;
+  size_t row = i->second;
+  _objectInstanceHandleRowMap.erase(i);
+
+  // Keep the rows dense, move the last row into the erased one
+  size_t last = _objectInstanceHandleVector.size() - 1;
+  if (row != last) {
+    _objectInstanceHandleVector[row] = _objectInstanceHandleVector[last];
+    _objectInstanceHandleRowMap[_objectInstanceHandleVector[row]] = row;
+    for (ColumnVector::iterator j = _columnVector.begin(); j != _columnVector.end(); ++j) {
+      if (!j->_cached)
+        continue;
+      if (j->_octetSize)
+        std::memcpy(&j->_data[row*j->_octetSize], &j->_data[last*j->_octetSize], j->_octetSize);
+      else
+        j->_variableData[row].swap(j->_variableData[last]);
+      j->_serials[row] = j->_serials[last];
+    }
+  }
+  _objectInstanceHandleVector.pop_back();
+  for (ColumnVector::iterator j = _columnVector.begin(); j != _columnVector.end(); ++j) {
+    if (!j->_cached)
+      continue;
+    _resizeColumn(*j, last);
+  }
+}
+
+bool
+AttributeCache::reflectAttributeValues(const ObjectInstanceHandle& objectInstanceHandle, const AttributeValueVector& attributeValueVector)
+{
+  size_t row = insertRow(objectInstanceHandle);
+  uint64_t serial = ++_serial;
+  bool uncached = false;
+  for (AttributeValueVector::const_iterator i = attributeValueVector.begin(); i != attributeValueVector.end(); ++i) {
+    // Values that do not fit are left to the reflect callback
+    if (!isValueCached(*i)) {
+      uncached = true;
+      continue;
+    }
+    Column& column = _columnVector[i->getAttributeHandle().getHandle()];
+    const VariableLengthData& value = i->getValue();
+    if (column._octetSize) {
+      std::memcpy(&column._data[row*column._octetSize], value.constData(), column._octetSize);
+    } else {
+      // Just references the received data
+      column._variableData[row] = value;
+    }
+    column._serials[row] = serial;
+  }
+  return uncached;
+}
+
+void
+AttributeCache::_resizeColumn(Column& column, size_t numRows)
+{
+  if (column._octetSize)
+    column._data.resize(numRows*column._octetSize, 0);
+  else
+    column._variableData.resize(numRows);
+  column._serials.resize(numRows, 0);
+}
+
+} // namespace OpenRTI
@@ -0,0 +1,135 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_AttributeCache_h
+#define OpenRTI_AttributeCache_h
+
+#include <map>
+#include <vector>
+#include "Export.h"
+#include "Handle.h"
+#include "Message.h"
+#include "Referenced.h"
+#include "Types.h"
+#include "VariableLengthData.h"
+
+namespace OpenRTI {
+
+/// Receive side cache of the reflected attribute values of the instances of one object class.
+/// The values are stored column wise, one contiguous column per cached attribute
+/// and one row per object instance. So the state of all instances can be processed
+/// in one sweep after evoking the callbacks instead of within each reflect callback.
+/// Rows are kept dense, erasing an instance moves the last row into its place.
+/// Columns with a fixed octet size hold the raw encoded values back to back,
+/// values of an other size are passed on to the reflect callback instead.
+/// Columns of octet size zero keep a VariableLengthData per row.
+/// Each column records per row the serial of the reflection that last wrote
+/// that value. Rows written since a previous look have a serial above the
+/// getSerial() value seen back then.
+class OPENRTI_API AttributeCache : public Referenced {
+public:
+  AttributeCache();
+  ~AttributeCache();
+
+  /// Cache the values of this attribute
+  void insertColumn(const AttributeHandle& attributeHandle, size_t octetSize);
+  bool isColumnCached(const AttributeHandle& attributeHandle) const
+  { return 0 != _getColumn(attributeHandle); }
+  /// Returns true if reflectAttributeValues stores this value.
+  /// Values of a fixed size column that do not match the octet size are not stored.
+  bool isValueCached(const AttributeValue& attributeValue) const
+  {
+    const Column* column = _getColumn(attributeValue.getAttributeHandle());
+    if (!column)
+      return false;
+    return !column->_octetSize || column->_octetSize == attributeValue.getValue().size();
+  }
+
+  /// The number of object instances in the cache
+  size_t getNumRows() const
+  { return _objectInstanceHandleVector.size(); }
+  /// The object instance handle of each row
+  const ObjectInstanceHandle* getObjectInstanceHandles() const
+  { return _objectInstanceHandleVector.empty() ? 0 : &_objectInstanceHandleVector.front(); }
+  /// Get the row of the object instance, returns false if the instance is not cached
+  bool getRow(const ObjectInstanceHandle& objectInstanceHandle, size_t& row) const;
+
+  /// The serial of the last reflection stored in this cache
+  uint64_t getSerial() const
+  { return _serial; }
+
+  /// The octet size of the rows in this column, zero for variable size columns
+  size_t getColumnOctetSize(const AttributeHandle& attributeHandle) const;
+  /// The getNumRows()*getColumnOctetSize() octets of a fixed size column,
+  /// zero if there are no rows or if the attribute is not cached in a fixed size column
+  const void* getColumnData(const AttributeHandle& attributeHandle) const;
+  /// The getNumRows() values of a variable size column, zero if not available
+  const VariableLengthData* getVariableColumnData(const AttributeHandle& attributeHandle) const;
+  /// The getNumRows() serials of the reflections that last wrote the values in this column,
+  /// zero if never written.
+  const uint64_t* getColumnSerials(const AttributeHandle& attributeHandle) const;
+
+  /// Insert a row for the object instance, returns the row
+  size_t insertRow(const ObjectInstanceHandle& objectInstanceHandle);
+  /// Erase the row of the object instance if there is one
+  void eraseRow(const ObjectInstanceHandle& objectInstanceHandle);
+
+  /// Store the values of the cached attributes in the row of the object instance.
+  /// Inserts the row if not already there.
+  /// Returns true if there are values that are not cached, see isValueCached.
+  bool reflectAttributeValues(const ObjectInstanceHandle& objectInstanceHandle, const AttributeValueVector& attributeValueVector);
+
+private:
+  AttributeCache(const AttributeCache&);
+  AttributeCache& operator=(const AttributeCache&);
+
+  struct Column {
+    Column() : _cached(false), _octetSize(0) { }
+    bool _cached;
+    size_t _octetSize;
+    std::vector<uint8_t> _data;
+    std::vector<VariableLengthData> _variableData;
+    std::vector<uint64_t> _serials;
+  };
+  typedef std::vector<Column> ColumnVector;
+
+  const Column* _getColumn(const AttributeHandle& attributeHandle) const
+  {
+    if (!attributeHandle.valid() || _columnVector.size() <= attributeHandle.getHandle())
+      return 0;
+    const Column& column = _columnVector[attributeHandle.getHandle()];
+    if (!column._cached)
+      return 0;
+    return &column;
+  }
+  void _resizeColumn(Column& column, size_t numRows);
+
+  // The columns indexed by the attribute handle
+  ColumnVector _columnVector;
+
+  std::vector<ObjectInstanceHandle> _objectInstanceHandleVector;
+  typedef std::map<ObjectInstanceHandle, size_t> ObjectInstanceHandleRowMap;
+  ObjectInstanceHandleRowMap _objectInstanceHandleRowMap;
+
+  uint64_t _serial;
+};
+
+} // namespace OpenRTI
+
+#endif
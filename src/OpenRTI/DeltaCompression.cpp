@@ -0,0 +1,267 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "DeltaCompression.h"
+
+#include <cstring>
+#include "DecodeDataStream.h"
+#include "EncodeDataStream.h"
+#include "Exception.h"
+
+namespace OpenRTI {
+
+/// The decoder drops its state before decoding this update
+enum { DeltaResetFlag = 1 };
+
+/// How an attribute value is sent
+enum {
+  LiteralValue = 0,
+  UnchangedValue = 1,
+  DeltaValue = 2
+};
+
+/// Bounds of the state kept per connect
+enum { MaxObjectInstances = 16*1024 };
+enum { MaxDictionarySize = 1024 };
+
+/// Changed byte ranges closer than that are sent as a single range
+enum { MinDeltaGap = 4 };
+
+DeltaCompressionEncoder::DeltaCompressionEncoder() :
+  _reset(false)
+{
+}
+
+DeltaCompressionEncoder::~DeltaCompressionEncoder()
+{
+}
+
+void
+DeltaCompressionEncoder::encode(EncodeDataStream& encodeStream, const AttributeUpdateMessage& message)
+{
+  ObjectInstanceHandleValueMap::iterator i = _objectInstanceHandleValueMap.find(message.getObjectInstanceHandle());
+  if (i == _objectInstanceHandleValueMap.end()) {
+    if (MaxObjectInstances <= _objectInstanceHandleValueMap.size())
+      reset();
+    i = _objectInstanceHandleValueMap.insert(ObjectInstanceHandleValueMap::value_type(message.getObjectInstanceHandle(), AttributeHandleValueMap())).first;
+  }
+
+  encodeStream.writeUInt8BE(_reset ? DeltaResetFlag : 0);
+  _reset = false;
+  encodeStream.writeUInt16Compressed(message.getFederationHandle());
+  encodeStream.writeUInt32Compressed(message.getFederateHandle());
+  encodeStream.writeUInt32Compressed(message.getObjectInstanceHandle());
+  encodeStream.writeUInt8BE(message.getTransportationType() == RELIABLE ? 0 : 1);
+
+  // Tags are either a dictionary index + 1, or 0 followed by the tag
+  TagIndexMap::const_iterator j = _tagIndexMap.find(message.getTag());
+  if (j != _tagIndexMap.end()) {
+    encodeStream.writeUInt32Compressed(j->second + 1);
+  } else {
+    encodeStream.writeUInt32Compressed(0);
+    encodeStream.writeSizeTCompressed(message.getTag().size());
+    encodeStream.writeData(message.getTag());
+    if (_tagIndexMap.size() < MaxDictionarySize)
+      _tagIndexMap.insert(TagIndexMap::value_type(message.getTag(), unsigned(_tagIndexMap.size())));
+  }
+
+  // Same for the set of attribute handles in this update
+  const AttributeValueVector& attributeValues = message.getAttributeValues();
+  _attributeHandleVector.resize(0);
+  for (AttributeValueVector::const_iterator k = attributeValues.begin(); k != attributeValues.end(); ++k)
+    _attributeHandleVector.push_back(k->getAttributeHandle());
+  AttributeHandleVectorIndexMap::const_iterator l = _attributeHandleVectorIndexMap.find(_attributeHandleVector);
+  if (l != _attributeHandleVectorIndexMap.end()) {
+    encodeStream.writeUInt32Compressed(l->second + 1);
+  } else {
+    encodeStream.writeUInt32Compressed(0);
+    encodeStream.writeSizeTCompressed(_attributeHandleVector.size());
+    for (AttributeHandleVector::const_iterator k = _attributeHandleVector.begin(); k != _attributeHandleVector.end(); ++k)
+      encodeStream.writeUInt32Compressed(*k);
+    if (_attributeHandleVectorIndexMap.size() < MaxDictionarySize)
+      _attributeHandleVectorIndexMap.insert(AttributeHandleVectorIndexMap::value_type(_attributeHandleVector, unsigned(_attributeHandleVectorIndexMap.size())));
+  }
+
+  for (AttributeValueVector::const_iterator k = attributeValues.begin(); k != attributeValues.end(); ++k)
+    encodeValue(encodeStream, i->second[k->getAttributeHandle()], k->getValue());
+}
+
+void
+DeltaCompressionEncoder::reset()
+{
+  _objectInstanceHandleValueMap.clear();
+  _tagIndexMap.clear();
+  _attributeHandleVectorIndexMap.clear();
+  _reset = true;
+}
+
+void
+DeltaCompressionEncoder::encodeValue(EncodeDataStream& encodeStream, VariableLengthData& lastValue, const VariableLengthData& value)
+{
+  size_t size = value.size();
+  if (size && lastValue.size() == size) {
+    const char* lastData = static_cast<const char*>(lastValue.constData());
+    const char* data = value.charData();
+
+    // Collect the changed byte ranges as skip, length and the new bytes
+    _delta.resize(0);
+    EncodeDataStream deltaStream(_delta);
+    size_t offset = 0;
+    size_t numRanges = 0;
+    for (;;) {
+      size_t begin = offset;
+      while (begin < size && lastData[begin] == data[begin])
+        ++begin;
+      if (begin == size)
+        break;
+      size_t end = begin + 1;
+      for (size_t equal = 0; end < size && equal < MinDeltaGap; ++end) {
+        if (lastData[end] == data[end])
+          ++equal;
+        else
+          equal = 0;
+      }
+      while (lastData[end - 1] == data[end - 1])
+        --end;
+      deltaStream.writeSizeTCompressed(begin - offset);
+      deltaStream.writeSizeTCompressed(end - begin);
+      deltaStream.writeData(data + begin, end - begin);
+      offset = end;
+      ++numRanges;
+    }
+
+    if (!numRanges) {
+      encodeStream.writeUInt8BE(UnchangedValue);
+      lastValue = value;
+      return;
+    }
+    if (_delta.size() < size) {
+      encodeStream.writeUInt8BE(DeltaValue);
+      encodeStream.writeSizeTCompressed(numRanges);
+      encodeStream.writeData(_delta);
+      lastValue = value;
+      return;
+    }
+  }
+
+  encodeStream.writeUInt8BE(LiteralValue);
+  encodeStream.writeSizeTCompressed(size);
+  encodeStream.writeData(value);
+  lastValue = value;
+}
+
+DeltaCompressionDecoder::DeltaCompressionDecoder()
+{
+}
+
+DeltaCompressionDecoder::~DeltaCompressionDecoder()
+{
+}
+
+SharedPtr<AttributeUpdateMessage>
+DeltaCompressionDecoder::decode(DecodeDataStream& decodeStream)
+{
+  SharedPtr<AttributeUpdateMessage> message = new AttributeUpdateMessage;
+
+  if (decodeStream.readUInt8BE() & DeltaResetFlag) {
+    _objectInstanceHandleValueMap.clear();
+    _tagVector.clear();
+    _attributeHandleVectorVector.clear();
+  }
+  message->setFederationHandle(decodeStream.readUInt16Compressed());
+  message->setFederateHandle(decodeStream.readUInt32Compressed());
+  message->setObjectInstanceHandle(decodeStream.readUInt32Compressed());
+  message->setTransportationType(decodeStream.readUInt8BE() == 0 ? RELIABLE : BEST_EFFORT);
+
+  uint32_t index = decodeStream.readUInt32Compressed();
+  if (index) {
+    if (_tagVector.size() < index)
+      throw MessageError("Unknown tag in delta compressed attribute update!");
+    message->setTag(_tagVector[index - 1]);
+  } else {
+    size_t size = decodeStream.readSizeTCompressed();
+    message->getTag().resize(size);
+    decodeStream.readData(message->getTag().data(), size);
+    if (_tagVector.size() < MaxDictionarySize)
+      _tagVector.push_back(message->getTag());
+  }
+
+  const AttributeHandleVector* attributeHandleVector;
+  index = decodeStream.readUInt32Compressed();
+  if (index) {
+    if (_attributeHandleVectorVector.size() < index)
+      throw MessageError("Unknown attribute handles in delta compressed attribute update!");
+    attributeHandleVector = &_attributeHandleVectorVector[index - 1];
+  } else {
+    _attributeHandleVector.resize(decodeStream.readSizeTCompressed());
+    for (AttributeHandleVector::iterator i = _attributeHandleVector.begin(); i != _attributeHandleVector.end(); ++i)
+      *i = decodeStream.readUInt32Compressed();
+    attributeHandleVector = &_attributeHandleVector;
+    if (_attributeHandleVectorVector.size() < MaxDictionarySize) {
+      _attributeHandleVectorVector.push_back(_attributeHandleVector);
+      attributeHandleVector = &_attributeHandleVectorVector.back();
+    }
+  }
+
+  AttributeHandleValueMap& attributeHandleValueMap = _objectInstanceHandleValueMap[message->getObjectInstanceHandle()];
+  AttributeValueVector& attributeValues = message->getAttributeValues();
+  attributeValues.resize(attributeHandleVector->size());
+  for (size_t i = 0; i < attributeValues.size(); ++i) {
+    attributeValues[i].setAttributeHandle((*attributeHandleVector)[i]);
+    decodeValue(decodeStream, attributeHandleValueMap[(*attributeHandleVector)[i]], attributeValues[i].getValue());
+  }
+
+  return message;
+}
+
+void
+DeltaCompressionDecoder::decodeValue(DecodeDataStream& decodeStream, VariableLengthData& lastValue, VariableLengthData& value)
+{
+  switch (decodeStream.readUInt8BE()) {
+  case LiteralValue:
+    {
+      size_t size = decodeStream.readSizeTCompressed();
+      value.resize(size);
+      decodeStream.readData(value.data(), size);
+    }
+    break;
+  case UnchangedValue:
+    value = lastValue;
+    break;
+  case DeltaValue:
+    {
+      value = lastValue;
+      size_t offset = 0;
+      for (size_t numRanges = decodeStream.readSizeTCompressed(); numRanges; --numRanges) {
+        offset += decodeStream.readSizeTCompressed();
+        size_t size = decodeStream.readSizeTCompressed();
+        if (!size || value.size() < offset || value.size() - offset < size)
+          throw MessageError("Delta exceeds the attribute value in delta compressed attribute update!");
+        decodeStream.readData(value.data(offset), size);
+        offset += size;
+      }
+    }
+    break;
+  default:
+    throw MessageError("Unknown value encoding in delta compressed attribute update!");
+  }
+  lastValue = value;
+}
+
+} // namespace OpenRTI
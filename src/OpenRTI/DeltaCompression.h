@@ -0,0 +1,106 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_DeltaCompression_h
+#define OpenRTI_DeltaCompression_h
+
+#include <map>
+#include <vector>
+#include "Export.h"
+#include "Message.h"
+#include "Referenced.h"
+#include "SharedPtr.h"
+
+namespace OpenRTI {
+
+class DecodeDataStream;
+class EncodeDataStream;
+
+/// Semantic compression of attribute updates on a single connect.
+/// Successive updates of an object instance tend to change only a few bytes
+/// of the attribute values while the handles and the tag repeat. So attribute
+/// values are sent as the byte ranges that changed since the last value sent
+/// for the same attribute on this connect. Tags and the attribute handle sets
+/// of the updates are collected into dictionaries and are referenced by their
+/// index once sent.
+/// Both ends of a connect keep the same state by applying the same updates
+/// in the same order. The encoder bounds the state. Once the bound is reached
+/// it drops everything and flags the next update to make the decoder do the same.
+class OPENRTI_API DeltaCompressionEncoder : public Referenced {
+public:
+  DeltaCompressionEncoder();
+  ~DeltaCompressionEncoder();
+
+  /// Write the update following the opcode of a delta packet
+  void encode(EncodeDataStream& encodeStream, const AttributeUpdateMessage& message);
+
+  /// Forget the state sent so far, the next update resynchronizes the peer
+  void reset();
+
+private:
+  DeltaCompressionEncoder(const DeltaCompressionEncoder&);
+  DeltaCompressionEncoder& operator=(const DeltaCompressionEncoder&);
+
+  void encodeValue(EncodeDataStream& encodeStream, VariableLengthData& lastValue, const VariableLengthData& value);
+
+  typedef std::map<AttributeHandle, VariableLengthData> AttributeHandleValueMap;
+  typedef std::map<ObjectInstanceHandle, AttributeHandleValueMap> ObjectInstanceHandleValueMap;
+  ObjectInstanceHandleValueMap _objectInstanceHandleValueMap;
+
+  typedef std::map<VariableLengthData, unsigned> TagIndexMap;
+  TagIndexMap _tagIndexMap;
+  typedef std::map<AttributeHandleVector, unsigned> AttributeHandleVectorIndexMap;
+  AttributeHandleVectorIndexMap _attributeHandleVectorIndexMap;
+
+  // Tells the decoder to drop its state with the next update
+  bool _reset;
+
+  // Scratch space reused for every update
+  AttributeHandleVector _attributeHandleVector;
+  VariableLengthData _delta;
+};
+
+class OPENRTI_API DeltaCompressionDecoder : public Referenced {
+public:
+  DeltaCompressionDecoder();
+  ~DeltaCompressionDecoder();
+
+  /// Read the update following the opcode of a delta packet
+  SharedPtr<AttributeUpdateMessage> decode(DecodeDataStream& decodeStream);
+
+private:
+  DeltaCompressionDecoder(const DeltaCompressionDecoder&);
+  DeltaCompressionDecoder& operator=(const DeltaCompressionDecoder&);
+
+  void decodeValue(DecodeDataStream& decodeStream, VariableLengthData& lastValue, VariableLengthData& value);
+
+  typedef std::map<AttributeHandle, VariableLengthData> AttributeHandleValueMap;
+  typedef std::map<ObjectInstanceHandle, AttributeHandleValueMap> ObjectInstanceHandleValueMap;
+  ObjectInstanceHandleValueMap _objectInstanceHandleValueMap;
+
+  std::vector<VariableLengthData> _tagVector;
+  std::vector<AttributeHandleVector> _attributeHandleVectorVector;
+
+  // Scratch space for handle sets not fitting into the dictionary
+  AttributeHandleVector _attributeHandleVector;
+};
+
+} // namespace OpenRTI
+
+#endif
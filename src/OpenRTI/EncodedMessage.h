@@ -0,0 +1,62 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_EncodedMessage_h
+#define OpenRTI_EncodedMessage_h
+
+#include <cstring>
+#include "Export.h"
+#include "Referenced.h"
+#include "VariableLengthData.h"
+
+namespace OpenRTI {
+
+/// The wire format of a message in one encoding.
+/// A message that is sent to several connects is encoded only once, all the
+/// connects using the same encoding write the same reference counted buffers.
+class OPENRTI_API EncodedMessage : public Referenced {
+public:
+  EncodedMessage(const char* encodingName, unsigned opcode) :
+    _encodingName(encodingName),
+    _opcode(opcode)
+  { }
+
+  bool isEncoding(const char* encodingName) const
+  { return std::strcmp(_encodingName, encodingName) == 0; }
+  unsigned getOpcode() const
+  { return _opcode; }
+
+  /// The header, body and payload buffers of the packet
+  VariableLengthDataList& getBufferList()
+  { return _bufferList; }
+  const VariableLengthDataList& getBufferList() const
+  { return _bufferList; }
+
+private:
+  EncodedMessage(const EncodedMessage&);
+  EncodedMessage& operator=(const EncodedMessage&);
+
+  const char* _encodingName;
+  unsigned _opcode;
+  VariableLengthDataList _bufferList;
+};
+
+} // namespace OpenRTI
+
+#endif
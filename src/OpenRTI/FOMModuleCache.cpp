@@ -0,0 +1,256 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "FOMModuleCache.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "FDD1516EFileReader.h"
+#include "FDD1516FileReader.h"
+#include "FEDFileReader.h"
+#include "Message.h"
+#include "Mutex.h"
+#include "ScopeLock.h"
+#include "TightBE1MessageEncoding.h"
+
+namespace OpenRTI {
+
+struct OPENRTI_LOCAL FOMModuleCacheEntry {
+  FOMModuleCacheEntry() : _modificationTime(0), _size(0) { }
+  int64_t _modificationTime;
+  int64_t _size;
+  FOMStringModuleList _moduleList;
+};
+
+struct OPENRTI_LOCAL FOMModuleCacheMap {
+  // Intentionally leaked, may still be used during static destruction
+  static FOMModuleCacheMap& instance()
+  {
+    static FOMModuleCacheMap* fomModuleCacheMap = new FOMModuleCacheMap;
+    return *fomModuleCacheMap;
+  }
+
+  typedef std::pair<std::string, std::pair<int, std::string> > Key;
+  typedef std::map<Key, FOMModuleCacheEntry> Map;
+
+  Mutex _mutex;
+  Map _map;
+};
+
+// The header of precompiled files, followed by the version and the size of the encoded modules
+static const char compiledMagic[12] = { 'O', 'p', 'e', 'n', 'R', 'T', 'I', 'F', 'O', 'M', '\r', '\n' };
+static const uint32_t compiledVersion = 1;
+static const size_t compiledHeaderSize = sizeof(compiledMagic) + 8;
+
+static uint32_t
+getUInt32BE(const char* data)
+{
+  return (uint32_t(uint8_t(data[0])) << 24) | (uint32_t(uint8_t(data[1])) << 16)
+    | (uint32_t(uint8_t(data[2])) << 8) | uint32_t(uint8_t(data[3]));
+}
+
+static void
+putUInt32BE(char* data, uint32_t value)
+{
+  data[0] = char(value >> 24);
+  data[1] = char(value >> 16);
+  data[2] = char(value >> 8);
+  data[3] = char(value);
+}
+
+// Returns false if the stream does not start with a precompiled header.
+// The stream is then left at its start.
+static bool
+readCompiledHeader(std::istream& stream, size_t& size)
+{
+  char header[compiledHeaderSize];
+  std::streampos position = stream.tellg();
+  if (!stream.read(header, compiledHeaderSize) || !std::equal(compiledMagic, compiledMagic + sizeof(compiledMagic), header)) {
+    stream.clear();
+    stream.seekg(position);
+    return false;
+  }
+  if (getUInt32BE(header + sizeof(compiledMagic)) != compiledVersion)
+    throw RTIinternalError("Unsupported precompiled FOM module version!");
+  size = getUInt32BE(header + sizeof(compiledMagic) + 4);
+  return true;
+}
+
+static FOMStringModuleList
+readCompiledBody(std::istream& stream, size_t size)
+{
+  // Read the body in one go and just decode the modules from there
+  VariableLengthData variableLengthData;
+  variableLengthData.resize(size);
+  if (size && !stream.read(variableLengthData.charData(), size))
+    throw RTIinternalError("Truncated precompiled FOM module!");
+  FOMStringModuleList moduleList;
+  TightBE1MessageEncoding::decodeFOMStringModuleList(moduleList, variableLengthData);
+  return moduleList;
+}
+
+static FOMStringModule
+readModule(FOMModuleCache::Format format, std::istream& stream, const std::string& encoding)
+{
+  switch (format) {
+  case FOMModuleCache::FEDFormat:
+    return FEDFileReader::read(stream);
+  case FOMModuleCache::FDD1516Format:
+    return FDD1516FileReader::read(stream, encoding);
+  default:
+    return FDD1516EFileReader::read(stream, encoding);
+  }
+}
+
+static FOMStringModule
+readContent(FOMModuleCache::Format format, const std::string& content, const std::string& encoding)
+{
+  std::istringstream stream(content);
+  FOMStringModule module = readModule(format, stream, encoding);
+  module.setContentHash(FOMModuleCache::getContentHash(format, content));
+  return module;
+}
+
+FOMStringModule
+FOMModuleCache::read(Format format, std::istream& stream, const std::string& encoding)
+{
+  std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+  return readContent(format, content, encoding);
+}
+
+// Fills the list with the modules from the file or the ones cached for the file
+static bool
+readFileModuleList(FOMStringModuleList& moduleList, FOMModuleCache::Format format, const std::string& fileName, const std::string& encoding)
+{
+  struct stat fileStat;
+  if (stat(fileName.c_str(), &fileStat) != 0)
+    return false;
+  if ((fileStat.st_mode & S_IFMT) != S_IFREG)
+    return false;
+
+  FOMModuleCacheMap& fomModuleCacheMap = FOMModuleCacheMap::instance();
+  FOMModuleCacheMap::Key key(fileName, std::make_pair(int(format), encoding));
+  {
+    ScopeLock scopeLock(fomModuleCacheMap._mutex);
+    FOMModuleCacheMap::Map::const_iterator i = fomModuleCacheMap._map.find(key);
+    if (i != fomModuleCacheMap._map.end() && i->second._modificationTime == int64_t(fileStat.st_mtime)
+        && i->second._size == int64_t(fileStat.st_size)) {
+      moduleList = i->second._moduleList;
+      return true;
+    }
+  }
+
+  std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+  if (!stream.is_open())
+    return false;
+  // Parse outside the lock, concurrent readers of the same file just do the work twice
+  size_t size;
+  if (readCompiledHeader(stream, size)) {
+    moduleList = readCompiledBody(stream, size);
+  } else {
+    std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    moduleList.clear();
+    moduleList.push_back(readContent(format, content, encoding));
+  }
+
+  ScopeLock scopeLock(fomModuleCacheMap._mutex);
+  FOMModuleCacheEntry& entry = fomModuleCacheMap._map[key];
+  entry._modificationTime = int64_t(fileStat.st_mtime);
+  entry._size = int64_t(fileStat.st_size);
+  entry._moduleList = moduleList;
+  return true;
+}
+
+bool
+FOMModuleCache::readFile(FOMStringModule& module, Format format, const std::string& fileName, const std::string& encoding)
+{
+  FOMStringModuleList moduleList;
+  if (!readFileModuleList(moduleList, format, fileName, encoding))
+    return false;
+  if (moduleList.size() != 1)
+    throw RTIinternalError("Expected a single FOM module in \"" + fileName + "\"!");
+  module = moduleList.front();
+  return true;
+}
+
+bool
+FOMModuleCache::readFile(FOMStringModuleList& moduleList, Format format, const std::string& fileName, const std::string& encoding)
+{
+  FOMStringModuleList fileModuleList;
+  if (!readFileModuleList(fileModuleList, format, fileName, encoding))
+    return false;
+  moduleList.insert(moduleList.end(), fileModuleList.begin(), fileModuleList.end());
+  return true;
+}
+
+void
+FOMModuleCache::writeCompiled(std::ostream& stream, const FOMStringModuleList& moduleList)
+{
+  VariableLengthData variableLengthData;
+  TightBE1MessageEncoding::encodeFOMStringModuleList(variableLengthData, moduleList);
+  char header[compiledHeaderSize];
+  std::copy(compiledMagic, compiledMagic + sizeof(compiledMagic), header);
+  putUInt32BE(header + sizeof(compiledMagic), compiledVersion);
+  putUInt32BE(header + sizeof(compiledMagic) + 4, uint32_t(variableLengthData.size()));
+  stream.write(header, compiledHeaderSize);
+  if (variableLengthData.size())
+    stream.write(variableLengthData.charData(), variableLengthData.size());
+}
+
+FOMStringModuleList
+FOMModuleCache::readCompiled(std::istream& stream)
+{
+  size_t size;
+  if (!readCompiledHeader(stream, size))
+    throw RTIinternalError("Not a precompiled FOM module!");
+  return readCompiledBody(stream, size);
+}
+
+std::string
+FOMModuleCache::getContentHash(Format format, const std::string& content)
+{
+  // Two differently seeded 64 bit fnv-1a hashes with the length and the format
+  // mixed in. Distinct modules are not chosen by an adversary, so this is sufficient
+  // to identify equal source texts.
+  uint64_t hash0 = 0xcbf29ce484222325ull;
+  uint64_t hash1 = 0x84222325cbf29ce4ull ^ uint64_t(format);
+  for (std::string::const_iterator i = content.begin(); i != content.end(); ++i) {
+    hash0 = (hash0 ^ uint8_t(*i))*0x100000001b3ull;
+    hash1 = (hash1 ^ uint8_t(*i))*0x100000001b3ull;
+    hash1 ^= hash1 >> 29;
+  }
+  std::stringstream stream;
+  stream << std::hex << int(format) << "-" << content.size() << "-" << hash0 << "-" << hash1;
+  return stream.str();
+}
+
+void
+FOMModuleCache::clear()
+{
+  FOMModuleCacheMap& fomModuleCacheMap = FOMModuleCacheMap::instance();
+  ScopeLock scopeLock(fomModuleCacheMap._mutex);
+  fomModuleCacheMap._map.clear();
+}
+
+} // namespace OpenRTI
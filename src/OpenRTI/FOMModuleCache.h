@@ -0,0 +1,72 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_FOMModuleCache_h
+#define OpenRTI_FOMModuleCache_h
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "Export.h"
+
+namespace OpenRTI {
+
+class FOMStringModule;
+typedef std::vector<FOMStringModule> FOMStringModuleList;
+
+/// Process wide cache of parsed FOM modules.
+/// Modules read from files are kept by file name, format and the modification
+/// time and size of the file. So repeated create and join calls with the same
+/// files skip parsing. Modules read through this class get the hash of their
+/// source text, joining federates use that to offer the modules the root server
+/// already knows by their hash only.
+/// Module lists can also be precompiled into a binary file, see writeCompiled.
+/// Reading such a file skips the xml parser and just decodes the modules.
+class OPENRTI_API FOMModuleCache {
+public:
+  enum Format {
+    FEDFormat,
+    FDD1516Format,
+    FDD1516EFormat
+  };
+
+  /// Parse a module from the stream
+  static FOMStringModule read(Format format, std::istream& stream, const std::string& encoding);
+  /// Parse a module from the file with the locale encoded name or return the cached one
+  /// if the file did not change since. Returns false if the file cannot be opened.
+  static bool readFile(FOMStringModule& module, Format format, const std::string& fileName, const std::string& encoding);
+  /// Same as above, but appends the modules to the list. Precompiled files are
+  /// detected by their header and append all the modules they contain.
+  static bool readFile(FOMStringModuleList& moduleList, Format format, const std::string& fileName, const std::string& encoding);
+
+  /// Write the modules in the precompiled binary format
+  static void writeCompiled(std::ostream& stream, const FOMStringModuleList& moduleList);
+  /// Read modules written by writeCompiled
+  static FOMStringModuleList readCompiled(std::istream& stream);
+
+  /// The hash identifying a modules source text in the given format
+  static std::string getContentHash(Format format, const std::string& content);
+
+  /// Drop all cached modules
+  static void clear();
+};
+
+} // namespace OpenRTI
+
+#endif
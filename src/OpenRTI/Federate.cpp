@@ -200,7 +200,8 @@ Federate::InteractionClass::insertChildInteractionClass(InteractionClass& intera
 
 Federate::ObjectClass::ObjectClass() :
   _subscriptionType(Unsubscribed),
-  _publicationType(Unpublished)
+  _publicationType(Unpublished),
+  _updateRate(0)
 {
 }
 
@@ -339,6 +340,21 @@ Federate::ObjectClass::setSubscriptionType(SubscriptionType subscriptionType)
   return oldSubscriptionType != getEffectiveSubscriptionType();
 }
 
+bool
+Federate::ObjectClass::setUpdateRate(double updateRate)
+{
+  if (_updateRate == updateRate)
+    return false;
+  _updateRate = updateRate;
+  return true;
+}
+
+void
+Federate::ObjectClass::setAttributeCache(const SharedPtr<AttributeCache>& attributeCache)
+{
+  _attributeCache = attributeCache;
+}
+
 bool
 Federate::ObjectClass::isAttributePublished(const AttributeHandle& attributeHandle) const
 {
@@ -518,7 +534,10 @@ Federate::Federate() :
   _attributeRelevanceAdvisorySwitchEnabled(false),
   _attributeScopeAdvisorySwitchEnabled(false),
   _interactionRelevanceAdvisorySwitchEnabled(false),
-  _permitTimeRegulation(true)
+  _permitTimeRegulation(true),
+  _saveStatus(NO_SAVE_IN_PROGRESS),
+  _restoreStatus(NO_RESTORE_IN_PROGRESS),
+  _restoreStateValid(false)
 {
 }
 
@@ -1138,6 +1157,36 @@ Federate::synchronizationLabelAnnounced(const std::string& label) const
   return _announcedFederationSynchonizationLabels.find(label) != _announcedFederationSynchonizationLabels.end();
 }
 
+void
+Federate::setSaveStatus(SaveStatus saveStatus)
+{
+  _saveStatus = saveStatus;
+}
+
+void
+Federate::setSaveLabel(const std::string& saveLabel)
+{
+  _saveLabel = saveLabel;
+}
+
+void
+Federate::setRestoreStatus(RestoreStatus restoreStatus)
+{
+  _restoreStatus = restoreStatus;
+}
+
+void
+Federate::setRestoreLabel(const std::string& restoreLabel)
+{
+  _restoreLabel = restoreLabel;
+}
+
+void
+Federate::setRestoreStateValid(bool restoreStateValid)
+{
+  _restoreStateValid = restoreStateValid;
+}
+
 void
 Federate::insertFOMModule(const FOMModule& module)
 {
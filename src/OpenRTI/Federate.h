@@ -20,6 +20,7 @@
 #ifndef OpenRTI_Federate_h
 #define OpenRTI_Federate_h
 
+#include "AttributeCache.h"
 #include "Export.h"
 #include "IntrusiveList.h"
 #include "HandleAllocator.h"
@@ -322,6 +323,17 @@ public:
     { return _subscriptionType; }
     bool setSubscriptionType(SubscriptionType subscriptionType);
 
+    // The update rate in Hz requested with the subscription, zero means unlimited.
+    double getUpdateRate() const
+    { return _updateRate; }
+    // Returns true if the update rate changed with this call.
+    bool setUpdateRate(double updateRate);
+
+    // The optional cache the reflected attribute values of instances known as this class go to.
+    AttributeCache* getAttributeCache() const
+    { return _attributeCache.get(); }
+    void setAttributeCache(const SharedPtr<AttributeCache>& attributeCache);
+
     // Returns true if the attribute is published.
     bool isAttributePublished(const AttributeHandle& attributeHandle) const;
     PublicationType getEffectiveAttributePublicationType(const AttributeHandle& attributeHandle) const;
@@ -351,6 +363,10 @@ public:
     SubscriptionType _subscriptionType;
     PublicationType _publicationType;
 
+    double _updateRate;
+
+    SharedPtr<AttributeCache> _attributeCache;
+
     ChildObjectClassList _childObjectClassList;
   };
   typedef std::vector<SharedPtr<ObjectClass> > ObjectClassVector;
@@ -479,6 +495,25 @@ public:
   void eraseAnnouncedFederationSynchonizationLabel(const std::string& label);
   bool synchronizationLabelAnnounced(const std::string& label) const;
 
+  /// The federation save and restore state of this federate
+  SaveStatus getSaveStatus() const
+  { return _saveStatus; }
+  void setSaveStatus(SaveStatus saveStatus);
+  const std::string& getSaveLabel() const
+  { return _saveLabel; }
+  void setSaveLabel(const std::string& saveLabel);
+
+  RestoreStatus getRestoreStatus() const
+  { return _restoreStatus; }
+  void setRestoreStatus(RestoreStatus restoreStatus);
+  const std::string& getRestoreLabel() const
+  { return _restoreLabel; }
+  void setRestoreLabel(const std::string& restoreLabel);
+  /// True if the rti internal state of the federate could be restored
+  bool getRestoreStateValid() const
+  { return _restoreStateValid; }
+  void setRestoreStateValid(bool restoreStateValid);
+
   /// On initialization we need to process object model data.
   /// We need only write access to this.
   void insertFOMModule(const FOMModule& module);
@@ -550,6 +585,13 @@ private:
 
   // The synchronization lables that are currently announced
   StringSet _announcedFederationSynchonizationLabels;
+
+  // The federation save and restore in progress
+  SaveStatus _saveStatus;
+  std::string _saveLabel;
+  RestoreStatus _restoreStatus;
+  std::string _restoreLabel;
+  bool _restoreStateValid;
 };
 
 } // namespace OpenRTI
@@ -167,6 +167,12 @@ public:
     return _timeAdvanceLogicalTimeFederateCountMap.begin()->first < _nextMessageLogicalTimeFederateCountMap.begin()->first;
   }
 
+  // O(log(n))
+  bool contains(const FederateHandle& federateHandle) const
+  {
+    return _federateHandleCommitMap.find(federateHandle) != _federateHandleCommitMap.end();
+  }
+
   // O(log(n))
   bool getFederateIsInNextMessageModeForAssert(const FederateHandle& federateHandle) const
   {
@@ -232,6 +238,34 @@ public:
     return true;
   }
 
+  /// Returns true if raising our own time advance commit from logicalTime to nextLogicalTime
+  /// cannot change the time advance or the next message galt of any other federate.
+  /// The time advance galt of every other federate stays at one of the two commits below ours.
+  /// The next message galt does so as long as no one of the two lowest next message commits is
+  /// in between, provided the caller keeps its own next message commit above nextLogicalTime.
+  bool getIsTimeAdvanceCommitInvisible(const LogicalTime& logicalTime, const LogicalTime& nextLogicalTime) const
+  {
+    FederateCountType count = 0;
+    for (typename LogicalTimeFederateCountMap::const_iterator i = _timeAdvanceLogicalTimeFederateCountMap.begin();
+         i != _timeAdvanceLogicalTimeFederateCountMap.end() && count < 2; ++i) {
+      if (!(i->first < logicalTime))
+        return false;
+      count += i->second;
+    }
+    if (count < 2)
+      return false;
+    typename LogicalTimeFederateCountMap::const_iterator i = _nextMessageLogicalTimeFederateCountMap.begin();
+    if (i == _nextMessageLogicalTimeFederateCountMap.end())
+      return false;
+    if (_isInInterval(i->first, logicalTime, nextLogicalTime))
+      return false;
+    if (1 < i->second)
+      return true;
+    if (++i == _nextMessageLogicalTimeFederateCountMap.end())
+      return true;
+    return !_isInInterval(i->first, logicalTime, nextLogicalTime);
+  }
+
   // O(n)
   void getNextMessageFederateHandleList(std::list<std::pair<FederateHandle, Unsigned> >& federateHandleCommitIdList)
   {
@@ -244,6 +278,9 @@ public:
   }
 
 private:
+  static bool _isInInterval(const LogicalTime& logicalTime, const LogicalTime& lower, const LogicalTime& upper)
+  { return lower < logicalTime && !(upper < logicalTime); }
+
   typedef FederateHandle::value_type FederateCountType;
 
   class OPENRTI_LOCAL LogicalTimeFederateCountMap {
@@ -0,0 +1,276 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "FederationSnapshot.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include "Exception.h"
+#include "LogStream.h"
+#include "TightBE1MessageEncoding.h"
+
+namespace OpenRTI {
+
+// The header of save files, followed by the version
+static const char saveMagic[12] = { 'O', 'p', 'e', 'n', 'R', 'T', 'I', 'S', 'A', 'V', '\r', '\n' };
+static const uint32_t saveVersion = 1;
+
+static uint32_t
+getUInt32BE(const char* data)
+{
+  return (uint32_t(uint8_t(data[0])) << 24) | (uint32_t(uint8_t(data[1])) << 16)
+    | (uint32_t(uint8_t(data[2])) << 8) | uint32_t(uint8_t(data[3]));
+}
+
+static void
+putUInt32BE(char* data, uint32_t value)
+{
+  data[0] = char(value >> 24);
+  data[1] = char(value >> 16);
+  data[2] = char(value >> 8);
+  data[3] = char(value);
+}
+
+static void
+writeRecord(std::ostream& stream, const VariableLengthData& variableLengthData)
+{
+  char size[4];
+  putUInt32BE(size, uint32_t(variableLengthData.size()));
+  stream.write(size, sizeof(size));
+  if (variableLengthData.size())
+    stream.write(variableLengthData.charData(), variableLengthData.size());
+}
+
+static void
+readRecord(VariableLengthData& variableLengthData, std::istream& stream)
+{
+  char size[4];
+  if (!stream.read(size, sizeof(size)))
+    throw RTIinternalError("Truncated federation save!");
+  variableLengthData.resize(getUInt32BE(size));
+  if (variableLengthData.size() && !stream.read(variableLengthData.charData(), variableLengthData.size()))
+    throw RTIinternalError("Truncated federation save!");
+}
+
+// Federation names and labels are arbitrary strings, keep only what is safe in a file name
+static std::string
+getFileNameComponent(const std::string& name)
+{
+  std::string component = name;
+  for (std::string::iterator i = component.begin(); i != component.end(); ++i) {
+    char c = *i;
+    if (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '-' || c == '_')
+      continue;
+    *i = '_';
+  }
+  return component;
+}
+
+FederationSnapshot::FederationSnapshot()
+{
+}
+
+FederationSnapshot::~FederationSnapshot()
+{
+}
+
+void
+FederationSnapshot::reserveObjectInstances(size_t numObjectInstances)
+{
+  _objectInstanceVector.reserve(numObjectInstances);
+}
+
+void
+FederationSnapshot::insertObjectInstance(const ObjectInstanceHandle& objectInstanceHandle, const std::string& name,
+                                         const ObjectClassHandle& objectClassHandle)
+{
+  _objectInstanceVector.push_back(_ObjectInstance());
+  _ObjectInstance& objectInstance = _objectInstanceVector.back();
+  objectInstance._objectInstanceHandle = objectInstanceHandle;
+  objectInstance._objectClassHandle = objectClassHandle;
+  objectInstance._nameBegin = _names.size();
+  objectInstance._ownerBegin = _attributeOwnerVector.size();
+  _names.append(name);
+  _header.setNumObjectInstances(Unsigned(_objectInstanceVector.size()));
+}
+
+void
+FederationSnapshot::insertAttributeOwner(const AttributeHandle& attributeHandle, const FederateHandle& federateHandle)
+{
+  OpenRTIAssert(!_objectInstanceVector.empty());
+  _attributeOwnerVector.push_back(AttributeHandleFederateHandlePair(attributeHandle, federateHandle));
+}
+
+void
+FederationSnapshot::getObjectInstanceVector(FederationSaveObjectInstanceVector& objectInstanceVector, size_t begin, size_t end) const
+{
+  OpenRTIAssert(begin <= end && end <= _objectInstanceVector.size());
+  objectInstanceVector.resize(end - begin);
+  for (size_t i = begin; i < end; ++i) {
+    const _ObjectInstance& objectInstance = _objectInstanceVector[i];
+    size_t nameEnd = _names.size();
+    size_t ownerEnd = _attributeOwnerVector.size();
+    if (i + 1 < _objectInstanceVector.size()) {
+      nameEnd = _objectInstanceVector[i + 1]._nameBegin;
+      ownerEnd = _objectInstanceVector[i + 1]._ownerBegin;
+    }
+    FederationSaveObjectInstance& saveObjectInstance = objectInstanceVector[i - begin];
+    saveObjectInstance.setObjectInstanceHandle(objectInstance._objectInstanceHandle);
+    saveObjectInstance.setObjectClassHandle(objectInstance._objectClassHandle);
+    saveObjectInstance.getName().assign(_names, objectInstance._nameBegin, nameEnd - objectInstance._nameBegin);
+    saveObjectInstance.getAttributeHandleFederateHandlePairVector().assign(_attributeOwnerVector.begin() + objectInstance._ownerBegin,
+                                                                          _attributeOwnerVector.begin() + ownerEnd);
+  }
+}
+
+void
+FederationSnapshot::write(std::ostream& stream) const
+{
+  char header[sizeof(saveMagic) + 4];
+  std::copy(saveMagic, saveMagic + sizeof(saveMagic), header);
+  putUInt32BE(header + sizeof(saveMagic), saveVersion);
+  stream.write(header, sizeof(header));
+
+  VariableLengthData variableLengthData;
+  TightBE1MessageEncoding::encodeFederationSaveHeader(variableLengthData, _header);
+  writeRecord(stream, variableLengthData);
+
+  // The buffers are reused for all blocks, so the memory needed is bounded by the block size
+  FederationSaveObjectInstanceVector objectInstanceVector;
+  for (size_t begin = 0; begin < _objectInstanceVector.size(); begin += ObjectInstanceBlockSize) {
+    size_t end = std::min(begin + size_t(ObjectInstanceBlockSize), _objectInstanceVector.size());
+    getObjectInstanceVector(objectInstanceVector, begin, end);
+    TightBE1MessageEncoding::encodeFederationSaveObjectInstanceVector(variableLengthData, objectInstanceVector);
+    writeRecord(stream, variableLengthData);
+  }
+
+  writeRecord(stream, VariableLengthData());
+}
+
+bool
+FederationSnapshot::readHeader(FederationSaveHeader& header, std::istream& stream)
+{
+  char magic[sizeof(saveMagic) + 4];
+  if (!stream.read(magic, sizeof(magic)) || !std::equal(saveMagic, saveMagic + sizeof(saveMagic), magic))
+    return false;
+  if (getUInt32BE(magic + sizeof(saveMagic)) != saveVersion)
+    throw RTIinternalError("Unsupported federation save version!");
+
+  VariableLengthData variableLengthData;
+  readRecord(variableLengthData, stream);
+  TightBE1MessageEncoding::decodeFederationSaveHeader(header, variableLengthData);
+  return true;
+}
+
+bool
+FederationSnapshot::readObjectInstanceVector(FederationSaveObjectInstanceVector& objectInstanceVector, std::istream& stream)
+{
+  VariableLengthData variableLengthData;
+  readRecord(variableLengthData, stream);
+  if (!variableLengthData.size())
+    return false;
+  TightBE1MessageEncoding::decodeFederationSaveObjectInstanceVector(objectInstanceVector, variableLengthData);
+  return true;
+}
+
+std::string
+FederationSnapshot::getFileName(const std::string& directory, const std::string& federationName, const std::string& label)
+{
+  std::string fileName = directory;
+  if (!fileName.empty() && fileName[fileName.size() - 1] != '/')
+    fileName.push_back('/');
+  fileName.append(getFileNameComponent(federationName));
+  fileName.push_back('.');
+  fileName.append(getFileNameComponent(label));
+  fileName.append(".save");
+  return fileName;
+}
+
+class OPENRTI_LOCAL FederationSnapshotWriter::_WrittenOperation : public AbstractServerNode::Operation {
+public:
+  _WrittenOperation(FederationSnapshotWriter& federationSnapshotWriter) :
+    _federationSnapshotWriter(&federationSnapshotWriter)
+  { }
+  virtual ~_WrittenOperation()
+  { }
+  virtual void operator()()
+  { _federationSnapshotWriter->written(); }
+
+private:
+  SharedPtr<FederationSnapshotWriter> _federationSnapshotWriter;
+};
+
+FederationSnapshotWriter::FederationSnapshotWriter(const SharedPtr<const FederationSnapshot>& federationSnapshot, const std::string& fileName,
+                                                   const SharedPtr<AbstractServerNode::ServerLoop>& serverLoop) :
+  _federationSnapshot(federationSnapshot),
+  _fileName(fileName),
+  _serverLoop(serverLoop),
+  _successful(false)
+{
+}
+
+FederationSnapshotWriter::~FederationSnapshotWriter()
+{
+}
+
+bool
+FederationSnapshotWriter::commit(bool successful)
+{
+  std::string temporaryFileName = getTemporaryFileName();
+  if (successful && _successful) {
+    // Replace an older save with the same label
+    std::remove(_fileName.c_str());
+    if (std::rename(temporaryFileName.c_str(), _fileName.c_str()) == 0)
+      return true;
+    Log(ServerFederation, Error) << "Cannot rename federation save \"" << temporaryFileName << "\"!" << std::endl;
+  }
+  std::remove(temporaryFileName.c_str());
+  return false;
+}
+
+void
+FederationSnapshotWriter::run()
+{
+  std::string temporaryFileName = getTemporaryFileName();
+  try {
+    std::ofstream stream(temporaryFileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (stream.is_open()) {
+      _federationSnapshot->write(stream);
+      stream.flush();
+      _successful = !stream.fail();
+      if (!_successful)
+        Log(ServerFederation, Error) << "Error writing federation save \"" << temporaryFileName << "\"!" << std::endl;
+    } else {
+      Log(ServerFederation, Error) << "Cannot open federation save \"" << temporaryFileName << "\" for writing!" << std::endl;
+    }
+  } catch (const OpenRTI::Exception& e) {
+    Log(ServerFederation, Error) << "Error writing federation save \"" << temporaryFileName << "\": " << e.what() << std::endl;
+  } catch (...) {
+    Log(ServerFederation, Error) << "Error writing federation save \"" << temporaryFileName << "\"!" << std::endl;
+  }
+  _federationSnapshot.clear();
+
+  // Nobody is left to finish the save
+  if (!_serverLoop->postOperation(new _WrittenOperation(*this)))
+    std::remove(temporaryFileName.c_str());
+  _serverLoop.clear();
+}
+
+} // namespace OpenRTI
@@ -0,0 +1,139 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_FederationSnapshot_h
+#define OpenRTI_FederationSnapshot_h
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "AbstractServerNode.h"
+#include "Export.h"
+#include "Message.h"
+#include "Referenced.h"
+#include "SharedPtr.h"
+#include "Thread.h"
+
+namespace OpenRTI {
+
+/// The rti side state of a federation at the time of a federation save.
+/// Taking the snapshot happens in the servers event loop and just copies
+/// the object instances into a few flat arrays without any per instance
+/// allocation. The snapshot is immutable from then on and encoding and
+/// writing it is done by a FederationSnapshotWriter in its own thread.
+/// The file starts with a magic and the format version, followed by
+/// length prefixed records: the header first, then blocks of object instances
+/// and an empty record marking the end.
+class OPENRTI_API FederationSnapshot : public Referenced {
+public:
+  /// Object instances per record in the file
+  enum { ObjectInstanceBlockSize = 1024 };
+
+  FederationSnapshot();
+  ~FederationSnapshot();
+
+  /// Everything besides the object instances
+  FederationSaveHeader& getHeader()
+  { return _header; }
+  const FederationSaveHeader& getHeader() const
+  { return _header; }
+
+  void reserveObjectInstances(size_t numObjectInstances);
+  /// Append an object instance, the owners inserted next belong to this instance
+  void insertObjectInstance(const ObjectInstanceHandle& objectInstanceHandle, const std::string& name,
+                            const ObjectClassHandle& objectClassHandle);
+  void insertAttributeOwner(const AttributeHandle& attributeHandle, const FederateHandle& federateHandle);
+
+  size_t getNumObjectInstances() const
+  { return _objectInstanceVector.size(); }
+  /// Expand the object instances from begin to end
+  void getObjectInstanceVector(FederationSaveObjectInstanceVector& objectInstanceVector, size_t begin, size_t end) const;
+
+  /// Encode and write the whole snapshot, one block of object instances at a time
+  void write(std::ostream& stream) const;
+
+  /// Read the header of a save, returns false if the stream does not contain a save
+  static bool readHeader(FederationSaveHeader& header, std::istream& stream);
+  /// Read the next block of object instances following the header, returns false at the end
+  static bool readObjectInstanceVector(FederationSaveObjectInstanceVector& objectInstanceVector, std::istream& stream);
+
+  /// The file a save of the federation with the given label lives in
+  static std::string getFileName(const std::string& directory, const std::string& federationName, const std::string& label);
+
+private:
+  FederationSnapshot(const FederationSnapshot&);
+  FederationSnapshot& operator=(const FederationSnapshot&);
+
+  struct _ObjectInstance {
+    ObjectInstanceHandle _objectInstanceHandle;
+    ObjectClassHandle _objectClassHandle;
+    // Ranges in _names and _attributeOwnerVector
+    size_t _nameBegin;
+    size_t _ownerBegin;
+  };
+
+  FederationSaveHeader _header;
+
+  std::vector<_ObjectInstance> _objectInstanceVector;
+  std::string _names;
+  AttributeHandleFederateHandlePairVector _attributeOwnerVector;
+};
+
+/// Writes a snapshot into a temporary file next to the final one.
+/// Once written, the writer posts itself back into the event loop of the
+/// server node and written is called from there, so the event loop never
+/// waits for the writer. The user renames the file once the save succeeded,
+/// so a failed or aborted save never replaces an existing save with the same label.
+class OPENRTI_API FederationSnapshotWriter : public Thread {
+public:
+  FederationSnapshotWriter(const SharedPtr<const FederationSnapshot>& federationSnapshot, const std::string& fileName,
+                           const SharedPtr<AbstractServerNode::ServerLoop>& serverLoop);
+
+  const std::string& getFileName() const
+  { return _fileName; }
+  std::string getTemporaryFileName() const
+  { return _fileName + ".tmp"; }
+
+  /// Only valid once written is called
+  bool getSuccessful() const
+  { return _successful; }
+
+  /// Move the written file into place or remove it, only valid once written is called
+  bool commit(bool successful);
+
+protected:
+  virtual ~FederationSnapshotWriter();
+
+  virtual void run();
+
+  /// Called from the event loop once the file is written
+  virtual void written() = 0;
+
+private:
+  class _WrittenOperation;
+
+  SharedPtr<const FederationSnapshot> _federationSnapshot;
+  std::string _fileName;
+  SharedPtr<AbstractServerNode::ServerLoop> _serverLoop;
+  bool _successful;
+};
+
+} // namespace OpenRTI
+
+#endif
@@ -23,6 +23,7 @@
 #include "AbstractServer.h"
 #include "MessageEncodingRegistry.h"
 #include "ServerOptions.h"
+#include "StringUtils.h"
 #include "ZLibProtocolLayer.h"
 
 namespace OpenRTI {
@@ -65,6 +66,10 @@ InitialClientStreamProtocol::setConnectOptions(StringStringListMap connectOption
 #endif
   // And all our encodings we can just do,
   connectOptions["encoding"] = MessageEncodingRegistry::instance().getEncodings();
+  // Optional extensions to the encoding we can do
+  connectOptions["extensions"].clear();
+  connectOptions["extensions"].push_back("trace");
+  connectOptions["extensions"].push_back("fragment");
 
   writeOptionMap(connectOptions);
 
@@ -95,10 +100,18 @@ InitialClientStreamProtocol::readOptionMap(const StringStringListMap& optionMap)
   if (!messageProtocol.valid()) {
     throw RTIinternalError("Unable to do server given encoding!");
   }
+  i = optionMap.find("extensions");
+  if (i != optionMap.end()) {
+    messageProtocol->setEnableTraceExtension(contains(i->second, "trace"));
+    messageProtocol->setEnableFragmentExtension(contains(i->second, "fragment"));
+  }
+  i = optionMap.find("deltaCompression");
+  if (i != optionMap.end())
+    messageProtocol->setEnableDeltaCompression(contains(i->second, "yes"));
 
   // Get a new parent connect from the server implementation.
   SharedPtr<AbstractConnect> connect;
-  connect = _abstractServer.sendConnect(optionMap, true /*parent*/);
+  connect = _abstractServer.sendNetworkConnect(optionMap, true /*parent*/);
   if (!connect.valid())
     throw RTIinternalError("Could not get an internal connect structure from the server!");
   messageProtocol->setConnect(connect);
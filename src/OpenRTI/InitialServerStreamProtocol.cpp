@@ -85,7 +85,7 @@ InitialServerStreamProtocol::readOptionMap(const StringStringListMap& clientOpti
 
   // Get a new client connect from the server implementation.
   SharedPtr<AbstractConnect> connect;
-  connect = _abstractServer.sendConnect(clientOptionMap, false /*parent*/);
+  connect = _abstractServer.sendNetworkConnect(clientOptionMap, false /*parent*/);
   if (!connect.valid()) {
     errorResponse("Could not get an internal connect structure from the server!");
     return;
@@ -101,6 +101,18 @@ InitialServerStreamProtocol::readOptionMap(const StringStringListMap& clientOpti
   responseValueMap["encoding"].clear();
   responseValueMap["encoding"].push_back(encodingList.front());
   responseValueMap["compression"].clear();
+  responseValueMap.erase("deltaCompression");
+  // Only echo the extensions the client asked for
+  responseValueMap["extensions"].clear();
+  i = clientOptionMap.find("extensions");
+  if (i != clientOptionMap.end() && contains(i->second, "trace")) {
+    messageProtocol->setEnableTraceExtension(true);
+    responseValueMap["extensions"].push_back("trace");
+  }
+  if (i != clientOptionMap.end() && contains(i->second, "fragment")) {
+    messageProtocol->setEnableFragmentExtension(true);
+    responseValueMap["extensions"].push_back("fragment");
+  }
 
   if (_abstractServer.getServerNode().getServerOptions()._preferCompression) {
     i = clientOptionMap.find("compression");
@@ -126,6 +138,12 @@ InitialServerStreamProtocol::readOptionMap(const StringStringListMap& clientOpti
 #endif
       }
     }
+    // Attribute updates as changes to the values last sent, independent of the stream compression
+    i = clientOptionMap.find("deltaCompression");
+    if (i != clientOptionMap.end() && contains(i->second, "yes")) {
+      messageProtocol->setEnableDeltaCompression(true);
+      responseValueMap["deltaCompression"].push_back("yes");
+    }
   }
   if (responseValueMap["compression"].empty())
     responseValueMap["compression"].push_back("no");
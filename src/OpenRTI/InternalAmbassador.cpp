@@ -26,6 +26,7 @@
 #include "LogStream.h"
 #include "LeafServerThread.h"
 #include "Message.h"
+#include "URL.h"
 
 namespace OpenRTI {
 
@@ -41,7 +42,31 @@ private:
   InternalAmbassador& _basicAmbassador;
 };
 
-InternalAmbassador::InternalAmbassador()
+static InternalTimeManagement::TimeStampOrderQueueType
+parseTimeStampOrderQueueType(const std::string& value)
+{
+  if (value == "heap")
+    return InternalTimeManagement::HeapTimeStampOrderQueue;
+  else if (value == "map")
+    return InternalTimeManagement::MapTimeStampOrderQueue;
+  else
+    throw InvalidLocalSettingsDesignator(std::string("Unknown timeStampOrderQueue \"") + value + "\"!");
+}
+
+static bool
+parseCommitCoalescing(const std::string& value)
+{
+  if (value == "true")
+    return true;
+  else if (value == "false")
+    return false;
+  else
+    throw InvalidLocalSettingsDesignator(std::string("Unknown commitCoalescing \"") + value + "\"!");
+}
+
+InternalAmbassador::InternalAmbassador() :
+  _timeStampOrderQueueType(InternalTimeManagement::MapTimeStampOrderQueue),
+  _commitCoalescing(false)
 {
 }
 
@@ -61,7 +86,29 @@ InternalAmbassador::isConnected() const
 void
 InternalAmbassador::connect(const URL& url, const StringStringListMap& parameterMap)
 {
-  _connect = LeafServerThread::connect(url, parameterMap);
+  StringStringListMap::const_iterator i = parameterMap.find("timeStampOrderQueue");
+  if (i != parameterMap.end() && !i->second.empty())
+    _timeStampOrderQueueType = parseTimeStampOrderQueueType(i->second.back());
+  i = parameterMap.find("commitCoalescing");
+  if (i != parameterMap.end() && !i->second.empty())
+    _commitCoalescing = parseCommitCoalescing(i->second.back());
+
+  // Ambassador local options may also be given in the url query.
+  // Strip them, federates in the same process with different local options
+  // still need to share the same leaf server.
+  StringPairVector query;
+  for (StringPairVector::const_iterator j = url.getQuery().begin(); j != url.getQuery().end(); ++j) {
+    if (j->first == "timeStampOrderQueue")
+      _timeStampOrderQueueType = parseTimeStampOrderQueueType(j->second);
+    else if (j->first == "commitCoalescing")
+      _commitCoalescing = parseCommitCoalescing(j->second);
+    else
+      query.push_back(*j);
+  }
+  URL connectUrl = url;
+  connectUrl.setQuery(query);
+
+  _connect = LeafServerThread::connect(connectUrl, parameterMap);
 }
 
 void
@@ -76,6 +123,8 @@ void
 InternalAmbassador::send(const SharedPtr<const AbstractMessage>& message)
 {
   OpenRTIAssert(_connect.valid());
+  if (MessageTrace::getEnabled())
+    message->setMessageTrace(MessageTrace::create());
   _connect->send(message);
 }
 
@@ -220,6 +269,82 @@ InternalAmbassador::acceptInternalMessage(const FederationSynchronizedMessage& m
   queueCallback(message);
 }
 
+void
+InternalAmbassador::acceptInternalMessage(const InitiateFederateSaveMessage& message)
+{
+  InternalTimeManagement* timeManagement = getTimeManagement();
+  if (!message.getTimeStampValid() || !timeManagement) {
+    queueCallback(message);
+    return;
+  }
+  if (timeManagement->queueTimeStampedSave(*this, message))
+    return;
+
+  // The federate is already past the save time
+  Federate* federate = getFederate();
+  if (!federate)
+    return;
+  SharedPtr<FederateSaveCompleteMessage> request = new FederateSaveCompleteMessage;
+  request->setFederationHandle(federate->getFederationHandle());
+  request->setFederateHandle(federate->getFederateHandle());
+  request->setSuccessful(false);
+  request->setSaveFailureReason(SAVE_TIME_CANNOT_BE_HONORED);
+  send(request);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const FederationSavedMessage& message)
+{
+  if (InternalTimeManagement* timeManagement = getTimeManagement())
+    timeManagement->acceptInternalMessage(*this, message);
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const QueryFederationSaveStatusResponseMessage& message)
+{
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const RequestFederationRestoreResponseMessage& message)
+{
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const FederationRestoreBegunMessage& message)
+{
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const InitiateFederateRestoreMessage& message)
+{
+  Federate* federate = getFederate();
+  if (!federate)
+    return;
+  // Return to the saved time management state right away, so nothing
+  // from the abandoned timeline can be delivered to the federate anymore
+  InternalTimeManagement* timeManagement = getTimeManagement();
+  federate->setRestoreStateValid(timeManagement && timeManagement->restoreState(*this, message.getLabel()));
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const FederationRestoredMessage& message)
+{
+  if (InternalTimeManagement* timeManagement = getTimeManagement())
+    timeManagement->acceptInternalMessage(*this, message);
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const QueryFederationRestoreStatusResponseMessage& message)
+{
+  queueCallback(message);
+}
+
 void
 InternalAmbassador::acceptInternalMessage(const EnableTimeRegulationRequestMessage& message)
 {
@@ -248,6 +373,13 @@ InternalAmbassador::acceptInternalMessage(const CommitLowerBoundTimeStampMessage
     timeManagement->acceptInternalMessage(*this, message);
 }
 
+void
+InternalAmbassador::acceptInternalMessage(const CollectedCommitLowerBoundTimeStampMessage& message)
+{
+  if (InternalTimeManagement* timeManagement = getTimeManagement())
+    timeManagement->acceptInternalMessage(*this, message);
+}
+
 void
 InternalAmbassador::acceptInternalMessage(const CommitLowerBoundTimeStampResponseMessage& message)
 {
@@ -262,6 +394,13 @@ InternalAmbassador::acceptInternalMessage(const LockedByNextMessageRequestMessag
     timeManagement->acceptInternalMessage(*this, message);
 }
 
+void
+InternalAmbassador::acceptInternalMessage(const MessageRetractionMessage& message)
+{
+  if (InternalTimeManagement* timeManagement = getTimeManagement())
+    timeManagement->acceptInternalMessage(*this, message);
+}
+
 void
 InternalAmbassador::acceptInternalMessage(const InsertRegionMessage& message)
 {
@@ -361,6 +500,22 @@ InternalAmbassador::acceptInternalMessage(const InsertObjectInstanceMessage& mes
   queueCallback(message);
 }
 
+void
+InternalAmbassador::acceptInternalMessage(const InsertMultipleObjectInstancesMessage& message)
+{
+  // Discover these one by one, just like single inserts
+  for (ObjectInstanceStateVector::const_iterator i = message.getObjectInstanceStateVector().begin();
+       i != message.getObjectInstanceStateVector().end(); ++i) {
+    SharedPtr<InsertObjectInstanceMessage> insert = new InsertObjectInstanceMessage;
+    insert->setFederationHandle(message.getFederationHandle());
+    insert->setObjectClassHandle(i->getObjectClassHandle());
+    insert->setObjectInstanceHandle(i->getObjectInstanceHandle());
+    insert->setName(i->getName());
+    insert->setAttributeStateVector(i->getAttributeStateVector());
+    queueCallback(*insert);
+  }
+}
+
 void
 InternalAmbassador::acceptInternalMessage(const DeleteObjectInstanceMessage& message)
 {
@@ -430,6 +585,30 @@ InternalAmbassador::acceptInternalMessage(const RequestClassAttributeUpdateMessa
   }
 }
 
+void
+InternalAmbassador::acceptInternalMessage(const ChangeAttributeTransportationTypeResponseMessage& message)
+{
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const ChangeInteractionTransportationTypeResponseMessage& message)
+{
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const QueryAttributeTransportationTypeResponseMessage& message)
+{
+  queueCallback(message);
+}
+
+void
+InternalAmbassador::acceptInternalMessage(const QueryInteractionTransportationTypeResponseMessage& message)
+{
+  queueCallback(message);
+}
+
 class OPENRTI_LOCAL InternalAmbassador::_CreateFederationExecutionFunctor {
 public:
   _CreateFederationExecutionFunctor(InternalAmbassador& basicAmbassador) :
@@ -667,6 +846,7 @@ InternalAmbassador::_dispatchCallbackMessage(AbstractMessageDispatcher& messageD
     SharedPtr<const AbstractMessage> message;
     message.swap(_callbackMessageList.front());
     _messageListPool.splice(_messageListPool.begin(), _callbackMessageList, _callbackMessageList.begin());
+    message->writeMessageTrace();
     message->dispatch(messageDispatcher);
     return true;
   }
@@ -22,6 +22,7 @@
 
 #include "AbstractConnect.h"
 #include "Message.h"
+#include "InternalTimeManagement.h"
 #include "StringUtils.h"
 
 namespace OpenRTI {
@@ -40,6 +41,15 @@ public:
   void connect(const URL& url, const StringStringListMap& parameterMap);
   void disconnect();
 
+  /// The time stamp order queue implementation used for the federate joined through this ambassador.
+  /// Configured by the timeStampOrderQueue connect option, either "map" or "heap".
+  InternalTimeManagement::TimeStampOrderQueueType getTimeStampOrderQueueType() const
+  { return _timeStampOrderQueueType; }
+  /// Defer time advance commits that cannot raise the GALT of any other federate.
+  /// Configured by the commitCoalescing connect option, either "true" or "false" (default).
+  bool getCommitCoalescing() const
+  { return _commitCoalescing; }
+
   /// Send a message
   void send(const SharedPtr<const AbstractMessage>& message);
 
@@ -78,12 +88,22 @@ public:
   void acceptInternalMessage(const AnnounceSynchronizationPointMessage& message);
   void acceptInternalMessage(const SynchronizationPointAchievedMessage& message);
   void acceptInternalMessage(const FederationSynchronizedMessage& message);
+  void acceptInternalMessage(const InitiateFederateSaveMessage& message);
+  void acceptInternalMessage(const FederationSavedMessage& message);
+  void acceptInternalMessage(const QueryFederationSaveStatusResponseMessage& message);
+  void acceptInternalMessage(const RequestFederationRestoreResponseMessage& message);
+  void acceptInternalMessage(const FederationRestoreBegunMessage& message);
+  void acceptInternalMessage(const InitiateFederateRestoreMessage& message);
+  void acceptInternalMessage(const FederationRestoredMessage& message);
+  void acceptInternalMessage(const QueryFederationRestoreStatusResponseMessage& message);
   void acceptInternalMessage(const EnableTimeRegulationRequestMessage& message);
   void acceptInternalMessage(const EnableTimeRegulationResponseMessage& message);
   void acceptInternalMessage(const DisableTimeRegulationRequestMessage& message);
   void acceptInternalMessage(const CommitLowerBoundTimeStampMessage& message);
+  void acceptInternalMessage(const CollectedCommitLowerBoundTimeStampMessage& message);
   void acceptInternalMessage(const CommitLowerBoundTimeStampResponseMessage& message);
   void acceptInternalMessage(const LockedByNextMessageRequestMessage& message);
+  void acceptInternalMessage(const MessageRetractionMessage& message);
   void acceptInternalMessage(const InsertRegionMessage& message);
   void acceptInternalMessage(const CommitRegionMessage& message);
   void acceptInternalMessage(const EraseRegionMessage& message);
@@ -99,12 +119,17 @@ public:
   void acceptInternalMessage(const ReserveObjectInstanceNameResponseMessage& message);
   void acceptInternalMessage(const ReserveMultipleObjectInstanceNameResponseMessage& message);
   void acceptInternalMessage(const InsertObjectInstanceMessage& message);
+  void acceptInternalMessage(const InsertMultipleObjectInstancesMessage& message);
   void acceptInternalMessage(const DeleteObjectInstanceMessage& message);
   void acceptInternalMessage(const TimeStampedDeleteObjectInstanceMessage& message);
   void acceptInternalMessage(const AttributeUpdateMessage& message);
   void acceptInternalMessage(const TimeStampedAttributeUpdateMessage& message);
   void acceptInternalMessage(const RequestAttributeUpdateMessage& message);
   void acceptInternalMessage(const RequestClassAttributeUpdateMessage& message);
+  void acceptInternalMessage(const ChangeAttributeTransportationTypeResponseMessage& message);
+  void acceptInternalMessage(const ChangeInteractionTransportationTypeResponseMessage& message);
+  void acceptInternalMessage(const QueryAttributeTransportationTypeResponseMessage& message);
+  void acceptInternalMessage(const QueryInteractionTransportationTypeResponseMessage& message);
 
 
   std::pair<CreateFederationExecutionResponseType, std::string>
@@ -168,6 +193,10 @@ private:
   // The connect to the ServerNodes
   SharedPtr<AbstractConnect> _connect;
 
+  // Ambassador local options given with the connect
+  InternalTimeManagement::TimeStampOrderQueueType _timeStampOrderQueueType;
+  bool _commitCoalescing;
+
   // List for receive order messages already queued for callback
   MessageList _callbackMessageList;
 
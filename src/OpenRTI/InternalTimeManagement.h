@@ -48,6 +48,11 @@ public:
     NextMessageRequestAvailable,
     FlushQueueRequest
   };
+  // The data structure used for the time stamp order message queue
+  enum TimeStampOrderQueueType {
+    MapTimeStampOrderQueue,
+    HeapTimeStampOrderQueue
+  };
 
   InternalTimeManagement();
   virtual ~InternalTimeManagement();
@@ -114,15 +119,35 @@ public:
   virtual void acceptInternalMessage(InternalAmbassador& ambassador, const EnableTimeRegulationResponseMessage& message) = 0;
   virtual void acceptInternalMessage(InternalAmbassador& ambassador, const DisableTimeRegulationRequestMessage& message) = 0;
   virtual void acceptInternalMessage(InternalAmbassador& ambassador, const CommitLowerBoundTimeStampMessage& message) = 0;
+  virtual void acceptInternalMessage(InternalAmbassador& ambassador, const CollectedCommitLowerBoundTimeStampMessage& message) = 0;
   virtual void acceptInternalMessage(InternalAmbassador& ambassador, const CommitLowerBoundTimeStampResponseMessage& message) = 0;
   virtual void acceptInternalMessage(InternalAmbassador& ambassador, const LockedByNextMessageRequestMessage& message) = 0;
+  virtual void acceptInternalMessage(InternalAmbassador& ambassador, const MessageRetractionMessage& message) = 0;
 
   virtual void queueTimeStampedMessage(InternalAmbassador& ambassador, const VariableLengthData& timeStamp, const AbstractMessage& message) = 0;
   virtual void queueReceiveOrderMessage(InternalAmbassador& ambassador, const AbstractMessage& message) = 0;
 
+  /// Federation save and restore.
+  /// Queue the instruction of a timed save at the save time, returns false if that time has already passed
+  virtual bool queueTimeStampedSave(InternalAmbassador& ambassador, const InitiateFederateSaveMessage& message) = 0;
+  /// Snapshot the state when the federate completed its save, it is kept if the federation saved
+  virtual void saveState(const std::string& label) = 0;
+  virtual void acceptInternalMessage(InternalAmbassador& ambassador, const FederationSavedMessage& message) = 0;
+  /// Return to the state saved with the label, returns false if there is no compatible saved state
+  virtual bool restoreState(InternalAmbassador& ambassador, const std::string& label) = 0;
+  virtual void acceptInternalMessage(InternalAmbassador& ambassador, const FederationRestoredMessage& message) = 0;
+
   virtual bool dispatchCallback(const AbstractMessageDispatcher& dispatcher) = 0;
   virtual bool callbackMessageAvailable() = 0;
 
+  /// Select the time stamp order queue implementation, only possible while the queue is empty
+  virtual void setTimeStampOrderQueueType(TimeStampOrderQueueType timeStampOrderQueueType) = 0;
+  /// Defer time advance commits that cannot raise the GALT of any other federate
+  virtual void setCommitCoalescing(bool commitCoalescing) = 0;
+  /// Commits travel through the root server, so they also arrive for the own
+  /// federate and for federates that already disabled time regulation
+  virtual void setTimeAdvanceBarrier(bool timeAdvanceBarrier) = 0;
+
 protected:
 
   // State values
@@ -395,6 +395,104 @@ EnumerateFederationExecutionsResponseMessage::operator<(const EnumerateFederatio
   return false;
 }
 
+MetricsRequestMessage::MetricsRequestMessage()
+{
+}
+
+MetricsRequestMessage::~MetricsRequestMessage()
+{
+}
+
+const char*
+MetricsRequestMessage::getTypeName() const
+{
+  return "MetricsRequestMessage";
+}
+
+void
+MetricsRequestMessage::out(std::ostream& os) const
+{
+  os << "MetricsRequestMessage " << *this;
+}
+
+void
+MetricsRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+MetricsRequestMessage::operator==(const AbstractMessage& rhs) const
+{
+  const MetricsRequestMessage* message = dynamic_cast<const MetricsRequestMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+MetricsRequestMessage::operator==(const MetricsRequestMessage& rhs) const
+{
+  return true;
+}
+
+bool
+MetricsRequestMessage::operator<(const MetricsRequestMessage& rhs) const
+{
+  return false;
+}
+
+MetricsResponseMessage::MetricsResponseMessage() :
+  _metrics()
+{
+}
+
+MetricsResponseMessage::~MetricsResponseMessage()
+{
+}
+
+const char*
+MetricsResponseMessage::getTypeName() const
+{
+  return "MetricsResponseMessage";
+}
+
+void
+MetricsResponseMessage::out(std::ostream& os) const
+{
+  os << "MetricsResponseMessage " << *this;
+}
+
+void
+MetricsResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+MetricsResponseMessage::operator==(const AbstractMessage& rhs) const
+{
+  const MetricsResponseMessage* message = dynamic_cast<const MetricsResponseMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+MetricsResponseMessage::operator==(const MetricsResponseMessage& rhs) const
+{
+  if (getMetrics() != rhs.getMetrics()) return false;
+  return true;
+}
+
+bool
+MetricsResponseMessage::operator<(const MetricsResponseMessage& rhs) const
+{
+  if (getMetrics() < rhs.getMetrics()) return true;
+  if (rhs.getMetrics() < getMetrics()) return false;
+  return false;
+}
+
 InsertFederationExecutionMessage::InsertFederationExecutionMessage() :
   _federationHandle(),
   _federationName(),
@@ -671,6 +769,7 @@ JoinFederationExecutionRequestMessage::JoinFederationExecutionRequestMessage() :
   _federateType(),
   _federateName(),
   _fOMStringModuleList(),
+  _fOMModuleContentHashVector(),
   _configurationParameterMap()
 {
 }
@@ -713,6 +812,7 @@ JoinFederationExecutionRequestMessage::operator==(const JoinFederationExecutionR
   if (getFederateType() != rhs.getFederateType()) return false;
   if (getFederateName() != rhs.getFederateName()) return false;
   if (getFOMStringModuleList() != rhs.getFOMStringModuleList()) return false;
+  if (getFOMModuleContentHashVector() != rhs.getFOMModuleContentHashVector()) return false;
   if (getConfigurationParameterMap() != rhs.getConfigurationParameterMap()) return false;
   return true;
 }
@@ -728,6 +828,8 @@ JoinFederationExecutionRequestMessage::operator<(const JoinFederationExecutionRe
   if (rhs.getFederateName() < getFederateName()) return false;
   if (getFOMStringModuleList() < rhs.getFOMStringModuleList()) return true;
   if (rhs.getFOMStringModuleList() < getFOMStringModuleList()) return false;
+  if (getFOMModuleContentHashVector() < rhs.getFOMModuleContentHashVector()) return true;
+  if (rhs.getFOMModuleContentHashVector() < getFOMModuleContentHashVector()) return false;
   if (getConfigurationParameterMap() < rhs.getConfigurationParameterMap()) return true;
   if (rhs.getConfigurationParameterMap() < getConfigurationParameterMap()) return false;
   return false;
@@ -1410,175 +1512,175 @@ FederationSynchronizedMessage::operator<(const FederationSynchronizedMessage& rh
   return false;
 }
 
-EnableTimeRegulationRequestMessage::EnableTimeRegulationRequestMessage() :
+RequestFederationSaveMessage::RequestFederationSaveMessage() :
   _federationHandle(),
   _federateHandle(),
+  _label(),
   _timeStamp(),
-  _commitId()
+  _timeStampValid()
 {
 }
 
-EnableTimeRegulationRequestMessage::~EnableTimeRegulationRequestMessage()
+RequestFederationSaveMessage::~RequestFederationSaveMessage()
 {
 }
 
 const char*
-EnableTimeRegulationRequestMessage::getTypeName() const
+RequestFederationSaveMessage::getTypeName() const
 {
-  return "EnableTimeRegulationRequestMessage";
+  return "RequestFederationSaveMessage";
 }
 
 void
-EnableTimeRegulationRequestMessage::out(std::ostream& os) const
+RequestFederationSaveMessage::out(std::ostream& os) const
 {
-  os << "EnableTimeRegulationRequestMessage " << *this;
+  os << "RequestFederationSaveMessage " << *this;
 }
 
 void
-EnableTimeRegulationRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+RequestFederationSaveMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-EnableTimeRegulationRequestMessage::operator==(const AbstractMessage& rhs) const
+RequestFederationSaveMessage::operator==(const AbstractMessage& rhs) const
 {
-  const EnableTimeRegulationRequestMessage* message = dynamic_cast<const EnableTimeRegulationRequestMessage*>(&rhs);
+  const RequestFederationSaveMessage* message = dynamic_cast<const RequestFederationSaveMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-EnableTimeRegulationRequestMessage::operator==(const EnableTimeRegulationRequestMessage& rhs) const
+RequestFederationSaveMessage::operator==(const RequestFederationSaveMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getLabel() != rhs.getLabel()) return false;
   if (getTimeStamp() != rhs.getTimeStamp()) return false;
-  if (getCommitId() != rhs.getCommitId()) return false;
+  if (getTimeStampValid() != rhs.getTimeStampValid()) return false;
   return true;
 }
 
 bool
-EnableTimeRegulationRequestMessage::operator<(const EnableTimeRegulationRequestMessage& rhs) const
+RequestFederationSaveMessage::operator<(const RequestFederationSaveMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getLabel() < rhs.getLabel()) return true;
+  if (rhs.getLabel() < getLabel()) return false;
   if (getTimeStamp() < rhs.getTimeStamp()) return true;
   if (rhs.getTimeStamp() < getTimeStamp()) return false;
-  if (getCommitId() < rhs.getCommitId()) return true;
-  if (rhs.getCommitId() < getCommitId()) return false;
+  if (getTimeStampValid() < rhs.getTimeStampValid()) return true;
+  if (rhs.getTimeStampValid() < getTimeStampValid()) return false;
   return false;
 }
 
-EnableTimeRegulationResponseMessage::EnableTimeRegulationResponseMessage() :
+InitiateFederateSaveMessage::InitiateFederateSaveMessage() :
   _federationHandle(),
-  _federateHandle(),
-  _respondingFederateHandle(),
-  _timeStampValid(),
-  _timeStamp()
+  _label(),
+  _timeStamp(),
+  _timeStampValid()
 {
 }
 
-EnableTimeRegulationResponseMessage::~EnableTimeRegulationResponseMessage()
+InitiateFederateSaveMessage::~InitiateFederateSaveMessage()
 {
 }
 
 const char*
-EnableTimeRegulationResponseMessage::getTypeName() const
+InitiateFederateSaveMessage::getTypeName() const
 {
-  return "EnableTimeRegulationResponseMessage";
+  return "InitiateFederateSaveMessage";
 }
 
 void
-EnableTimeRegulationResponseMessage::out(std::ostream& os) const
+InitiateFederateSaveMessage::out(std::ostream& os) const
 {
-  os << "EnableTimeRegulationResponseMessage " << *this;
+  os << "InitiateFederateSaveMessage " << *this;
 }
 
 void
-EnableTimeRegulationResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+InitiateFederateSaveMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-EnableTimeRegulationResponseMessage::operator==(const AbstractMessage& rhs) const
+InitiateFederateSaveMessage::operator==(const AbstractMessage& rhs) const
 {
-  const EnableTimeRegulationResponseMessage* message = dynamic_cast<const EnableTimeRegulationResponseMessage*>(&rhs);
+  const InitiateFederateSaveMessage* message = dynamic_cast<const InitiateFederateSaveMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-EnableTimeRegulationResponseMessage::operator==(const EnableTimeRegulationResponseMessage& rhs) const
+InitiateFederateSaveMessage::operator==(const InitiateFederateSaveMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getRespondingFederateHandle() != rhs.getRespondingFederateHandle()) return false;
-  if (getTimeStampValid() != rhs.getTimeStampValid()) return false;
+  if (getLabel() != rhs.getLabel()) return false;
   if (getTimeStamp() != rhs.getTimeStamp()) return false;
+  if (getTimeStampValid() != rhs.getTimeStampValid()) return false;
   return true;
 }
 
 bool
-EnableTimeRegulationResponseMessage::operator<(const EnableTimeRegulationResponseMessage& rhs) const
+InitiateFederateSaveMessage::operator<(const InitiateFederateSaveMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getFederateHandle() < rhs.getFederateHandle()) return true;
-  if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getRespondingFederateHandle() < rhs.getRespondingFederateHandle()) return true;
-  if (rhs.getRespondingFederateHandle() < getRespondingFederateHandle()) return false;
-  if (getTimeStampValid() < rhs.getTimeStampValid()) return true;
-  if (rhs.getTimeStampValid() < getTimeStampValid()) return false;
+  if (getLabel() < rhs.getLabel()) return true;
+  if (rhs.getLabel() < getLabel()) return false;
   if (getTimeStamp() < rhs.getTimeStamp()) return true;
   if (rhs.getTimeStamp() < getTimeStamp()) return false;
+  if (getTimeStampValid() < rhs.getTimeStampValid()) return true;
+  if (rhs.getTimeStampValid() < getTimeStampValid()) return false;
   return false;
 }
 
-DisableTimeRegulationRequestMessage::DisableTimeRegulationRequestMessage() :
+FederateSaveBegunMessage::FederateSaveBegunMessage() :
   _federationHandle(),
   _federateHandle()
 {
 }
 
-DisableTimeRegulationRequestMessage::~DisableTimeRegulationRequestMessage()
+FederateSaveBegunMessage::~FederateSaveBegunMessage()
 {
 }
 
 const char*
-DisableTimeRegulationRequestMessage::getTypeName() const
+FederateSaveBegunMessage::getTypeName() const
 {
-  return "DisableTimeRegulationRequestMessage";
+  return "FederateSaveBegunMessage";
 }
 
 void
-DisableTimeRegulationRequestMessage::out(std::ostream& os) const
+FederateSaveBegunMessage::out(std::ostream& os) const
 {
-  os << "DisableTimeRegulationRequestMessage " << *this;
+  os << "FederateSaveBegunMessage " << *this;
 }
 
 void
-DisableTimeRegulationRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+FederateSaveBegunMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-DisableTimeRegulationRequestMessage::operator==(const AbstractMessage& rhs) const
+FederateSaveBegunMessage::operator==(const AbstractMessage& rhs) const
 {
-  const DisableTimeRegulationRequestMessage* message = dynamic_cast<const DisableTimeRegulationRequestMessage*>(&rhs);
+  const FederateSaveBegunMessage* message = dynamic_cast<const FederateSaveBegunMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-DisableTimeRegulationRequestMessage::operator==(const DisableTimeRegulationRequestMessage& rhs) const
+FederateSaveBegunMessage::operator==(const FederateSaveBegunMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
@@ -1586,7 +1688,7 @@ DisableTimeRegulationRequestMessage::operator==(const DisableTimeRegulationReque
 }
 
 bool
-DisableTimeRegulationRequestMessage::operator<(const DisableTimeRegulationRequestMessage& rhs) const
+FederateSaveBegunMessage::operator<(const FederateSaveBegunMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
@@ -1595,1771 +1697,3615 @@ DisableTimeRegulationRequestMessage::operator<(const DisableTimeRegulationReques
   return false;
 }
 
-CommitLowerBoundTimeStampMessage::CommitLowerBoundTimeStampMessage() :
+FederateSaveCompleteMessage::FederateSaveCompleteMessage() :
   _federationHandle(),
   _federateHandle(),
-  _timeStamp(),
-  _commitType(),
-  _commitId()
+  _successful(),
+  _saveFailureReason()
 {
 }
 
-CommitLowerBoundTimeStampMessage::~CommitLowerBoundTimeStampMessage()
+FederateSaveCompleteMessage::~FederateSaveCompleteMessage()
 {
 }
 
 const char*
-CommitLowerBoundTimeStampMessage::getTypeName() const
+FederateSaveCompleteMessage::getTypeName() const
 {
-  return "CommitLowerBoundTimeStampMessage";
+  return "FederateSaveCompleteMessage";
 }
 
 void
-CommitLowerBoundTimeStampMessage::out(std::ostream& os) const
+FederateSaveCompleteMessage::out(std::ostream& os) const
 {
-  os << "CommitLowerBoundTimeStampMessage " << *this;
+  os << "FederateSaveCompleteMessage " << *this;
 }
 
 void
-CommitLowerBoundTimeStampMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+FederateSaveCompleteMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-CommitLowerBoundTimeStampMessage::operator==(const AbstractMessage& rhs) const
+FederateSaveCompleteMessage::operator==(const AbstractMessage& rhs) const
 {
-  const CommitLowerBoundTimeStampMessage* message = dynamic_cast<const CommitLowerBoundTimeStampMessage*>(&rhs);
+  const FederateSaveCompleteMessage* message = dynamic_cast<const FederateSaveCompleteMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-CommitLowerBoundTimeStampMessage::operator==(const CommitLowerBoundTimeStampMessage& rhs) const
+FederateSaveCompleteMessage::operator==(const FederateSaveCompleteMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getTimeStamp() != rhs.getTimeStamp()) return false;
-  if (getCommitType() != rhs.getCommitType()) return false;
-  if (getCommitId() != rhs.getCommitId()) return false;
+  if (getSuccessful() != rhs.getSuccessful()) return false;
+  if (getSaveFailureReason() != rhs.getSaveFailureReason()) return false;
   return true;
 }
 
 bool
-CommitLowerBoundTimeStampMessage::operator<(const CommitLowerBoundTimeStampMessage& rhs) const
+FederateSaveCompleteMessage::operator<(const FederateSaveCompleteMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getTimeStamp() < rhs.getTimeStamp()) return true;
-  if (rhs.getTimeStamp() < getTimeStamp()) return false;
-  if (getCommitType() < rhs.getCommitType()) return true;
-  if (rhs.getCommitType() < getCommitType()) return false;
-  if (getCommitId() < rhs.getCommitId()) return true;
-  if (rhs.getCommitId() < getCommitId()) return false;
+  if (getSuccessful() < rhs.getSuccessful()) return true;
+  if (rhs.getSuccessful() < getSuccessful()) return false;
+  if (getSaveFailureReason() < rhs.getSaveFailureReason()) return true;
+  if (rhs.getSaveFailureReason() < getSaveFailureReason()) return false;
   return false;
 }
 
-CommitLowerBoundTimeStampResponseMessage::CommitLowerBoundTimeStampResponseMessage() :
+FederationSavedMessage::FederationSavedMessage() :
   _federationHandle(),
-  _federateHandle(),
-  _sendingFederateHandle(),
-  _commitId()
+  _label(),
+  _successful(),
+  _saveFailureReason()
 {
 }
 
-CommitLowerBoundTimeStampResponseMessage::~CommitLowerBoundTimeStampResponseMessage()
+FederationSavedMessage::~FederationSavedMessage()
 {
 }
 
 const char*
-CommitLowerBoundTimeStampResponseMessage::getTypeName() const
+FederationSavedMessage::getTypeName() const
 {
-  return "CommitLowerBoundTimeStampResponseMessage";
+  return "FederationSavedMessage";
 }
 
 void
-CommitLowerBoundTimeStampResponseMessage::out(std::ostream& os) const
+FederationSavedMessage::out(std::ostream& os) const
 {
-  os << "CommitLowerBoundTimeStampResponseMessage " << *this;
+  os << "FederationSavedMessage " << *this;
 }
 
 void
-CommitLowerBoundTimeStampResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+FederationSavedMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-CommitLowerBoundTimeStampResponseMessage::operator==(const AbstractMessage& rhs) const
+FederationSavedMessage::operator==(const AbstractMessage& rhs) const
 {
-  const CommitLowerBoundTimeStampResponseMessage* message = dynamic_cast<const CommitLowerBoundTimeStampResponseMessage*>(&rhs);
+  const FederationSavedMessage* message = dynamic_cast<const FederationSavedMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-CommitLowerBoundTimeStampResponseMessage::operator==(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+FederationSavedMessage::operator==(const FederationSavedMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getSendingFederateHandle() != rhs.getSendingFederateHandle()) return false;
-  if (getCommitId() != rhs.getCommitId()) return false;
+  if (getLabel() != rhs.getLabel()) return false;
+  if (getSuccessful() != rhs.getSuccessful()) return false;
+  if (getSaveFailureReason() != rhs.getSaveFailureReason()) return false;
   return true;
 }
 
 bool
-CommitLowerBoundTimeStampResponseMessage::operator<(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+FederationSavedMessage::operator<(const FederationSavedMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getFederateHandle() < rhs.getFederateHandle()) return true;
-  if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getSendingFederateHandle() < rhs.getSendingFederateHandle()) return true;
-  if (rhs.getSendingFederateHandle() < getSendingFederateHandle()) return false;
-  if (getCommitId() < rhs.getCommitId()) return true;
-  if (rhs.getCommitId() < getCommitId()) return false;
+  if (getLabel() < rhs.getLabel()) return true;
+  if (rhs.getLabel() < getLabel()) return false;
+  if (getSuccessful() < rhs.getSuccessful()) return true;
+  if (rhs.getSuccessful() < getSuccessful()) return false;
+  if (getSaveFailureReason() < rhs.getSaveFailureReason()) return true;
+  if (rhs.getSaveFailureReason() < getSaveFailureReason()) return false;
   return false;
 }
 
-LockedByNextMessageRequestMessage::LockedByNextMessageRequestMessage() :
+AbortFederationSaveMessage::AbortFederationSaveMessage() :
   _federationHandle(),
-  _sendingFederateHandle(),
-  _lockedByNextMessage()
+  _federateHandle()
 {
 }
 
-LockedByNextMessageRequestMessage::~LockedByNextMessageRequestMessage()
+AbortFederationSaveMessage::~AbortFederationSaveMessage()
 {
 }
 
 const char*
-LockedByNextMessageRequestMessage::getTypeName() const
+AbortFederationSaveMessage::getTypeName() const
 {
-  return "LockedByNextMessageRequestMessage";
+  return "AbortFederationSaveMessage";
 }
 
 void
-LockedByNextMessageRequestMessage::out(std::ostream& os) const
+AbortFederationSaveMessage::out(std::ostream& os) const
 {
-  os << "LockedByNextMessageRequestMessage " << *this;
+  os << "AbortFederationSaveMessage " << *this;
 }
 
 void
-LockedByNextMessageRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+AbortFederationSaveMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-LockedByNextMessageRequestMessage::operator==(const AbstractMessage& rhs) const
+AbortFederationSaveMessage::operator==(const AbstractMessage& rhs) const
 {
-  const LockedByNextMessageRequestMessage* message = dynamic_cast<const LockedByNextMessageRequestMessage*>(&rhs);
+  const AbortFederationSaveMessage* message = dynamic_cast<const AbortFederationSaveMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-LockedByNextMessageRequestMessage::operator==(const LockedByNextMessageRequestMessage& rhs) const
+AbortFederationSaveMessage::operator==(const AbortFederationSaveMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getSendingFederateHandle() != rhs.getSendingFederateHandle()) return false;
-  if (getLockedByNextMessage() != rhs.getLockedByNextMessage()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
   return true;
 }
 
 bool
-LockedByNextMessageRequestMessage::operator<(const LockedByNextMessageRequestMessage& rhs) const
+AbortFederationSaveMessage::operator<(const AbortFederationSaveMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getSendingFederateHandle() < rhs.getSendingFederateHandle()) return true;
-  if (rhs.getSendingFederateHandle() < getSendingFederateHandle()) return false;
-  if (getLockedByNextMessage() < rhs.getLockedByNextMessage()) return true;
-  if (rhs.getLockedByNextMessage() < getLockedByNextMessage()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
   return false;
 }
 
-TimeConstrainedEnabledMessage::TimeConstrainedEnabledMessage()
+QueryFederationSaveStatusRequestMessage::QueryFederationSaveStatusRequestMessage() :
+  _federationHandle(),
+  _federateHandle()
 {
 }
 
-TimeConstrainedEnabledMessage::~TimeConstrainedEnabledMessage()
+QueryFederationSaveStatusRequestMessage::~QueryFederationSaveStatusRequestMessage()
 {
 }
 
 const char*
-TimeConstrainedEnabledMessage::getTypeName() const
+QueryFederationSaveStatusRequestMessage::getTypeName() const
 {
-  return "TimeConstrainedEnabledMessage";
+  return "QueryFederationSaveStatusRequestMessage";
 }
 
 void
-TimeConstrainedEnabledMessage::out(std::ostream& os) const
+QueryFederationSaveStatusRequestMessage::out(std::ostream& os) const
 {
-  os << "TimeConstrainedEnabledMessage " << *this;
+  os << "QueryFederationSaveStatusRequestMessage " << *this;
 }
 
 void
-TimeConstrainedEnabledMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+QueryFederationSaveStatusRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-TimeConstrainedEnabledMessage::operator==(const AbstractMessage& rhs) const
+QueryFederationSaveStatusRequestMessage::operator==(const AbstractMessage& rhs) const
 {
-  const TimeConstrainedEnabledMessage* message = dynamic_cast<const TimeConstrainedEnabledMessage*>(&rhs);
+  const QueryFederationSaveStatusRequestMessage* message = dynamic_cast<const QueryFederationSaveStatusRequestMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-TimeConstrainedEnabledMessage::operator==(const TimeConstrainedEnabledMessage& rhs) const
+QueryFederationSaveStatusRequestMessage::operator==(const QueryFederationSaveStatusRequestMessage& rhs) const
 {
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
   return true;
 }
 
 bool
-TimeConstrainedEnabledMessage::operator<(const TimeConstrainedEnabledMessage& rhs) const
+QueryFederationSaveStatusRequestMessage::operator<(const QueryFederationSaveStatusRequestMessage& rhs) const
 {
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
   return false;
 }
 
-TimeRegulationEnabledMessage::TimeRegulationEnabledMessage()
+QueryFederationSaveStatusResponseMessage::QueryFederationSaveStatusResponseMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _federateHandleSaveStatusPairVector()
 {
 }
 
-TimeRegulationEnabledMessage::~TimeRegulationEnabledMessage()
+QueryFederationSaveStatusResponseMessage::~QueryFederationSaveStatusResponseMessage()
 {
 }
 
 const char*
-TimeRegulationEnabledMessage::getTypeName() const
+QueryFederationSaveStatusResponseMessage::getTypeName() const
 {
-  return "TimeRegulationEnabledMessage";
+  return "QueryFederationSaveStatusResponseMessage";
 }
 
 void
-TimeRegulationEnabledMessage::out(std::ostream& os) const
+QueryFederationSaveStatusResponseMessage::out(std::ostream& os) const
 {
-  os << "TimeRegulationEnabledMessage " << *this;
+  os << "QueryFederationSaveStatusResponseMessage " << *this;
 }
 
 void
-TimeRegulationEnabledMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+QueryFederationSaveStatusResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-TimeRegulationEnabledMessage::operator==(const AbstractMessage& rhs) const
+QueryFederationSaveStatusResponseMessage::operator==(const AbstractMessage& rhs) const
 {
-  const TimeRegulationEnabledMessage* message = dynamic_cast<const TimeRegulationEnabledMessage*>(&rhs);
+  const QueryFederationSaveStatusResponseMessage* message = dynamic_cast<const QueryFederationSaveStatusResponseMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-TimeRegulationEnabledMessage::operator==(const TimeRegulationEnabledMessage& rhs) const
+QueryFederationSaveStatusResponseMessage::operator==(const QueryFederationSaveStatusResponseMessage& rhs) const
 {
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getFederateHandleSaveStatusPairVector() != rhs.getFederateHandleSaveStatusPairVector()) return false;
   return true;
 }
 
 bool
-TimeRegulationEnabledMessage::operator<(const TimeRegulationEnabledMessage& rhs) const
+QueryFederationSaveStatusResponseMessage::operator<(const QueryFederationSaveStatusResponseMessage& rhs) const
 {
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getFederateHandleSaveStatusPairVector() < rhs.getFederateHandleSaveStatusPairVector()) return true;
+  if (rhs.getFederateHandleSaveStatusPairVector() < getFederateHandleSaveStatusPairVector()) return false;
   return false;
 }
 
-TimeAdvanceGrantedMessage::TimeAdvanceGrantedMessage()
+RequestFederationRestoreMessage::RequestFederationRestoreMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _label()
 {
 }
 
-TimeAdvanceGrantedMessage::~TimeAdvanceGrantedMessage()
+RequestFederationRestoreMessage::~RequestFederationRestoreMessage()
 {
 }
 
 const char*
-TimeAdvanceGrantedMessage::getTypeName() const
+RequestFederationRestoreMessage::getTypeName() const
 {
-  return "TimeAdvanceGrantedMessage";
+  return "RequestFederationRestoreMessage";
 }
 
 void
-TimeAdvanceGrantedMessage::out(std::ostream& os) const
+RequestFederationRestoreMessage::out(std::ostream& os) const
 {
-  os << "TimeAdvanceGrantedMessage " << *this;
+  os << "RequestFederationRestoreMessage " << *this;
 }
 
 void
-TimeAdvanceGrantedMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+RequestFederationRestoreMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-TimeAdvanceGrantedMessage::operator==(const AbstractMessage& rhs) const
+RequestFederationRestoreMessage::operator==(const AbstractMessage& rhs) const
 {
-  const TimeAdvanceGrantedMessage* message = dynamic_cast<const TimeAdvanceGrantedMessage*>(&rhs);
+  const RequestFederationRestoreMessage* message = dynamic_cast<const RequestFederationRestoreMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-TimeAdvanceGrantedMessage::operator==(const TimeAdvanceGrantedMessage& rhs) const
+RequestFederationRestoreMessage::operator==(const RequestFederationRestoreMessage& rhs) const
 {
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getLabel() != rhs.getLabel()) return false;
   return true;
 }
 
 bool
-TimeAdvanceGrantedMessage::operator<(const TimeAdvanceGrantedMessage& rhs) const
+RequestFederationRestoreMessage::operator<(const RequestFederationRestoreMessage& rhs) const
 {
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getLabel() < rhs.getLabel()) return true;
+  if (rhs.getLabel() < getLabel()) return false;
   return false;
 }
 
-InsertRegionMessage::InsertRegionMessage() :
+RequestFederationRestoreResponseMessage::RequestFederationRestoreResponseMessage() :
   _federationHandle(),
-  _regionHandleDimensionHandleSetPairVector()
+  _federateHandle(),
+  _label(),
+  _successful()
 {
 }
 
-InsertRegionMessage::~InsertRegionMessage()
+RequestFederationRestoreResponseMessage::~RequestFederationRestoreResponseMessage()
 {
 }
 
 const char*
-InsertRegionMessage::getTypeName() const
+RequestFederationRestoreResponseMessage::getTypeName() const
 {
-  return "InsertRegionMessage";
+  return "RequestFederationRestoreResponseMessage";
 }
 
 void
-InsertRegionMessage::out(std::ostream& os) const
+RequestFederationRestoreResponseMessage::out(std::ostream& os) const
 {
-  os << "InsertRegionMessage " << *this;
+  os << "RequestFederationRestoreResponseMessage " << *this;
 }
 
 void
-InsertRegionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+RequestFederationRestoreResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-InsertRegionMessage::operator==(const AbstractMessage& rhs) const
+RequestFederationRestoreResponseMessage::operator==(const AbstractMessage& rhs) const
 {
-  const InsertRegionMessage* message = dynamic_cast<const InsertRegionMessage*>(&rhs);
+  const RequestFederationRestoreResponseMessage* message = dynamic_cast<const RequestFederationRestoreResponseMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-InsertRegionMessage::operator==(const InsertRegionMessage& rhs) const
+RequestFederationRestoreResponseMessage::operator==(const RequestFederationRestoreResponseMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getRegionHandleDimensionHandleSetPairVector() != rhs.getRegionHandleDimensionHandleSetPairVector()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getLabel() != rhs.getLabel()) return false;
+  if (getSuccessful() != rhs.getSuccessful()) return false;
   return true;
 }
 
 bool
-InsertRegionMessage::operator<(const InsertRegionMessage& rhs) const
+RequestFederationRestoreResponseMessage::operator<(const RequestFederationRestoreResponseMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getRegionHandleDimensionHandleSetPairVector() < rhs.getRegionHandleDimensionHandleSetPairVector()) return true;
-  if (rhs.getRegionHandleDimensionHandleSetPairVector() < getRegionHandleDimensionHandleSetPairVector()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getLabel() < rhs.getLabel()) return true;
+  if (rhs.getLabel() < getLabel()) return false;
+  if (getSuccessful() < rhs.getSuccessful()) return true;
+  if (rhs.getSuccessful() < getSuccessful()) return false;
   return false;
 }
 
-CommitRegionMessage::CommitRegionMessage() :
+FederationRestoreBegunMessage::FederationRestoreBegunMessage() :
   _federationHandle(),
-  _regionHandleRegionValuePairVector()
+  _label()
 {
 }
 
-CommitRegionMessage::~CommitRegionMessage()
+FederationRestoreBegunMessage::~FederationRestoreBegunMessage()
 {
 }
 
 const char*
-CommitRegionMessage::getTypeName() const
+FederationRestoreBegunMessage::getTypeName() const
 {
-  return "CommitRegionMessage";
+  return "FederationRestoreBegunMessage";
 }
 
 void
-CommitRegionMessage::out(std::ostream& os) const
+FederationRestoreBegunMessage::out(std::ostream& os) const
 {
-  os << "CommitRegionMessage " << *this;
+  os << "FederationRestoreBegunMessage " << *this;
 }
 
 void
-CommitRegionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+FederationRestoreBegunMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-CommitRegionMessage::operator==(const AbstractMessage& rhs) const
+FederationRestoreBegunMessage::operator==(const AbstractMessage& rhs) const
 {
-  const CommitRegionMessage* message = dynamic_cast<const CommitRegionMessage*>(&rhs);
+  const FederationRestoreBegunMessage* message = dynamic_cast<const FederationRestoreBegunMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-CommitRegionMessage::operator==(const CommitRegionMessage& rhs) const
+FederationRestoreBegunMessage::operator==(const FederationRestoreBegunMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getRegionHandleRegionValuePairVector() != rhs.getRegionHandleRegionValuePairVector()) return false;
+  if (getLabel() != rhs.getLabel()) return false;
   return true;
 }
 
 bool
-CommitRegionMessage::operator<(const CommitRegionMessage& rhs) const
+FederationRestoreBegunMessage::operator<(const FederationRestoreBegunMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getRegionHandleRegionValuePairVector() < rhs.getRegionHandleRegionValuePairVector()) return true;
-  if (rhs.getRegionHandleRegionValuePairVector() < getRegionHandleRegionValuePairVector()) return false;
+  if (getLabel() < rhs.getLabel()) return true;
+  if (rhs.getLabel() < getLabel()) return false;
   return false;
 }
 
-EraseRegionMessage::EraseRegionMessage() :
+InitiateFederateRestoreMessage::InitiateFederateRestoreMessage() :
   _federationHandle(),
-  _regionHandleVector()
+  _federateHandle(),
+  _label(),
+  _federateName()
 {
 }
 
-EraseRegionMessage::~EraseRegionMessage()
+InitiateFederateRestoreMessage::~InitiateFederateRestoreMessage()
 {
 }
 
 const char*
-EraseRegionMessage::getTypeName() const
+InitiateFederateRestoreMessage::getTypeName() const
 {
-  return "EraseRegionMessage";
+  return "InitiateFederateRestoreMessage";
 }
 
 void
-EraseRegionMessage::out(std::ostream& os) const
+InitiateFederateRestoreMessage::out(std::ostream& os) const
 {
-  os << "EraseRegionMessage " << *this;
+  os << "InitiateFederateRestoreMessage " << *this;
 }
 
 void
-EraseRegionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+InitiateFederateRestoreMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-EraseRegionMessage::operator==(const AbstractMessage& rhs) const
+InitiateFederateRestoreMessage::operator==(const AbstractMessage& rhs) const
 {
-  const EraseRegionMessage* message = dynamic_cast<const EraseRegionMessage*>(&rhs);
+  const InitiateFederateRestoreMessage* message = dynamic_cast<const InitiateFederateRestoreMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-EraseRegionMessage::operator==(const EraseRegionMessage& rhs) const
+InitiateFederateRestoreMessage::operator==(const InitiateFederateRestoreMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getRegionHandleVector() != rhs.getRegionHandleVector()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getLabel() != rhs.getLabel()) return false;
+  if (getFederateName() != rhs.getFederateName()) return false;
   return true;
 }
 
 bool
-EraseRegionMessage::operator<(const EraseRegionMessage& rhs) const
+InitiateFederateRestoreMessage::operator<(const InitiateFederateRestoreMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getRegionHandleVector() < rhs.getRegionHandleVector()) return true;
-  if (rhs.getRegionHandleVector() < getRegionHandleVector()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getLabel() < rhs.getLabel()) return true;
+  if (rhs.getLabel() < getLabel()) return false;
+  if (getFederateName() < rhs.getFederateName()) return true;
+  if (rhs.getFederateName() < getFederateName()) return false;
   return false;
 }
 
-ChangeInteractionClassPublicationMessage::ChangeInteractionClassPublicationMessage() :
+FederateRestoreCompleteMessage::FederateRestoreCompleteMessage() :
   _federationHandle(),
-  _publicationType(),
-  _interactionClassHandle()
+  _federateHandle(),
+  _successful()
 {
 }
 
-ChangeInteractionClassPublicationMessage::~ChangeInteractionClassPublicationMessage()
+FederateRestoreCompleteMessage::~FederateRestoreCompleteMessage()
 {
 }
 
 const char*
-ChangeInteractionClassPublicationMessage::getTypeName() const
+FederateRestoreCompleteMessage::getTypeName() const
 {
-  return "ChangeInteractionClassPublicationMessage";
+  return "FederateRestoreCompleteMessage";
 }
 
 void
-ChangeInteractionClassPublicationMessage::out(std::ostream& os) const
+FederateRestoreCompleteMessage::out(std::ostream& os) const
 {
-  os << "ChangeInteractionClassPublicationMessage " << *this;
+  os << "FederateRestoreCompleteMessage " << *this;
 }
 
 void
-ChangeInteractionClassPublicationMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+FederateRestoreCompleteMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ChangeInteractionClassPublicationMessage::operator==(const AbstractMessage& rhs) const
+FederateRestoreCompleteMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ChangeInteractionClassPublicationMessage* message = dynamic_cast<const ChangeInteractionClassPublicationMessage*>(&rhs);
+  const FederateRestoreCompleteMessage* message = dynamic_cast<const FederateRestoreCompleteMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ChangeInteractionClassPublicationMessage::operator==(const ChangeInteractionClassPublicationMessage& rhs) const
+FederateRestoreCompleteMessage::operator==(const FederateRestoreCompleteMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getPublicationType() != rhs.getPublicationType()) return false;
-  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getSuccessful() != rhs.getSuccessful()) return false;
   return true;
 }
 
 bool
-ChangeInteractionClassPublicationMessage::operator<(const ChangeInteractionClassPublicationMessage& rhs) const
+FederateRestoreCompleteMessage::operator<(const FederateRestoreCompleteMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getPublicationType() < rhs.getPublicationType()) return true;
-  if (rhs.getPublicationType() < getPublicationType()) return false;
-  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
-  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getSuccessful() < rhs.getSuccessful()) return true;
+  if (rhs.getSuccessful() < getSuccessful()) return false;
   return false;
 }
 
-ChangeObjectClassPublicationMessage::ChangeObjectClassPublicationMessage() :
+FederationRestoredMessage::FederationRestoredMessage() :
   _federationHandle(),
-  _publicationType(),
-  _objectClassHandle(),
-  _attributeHandles()
+  _label(),
+  _successful(),
+  _restoreFailureReason()
 {
 }
 
-ChangeObjectClassPublicationMessage::~ChangeObjectClassPublicationMessage()
+FederationRestoredMessage::~FederationRestoredMessage()
 {
 }
 
 const char*
-ChangeObjectClassPublicationMessage::getTypeName() const
+FederationRestoredMessage::getTypeName() const
 {
-  return "ChangeObjectClassPublicationMessage";
+  return "FederationRestoredMessage";
 }
 
 void
-ChangeObjectClassPublicationMessage::out(std::ostream& os) const
+FederationRestoredMessage::out(std::ostream& os) const
 {
-  os << "ChangeObjectClassPublicationMessage " << *this;
+  os << "FederationRestoredMessage " << *this;
 }
 
 void
-ChangeObjectClassPublicationMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+FederationRestoredMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ChangeObjectClassPublicationMessage::operator==(const AbstractMessage& rhs) const
+FederationRestoredMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ChangeObjectClassPublicationMessage* message = dynamic_cast<const ChangeObjectClassPublicationMessage*>(&rhs);
+  const FederationRestoredMessage* message = dynamic_cast<const FederationRestoredMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ChangeObjectClassPublicationMessage::operator==(const ChangeObjectClassPublicationMessage& rhs) const
+FederationRestoredMessage::operator==(const FederationRestoredMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getPublicationType() != rhs.getPublicationType()) return false;
-  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
-  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getLabel() != rhs.getLabel()) return false;
+  if (getSuccessful() != rhs.getSuccessful()) return false;
+  if (getRestoreFailureReason() != rhs.getRestoreFailureReason()) return false;
   return true;
 }
 
 bool
-ChangeObjectClassPublicationMessage::operator<(const ChangeObjectClassPublicationMessage& rhs) const
+FederationRestoredMessage::operator<(const FederationRestoredMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getPublicationType() < rhs.getPublicationType()) return true;
-  if (rhs.getPublicationType() < getPublicationType()) return false;
-  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
-  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
-  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
-  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getLabel() < rhs.getLabel()) return true;
+  if (rhs.getLabel() < getLabel()) return false;
+  if (getSuccessful() < rhs.getSuccessful()) return true;
+  if (rhs.getSuccessful() < getSuccessful()) return false;
+  if (getRestoreFailureReason() < rhs.getRestoreFailureReason()) return true;
+  if (rhs.getRestoreFailureReason() < getRestoreFailureReason()) return false;
   return false;
 }
 
-ChangeInteractionClassSubscriptionMessage::ChangeInteractionClassSubscriptionMessage() :
+AbortFederationRestoreMessage::AbortFederationRestoreMessage() :
   _federationHandle(),
-  _subscriptionType(),
-  _interactionClassHandle()
+  _federateHandle()
 {
 }
 
-ChangeInteractionClassSubscriptionMessage::~ChangeInteractionClassSubscriptionMessage()
+AbortFederationRestoreMessage::~AbortFederationRestoreMessage()
 {
 }
 
 const char*
-ChangeInteractionClassSubscriptionMessage::getTypeName() const
+AbortFederationRestoreMessage::getTypeName() const
 {
-  return "ChangeInteractionClassSubscriptionMessage";
+  return "AbortFederationRestoreMessage";
 }
 
 void
-ChangeInteractionClassSubscriptionMessage::out(std::ostream& os) const
+AbortFederationRestoreMessage::out(std::ostream& os) const
 {
-  os << "ChangeInteractionClassSubscriptionMessage " << *this;
+  os << "AbortFederationRestoreMessage " << *this;
 }
 
 void
-ChangeInteractionClassSubscriptionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+AbortFederationRestoreMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ChangeInteractionClassSubscriptionMessage::operator==(const AbstractMessage& rhs) const
+AbortFederationRestoreMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ChangeInteractionClassSubscriptionMessage* message = dynamic_cast<const ChangeInteractionClassSubscriptionMessage*>(&rhs);
+  const AbortFederationRestoreMessage* message = dynamic_cast<const AbortFederationRestoreMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ChangeInteractionClassSubscriptionMessage::operator==(const ChangeInteractionClassSubscriptionMessage& rhs) const
+AbortFederationRestoreMessage::operator==(const AbortFederationRestoreMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getSubscriptionType() != rhs.getSubscriptionType()) return false;
-  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
   return true;
 }
 
 bool
-ChangeInteractionClassSubscriptionMessage::operator<(const ChangeInteractionClassSubscriptionMessage& rhs) const
+AbortFederationRestoreMessage::operator<(const AbortFederationRestoreMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getSubscriptionType() < rhs.getSubscriptionType()) return true;
-  if (rhs.getSubscriptionType() < getSubscriptionType()) return false;
-  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
-  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
   return false;
 }
 
-ChangeObjectClassSubscriptionMessage::ChangeObjectClassSubscriptionMessage() :
+QueryFederationRestoreStatusRequestMessage::QueryFederationRestoreStatusRequestMessage() :
   _federationHandle(),
-  _subscriptionType(),
-  _objectClassHandle(),
-  _attributeHandles()
+  _federateHandle()
 {
 }
 
-ChangeObjectClassSubscriptionMessage::~ChangeObjectClassSubscriptionMessage()
+QueryFederationRestoreStatusRequestMessage::~QueryFederationRestoreStatusRequestMessage()
 {
 }
 
 const char*
-ChangeObjectClassSubscriptionMessage::getTypeName() const
+QueryFederationRestoreStatusRequestMessage::getTypeName() const
 {
-  return "ChangeObjectClassSubscriptionMessage";
+  return "QueryFederationRestoreStatusRequestMessage";
 }
 
 void
-ChangeObjectClassSubscriptionMessage::out(std::ostream& os) const
+QueryFederationRestoreStatusRequestMessage::out(std::ostream& os) const
 {
-  os << "ChangeObjectClassSubscriptionMessage " << *this;
+  os << "QueryFederationRestoreStatusRequestMessage " << *this;
 }
 
 void
-ChangeObjectClassSubscriptionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+QueryFederationRestoreStatusRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ChangeObjectClassSubscriptionMessage::operator==(const AbstractMessage& rhs) const
+QueryFederationRestoreStatusRequestMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ChangeObjectClassSubscriptionMessage* message = dynamic_cast<const ChangeObjectClassSubscriptionMessage*>(&rhs);
+  const QueryFederationRestoreStatusRequestMessage* message = dynamic_cast<const QueryFederationRestoreStatusRequestMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ChangeObjectClassSubscriptionMessage::operator==(const ChangeObjectClassSubscriptionMessage& rhs) const
+QueryFederationRestoreStatusRequestMessage::operator==(const QueryFederationRestoreStatusRequestMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getSubscriptionType() != rhs.getSubscriptionType()) return false;
-  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
-  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
   return true;
 }
 
 bool
-ChangeObjectClassSubscriptionMessage::operator<(const ChangeObjectClassSubscriptionMessage& rhs) const
+QueryFederationRestoreStatusRequestMessage::operator<(const QueryFederationRestoreStatusRequestMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getSubscriptionType() < rhs.getSubscriptionType()) return true;
-  if (rhs.getSubscriptionType() < getSubscriptionType()) return false;
-  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
-  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
-  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
-  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
   return false;
 }
 
-RegistrationForObjectClassMessage::RegistrationForObjectClassMessage() :
-  _objectClassHandle(),
-  _start()
+QueryFederationRestoreStatusResponseMessage::QueryFederationRestoreStatusResponseMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _federateHandleRestoreStatusPairVector()
 {
 }
 
-RegistrationForObjectClassMessage::~RegistrationForObjectClassMessage()
+QueryFederationRestoreStatusResponseMessage::~QueryFederationRestoreStatusResponseMessage()
 {
 }
 
 const char*
-RegistrationForObjectClassMessage::getTypeName() const
+QueryFederationRestoreStatusResponseMessage::getTypeName() const
 {
-  return "RegistrationForObjectClassMessage";
+  return "QueryFederationRestoreStatusResponseMessage";
 }
 
 void
-RegistrationForObjectClassMessage::out(std::ostream& os) const
+QueryFederationRestoreStatusResponseMessage::out(std::ostream& os) const
 {
-  os << "RegistrationForObjectClassMessage " << *this;
+  os << "QueryFederationRestoreStatusResponseMessage " << *this;
 }
 
 void
-RegistrationForObjectClassMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+QueryFederationRestoreStatusResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-RegistrationForObjectClassMessage::operator==(const AbstractMessage& rhs) const
+QueryFederationRestoreStatusResponseMessage::operator==(const AbstractMessage& rhs) const
 {
-  const RegistrationForObjectClassMessage* message = dynamic_cast<const RegistrationForObjectClassMessage*>(&rhs);
+  const QueryFederationRestoreStatusResponseMessage* message = dynamic_cast<const QueryFederationRestoreStatusResponseMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-RegistrationForObjectClassMessage::operator==(const RegistrationForObjectClassMessage& rhs) const
+QueryFederationRestoreStatusResponseMessage::operator==(const QueryFederationRestoreStatusResponseMessage& rhs) const
 {
-  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
-  if (getStart() != rhs.getStart()) return false;
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getFederateHandleRestoreStatusPairVector() != rhs.getFederateHandleRestoreStatusPairVector()) return false;
   return true;
 }
 
 bool
-RegistrationForObjectClassMessage::operator<(const RegistrationForObjectClassMessage& rhs) const
+QueryFederationRestoreStatusResponseMessage::operator<(const QueryFederationRestoreStatusResponseMessage& rhs) const
 {
-  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
-  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
-  if (getStart() < rhs.getStart()) return true;
-  if (rhs.getStart() < getStart()) return false;
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getFederateHandleRestoreStatusPairVector() < rhs.getFederateHandleRestoreStatusPairVector()) return true;
+  if (rhs.getFederateHandleRestoreStatusPairVector() < getFederateHandleRestoreStatusPairVector()) return false;
   return false;
 }
 
-AttributesInScopeMessage::AttributesInScopeMessage() :
-  _objectInstanceHandle(),
-  _attributeHandles(),
-  _inScope()
+EnableTimeRegulationRequestMessage::EnableTimeRegulationRequestMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _timeStamp(),
+  _commitId()
 {
 }
 
-AttributesInScopeMessage::~AttributesInScopeMessage()
+EnableTimeRegulationRequestMessage::~EnableTimeRegulationRequestMessage()
 {
 }
 
 const char*
-AttributesInScopeMessage::getTypeName() const
+EnableTimeRegulationRequestMessage::getTypeName() const
 {
-  return "AttributesInScopeMessage";
+  return "EnableTimeRegulationRequestMessage";
 }
 
 void
-AttributesInScopeMessage::out(std::ostream& os) const
+EnableTimeRegulationRequestMessage::out(std::ostream& os) const
 {
-  os << "AttributesInScopeMessage " << *this;
+  os << "EnableTimeRegulationRequestMessage " << *this;
 }
 
 void
-AttributesInScopeMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+EnableTimeRegulationRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-AttributesInScopeMessage::operator==(const AbstractMessage& rhs) const
+EnableTimeRegulationRequestMessage::operator==(const AbstractMessage& rhs) const
 {
-  const AttributesInScopeMessage* message = dynamic_cast<const AttributesInScopeMessage*>(&rhs);
+  const EnableTimeRegulationRequestMessage* message = dynamic_cast<const EnableTimeRegulationRequestMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-AttributesInScopeMessage::operator==(const AttributesInScopeMessage& rhs) const
+EnableTimeRegulationRequestMessage::operator==(const EnableTimeRegulationRequestMessage& rhs) const
 {
-  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
-  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
-  if (getInScope() != rhs.getInScope()) return false;
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getTimeStamp() != rhs.getTimeStamp()) return false;
+  if (getCommitId() != rhs.getCommitId()) return false;
   return true;
 }
 
 bool
-AttributesInScopeMessage::operator<(const AttributesInScopeMessage& rhs) const
+EnableTimeRegulationRequestMessage::operator<(const EnableTimeRegulationRequestMessage& rhs) const
 {
-  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
-  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
-  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
-  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
-  if (getInScope() < rhs.getInScope()) return true;
-  if (rhs.getInScope() < getInScope()) return false;
-  return false;
-}
-
-ObjectInstanceHandle
-AttributesInScopeMessage::getObjectInstanceHandleForMessage() const
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getTimeStamp() < rhs.getTimeStamp()) return true;
+  if (rhs.getTimeStamp() < getTimeStamp()) return false;
+  if (getCommitId() < rhs.getCommitId()) return true;
+  if (rhs.getCommitId() < getCommitId()) return false;
+  return false;
+}
+
+EnableTimeRegulationResponseMessage::EnableTimeRegulationResponseMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _respondingFederateHandle(),
+  _timeStampValid(),
+  _timeStamp()
+{
+}
+
+EnableTimeRegulationResponseMessage::~EnableTimeRegulationResponseMessage()
+{
+}
+
+const char*
+EnableTimeRegulationResponseMessage::getTypeName() const
+{
+  return "EnableTimeRegulationResponseMessage";
+}
+
+void
+EnableTimeRegulationResponseMessage::out(std::ostream& os) const
+{
+  os << "EnableTimeRegulationResponseMessage " << *this;
+}
+
+void
+EnableTimeRegulationResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+EnableTimeRegulationResponseMessage::operator==(const AbstractMessage& rhs) const
+{
+  const EnableTimeRegulationResponseMessage* message = dynamic_cast<const EnableTimeRegulationResponseMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+EnableTimeRegulationResponseMessage::operator==(const EnableTimeRegulationResponseMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getRespondingFederateHandle() != rhs.getRespondingFederateHandle()) return false;
+  if (getTimeStampValid() != rhs.getTimeStampValid()) return false;
+  if (getTimeStamp() != rhs.getTimeStamp()) return false;
+  return true;
+}
+
+bool
+EnableTimeRegulationResponseMessage::operator<(const EnableTimeRegulationResponseMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getRespondingFederateHandle() < rhs.getRespondingFederateHandle()) return true;
+  if (rhs.getRespondingFederateHandle() < getRespondingFederateHandle()) return false;
+  if (getTimeStampValid() < rhs.getTimeStampValid()) return true;
+  if (rhs.getTimeStampValid() < getTimeStampValid()) return false;
+  if (getTimeStamp() < rhs.getTimeStamp()) return true;
+  if (rhs.getTimeStamp() < getTimeStamp()) return false;
+  return false;
+}
+
+DisableTimeRegulationRequestMessage::DisableTimeRegulationRequestMessage() :
+  _federationHandle(),
+  _federateHandle()
+{
+}
+
+DisableTimeRegulationRequestMessage::~DisableTimeRegulationRequestMessage()
+{
+}
+
+const char*
+DisableTimeRegulationRequestMessage::getTypeName() const
+{
+  return "DisableTimeRegulationRequestMessage";
+}
+
+void
+DisableTimeRegulationRequestMessage::out(std::ostream& os) const
+{
+  os << "DisableTimeRegulationRequestMessage " << *this;
+}
+
+void
+DisableTimeRegulationRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+DisableTimeRegulationRequestMessage::operator==(const AbstractMessage& rhs) const
+{
+  const DisableTimeRegulationRequestMessage* message = dynamic_cast<const DisableTimeRegulationRequestMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+DisableTimeRegulationRequestMessage::operator==(const DisableTimeRegulationRequestMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  return true;
+}
+
+bool
+DisableTimeRegulationRequestMessage::operator<(const DisableTimeRegulationRequestMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  return false;
+}
+
+CommitLowerBoundTimeStampMessage::CommitLowerBoundTimeStampMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _timeStamp(),
+  _commitType(),
+  _commitId()
+{
+}
+
+CommitLowerBoundTimeStampMessage::~CommitLowerBoundTimeStampMessage()
+{
+}
+
+const char*
+CommitLowerBoundTimeStampMessage::getTypeName() const
+{
+  return "CommitLowerBoundTimeStampMessage";
+}
+
+void
+CommitLowerBoundTimeStampMessage::out(std::ostream& os) const
+{
+  os << "CommitLowerBoundTimeStampMessage " << *this;
+}
+
+void
+CommitLowerBoundTimeStampMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+CommitLowerBoundTimeStampMessage::operator==(const AbstractMessage& rhs) const
+{
+  const CommitLowerBoundTimeStampMessage* message = dynamic_cast<const CommitLowerBoundTimeStampMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+CommitLowerBoundTimeStampMessage::operator==(const CommitLowerBoundTimeStampMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getTimeStamp() != rhs.getTimeStamp()) return false;
+  if (getCommitType() != rhs.getCommitType()) return false;
+  if (getCommitId() != rhs.getCommitId()) return false;
+  return true;
+}
+
+bool
+CommitLowerBoundTimeStampMessage::operator<(const CommitLowerBoundTimeStampMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getTimeStamp() < rhs.getTimeStamp()) return true;
+  if (rhs.getTimeStamp() < getTimeStamp()) return false;
+  if (getCommitType() < rhs.getCommitType()) return true;
+  if (rhs.getCommitType() < getCommitType()) return false;
+  if (getCommitId() < rhs.getCommitId()) return true;
+  if (rhs.getCommitId() < getCommitId()) return false;
+  return false;
+}
+
+AbstractMessage::Priority
+CommitLowerBoundTimeStampMessage::getPriority() const
+{
+  return ControlPriority;
+}
+
+CollectedCommitLowerBoundTimeStampMessage::CollectedCommitLowerBoundTimeStampMessage() :
+  _federationHandle(),
+  _timeStamp(),
+  _commitType(),
+  _federateHandleCommitIdPairVector()
+{
+}
+
+CollectedCommitLowerBoundTimeStampMessage::~CollectedCommitLowerBoundTimeStampMessage()
+{
+}
+
+const char*
+CollectedCommitLowerBoundTimeStampMessage::getTypeName() const
+{
+  return "CollectedCommitLowerBoundTimeStampMessage";
+}
+
+void
+CollectedCommitLowerBoundTimeStampMessage::out(std::ostream& os) const
+{
+  os << "CollectedCommitLowerBoundTimeStampMessage " << *this;
+}
+
+void
+CollectedCommitLowerBoundTimeStampMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+CollectedCommitLowerBoundTimeStampMessage::operator==(const AbstractMessage& rhs) const
+{
+  const CollectedCommitLowerBoundTimeStampMessage* message = dynamic_cast<const CollectedCommitLowerBoundTimeStampMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+CollectedCommitLowerBoundTimeStampMessage::operator==(const CollectedCommitLowerBoundTimeStampMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getTimeStamp() != rhs.getTimeStamp()) return false;
+  if (getCommitType() != rhs.getCommitType()) return false;
+  if (getFederateHandleCommitIdPairVector() != rhs.getFederateHandleCommitIdPairVector()) return false;
+  return true;
+}
+
+bool
+CollectedCommitLowerBoundTimeStampMessage::operator<(const CollectedCommitLowerBoundTimeStampMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getTimeStamp() < rhs.getTimeStamp()) return true;
+  if (rhs.getTimeStamp() < getTimeStamp()) return false;
+  if (getCommitType() < rhs.getCommitType()) return true;
+  if (rhs.getCommitType() < getCommitType()) return false;
+  if (getFederateHandleCommitIdPairVector() < rhs.getFederateHandleCommitIdPairVector()) return true;
+  if (rhs.getFederateHandleCommitIdPairVector() < getFederateHandleCommitIdPairVector()) return false;
+  return false;
+}
+
+AbstractMessage::Priority
+CollectedCommitLowerBoundTimeStampMessage::getPriority() const
+{
+  return ControlPriority;
+}
+
+CommitLowerBoundTimeStampResponseMessage::CommitLowerBoundTimeStampResponseMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _sendingFederateHandle(),
+  _commitId()
+{
+}
+
+CommitLowerBoundTimeStampResponseMessage::~CommitLowerBoundTimeStampResponseMessage()
+{
+}
+
+const char*
+CommitLowerBoundTimeStampResponseMessage::getTypeName() const
+{
+  return "CommitLowerBoundTimeStampResponseMessage";
+}
+
+void
+CommitLowerBoundTimeStampResponseMessage::out(std::ostream& os) const
+{
+  os << "CommitLowerBoundTimeStampResponseMessage " << *this;
+}
+
+void
+CommitLowerBoundTimeStampResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+CommitLowerBoundTimeStampResponseMessage::operator==(const AbstractMessage& rhs) const
+{
+  const CommitLowerBoundTimeStampResponseMessage* message = dynamic_cast<const CommitLowerBoundTimeStampResponseMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+CommitLowerBoundTimeStampResponseMessage::operator==(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getSendingFederateHandle() != rhs.getSendingFederateHandle()) return false;
+  if (getCommitId() != rhs.getCommitId()) return false;
+  return true;
+}
+
+bool
+CommitLowerBoundTimeStampResponseMessage::operator<(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getSendingFederateHandle() < rhs.getSendingFederateHandle()) return true;
+  if (rhs.getSendingFederateHandle() < getSendingFederateHandle()) return false;
+  if (getCommitId() < rhs.getCommitId()) return true;
+  if (rhs.getCommitId() < getCommitId()) return false;
+  return false;
+}
+
+AbstractMessage::Priority
+CommitLowerBoundTimeStampResponseMessage::getPriority() const
+{
+  return ControlPriority;
+}
+
+LockedByNextMessageRequestMessage::LockedByNextMessageRequestMessage() :
+  _federationHandle(),
+  _sendingFederateHandle(),
+  _lockedByNextMessage()
+{
+}
+
+LockedByNextMessageRequestMessage::~LockedByNextMessageRequestMessage()
+{
+}
+
+const char*
+LockedByNextMessageRequestMessage::getTypeName() const
+{
+  return "LockedByNextMessageRequestMessage";
+}
+
+void
+LockedByNextMessageRequestMessage::out(std::ostream& os) const
+{
+  os << "LockedByNextMessageRequestMessage " << *this;
+}
+
+void
+LockedByNextMessageRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+LockedByNextMessageRequestMessage::operator==(const AbstractMessage& rhs) const
+{
+  const LockedByNextMessageRequestMessage* message = dynamic_cast<const LockedByNextMessageRequestMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+LockedByNextMessageRequestMessage::operator==(const LockedByNextMessageRequestMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getSendingFederateHandle() != rhs.getSendingFederateHandle()) return false;
+  if (getLockedByNextMessage() != rhs.getLockedByNextMessage()) return false;
+  return true;
+}
+
+bool
+LockedByNextMessageRequestMessage::operator<(const LockedByNextMessageRequestMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getSendingFederateHandle() < rhs.getSendingFederateHandle()) return true;
+  if (rhs.getSendingFederateHandle() < getSendingFederateHandle()) return false;
+  if (getLockedByNextMessage() < rhs.getLockedByNextMessage()) return true;
+  if (rhs.getLockedByNextMessage() < getLockedByNextMessage()) return false;
+  return false;
+}
+
+AbstractMessage::Priority
+LockedByNextMessageRequestMessage::getPriority() const
+{
+  return ControlPriority;
+}
+
+TimeConstrainedEnabledMessage::TimeConstrainedEnabledMessage()
+{
+}
+
+TimeConstrainedEnabledMessage::~TimeConstrainedEnabledMessage()
+{
+}
+
+const char*
+TimeConstrainedEnabledMessage::getTypeName() const
+{
+  return "TimeConstrainedEnabledMessage";
+}
+
+void
+TimeConstrainedEnabledMessage::out(std::ostream& os) const
+{
+  os << "TimeConstrainedEnabledMessage " << *this;
+}
+
+void
+TimeConstrainedEnabledMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+TimeConstrainedEnabledMessage::operator==(const AbstractMessage& rhs) const
+{
+  const TimeConstrainedEnabledMessage* message = dynamic_cast<const TimeConstrainedEnabledMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+TimeConstrainedEnabledMessage::operator==(const TimeConstrainedEnabledMessage& rhs) const
+{
+  return true;
+}
+
+bool
+TimeConstrainedEnabledMessage::operator<(const TimeConstrainedEnabledMessage& rhs) const
+{
+  return false;
+}
+
+TimeRegulationEnabledMessage::TimeRegulationEnabledMessage()
+{
+}
+
+TimeRegulationEnabledMessage::~TimeRegulationEnabledMessage()
+{
+}
+
+const char*
+TimeRegulationEnabledMessage::getTypeName() const
+{
+  return "TimeRegulationEnabledMessage";
+}
+
+void
+TimeRegulationEnabledMessage::out(std::ostream& os) const
+{
+  os << "TimeRegulationEnabledMessage " << *this;
+}
+
+void
+TimeRegulationEnabledMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+TimeRegulationEnabledMessage::operator==(const AbstractMessage& rhs) const
+{
+  const TimeRegulationEnabledMessage* message = dynamic_cast<const TimeRegulationEnabledMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+TimeRegulationEnabledMessage::operator==(const TimeRegulationEnabledMessage& rhs) const
+{
+  return true;
+}
+
+bool
+TimeRegulationEnabledMessage::operator<(const TimeRegulationEnabledMessage& rhs) const
+{
+  return false;
+}
+
+TimeAdvanceGrantedMessage::TimeAdvanceGrantedMessage()
+{
+}
+
+TimeAdvanceGrantedMessage::~TimeAdvanceGrantedMessage()
+{
+}
+
+const char*
+TimeAdvanceGrantedMessage::getTypeName() const
+{
+  return "TimeAdvanceGrantedMessage";
+}
+
+void
+TimeAdvanceGrantedMessage::out(std::ostream& os) const
+{
+  os << "TimeAdvanceGrantedMessage " << *this;
+}
+
+void
+TimeAdvanceGrantedMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+TimeAdvanceGrantedMessage::operator==(const AbstractMessage& rhs) const
+{
+  const TimeAdvanceGrantedMessage* message = dynamic_cast<const TimeAdvanceGrantedMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+TimeAdvanceGrantedMessage::operator==(const TimeAdvanceGrantedMessage& rhs) const
+{
+  return true;
+}
+
+bool
+TimeAdvanceGrantedMessage::operator<(const TimeAdvanceGrantedMessage& rhs) const
+{
+  return false;
+}
+
+InsertRegionMessage::InsertRegionMessage() :
+  _federationHandle(),
+  _regionHandleDimensionHandleSetPairVector()
+{
+}
+
+InsertRegionMessage::~InsertRegionMessage()
+{
+}
+
+const char*
+InsertRegionMessage::getTypeName() const
+{
+  return "InsertRegionMessage";
+}
+
+void
+InsertRegionMessage::out(std::ostream& os) const
+{
+  os << "InsertRegionMessage " << *this;
+}
+
+void
+InsertRegionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+InsertRegionMessage::operator==(const AbstractMessage& rhs) const
+{
+  const InsertRegionMessage* message = dynamic_cast<const InsertRegionMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+InsertRegionMessage::operator==(const InsertRegionMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getRegionHandleDimensionHandleSetPairVector() != rhs.getRegionHandleDimensionHandleSetPairVector()) return false;
+  return true;
+}
+
+bool
+InsertRegionMessage::operator<(const InsertRegionMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getRegionHandleDimensionHandleSetPairVector() < rhs.getRegionHandleDimensionHandleSetPairVector()) return true;
+  if (rhs.getRegionHandleDimensionHandleSetPairVector() < getRegionHandleDimensionHandleSetPairVector()) return false;
+  return false;
+}
+
+CommitRegionMessage::CommitRegionMessage() :
+  _federationHandle(),
+  _regionHandleRegionValuePairVector()
+{
+}
+
+CommitRegionMessage::~CommitRegionMessage()
+{
+}
+
+const char*
+CommitRegionMessage::getTypeName() const
+{
+  return "CommitRegionMessage";
+}
+
+void
+CommitRegionMessage::out(std::ostream& os) const
+{
+  os << "CommitRegionMessage " << *this;
+}
+
+void
+CommitRegionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+CommitRegionMessage::operator==(const AbstractMessage& rhs) const
+{
+  const CommitRegionMessage* message = dynamic_cast<const CommitRegionMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+CommitRegionMessage::operator==(const CommitRegionMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getRegionHandleRegionValuePairVector() != rhs.getRegionHandleRegionValuePairVector()) return false;
+  return true;
+}
+
+bool
+CommitRegionMessage::operator<(const CommitRegionMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getRegionHandleRegionValuePairVector() < rhs.getRegionHandleRegionValuePairVector()) return true;
+  if (rhs.getRegionHandleRegionValuePairVector() < getRegionHandleRegionValuePairVector()) return false;
+  return false;
+}
+
+EraseRegionMessage::EraseRegionMessage() :
+  _federationHandle(),
+  _regionHandleVector()
+{
+}
+
+EraseRegionMessage::~EraseRegionMessage()
+{
+}
+
+const char*
+EraseRegionMessage::getTypeName() const
+{
+  return "EraseRegionMessage";
+}
+
+void
+EraseRegionMessage::out(std::ostream& os) const
+{
+  os << "EraseRegionMessage " << *this;
+}
+
+void
+EraseRegionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+EraseRegionMessage::operator==(const AbstractMessage& rhs) const
+{
+  const EraseRegionMessage* message = dynamic_cast<const EraseRegionMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+EraseRegionMessage::operator==(const EraseRegionMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getRegionHandleVector() != rhs.getRegionHandleVector()) return false;
+  return true;
+}
+
+bool
+EraseRegionMessage::operator<(const EraseRegionMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getRegionHandleVector() < rhs.getRegionHandleVector()) return true;
+  if (rhs.getRegionHandleVector() < getRegionHandleVector()) return false;
+  return false;
+}
+
+ChangeInteractionClassPublicationMessage::ChangeInteractionClassPublicationMessage() :
+  _federationHandle(),
+  _publicationType(),
+  _interactionClassHandle()
+{
+}
+
+ChangeInteractionClassPublicationMessage::~ChangeInteractionClassPublicationMessage()
+{
+}
+
+const char*
+ChangeInteractionClassPublicationMessage::getTypeName() const
+{
+  return "ChangeInteractionClassPublicationMessage";
+}
+
+void
+ChangeInteractionClassPublicationMessage::out(std::ostream& os) const
+{
+  os << "ChangeInteractionClassPublicationMessage " << *this;
+}
+
+void
+ChangeInteractionClassPublicationMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ChangeInteractionClassPublicationMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ChangeInteractionClassPublicationMessage* message = dynamic_cast<const ChangeInteractionClassPublicationMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ChangeInteractionClassPublicationMessage::operator==(const ChangeInteractionClassPublicationMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getPublicationType() != rhs.getPublicationType()) return false;
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  return true;
+}
+
+bool
+ChangeInteractionClassPublicationMessage::operator<(const ChangeInteractionClassPublicationMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getPublicationType() < rhs.getPublicationType()) return true;
+  if (rhs.getPublicationType() < getPublicationType()) return false;
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  return false;
+}
+
+ChangeObjectClassPublicationMessage::ChangeObjectClassPublicationMessage() :
+  _federationHandle(),
+  _publicationType(),
+  _objectClassHandle(),
+  _attributeHandles()
+{
+}
+
+ChangeObjectClassPublicationMessage::~ChangeObjectClassPublicationMessage()
+{
+}
+
+const char*
+ChangeObjectClassPublicationMessage::getTypeName() const
+{
+  return "ChangeObjectClassPublicationMessage";
+}
+
+void
+ChangeObjectClassPublicationMessage::out(std::ostream& os) const
+{
+  os << "ChangeObjectClassPublicationMessage " << *this;
+}
+
+void
+ChangeObjectClassPublicationMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ChangeObjectClassPublicationMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ChangeObjectClassPublicationMessage* message = dynamic_cast<const ChangeObjectClassPublicationMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ChangeObjectClassPublicationMessage::operator==(const ChangeObjectClassPublicationMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getPublicationType() != rhs.getPublicationType()) return false;
+  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
+  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  return true;
+}
+
+bool
+ChangeObjectClassPublicationMessage::operator<(const ChangeObjectClassPublicationMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getPublicationType() < rhs.getPublicationType()) return true;
+  if (rhs.getPublicationType() < getPublicationType()) return false;
+  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
+  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
+  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
+  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  return false;
+}
+
+ChangeInteractionClassSubscriptionMessage::ChangeInteractionClassSubscriptionMessage() :
+  _federationHandle(),
+  _subscriptionType(),
+  _interactionClassHandle()
+{
+}
+
+ChangeInteractionClassSubscriptionMessage::~ChangeInteractionClassSubscriptionMessage()
+{
+}
+
+const char*
+ChangeInteractionClassSubscriptionMessage::getTypeName() const
+{
+  return "ChangeInteractionClassSubscriptionMessage";
+}
+
+void
+ChangeInteractionClassSubscriptionMessage::out(std::ostream& os) const
+{
+  os << "ChangeInteractionClassSubscriptionMessage " << *this;
+}
+
+void
+ChangeInteractionClassSubscriptionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ChangeInteractionClassSubscriptionMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ChangeInteractionClassSubscriptionMessage* message = dynamic_cast<const ChangeInteractionClassSubscriptionMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ChangeInteractionClassSubscriptionMessage::operator==(const ChangeInteractionClassSubscriptionMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getSubscriptionType() != rhs.getSubscriptionType()) return false;
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  return true;
+}
+
+bool
+ChangeInteractionClassSubscriptionMessage::operator<(const ChangeInteractionClassSubscriptionMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getSubscriptionType() < rhs.getSubscriptionType()) return true;
+  if (rhs.getSubscriptionType() < getSubscriptionType()) return false;
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  return false;
+}
+
+ChangeObjectClassSubscriptionMessage::ChangeObjectClassSubscriptionMessage() :
+  _federationHandle(),
+  _subscriptionType(),
+  _objectClassHandle(),
+  _attributeHandles(),
+  _updateRate()
+{
+}
+
+ChangeObjectClassSubscriptionMessage::~ChangeObjectClassSubscriptionMessage()
+{
+}
+
+const char*
+ChangeObjectClassSubscriptionMessage::getTypeName() const
+{
+  return "ChangeObjectClassSubscriptionMessage";
+}
+
+void
+ChangeObjectClassSubscriptionMessage::out(std::ostream& os) const
+{
+  os << "ChangeObjectClassSubscriptionMessage " << *this;
+}
+
+void
+ChangeObjectClassSubscriptionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ChangeObjectClassSubscriptionMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ChangeObjectClassSubscriptionMessage* message = dynamic_cast<const ChangeObjectClassSubscriptionMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ChangeObjectClassSubscriptionMessage::operator==(const ChangeObjectClassSubscriptionMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getSubscriptionType() != rhs.getSubscriptionType()) return false;
+  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
+  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getUpdateRate() != rhs.getUpdateRate()) return false;
+  return true;
+}
+
+bool
+ChangeObjectClassSubscriptionMessage::operator<(const ChangeObjectClassSubscriptionMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getSubscriptionType() < rhs.getSubscriptionType()) return true;
+  if (rhs.getSubscriptionType() < getSubscriptionType()) return false;
+  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
+  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
+  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
+  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getUpdateRate() < rhs.getUpdateRate()) return true;
+  if (rhs.getUpdateRate() < getUpdateRate()) return false;
+  return false;
+}
+
+RegistrationForObjectClassMessage::RegistrationForObjectClassMessage() :
+  _objectClassHandle(),
+  _start()
+{
+}
+
+RegistrationForObjectClassMessage::~RegistrationForObjectClassMessage()
+{
+}
+
+const char*
+RegistrationForObjectClassMessage::getTypeName() const
+{
+  return "RegistrationForObjectClassMessage";
+}
+
+void
+RegistrationForObjectClassMessage::out(std::ostream& os) const
+{
+  os << "RegistrationForObjectClassMessage " << *this;
+}
+
+void
+RegistrationForObjectClassMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+RegistrationForObjectClassMessage::operator==(const AbstractMessage& rhs) const
+{
+  const RegistrationForObjectClassMessage* message = dynamic_cast<const RegistrationForObjectClassMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+RegistrationForObjectClassMessage::operator==(const RegistrationForObjectClassMessage& rhs) const
+{
+  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
+  if (getStart() != rhs.getStart()) return false;
+  return true;
+}
+
+bool
+RegistrationForObjectClassMessage::operator<(const RegistrationForObjectClassMessage& rhs) const
+{
+  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
+  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
+  if (getStart() < rhs.getStart()) return true;
+  if (rhs.getStart() < getStart()) return false;
+  return false;
+}
+
+AttributesInScopeMessage::AttributesInScopeMessage() :
+  _objectInstanceHandle(),
+  _attributeHandles(),
+  _inScope()
+{
+}
+
+AttributesInScopeMessage::~AttributesInScopeMessage()
+{
+}
+
+const char*
+AttributesInScopeMessage::getTypeName() const
+{
+  return "AttributesInScopeMessage";
+}
+
+void
+AttributesInScopeMessage::out(std::ostream& os) const
+{
+  os << "AttributesInScopeMessage " << *this;
+}
+
+void
+AttributesInScopeMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+AttributesInScopeMessage::operator==(const AbstractMessage& rhs) const
+{
+  const AttributesInScopeMessage* message = dynamic_cast<const AttributesInScopeMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+AttributesInScopeMessage::operator==(const AttributesInScopeMessage& rhs) const
+{
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getInScope() != rhs.getInScope()) return false;
+  return true;
+}
+
+bool
+AttributesInScopeMessage::operator<(const AttributesInScopeMessage& rhs) const
+{
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
+  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getInScope() < rhs.getInScope()) return true;
+  if (rhs.getInScope() < getInScope()) return false;
+  return false;
+}
+
+ObjectInstanceHandle
+AttributesInScopeMessage::getObjectInstanceHandleForMessage() const
+{
+  return getObjectInstanceHandle();
+}
+
+TurnUpdatesOnForInstanceMessage::TurnUpdatesOnForInstanceMessage() :
+  _objectInstanceHandle(),
+  _attributeHandles(),
+  _updateRate(),
+  _on()
+{
+}
+
+TurnUpdatesOnForInstanceMessage::~TurnUpdatesOnForInstanceMessage()
+{
+}
+
+const char*
+TurnUpdatesOnForInstanceMessage::getTypeName() const
+{
+  return "TurnUpdatesOnForInstanceMessage";
+}
+
+void
+TurnUpdatesOnForInstanceMessage::out(std::ostream& os) const
+{
+  os << "TurnUpdatesOnForInstanceMessage " << *this;
+}
+
+void
+TurnUpdatesOnForInstanceMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+TurnUpdatesOnForInstanceMessage::operator==(const AbstractMessage& rhs) const
+{
+  const TurnUpdatesOnForInstanceMessage* message = dynamic_cast<const TurnUpdatesOnForInstanceMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+TurnUpdatesOnForInstanceMessage::operator==(const TurnUpdatesOnForInstanceMessage& rhs) const
+{
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getUpdateRate() != rhs.getUpdateRate()) return false;
+  if (getOn() != rhs.getOn()) return false;
+  return true;
+}
+
+bool
+TurnUpdatesOnForInstanceMessage::operator<(const TurnUpdatesOnForInstanceMessage& rhs) const
+{
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
+  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getUpdateRate() < rhs.getUpdateRate()) return true;
+  if (rhs.getUpdateRate() < getUpdateRate()) return false;
+  if (getOn() < rhs.getOn()) return true;
+  if (rhs.getOn() < getOn()) return false;
+  return false;
+}
+
+ObjectInstanceHandle
+TurnUpdatesOnForInstanceMessage::getObjectInstanceHandleForMessage() const
+{
+  return getObjectInstanceHandle();
+}
+
+TurnInteractionsOnMessage::TurnInteractionsOnMessage() :
+  _interactionClassHandle(),
+  _on()
+{
+}
+
+TurnInteractionsOnMessage::~TurnInteractionsOnMessage()
+{
+}
+
+const char*
+TurnInteractionsOnMessage::getTypeName() const
+{
+  return "TurnInteractionsOnMessage";
+}
+
+void
+TurnInteractionsOnMessage::out(std::ostream& os) const
+{
+  os << "TurnInteractionsOnMessage " << *this;
+}
+
+void
+TurnInteractionsOnMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+TurnInteractionsOnMessage::operator==(const AbstractMessage& rhs) const
+{
+  const TurnInteractionsOnMessage* message = dynamic_cast<const TurnInteractionsOnMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+TurnInteractionsOnMessage::operator==(const TurnInteractionsOnMessage& rhs) const
+{
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getOn() != rhs.getOn()) return false;
+  return true;
+}
+
+bool
+TurnInteractionsOnMessage::operator<(const TurnInteractionsOnMessage& rhs) const
+{
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getOn() < rhs.getOn()) return true;
+  if (rhs.getOn() < getOn()) return false;
+  return false;
+}
+
+InteractionMessage::InteractionMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _interactionClassHandle(),
+  _transportationType(),
+  _tag(),
+  _parameterValues()
+{
+}
+
+InteractionMessage::~InteractionMessage()
+{
+}
+
+const char*
+InteractionMessage::getTypeName() const
+{
+  return "InteractionMessage";
+}
+
+void
+InteractionMessage::out(std::ostream& os) const
+{
+  os << "InteractionMessage " << *this;
+}
+
+void
+InteractionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+InteractionMessage::operator==(const AbstractMessage& rhs) const
+{
+  const InteractionMessage* message = dynamic_cast<const InteractionMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+InteractionMessage::operator==(const InteractionMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
+  if (getTag() != rhs.getTag()) return false;
+  if (getParameterValues() != rhs.getParameterValues()) return false;
+  return true;
+}
+
+bool
+InteractionMessage::operator<(const InteractionMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
+  if (getTag() < rhs.getTag()) return true;
+  if (rhs.getTag() < getTag()) return false;
+  if (getParameterValues() < rhs.getParameterValues()) return true;
+  if (rhs.getParameterValues() < getParameterValues()) return false;
+  return false;
+}
+
+bool
+InteractionMessage::getReliable() const
+{
+  return getTransportationType() == RELIABLE;
+}
+
+AbstractMessage::Priority
+InteractionMessage::getPriority() const
+{
+  return BulkPriority;
+}
+
+TimeStampedInteractionMessage::TimeStampedInteractionMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _interactionClassHandle(),
+  _orderType(),
+  _transportationType(),
+  _tag(),
+  _timeStamp(),
+  _messageRetractionHandle(),
+  _parameterValues()
+{
+}
+
+TimeStampedInteractionMessage::~TimeStampedInteractionMessage()
+{
+}
+
+const char*
+TimeStampedInteractionMessage::getTypeName() const
+{
+  return "TimeStampedInteractionMessage";
+}
+
+void
+TimeStampedInteractionMessage::out(std::ostream& os) const
+{
+  os << "TimeStampedInteractionMessage " << *this;
+}
+
+void
+TimeStampedInteractionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+TimeStampedInteractionMessage::operator==(const AbstractMessage& rhs) const
+{
+  const TimeStampedInteractionMessage* message = dynamic_cast<const TimeStampedInteractionMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+TimeStampedInteractionMessage::operator==(const TimeStampedInteractionMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getOrderType() != rhs.getOrderType()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
+  if (getTag() != rhs.getTag()) return false;
+  if (getTimeStamp() != rhs.getTimeStamp()) return false;
+  if (getMessageRetractionHandle() != rhs.getMessageRetractionHandle()) return false;
+  if (getParameterValues() != rhs.getParameterValues()) return false;
+  return true;
+}
+
+bool
+TimeStampedInteractionMessage::operator<(const TimeStampedInteractionMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getOrderType() < rhs.getOrderType()) return true;
+  if (rhs.getOrderType() < getOrderType()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
+  if (getTag() < rhs.getTag()) return true;
+  if (rhs.getTag() < getTag()) return false;
+  if (getTimeStamp() < rhs.getTimeStamp()) return true;
+  if (rhs.getTimeStamp() < getTimeStamp()) return false;
+  if (getMessageRetractionHandle() < rhs.getMessageRetractionHandle()) return true;
+  if (rhs.getMessageRetractionHandle() < getMessageRetractionHandle()) return false;
+  if (getParameterValues() < rhs.getParameterValues()) return true;
+  if (rhs.getParameterValues() < getParameterValues()) return false;
+  return false;
+}
+
+bool
+TimeStampedInteractionMessage::getReliable() const
+{
+  return getTransportationType() == RELIABLE || getOrderType() == TIMESTAMP;
+}
+
+MessageRetractionHandle
+TimeStampedInteractionMessage::getMessageRetractionHandleForMessage() const
+{
+  return getOrderType() == TIMESTAMP ? getMessageRetractionHandle() : MessageRetractionHandle();
+}
+
+AbstractMessage::Priority
+TimeStampedInteractionMessage::getPriority() const
+{
+  return getOrderType() == TIMESTAMP ? NormalPriority : BulkPriority;
+}
+
+ObjectInstanceHandlesRequestMessage::ObjectInstanceHandlesRequestMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _count()
+{
+}
+
+ObjectInstanceHandlesRequestMessage::~ObjectInstanceHandlesRequestMessage()
+{
+}
+
+const char*
+ObjectInstanceHandlesRequestMessage::getTypeName() const
+{
+  return "ObjectInstanceHandlesRequestMessage";
+}
+
+void
+ObjectInstanceHandlesRequestMessage::out(std::ostream& os) const
+{
+  os << "ObjectInstanceHandlesRequestMessage " << *this;
+}
+
+void
+ObjectInstanceHandlesRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ObjectInstanceHandlesRequestMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ObjectInstanceHandlesRequestMessage* message = dynamic_cast<const ObjectInstanceHandlesRequestMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ObjectInstanceHandlesRequestMessage::operator==(const ObjectInstanceHandlesRequestMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getCount() != rhs.getCount()) return false;
+  return true;
+}
+
+bool
+ObjectInstanceHandlesRequestMessage::operator<(const ObjectInstanceHandlesRequestMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getCount() < rhs.getCount()) return true;
+  if (rhs.getCount() < getCount()) return false;
+  return false;
+}
+
+ObjectInstanceHandlesResponseMessage::ObjectInstanceHandlesResponseMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _objectInstanceHandleNamePairVector()
+{
+}
+
+ObjectInstanceHandlesResponseMessage::~ObjectInstanceHandlesResponseMessage()
+{
+}
+
+const char*
+ObjectInstanceHandlesResponseMessage::getTypeName() const
+{
+  return "ObjectInstanceHandlesResponseMessage";
+}
+
+void
+ObjectInstanceHandlesResponseMessage::out(std::ostream& os) const
+{
+  os << "ObjectInstanceHandlesResponseMessage " << *this;
+}
+
+void
+ObjectInstanceHandlesResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ObjectInstanceHandlesResponseMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ObjectInstanceHandlesResponseMessage* message = dynamic_cast<const ObjectInstanceHandlesResponseMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ObjectInstanceHandlesResponseMessage::operator==(const ObjectInstanceHandlesResponseMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getObjectInstanceHandleNamePairVector() != rhs.getObjectInstanceHandleNamePairVector()) return false;
+  return true;
+}
+
+bool
+ObjectInstanceHandlesResponseMessage::operator<(const ObjectInstanceHandlesResponseMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getObjectInstanceHandleNamePairVector() < rhs.getObjectInstanceHandleNamePairVector()) return true;
+  if (rhs.getObjectInstanceHandleNamePairVector() < getObjectInstanceHandleNamePairVector()) return false;
+  return false;
+}
+
+ReleaseMultipleObjectInstanceNameHandlePairsMessage::ReleaseMultipleObjectInstanceNameHandlePairsMessage() :
+  _federationHandle(),
+  _objectInstanceHandleVector()
+{
+}
+
+ReleaseMultipleObjectInstanceNameHandlePairsMessage::~ReleaseMultipleObjectInstanceNameHandlePairsMessage()
+{
+}
+
+const char*
+ReleaseMultipleObjectInstanceNameHandlePairsMessage::getTypeName() const
+{
+  return "ReleaseMultipleObjectInstanceNameHandlePairsMessage";
+}
+
+void
+ReleaseMultipleObjectInstanceNameHandlePairsMessage::out(std::ostream& os) const
+{
+  os << "ReleaseMultipleObjectInstanceNameHandlePairsMessage " << *this;
+}
+
+void
+ReleaseMultipleObjectInstanceNameHandlePairsMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ReleaseMultipleObjectInstanceNameHandlePairsMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ReleaseMultipleObjectInstanceNameHandlePairsMessage* message = dynamic_cast<const ReleaseMultipleObjectInstanceNameHandlePairsMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ReleaseMultipleObjectInstanceNameHandlePairsMessage::operator==(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getObjectInstanceHandleVector() != rhs.getObjectInstanceHandleVector()) return false;
+  return true;
+}
+
+bool
+ReleaseMultipleObjectInstanceNameHandlePairsMessage::operator<(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getObjectInstanceHandleVector() < rhs.getObjectInstanceHandleVector()) return true;
+  if (rhs.getObjectInstanceHandleVector() < getObjectInstanceHandleVector()) return false;
+  return false;
+}
+
+ReserveObjectInstanceNameRequestMessage::ReserveObjectInstanceNameRequestMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _name()
+{
+}
+
+ReserveObjectInstanceNameRequestMessage::~ReserveObjectInstanceNameRequestMessage()
+{
+}
+
+const char*
+ReserveObjectInstanceNameRequestMessage::getTypeName() const
+{
+  return "ReserveObjectInstanceNameRequestMessage";
+}
+
+void
+ReserveObjectInstanceNameRequestMessage::out(std::ostream& os) const
+{
+  os << "ReserveObjectInstanceNameRequestMessage " << *this;
+}
+
+void
+ReserveObjectInstanceNameRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ReserveObjectInstanceNameRequestMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ReserveObjectInstanceNameRequestMessage* message = dynamic_cast<const ReserveObjectInstanceNameRequestMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ReserveObjectInstanceNameRequestMessage::operator==(const ReserveObjectInstanceNameRequestMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getName() != rhs.getName()) return false;
+  return true;
+}
+
+bool
+ReserveObjectInstanceNameRequestMessage::operator<(const ReserveObjectInstanceNameRequestMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getName() < rhs.getName()) return true;
+  if (rhs.getName() < getName()) return false;
+  return false;
+}
+
+ReserveObjectInstanceNameResponseMessage::ReserveObjectInstanceNameResponseMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _objectInstanceHandleNamePair(),
+  _success()
+{
+}
+
+ReserveObjectInstanceNameResponseMessage::~ReserveObjectInstanceNameResponseMessage()
+{
+}
+
+const char*
+ReserveObjectInstanceNameResponseMessage::getTypeName() const
+{
+  return "ReserveObjectInstanceNameResponseMessage";
+}
+
+void
+ReserveObjectInstanceNameResponseMessage::out(std::ostream& os) const
+{
+  os << "ReserveObjectInstanceNameResponseMessage " << *this;
+}
+
+void
+ReserveObjectInstanceNameResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ReserveObjectInstanceNameResponseMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ReserveObjectInstanceNameResponseMessage* message = dynamic_cast<const ReserveObjectInstanceNameResponseMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ReserveObjectInstanceNameResponseMessage::operator==(const ReserveObjectInstanceNameResponseMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getObjectInstanceHandleNamePair() != rhs.getObjectInstanceHandleNamePair()) return false;
+  if (getSuccess() != rhs.getSuccess()) return false;
+  return true;
+}
+
+bool
+ReserveObjectInstanceNameResponseMessage::operator<(const ReserveObjectInstanceNameResponseMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getObjectInstanceHandleNamePair() < rhs.getObjectInstanceHandleNamePair()) return true;
+  if (rhs.getObjectInstanceHandleNamePair() < getObjectInstanceHandleNamePair()) return false;
+  if (getSuccess() < rhs.getSuccess()) return true;
+  if (rhs.getSuccess() < getSuccess()) return false;
+  return false;
+}
+
+ReserveMultipleObjectInstanceNameRequestMessage::ReserveMultipleObjectInstanceNameRequestMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _nameList()
+{
+}
+
+ReserveMultipleObjectInstanceNameRequestMessage::~ReserveMultipleObjectInstanceNameRequestMessage()
+{
+}
+
+const char*
+ReserveMultipleObjectInstanceNameRequestMessage::getTypeName() const
+{
+  return "ReserveMultipleObjectInstanceNameRequestMessage";
+}
+
+void
+ReserveMultipleObjectInstanceNameRequestMessage::out(std::ostream& os) const
+{
+  os << "ReserveMultipleObjectInstanceNameRequestMessage " << *this;
+}
+
+void
+ReserveMultipleObjectInstanceNameRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ReserveMultipleObjectInstanceNameRequestMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ReserveMultipleObjectInstanceNameRequestMessage* message = dynamic_cast<const ReserveMultipleObjectInstanceNameRequestMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ReserveMultipleObjectInstanceNameRequestMessage::operator==(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
+{
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getNameList() != rhs.getNameList()) return false;
+  return true;
+}
+
+bool
+ReserveMultipleObjectInstanceNameRequestMessage::operator<(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getNameList() < rhs.getNameList()) return true;
+  if (rhs.getNameList() < getNameList()) return false;
+  return false;
+}
+
+ReserveMultipleObjectInstanceNameResponseMessage::ReserveMultipleObjectInstanceNameResponseMessage() :
+  _federationHandle(),
+  _federateHandle(),
+  _objectInstanceHandleNamePairVector(),
+  _success()
+{
+}
+
+ReserveMultipleObjectInstanceNameResponseMessage::~ReserveMultipleObjectInstanceNameResponseMessage()
+{
+}
+
+const char*
+ReserveMultipleObjectInstanceNameResponseMessage::getTypeName() const
+{
+  return "ReserveMultipleObjectInstanceNameResponseMessage";
+}
+
+void
+ReserveMultipleObjectInstanceNameResponseMessage::out(std::ostream& os) const
+{
+  os << "ReserveMultipleObjectInstanceNameResponseMessage " << *this;
+}
+
+void
+ReserveMultipleObjectInstanceNameResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+{
+  dispatcher.accept(*this);
+}
+
+bool
+ReserveMultipleObjectInstanceNameResponseMessage::operator==(const AbstractMessage& rhs) const
+{
+  const ReserveMultipleObjectInstanceNameResponseMessage* message = dynamic_cast<const ReserveMultipleObjectInstanceNameResponseMessage*>(&rhs);
+  if (!message)
+    return false;
+  return operator==(*message);
+}
+
+bool
+ReserveMultipleObjectInstanceNameResponseMessage::operator==(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
 {
-  return getObjectInstanceHandle();
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getObjectInstanceHandleNamePairVector() != rhs.getObjectInstanceHandleNamePairVector()) return false;
+  if (getSuccess() != rhs.getSuccess()) return false;
+  return true;
 }
 
-TurnUpdatesOnForInstanceMessage::TurnUpdatesOnForInstanceMessage() :
+bool
+ReserveMultipleObjectInstanceNameResponseMessage::operator<(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
+{
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getObjectInstanceHandleNamePairVector() < rhs.getObjectInstanceHandleNamePairVector()) return true;
+  if (rhs.getObjectInstanceHandleNamePairVector() < getObjectInstanceHandleNamePairVector()) return false;
+  if (getSuccess() < rhs.getSuccess()) return true;
+  if (rhs.getSuccess() < getSuccess()) return false;
+  return false;
+}
+
+InsertObjectInstanceMessage::InsertObjectInstanceMessage() :
+  _federationHandle(),
+  _objectClassHandle(),
   _objectInstanceHandle(),
-  _attributeHandles(),
-  _updateRate(),
-  _on()
+  _name(),
+  _attributeStateVector()
 {
 }
 
-TurnUpdatesOnForInstanceMessage::~TurnUpdatesOnForInstanceMessage()
+InsertObjectInstanceMessage::~InsertObjectInstanceMessage()
 {
 }
 
 const char*
-TurnUpdatesOnForInstanceMessage::getTypeName() const
+InsertObjectInstanceMessage::getTypeName() const
 {
-  return "TurnUpdatesOnForInstanceMessage";
+  return "InsertObjectInstanceMessage";
 }
 
 void
-TurnUpdatesOnForInstanceMessage::out(std::ostream& os) const
+InsertObjectInstanceMessage::out(std::ostream& os) const
 {
-  os << "TurnUpdatesOnForInstanceMessage " << *this;
+  os << "InsertObjectInstanceMessage " << *this;
 }
 
 void
-TurnUpdatesOnForInstanceMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+InsertObjectInstanceMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-TurnUpdatesOnForInstanceMessage::operator==(const AbstractMessage& rhs) const
+InsertObjectInstanceMessage::operator==(const AbstractMessage& rhs) const
 {
-  const TurnUpdatesOnForInstanceMessage* message = dynamic_cast<const TurnUpdatesOnForInstanceMessage*>(&rhs);
+  const InsertObjectInstanceMessage* message = dynamic_cast<const InsertObjectInstanceMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-TurnUpdatesOnForInstanceMessage::operator==(const TurnUpdatesOnForInstanceMessage& rhs) const
+InsertObjectInstanceMessage::operator==(const InsertObjectInstanceMessage& rhs) const
 {
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
   if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
-  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
-  if (getUpdateRate() != rhs.getUpdateRate()) return false;
-  if (getOn() != rhs.getOn()) return false;
+  if (getName() != rhs.getName()) return false;
+  if (getAttributeStateVector() != rhs.getAttributeStateVector()) return false;
   return true;
 }
 
 bool
-TurnUpdatesOnForInstanceMessage::operator<(const TurnUpdatesOnForInstanceMessage& rhs) const
+InsertObjectInstanceMessage::operator<(const InsertObjectInstanceMessage& rhs) const
 {
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
+  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
   if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
   if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
-  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
-  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
-  if (getUpdateRate() < rhs.getUpdateRate()) return true;
-  if (rhs.getUpdateRate() < getUpdateRate()) return false;
-  if (getOn() < rhs.getOn()) return true;
-  if (rhs.getOn() < getOn()) return false;
+  if (getName() < rhs.getName()) return true;
+  if (rhs.getName() < getName()) return false;
+  if (getAttributeStateVector() < rhs.getAttributeStateVector()) return true;
+  if (rhs.getAttributeStateVector() < getAttributeStateVector()) return false;
   return false;
 }
 
 ObjectInstanceHandle
-TurnUpdatesOnForInstanceMessage::getObjectInstanceHandleForMessage() const
+InsertObjectInstanceMessage::getObjectInstanceHandleForMessage() const
 {
   return getObjectInstanceHandle();
 }
 
-TurnInteractionsOnMessage::TurnInteractionsOnMessage() :
-  _interactionClassHandle(),
-  _on()
+InsertMultipleObjectInstancesMessage::InsertMultipleObjectInstancesMessage() :
+  _federationHandle(),
+  _objectInstanceStateVector()
 {
 }
 
-TurnInteractionsOnMessage::~TurnInteractionsOnMessage()
+InsertMultipleObjectInstancesMessage::~InsertMultipleObjectInstancesMessage()
 {
 }
 
 const char*
-TurnInteractionsOnMessage::getTypeName() const
+InsertMultipleObjectInstancesMessage::getTypeName() const
 {
-  return "TurnInteractionsOnMessage";
+  return "InsertMultipleObjectInstancesMessage";
 }
 
 void
-TurnInteractionsOnMessage::out(std::ostream& os) const
+InsertMultipleObjectInstancesMessage::out(std::ostream& os) const
 {
-  os << "TurnInteractionsOnMessage " << *this;
+  os << "InsertMultipleObjectInstancesMessage " << *this;
 }
 
 void
-TurnInteractionsOnMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+InsertMultipleObjectInstancesMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-TurnInteractionsOnMessage::operator==(const AbstractMessage& rhs) const
+InsertMultipleObjectInstancesMessage::operator==(const AbstractMessage& rhs) const
 {
-  const TurnInteractionsOnMessage* message = dynamic_cast<const TurnInteractionsOnMessage*>(&rhs);
+  const InsertMultipleObjectInstancesMessage* message = dynamic_cast<const InsertMultipleObjectInstancesMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-TurnInteractionsOnMessage::operator==(const TurnInteractionsOnMessage& rhs) const
+InsertMultipleObjectInstancesMessage::operator==(const InsertMultipleObjectInstancesMessage& rhs) const
 {
-  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
-  if (getOn() != rhs.getOn()) return false;
+  if (getFederationHandle() != rhs.getFederationHandle()) return false;
+  if (getObjectInstanceStateVector() != rhs.getObjectInstanceStateVector()) return false;
   return true;
 }
 
 bool
-TurnInteractionsOnMessage::operator<(const TurnInteractionsOnMessage& rhs) const
+InsertMultipleObjectInstancesMessage::operator<(const InsertMultipleObjectInstancesMessage& rhs) const
 {
-  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
-  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
-  if (getOn() < rhs.getOn()) return true;
-  if (rhs.getOn() < getOn()) return false;
+  if (getFederationHandle() < rhs.getFederationHandle()) return true;
+  if (rhs.getFederationHandle() < getFederationHandle()) return false;
+  if (getObjectInstanceStateVector() < rhs.getObjectInstanceStateVector()) return true;
+  if (rhs.getObjectInstanceStateVector() < getObjectInstanceStateVector()) return false;
   return false;
 }
 
-InteractionMessage::InteractionMessage() :
+DeleteObjectInstanceMessage::DeleteObjectInstanceMessage() :
   _federationHandle(),
   _federateHandle(),
-  _interactionClassHandle(),
-  _transportationType(),
-  _tag(),
-  _parameterValues()
+  _objectInstanceHandle(),
+  _tag()
 {
 }
 
-InteractionMessage::~InteractionMessage()
+DeleteObjectInstanceMessage::~DeleteObjectInstanceMessage()
 {
 }
 
 const char*
-InteractionMessage::getTypeName() const
+DeleteObjectInstanceMessage::getTypeName() const
 {
-  return "InteractionMessage";
+  return "DeleteObjectInstanceMessage";
 }
 
 void
-InteractionMessage::out(std::ostream& os) const
+DeleteObjectInstanceMessage::out(std::ostream& os) const
 {
-  os << "InteractionMessage " << *this;
+  os << "DeleteObjectInstanceMessage " << *this;
 }
 
 void
-InteractionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+DeleteObjectInstanceMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-InteractionMessage::operator==(const AbstractMessage& rhs) const
+DeleteObjectInstanceMessage::operator==(const AbstractMessage& rhs) const
 {
-  const InteractionMessage* message = dynamic_cast<const InteractionMessage*>(&rhs);
+  const DeleteObjectInstanceMessage* message = dynamic_cast<const DeleteObjectInstanceMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-InteractionMessage::operator==(const InteractionMessage& rhs) const
+DeleteObjectInstanceMessage::operator==(const DeleteObjectInstanceMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
-  if (getTransportationType() != rhs.getTransportationType()) return false;
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
   if (getTag() != rhs.getTag()) return false;
-  if (getParameterValues() != rhs.getParameterValues()) return false;
   return true;
 }
 
 bool
-InteractionMessage::operator<(const InteractionMessage& rhs) const
+DeleteObjectInstanceMessage::operator<(const DeleteObjectInstanceMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
-  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
-  if (getTransportationType() < rhs.getTransportationType()) return true;
-  if (rhs.getTransportationType() < getTransportationType()) return false;
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
   if (getTag() < rhs.getTag()) return true;
   if (rhs.getTag() < getTag()) return false;
-  if (getParameterValues() < rhs.getParameterValues()) return true;
-  if (rhs.getParameterValues() < getParameterValues()) return false;
   return false;
 }
 
-bool
-InteractionMessage::getReliable() const
+ObjectInstanceHandle
+DeleteObjectInstanceMessage::getObjectInstanceHandleForMessage() const
 {
-  return getTransportationType() == RELIABLE;
+  return getObjectInstanceHandle();
 }
 
-TimeStampedInteractionMessage::TimeStampedInteractionMessage() :
+TimeStampedDeleteObjectInstanceMessage::TimeStampedDeleteObjectInstanceMessage() :
   _federationHandle(),
   _federateHandle(),
-  _interactionClassHandle(),
+  _objectInstanceHandle(),
   _orderType(),
-  _transportationType(),
   _tag(),
   _timeStamp(),
-  _messageRetractionHandle(),
-  _parameterValues()
+  _messageRetractionHandle()
 {
 }
 
-TimeStampedInteractionMessage::~TimeStampedInteractionMessage()
+TimeStampedDeleteObjectInstanceMessage::~TimeStampedDeleteObjectInstanceMessage()
 {
 }
 
 const char*
-TimeStampedInteractionMessage::getTypeName() const
+TimeStampedDeleteObjectInstanceMessage::getTypeName() const
 {
-  return "TimeStampedInteractionMessage";
+  return "TimeStampedDeleteObjectInstanceMessage";
 }
 
 void
-TimeStampedInteractionMessage::out(std::ostream& os) const
+TimeStampedDeleteObjectInstanceMessage::out(std::ostream& os) const
 {
-  os << "TimeStampedInteractionMessage " << *this;
+  os << "TimeStampedDeleteObjectInstanceMessage " << *this;
 }
 
 void
-TimeStampedInteractionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+TimeStampedDeleteObjectInstanceMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-TimeStampedInteractionMessage::operator==(const AbstractMessage& rhs) const
+TimeStampedDeleteObjectInstanceMessage::operator==(const AbstractMessage& rhs) const
 {
-  const TimeStampedInteractionMessage* message = dynamic_cast<const TimeStampedInteractionMessage*>(&rhs);
+  const TimeStampedDeleteObjectInstanceMessage* message = dynamic_cast<const TimeStampedDeleteObjectInstanceMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-TimeStampedInteractionMessage::operator==(const TimeStampedInteractionMessage& rhs) const
+TimeStampedDeleteObjectInstanceMessage::operator==(const TimeStampedDeleteObjectInstanceMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
   if (getOrderType() != rhs.getOrderType()) return false;
-  if (getTransportationType() != rhs.getTransportationType()) return false;
   if (getTag() != rhs.getTag()) return false;
   if (getTimeStamp() != rhs.getTimeStamp()) return false;
   if (getMessageRetractionHandle() != rhs.getMessageRetractionHandle()) return false;
-  if (getParameterValues() != rhs.getParameterValues()) return false;
   return true;
 }
 
 bool
-TimeStampedInteractionMessage::operator<(const TimeStampedInteractionMessage& rhs) const
+TimeStampedDeleteObjectInstanceMessage::operator<(const TimeStampedDeleteObjectInstanceMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
-  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
   if (getOrderType() < rhs.getOrderType()) return true;
   if (rhs.getOrderType() < getOrderType()) return false;
-  if (getTransportationType() < rhs.getTransportationType()) return true;
-  if (rhs.getTransportationType() < getTransportationType()) return false;
   if (getTag() < rhs.getTag()) return true;
   if (rhs.getTag() < getTag()) return false;
   if (getTimeStamp() < rhs.getTimeStamp()) return true;
   if (rhs.getTimeStamp() < getTimeStamp()) return false;
   if (getMessageRetractionHandle() < rhs.getMessageRetractionHandle()) return true;
   if (rhs.getMessageRetractionHandle() < getMessageRetractionHandle()) return false;
-  if (getParameterValues() < rhs.getParameterValues()) return true;
-  if (rhs.getParameterValues() < getParameterValues()) return false;
   return false;
 }
 
-bool
-TimeStampedInteractionMessage::getReliable() const
+ObjectInstanceHandle
+TimeStampedDeleteObjectInstanceMessage::getObjectInstanceHandleForMessage() const
 {
-  return getTransportationType() == RELIABLE;
+  return getObjectInstanceHandle();
 }
 
-ObjectInstanceHandlesRequestMessage::ObjectInstanceHandlesRequestMessage() :
+MessageRetractionHandle
+TimeStampedDeleteObjectInstanceMessage::getMessageRetractionHandleForMessage() const
+{
+  return getOrderType() == TIMESTAMP ? getMessageRetractionHandle() : MessageRetractionHandle();
+}
+
+AttributeUpdateMessage::AttributeUpdateMessage() :
   _federationHandle(),
   _federateHandle(),
-  _count()
+  _objectInstanceHandle(),
+  _tag(),
+  _transportationType(),
+  _attributeValues()
 {
 }
 
-ObjectInstanceHandlesRequestMessage::~ObjectInstanceHandlesRequestMessage()
+AttributeUpdateMessage::~AttributeUpdateMessage()
 {
 }
 
 const char*
-ObjectInstanceHandlesRequestMessage::getTypeName() const
+AttributeUpdateMessage::getTypeName() const
 {
-  return "ObjectInstanceHandlesRequestMessage";
+  return "AttributeUpdateMessage";
 }
 
 void
-ObjectInstanceHandlesRequestMessage::out(std::ostream& os) const
+AttributeUpdateMessage::out(std::ostream& os) const
 {
-  os << "ObjectInstanceHandlesRequestMessage " << *this;
+  os << "AttributeUpdateMessage " << *this;
 }
 
 void
-ObjectInstanceHandlesRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+AttributeUpdateMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ObjectInstanceHandlesRequestMessage::operator==(const AbstractMessage& rhs) const
+AttributeUpdateMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ObjectInstanceHandlesRequestMessage* message = dynamic_cast<const ObjectInstanceHandlesRequestMessage*>(&rhs);
+  const AttributeUpdateMessage* message = dynamic_cast<const AttributeUpdateMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ObjectInstanceHandlesRequestMessage::operator==(const ObjectInstanceHandlesRequestMessage& rhs) const
+AttributeUpdateMessage::operator==(const AttributeUpdateMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getCount() != rhs.getCount()) return false;
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
+  if (getTag() != rhs.getTag()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
+  if (getAttributeValues() != rhs.getAttributeValues()) return false;
   return true;
 }
 
 bool
-ObjectInstanceHandlesRequestMessage::operator<(const ObjectInstanceHandlesRequestMessage& rhs) const
+AttributeUpdateMessage::operator<(const AttributeUpdateMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getCount() < rhs.getCount()) return true;
-  if (rhs.getCount() < getCount()) return false;
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
+  if (getTag() < rhs.getTag()) return true;
+  if (rhs.getTag() < getTag()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
+  if (getAttributeValues() < rhs.getAttributeValues()) return true;
+  if (rhs.getAttributeValues() < getAttributeValues()) return false;
   return false;
 }
 
-ObjectInstanceHandlesResponseMessage::ObjectInstanceHandlesResponseMessage() :
+bool
+AttributeUpdateMessage::getReliable() const
+{
+  return getTransportationType() == RELIABLE;
+}
+
+ObjectInstanceHandle
+AttributeUpdateMessage::getObjectInstanceHandleForMessage() const
+{
+  return getObjectInstanceHandle();
+}
+
+AbstractMessage::Priority
+AttributeUpdateMessage::getPriority() const
+{
+  return BulkPriority;
+}
+
+TimeStampedAttributeUpdateMessage::TimeStampedAttributeUpdateMessage() :
   _federationHandle(),
   _federateHandle(),
-  _objectInstanceHandleNamePairVector()
+  _objectInstanceHandle(),
+  _tag(),
+  _timeStamp(),
+  _messageRetractionHandle(),
+  _orderType(),
+  _transportationType(),
+  _attributeValues()
 {
 }
 
-ObjectInstanceHandlesResponseMessage::~ObjectInstanceHandlesResponseMessage()
+TimeStampedAttributeUpdateMessage::~TimeStampedAttributeUpdateMessage()
 {
 }
 
 const char*
-ObjectInstanceHandlesResponseMessage::getTypeName() const
+TimeStampedAttributeUpdateMessage::getTypeName() const
 {
-  return "ObjectInstanceHandlesResponseMessage";
+  return "TimeStampedAttributeUpdateMessage";
 }
 
 void
-ObjectInstanceHandlesResponseMessage::out(std::ostream& os) const
+TimeStampedAttributeUpdateMessage::out(std::ostream& os) const
 {
-  os << "ObjectInstanceHandlesResponseMessage " << *this;
+  os << "TimeStampedAttributeUpdateMessage " << *this;
 }
 
 void
-ObjectInstanceHandlesResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+TimeStampedAttributeUpdateMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ObjectInstanceHandlesResponseMessage::operator==(const AbstractMessage& rhs) const
+TimeStampedAttributeUpdateMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ObjectInstanceHandlesResponseMessage* message = dynamic_cast<const ObjectInstanceHandlesResponseMessage*>(&rhs);
+  const TimeStampedAttributeUpdateMessage* message = dynamic_cast<const TimeStampedAttributeUpdateMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ObjectInstanceHandlesResponseMessage::operator==(const ObjectInstanceHandlesResponseMessage& rhs) const
+TimeStampedAttributeUpdateMessage::operator==(const TimeStampedAttributeUpdateMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getObjectInstanceHandleNamePairVector() != rhs.getObjectInstanceHandleNamePairVector()) return false;
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
+  if (getTag() != rhs.getTag()) return false;
+  if (getTimeStamp() != rhs.getTimeStamp()) return false;
+  if (getMessageRetractionHandle() != rhs.getMessageRetractionHandle()) return false;
+  if (getOrderType() != rhs.getOrderType()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
+  if (getAttributeValues() != rhs.getAttributeValues()) return false;
   return true;
 }
 
 bool
-ObjectInstanceHandlesResponseMessage::operator<(const ObjectInstanceHandlesResponseMessage& rhs) const
+TimeStampedAttributeUpdateMessage::operator<(const TimeStampedAttributeUpdateMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getObjectInstanceHandleNamePairVector() < rhs.getObjectInstanceHandleNamePairVector()) return true;
-  if (rhs.getObjectInstanceHandleNamePairVector() < getObjectInstanceHandleNamePairVector()) return false;
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
+  if (getTag() < rhs.getTag()) return true;
+  if (rhs.getTag() < getTag()) return false;
+  if (getTimeStamp() < rhs.getTimeStamp()) return true;
+  if (rhs.getTimeStamp() < getTimeStamp()) return false;
+  if (getMessageRetractionHandle() < rhs.getMessageRetractionHandle()) return true;
+  if (rhs.getMessageRetractionHandle() < getMessageRetractionHandle()) return false;
+  if (getOrderType() < rhs.getOrderType()) return true;
+  if (rhs.getOrderType() < getOrderType()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
+  if (getAttributeValues() < rhs.getAttributeValues()) return true;
+  if (rhs.getAttributeValues() < getAttributeValues()) return false;
   return false;
 }
 
-ReleaseMultipleObjectInstanceNameHandlePairsMessage::ReleaseMultipleObjectInstanceNameHandlePairsMessage() :
-  _federationHandle(),
-  _objectInstanceHandleVector()
-{
-}
-
-ReleaseMultipleObjectInstanceNameHandlePairsMessage::~ReleaseMultipleObjectInstanceNameHandlePairsMessage()
-{
-}
-
-const char*
-ReleaseMultipleObjectInstanceNameHandlePairsMessage::getTypeName() const
-{
-  return "ReleaseMultipleObjectInstanceNameHandlePairsMessage";
-}
-
-void
-ReleaseMultipleObjectInstanceNameHandlePairsMessage::out(std::ostream& os) const
-{
-  os << "ReleaseMultipleObjectInstanceNameHandlePairsMessage " << *this;
-}
-
-void
-ReleaseMultipleObjectInstanceNameHandlePairsMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+bool
+TimeStampedAttributeUpdateMessage::getReliable() const
 {
-  dispatcher.accept(*this);
+  return getTransportationType() == RELIABLE || getOrderType() == TIMESTAMP;
 }
 
-bool
-ReleaseMultipleObjectInstanceNameHandlePairsMessage::operator==(const AbstractMessage& rhs) const
+ObjectInstanceHandle
+TimeStampedAttributeUpdateMessage::getObjectInstanceHandleForMessage() const
 {
-  const ReleaseMultipleObjectInstanceNameHandlePairsMessage* message = dynamic_cast<const ReleaseMultipleObjectInstanceNameHandlePairsMessage*>(&rhs);
-  if (!message)
-    return false;
-  return operator==(*message);
+  return getObjectInstanceHandle();
 }
 
-bool
-ReleaseMultipleObjectInstanceNameHandlePairsMessage::operator==(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
+MessageRetractionHandle
+TimeStampedAttributeUpdateMessage::getMessageRetractionHandleForMessage() const
 {
-  if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getObjectInstanceHandleVector() != rhs.getObjectInstanceHandleVector()) return false;
-  return true;
+  return getOrderType() == TIMESTAMP ? getMessageRetractionHandle() : MessageRetractionHandle();
 }
 
-bool
-ReleaseMultipleObjectInstanceNameHandlePairsMessage::operator<(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
+AbstractMessage::Priority
+TimeStampedAttributeUpdateMessage::getPriority() const
 {
-  if (getFederationHandle() < rhs.getFederationHandle()) return true;
-  if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getObjectInstanceHandleVector() < rhs.getObjectInstanceHandleVector()) return true;
-  if (rhs.getObjectInstanceHandleVector() < getObjectInstanceHandleVector()) return false;
-  return false;
+  return getOrderType() == TIMESTAMP ? NormalPriority : BulkPriority;
 }
 
-ReserveObjectInstanceNameRequestMessage::ReserveObjectInstanceNameRequestMessage() :
+RequestAttributeUpdateMessage::RequestAttributeUpdateMessage() :
   _federationHandle(),
-  _federateHandle(),
-  _name()
+  _objectInstanceHandle(),
+  _attributeHandles(),
+  _tag()
 {
 }
 
-ReserveObjectInstanceNameRequestMessage::~ReserveObjectInstanceNameRequestMessage()
+RequestAttributeUpdateMessage::~RequestAttributeUpdateMessage()
 {
 }
 
 const char*
-ReserveObjectInstanceNameRequestMessage::getTypeName() const
+RequestAttributeUpdateMessage::getTypeName() const
 {
-  return "ReserveObjectInstanceNameRequestMessage";
+  return "RequestAttributeUpdateMessage";
 }
 
 void
-ReserveObjectInstanceNameRequestMessage::out(std::ostream& os) const
+RequestAttributeUpdateMessage::out(std::ostream& os) const
 {
-  os << "ReserveObjectInstanceNameRequestMessage " << *this;
+  os << "RequestAttributeUpdateMessage " << *this;
 }
 
 void
-ReserveObjectInstanceNameRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+RequestAttributeUpdateMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ReserveObjectInstanceNameRequestMessage::operator==(const AbstractMessage& rhs) const
+RequestAttributeUpdateMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ReserveObjectInstanceNameRequestMessage* message = dynamic_cast<const ReserveObjectInstanceNameRequestMessage*>(&rhs);
+  const RequestAttributeUpdateMessage* message = dynamic_cast<const RequestAttributeUpdateMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ReserveObjectInstanceNameRequestMessage::operator==(const ReserveObjectInstanceNameRequestMessage& rhs) const
+RequestAttributeUpdateMessage::operator==(const RequestAttributeUpdateMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getName() != rhs.getName()) return false;
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getTag() != rhs.getTag()) return false;
   return true;
 }
 
 bool
-ReserveObjectInstanceNameRequestMessage::operator<(const ReserveObjectInstanceNameRequestMessage& rhs) const
+RequestAttributeUpdateMessage::operator<(const RequestAttributeUpdateMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getFederateHandle() < rhs.getFederateHandle()) return true;
-  if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getName() < rhs.getName()) return true;
-  if (rhs.getName() < getName()) return false;
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
+  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getTag() < rhs.getTag()) return true;
+  if (rhs.getTag() < getTag()) return false;
   return false;
 }
 
-ReserveObjectInstanceNameResponseMessage::ReserveObjectInstanceNameResponseMessage() :
+ObjectInstanceHandle
+RequestAttributeUpdateMessage::getObjectInstanceHandleForMessage() const
+{
+  return getObjectInstanceHandle();
+}
+
+RequestClassAttributeUpdateMessage::RequestClassAttributeUpdateMessage() :
   _federationHandle(),
-  _federateHandle(),
-  _objectInstanceHandleNamePair(),
-  _success()
+  _objectClassHandle(),
+  _attributeHandles(),
+  _tag()
 {
 }
 
-ReserveObjectInstanceNameResponseMessage::~ReserveObjectInstanceNameResponseMessage()
+RequestClassAttributeUpdateMessage::~RequestClassAttributeUpdateMessage()
 {
 }
 
 const char*
-ReserveObjectInstanceNameResponseMessage::getTypeName() const
+RequestClassAttributeUpdateMessage::getTypeName() const
 {
-  return "ReserveObjectInstanceNameResponseMessage";
+  return "RequestClassAttributeUpdateMessage";
 }
 
 void
-ReserveObjectInstanceNameResponseMessage::out(std::ostream& os) const
+RequestClassAttributeUpdateMessage::out(std::ostream& os) const
 {
-  os << "ReserveObjectInstanceNameResponseMessage " << *this;
+  os << "RequestClassAttributeUpdateMessage " << *this;
 }
 
 void
-ReserveObjectInstanceNameResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+RequestClassAttributeUpdateMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ReserveObjectInstanceNameResponseMessage::operator==(const AbstractMessage& rhs) const
+RequestClassAttributeUpdateMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ReserveObjectInstanceNameResponseMessage* message = dynamic_cast<const ReserveObjectInstanceNameResponseMessage*>(&rhs);
+  const RequestClassAttributeUpdateMessage* message = dynamic_cast<const RequestClassAttributeUpdateMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ReserveObjectInstanceNameResponseMessage::operator==(const ReserveObjectInstanceNameResponseMessage& rhs) const
+RequestClassAttributeUpdateMessage::operator==(const RequestClassAttributeUpdateMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getObjectInstanceHandleNamePair() != rhs.getObjectInstanceHandleNamePair()) return false;
-  if (getSuccess() != rhs.getSuccess()) return false;
+  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
+  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getTag() != rhs.getTag()) return false;
   return true;
 }
 
 bool
-ReserveObjectInstanceNameResponseMessage::operator<(const ReserveObjectInstanceNameResponseMessage& rhs) const
+RequestClassAttributeUpdateMessage::operator<(const RequestClassAttributeUpdateMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getFederateHandle() < rhs.getFederateHandle()) return true;
-  if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getObjectInstanceHandleNamePair() < rhs.getObjectInstanceHandleNamePair()) return true;
-  if (rhs.getObjectInstanceHandleNamePair() < getObjectInstanceHandleNamePair()) return false;
-  if (getSuccess() < rhs.getSuccess()) return true;
-  if (rhs.getSuccess() < getSuccess()) return false;
+  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
+  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
+  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
+  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getTag() < rhs.getTag()) return true;
+  if (rhs.getTag() < getTag()) return false;
   return false;
 }
 
-ReserveMultipleObjectInstanceNameRequestMessage::ReserveMultipleObjectInstanceNameRequestMessage() :
+ChangeAttributeTransportationTypeRequestMessage::ChangeAttributeTransportationTypeRequestMessage() :
   _federationHandle(),
   _federateHandle(),
-  _nameList()
+  _objectInstanceHandle(),
+  _attributeHandles(),
+  _transportationType()
 {
 }
 
-ReserveMultipleObjectInstanceNameRequestMessage::~ReserveMultipleObjectInstanceNameRequestMessage()
+ChangeAttributeTransportationTypeRequestMessage::~ChangeAttributeTransportationTypeRequestMessage()
 {
 }
 
 const char*
-ReserveMultipleObjectInstanceNameRequestMessage::getTypeName() const
+ChangeAttributeTransportationTypeRequestMessage::getTypeName() const
 {
-  return "ReserveMultipleObjectInstanceNameRequestMessage";
+  return "ChangeAttributeTransportationTypeRequestMessage";
 }
 
 void
-ReserveMultipleObjectInstanceNameRequestMessage::out(std::ostream& os) const
+ChangeAttributeTransportationTypeRequestMessage::out(std::ostream& os) const
 {
-  os << "ReserveMultipleObjectInstanceNameRequestMessage " << *this;
+  os << "ChangeAttributeTransportationTypeRequestMessage " << *this;
 }
 
 void
-ReserveMultipleObjectInstanceNameRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+ChangeAttributeTransportationTypeRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ReserveMultipleObjectInstanceNameRequestMessage::operator==(const AbstractMessage& rhs) const
+ChangeAttributeTransportationTypeRequestMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ReserveMultipleObjectInstanceNameRequestMessage* message = dynamic_cast<const ReserveMultipleObjectInstanceNameRequestMessage*>(&rhs);
+  const ChangeAttributeTransportationTypeRequestMessage* message = dynamic_cast<const ChangeAttributeTransportationTypeRequestMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ReserveMultipleObjectInstanceNameRequestMessage::operator==(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
+ChangeAttributeTransportationTypeRequestMessage::operator==(const ChangeAttributeTransportationTypeRequestMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getNameList() != rhs.getNameList()) return false;
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
   return true;
 }
 
 bool
-ReserveMultipleObjectInstanceNameRequestMessage::operator<(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
+ChangeAttributeTransportationTypeRequestMessage::operator<(const ChangeAttributeTransportationTypeRequestMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getNameList() < rhs.getNameList()) return true;
-  if (rhs.getNameList() < getNameList()) return false;
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
+  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
   return false;
 }
 
-ReserveMultipleObjectInstanceNameResponseMessage::ReserveMultipleObjectInstanceNameResponseMessage() :
+ChangeAttributeTransportationTypeResponseMessage::ChangeAttributeTransportationTypeResponseMessage() :
   _federationHandle(),
   _federateHandle(),
-  _objectInstanceHandleNamePairVector(),
-  _success()
+  _objectInstanceHandle(),
+  _attributeHandles(),
+  _transportationType()
 {
 }
 
-ReserveMultipleObjectInstanceNameResponseMessage::~ReserveMultipleObjectInstanceNameResponseMessage()
+ChangeAttributeTransportationTypeResponseMessage::~ChangeAttributeTransportationTypeResponseMessage()
 {
 }
 
 const char*
-ReserveMultipleObjectInstanceNameResponseMessage::getTypeName() const
+ChangeAttributeTransportationTypeResponseMessage::getTypeName() const
 {
-  return "ReserveMultipleObjectInstanceNameResponseMessage";
+  return "ChangeAttributeTransportationTypeResponseMessage";
 }
 
 void
-ReserveMultipleObjectInstanceNameResponseMessage::out(std::ostream& os) const
+ChangeAttributeTransportationTypeResponseMessage::out(std::ostream& os) const
 {
-  os << "ReserveMultipleObjectInstanceNameResponseMessage " << *this;
+  os << "ChangeAttributeTransportationTypeResponseMessage " << *this;
 }
 
 void
-ReserveMultipleObjectInstanceNameResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+ChangeAttributeTransportationTypeResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-ReserveMultipleObjectInstanceNameResponseMessage::operator==(const AbstractMessage& rhs) const
+ChangeAttributeTransportationTypeResponseMessage::operator==(const AbstractMessage& rhs) const
 {
-  const ReserveMultipleObjectInstanceNameResponseMessage* message = dynamic_cast<const ReserveMultipleObjectInstanceNameResponseMessage*>(&rhs);
+  const ChangeAttributeTransportationTypeResponseMessage* message = dynamic_cast<const ChangeAttributeTransportationTypeResponseMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-ReserveMultipleObjectInstanceNameResponseMessage::operator==(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
+ChangeAttributeTransportationTypeResponseMessage::operator==(const ChangeAttributeTransportationTypeResponseMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getObjectInstanceHandleNamePairVector() != rhs.getObjectInstanceHandleNamePairVector()) return false;
-  if (getSuccess() != rhs.getSuccess()) return false;
+  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
   return true;
 }
 
 bool
-ReserveMultipleObjectInstanceNameResponseMessage::operator<(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
+ChangeAttributeTransportationTypeResponseMessage::operator<(const ChangeAttributeTransportationTypeResponseMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getObjectInstanceHandleNamePairVector() < rhs.getObjectInstanceHandleNamePairVector()) return true;
-  if (rhs.getObjectInstanceHandleNamePairVector() < getObjectInstanceHandleNamePairVector()) return false;
-  if (getSuccess() < rhs.getSuccess()) return true;
-  if (rhs.getSuccess() < getSuccess()) return false;
+  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
+  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
+  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
   return false;
 }
 
-InsertObjectInstanceMessage::InsertObjectInstanceMessage() :
+ChangeInteractionTransportationTypeRequestMessage::ChangeInteractionTransportationTypeRequestMessage() :
   _federationHandle(),
-  _objectClassHandle(),
-  _objectInstanceHandle(),
-  _name(),
-  _attributeStateVector()
+  _federateHandle(),
+  _interactionClassHandle(),
+  _transportationType()
 {
 }
 
-InsertObjectInstanceMessage::~InsertObjectInstanceMessage()
+ChangeInteractionTransportationTypeRequestMessage::~ChangeInteractionTransportationTypeRequestMessage()
 {
 }
 
 const char*
-InsertObjectInstanceMessage::getTypeName() const
+ChangeInteractionTransportationTypeRequestMessage::getTypeName() const
 {
-  return "InsertObjectInstanceMessage";
+  return "ChangeInteractionTransportationTypeRequestMessage";
 }
 
 void
-InsertObjectInstanceMessage::out(std::ostream& os) const
+ChangeInteractionTransportationTypeRequestMessage::out(std::ostream& os) const
 {
-  os << "InsertObjectInstanceMessage " << *this;
+  os << "ChangeInteractionTransportationTypeRequestMessage " << *this;
 }
 
 void
-InsertObjectInstanceMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+ChangeInteractionTransportationTypeRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-InsertObjectInstanceMessage::operator==(const AbstractMessage& rhs) const
+ChangeInteractionTransportationTypeRequestMessage::operator==(const AbstractMessage& rhs) const
 {
-  const InsertObjectInstanceMessage* message = dynamic_cast<const InsertObjectInstanceMessage*>(&rhs);
+  const ChangeInteractionTransportationTypeRequestMessage* message = dynamic_cast<const ChangeInteractionTransportationTypeRequestMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-InsertObjectInstanceMessage::operator==(const InsertObjectInstanceMessage& rhs) const
+ChangeInteractionTransportationTypeRequestMessage::operator==(const ChangeInteractionTransportationTypeRequestMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
-  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
-  if (getName() != rhs.getName()) return false;
-  if (getAttributeStateVector() != rhs.getAttributeStateVector()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
   return true;
 }
 
 bool
-InsertObjectInstanceMessage::operator<(const InsertObjectInstanceMessage& rhs) const
+ChangeInteractionTransportationTypeRequestMessage::operator<(const ChangeInteractionTransportationTypeRequestMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
-  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
-  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
-  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
-  if (getName() < rhs.getName()) return true;
-  if (rhs.getName() < getName()) return false;
-  if (getAttributeStateVector() < rhs.getAttributeStateVector()) return true;
-  if (rhs.getAttributeStateVector() < getAttributeStateVector()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
   return false;
 }
 
-ObjectInstanceHandle
-InsertObjectInstanceMessage::getObjectInstanceHandleForMessage() const
-{
-  return getObjectInstanceHandle();
-}
-
-DeleteObjectInstanceMessage::DeleteObjectInstanceMessage() :
+ChangeInteractionTransportationTypeResponseMessage::ChangeInteractionTransportationTypeResponseMessage() :
   _federationHandle(),
   _federateHandle(),
-  _objectInstanceHandle(),
-  _tag()
+  _interactionClassHandle(),
+  _transportationType()
 {
 }
 
-DeleteObjectInstanceMessage::~DeleteObjectInstanceMessage()
+ChangeInteractionTransportationTypeResponseMessage::~ChangeInteractionTransportationTypeResponseMessage()
 {
 }
 
 const char*
-DeleteObjectInstanceMessage::getTypeName() const
+ChangeInteractionTransportationTypeResponseMessage::getTypeName() const
 {
-  return "DeleteObjectInstanceMessage";
+  return "ChangeInteractionTransportationTypeResponseMessage";
 }
 
 void
-DeleteObjectInstanceMessage::out(std::ostream& os) const
+ChangeInteractionTransportationTypeResponseMessage::out(std::ostream& os) const
 {
-  os << "DeleteObjectInstanceMessage " << *this;
+  os << "ChangeInteractionTransportationTypeResponseMessage " << *this;
 }
 
 void
-DeleteObjectInstanceMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+ChangeInteractionTransportationTypeResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-DeleteObjectInstanceMessage::operator==(const AbstractMessage& rhs) const
+ChangeInteractionTransportationTypeResponseMessage::operator==(const AbstractMessage& rhs) const
 {
-  const DeleteObjectInstanceMessage* message = dynamic_cast<const DeleteObjectInstanceMessage*>(&rhs);
+  const ChangeInteractionTransportationTypeResponseMessage* message = dynamic_cast<const ChangeInteractionTransportationTypeResponseMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-DeleteObjectInstanceMessage::operator==(const DeleteObjectInstanceMessage& rhs) const
+ChangeInteractionTransportationTypeResponseMessage::operator==(const ChangeInteractionTransportationTypeResponseMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
-  if (getTag() != rhs.getTag()) return false;
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
   return true;
 }
 
 bool
-DeleteObjectInstanceMessage::operator<(const DeleteObjectInstanceMessage& rhs) const
+ChangeInteractionTransportationTypeResponseMessage::operator<(const ChangeInteractionTransportationTypeResponseMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
-  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
-  if (getTag() < rhs.getTag()) return true;
-  if (rhs.getTag() < getTag()) return false;
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
   return false;
 }
 
-ObjectInstanceHandle
-DeleteObjectInstanceMessage::getObjectInstanceHandleForMessage() const
-{
-  return getObjectInstanceHandle();
-}
-
-TimeStampedDeleteObjectInstanceMessage::TimeStampedDeleteObjectInstanceMessage() :
+QueryAttributeTransportationTypeRequestMessage::QueryAttributeTransportationTypeRequestMessage() :
   _federationHandle(),
   _federateHandle(),
   _objectInstanceHandle(),
-  _orderType(),
-  _tag(),
-  _timeStamp(),
-  _messageRetractionHandle()
+  _attributeHandle()
 {
 }
 
-TimeStampedDeleteObjectInstanceMessage::~TimeStampedDeleteObjectInstanceMessage()
+QueryAttributeTransportationTypeRequestMessage::~QueryAttributeTransportationTypeRequestMessage()
 {
 }
 
 const char*
-TimeStampedDeleteObjectInstanceMessage::getTypeName() const
+QueryAttributeTransportationTypeRequestMessage::getTypeName() const
 {
-  return "TimeStampedDeleteObjectInstanceMessage";
+  return "QueryAttributeTransportationTypeRequestMessage";
 }
 
 void
-TimeStampedDeleteObjectInstanceMessage::out(std::ostream& os) const
+QueryAttributeTransportationTypeRequestMessage::out(std::ostream& os) const
 {
-  os << "TimeStampedDeleteObjectInstanceMessage " << *this;
+  os << "QueryAttributeTransportationTypeRequestMessage " << *this;
 }
 
 void
-TimeStampedDeleteObjectInstanceMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+QueryAttributeTransportationTypeRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-TimeStampedDeleteObjectInstanceMessage::operator==(const AbstractMessage& rhs) const
+QueryAttributeTransportationTypeRequestMessage::operator==(const AbstractMessage& rhs) const
 {
-  const TimeStampedDeleteObjectInstanceMessage* message = dynamic_cast<const TimeStampedDeleteObjectInstanceMessage*>(&rhs);
+  const QueryAttributeTransportationTypeRequestMessage* message = dynamic_cast<const QueryAttributeTransportationTypeRequestMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-TimeStampedDeleteObjectInstanceMessage::operator==(const TimeStampedDeleteObjectInstanceMessage& rhs) const
+QueryAttributeTransportationTypeRequestMessage::operator==(const QueryAttributeTransportationTypeRequestMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
   if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
-  if (getOrderType() != rhs.getOrderType()) return false;
-  if (getTag() != rhs.getTag()) return false;
-  if (getTimeStamp() != rhs.getTimeStamp()) return false;
-  if (getMessageRetractionHandle() != rhs.getMessageRetractionHandle()) return false;
+  if (getAttributeHandle() != rhs.getAttributeHandle()) return false;
   return true;
 }
 
 bool
-TimeStampedDeleteObjectInstanceMessage::operator<(const TimeStampedDeleteObjectInstanceMessage& rhs) const
+QueryAttributeTransportationTypeRequestMessage::operator<(const QueryAttributeTransportationTypeRequestMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
@@ -3367,78 +5313,64 @@ TimeStampedDeleteObjectInstanceMessage::operator<(const TimeStampedDeleteObjectI
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
   if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
   if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
-  if (getOrderType() < rhs.getOrderType()) return true;
-  if (rhs.getOrderType() < getOrderType()) return false;
-  if (getTag() < rhs.getTag()) return true;
-  if (rhs.getTag() < getTag()) return false;
-  if (getTimeStamp() < rhs.getTimeStamp()) return true;
-  if (rhs.getTimeStamp() < getTimeStamp()) return false;
-  if (getMessageRetractionHandle() < rhs.getMessageRetractionHandle()) return true;
-  if (rhs.getMessageRetractionHandle() < getMessageRetractionHandle()) return false;
+  if (getAttributeHandle() < rhs.getAttributeHandle()) return true;
+  if (rhs.getAttributeHandle() < getAttributeHandle()) return false;
   return false;
 }
 
-ObjectInstanceHandle
-TimeStampedDeleteObjectInstanceMessage::getObjectInstanceHandleForMessage() const
-{
-  return getObjectInstanceHandle();
-}
-
-AttributeUpdateMessage::AttributeUpdateMessage() :
+QueryAttributeTransportationTypeResponseMessage::QueryAttributeTransportationTypeResponseMessage() :
   _federationHandle(),
   _federateHandle(),
   _objectInstanceHandle(),
-  _tag(),
-  _transportationType(),
-  _attributeValues()
+  _attributeHandle(),
+  _transportationType()
 {
 }
 
-AttributeUpdateMessage::~AttributeUpdateMessage()
+QueryAttributeTransportationTypeResponseMessage::~QueryAttributeTransportationTypeResponseMessage()
 {
 }
 
 const char*
-AttributeUpdateMessage::getTypeName() const
+QueryAttributeTransportationTypeResponseMessage::getTypeName() const
 {
-  return "AttributeUpdateMessage";
+  return "QueryAttributeTransportationTypeResponseMessage";
 }
 
 void
-AttributeUpdateMessage::out(std::ostream& os) const
+QueryAttributeTransportationTypeResponseMessage::out(std::ostream& os) const
 {
-  os << "AttributeUpdateMessage " << *this;
+  os << "QueryAttributeTransportationTypeResponseMessage " << *this;
 }
 
 void
-AttributeUpdateMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+QueryAttributeTransportationTypeResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-AttributeUpdateMessage::operator==(const AbstractMessage& rhs) const
+QueryAttributeTransportationTypeResponseMessage::operator==(const AbstractMessage& rhs) const
 {
-  const AttributeUpdateMessage* message = dynamic_cast<const AttributeUpdateMessage*>(&rhs);
+  const QueryAttributeTransportationTypeResponseMessage* message = dynamic_cast<const QueryAttributeTransportationTypeResponseMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-AttributeUpdateMessage::operator==(const AttributeUpdateMessage& rhs) const
+QueryAttributeTransportationTypeResponseMessage::operator==(const QueryAttributeTransportationTypeResponseMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
   if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
-  if (getTag() != rhs.getTag()) return false;
+  if (getAttributeHandle() != rhs.getAttributeHandle()) return false;
   if (getTransportationType() != rhs.getTransportationType()) return false;
-  if (getAttributeValues() != rhs.getAttributeValues()) return false;
   return true;
 }
 
 bool
-AttributeUpdateMessage::operator<(const AttributeUpdateMessage& rhs) const
+QueryAttributeTransportationTypeResponseMessage::operator<(const QueryAttributeTransportationTypeResponseMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
@@ -3446,251 +5378,195 @@ AttributeUpdateMessage::operator<(const AttributeUpdateMessage& rhs) const
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
   if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
   if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
-  if (getTag() < rhs.getTag()) return true;
-  if (rhs.getTag() < getTag()) return false;
+  if (getAttributeHandle() < rhs.getAttributeHandle()) return true;
+  if (rhs.getAttributeHandle() < getAttributeHandle()) return false;
   if (getTransportationType() < rhs.getTransportationType()) return true;
   if (rhs.getTransportationType() < getTransportationType()) return false;
-  if (getAttributeValues() < rhs.getAttributeValues()) return true;
-  if (rhs.getAttributeValues() < getAttributeValues()) return false;
   return false;
 }
 
-bool
-AttributeUpdateMessage::getReliable() const
-{
-  return getTransportationType() == RELIABLE;
-}
-
-ObjectInstanceHandle
-AttributeUpdateMessage::getObjectInstanceHandleForMessage() const
-{
-  return getObjectInstanceHandle();
-}
-
-TimeStampedAttributeUpdateMessage::TimeStampedAttributeUpdateMessage() :
+QueryInteractionTransportationTypeRequestMessage::QueryInteractionTransportationTypeRequestMessage() :
   _federationHandle(),
   _federateHandle(),
-  _objectInstanceHandle(),
-  _tag(),
-  _timeStamp(),
-  _messageRetractionHandle(),
-  _orderType(),
-  _transportationType(),
-  _attributeValues()
+  _queriedFederateHandle(),
+  _interactionClassHandle()
 {
 }
 
-TimeStampedAttributeUpdateMessage::~TimeStampedAttributeUpdateMessage()
+QueryInteractionTransportationTypeRequestMessage::~QueryInteractionTransportationTypeRequestMessage()
 {
 }
 
 const char*
-TimeStampedAttributeUpdateMessage::getTypeName() const
+QueryInteractionTransportationTypeRequestMessage::getTypeName() const
 {
-  return "TimeStampedAttributeUpdateMessage";
+  return "QueryInteractionTransportationTypeRequestMessage";
 }
 
 void
-TimeStampedAttributeUpdateMessage::out(std::ostream& os) const
+QueryInteractionTransportationTypeRequestMessage::out(std::ostream& os) const
 {
-  os << "TimeStampedAttributeUpdateMessage " << *this;
+  os << "QueryInteractionTransportationTypeRequestMessage " << *this;
 }
 
 void
-TimeStampedAttributeUpdateMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+QueryInteractionTransportationTypeRequestMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-TimeStampedAttributeUpdateMessage::operator==(const AbstractMessage& rhs) const
+QueryInteractionTransportationTypeRequestMessage::operator==(const AbstractMessage& rhs) const
 {
-  const TimeStampedAttributeUpdateMessage* message = dynamic_cast<const TimeStampedAttributeUpdateMessage*>(&rhs);
+  const QueryInteractionTransportationTypeRequestMessage* message = dynamic_cast<const QueryInteractionTransportationTypeRequestMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-TimeStampedAttributeUpdateMessage::operator==(const TimeStampedAttributeUpdateMessage& rhs) const
+QueryInteractionTransportationTypeRequestMessage::operator==(const QueryInteractionTransportationTypeRequestMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
   if (getFederateHandle() != rhs.getFederateHandle()) return false;
-  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
-  if (getTag() != rhs.getTag()) return false;
-  if (getTimeStamp() != rhs.getTimeStamp()) return false;
-  if (getMessageRetractionHandle() != rhs.getMessageRetractionHandle()) return false;
-  if (getOrderType() != rhs.getOrderType()) return false;
-  if (getTransportationType() != rhs.getTransportationType()) return false;
-  if (getAttributeValues() != rhs.getAttributeValues()) return false;
+  if (getQueriedFederateHandle() != rhs.getQueriedFederateHandle()) return false;
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
   return true;
 }
 
 bool
-TimeStampedAttributeUpdateMessage::operator<(const TimeStampedAttributeUpdateMessage& rhs) const
+QueryInteractionTransportationTypeRequestMessage::operator<(const QueryInteractionTransportationTypeRequestMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
   if (getFederateHandle() < rhs.getFederateHandle()) return true;
   if (rhs.getFederateHandle() < getFederateHandle()) return false;
-  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
-  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
-  if (getTag() < rhs.getTag()) return true;
-  if (rhs.getTag() < getTag()) return false;
-  if (getTimeStamp() < rhs.getTimeStamp()) return true;
-  if (rhs.getTimeStamp() < getTimeStamp()) return false;
-  if (getMessageRetractionHandle() < rhs.getMessageRetractionHandle()) return true;
-  if (rhs.getMessageRetractionHandle() < getMessageRetractionHandle()) return false;
-  if (getOrderType() < rhs.getOrderType()) return true;
-  if (rhs.getOrderType() < getOrderType()) return false;
-  if (getTransportationType() < rhs.getTransportationType()) return true;
-  if (rhs.getTransportationType() < getTransportationType()) return false;
-  if (getAttributeValues() < rhs.getAttributeValues()) return true;
-  if (rhs.getAttributeValues() < getAttributeValues()) return false;
+  if (getQueriedFederateHandle() < rhs.getQueriedFederateHandle()) return true;
+  if (rhs.getQueriedFederateHandle() < getQueriedFederateHandle()) return false;
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
   return false;
 }
 
-bool
-TimeStampedAttributeUpdateMessage::getReliable() const
-{
-  return getTransportationType() == RELIABLE;
-}
-
-ObjectInstanceHandle
-TimeStampedAttributeUpdateMessage::getObjectInstanceHandleForMessage() const
-{
-  return getObjectInstanceHandle();
-}
-
-RequestAttributeUpdateMessage::RequestAttributeUpdateMessage() :
+QueryInteractionTransportationTypeResponseMessage::QueryInteractionTransportationTypeResponseMessage() :
   _federationHandle(),
-  _objectInstanceHandle(),
-  _attributeHandles(),
-  _tag()
+  _federateHandle(),
+  _queriedFederateHandle(),
+  _interactionClassHandle(),
+  _transportationType()
 {
 }
 
-RequestAttributeUpdateMessage::~RequestAttributeUpdateMessage()
+QueryInteractionTransportationTypeResponseMessage::~QueryInteractionTransportationTypeResponseMessage()
 {
 }
 
 const char*
-RequestAttributeUpdateMessage::getTypeName() const
+QueryInteractionTransportationTypeResponseMessage::getTypeName() const
 {
-  return "RequestAttributeUpdateMessage";
+  return "QueryInteractionTransportationTypeResponseMessage";
 }
 
 void
-RequestAttributeUpdateMessage::out(std::ostream& os) const
+QueryInteractionTransportationTypeResponseMessage::out(std::ostream& os) const
 {
-  os << "RequestAttributeUpdateMessage " << *this;
+  os << "QueryInteractionTransportationTypeResponseMessage " << *this;
 }
 
 void
-RequestAttributeUpdateMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+QueryInteractionTransportationTypeResponseMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-RequestAttributeUpdateMessage::operator==(const AbstractMessage& rhs) const
+QueryInteractionTransportationTypeResponseMessage::operator==(const AbstractMessage& rhs) const
 {
-  const RequestAttributeUpdateMessage* message = dynamic_cast<const RequestAttributeUpdateMessage*>(&rhs);
+  const QueryInteractionTransportationTypeResponseMessage* message = dynamic_cast<const QueryInteractionTransportationTypeResponseMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-RequestAttributeUpdateMessage::operator==(const RequestAttributeUpdateMessage& rhs) const
+QueryInteractionTransportationTypeResponseMessage::operator==(const QueryInteractionTransportationTypeResponseMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
-  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
-  if (getTag() != rhs.getTag()) return false;
+  if (getFederateHandle() != rhs.getFederateHandle()) return false;
+  if (getQueriedFederateHandle() != rhs.getQueriedFederateHandle()) return false;
+  if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+  if (getTransportationType() != rhs.getTransportationType()) return false;
   return true;
 }
 
 bool
-RequestAttributeUpdateMessage::operator<(const RequestAttributeUpdateMessage& rhs) const
+QueryInteractionTransportationTypeResponseMessage::operator<(const QueryInteractionTransportationTypeResponseMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
-  if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
-  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
-  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
-  if (getTag() < rhs.getTag()) return true;
-  if (rhs.getTag() < getTag()) return false;
+  if (getFederateHandle() < rhs.getFederateHandle()) return true;
+  if (rhs.getFederateHandle() < getFederateHandle()) return false;
+  if (getQueriedFederateHandle() < rhs.getQueriedFederateHandle()) return true;
+  if (rhs.getQueriedFederateHandle() < getQueriedFederateHandle()) return false;
+  if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+  if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+  if (getTransportationType() < rhs.getTransportationType()) return true;
+  if (rhs.getTransportationType() < getTransportationType()) return false;
   return false;
 }
 
-ObjectInstanceHandle
-RequestAttributeUpdateMessage::getObjectInstanceHandleForMessage() const
-{
-  return getObjectInstanceHandle();
-}
-
-RequestClassAttributeUpdateMessage::RequestClassAttributeUpdateMessage() :
+MessageRetractionMessage::MessageRetractionMessage() :
   _federationHandle(),
-  _objectClassHandle(),
-  _attributeHandles(),
-  _tag()
+  _messageRetractionHandle()
 {
 }
 
-RequestClassAttributeUpdateMessage::~RequestClassAttributeUpdateMessage()
+MessageRetractionMessage::~MessageRetractionMessage()
 {
 }
 
 const char*
-RequestClassAttributeUpdateMessage::getTypeName() const
+MessageRetractionMessage::getTypeName() const
 {
-  return "RequestClassAttributeUpdateMessage";
+  return "MessageRetractionMessage";
 }
 
 void
-RequestClassAttributeUpdateMessage::out(std::ostream& os) const
+MessageRetractionMessage::out(std::ostream& os) const
 {
-  os << "RequestClassAttributeUpdateMessage " << *this;
+  os << "MessageRetractionMessage " << *this;
 }
 
 void
-RequestClassAttributeUpdateMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
+MessageRetractionMessage::dispatch(const AbstractMessageDispatcher& dispatcher) const
 {
   dispatcher.accept(*this);
 }
 
 bool
-RequestClassAttributeUpdateMessage::operator==(const AbstractMessage& rhs) const
+MessageRetractionMessage::operator==(const AbstractMessage& rhs) const
 {
-  const RequestClassAttributeUpdateMessage* message = dynamic_cast<const RequestClassAttributeUpdateMessage*>(&rhs);
+  const MessageRetractionMessage* message = dynamic_cast<const MessageRetractionMessage*>(&rhs);
   if (!message)
     return false;
   return operator==(*message);
 }
 
 bool
-RequestClassAttributeUpdateMessage::operator==(const RequestClassAttributeUpdateMessage& rhs) const
+MessageRetractionMessage::operator==(const MessageRetractionMessage& rhs) const
 {
   if (getFederationHandle() != rhs.getFederationHandle()) return false;
-  if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
-  if (getAttributeHandles() != rhs.getAttributeHandles()) return false;
-  if (getTag() != rhs.getTag()) return false;
+  if (getMessageRetractionHandle() != rhs.getMessageRetractionHandle()) return false;
   return true;
 }
 
 bool
-RequestClassAttributeUpdateMessage::operator<(const RequestClassAttributeUpdateMessage& rhs) const
+MessageRetractionMessage::operator<(const MessageRetractionMessage& rhs) const
 {
   if (getFederationHandle() < rhs.getFederationHandle()) return true;
   if (rhs.getFederationHandle() < getFederationHandle()) return false;
-  if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
-  if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
-  if (getAttributeHandles() < rhs.getAttributeHandles()) return true;
-  if (rhs.getAttributeHandles() < getAttributeHandles()) return false;
-  if (getTag() < rhs.getTag()) return true;
-  if (rhs.getTag() < getTag()) return false;
+  if (getMessageRetractionHandle() < rhs.getMessageRetractionHandle()) return true;
+  if (rhs.getMessageRetractionHandle() < getMessageRetractionHandle()) return false;
   return false;
 }
 
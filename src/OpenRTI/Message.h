@@ -72,7 +72,8 @@ enum RestoreFailureReason {
   RTI_UNABLE_TO_RESTORE,
   FEDERATE_REPORTED_FAILURE_DURING_RESTORE,
   FEDERATE_RESIGNED_DURING_RESTORE,
-  RTI_DETECTED_FAILURE_DURING_RESTORE
+  RTI_DETECTED_FAILURE_DURING_RESTORE,
+  RESTORE_ABORTED
 };
 
 enum RestoreStatus {
@@ -89,7 +90,8 @@ enum SaveFailureReason {
   FEDERATE_REPORTED_FAILURE_DURING_SAVE,
   FEDERATE_RESIGNED_DURING_SAVE,
   RTI_DETECTED_FAILURE_DURING_SAVE,
-  SAVE_TIME_CANNOT_BE_HONORED
+  SAVE_TIME_CANNOT_BE_HONORED,
+  SAVE_ABORTED
 };
 
 enum SaveStatus {
@@ -157,6 +159,10 @@ typedef std::pair<FederateHandle, Bool> FederateHandleBoolPair;
 
 typedef std::vector<FederateHandleBoolPair> FederateHandleBoolPairVector;
 
+typedef std::pair<FederateHandle, Unsigned> FederateHandleCommitIdPair;
+
+typedef std::vector<FederateHandleCommitIdPair> FederateHandleCommitIdPairVector;
+
 class RangeBoundsValue;
 typedef std::pair<DimensionHandle, RangeBoundsValue> DimensionHandleRangeBoundsValuePair;
 
@@ -183,6 +189,9 @@ typedef std::pair<AttributeHandle, RegionValueList> AttributeHandleRegionValueLi
 class AttributeState;
 typedef std::vector<AttributeState> AttributeStateVector;
 
+class ObjectInstanceState;
+typedef std::vector<ObjectInstanceState> ObjectInstanceStateVector;
+
 class ParameterValue;
 typedef std::vector<ParameterValue> ParameterValueVector;
 
@@ -204,6 +213,23 @@ typedef std::pair<ObjectInstanceHandle, String> ObjectInstanceHandleNamePair;
 
 typedef std::vector<ObjectInstanceHandleNamePair> ObjectInstanceHandleNamePairVector;
 
+class FederationSaveFederate;
+typedef std::vector<FederationSaveFederate> FederationSaveFederateVector;
+
+class FederationSaveInteractionClassSubscription;
+typedef std::vector<FederationSaveInteractionClassSubscription> FederationSaveInteractionClassSubscriptionVector;
+
+class FederationSaveObjectClassSubscription;
+typedef std::vector<FederationSaveObjectClassSubscription> FederationSaveObjectClassSubscriptionVector;
+
+class FederationSaveHeader;
+typedef std::pair<AttributeHandle, FederateHandle> AttributeHandleFederateHandlePair;
+
+typedef std::vector<AttributeHandleFederateHandlePair> AttributeHandleFederateHandlePairVector;
+
+class FederationSaveObjectInstance;
+typedef std::vector<FederationSaveObjectInstance> FederationSaveObjectInstanceVector;
+
 enum CreateFederationExecutionResponseType {
   CreateFederationExecutionResponseSuccess,
   CreateFederationExecutionResponseFederationExecutionAlreadyExists,
@@ -227,7 +253,8 @@ enum JoinFederationExecutionResponseType {
   JoinFederationExecutionResponseFederationExecutionDoesNotExist,
   JoinFederationExecutionResponseSaveInProgress,
   JoinFederationExecutionResponseRestoreInProgress,
-  JoinFederationExecutionResponseInconsistentFDD
+  JoinFederationExecutionResponseInconsistentFDD,
+  JoinFederationExecutionResponseMissingFOMModules
 };
 
 enum RegisterFederationSynchronizationPointResponseType {
@@ -305,6 +332,8 @@ class DestroyFederationExecutionRequestMessage;
 class DestroyFederationExecutionResponseMessage;
 class EnumerateFederationExecutionsRequestMessage;
 class EnumerateFederationExecutionsResponseMessage;
+class MetricsRequestMessage;
+class MetricsResponseMessage;
 class InsertFederationExecutionMessage;
 class ShutdownFederationExecutionMessage;
 class EraseFederationExecutionMessage;
@@ -322,10 +351,28 @@ class RegisterFederationSynchronizationPointResponseMessage;
 class AnnounceSynchronizationPointMessage;
 class SynchronizationPointAchievedMessage;
 class FederationSynchronizedMessage;
+class RequestFederationSaveMessage;
+class InitiateFederateSaveMessage;
+class FederateSaveBegunMessage;
+class FederateSaveCompleteMessage;
+class FederationSavedMessage;
+class AbortFederationSaveMessage;
+class QueryFederationSaveStatusRequestMessage;
+class QueryFederationSaveStatusResponseMessage;
+class RequestFederationRestoreMessage;
+class RequestFederationRestoreResponseMessage;
+class FederationRestoreBegunMessage;
+class InitiateFederateRestoreMessage;
+class FederateRestoreCompleteMessage;
+class FederationRestoredMessage;
+class AbortFederationRestoreMessage;
+class QueryFederationRestoreStatusRequestMessage;
+class QueryFederationRestoreStatusResponseMessage;
 class EnableTimeRegulationRequestMessage;
 class EnableTimeRegulationResponseMessage;
 class DisableTimeRegulationRequestMessage;
 class CommitLowerBoundTimeStampMessage;
+class CollectedCommitLowerBoundTimeStampMessage;
 class CommitLowerBoundTimeStampResponseMessage;
 class LockedByNextMessageRequestMessage;
 class TimeConstrainedEnabledMessage;
@@ -352,12 +399,22 @@ class ReserveObjectInstanceNameResponseMessage;
 class ReserveMultipleObjectInstanceNameRequestMessage;
 class ReserveMultipleObjectInstanceNameResponseMessage;
 class InsertObjectInstanceMessage;
+class InsertMultipleObjectInstancesMessage;
 class DeleteObjectInstanceMessage;
 class TimeStampedDeleteObjectInstanceMessage;
 class AttributeUpdateMessage;
 class TimeStampedAttributeUpdateMessage;
 class RequestAttributeUpdateMessage;
 class RequestClassAttributeUpdateMessage;
+class ChangeAttributeTransportationTypeRequestMessage;
+class ChangeAttributeTransportationTypeResponseMessage;
+class ChangeInteractionTransportationTypeRequestMessage;
+class ChangeInteractionTransportationTypeResponseMessage;
+class QueryAttributeTransportationTypeRequestMessage;
+class QueryAttributeTransportationTypeResponseMessage;
+class QueryInteractionTransportationTypeRequestMessage;
+class QueryInteractionTransportationTypeResponseMessage;
+class MessageRetractionMessage;
 
 typedef bool Bool;
 
@@ -391,6 +448,10 @@ typedef std::pair<FederateHandle, Bool> FederateHandleBoolPair;
 
 typedef std::vector<FederateHandleBoolPair> FederateHandleBoolPairVector;
 
+typedef std::pair<FederateHandle, Unsigned> FederateHandleCommitIdPair;
+
+typedef std::vector<FederateHandleCommitIdPair> FederateHandleCommitIdPairVector;
+
 class OPENRTI_API RangeBoundsValue {
 public:
   RangeBoundsValue() :
@@ -520,6 +581,103 @@ private:
 
 typedef std::vector<AttributeState> AttributeStateVector;
 
+class OPENRTI_API ObjectInstanceState {
+public:
+  ObjectInstanceState() :
+    _objectClassHandle(),
+    _objectInstanceHandle(),
+    _name(),
+    _attributeStateVector()
+  { }
+  void setObjectClassHandle(const ObjectClassHandle& value)
+  { _objectClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectClassHandle(ObjectClassHandle&& value)
+  { _objectClassHandle = std::move(value); }
+#endif
+  ObjectClassHandle& getObjectClassHandle()
+  { return _objectClassHandle; }
+  const ObjectClassHandle& getObjectClassHandle() const
+  { return _objectClassHandle; }
+
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
+#endif
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
+
+  void setName(const String& value)
+  { _name = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setName(String&& value)
+  { _name = std::move(value); }
+#endif
+  String& getName()
+  { return _name; }
+  const String& getName() const
+  { return _name; }
+
+  void setAttributeStateVector(const AttributeStateVector& value)
+  { _attributeStateVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setAttributeStateVector(AttributeStateVector&& value)
+  { _attributeStateVector = std::move(value); }
+#endif
+  AttributeStateVector& getAttributeStateVector()
+  { return _attributeStateVector; }
+  const AttributeStateVector& getAttributeStateVector() const
+  { return _attributeStateVector; }
+
+  ObjectInstanceState& swap(ObjectInstanceState& rhs)
+  {
+    std::swap(_objectClassHandle, rhs._objectClassHandle);
+    std::swap(_objectInstanceHandle, rhs._objectInstanceHandle);
+    _name.swap(rhs._name);
+    _attributeStateVector.swap(rhs._attributeStateVector);
+    return *this;
+  }
+  bool operator==(const ObjectInstanceState& rhs) const
+  {
+    if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
+    if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
+    if (getName() != rhs.getName()) return false;
+    if (getAttributeStateVector() != rhs.getAttributeStateVector()) return false;
+    return true;
+  }
+  bool operator<(const ObjectInstanceState& rhs) const
+  {
+    if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
+    if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
+    if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+    if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
+    if (getName() < rhs.getName()) return true;
+    if (rhs.getName() < getName()) return false;
+    if (getAttributeStateVector() < rhs.getAttributeStateVector()) return true;
+    if (rhs.getAttributeStateVector() < getAttributeStateVector()) return false;
+    return false;
+  }
+  bool operator!=(const ObjectInstanceState& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const ObjectInstanceState& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const ObjectInstanceState& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const ObjectInstanceState& rhs) const
+  { return !operator>(rhs); }
+private:
+  ObjectClassHandle _objectClassHandle;
+  ObjectInstanceHandle _objectInstanceHandle;
+  String _name;
+  AttributeStateVector _attributeStateVector;
+};
+
+typedef std::vector<ObjectInstanceState> ObjectInstanceStateVector;
+
 class OPENRTI_API ParameterValue {
 public:
   ParameterValue() :
@@ -721,250 +879,566 @@ typedef std::pair<ObjectInstanceHandle, String> ObjectInstanceHandleNamePair;
 
 typedef std::vector<ObjectInstanceHandleNamePair> ObjectInstanceHandleNamePairVector;
 
-typedef std::map<String, StringVector> ConfigurationParameterMap;
-
-class OPENRTI_API FOMStringTransportationType {
+class OPENRTI_API FederationSaveFederate {
 public:
-  FOMStringTransportationType() : 
-    _impl(new Implementation())
+  FederationSaveFederate() :
+    _federateHandle(),
+    _name(),
+    _federateType(),
+    _isTimeRegulating(),
+    _timeAdvanceTimeStamp(),
+    _nextMessageTimeStamp(),
+    _regionHandleDimensionHandleSetPairVector(),
+    _regionHandleRegionValuePairVector()
   { }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
   void setName(const String& value)
-  { getImpl()._name = value; }
+  { _name = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
   void setName(String&& value)
-  { getImpl()._name = std::move(value); }
+  { _name = std::move(value); }
 #endif
   String& getName()
-  { return getImpl()._name; }
+  { return _name; }
   const String& getName() const
-  { return getConstImpl()._name; }
+  { return _name; }
 
-  FOMStringTransportationType& swap(FOMStringTransportationType& rhs)
+  void setFederateType(const String& value)
+  { _federateType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateType(String&& value)
+  { _federateType = std::move(value); }
+#endif
+  String& getFederateType()
+  { return _federateType; }
+  const String& getFederateType() const
+  { return _federateType; }
+
+  void setIsTimeRegulating(const Bool& value)
+  { _isTimeRegulating = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setIsTimeRegulating(Bool&& value)
+  { _isTimeRegulating = std::move(value); }
+#endif
+  Bool& getIsTimeRegulating()
+  { return _isTimeRegulating; }
+  const Bool& getIsTimeRegulating() const
+  { return _isTimeRegulating; }
+
+  void setTimeAdvanceTimeStamp(const String& value)
+  { _timeAdvanceTimeStamp = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTimeAdvanceTimeStamp(String&& value)
+  { _timeAdvanceTimeStamp = std::move(value); }
+#endif
+  String& getTimeAdvanceTimeStamp()
+  { return _timeAdvanceTimeStamp; }
+  const String& getTimeAdvanceTimeStamp() const
+  { return _timeAdvanceTimeStamp; }
+
+  void setNextMessageTimeStamp(const String& value)
+  { _nextMessageTimeStamp = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setNextMessageTimeStamp(String&& value)
+  { _nextMessageTimeStamp = std::move(value); }
+#endif
+  String& getNextMessageTimeStamp()
+  { return _nextMessageTimeStamp; }
+  const String& getNextMessageTimeStamp() const
+  { return _nextMessageTimeStamp; }
+
+  void setRegionHandleDimensionHandleSetPairVector(const RegionHandleDimensionHandleSetPairVector& value)
+  { _regionHandleDimensionHandleSetPairVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setRegionHandleDimensionHandleSetPairVector(RegionHandleDimensionHandleSetPairVector&& value)
+  { _regionHandleDimensionHandleSetPairVector = std::move(value); }
+#endif
+  RegionHandleDimensionHandleSetPairVector& getRegionHandleDimensionHandleSetPairVector()
+  { return _regionHandleDimensionHandleSetPairVector; }
+  const RegionHandleDimensionHandleSetPairVector& getRegionHandleDimensionHandleSetPairVector() const
+  { return _regionHandleDimensionHandleSetPairVector; }
+
+  void setRegionHandleRegionValuePairVector(const RegionHandleRegionValuePairVector& value)
+  { _regionHandleRegionValuePairVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setRegionHandleRegionValuePairVector(RegionHandleRegionValuePairVector&& value)
+  { _regionHandleRegionValuePairVector = std::move(value); }
+#endif
+  RegionHandleRegionValuePairVector& getRegionHandleRegionValuePairVector()
+  { return _regionHandleRegionValuePairVector; }
+  const RegionHandleRegionValuePairVector& getRegionHandleRegionValuePairVector() const
+  { return _regionHandleRegionValuePairVector; }
+
+  FederationSaveFederate& swap(FederationSaveFederate& rhs)
   {
-    _impl.swap(rhs._impl);
+    std::swap(_federateHandle, rhs._federateHandle);
+    _name.swap(rhs._name);
+    _federateType.swap(rhs._federateType);
+    std::swap(_isTimeRegulating, rhs._isTimeRegulating);
+    _timeAdvanceTimeStamp.swap(rhs._timeAdvanceTimeStamp);
+    _nextMessageTimeStamp.swap(rhs._nextMessageTimeStamp);
+    _regionHandleDimensionHandleSetPairVector.swap(rhs._regionHandleDimensionHandleSetPairVector);
+    _regionHandleRegionValuePairVector.swap(rhs._regionHandleRegionValuePairVector);
     return *this;
   }
-  bool operator==(const FOMStringTransportationType& rhs) const
+  bool operator==(const FederationSaveFederate& rhs) const
   {
-    if (_impl.get() == rhs._impl.get())
-      return true;
+    if (getFederateHandle() != rhs.getFederateHandle()) return false;
     if (getName() != rhs.getName()) return false;
+    if (getFederateType() != rhs.getFederateType()) return false;
+    if (getIsTimeRegulating() != rhs.getIsTimeRegulating()) return false;
+    if (getTimeAdvanceTimeStamp() != rhs.getTimeAdvanceTimeStamp()) return false;
+    if (getNextMessageTimeStamp() != rhs.getNextMessageTimeStamp()) return false;
+    if (getRegionHandleDimensionHandleSetPairVector() != rhs.getRegionHandleDimensionHandleSetPairVector()) return false;
+    if (getRegionHandleRegionValuePairVector() != rhs.getRegionHandleRegionValuePairVector()) return false;
     return true;
   }
-  bool operator<(const FOMStringTransportationType& rhs) const
+  bool operator<(const FederationSaveFederate& rhs) const
   {
-    if (_impl.get() == rhs._impl.get())
-      return false;
+    if (getFederateHandle() < rhs.getFederateHandle()) return true;
+    if (rhs.getFederateHandle() < getFederateHandle()) return false;
     if (getName() < rhs.getName()) return true;
     if (rhs.getName() < getName()) return false;
+    if (getFederateType() < rhs.getFederateType()) return true;
+    if (rhs.getFederateType() < getFederateType()) return false;
+    if (getIsTimeRegulating() < rhs.getIsTimeRegulating()) return true;
+    if (rhs.getIsTimeRegulating() < getIsTimeRegulating()) return false;
+    if (getTimeAdvanceTimeStamp() < rhs.getTimeAdvanceTimeStamp()) return true;
+    if (rhs.getTimeAdvanceTimeStamp() < getTimeAdvanceTimeStamp()) return false;
+    if (getNextMessageTimeStamp() < rhs.getNextMessageTimeStamp()) return true;
+    if (rhs.getNextMessageTimeStamp() < getNextMessageTimeStamp()) return false;
+    if (getRegionHandleDimensionHandleSetPairVector() < rhs.getRegionHandleDimensionHandleSetPairVector()) return true;
+    if (rhs.getRegionHandleDimensionHandleSetPairVector() < getRegionHandleDimensionHandleSetPairVector()) return false;
+    if (getRegionHandleRegionValuePairVector() < rhs.getRegionHandleRegionValuePairVector()) return true;
+    if (rhs.getRegionHandleRegionValuePairVector() < getRegionHandleRegionValuePairVector()) return false;
     return false;
   }
-  bool operator!=(const FOMStringTransportationType& rhs) const
+  bool operator!=(const FederationSaveFederate& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const FOMStringTransportationType& rhs) const
+  bool operator>(const FederationSaveFederate& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const FOMStringTransportationType& rhs) const
+  bool operator>=(const FederationSaveFederate& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const FOMStringTransportationType& rhs) const
+  bool operator<=(const FederationSaveFederate& rhs) const
   { return !operator>(rhs); }
 private:
-  struct OPENRTI_API Implementation : public Referenced {
-    Implementation() :
-      _name()
-    { }
-    String _name;
-  };
-
-  const Implementation& getConstImpl() const
-  {
-    return *_impl;
-  }
-
-  Implementation& getImpl()
-  {
-    if (1 < Referenced::count(_impl.get()))
-      _impl = new Implementation(*_impl);
-    return *_impl;
-  }
-
-  SharedPtr<Implementation> _impl;
+  FederateHandle _federateHandle;
+  String _name;
+  String _federateType;
+  Bool _isTimeRegulating;
+  String _timeAdvanceTimeStamp;
+  String _nextMessageTimeStamp;
+  RegionHandleDimensionHandleSetPairVector _regionHandleDimensionHandleSetPairVector;
+  RegionHandleRegionValuePairVector _regionHandleRegionValuePairVector;
 };
 
-typedef std::vector<FOMStringTransportationType> FOMStringTransportationTypeList;
+typedef std::vector<FederationSaveFederate> FederationSaveFederateVector;
 
-class OPENRTI_API FOMStringDimension {
+class OPENRTI_API FederationSaveInteractionClassSubscription {
 public:
-  FOMStringDimension() : 
-    _impl(new Implementation())
+  FederationSaveInteractionClassSubscription() :
+    _interactionClassHandle(),
+    _federateHandleVector()
   { }
-  void setName(const String& value)
-  { getImpl()._name = value; }
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setName(String&& value)
-  { getImpl()._name = std::move(value); }
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
 #endif
-  String& getName()
-  { return getImpl()._name; }
-  const String& getName() const
-  { return getConstImpl()._name; }
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
 
-  void setUpperBound(const Unsigned& value)
-  { getImpl()._upperBound = value; }
+  void setFederateHandleVector(const FederateHandleVector& value)
+  { _federateHandleVector = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setUpperBound(Unsigned&& value)
-  { getImpl()._upperBound = std::move(value); }
+  void setFederateHandleVector(FederateHandleVector&& value)
+  { _federateHandleVector = std::move(value); }
 #endif
-  Unsigned& getUpperBound()
-  { return getImpl()._upperBound; }
-  const Unsigned& getUpperBound() const
-  { return getConstImpl()._upperBound; }
+  FederateHandleVector& getFederateHandleVector()
+  { return _federateHandleVector; }
+  const FederateHandleVector& getFederateHandleVector() const
+  { return _federateHandleVector; }
 
-  FOMStringDimension& swap(FOMStringDimension& rhs)
+  FederationSaveInteractionClassSubscription& swap(FederationSaveInteractionClassSubscription& rhs)
   {
-    _impl.swap(rhs._impl);
+    std::swap(_interactionClassHandle, rhs._interactionClassHandle);
+    _federateHandleVector.swap(rhs._federateHandleVector);
     return *this;
   }
-  bool operator==(const FOMStringDimension& rhs) const
+  bool operator==(const FederationSaveInteractionClassSubscription& rhs) const
   {
-    if (_impl.get() == rhs._impl.get())
-      return true;
-    if (getName() != rhs.getName()) return false;
-    if (getUpperBound() != rhs.getUpperBound()) return false;
+    if (getInteractionClassHandle() != rhs.getInteractionClassHandle()) return false;
+    if (getFederateHandleVector() != rhs.getFederateHandleVector()) return false;
     return true;
   }
-  bool operator<(const FOMStringDimension& rhs) const
+  bool operator<(const FederationSaveInteractionClassSubscription& rhs) const
   {
-    if (_impl.get() == rhs._impl.get())
-      return false;
-    if (getName() < rhs.getName()) return true;
-    if (rhs.getName() < getName()) return false;
-    if (getUpperBound() < rhs.getUpperBound()) return true;
-    if (rhs.getUpperBound() < getUpperBound()) return false;
+    if (getInteractionClassHandle() < rhs.getInteractionClassHandle()) return true;
+    if (rhs.getInteractionClassHandle() < getInteractionClassHandle()) return false;
+    if (getFederateHandleVector() < rhs.getFederateHandleVector()) return true;
+    if (rhs.getFederateHandleVector() < getFederateHandleVector()) return false;
     return false;
   }
-  bool operator!=(const FOMStringDimension& rhs) const
+  bool operator!=(const FederationSaveInteractionClassSubscription& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const FOMStringDimension& rhs) const
+  bool operator>(const FederationSaveInteractionClassSubscription& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const FOMStringDimension& rhs) const
+  bool operator>=(const FederationSaveInteractionClassSubscription& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const FOMStringDimension& rhs) const
+  bool operator<=(const FederationSaveInteractionClassSubscription& rhs) const
   { return !operator>(rhs); }
 private:
-  struct OPENRTI_API Implementation : public Referenced {
-    Implementation() :
-      _name(),
-      _upperBound()
-    { }
-    String _name;
-    Unsigned _upperBound;
-  };
+  InteractionClassHandle _interactionClassHandle;
+  FederateHandleVector _federateHandleVector;
+};
 
-  const Implementation& getConstImpl() const
+typedef std::vector<FederationSaveInteractionClassSubscription> FederationSaveInteractionClassSubscriptionVector;
+
+class OPENRTI_API FederationSaveObjectClassSubscription {
+public:
+  FederationSaveObjectClassSubscription() :
+    _objectClassHandle(),
+    _attributeHandle(),
+    _federateHandleVector()
+  { }
+  void setObjectClassHandle(const ObjectClassHandle& value)
+  { _objectClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectClassHandle(ObjectClassHandle&& value)
+  { _objectClassHandle = std::move(value); }
+#endif
+  ObjectClassHandle& getObjectClassHandle()
+  { return _objectClassHandle; }
+  const ObjectClassHandle& getObjectClassHandle() const
+  { return _objectClassHandle; }
+
+  void setAttributeHandle(const AttributeHandle& value)
+  { _attributeHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setAttributeHandle(AttributeHandle&& value)
+  { _attributeHandle = std::move(value); }
+#endif
+  AttributeHandle& getAttributeHandle()
+  { return _attributeHandle; }
+  const AttributeHandle& getAttributeHandle() const
+  { return _attributeHandle; }
+
+  void setFederateHandleVector(const FederateHandleVector& value)
+  { _federateHandleVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandleVector(FederateHandleVector&& value)
+  { _federateHandleVector = std::move(value); }
+#endif
+  FederateHandleVector& getFederateHandleVector()
+  { return _federateHandleVector; }
+  const FederateHandleVector& getFederateHandleVector() const
+  { return _federateHandleVector; }
+
+  FederationSaveObjectClassSubscription& swap(FederationSaveObjectClassSubscription& rhs)
   {
-    return *_impl;
+    std::swap(_objectClassHandle, rhs._objectClassHandle);
+    std::swap(_attributeHandle, rhs._attributeHandle);
+    _federateHandleVector.swap(rhs._federateHandleVector);
+    return *this;
   }
-
-  Implementation& getImpl()
+  bool operator==(const FederationSaveObjectClassSubscription& rhs) const
   {
-    if (1 < Referenced::count(_impl.get()))
-      _impl = new Implementation(*_impl);
-    return *_impl;
+    if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
+    if (getAttributeHandle() != rhs.getAttributeHandle()) return false;
+    if (getFederateHandleVector() != rhs.getFederateHandleVector()) return false;
+    return true;
   }
+  bool operator<(const FederationSaveObjectClassSubscription& rhs) const
+  {
+    if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
+    if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
+    if (getAttributeHandle() < rhs.getAttributeHandle()) return true;
+    if (rhs.getAttributeHandle() < getAttributeHandle()) return false;
+    if (getFederateHandleVector() < rhs.getFederateHandleVector()) return true;
+    if (rhs.getFederateHandleVector() < getFederateHandleVector()) return false;
+    return false;
+  }
+  bool operator!=(const FederationSaveObjectClassSubscription& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const FederationSaveObjectClassSubscription& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const FederationSaveObjectClassSubscription& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const FederationSaveObjectClassSubscription& rhs) const
+  { return !operator>(rhs); }
+private:
+  ObjectClassHandle _objectClassHandle;
+  AttributeHandle _attributeHandle;
+  FederateHandleVector _federateHandleVector;
+};
 
-  SharedPtr<Implementation> _impl;
+typedef std::vector<FederationSaveObjectClassSubscription> FederationSaveObjectClassSubscriptionVector;
+
+class OPENRTI_API FederationSaveHeader {
+public:
+  FederationSaveHeader() :
+    _federationName(),
+    _logicalTimeFactoryName(),
+    _label(),
+    _federateVector(),
+    _interactionClassSubscriptionVector(),
+    _objectClassSubscriptionVector(),
+    _numObjectInstances()
+  { }
+  void setFederationName(const String& value)
+  { _federationName = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationName(String&& value)
+  { _federationName = std::move(value); }
+#endif
+  String& getFederationName()
+  { return _federationName; }
+  const String& getFederationName() const
+  { return _federationName; }
+
+  void setLogicalTimeFactoryName(const String& value)
+  { _logicalTimeFactoryName = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setLogicalTimeFactoryName(String&& value)
+  { _logicalTimeFactoryName = std::move(value); }
+#endif
+  String& getLogicalTimeFactoryName()
+  { return _logicalTimeFactoryName; }
+  const String& getLogicalTimeFactoryName() const
+  { return _logicalTimeFactoryName; }
+
+  void setLabel(const String& value)
+  { _label = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setLabel(String&& value)
+  { _label = std::move(value); }
+#endif
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
+
+  void setFederateVector(const FederationSaveFederateVector& value)
+  { _federateVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateVector(FederationSaveFederateVector&& value)
+  { _federateVector = std::move(value); }
+#endif
+  FederationSaveFederateVector& getFederateVector()
+  { return _federateVector; }
+  const FederationSaveFederateVector& getFederateVector() const
+  { return _federateVector; }
+
+  void setInteractionClassSubscriptionVector(const FederationSaveInteractionClassSubscriptionVector& value)
+  { _interactionClassSubscriptionVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setInteractionClassSubscriptionVector(FederationSaveInteractionClassSubscriptionVector&& value)
+  { _interactionClassSubscriptionVector = std::move(value); }
+#endif
+  FederationSaveInteractionClassSubscriptionVector& getInteractionClassSubscriptionVector()
+  { return _interactionClassSubscriptionVector; }
+  const FederationSaveInteractionClassSubscriptionVector& getInteractionClassSubscriptionVector() const
+  { return _interactionClassSubscriptionVector; }
+
+  void setObjectClassSubscriptionVector(const FederationSaveObjectClassSubscriptionVector& value)
+  { _objectClassSubscriptionVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectClassSubscriptionVector(FederationSaveObjectClassSubscriptionVector&& value)
+  { _objectClassSubscriptionVector = std::move(value); }
+#endif
+  FederationSaveObjectClassSubscriptionVector& getObjectClassSubscriptionVector()
+  { return _objectClassSubscriptionVector; }
+  const FederationSaveObjectClassSubscriptionVector& getObjectClassSubscriptionVector() const
+  { return _objectClassSubscriptionVector; }
+
+  void setNumObjectInstances(const Unsigned& value)
+  { _numObjectInstances = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setNumObjectInstances(Unsigned&& value)
+  { _numObjectInstances = std::move(value); }
+#endif
+  Unsigned& getNumObjectInstances()
+  { return _numObjectInstances; }
+  const Unsigned& getNumObjectInstances() const
+  { return _numObjectInstances; }
+
+  FederationSaveHeader& swap(FederationSaveHeader& rhs)
+  {
+    _federationName.swap(rhs._federationName);
+    _logicalTimeFactoryName.swap(rhs._logicalTimeFactoryName);
+    _label.swap(rhs._label);
+    _federateVector.swap(rhs._federateVector);
+    _interactionClassSubscriptionVector.swap(rhs._interactionClassSubscriptionVector);
+    _objectClassSubscriptionVector.swap(rhs._objectClassSubscriptionVector);
+    std::swap(_numObjectInstances, rhs._numObjectInstances);
+    return *this;
+  }
+  bool operator==(const FederationSaveHeader& rhs) const
+  {
+    if (getFederationName() != rhs.getFederationName()) return false;
+    if (getLogicalTimeFactoryName() != rhs.getLogicalTimeFactoryName()) return false;
+    if (getLabel() != rhs.getLabel()) return false;
+    if (getFederateVector() != rhs.getFederateVector()) return false;
+    if (getInteractionClassSubscriptionVector() != rhs.getInteractionClassSubscriptionVector()) return false;
+    if (getObjectClassSubscriptionVector() != rhs.getObjectClassSubscriptionVector()) return false;
+    if (getNumObjectInstances() != rhs.getNumObjectInstances()) return false;
+    return true;
+  }
+  bool operator<(const FederationSaveHeader& rhs) const
+  {
+    if (getFederationName() < rhs.getFederationName()) return true;
+    if (rhs.getFederationName() < getFederationName()) return false;
+    if (getLogicalTimeFactoryName() < rhs.getLogicalTimeFactoryName()) return true;
+    if (rhs.getLogicalTimeFactoryName() < getLogicalTimeFactoryName()) return false;
+    if (getLabel() < rhs.getLabel()) return true;
+    if (rhs.getLabel() < getLabel()) return false;
+    if (getFederateVector() < rhs.getFederateVector()) return true;
+    if (rhs.getFederateVector() < getFederateVector()) return false;
+    if (getInteractionClassSubscriptionVector() < rhs.getInteractionClassSubscriptionVector()) return true;
+    if (rhs.getInteractionClassSubscriptionVector() < getInteractionClassSubscriptionVector()) return false;
+    if (getObjectClassSubscriptionVector() < rhs.getObjectClassSubscriptionVector()) return true;
+    if (rhs.getObjectClassSubscriptionVector() < getObjectClassSubscriptionVector()) return false;
+    if (getNumObjectInstances() < rhs.getNumObjectInstances()) return true;
+    if (rhs.getNumObjectInstances() < getNumObjectInstances()) return false;
+    return false;
+  }
+  bool operator!=(const FederationSaveHeader& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const FederationSaveHeader& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const FederationSaveHeader& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const FederationSaveHeader& rhs) const
+  { return !operator>(rhs); }
+private:
+  String _federationName;
+  String _logicalTimeFactoryName;
+  String _label;
+  FederationSaveFederateVector _federateVector;
+  FederationSaveInteractionClassSubscriptionVector _interactionClassSubscriptionVector;
+  FederationSaveObjectClassSubscriptionVector _objectClassSubscriptionVector;
+  Unsigned _numObjectInstances;
 };
 
-typedef std::vector<FOMStringDimension> FOMStringDimensionList;
+typedef std::pair<AttributeHandle, FederateHandle> AttributeHandleFederateHandlePair;
 
-class OPENRTI_API FOMStringRoutingSpace {
+typedef std::vector<AttributeHandleFederateHandlePair> AttributeHandleFederateHandlePairVector;
+
+class OPENRTI_API FederationSaveObjectInstance {
 public:
-  FOMStringRoutingSpace() : 
-    _impl(new Implementation())
+  FederationSaveObjectInstance() :
+    _objectInstanceHandle(),
+    _name(),
+    _objectClassHandle(),
+    _attributeHandleFederateHandlePairVector()
   { }
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
+#endif
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
+
   void setName(const String& value)
-  { getImpl()._name = value; }
+  { _name = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
   void setName(String&& value)
-  { getImpl()._name = std::move(value); }
+  { _name = std::move(value); }
 #endif
   String& getName()
-  { return getImpl()._name; }
+  { return _name; }
   const String& getName() const
-  { return getConstImpl()._name; }
+  { return _name; }
 
-  void setDimensionSet(const StringSet& value)
-  { getImpl()._dimensionSet = value; }
+  void setObjectClassHandle(const ObjectClassHandle& value)
+  { _objectClassHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setDimensionSet(StringSet&& value)
-  { getImpl()._dimensionSet = std::move(value); }
+  void setObjectClassHandle(ObjectClassHandle&& value)
+  { _objectClassHandle = std::move(value); }
 #endif
-  StringSet& getDimensionSet()
-  { return getImpl()._dimensionSet; }
-  const StringSet& getDimensionSet() const
-  { return getConstImpl()._dimensionSet; }
+  ObjectClassHandle& getObjectClassHandle()
+  { return _objectClassHandle; }
+  const ObjectClassHandle& getObjectClassHandle() const
+  { return _objectClassHandle; }
 
-  FOMStringRoutingSpace& swap(FOMStringRoutingSpace& rhs)
+  void setAttributeHandleFederateHandlePairVector(const AttributeHandleFederateHandlePairVector& value)
+  { _attributeHandleFederateHandlePairVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setAttributeHandleFederateHandlePairVector(AttributeHandleFederateHandlePairVector&& value)
+  { _attributeHandleFederateHandlePairVector = std::move(value); }
+#endif
+  AttributeHandleFederateHandlePairVector& getAttributeHandleFederateHandlePairVector()
+  { return _attributeHandleFederateHandlePairVector; }
+  const AttributeHandleFederateHandlePairVector& getAttributeHandleFederateHandlePairVector() const
+  { return _attributeHandleFederateHandlePairVector; }
+
+  FederationSaveObjectInstance& swap(FederationSaveObjectInstance& rhs)
   {
-    _impl.swap(rhs._impl);
+    std::swap(_objectInstanceHandle, rhs._objectInstanceHandle);
+    _name.swap(rhs._name);
+    std::swap(_objectClassHandle, rhs._objectClassHandle);
+    _attributeHandleFederateHandlePairVector.swap(rhs._attributeHandleFederateHandlePairVector);
     return *this;
   }
-  bool operator==(const FOMStringRoutingSpace& rhs) const
+  bool operator==(const FederationSaveObjectInstance& rhs) const
   {
-    if (_impl.get() == rhs._impl.get())
-      return true;
+    if (getObjectInstanceHandle() != rhs.getObjectInstanceHandle()) return false;
     if (getName() != rhs.getName()) return false;
-    if (getDimensionSet() != rhs.getDimensionSet()) return false;
+    if (getObjectClassHandle() != rhs.getObjectClassHandle()) return false;
+    if (getAttributeHandleFederateHandlePairVector() != rhs.getAttributeHandleFederateHandlePairVector()) return false;
     return true;
   }
-  bool operator<(const FOMStringRoutingSpace& rhs) const
+  bool operator<(const FederationSaveObjectInstance& rhs) const
   {
-    if (_impl.get() == rhs._impl.get())
-      return false;
+    if (getObjectInstanceHandle() < rhs.getObjectInstanceHandle()) return true;
+    if (rhs.getObjectInstanceHandle() < getObjectInstanceHandle()) return false;
     if (getName() < rhs.getName()) return true;
     if (rhs.getName() < getName()) return false;
-    if (getDimensionSet() < rhs.getDimensionSet()) return true;
-    if (rhs.getDimensionSet() < getDimensionSet()) return false;
+    if (getObjectClassHandle() < rhs.getObjectClassHandle()) return true;
+    if (rhs.getObjectClassHandle() < getObjectClassHandle()) return false;
+    if (getAttributeHandleFederateHandlePairVector() < rhs.getAttributeHandleFederateHandlePairVector()) return true;
+    if (rhs.getAttributeHandleFederateHandlePairVector() < getAttributeHandleFederateHandlePairVector()) return false;
     return false;
   }
-  bool operator!=(const FOMStringRoutingSpace& rhs) const
+  bool operator!=(const FederationSaveObjectInstance& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const FOMStringRoutingSpace& rhs) const
+  bool operator>(const FederationSaveObjectInstance& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const FOMStringRoutingSpace& rhs) const
+  bool operator>=(const FederationSaveObjectInstance& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const FOMStringRoutingSpace& rhs) const
+  bool operator<=(const FederationSaveObjectInstance& rhs) const
   { return !operator>(rhs); }
 private:
-  struct OPENRTI_API Implementation : public Referenced {
-    Implementation() :
-      _name(),
-      _dimensionSet()
-    { }
-    String _name;
-    StringSet _dimensionSet;
-  };
-
-  const Implementation& getConstImpl() const
-  {
-    return *_impl;
-  }
-
-  Implementation& getImpl()
-  {
-    if (1 < Referenced::count(_impl.get()))
-      _impl = new Implementation(*_impl);
-    return *_impl;
-  }
-
-  SharedPtr<Implementation> _impl;
+  ObjectInstanceHandle _objectInstanceHandle;
+  String _name;
+  ObjectClassHandle _objectClassHandle;
+  AttributeHandleFederateHandlePairVector _attributeHandleFederateHandlePairVector;
 };
 
-typedef std::vector<FOMStringRoutingSpace> FOMStringRoutingSpaceList;
+typedef std::vector<FederationSaveObjectInstance> FederationSaveObjectInstanceVector;
 
-class OPENRTI_API FOMStringParameter {
+typedef std::map<String, StringVector> ConfigurationParameterMap;
+
+class OPENRTI_API FOMStringTransportationType {
 public:
-  FOMStringParameter() : 
+  FOMStringTransportationType() : 
     _impl(new Implementation())
   { }
   void setName(const String& value)
@@ -978,19 +1452,19 @@ public:
   const String& getName() const
   { return getConstImpl()._name; }
 
-  FOMStringParameter& swap(FOMStringParameter& rhs)
+  FOMStringTransportationType& swap(FOMStringTransportationType& rhs)
   {
     _impl.swap(rhs._impl);
     return *this;
   }
-  bool operator==(const FOMStringParameter& rhs) const
+  bool operator==(const FOMStringTransportationType& rhs) const
   {
     if (_impl.get() == rhs._impl.get())
       return true;
     if (getName() != rhs.getName()) return false;
     return true;
   }
-  bool operator<(const FOMStringParameter& rhs) const
+  bool operator<(const FOMStringTransportationType& rhs) const
   {
     if (_impl.get() == rhs._impl.get())
       return false;
@@ -998,13 +1472,13 @@ public:
     if (rhs.getName() < getName()) return false;
     return false;
   }
-  bool operator!=(const FOMStringParameter& rhs) const
+  bool operator!=(const FOMStringTransportationType& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const FOMStringParameter& rhs) const
+  bool operator>(const FOMStringTransportationType& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const FOMStringParameter& rhs) const
+  bool operator>=(const FOMStringTransportationType& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const FOMStringParameter& rhs) const
+  bool operator<=(const FOMStringTransportationType& rhs) const
   { return !operator>(rhs); }
 private:
   struct OPENRTI_API Implementation : public Referenced {
@@ -1029,25 +1503,264 @@ private:
   SharedPtr<Implementation> _impl;
 };
 
-typedef std::vector<FOMStringParameter> FOMStringParameterList;
+typedef std::vector<FOMStringTransportationType> FOMStringTransportationTypeList;
 
-class OPENRTI_API FOMStringInteractionClass {
+class OPENRTI_API FOMStringDimension {
 public:
-  FOMStringInteractionClass() : 
+  FOMStringDimension() : 
     _impl(new Implementation())
   { }
-  void setName(const StringVector& value)
+  void setName(const String& value)
   { getImpl()._name = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setName(StringVector&& value)
+  void setName(String&& value)
   { getImpl()._name = std::move(value); }
 #endif
-  StringVector& getName()
+  String& getName()
   { return getImpl()._name; }
-  const StringVector& getName() const
+  const String& getName() const
   { return getConstImpl()._name; }
 
-  void setOrderType(const String& value)
+  void setUpperBound(const Unsigned& value)
+  { getImpl()._upperBound = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setUpperBound(Unsigned&& value)
+  { getImpl()._upperBound = std::move(value); }
+#endif
+  Unsigned& getUpperBound()
+  { return getImpl()._upperBound; }
+  const Unsigned& getUpperBound() const
+  { return getConstImpl()._upperBound; }
+
+  FOMStringDimension& swap(FOMStringDimension& rhs)
+  {
+    _impl.swap(rhs._impl);
+    return *this;
+  }
+  bool operator==(const FOMStringDimension& rhs) const
+  {
+    if (_impl.get() == rhs._impl.get())
+      return true;
+    if (getName() != rhs.getName()) return false;
+    if (getUpperBound() != rhs.getUpperBound()) return false;
+    return true;
+  }
+  bool operator<(const FOMStringDimension& rhs) const
+  {
+    if (_impl.get() == rhs._impl.get())
+      return false;
+    if (getName() < rhs.getName()) return true;
+    if (rhs.getName() < getName()) return false;
+    if (getUpperBound() < rhs.getUpperBound()) return true;
+    if (rhs.getUpperBound() < getUpperBound()) return false;
+    return false;
+  }
+  bool operator!=(const FOMStringDimension& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const FOMStringDimension& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const FOMStringDimension& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const FOMStringDimension& rhs) const
+  { return !operator>(rhs); }
+private:
+  struct OPENRTI_API Implementation : public Referenced {
+    Implementation() :
+      _name(),
+      _upperBound()
+    { }
+    String _name;
+    Unsigned _upperBound;
+  };
+
+  const Implementation& getConstImpl() const
+  {
+    return *_impl;
+  }
+
+  Implementation& getImpl()
+  {
+    if (1 < Referenced::count(_impl.get()))
+      _impl = new Implementation(*_impl);
+    return *_impl;
+  }
+
+  SharedPtr<Implementation> _impl;
+};
+
+typedef std::vector<FOMStringDimension> FOMStringDimensionList;
+
+class OPENRTI_API FOMStringRoutingSpace {
+public:
+  FOMStringRoutingSpace() : 
+    _impl(new Implementation())
+  { }
+  void setName(const String& value)
+  { getImpl()._name = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setName(String&& value)
+  { getImpl()._name = std::move(value); }
+#endif
+  String& getName()
+  { return getImpl()._name; }
+  const String& getName() const
+  { return getConstImpl()._name; }
+
+  void setDimensionSet(const StringSet& value)
+  { getImpl()._dimensionSet = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setDimensionSet(StringSet&& value)
+  { getImpl()._dimensionSet = std::move(value); }
+#endif
+  StringSet& getDimensionSet()
+  { return getImpl()._dimensionSet; }
+  const StringSet& getDimensionSet() const
+  { return getConstImpl()._dimensionSet; }
+
+  FOMStringRoutingSpace& swap(FOMStringRoutingSpace& rhs)
+  {
+    _impl.swap(rhs._impl);
+    return *this;
+  }
+  bool operator==(const FOMStringRoutingSpace& rhs) const
+  {
+    if (_impl.get() == rhs._impl.get())
+      return true;
+    if (getName() != rhs.getName()) return false;
+    if (getDimensionSet() != rhs.getDimensionSet()) return false;
+    return true;
+  }
+  bool operator<(const FOMStringRoutingSpace& rhs) const
+  {
+    if (_impl.get() == rhs._impl.get())
+      return false;
+    if (getName() < rhs.getName()) return true;
+    if (rhs.getName() < getName()) return false;
+    if (getDimensionSet() < rhs.getDimensionSet()) return true;
+    if (rhs.getDimensionSet() < getDimensionSet()) return false;
+    return false;
+  }
+  bool operator!=(const FOMStringRoutingSpace& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const FOMStringRoutingSpace& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const FOMStringRoutingSpace& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const FOMStringRoutingSpace& rhs) const
+  { return !operator>(rhs); }
+private:
+  struct OPENRTI_API Implementation : public Referenced {
+    Implementation() :
+      _name(),
+      _dimensionSet()
+    { }
+    String _name;
+    StringSet _dimensionSet;
+  };
+
+  const Implementation& getConstImpl() const
+  {
+    return *_impl;
+  }
+
+  Implementation& getImpl()
+  {
+    if (1 < Referenced::count(_impl.get()))
+      _impl = new Implementation(*_impl);
+    return *_impl;
+  }
+
+  SharedPtr<Implementation> _impl;
+};
+
+typedef std::vector<FOMStringRoutingSpace> FOMStringRoutingSpaceList;
+
+class OPENRTI_API FOMStringParameter {
+public:
+  FOMStringParameter() : 
+    _impl(new Implementation())
+  { }
+  void setName(const String& value)
+  { getImpl()._name = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setName(String&& value)
+  { getImpl()._name = std::move(value); }
+#endif
+  String& getName()
+  { return getImpl()._name; }
+  const String& getName() const
+  { return getConstImpl()._name; }
+
+  FOMStringParameter& swap(FOMStringParameter& rhs)
+  {
+    _impl.swap(rhs._impl);
+    return *this;
+  }
+  bool operator==(const FOMStringParameter& rhs) const
+  {
+    if (_impl.get() == rhs._impl.get())
+      return true;
+    if (getName() != rhs.getName()) return false;
+    return true;
+  }
+  bool operator<(const FOMStringParameter& rhs) const
+  {
+    if (_impl.get() == rhs._impl.get())
+      return false;
+    if (getName() < rhs.getName()) return true;
+    if (rhs.getName() < getName()) return false;
+    return false;
+  }
+  bool operator!=(const FOMStringParameter& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const FOMStringParameter& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const FOMStringParameter& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const FOMStringParameter& rhs) const
+  { return !operator>(rhs); }
+private:
+  struct OPENRTI_API Implementation : public Referenced {
+    Implementation() :
+      _name()
+    { }
+    String _name;
+  };
+
+  const Implementation& getConstImpl() const
+  {
+    return *_impl;
+  }
+
+  Implementation& getImpl()
+  {
+    if (1 < Referenced::count(_impl.get()))
+      _impl = new Implementation(*_impl);
+    return *_impl;
+  }
+
+  SharedPtr<Implementation> _impl;
+};
+
+typedef std::vector<FOMStringParameter> FOMStringParameterList;
+
+class OPENRTI_API FOMStringInteractionClass {
+public:
+  FOMStringInteractionClass() : 
+    _impl(new Implementation())
+  { }
+  void setName(const StringVector& value)
+  { getImpl()._name = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setName(StringVector&& value)
+  { getImpl()._name = std::move(value); }
+#endif
+  StringVector& getName()
+  { return getImpl()._name; }
+  const StringVector& getName() const
+  { return getConstImpl()._name; }
+
+  void setOrderType(const String& value)
   { getImpl()._orderType = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
   void setOrderType(String&& value)
@@ -1584,6 +2297,17 @@ public:
   const String& getContent() const
   { return getConstImpl()._content; }
 
+  void setContentHash(const String& value)
+  { getImpl()._contentHash = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setContentHash(String&& value)
+  { getImpl()._contentHash = std::move(value); }
+#endif
+  String& getContentHash()
+  { return getImpl()._contentHash; }
+  const String& getContentHash() const
+  { return getConstImpl()._contentHash; }
+
   void setTransportationTypeList(const FOMStringTransportationTypeList& value)
   { getImpl()._transportationTypeList = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -1693,6 +2417,7 @@ public:
     if (_impl.get() == rhs._impl.get())
       return true;
     if (getContent() != rhs.getContent()) return false;
+    if (getContentHash() != rhs.getContentHash()) return false;
     if (getTransportationTypeList() != rhs.getTransportationTypeList()) return false;
     if (getDimensionList() != rhs.getDimensionList()) return false;
     if (getRoutingSpaceList() != rhs.getRoutingSpaceList()) return false;
@@ -1710,6 +2435,8 @@ public:
       return false;
     if (getContent() < rhs.getContent()) return true;
     if (rhs.getContent() < getContent()) return false;
+    if (getContentHash() < rhs.getContentHash()) return true;
+    if (rhs.getContentHash() < getContentHash()) return false;
     if (getTransportationTypeList() < rhs.getTransportationTypeList()) return true;
     if (rhs.getTransportationTypeList() < getTransportationTypeList()) return false;
     if (getDimensionList() < rhs.getDimensionList()) return true;
@@ -1742,6 +2469,7 @@ private:
   struct OPENRTI_API Implementation : public Referenced {
     Implementation() :
       _content(),
+      _contentHash(),
       _transportationTypeList(),
       _dimensionList(),
       _routingSpaceList(),
@@ -1753,6 +2481,7 @@ private:
       _artificialObjectRoot()
     { }
     String _content;
+    String _contentHash;
     FOMStringTransportationTypeList _transportationTypeList;
     FOMStringDimensionList _dimensionList;
     FOMStringRoutingSpaceList _routingSpaceList;
@@ -3259,31 +3988,91 @@ private:
   FederationExecutionInformationVector _federationExecutionInformationVector;
 };
 
-class OPENRTI_API InsertFederationExecutionMessage : public AbstractMessage {
+class OPENRTI_API MetricsRequestMessage : public AbstractMessage {
 public:
-  InsertFederationExecutionMessage();
-  virtual ~InsertFederationExecutionMessage();
+  MetricsRequestMessage();
+  virtual ~MetricsRequestMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const InsertFederationExecutionMessage& rhs) const;
-  bool operator<(const InsertFederationExecutionMessage& rhs) const;
-  bool operator!=(const InsertFederationExecutionMessage& rhs) const
+  bool operator==(const MetricsRequestMessage& rhs) const;
+  bool operator<(const MetricsRequestMessage& rhs) const;
+  bool operator!=(const MetricsRequestMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const InsertFederationExecutionMessage& rhs) const
+  bool operator>(const MetricsRequestMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const InsertFederationExecutionMessage& rhs) const
+  bool operator>=(const MetricsRequestMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const InsertFederationExecutionMessage& rhs) const
+  bool operator<=(const MetricsRequestMessage& rhs) const
   { return !operator>(rhs); }
 
-  void setFederationHandle(const FederationHandle& value)
-  { _federationHandle = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setFederationHandle(FederationHandle&& value)
+private:
+};
+
+class OPENRTI_API MetricsResponseMessage : public AbstractMessage {
+public:
+  MetricsResponseMessage();
+  virtual ~MetricsResponseMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const MetricsResponseMessage& rhs) const;
+  bool operator<(const MetricsResponseMessage& rhs) const;
+  bool operator!=(const MetricsResponseMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const MetricsResponseMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const MetricsResponseMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const MetricsResponseMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setMetrics(const String& value)
+  { _metrics = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setMetrics(String&& value)
+  { _metrics = std::move(value); }
+#endif
+  String& getMetrics()
+  { return _metrics; }
+  const String& getMetrics() const
+  { return _metrics; }
+
+private:
+  String _metrics;
+};
+
+class OPENRTI_API InsertFederationExecutionMessage : public AbstractMessage {
+public:
+  InsertFederationExecutionMessage();
+  virtual ~InsertFederationExecutionMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const InsertFederationExecutionMessage& rhs) const;
+  bool operator<(const InsertFederationExecutionMessage& rhs) const;
+  bool operator!=(const InsertFederationExecutionMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const InsertFederationExecutionMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const InsertFederationExecutionMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const InsertFederationExecutionMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
   { _federationHandle = std::move(value); }
 #endif
   FederationHandle& getFederationHandle()
@@ -3552,6 +4341,17 @@ public:
   const FOMStringModuleList& getFOMStringModuleList() const
   { return _fOMStringModuleList; }
 
+  void setFOMModuleContentHashVector(const StringVector& value)
+  { _fOMModuleContentHashVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFOMModuleContentHashVector(StringVector&& value)
+  { _fOMModuleContentHashVector = std::move(value); }
+#endif
+  StringVector& getFOMModuleContentHashVector()
+  { return _fOMModuleContentHashVector; }
+  const StringVector& getFOMModuleContentHashVector() const
+  { return _fOMModuleContentHashVector; }
+
   void setConfigurationParameterMap(const ConfigurationParameterMap& value)
   { _configurationParameterMap = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -3568,6 +4368,7 @@ private:
   String _federateType;
   String _federateName;
   FOMStringModuleList _fOMStringModuleList;
+  StringVector _fOMModuleContentHashVector;
   ConfigurationParameterMap _configurationParameterMap;
 };
 
@@ -4315,25 +5116,25 @@ private:
   FederateHandleBoolPairVector _federateHandleBoolPairVector;
 };
 
-class OPENRTI_API EnableTimeRegulationRequestMessage : public AbstractMessage {
+class OPENRTI_API RequestFederationSaveMessage : public AbstractMessage {
 public:
-  EnableTimeRegulationRequestMessage();
-  virtual ~EnableTimeRegulationRequestMessage();
+  RequestFederationSaveMessage();
+  virtual ~RequestFederationSaveMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const EnableTimeRegulationRequestMessage& rhs) const;
-  bool operator<(const EnableTimeRegulationRequestMessage& rhs) const;
-  bool operator!=(const EnableTimeRegulationRequestMessage& rhs) const
+  bool operator==(const RequestFederationSaveMessage& rhs) const;
+  bool operator<(const RequestFederationSaveMessage& rhs) const;
+  bool operator!=(const RequestFederationSaveMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const EnableTimeRegulationRequestMessage& rhs) const
+  bool operator>(const RequestFederationSaveMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const EnableTimeRegulationRequestMessage& rhs) const
+  bool operator>=(const RequestFederationSaveMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const EnableTimeRegulationRequestMessage& rhs) const
+  bool operator<=(const RequestFederationSaveMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4358,6 +5159,17 @@ public:
   const FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
+  void setLabel(const String& value)
+  { _label = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setLabel(String&& value)
+  { _label = std::move(value); }
+#endif
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
+
   void setTimeStamp(const VariableLengthData& value)
   { _timeStamp = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -4369,43 +5181,44 @@ public:
   const VariableLengthData& getTimeStamp() const
   { return _timeStamp; }
 
-  void setCommitId(const Unsigned& value)
-  { _commitId = value; }
+  void setTimeStampValid(const Bool& value)
+  { _timeStampValid = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setCommitId(Unsigned&& value)
-  { _commitId = std::move(value); }
+  void setTimeStampValid(Bool&& value)
+  { _timeStampValid = std::move(value); }
 #endif
-  Unsigned& getCommitId()
-  { return _commitId; }
-  const Unsigned& getCommitId() const
-  { return _commitId; }
+  Bool& getTimeStampValid()
+  { return _timeStampValid; }
+  const Bool& getTimeStampValid() const
+  { return _timeStampValid; }
 
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
+  String _label;
   VariableLengthData _timeStamp;
-  Unsigned _commitId;
+  Bool _timeStampValid;
 };
 
-class OPENRTI_API EnableTimeRegulationResponseMessage : public AbstractMessage {
+class OPENRTI_API InitiateFederateSaveMessage : public AbstractMessage {
 public:
-  EnableTimeRegulationResponseMessage();
-  virtual ~EnableTimeRegulationResponseMessage();
+  InitiateFederateSaveMessage();
+  virtual ~InitiateFederateSaveMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const EnableTimeRegulationResponseMessage& rhs) const;
-  bool operator<(const EnableTimeRegulationResponseMessage& rhs) const;
-  bool operator!=(const EnableTimeRegulationResponseMessage& rhs) const
+  bool operator==(const InitiateFederateSaveMessage& rhs) const;
+  bool operator<(const InitiateFederateSaveMessage& rhs) const;
+  bool operator!=(const InitiateFederateSaveMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const EnableTimeRegulationResponseMessage& rhs) const
+  bool operator>(const InitiateFederateSaveMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const EnableTimeRegulationResponseMessage& rhs) const
+  bool operator>=(const InitiateFederateSaveMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const EnableTimeRegulationResponseMessage& rhs) const
+  bool operator<=(const InitiateFederateSaveMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4419,27 +5232,27 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setFederateHandle(const FederateHandle& value)
-  { _federateHandle = value; }
+  void setLabel(const String& value)
+  { _label = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setFederateHandle(FederateHandle&& value)
-  { _federateHandle = std::move(value); }
+  void setLabel(String&& value)
+  { _label = std::move(value); }
 #endif
-  FederateHandle& getFederateHandle()
-  { return _federateHandle; }
-  const FederateHandle& getFederateHandle() const
-  { return _federateHandle; }
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
 
-  void setRespondingFederateHandle(const FederateHandle& value)
-  { _respondingFederateHandle = value; }
+  void setTimeStamp(const VariableLengthData& value)
+  { _timeStamp = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setRespondingFederateHandle(FederateHandle&& value)
-  { _respondingFederateHandle = std::move(value); }
+  void setTimeStamp(VariableLengthData&& value)
+  { _timeStamp = std::move(value); }
 #endif
-  FederateHandle& getRespondingFederateHandle()
-  { return _respondingFederateHandle; }
-  const FederateHandle& getRespondingFederateHandle() const
-  { return _respondingFederateHandle; }
+  VariableLengthData& getTimeStamp()
+  { return _timeStamp; }
+  const VariableLengthData& getTimeStamp() const
+  { return _timeStamp; }
 
   void setTimeStampValid(const Bool& value)
   { _timeStampValid = value; }
@@ -4452,44 +5265,32 @@ public:
   const Bool& getTimeStampValid() const
   { return _timeStampValid; }
 
-  void setTimeStamp(const VariableLengthData& value)
-  { _timeStamp = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTimeStamp(VariableLengthData&& value)
-  { _timeStamp = std::move(value); }
-#endif
-  VariableLengthData& getTimeStamp()
-  { return _timeStamp; }
-  const VariableLengthData& getTimeStamp() const
-  { return _timeStamp; }
-
 private:
   FederationHandle _federationHandle;
-  FederateHandle _federateHandle;
-  FederateHandle _respondingFederateHandle;
-  Bool _timeStampValid;
+  String _label;
   VariableLengthData _timeStamp;
+  Bool _timeStampValid;
 };
 
-class OPENRTI_API DisableTimeRegulationRequestMessage : public AbstractMessage {
+class OPENRTI_API FederateSaveBegunMessage : public AbstractMessage {
 public:
-  DisableTimeRegulationRequestMessage();
-  virtual ~DisableTimeRegulationRequestMessage();
+  FederateSaveBegunMessage();
+  virtual ~FederateSaveBegunMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const DisableTimeRegulationRequestMessage& rhs) const;
-  bool operator<(const DisableTimeRegulationRequestMessage& rhs) const;
-  bool operator!=(const DisableTimeRegulationRequestMessage& rhs) const
+  bool operator==(const FederateSaveBegunMessage& rhs) const;
+  bool operator<(const FederateSaveBegunMessage& rhs) const;
+  bool operator!=(const FederateSaveBegunMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const DisableTimeRegulationRequestMessage& rhs) const
+  bool operator>(const FederateSaveBegunMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const DisableTimeRegulationRequestMessage& rhs) const
+  bool operator>=(const FederateSaveBegunMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const DisableTimeRegulationRequestMessage& rhs) const
+  bool operator<=(const FederateSaveBegunMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4519,25 +5320,25 @@ private:
   FederateHandle _federateHandle;
 };
 
-class OPENRTI_API CommitLowerBoundTimeStampMessage : public AbstractMessage {
+class OPENRTI_API FederateSaveCompleteMessage : public AbstractMessage {
 public:
-  CommitLowerBoundTimeStampMessage();
-  virtual ~CommitLowerBoundTimeStampMessage();
+  FederateSaveCompleteMessage();
+  virtual ~FederateSaveCompleteMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const CommitLowerBoundTimeStampMessage& rhs) const;
-  bool operator<(const CommitLowerBoundTimeStampMessage& rhs) const;
-  bool operator!=(const CommitLowerBoundTimeStampMessage& rhs) const
+  bool operator==(const FederateSaveCompleteMessage& rhs) const;
+  bool operator<(const FederateSaveCompleteMessage& rhs) const;
+  bool operator!=(const FederateSaveCompleteMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const CommitLowerBoundTimeStampMessage& rhs) const
+  bool operator>(const FederateSaveCompleteMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const CommitLowerBoundTimeStampMessage& rhs) const
+  bool operator>=(const FederateSaveCompleteMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const CommitLowerBoundTimeStampMessage& rhs) const
+  bool operator<=(const FederateSaveCompleteMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4562,66 +5363,54 @@ public:
   const FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
-  void setTimeStamp(const VariableLengthData& value)
-  { _timeStamp = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTimeStamp(VariableLengthData&& value)
-  { _timeStamp = std::move(value); }
-#endif
-  VariableLengthData& getTimeStamp()
-  { return _timeStamp; }
-  const VariableLengthData& getTimeStamp() const
-  { return _timeStamp; }
-
-  void setCommitType(const LowerBoundTimeStampCommitType& value)
-  { _commitType = value; }
+  void setSuccessful(const Bool& value)
+  { _successful = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setCommitType(LowerBoundTimeStampCommitType&& value)
-  { _commitType = std::move(value); }
+  void setSuccessful(Bool&& value)
+  { _successful = std::move(value); }
 #endif
-  LowerBoundTimeStampCommitType& getCommitType()
-  { return _commitType; }
-  const LowerBoundTimeStampCommitType& getCommitType() const
-  { return _commitType; }
+  Bool& getSuccessful()
+  { return _successful; }
+  const Bool& getSuccessful() const
+  { return _successful; }
 
-  void setCommitId(const Unsigned& value)
-  { _commitId = value; }
+  void setSaveFailureReason(const SaveFailureReason& value)
+  { _saveFailureReason = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setCommitId(Unsigned&& value)
-  { _commitId = std::move(value); }
+  void setSaveFailureReason(SaveFailureReason&& value)
+  { _saveFailureReason = std::move(value); }
 #endif
-  Unsigned& getCommitId()
-  { return _commitId; }
-  const Unsigned& getCommitId() const
-  { return _commitId; }
+  SaveFailureReason& getSaveFailureReason()
+  { return _saveFailureReason; }
+  const SaveFailureReason& getSaveFailureReason() const
+  { return _saveFailureReason; }
 
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
-  VariableLengthData _timeStamp;
-  LowerBoundTimeStampCommitType _commitType;
-  Unsigned _commitId;
+  Bool _successful;
+  SaveFailureReason _saveFailureReason;
 };
 
-class OPENRTI_API CommitLowerBoundTimeStampResponseMessage : public AbstractMessage {
+class OPENRTI_API FederationSavedMessage : public AbstractMessage {
 public:
-  CommitLowerBoundTimeStampResponseMessage();
-  virtual ~CommitLowerBoundTimeStampResponseMessage();
+  FederationSavedMessage();
+  virtual ~FederationSavedMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const CommitLowerBoundTimeStampResponseMessage& rhs) const;
-  bool operator<(const CommitLowerBoundTimeStampResponseMessage& rhs) const;
-  bool operator!=(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+  bool operator==(const FederationSavedMessage& rhs) const;
+  bool operator<(const FederationSavedMessage& rhs) const;
+  bool operator!=(const FederationSavedMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+  bool operator>(const FederationSavedMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+  bool operator>=(const FederationSavedMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+  bool operator<=(const FederationSavedMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4635,65 +5424,65 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setFederateHandle(const FederateHandle& value)
-  { _federateHandle = value; }
+  void setLabel(const String& value)
+  { _label = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setFederateHandle(FederateHandle&& value)
-  { _federateHandle = std::move(value); }
+  void setLabel(String&& value)
+  { _label = std::move(value); }
 #endif
-  FederateHandle& getFederateHandle()
-  { return _federateHandle; }
-  const FederateHandle& getFederateHandle() const
-  { return _federateHandle; }
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
 
-  void setSendingFederateHandle(const FederateHandle& value)
-  { _sendingFederateHandle = value; }
+  void setSuccessful(const Bool& value)
+  { _successful = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setSendingFederateHandle(FederateHandle&& value)
-  { _sendingFederateHandle = std::move(value); }
+  void setSuccessful(Bool&& value)
+  { _successful = std::move(value); }
 #endif
-  FederateHandle& getSendingFederateHandle()
-  { return _sendingFederateHandle; }
-  const FederateHandle& getSendingFederateHandle() const
-  { return _sendingFederateHandle; }
+  Bool& getSuccessful()
+  { return _successful; }
+  const Bool& getSuccessful() const
+  { return _successful; }
 
-  void setCommitId(const Unsigned& value)
-  { _commitId = value; }
+  void setSaveFailureReason(const SaveFailureReason& value)
+  { _saveFailureReason = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setCommitId(Unsigned&& value)
-  { _commitId = std::move(value); }
+  void setSaveFailureReason(SaveFailureReason&& value)
+  { _saveFailureReason = std::move(value); }
 #endif
-  Unsigned& getCommitId()
-  { return _commitId; }
-  const Unsigned& getCommitId() const
-  { return _commitId; }
+  SaveFailureReason& getSaveFailureReason()
+  { return _saveFailureReason; }
+  const SaveFailureReason& getSaveFailureReason() const
+  { return _saveFailureReason; }
 
 private:
   FederationHandle _federationHandle;
-  FederateHandle _federateHandle;
-  FederateHandle _sendingFederateHandle;
-  Unsigned _commitId;
+  String _label;
+  Bool _successful;
+  SaveFailureReason _saveFailureReason;
 };
 
-class OPENRTI_API LockedByNextMessageRequestMessage : public AbstractMessage {
+class OPENRTI_API AbortFederationSaveMessage : public AbstractMessage {
 public:
-  LockedByNextMessageRequestMessage();
-  virtual ~LockedByNextMessageRequestMessage();
+  AbortFederationSaveMessage();
+  virtual ~AbortFederationSaveMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const LockedByNextMessageRequestMessage& rhs) const;
-  bool operator<(const LockedByNextMessageRequestMessage& rhs) const;
-  bool operator!=(const LockedByNextMessageRequestMessage& rhs) const
+  bool operator==(const AbortFederationSaveMessage& rhs) const;
+  bool operator<(const AbortFederationSaveMessage& rhs) const;
+  bool operator!=(const AbortFederationSaveMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const LockedByNextMessageRequestMessage& rhs) const
+  bool operator>(const AbortFederationSaveMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const LockedByNextMessageRequestMessage& rhs) const
+  bool operator>=(const AbortFederationSaveMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const LockedByNextMessageRequestMessage& rhs) const
+  bool operator<=(const AbortFederationSaveMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4707,125 +5496,149 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setSendingFederateHandle(const FederateHandle& value)
-  { _sendingFederateHandle = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setSendingFederateHandle(FederateHandle&& value)
-  { _sendingFederateHandle = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  FederateHandle& getSendingFederateHandle()
-  { return _sendingFederateHandle; }
-  const FederateHandle& getSendingFederateHandle() const
-  { return _sendingFederateHandle; }
-
-  void setLockedByNextMessage(const Bool& value)
-  { _lockedByNextMessage = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setLockedByNextMessage(Bool&& value)
-  { _lockedByNextMessage = std::move(value); }
-#endif
-  Bool& getLockedByNextMessage()
-  { return _lockedByNextMessage; }
-  const Bool& getLockedByNextMessage() const
-  { return _lockedByNextMessage; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
 private:
   FederationHandle _federationHandle;
-  FederateHandle _sendingFederateHandle;
-  Bool _lockedByNextMessage;
+  FederateHandle _federateHandle;
 };
 
-class OPENRTI_API TimeConstrainedEnabledMessage : public AbstractMessage {
+class OPENRTI_API QueryFederationSaveStatusRequestMessage : public AbstractMessage {
 public:
-  TimeConstrainedEnabledMessage();
-  virtual ~TimeConstrainedEnabledMessage();
+  QueryFederationSaveStatusRequestMessage();
+  virtual ~QueryFederationSaveStatusRequestMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const TimeConstrainedEnabledMessage& rhs) const;
-  bool operator<(const TimeConstrainedEnabledMessage& rhs) const;
-  bool operator!=(const TimeConstrainedEnabledMessage& rhs) const
+  bool operator==(const QueryFederationSaveStatusRequestMessage& rhs) const;
+  bool operator<(const QueryFederationSaveStatusRequestMessage& rhs) const;
+  bool operator!=(const QueryFederationSaveStatusRequestMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const TimeConstrainedEnabledMessage& rhs) const
+  bool operator>(const QueryFederationSaveStatusRequestMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const TimeConstrainedEnabledMessage& rhs) const
+  bool operator>=(const QueryFederationSaveStatusRequestMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const TimeConstrainedEnabledMessage& rhs) const
+  bool operator<=(const QueryFederationSaveStatusRequestMessage& rhs) const
   { return !operator>(rhs); }
 
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
 private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
 };
 
-class OPENRTI_API TimeRegulationEnabledMessage : public AbstractMessage {
+class OPENRTI_API QueryFederationSaveStatusResponseMessage : public AbstractMessage {
 public:
-  TimeRegulationEnabledMessage();
-  virtual ~TimeRegulationEnabledMessage();
+  QueryFederationSaveStatusResponseMessage();
+  virtual ~QueryFederationSaveStatusResponseMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const TimeRegulationEnabledMessage& rhs) const;
-  bool operator<(const TimeRegulationEnabledMessage& rhs) const;
-  bool operator!=(const TimeRegulationEnabledMessage& rhs) const
+  bool operator==(const QueryFederationSaveStatusResponseMessage& rhs) const;
+  bool operator<(const QueryFederationSaveStatusResponseMessage& rhs) const;
+  bool operator!=(const QueryFederationSaveStatusResponseMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const TimeRegulationEnabledMessage& rhs) const
+  bool operator>(const QueryFederationSaveStatusResponseMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const TimeRegulationEnabledMessage& rhs) const
+  bool operator>=(const QueryFederationSaveStatusResponseMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const TimeRegulationEnabledMessage& rhs) const
+  bool operator<=(const QueryFederationSaveStatusResponseMessage& rhs) const
   { return !operator>(rhs); }
 
-private:
-};
-
-class OPENRTI_API TimeAdvanceGrantedMessage : public AbstractMessage {
-public:
-  TimeAdvanceGrantedMessage();
-  virtual ~TimeAdvanceGrantedMessage();
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
 
-  virtual const char* getTypeName() const;
-  virtual void out(std::ostream& os) const;
-  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
-  virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const TimeAdvanceGrantedMessage& rhs) const;
-  bool operator<(const TimeAdvanceGrantedMessage& rhs) const;
-  bool operator!=(const TimeAdvanceGrantedMessage& rhs) const
-  { return !operator==(rhs); }
-  bool operator>(const TimeAdvanceGrantedMessage& rhs) const
-  { return rhs.operator<(*this); }
-  bool operator>=(const TimeAdvanceGrantedMessage& rhs) const
-  { return !operator<(rhs); }
-  bool operator<=(const TimeAdvanceGrantedMessage& rhs) const
-  { return !operator>(rhs); }
+  void setFederateHandleSaveStatusPairVector(const FederateHandleSaveStatusPairVector& value)
+  { _federateHandleSaveStatusPairVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandleSaveStatusPairVector(FederateHandleSaveStatusPairVector&& value)
+  { _federateHandleSaveStatusPairVector = std::move(value); }
+#endif
+  FederateHandleSaveStatusPairVector& getFederateHandleSaveStatusPairVector()
+  { return _federateHandleSaveStatusPairVector; }
+  const FederateHandleSaveStatusPairVector& getFederateHandleSaveStatusPairVector() const
+  { return _federateHandleSaveStatusPairVector; }
 
 private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  FederateHandleSaveStatusPairVector _federateHandleSaveStatusPairVector;
 };
 
-class OPENRTI_API InsertRegionMessage : public AbstractMessage {
+class OPENRTI_API RequestFederationRestoreMessage : public AbstractMessage {
 public:
-  InsertRegionMessage();
-  virtual ~InsertRegionMessage();
+  RequestFederationRestoreMessage();
+  virtual ~RequestFederationRestoreMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const InsertRegionMessage& rhs) const;
-  bool operator<(const InsertRegionMessage& rhs) const;
-  bool operator!=(const InsertRegionMessage& rhs) const
+  bool operator==(const RequestFederationRestoreMessage& rhs) const;
+  bool operator<(const RequestFederationRestoreMessage& rhs) const;
+  bool operator!=(const RequestFederationRestoreMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const InsertRegionMessage& rhs) const
+  bool operator>(const RequestFederationRestoreMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const InsertRegionMessage& rhs) const
+  bool operator>=(const RequestFederationRestoreMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const InsertRegionMessage& rhs) const
+  bool operator<=(const RequestFederationRestoreMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4839,41 +5652,53 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setRegionHandleDimensionHandleSetPairVector(const RegionHandleDimensionHandleSetPairVector& value)
-  { _regionHandleDimensionHandleSetPairVector = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setRegionHandleDimensionHandleSetPairVector(RegionHandleDimensionHandleSetPairVector&& value)
-  { _regionHandleDimensionHandleSetPairVector = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  RegionHandleDimensionHandleSetPairVector& getRegionHandleDimensionHandleSetPairVector()
-  { return _regionHandleDimensionHandleSetPairVector; }
-  const RegionHandleDimensionHandleSetPairVector& getRegionHandleDimensionHandleSetPairVector() const
-  { return _regionHandleDimensionHandleSetPairVector; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setLabel(const String& value)
+  { _label = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setLabel(String&& value)
+  { _label = std::move(value); }
+#endif
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
 
 private:
   FederationHandle _federationHandle;
-  RegionHandleDimensionHandleSetPairVector _regionHandleDimensionHandleSetPairVector;
+  FederateHandle _federateHandle;
+  String _label;
 };
 
-class OPENRTI_API CommitRegionMessage : public AbstractMessage {
+class OPENRTI_API RequestFederationRestoreResponseMessage : public AbstractMessage {
 public:
-  CommitRegionMessage();
-  virtual ~CommitRegionMessage();
+  RequestFederationRestoreResponseMessage();
+  virtual ~RequestFederationRestoreResponseMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const CommitRegionMessage& rhs) const;
-  bool operator<(const CommitRegionMessage& rhs) const;
-  bool operator!=(const CommitRegionMessage& rhs) const
+  bool operator==(const RequestFederationRestoreResponseMessage& rhs) const;
+  bool operator<(const RequestFederationRestoreResponseMessage& rhs) const;
+  bool operator!=(const RequestFederationRestoreResponseMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const CommitRegionMessage& rhs) const
+  bool operator>(const RequestFederationRestoreResponseMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const CommitRegionMessage& rhs) const
+  bool operator>=(const RequestFederationRestoreResponseMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const CommitRegionMessage& rhs) const
+  bool operator<=(const RequestFederationRestoreResponseMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4887,41 +5712,65 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setRegionHandleRegionValuePairVector(const RegionHandleRegionValuePairVector& value)
-  { _regionHandleRegionValuePairVector = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setRegionHandleRegionValuePairVector(RegionHandleRegionValuePairVector&& value)
-  { _regionHandleRegionValuePairVector = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  RegionHandleRegionValuePairVector& getRegionHandleRegionValuePairVector()
-  { return _regionHandleRegionValuePairVector; }
-  const RegionHandleRegionValuePairVector& getRegionHandleRegionValuePairVector() const
-  { return _regionHandleRegionValuePairVector; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setLabel(const String& value)
+  { _label = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setLabel(String&& value)
+  { _label = std::move(value); }
+#endif
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
+
+  void setSuccessful(const Bool& value)
+  { _successful = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setSuccessful(Bool&& value)
+  { _successful = std::move(value); }
+#endif
+  Bool& getSuccessful()
+  { return _successful; }
+  const Bool& getSuccessful() const
+  { return _successful; }
 
 private:
   FederationHandle _federationHandle;
-  RegionHandleRegionValuePairVector _regionHandleRegionValuePairVector;
+  FederateHandle _federateHandle;
+  String _label;
+  Bool _successful;
 };
 
-class OPENRTI_API EraseRegionMessage : public AbstractMessage {
+class OPENRTI_API FederationRestoreBegunMessage : public AbstractMessage {
 public:
-  EraseRegionMessage();
-  virtual ~EraseRegionMessage();
+  FederationRestoreBegunMessage();
+  virtual ~FederationRestoreBegunMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const EraseRegionMessage& rhs) const;
-  bool operator<(const EraseRegionMessage& rhs) const;
-  bool operator!=(const EraseRegionMessage& rhs) const
+  bool operator==(const FederationRestoreBegunMessage& rhs) const;
+  bool operator<(const FederationRestoreBegunMessage& rhs) const;
+  bool operator!=(const FederationRestoreBegunMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const EraseRegionMessage& rhs) const
+  bool operator>(const FederationRestoreBegunMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const EraseRegionMessage& rhs) const
+  bool operator>=(const FederationRestoreBegunMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const EraseRegionMessage& rhs) const
+  bool operator<=(const FederationRestoreBegunMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4935,41 +5784,41 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setRegionHandleVector(const RegionHandleVector& value)
-  { _regionHandleVector = value; }
+  void setLabel(const String& value)
+  { _label = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setRegionHandleVector(RegionHandleVector&& value)
-  { _regionHandleVector = std::move(value); }
+  void setLabel(String&& value)
+  { _label = std::move(value); }
 #endif
-  RegionHandleVector& getRegionHandleVector()
-  { return _regionHandleVector; }
-  const RegionHandleVector& getRegionHandleVector() const
-  { return _regionHandleVector; }
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
 
 private:
   FederationHandle _federationHandle;
-  RegionHandleVector _regionHandleVector;
+  String _label;
 };
 
-class OPENRTI_API ChangeInteractionClassPublicationMessage : public AbstractMessage {
+class OPENRTI_API InitiateFederateRestoreMessage : public AbstractMessage {
 public:
-  ChangeInteractionClassPublicationMessage();
-  virtual ~ChangeInteractionClassPublicationMessage();
+  InitiateFederateRestoreMessage();
+  virtual ~InitiateFederateRestoreMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ChangeInteractionClassPublicationMessage& rhs) const;
-  bool operator<(const ChangeInteractionClassPublicationMessage& rhs) const;
-  bool operator!=(const ChangeInteractionClassPublicationMessage& rhs) const
+  bool operator==(const InitiateFederateRestoreMessage& rhs) const;
+  bool operator<(const InitiateFederateRestoreMessage& rhs) const;
+  bool operator!=(const InitiateFederateRestoreMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ChangeInteractionClassPublicationMessage& rhs) const
+  bool operator>(const InitiateFederateRestoreMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ChangeInteractionClassPublicationMessage& rhs) const
+  bool operator>=(const InitiateFederateRestoreMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ChangeInteractionClassPublicationMessage& rhs) const
+  bool operator<=(const InitiateFederateRestoreMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -4983,53 +5832,1935 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setPublicationType(const PublicationType& value)
-  { _publicationType = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setPublicationType(PublicationType&& value)
-  { _publicationType = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  PublicationType& getPublicationType()
-  { return _publicationType; }
-  const PublicationType& getPublicationType() const
-  { return _publicationType; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
-  void setInteractionClassHandle(const InteractionClassHandle& value)
-  { _interactionClassHandle = value; }
+  void setLabel(const String& value)
+  { _label = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setLabel(String&& value)
+  { _label = std::move(value); }
+#endif
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
+
+  void setFederateName(const String& value)
+  { _federateName = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateName(String&& value)
+  { _federateName = std::move(value); }
+#endif
+  String& getFederateName()
+  { return _federateName; }
+  const String& getFederateName() const
+  { return _federateName; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  String _label;
+  String _federateName;
+};
+
+class OPENRTI_API FederateRestoreCompleteMessage : public AbstractMessage {
+public:
+  FederateRestoreCompleteMessage();
+  virtual ~FederateRestoreCompleteMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const FederateRestoreCompleteMessage& rhs) const;
+  bool operator<(const FederateRestoreCompleteMessage& rhs) const;
+  bool operator!=(const FederateRestoreCompleteMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const FederateRestoreCompleteMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const FederateRestoreCompleteMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const FederateRestoreCompleteMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setSuccessful(const Bool& value)
+  { _successful = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setSuccessful(Bool&& value)
+  { _successful = std::move(value); }
+#endif
+  Bool& getSuccessful()
+  { return _successful; }
+  const Bool& getSuccessful() const
+  { return _successful; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  Bool _successful;
+};
+
+class OPENRTI_API FederationRestoredMessage : public AbstractMessage {
+public:
+  FederationRestoredMessage();
+  virtual ~FederationRestoredMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const FederationRestoredMessage& rhs) const;
+  bool operator<(const FederationRestoredMessage& rhs) const;
+  bool operator!=(const FederationRestoredMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const FederationRestoredMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const FederationRestoredMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const FederationRestoredMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setLabel(const String& value)
+  { _label = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setLabel(String&& value)
+  { _label = std::move(value); }
+#endif
+  String& getLabel()
+  { return _label; }
+  const String& getLabel() const
+  { return _label; }
+
+  void setSuccessful(const Bool& value)
+  { _successful = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setSuccessful(Bool&& value)
+  { _successful = std::move(value); }
+#endif
+  Bool& getSuccessful()
+  { return _successful; }
+  const Bool& getSuccessful() const
+  { return _successful; }
+
+  void setRestoreFailureReason(const RestoreFailureReason& value)
+  { _restoreFailureReason = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setRestoreFailureReason(RestoreFailureReason&& value)
+  { _restoreFailureReason = std::move(value); }
+#endif
+  RestoreFailureReason& getRestoreFailureReason()
+  { return _restoreFailureReason; }
+  const RestoreFailureReason& getRestoreFailureReason() const
+  { return _restoreFailureReason; }
+
+private:
+  FederationHandle _federationHandle;
+  String _label;
+  Bool _successful;
+  RestoreFailureReason _restoreFailureReason;
+};
+
+class OPENRTI_API AbortFederationRestoreMessage : public AbstractMessage {
+public:
+  AbortFederationRestoreMessage();
+  virtual ~AbortFederationRestoreMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const AbortFederationRestoreMessage& rhs) const;
+  bool operator<(const AbortFederationRestoreMessage& rhs) const;
+  bool operator!=(const AbortFederationRestoreMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const AbortFederationRestoreMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const AbortFederationRestoreMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const AbortFederationRestoreMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+};
+
+class OPENRTI_API QueryFederationRestoreStatusRequestMessage : public AbstractMessage {
+public:
+  QueryFederationRestoreStatusRequestMessage();
+  virtual ~QueryFederationRestoreStatusRequestMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const QueryFederationRestoreStatusRequestMessage& rhs) const;
+  bool operator<(const QueryFederationRestoreStatusRequestMessage& rhs) const;
+  bool operator!=(const QueryFederationRestoreStatusRequestMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const QueryFederationRestoreStatusRequestMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const QueryFederationRestoreStatusRequestMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const QueryFederationRestoreStatusRequestMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+};
+
+class OPENRTI_API QueryFederationRestoreStatusResponseMessage : public AbstractMessage {
+public:
+  QueryFederationRestoreStatusResponseMessage();
+  virtual ~QueryFederationRestoreStatusResponseMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const QueryFederationRestoreStatusResponseMessage& rhs) const;
+  bool operator<(const QueryFederationRestoreStatusResponseMessage& rhs) const;
+  bool operator!=(const QueryFederationRestoreStatusResponseMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const QueryFederationRestoreStatusResponseMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const QueryFederationRestoreStatusResponseMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const QueryFederationRestoreStatusResponseMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setFederateHandleRestoreStatusPairVector(const FederateHandleRestoreStatusPairVector& value)
+  { _federateHandleRestoreStatusPairVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandleRestoreStatusPairVector(FederateHandleRestoreStatusPairVector&& value)
+  { _federateHandleRestoreStatusPairVector = std::move(value); }
+#endif
+  FederateHandleRestoreStatusPairVector& getFederateHandleRestoreStatusPairVector()
+  { return _federateHandleRestoreStatusPairVector; }
+  const FederateHandleRestoreStatusPairVector& getFederateHandleRestoreStatusPairVector() const
+  { return _federateHandleRestoreStatusPairVector; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  FederateHandleRestoreStatusPairVector _federateHandleRestoreStatusPairVector;
+};
+
+class OPENRTI_API EnableTimeRegulationRequestMessage : public AbstractMessage {
+public:
+  EnableTimeRegulationRequestMessage();
+  virtual ~EnableTimeRegulationRequestMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const EnableTimeRegulationRequestMessage& rhs) const;
+  bool operator<(const EnableTimeRegulationRequestMessage& rhs) const;
+  bool operator!=(const EnableTimeRegulationRequestMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const EnableTimeRegulationRequestMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const EnableTimeRegulationRequestMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const EnableTimeRegulationRequestMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setTimeStamp(const VariableLengthData& value)
+  { _timeStamp = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTimeStamp(VariableLengthData&& value)
+  { _timeStamp = std::move(value); }
+#endif
+  VariableLengthData& getTimeStamp()
+  { return _timeStamp; }
+  const VariableLengthData& getTimeStamp() const
+  { return _timeStamp; }
+
+  void setCommitId(const Unsigned& value)
+  { _commitId = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setCommitId(Unsigned&& value)
+  { _commitId = std::move(value); }
+#endif
+  Unsigned& getCommitId()
+  { return _commitId; }
+  const Unsigned& getCommitId() const
+  { return _commitId; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  VariableLengthData _timeStamp;
+  Unsigned _commitId;
+};
+
+class OPENRTI_API EnableTimeRegulationResponseMessage : public AbstractMessage {
+public:
+  EnableTimeRegulationResponseMessage();
+  virtual ~EnableTimeRegulationResponseMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const EnableTimeRegulationResponseMessage& rhs) const;
+  bool operator<(const EnableTimeRegulationResponseMessage& rhs) const;
+  bool operator!=(const EnableTimeRegulationResponseMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const EnableTimeRegulationResponseMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const EnableTimeRegulationResponseMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const EnableTimeRegulationResponseMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setRespondingFederateHandle(const FederateHandle& value)
+  { _respondingFederateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setRespondingFederateHandle(FederateHandle&& value)
+  { _respondingFederateHandle = std::move(value); }
+#endif
+  FederateHandle& getRespondingFederateHandle()
+  { return _respondingFederateHandle; }
+  const FederateHandle& getRespondingFederateHandle() const
+  { return _respondingFederateHandle; }
+
+  void setTimeStampValid(const Bool& value)
+  { _timeStampValid = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTimeStampValid(Bool&& value)
+  { _timeStampValid = std::move(value); }
+#endif
+  Bool& getTimeStampValid()
+  { return _timeStampValid; }
+  const Bool& getTimeStampValid() const
+  { return _timeStampValid; }
+
+  void setTimeStamp(const VariableLengthData& value)
+  { _timeStamp = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTimeStamp(VariableLengthData&& value)
+  { _timeStamp = std::move(value); }
+#endif
+  VariableLengthData& getTimeStamp()
+  { return _timeStamp; }
+  const VariableLengthData& getTimeStamp() const
+  { return _timeStamp; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  FederateHandle _respondingFederateHandle;
+  Bool _timeStampValid;
+  VariableLengthData _timeStamp;
+};
+
+class OPENRTI_API DisableTimeRegulationRequestMessage : public AbstractMessage {
+public:
+  DisableTimeRegulationRequestMessage();
+  virtual ~DisableTimeRegulationRequestMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const DisableTimeRegulationRequestMessage& rhs) const;
+  bool operator<(const DisableTimeRegulationRequestMessage& rhs) const;
+  bool operator!=(const DisableTimeRegulationRequestMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const DisableTimeRegulationRequestMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const DisableTimeRegulationRequestMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const DisableTimeRegulationRequestMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+};
+
+class OPENRTI_API CommitLowerBoundTimeStampMessage : public AbstractMessage {
+public:
+  CommitLowerBoundTimeStampMessage();
+  virtual ~CommitLowerBoundTimeStampMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const CommitLowerBoundTimeStampMessage& rhs) const;
+  bool operator<(const CommitLowerBoundTimeStampMessage& rhs) const;
+  bool operator!=(const CommitLowerBoundTimeStampMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const CommitLowerBoundTimeStampMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const CommitLowerBoundTimeStampMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const CommitLowerBoundTimeStampMessage& rhs) const
+  { return !operator>(rhs); }
+
+  virtual Priority getPriority() const;
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setTimeStamp(const VariableLengthData& value)
+  { _timeStamp = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTimeStamp(VariableLengthData&& value)
+  { _timeStamp = std::move(value); }
+#endif
+  VariableLengthData& getTimeStamp()
+  { return _timeStamp; }
+  const VariableLengthData& getTimeStamp() const
+  { return _timeStamp; }
+
+  void setCommitType(const LowerBoundTimeStampCommitType& value)
+  { _commitType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setCommitType(LowerBoundTimeStampCommitType&& value)
+  { _commitType = std::move(value); }
+#endif
+  LowerBoundTimeStampCommitType& getCommitType()
+  { return _commitType; }
+  const LowerBoundTimeStampCommitType& getCommitType() const
+  { return _commitType; }
+
+  void setCommitId(const Unsigned& value)
+  { _commitId = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setCommitId(Unsigned&& value)
+  { _commitId = std::move(value); }
+#endif
+  Unsigned& getCommitId()
+  { return _commitId; }
+  const Unsigned& getCommitId() const
+  { return _commitId; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  VariableLengthData _timeStamp;
+  LowerBoundTimeStampCommitType _commitType;
+  Unsigned _commitId;
+};
+
+class OPENRTI_API CollectedCommitLowerBoundTimeStampMessage : public AbstractMessage {
+public:
+  CollectedCommitLowerBoundTimeStampMessage();
+  virtual ~CollectedCommitLowerBoundTimeStampMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const CollectedCommitLowerBoundTimeStampMessage& rhs) const;
+  bool operator<(const CollectedCommitLowerBoundTimeStampMessage& rhs) const;
+  bool operator!=(const CollectedCommitLowerBoundTimeStampMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const CollectedCommitLowerBoundTimeStampMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const CollectedCommitLowerBoundTimeStampMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const CollectedCommitLowerBoundTimeStampMessage& rhs) const
+  { return !operator>(rhs); }
+
+  virtual Priority getPriority() const;
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setTimeStamp(const VariableLengthData& value)
+  { _timeStamp = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTimeStamp(VariableLengthData&& value)
+  { _timeStamp = std::move(value); }
+#endif
+  VariableLengthData& getTimeStamp()
+  { return _timeStamp; }
+  const VariableLengthData& getTimeStamp() const
+  { return _timeStamp; }
+
+  void setCommitType(const LowerBoundTimeStampCommitType& value)
+  { _commitType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setCommitType(LowerBoundTimeStampCommitType&& value)
+  { _commitType = std::move(value); }
+#endif
+  LowerBoundTimeStampCommitType& getCommitType()
+  { return _commitType; }
+  const LowerBoundTimeStampCommitType& getCommitType() const
+  { return _commitType; }
+
+  void setFederateHandleCommitIdPairVector(const FederateHandleCommitIdPairVector& value)
+  { _federateHandleCommitIdPairVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandleCommitIdPairVector(FederateHandleCommitIdPairVector&& value)
+  { _federateHandleCommitIdPairVector = std::move(value); }
+#endif
+  FederateHandleCommitIdPairVector& getFederateHandleCommitIdPairVector()
+  { return _federateHandleCommitIdPairVector; }
+  const FederateHandleCommitIdPairVector& getFederateHandleCommitIdPairVector() const
+  { return _federateHandleCommitIdPairVector; }
+
+private:
+  FederationHandle _federationHandle;
+  VariableLengthData _timeStamp;
+  LowerBoundTimeStampCommitType _commitType;
+  FederateHandleCommitIdPairVector _federateHandleCommitIdPairVector;
+};
+
+class OPENRTI_API CommitLowerBoundTimeStampResponseMessage : public AbstractMessage {
+public:
+  CommitLowerBoundTimeStampResponseMessage();
+  virtual ~CommitLowerBoundTimeStampResponseMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const CommitLowerBoundTimeStampResponseMessage& rhs) const;
+  bool operator<(const CommitLowerBoundTimeStampResponseMessage& rhs) const;
+  bool operator!=(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const CommitLowerBoundTimeStampResponseMessage& rhs) const
+  { return !operator>(rhs); }
+
+  virtual Priority getPriority() const;
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setSendingFederateHandle(const FederateHandle& value)
+  { _sendingFederateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setSendingFederateHandle(FederateHandle&& value)
+  { _sendingFederateHandle = std::move(value); }
+#endif
+  FederateHandle& getSendingFederateHandle()
+  { return _sendingFederateHandle; }
+  const FederateHandle& getSendingFederateHandle() const
+  { return _sendingFederateHandle; }
+
+  void setCommitId(const Unsigned& value)
+  { _commitId = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setCommitId(Unsigned&& value)
+  { _commitId = std::move(value); }
+#endif
+  Unsigned& getCommitId()
+  { return _commitId; }
+  const Unsigned& getCommitId() const
+  { return _commitId; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  FederateHandle _sendingFederateHandle;
+  Unsigned _commitId;
+};
+
+class OPENRTI_API LockedByNextMessageRequestMessage : public AbstractMessage {
+public:
+  LockedByNextMessageRequestMessage();
+  virtual ~LockedByNextMessageRequestMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const LockedByNextMessageRequestMessage& rhs) const;
+  bool operator<(const LockedByNextMessageRequestMessage& rhs) const;
+  bool operator!=(const LockedByNextMessageRequestMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const LockedByNextMessageRequestMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const LockedByNextMessageRequestMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const LockedByNextMessageRequestMessage& rhs) const
+  { return !operator>(rhs); }
+
+  virtual Priority getPriority() const;
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setSendingFederateHandle(const FederateHandle& value)
+  { _sendingFederateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setSendingFederateHandle(FederateHandle&& value)
+  { _sendingFederateHandle = std::move(value); }
+#endif
+  FederateHandle& getSendingFederateHandle()
+  { return _sendingFederateHandle; }
+  const FederateHandle& getSendingFederateHandle() const
+  { return _sendingFederateHandle; }
+
+  void setLockedByNextMessage(const Bool& value)
+  { _lockedByNextMessage = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setLockedByNextMessage(Bool&& value)
+  { _lockedByNextMessage = std::move(value); }
+#endif
+  Bool& getLockedByNextMessage()
+  { return _lockedByNextMessage; }
+  const Bool& getLockedByNextMessage() const
+  { return _lockedByNextMessage; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _sendingFederateHandle;
+  Bool _lockedByNextMessage;
+};
+
+class OPENRTI_API TimeConstrainedEnabledMessage : public AbstractMessage {
+public:
+  TimeConstrainedEnabledMessage();
+  virtual ~TimeConstrainedEnabledMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const TimeConstrainedEnabledMessage& rhs) const;
+  bool operator<(const TimeConstrainedEnabledMessage& rhs) const;
+  bool operator!=(const TimeConstrainedEnabledMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const TimeConstrainedEnabledMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const TimeConstrainedEnabledMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const TimeConstrainedEnabledMessage& rhs) const
+  { return !operator>(rhs); }
+
+private:
+};
+
+class OPENRTI_API TimeRegulationEnabledMessage : public AbstractMessage {
+public:
+  TimeRegulationEnabledMessage();
+  virtual ~TimeRegulationEnabledMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const TimeRegulationEnabledMessage& rhs) const;
+  bool operator<(const TimeRegulationEnabledMessage& rhs) const;
+  bool operator!=(const TimeRegulationEnabledMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const TimeRegulationEnabledMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const TimeRegulationEnabledMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const TimeRegulationEnabledMessage& rhs) const
+  { return !operator>(rhs); }
+
+private:
+};
+
+class OPENRTI_API TimeAdvanceGrantedMessage : public AbstractMessage {
+public:
+  TimeAdvanceGrantedMessage();
+  virtual ~TimeAdvanceGrantedMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const TimeAdvanceGrantedMessage& rhs) const;
+  bool operator<(const TimeAdvanceGrantedMessage& rhs) const;
+  bool operator!=(const TimeAdvanceGrantedMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const TimeAdvanceGrantedMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const TimeAdvanceGrantedMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const TimeAdvanceGrantedMessage& rhs) const
+  { return !operator>(rhs); }
+
+private:
+};
+
+class OPENRTI_API InsertRegionMessage : public AbstractMessage {
+public:
+  InsertRegionMessage();
+  virtual ~InsertRegionMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const InsertRegionMessage& rhs) const;
+  bool operator<(const InsertRegionMessage& rhs) const;
+  bool operator!=(const InsertRegionMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const InsertRegionMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const InsertRegionMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const InsertRegionMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setRegionHandleDimensionHandleSetPairVector(const RegionHandleDimensionHandleSetPairVector& value)
+  { _regionHandleDimensionHandleSetPairVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setRegionHandleDimensionHandleSetPairVector(RegionHandleDimensionHandleSetPairVector&& value)
+  { _regionHandleDimensionHandleSetPairVector = std::move(value); }
+#endif
+  RegionHandleDimensionHandleSetPairVector& getRegionHandleDimensionHandleSetPairVector()
+  { return _regionHandleDimensionHandleSetPairVector; }
+  const RegionHandleDimensionHandleSetPairVector& getRegionHandleDimensionHandleSetPairVector() const
+  { return _regionHandleDimensionHandleSetPairVector; }
+
+private:
+  FederationHandle _federationHandle;
+  RegionHandleDimensionHandleSetPairVector _regionHandleDimensionHandleSetPairVector;
+};
+
+class OPENRTI_API CommitRegionMessage : public AbstractMessage {
+public:
+  CommitRegionMessage();
+  virtual ~CommitRegionMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const CommitRegionMessage& rhs) const;
+  bool operator<(const CommitRegionMessage& rhs) const;
+  bool operator!=(const CommitRegionMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const CommitRegionMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const CommitRegionMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const CommitRegionMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setRegionHandleRegionValuePairVector(const RegionHandleRegionValuePairVector& value)
+  { _regionHandleRegionValuePairVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setRegionHandleRegionValuePairVector(RegionHandleRegionValuePairVector&& value)
+  { _regionHandleRegionValuePairVector = std::move(value); }
+#endif
+  RegionHandleRegionValuePairVector& getRegionHandleRegionValuePairVector()
+  { return _regionHandleRegionValuePairVector; }
+  const RegionHandleRegionValuePairVector& getRegionHandleRegionValuePairVector() const
+  { return _regionHandleRegionValuePairVector; }
+
+private:
+  FederationHandle _federationHandle;
+  RegionHandleRegionValuePairVector _regionHandleRegionValuePairVector;
+};
+
+class OPENRTI_API EraseRegionMessage : public AbstractMessage {
+public:
+  EraseRegionMessage();
+  virtual ~EraseRegionMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const EraseRegionMessage& rhs) const;
+  bool operator<(const EraseRegionMessage& rhs) const;
+  bool operator!=(const EraseRegionMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const EraseRegionMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const EraseRegionMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const EraseRegionMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setRegionHandleVector(const RegionHandleVector& value)
+  { _regionHandleVector = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setRegionHandleVector(RegionHandleVector&& value)
+  { _regionHandleVector = std::move(value); }
+#endif
+  RegionHandleVector& getRegionHandleVector()
+  { return _regionHandleVector; }
+  const RegionHandleVector& getRegionHandleVector() const
+  { return _regionHandleVector; }
+
+private:
+  FederationHandle _federationHandle;
+  RegionHandleVector _regionHandleVector;
+};
+
+class OPENRTI_API ChangeInteractionClassPublicationMessage : public AbstractMessage {
+public:
+  ChangeInteractionClassPublicationMessage();
+  virtual ~ChangeInteractionClassPublicationMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const ChangeInteractionClassPublicationMessage& rhs) const;
+  bool operator<(const ChangeInteractionClassPublicationMessage& rhs) const;
+  bool operator!=(const ChangeInteractionClassPublicationMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const ChangeInteractionClassPublicationMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const ChangeInteractionClassPublicationMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const ChangeInteractionClassPublicationMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setPublicationType(const PublicationType& value)
+  { _publicationType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setPublicationType(PublicationType&& value)
+  { _publicationType = std::move(value); }
+#endif
+  PublicationType& getPublicationType()
+  { return _publicationType; }
+  const PublicationType& getPublicationType() const
+  { return _publicationType; }
+
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
+#endif
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
+
+private:
+  FederationHandle _federationHandle;
+  PublicationType _publicationType;
+  InteractionClassHandle _interactionClassHandle;
+};
+
+class OPENRTI_API ChangeObjectClassPublicationMessage : public AbstractMessage {
+public:
+  ChangeObjectClassPublicationMessage();
+  virtual ~ChangeObjectClassPublicationMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const ChangeObjectClassPublicationMessage& rhs) const;
+  bool operator<(const ChangeObjectClassPublicationMessage& rhs) const;
+  bool operator!=(const ChangeObjectClassPublicationMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const ChangeObjectClassPublicationMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const ChangeObjectClassPublicationMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const ChangeObjectClassPublicationMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setPublicationType(const PublicationType& value)
+  { _publicationType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setPublicationType(PublicationType&& value)
+  { _publicationType = std::move(value); }
+#endif
+  PublicationType& getPublicationType()
+  { return _publicationType; }
+  const PublicationType& getPublicationType() const
+  { return _publicationType; }
+
+  void setObjectClassHandle(const ObjectClassHandle& value)
+  { _objectClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectClassHandle(ObjectClassHandle&& value)
+  { _objectClassHandle = std::move(value); }
+#endif
+  ObjectClassHandle& getObjectClassHandle()
+  { return _objectClassHandle; }
+  const ObjectClassHandle& getObjectClassHandle() const
+  { return _objectClassHandle; }
+
+  void setAttributeHandles(const AttributeHandleVector& value)
+  { _attributeHandles = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setAttributeHandles(AttributeHandleVector&& value)
+  { _attributeHandles = std::move(value); }
+#endif
+  AttributeHandleVector& getAttributeHandles()
+  { return _attributeHandles; }
+  const AttributeHandleVector& getAttributeHandles() const
+  { return _attributeHandles; }
+
+private:
+  FederationHandle _federationHandle;
+  PublicationType _publicationType;
+  ObjectClassHandle _objectClassHandle;
+  AttributeHandleVector _attributeHandles;
+};
+
+class OPENRTI_API ChangeInteractionClassSubscriptionMessage : public AbstractMessage {
+public:
+  ChangeInteractionClassSubscriptionMessage();
+  virtual ~ChangeInteractionClassSubscriptionMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const ChangeInteractionClassSubscriptionMessage& rhs) const;
+  bool operator<(const ChangeInteractionClassSubscriptionMessage& rhs) const;
+  bool operator!=(const ChangeInteractionClassSubscriptionMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const ChangeInteractionClassSubscriptionMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const ChangeInteractionClassSubscriptionMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const ChangeInteractionClassSubscriptionMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setSubscriptionType(const SubscriptionType& value)
+  { _subscriptionType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setSubscriptionType(SubscriptionType&& value)
+  { _subscriptionType = std::move(value); }
+#endif
+  SubscriptionType& getSubscriptionType()
+  { return _subscriptionType; }
+  const SubscriptionType& getSubscriptionType() const
+  { return _subscriptionType; }
+
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
+#endif
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
+
+private:
+  FederationHandle _federationHandle;
+  SubscriptionType _subscriptionType;
+  InteractionClassHandle _interactionClassHandle;
+};
+
+class OPENRTI_API ChangeObjectClassSubscriptionMessage : public AbstractMessage {
+public:
+  ChangeObjectClassSubscriptionMessage();
+  virtual ~ChangeObjectClassSubscriptionMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const ChangeObjectClassSubscriptionMessage& rhs) const;
+  bool operator<(const ChangeObjectClassSubscriptionMessage& rhs) const;
+  bool operator!=(const ChangeObjectClassSubscriptionMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const ChangeObjectClassSubscriptionMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const ChangeObjectClassSubscriptionMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const ChangeObjectClassSubscriptionMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setSubscriptionType(const SubscriptionType& value)
+  { _subscriptionType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setSubscriptionType(SubscriptionType&& value)
+  { _subscriptionType = std::move(value); }
+#endif
+  SubscriptionType& getSubscriptionType()
+  { return _subscriptionType; }
+  const SubscriptionType& getSubscriptionType() const
+  { return _subscriptionType; }
+
+  void setObjectClassHandle(const ObjectClassHandle& value)
+  { _objectClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectClassHandle(ObjectClassHandle&& value)
+  { _objectClassHandle = std::move(value); }
+#endif
+  ObjectClassHandle& getObjectClassHandle()
+  { return _objectClassHandle; }
+  const ObjectClassHandle& getObjectClassHandle() const
+  { return _objectClassHandle; }
+
+  void setAttributeHandles(const AttributeHandleVector& value)
+  { _attributeHandles = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setAttributeHandles(AttributeHandleVector&& value)
+  { _attributeHandles = std::move(value); }
+#endif
+  AttributeHandleVector& getAttributeHandles()
+  { return _attributeHandles; }
+  const AttributeHandleVector& getAttributeHandles() const
+  { return _attributeHandles; }
+
+  void setUpdateRate(const Double& value)
+  { _updateRate = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setUpdateRate(Double&& value)
+  { _updateRate = std::move(value); }
+#endif
+  Double& getUpdateRate()
+  { return _updateRate; }
+  const Double& getUpdateRate() const
+  { return _updateRate; }
+
+private:
+  FederationHandle _federationHandle;
+  SubscriptionType _subscriptionType;
+  ObjectClassHandle _objectClassHandle;
+  AttributeHandleVector _attributeHandles;
+  Double _updateRate;
+};
+
+class OPENRTI_API RegistrationForObjectClassMessage : public AbstractMessage {
+public:
+  RegistrationForObjectClassMessage();
+  virtual ~RegistrationForObjectClassMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const RegistrationForObjectClassMessage& rhs) const;
+  bool operator<(const RegistrationForObjectClassMessage& rhs) const;
+  bool operator!=(const RegistrationForObjectClassMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const RegistrationForObjectClassMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const RegistrationForObjectClassMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const RegistrationForObjectClassMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setObjectClassHandle(const ObjectClassHandle& value)
+  { _objectClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectClassHandle(ObjectClassHandle&& value)
+  { _objectClassHandle = std::move(value); }
+#endif
+  ObjectClassHandle& getObjectClassHandle()
+  { return _objectClassHandle; }
+  const ObjectClassHandle& getObjectClassHandle() const
+  { return _objectClassHandle; }
+
+  void setStart(const Bool& value)
+  { _start = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setStart(Bool&& value)
+  { _start = std::move(value); }
+#endif
+  Bool& getStart()
+  { return _start; }
+  const Bool& getStart() const
+  { return _start; }
+
+private:
+  ObjectClassHandle _objectClassHandle;
+  Bool _start;
+};
+
+class OPENRTI_API AttributesInScopeMessage : public AbstractMessage {
+public:
+  AttributesInScopeMessage();
+  virtual ~AttributesInScopeMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const AttributesInScopeMessage& rhs) const;
+  bool operator<(const AttributesInScopeMessage& rhs) const;
+  bool operator!=(const AttributesInScopeMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const AttributesInScopeMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const AttributesInScopeMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const AttributesInScopeMessage& rhs) const
+  { return !operator>(rhs); }
+
+  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
+
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
+#endif
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
+
+  void setAttributeHandles(const AttributeHandleVector& value)
+  { _attributeHandles = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setAttributeHandles(AttributeHandleVector&& value)
+  { _attributeHandles = std::move(value); }
+#endif
+  AttributeHandleVector& getAttributeHandles()
+  { return _attributeHandles; }
+  const AttributeHandleVector& getAttributeHandles() const
+  { return _attributeHandles; }
+
+  void setInScope(const Bool& value)
+  { _inScope = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setInScope(Bool&& value)
+  { _inScope = std::move(value); }
+#endif
+  Bool& getInScope()
+  { return _inScope; }
+  const Bool& getInScope() const
+  { return _inScope; }
+
+private:
+  ObjectInstanceHandle _objectInstanceHandle;
+  AttributeHandleVector _attributeHandles;
+  Bool _inScope;
+};
+
+class OPENRTI_API TurnUpdatesOnForInstanceMessage : public AbstractMessage {
+public:
+  TurnUpdatesOnForInstanceMessage();
+  virtual ~TurnUpdatesOnForInstanceMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const TurnUpdatesOnForInstanceMessage& rhs) const;
+  bool operator<(const TurnUpdatesOnForInstanceMessage& rhs) const;
+  bool operator!=(const TurnUpdatesOnForInstanceMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const TurnUpdatesOnForInstanceMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const TurnUpdatesOnForInstanceMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const TurnUpdatesOnForInstanceMessage& rhs) const
+  { return !operator>(rhs); }
+
+  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
+
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
+#endif
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
+
+  void setAttributeHandles(const AttributeHandleVector& value)
+  { _attributeHandles = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setAttributeHandles(AttributeHandleVector&& value)
+  { _attributeHandles = std::move(value); }
+#endif
+  AttributeHandleVector& getAttributeHandles()
+  { return _attributeHandles; }
+  const AttributeHandleVector& getAttributeHandles() const
+  { return _attributeHandles; }
+
+  void setUpdateRate(const String& value)
+  { _updateRate = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setUpdateRate(String&& value)
+  { _updateRate = std::move(value); }
+#endif
+  String& getUpdateRate()
+  { return _updateRate; }
+  const String& getUpdateRate() const
+  { return _updateRate; }
+
+  void setOn(const Bool& value)
+  { _on = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setOn(Bool&& value)
+  { _on = std::move(value); }
+#endif
+  Bool& getOn()
+  { return _on; }
+  const Bool& getOn() const
+  { return _on; }
+
+private:
+  ObjectInstanceHandle _objectInstanceHandle;
+  AttributeHandleVector _attributeHandles;
+  String _updateRate;
+  Bool _on;
+};
+
+class OPENRTI_API TurnInteractionsOnMessage : public AbstractMessage {
+public:
+  TurnInteractionsOnMessage();
+  virtual ~TurnInteractionsOnMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const TurnInteractionsOnMessage& rhs) const;
+  bool operator<(const TurnInteractionsOnMessage& rhs) const;
+  bool operator!=(const TurnInteractionsOnMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const TurnInteractionsOnMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const TurnInteractionsOnMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const TurnInteractionsOnMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
+#endif
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
+
+  void setOn(const Bool& value)
+  { _on = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setOn(Bool&& value)
+  { _on = std::move(value); }
+#endif
+  Bool& getOn()
+  { return _on; }
+  const Bool& getOn() const
+  { return _on; }
+
+private:
+  InteractionClassHandle _interactionClassHandle;
+  Bool _on;
+};
+
+class OPENRTI_API InteractionMessage : public AbstractMessage {
+public:
+  InteractionMessage();
+  virtual ~InteractionMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const InteractionMessage& rhs) const;
+  bool operator<(const InteractionMessage& rhs) const;
+  bool operator!=(const InteractionMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const InteractionMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const InteractionMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const InteractionMessage& rhs) const
+  { return !operator>(rhs); }
+
+  virtual bool getReliable() const;
+
+  virtual Priority getPriority() const;
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
+#endif
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
+
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
+#endif
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
+
+  void setTag(const VariableLengthData& value)
+  { _tag = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTag(VariableLengthData&& value)
+  { _tag = std::move(value); }
+#endif
+  VariableLengthData& getTag()
+  { return _tag; }
+  const VariableLengthData& getTag() const
+  { return _tag; }
+
+  void setParameterValues(const ParameterValueVector& value)
+  { _parameterValues = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setParameterValues(ParameterValueVector&& value)
+  { _parameterValues = std::move(value); }
+#endif
+  ParameterValueVector& getParameterValues()
+  { return _parameterValues; }
+  const ParameterValueVector& getParameterValues() const
+  { return _parameterValues; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  InteractionClassHandle _interactionClassHandle;
+  TransportationType _transportationType;
+  VariableLengthData _tag;
+  ParameterValueVector _parameterValues;
+};
+
+class OPENRTI_API TimeStampedInteractionMessage : public AbstractMessage {
+public:
+  TimeStampedInteractionMessage();
+  virtual ~TimeStampedInteractionMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const TimeStampedInteractionMessage& rhs) const;
+  bool operator<(const TimeStampedInteractionMessage& rhs) const;
+  bool operator!=(const TimeStampedInteractionMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const TimeStampedInteractionMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const TimeStampedInteractionMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const TimeStampedInteractionMessage& rhs) const
+  { return !operator>(rhs); }
+
+  virtual bool getReliable() const;
+
+  virtual MessageRetractionHandle getMessageRetractionHandleForMessage() const;
+
+  virtual Priority getPriority() const;
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
+#endif
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
+
+  void setOrderType(const OrderType& value)
+  { _orderType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setOrderType(OrderType&& value)
+  { _orderType = std::move(value); }
+#endif
+  OrderType& getOrderType()
+  { return _orderType; }
+  const OrderType& getOrderType() const
+  { return _orderType; }
+
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
+#endif
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
+
+  void setTag(const VariableLengthData& value)
+  { _tag = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTag(VariableLengthData&& value)
+  { _tag = std::move(value); }
+#endif
+  VariableLengthData& getTag()
+  { return _tag; }
+  const VariableLengthData& getTag() const
+  { return _tag; }
+
+  void setTimeStamp(const VariableLengthData& value)
+  { _timeStamp = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTimeStamp(VariableLengthData&& value)
+  { _timeStamp = std::move(value); }
+#endif
+  VariableLengthData& getTimeStamp()
+  { return _timeStamp; }
+  const VariableLengthData& getTimeStamp() const
+  { return _timeStamp; }
+
+  void setMessageRetractionHandle(const MessageRetractionHandle& value)
+  { _messageRetractionHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setMessageRetractionHandle(MessageRetractionHandle&& value)
+  { _messageRetractionHandle = std::move(value); }
+#endif
+  MessageRetractionHandle& getMessageRetractionHandle()
+  { return _messageRetractionHandle; }
+  const MessageRetractionHandle& getMessageRetractionHandle() const
+  { return _messageRetractionHandle; }
+
+  void setParameterValues(const ParameterValueVector& value)
+  { _parameterValues = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setParameterValues(ParameterValueVector&& value)
+  { _parameterValues = std::move(value); }
+#endif
+  ParameterValueVector& getParameterValues()
+  { return _parameterValues; }
+  const ParameterValueVector& getParameterValues() const
+  { return _parameterValues; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  InteractionClassHandle _interactionClassHandle;
+  OrderType _orderType;
+  TransportationType _transportationType;
+  VariableLengthData _tag;
+  VariableLengthData _timeStamp;
+  MessageRetractionHandle _messageRetractionHandle;
+  ParameterValueVector _parameterValues;
+};
+
+class OPENRTI_API ObjectInstanceHandlesRequestMessage : public AbstractMessage {
+public:
+  ObjectInstanceHandlesRequestMessage();
+  virtual ~ObjectInstanceHandlesRequestMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const ObjectInstanceHandlesRequestMessage& rhs) const;
+  bool operator<(const ObjectInstanceHandlesRequestMessage& rhs) const;
+  bool operator!=(const ObjectInstanceHandlesRequestMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const ObjectInstanceHandlesRequestMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const ObjectInstanceHandlesRequestMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const ObjectInstanceHandlesRequestMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setCount(const Unsigned& value)
+  { _count = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setCount(Unsigned&& value)
+  { _count = std::move(value); }
+#endif
+  Unsigned& getCount()
+  { return _count; }
+  const Unsigned& getCount() const
+  { return _count; }
+
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  Unsigned _count;
+};
+
+class OPENRTI_API ObjectInstanceHandlesResponseMessage : public AbstractMessage {
+public:
+  ObjectInstanceHandlesResponseMessage();
+  virtual ~ObjectInstanceHandlesResponseMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const ObjectInstanceHandlesResponseMessage& rhs) const;
+  bool operator<(const ObjectInstanceHandlesResponseMessage& rhs) const;
+  bool operator!=(const ObjectInstanceHandlesResponseMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const ObjectInstanceHandlesResponseMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const ObjectInstanceHandlesResponseMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const ObjectInstanceHandlesResponseMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setObjectInstanceHandleNamePairVector(const ObjectInstanceHandleNamePairVector& value)
+  { _objectInstanceHandleNamePairVector = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setInteractionClassHandle(InteractionClassHandle&& value)
-  { _interactionClassHandle = std::move(value); }
+  void setObjectInstanceHandleNamePairVector(ObjectInstanceHandleNamePairVector&& value)
+  { _objectInstanceHandleNamePairVector = std::move(value); }
 #endif
-  InteractionClassHandle& getInteractionClassHandle()
-  { return _interactionClassHandle; }
-  const InteractionClassHandle& getInteractionClassHandle() const
-  { return _interactionClassHandle; }
+  ObjectInstanceHandleNamePairVector& getObjectInstanceHandleNamePairVector()
+  { return _objectInstanceHandleNamePairVector; }
+  const ObjectInstanceHandleNamePairVector& getObjectInstanceHandleNamePairVector() const
+  { return _objectInstanceHandleNamePairVector; }
 
 private:
   FederationHandle _federationHandle;
-  PublicationType _publicationType;
-  InteractionClassHandle _interactionClassHandle;
+  FederateHandle _federateHandle;
+  ObjectInstanceHandleNamePairVector _objectInstanceHandleNamePairVector;
 };
 
-class OPENRTI_API ChangeObjectClassPublicationMessage : public AbstractMessage {
+class OPENRTI_API ReleaseMultipleObjectInstanceNameHandlePairsMessage : public AbstractMessage {
 public:
-  ChangeObjectClassPublicationMessage();
-  virtual ~ChangeObjectClassPublicationMessage();
+  ReleaseMultipleObjectInstanceNameHandlePairsMessage();
+  virtual ~ReleaseMultipleObjectInstanceNameHandlePairsMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ChangeObjectClassPublicationMessage& rhs) const;
-  bool operator<(const ChangeObjectClassPublicationMessage& rhs) const;
-  bool operator!=(const ChangeObjectClassPublicationMessage& rhs) const
+  bool operator==(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const;
+  bool operator<(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const;
+  bool operator!=(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ChangeObjectClassPublicationMessage& rhs) const
+  bool operator>(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ChangeObjectClassPublicationMessage& rhs) const
+  bool operator>=(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ChangeObjectClassPublicationMessage& rhs) const
+  bool operator<=(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -5043,65 +7774,41 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setPublicationType(const PublicationType& value)
-  { _publicationType = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setPublicationType(PublicationType&& value)
-  { _publicationType = std::move(value); }
-#endif
-  PublicationType& getPublicationType()
-  { return _publicationType; }
-  const PublicationType& getPublicationType() const
-  { return _publicationType; }
-
-  void setObjectClassHandle(const ObjectClassHandle& value)
-  { _objectClassHandle = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectClassHandle(ObjectClassHandle&& value)
-  { _objectClassHandle = std::move(value); }
-#endif
-  ObjectClassHandle& getObjectClassHandle()
-  { return _objectClassHandle; }
-  const ObjectClassHandle& getObjectClassHandle() const
-  { return _objectClassHandle; }
-
-  void setAttributeHandles(const AttributeHandleVector& value)
-  { _attributeHandles = value; }
+  void setObjectInstanceHandleVector(const ObjectInstanceHandleVector& value)
+  { _objectInstanceHandleVector = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeHandles(AttributeHandleVector&& value)
-  { _attributeHandles = std::move(value); }
+  void setObjectInstanceHandleVector(ObjectInstanceHandleVector&& value)
+  { _objectInstanceHandleVector = std::move(value); }
 #endif
-  AttributeHandleVector& getAttributeHandles()
-  { return _attributeHandles; }
-  const AttributeHandleVector& getAttributeHandles() const
-  { return _attributeHandles; }
+  ObjectInstanceHandleVector& getObjectInstanceHandleVector()
+  { return _objectInstanceHandleVector; }
+  const ObjectInstanceHandleVector& getObjectInstanceHandleVector() const
+  { return _objectInstanceHandleVector; }
 
 private:
   FederationHandle _federationHandle;
-  PublicationType _publicationType;
-  ObjectClassHandle _objectClassHandle;
-  AttributeHandleVector _attributeHandles;
+  ObjectInstanceHandleVector _objectInstanceHandleVector;
 };
 
-class OPENRTI_API ChangeInteractionClassSubscriptionMessage : public AbstractMessage {
+class OPENRTI_API ReserveObjectInstanceNameRequestMessage : public AbstractMessage {
 public:
-  ChangeInteractionClassSubscriptionMessage();
-  virtual ~ChangeInteractionClassSubscriptionMessage();
+  ReserveObjectInstanceNameRequestMessage();
+  virtual ~ReserveObjectInstanceNameRequestMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ChangeInteractionClassSubscriptionMessage& rhs) const;
-  bool operator<(const ChangeInteractionClassSubscriptionMessage& rhs) const;
-  bool operator!=(const ChangeInteractionClassSubscriptionMessage& rhs) const
+  bool operator==(const ReserveObjectInstanceNameRequestMessage& rhs) const;
+  bool operator<(const ReserveObjectInstanceNameRequestMessage& rhs) const;
+  bool operator!=(const ReserveObjectInstanceNameRequestMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ChangeInteractionClassSubscriptionMessage& rhs) const
+  bool operator>(const ReserveObjectInstanceNameRequestMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ChangeInteractionClassSubscriptionMessage& rhs) const
+  bool operator>=(const ReserveObjectInstanceNameRequestMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ChangeInteractionClassSubscriptionMessage& rhs) const
+  bool operator<=(const ReserveObjectInstanceNameRequestMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -5115,53 +7822,53 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setSubscriptionType(const SubscriptionType& value)
-  { _subscriptionType = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setSubscriptionType(SubscriptionType&& value)
-  { _subscriptionType = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  SubscriptionType& getSubscriptionType()
-  { return _subscriptionType; }
-  const SubscriptionType& getSubscriptionType() const
-  { return _subscriptionType; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
-  void setInteractionClassHandle(const InteractionClassHandle& value)
-  { _interactionClassHandle = value; }
+  void setName(const String& value)
+  { _name = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setInteractionClassHandle(InteractionClassHandle&& value)
-  { _interactionClassHandle = std::move(value); }
+  void setName(String&& value)
+  { _name = std::move(value); }
 #endif
-  InteractionClassHandle& getInteractionClassHandle()
-  { return _interactionClassHandle; }
-  const InteractionClassHandle& getInteractionClassHandle() const
-  { return _interactionClassHandle; }
+  String& getName()
+  { return _name; }
+  const String& getName() const
+  { return _name; }
 
 private:
   FederationHandle _federationHandle;
-  SubscriptionType _subscriptionType;
-  InteractionClassHandle _interactionClassHandle;
+  FederateHandle _federateHandle;
+  String _name;
 };
 
-class OPENRTI_API ChangeObjectClassSubscriptionMessage : public AbstractMessage {
+class OPENRTI_API ReserveObjectInstanceNameResponseMessage : public AbstractMessage {
 public:
-  ChangeObjectClassSubscriptionMessage();
-  virtual ~ChangeObjectClassSubscriptionMessage();
+  ReserveObjectInstanceNameResponseMessage();
+  virtual ~ReserveObjectInstanceNameResponseMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ChangeObjectClassSubscriptionMessage& rhs) const;
-  bool operator<(const ChangeObjectClassSubscriptionMessage& rhs) const;
-  bool operator!=(const ChangeObjectClassSubscriptionMessage& rhs) const
+  bool operator==(const ReserveObjectInstanceNameResponseMessage& rhs) const;
+  bool operator<(const ReserveObjectInstanceNameResponseMessage& rhs) const;
+  bool operator!=(const ReserveObjectInstanceNameResponseMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ChangeObjectClassSubscriptionMessage& rhs) const
+  bool operator>(const ReserveObjectInstanceNameResponseMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ChangeObjectClassSubscriptionMessage& rhs) const
+  bool operator>=(const ReserveObjectInstanceNameResponseMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ChangeObjectClassSubscriptionMessage& rhs) const
+  bool operator<=(const ReserveObjectInstanceNameResponseMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -5175,179 +7882,223 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setSubscriptionType(const SubscriptionType& value)
-  { _subscriptionType = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setSubscriptionType(SubscriptionType&& value)
-  { _subscriptionType = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  SubscriptionType& getSubscriptionType()
-  { return _subscriptionType; }
-  const SubscriptionType& getSubscriptionType() const
-  { return _subscriptionType; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
-  void setObjectClassHandle(const ObjectClassHandle& value)
-  { _objectClassHandle = value; }
+  void setObjectInstanceHandleNamePair(const ObjectInstanceHandleNamePair& value)
+  { _objectInstanceHandleNamePair = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectClassHandle(ObjectClassHandle&& value)
-  { _objectClassHandle = std::move(value); }
+  void setObjectInstanceHandleNamePair(ObjectInstanceHandleNamePair&& value)
+  { _objectInstanceHandleNamePair = std::move(value); }
 #endif
-  ObjectClassHandle& getObjectClassHandle()
-  { return _objectClassHandle; }
-  const ObjectClassHandle& getObjectClassHandle() const
-  { return _objectClassHandle; }
+  ObjectInstanceHandleNamePair& getObjectInstanceHandleNamePair()
+  { return _objectInstanceHandleNamePair; }
+  const ObjectInstanceHandleNamePair& getObjectInstanceHandleNamePair() const
+  { return _objectInstanceHandleNamePair; }
 
-  void setAttributeHandles(const AttributeHandleVector& value)
-  { _attributeHandles = value; }
+  void setSuccess(const Bool& value)
+  { _success = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeHandles(AttributeHandleVector&& value)
-  { _attributeHandles = std::move(value); }
+  void setSuccess(Bool&& value)
+  { _success = std::move(value); }
 #endif
-  AttributeHandleVector& getAttributeHandles()
-  { return _attributeHandles; }
-  const AttributeHandleVector& getAttributeHandles() const
-  { return _attributeHandles; }
+  Bool& getSuccess()
+  { return _success; }
+  const Bool& getSuccess() const
+  { return _success; }
 
 private:
   FederationHandle _federationHandle;
-  SubscriptionType _subscriptionType;
-  ObjectClassHandle _objectClassHandle;
-  AttributeHandleVector _attributeHandles;
+  FederateHandle _federateHandle;
+  ObjectInstanceHandleNamePair _objectInstanceHandleNamePair;
+  Bool _success;
 };
 
-class OPENRTI_API RegistrationForObjectClassMessage : public AbstractMessage {
+class OPENRTI_API ReserveMultipleObjectInstanceNameRequestMessage : public AbstractMessage {
 public:
-  RegistrationForObjectClassMessage();
-  virtual ~RegistrationForObjectClassMessage();
+  ReserveMultipleObjectInstanceNameRequestMessage();
+  virtual ~ReserveMultipleObjectInstanceNameRequestMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const RegistrationForObjectClassMessage& rhs) const;
-  bool operator<(const RegistrationForObjectClassMessage& rhs) const;
-  bool operator!=(const RegistrationForObjectClassMessage& rhs) const
+  bool operator==(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const;
+  bool operator<(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const;
+  bool operator!=(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const RegistrationForObjectClassMessage& rhs) const
+  bool operator>(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const RegistrationForObjectClassMessage& rhs) const
+  bool operator>=(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const RegistrationForObjectClassMessage& rhs) const
+  bool operator<=(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
   { return !operator>(rhs); }
 
-  void setObjectClassHandle(const ObjectClassHandle& value)
-  { _objectClassHandle = value; }
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectClassHandle(ObjectClassHandle&& value)
-  { _objectClassHandle = std::move(value); }
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
 #endif
-  ObjectClassHandle& getObjectClassHandle()
-  { return _objectClassHandle; }
-  const ObjectClassHandle& getObjectClassHandle() const
-  { return _objectClassHandle; }
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
 
-  void setStart(const Bool& value)
-  { _start = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setStart(Bool&& value)
-  { _start = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
+#endif
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
+
+  void setNameList(const StringVector& value)
+  { _nameList = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setNameList(StringVector&& value)
+  { _nameList = std::move(value); }
 #endif
-  Bool& getStart()
-  { return _start; }
-  const Bool& getStart() const
-  { return _start; }
+  StringVector& getNameList()
+  { return _nameList; }
+  const StringVector& getNameList() const
+  { return _nameList; }
 
 private:
-  ObjectClassHandle _objectClassHandle;
-  Bool _start;
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  StringVector _nameList;
 };
 
-class OPENRTI_API AttributesInScopeMessage : public AbstractMessage {
+class OPENRTI_API ReserveMultipleObjectInstanceNameResponseMessage : public AbstractMessage {
 public:
-  AttributesInScopeMessage();
-  virtual ~AttributesInScopeMessage();
+  ReserveMultipleObjectInstanceNameResponseMessage();
+  virtual ~ReserveMultipleObjectInstanceNameResponseMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const AttributesInScopeMessage& rhs) const;
-  bool operator<(const AttributesInScopeMessage& rhs) const;
-  bool operator!=(const AttributesInScopeMessage& rhs) const
+  bool operator==(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const;
+  bool operator<(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const;
+  bool operator!=(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const AttributesInScopeMessage& rhs) const
+  bool operator>(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const AttributesInScopeMessage& rhs) const
+  bool operator>=(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const AttributesInScopeMessage& rhs) const
+  bool operator<=(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
 
-  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
-  { _objectInstanceHandle = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
-  { _objectInstanceHandle = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  ObjectInstanceHandle& getObjectInstanceHandle()
-  { return _objectInstanceHandle; }
-  const ObjectInstanceHandle& getObjectInstanceHandle() const
-  { return _objectInstanceHandle; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
-  void setAttributeHandles(const AttributeHandleVector& value)
-  { _attributeHandles = value; }
+  void setObjectInstanceHandleNamePairVector(const ObjectInstanceHandleNamePairVector& value)
+  { _objectInstanceHandleNamePairVector = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeHandles(AttributeHandleVector&& value)
-  { _attributeHandles = std::move(value); }
+  void setObjectInstanceHandleNamePairVector(ObjectInstanceHandleNamePairVector&& value)
+  { _objectInstanceHandleNamePairVector = std::move(value); }
 #endif
-  AttributeHandleVector& getAttributeHandles()
-  { return _attributeHandles; }
-  const AttributeHandleVector& getAttributeHandles() const
-  { return _attributeHandles; }
+  ObjectInstanceHandleNamePairVector& getObjectInstanceHandleNamePairVector()
+  { return _objectInstanceHandleNamePairVector; }
+  const ObjectInstanceHandleNamePairVector& getObjectInstanceHandleNamePairVector() const
+  { return _objectInstanceHandleNamePairVector; }
 
-  void setInScope(const Bool& value)
-  { _inScope = value; }
+  void setSuccess(const Bool& value)
+  { _success = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setInScope(Bool&& value)
-  { _inScope = std::move(value); }
+  void setSuccess(Bool&& value)
+  { _success = std::move(value); }
 #endif
-  Bool& getInScope()
-  { return _inScope; }
-  const Bool& getInScope() const
-  { return _inScope; }
+  Bool& getSuccess()
+  { return _success; }
+  const Bool& getSuccess() const
+  { return _success; }
 
 private:
-  ObjectInstanceHandle _objectInstanceHandle;
-  AttributeHandleVector _attributeHandles;
-  Bool _inScope;
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  ObjectInstanceHandleNamePairVector _objectInstanceHandleNamePairVector;
+  Bool _success;
 };
 
-class OPENRTI_API TurnUpdatesOnForInstanceMessage : public AbstractMessage {
+class OPENRTI_API InsertObjectInstanceMessage : public AbstractMessage {
 public:
-  TurnUpdatesOnForInstanceMessage();
-  virtual ~TurnUpdatesOnForInstanceMessage();
+  InsertObjectInstanceMessage();
+  virtual ~InsertObjectInstanceMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const TurnUpdatesOnForInstanceMessage& rhs) const;
-  bool operator<(const TurnUpdatesOnForInstanceMessage& rhs) const;
-  bool operator!=(const TurnUpdatesOnForInstanceMessage& rhs) const
+  bool operator==(const InsertObjectInstanceMessage& rhs) const;
+  bool operator<(const InsertObjectInstanceMessage& rhs) const;
+  bool operator!=(const InsertObjectInstanceMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const TurnUpdatesOnForInstanceMessage& rhs) const
+  bool operator>(const InsertObjectInstanceMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const TurnUpdatesOnForInstanceMessage& rhs) const
+  bool operator>=(const InsertObjectInstanceMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const TurnUpdatesOnForInstanceMessage& rhs) const
+  bool operator<=(const InsertObjectInstanceMessage& rhs) const
   { return !operator>(rhs); }
 
   virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
 
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
+#endif
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
+
+  void setObjectClassHandle(const ObjectClassHandle& value)
+  { _objectClassHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setObjectClassHandle(ObjectClassHandle&& value)
+  { _objectClassHandle = std::move(value); }
+#endif
+  ObjectClassHandle& getObjectClassHandle()
+  { return _objectClassHandle; }
+  const ObjectClassHandle& getObjectClassHandle() const
+  { return _objectClassHandle; }
+
   void setObjectInstanceHandle(const ObjectInstanceHandle& value)
   { _objectInstanceHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -5359,116 +8110,106 @@ public:
   const ObjectInstanceHandle& getObjectInstanceHandle() const
   { return _objectInstanceHandle; }
 
-  void setAttributeHandles(const AttributeHandleVector& value)
-  { _attributeHandles = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeHandles(AttributeHandleVector&& value)
-  { _attributeHandles = std::move(value); }
-#endif
-  AttributeHandleVector& getAttributeHandles()
-  { return _attributeHandles; }
-  const AttributeHandleVector& getAttributeHandles() const
-  { return _attributeHandles; }
-
-  void setUpdateRate(const String& value)
-  { _updateRate = value; }
+  void setName(const String& value)
+  { _name = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setUpdateRate(String&& value)
-  { _updateRate = std::move(value); }
+  void setName(String&& value)
+  { _name = std::move(value); }
 #endif
-  String& getUpdateRate()
-  { return _updateRate; }
-  const String& getUpdateRate() const
-  { return _updateRate; }
+  String& getName()
+  { return _name; }
+  const String& getName() const
+  { return _name; }
 
-  void setOn(const Bool& value)
-  { _on = value; }
+  void setAttributeStateVector(const AttributeStateVector& value)
+  { _attributeStateVector = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setOn(Bool&& value)
-  { _on = std::move(value); }
+  void setAttributeStateVector(AttributeStateVector&& value)
+  { _attributeStateVector = std::move(value); }
 #endif
-  Bool& getOn()
-  { return _on; }
-  const Bool& getOn() const
-  { return _on; }
+  AttributeStateVector& getAttributeStateVector()
+  { return _attributeStateVector; }
+  const AttributeStateVector& getAttributeStateVector() const
+  { return _attributeStateVector; }
 
 private:
+  FederationHandle _federationHandle;
+  ObjectClassHandle _objectClassHandle;
   ObjectInstanceHandle _objectInstanceHandle;
-  AttributeHandleVector _attributeHandles;
-  String _updateRate;
-  Bool _on;
+  String _name;
+  AttributeStateVector _attributeStateVector;
 };
 
-class OPENRTI_API TurnInteractionsOnMessage : public AbstractMessage {
+class OPENRTI_API InsertMultipleObjectInstancesMessage : public AbstractMessage {
 public:
-  TurnInteractionsOnMessage();
-  virtual ~TurnInteractionsOnMessage();
+  InsertMultipleObjectInstancesMessage();
+  virtual ~InsertMultipleObjectInstancesMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const TurnInteractionsOnMessage& rhs) const;
-  bool operator<(const TurnInteractionsOnMessage& rhs) const;
-  bool operator!=(const TurnInteractionsOnMessage& rhs) const
+  bool operator==(const InsertMultipleObjectInstancesMessage& rhs) const;
+  bool operator<(const InsertMultipleObjectInstancesMessage& rhs) const;
+  bool operator!=(const InsertMultipleObjectInstancesMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const TurnInteractionsOnMessage& rhs) const
+  bool operator>(const InsertMultipleObjectInstancesMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const TurnInteractionsOnMessage& rhs) const
+  bool operator>=(const InsertMultipleObjectInstancesMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const TurnInteractionsOnMessage& rhs) const
+  bool operator<=(const InsertMultipleObjectInstancesMessage& rhs) const
   { return !operator>(rhs); }
 
-  void setInteractionClassHandle(const InteractionClassHandle& value)
-  { _interactionClassHandle = value; }
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setInteractionClassHandle(InteractionClassHandle&& value)
-  { _interactionClassHandle = std::move(value); }
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
 #endif
-  InteractionClassHandle& getInteractionClassHandle()
-  { return _interactionClassHandle; }
-  const InteractionClassHandle& getInteractionClassHandle() const
-  { return _interactionClassHandle; }
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
 
-  void setOn(const Bool& value)
-  { _on = value; }
+  void setObjectInstanceStateVector(const ObjectInstanceStateVector& value)
+  { _objectInstanceStateVector = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setOn(Bool&& value)
-  { _on = std::move(value); }
+  void setObjectInstanceStateVector(ObjectInstanceStateVector&& value)
+  { _objectInstanceStateVector = std::move(value); }
 #endif
-  Bool& getOn()
-  { return _on; }
-  const Bool& getOn() const
-  { return _on; }
+  ObjectInstanceStateVector& getObjectInstanceStateVector()
+  { return _objectInstanceStateVector; }
+  const ObjectInstanceStateVector& getObjectInstanceStateVector() const
+  { return _objectInstanceStateVector; }
 
 private:
-  InteractionClassHandle _interactionClassHandle;
-  Bool _on;
+  FederationHandle _federationHandle;
+  ObjectInstanceStateVector _objectInstanceStateVector;
 };
 
-class OPENRTI_API InteractionMessage : public AbstractMessage {
+class OPENRTI_API DeleteObjectInstanceMessage : public AbstractMessage {
 public:
-  InteractionMessage();
-  virtual ~InteractionMessage();
+  DeleteObjectInstanceMessage();
+  virtual ~DeleteObjectInstanceMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const InteractionMessage& rhs) const;
-  bool operator<(const InteractionMessage& rhs) const;
-  bool operator!=(const InteractionMessage& rhs) const
+  bool operator==(const DeleteObjectInstanceMessage& rhs) const;
+  bool operator<(const DeleteObjectInstanceMessage& rhs) const;
+  bool operator!=(const DeleteObjectInstanceMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const InteractionMessage& rhs) const
+  bool operator>(const DeleteObjectInstanceMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const InteractionMessage& rhs) const
+  bool operator>=(const DeleteObjectInstanceMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const InteractionMessage& rhs) const
+  bool operator<=(const DeleteObjectInstanceMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual bool getReliable() const;
+  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
 
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
@@ -5489,30 +8230,19 @@ public:
 #endif
   FederateHandle& getFederateHandle()
   { return _federateHandle; }
-  const FederateHandle& getFederateHandle() const
-  { return _federateHandle; }
-
-  void setInteractionClassHandle(const InteractionClassHandle& value)
-  { _interactionClassHandle = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setInteractionClassHandle(InteractionClassHandle&& value)
-  { _interactionClassHandle = std::move(value); }
-#endif
-  InteractionClassHandle& getInteractionClassHandle()
-  { return _interactionClassHandle; }
-  const InteractionClassHandle& getInteractionClassHandle() const
-  { return _interactionClassHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
-  void setTransportationType(const TransportationType& value)
-  { _transportationType = value; }
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTransportationType(TransportationType&& value)
-  { _transportationType = std::move(value); }
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
 #endif
-  TransportationType& getTransportationType()
-  { return _transportationType; }
-  const TransportationType& getTransportationType() const
-  { return _transportationType; }
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
 
   void setTag(const VariableLengthData& value)
   { _tag = value; }
@@ -5525,48 +8255,37 @@ public:
   const VariableLengthData& getTag() const
   { return _tag; }
 
-  void setParameterValues(const ParameterValueVector& value)
-  { _parameterValues = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setParameterValues(ParameterValueVector&& value)
-  { _parameterValues = std::move(value); }
-#endif
-  ParameterValueVector& getParameterValues()
-  { return _parameterValues; }
-  const ParameterValueVector& getParameterValues() const
-  { return _parameterValues; }
-
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
-  InteractionClassHandle _interactionClassHandle;
-  TransportationType _transportationType;
+  ObjectInstanceHandle _objectInstanceHandle;
   VariableLengthData _tag;
-  ParameterValueVector _parameterValues;
 };
 
-class OPENRTI_API TimeStampedInteractionMessage : public AbstractMessage {
+class OPENRTI_API TimeStampedDeleteObjectInstanceMessage : public AbstractMessage {
 public:
-  TimeStampedInteractionMessage();
-  virtual ~TimeStampedInteractionMessage();
+  TimeStampedDeleteObjectInstanceMessage();
+  virtual ~TimeStampedDeleteObjectInstanceMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const TimeStampedInteractionMessage& rhs) const;
-  bool operator<(const TimeStampedInteractionMessage& rhs) const;
-  bool operator!=(const TimeStampedInteractionMessage& rhs) const
+  bool operator==(const TimeStampedDeleteObjectInstanceMessage& rhs) const;
+  bool operator<(const TimeStampedDeleteObjectInstanceMessage& rhs) const;
+  bool operator!=(const TimeStampedDeleteObjectInstanceMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const TimeStampedInteractionMessage& rhs) const
+  bool operator>(const TimeStampedDeleteObjectInstanceMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const TimeStampedInteractionMessage& rhs) const
+  bool operator>=(const TimeStampedDeleteObjectInstanceMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const TimeStampedInteractionMessage& rhs) const
+  bool operator<=(const TimeStampedDeleteObjectInstanceMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual bool getReliable() const;
+  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
+
+  virtual MessageRetractionHandle getMessageRetractionHandleForMessage() const;
 
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
@@ -5590,16 +8309,16 @@ public:
   const FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
-  void setInteractionClassHandle(const InteractionClassHandle& value)
-  { _interactionClassHandle = value; }
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setInteractionClassHandle(InteractionClassHandle&& value)
-  { _interactionClassHandle = std::move(value); }
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
 #endif
-  InteractionClassHandle& getInteractionClassHandle()
-  { return _interactionClassHandle; }
-  const InteractionClassHandle& getInteractionClassHandle() const
-  { return _interactionClassHandle; }
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
 
   void setOrderType(const OrderType& value)
   { _orderType = value; }
@@ -5612,17 +8331,6 @@ public:
   const OrderType& getOrderType() const
   { return _orderType; }
 
-  void setTransportationType(const TransportationType& value)
-  { _transportationType = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTransportationType(TransportationType&& value)
-  { _transportationType = std::move(value); }
-#endif
-  TransportationType& getTransportationType()
-  { return _transportationType; }
-  const TransportationType& getTransportationType() const
-  { return _transportationType; }
-
   void setTag(const VariableLengthData& value)
   { _tag = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -5656,109 +8364,42 @@ public:
   const MessageRetractionHandle& getMessageRetractionHandle() const
   { return _messageRetractionHandle; }
 
-  void setParameterValues(const ParameterValueVector& value)
-  { _parameterValues = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setParameterValues(ParameterValueVector&& value)
-  { _parameterValues = std::move(value); }
-#endif
-  ParameterValueVector& getParameterValues()
-  { return _parameterValues; }
-  const ParameterValueVector& getParameterValues() const
-  { return _parameterValues; }
-
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
-  InteractionClassHandle _interactionClassHandle;
+  ObjectInstanceHandle _objectInstanceHandle;
   OrderType _orderType;
-  TransportationType _transportationType;
   VariableLengthData _tag;
   VariableLengthData _timeStamp;
   MessageRetractionHandle _messageRetractionHandle;
-  ParameterValueVector _parameterValues;
 };
 
-class OPENRTI_API ObjectInstanceHandlesRequestMessage : public AbstractMessage {
+class OPENRTI_API AttributeUpdateMessage : public AbstractMessage {
 public:
-  ObjectInstanceHandlesRequestMessage();
-  virtual ~ObjectInstanceHandlesRequestMessage();
+  AttributeUpdateMessage();
+  virtual ~AttributeUpdateMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ObjectInstanceHandlesRequestMessage& rhs) const;
-  bool operator<(const ObjectInstanceHandlesRequestMessage& rhs) const;
-  bool operator!=(const ObjectInstanceHandlesRequestMessage& rhs) const
+  bool operator==(const AttributeUpdateMessage& rhs) const;
+  bool operator<(const AttributeUpdateMessage& rhs) const;
+  bool operator!=(const AttributeUpdateMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ObjectInstanceHandlesRequestMessage& rhs) const
+  bool operator>(const AttributeUpdateMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ObjectInstanceHandlesRequestMessage& rhs) const
+  bool operator>=(const AttributeUpdateMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ObjectInstanceHandlesRequestMessage& rhs) const
+  bool operator<=(const AttributeUpdateMessage& rhs) const
   { return !operator>(rhs); }
 
-  void setFederationHandle(const FederationHandle& value)
-  { _federationHandle = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setFederationHandle(FederationHandle&& value)
-  { _federationHandle = std::move(value); }
-#endif
-  FederationHandle& getFederationHandle()
-  { return _federationHandle; }
-  const FederationHandle& getFederationHandle() const
-  { return _federationHandle; }
-
-  void setFederateHandle(const FederateHandle& value)
-  { _federateHandle = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setFederateHandle(FederateHandle&& value)
-  { _federateHandle = std::move(value); }
-#endif
-  FederateHandle& getFederateHandle()
-  { return _federateHandle; }
-  const FederateHandle& getFederateHandle() const
-  { return _federateHandle; }
-
-  void setCount(const Unsigned& value)
-  { _count = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setCount(Unsigned&& value)
-  { _count = std::move(value); }
-#endif
-  Unsigned& getCount()
-  { return _count; }
-  const Unsigned& getCount() const
-  { return _count; }
-
-private:
-  FederationHandle _federationHandle;
-  FederateHandle _federateHandle;
-  Unsigned _count;
-};
-
-class OPENRTI_API ObjectInstanceHandlesResponseMessage : public AbstractMessage {
-public:
-  ObjectInstanceHandlesResponseMessage();
-  virtual ~ObjectInstanceHandlesResponseMessage();
+  virtual bool getReliable() const;
 
-  virtual const char* getTypeName() const;
-  virtual void out(std::ostream& os) const;
-  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
 
-  virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ObjectInstanceHandlesResponseMessage& rhs) const;
-  bool operator<(const ObjectInstanceHandlesResponseMessage& rhs) const;
-  bool operator!=(const ObjectInstanceHandlesResponseMessage& rhs) const
-  { return !operator==(rhs); }
-  bool operator>(const ObjectInstanceHandlesResponseMessage& rhs) const
-  { return rhs.operator<(*this); }
-  bool operator>=(const ObjectInstanceHandlesResponseMessage& rhs) const
-  { return !operator<(rhs); }
-  bool operator<=(const ObjectInstanceHandlesResponseMessage& rhs) const
-  { return !operator>(rhs); }
+  virtual Priority getPriority() const;
 
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
@@ -5782,92 +8423,88 @@ public:
   const FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
-  void setObjectInstanceHandleNamePairVector(const ObjectInstanceHandleNamePairVector& value)
-  { _objectInstanceHandleNamePairVector = value; }
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectInstanceHandleNamePairVector(ObjectInstanceHandleNamePairVector&& value)
-  { _objectInstanceHandleNamePairVector = std::move(value); }
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
 #endif
-  ObjectInstanceHandleNamePairVector& getObjectInstanceHandleNamePairVector()
-  { return _objectInstanceHandleNamePairVector; }
-  const ObjectInstanceHandleNamePairVector& getObjectInstanceHandleNamePairVector() const
-  { return _objectInstanceHandleNamePairVector; }
-
-private:
-  FederationHandle _federationHandle;
-  FederateHandle _federateHandle;
-  ObjectInstanceHandleNamePairVector _objectInstanceHandleNamePairVector;
-};
-
-class OPENRTI_API ReleaseMultipleObjectInstanceNameHandlePairsMessage : public AbstractMessage {
-public:
-  ReleaseMultipleObjectInstanceNameHandlePairsMessage();
-  virtual ~ReleaseMultipleObjectInstanceNameHandlePairsMessage();
-
-  virtual const char* getTypeName() const;
-  virtual void out(std::ostream& os) const;
-  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
 
-  virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const;
-  bool operator<(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const;
-  bool operator!=(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
-  { return !operator==(rhs); }
-  bool operator>(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
-  { return rhs.operator<(*this); }
-  bool operator>=(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
-  { return !operator<(rhs); }
-  bool operator<=(const ReleaseMultipleObjectInstanceNameHandlePairsMessage& rhs) const
-  { return !operator>(rhs); }
+  void setTag(const VariableLengthData& value)
+  { _tag = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTag(VariableLengthData&& value)
+  { _tag = std::move(value); }
+#endif
+  VariableLengthData& getTag()
+  { return _tag; }
+  const VariableLengthData& getTag() const
+  { return _tag; }
 
-  void setFederationHandle(const FederationHandle& value)
-  { _federationHandle = value; }
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setFederationHandle(FederationHandle&& value)
-  { _federationHandle = std::move(value); }
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
 #endif
-  FederationHandle& getFederationHandle()
-  { return _federationHandle; }
-  const FederationHandle& getFederationHandle() const
-  { return _federationHandle; }
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
 
-  void setObjectInstanceHandleVector(const ObjectInstanceHandleVector& value)
-  { _objectInstanceHandleVector = value; }
+  void setAttributeValues(const AttributeValueVector& value)
+  { _attributeValues = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectInstanceHandleVector(ObjectInstanceHandleVector&& value)
-  { _objectInstanceHandleVector = std::move(value); }
+  void setAttributeValues(AttributeValueVector&& value)
+  { _attributeValues = std::move(value); }
 #endif
-  ObjectInstanceHandleVector& getObjectInstanceHandleVector()
-  { return _objectInstanceHandleVector; }
-  const ObjectInstanceHandleVector& getObjectInstanceHandleVector() const
-  { return _objectInstanceHandleVector; }
+  AttributeValueVector& getAttributeValues()
+  { return _attributeValues; }
+  const AttributeValueVector& getAttributeValues() const
+  { return _attributeValues; }
 
 private:
   FederationHandle _federationHandle;
-  ObjectInstanceHandleVector _objectInstanceHandleVector;
+  FederateHandle _federateHandle;
+  ObjectInstanceHandle _objectInstanceHandle;
+  VariableLengthData _tag;
+  TransportationType _transportationType;
+  AttributeValueVector _attributeValues;
 };
 
-class OPENRTI_API ReserveObjectInstanceNameRequestMessage : public AbstractMessage {
+class OPENRTI_API TimeStampedAttributeUpdateMessage : public AbstractMessage {
 public:
-  ReserveObjectInstanceNameRequestMessage();
-  virtual ~ReserveObjectInstanceNameRequestMessage();
+  TimeStampedAttributeUpdateMessage();
+  virtual ~TimeStampedAttributeUpdateMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ReserveObjectInstanceNameRequestMessage& rhs) const;
-  bool operator<(const ReserveObjectInstanceNameRequestMessage& rhs) const;
-  bool operator!=(const ReserveObjectInstanceNameRequestMessage& rhs) const
+  bool operator==(const TimeStampedAttributeUpdateMessage& rhs) const;
+  bool operator<(const TimeStampedAttributeUpdateMessage& rhs) const;
+  bool operator!=(const TimeStampedAttributeUpdateMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ReserveObjectInstanceNameRequestMessage& rhs) const
+  bool operator>(const TimeStampedAttributeUpdateMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ReserveObjectInstanceNameRequestMessage& rhs) const
+  bool operator>=(const TimeStampedAttributeUpdateMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ReserveObjectInstanceNameRequestMessage& rhs) const
+  bool operator<=(const TimeStampedAttributeUpdateMessage& rhs) const
   { return !operator>(rhs); }
 
+  virtual bool getReliable() const;
+
+  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
+
+  virtual MessageRetractionHandle getMessageRetractionHandleForMessage() const;
+
+  virtual Priority getPriority() const;
+
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -5890,44 +8527,118 @@ public:
   const FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
-  void setName(const String& value)
-  { _name = value; }
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setName(String&& value)
-  { _name = std::move(value); }
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
 #endif
-  String& getName()
-  { return _name; }
-  const String& getName() const
-  { return _name; }
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
+
+  void setTag(const VariableLengthData& value)
+  { _tag = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTag(VariableLengthData&& value)
+  { _tag = std::move(value); }
+#endif
+  VariableLengthData& getTag()
+  { return _tag; }
+  const VariableLengthData& getTag() const
+  { return _tag; }
+
+  void setTimeStamp(const VariableLengthData& value)
+  { _timeStamp = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTimeStamp(VariableLengthData&& value)
+  { _timeStamp = std::move(value); }
+#endif
+  VariableLengthData& getTimeStamp()
+  { return _timeStamp; }
+  const VariableLengthData& getTimeStamp() const
+  { return _timeStamp; }
+
+  void setMessageRetractionHandle(const MessageRetractionHandle& value)
+  { _messageRetractionHandle = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setMessageRetractionHandle(MessageRetractionHandle&& value)
+  { _messageRetractionHandle = std::move(value); }
+#endif
+  MessageRetractionHandle& getMessageRetractionHandle()
+  { return _messageRetractionHandle; }
+  const MessageRetractionHandle& getMessageRetractionHandle() const
+  { return _messageRetractionHandle; }
+
+  void setOrderType(const OrderType& value)
+  { _orderType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setOrderType(OrderType&& value)
+  { _orderType = std::move(value); }
+#endif
+  OrderType& getOrderType()
+  { return _orderType; }
+  const OrderType& getOrderType() const
+  { return _orderType; }
+
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
+#endif
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
+
+  void setAttributeValues(const AttributeValueVector& value)
+  { _attributeValues = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setAttributeValues(AttributeValueVector&& value)
+  { _attributeValues = std::move(value); }
+#endif
+  AttributeValueVector& getAttributeValues()
+  { return _attributeValues; }
+  const AttributeValueVector& getAttributeValues() const
+  { return _attributeValues; }
 
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
-  String _name;
+  ObjectInstanceHandle _objectInstanceHandle;
+  VariableLengthData _tag;
+  VariableLengthData _timeStamp;
+  MessageRetractionHandle _messageRetractionHandle;
+  OrderType _orderType;
+  TransportationType _transportationType;
+  AttributeValueVector _attributeValues;
 };
 
-class OPENRTI_API ReserveObjectInstanceNameResponseMessage : public AbstractMessage {
+class OPENRTI_API RequestAttributeUpdateMessage : public AbstractMessage {
 public:
-  ReserveObjectInstanceNameResponseMessage();
-  virtual ~ReserveObjectInstanceNameResponseMessage();
+  RequestAttributeUpdateMessage();
+  virtual ~RequestAttributeUpdateMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ReserveObjectInstanceNameResponseMessage& rhs) const;
-  bool operator<(const ReserveObjectInstanceNameResponseMessage& rhs) const;
-  bool operator!=(const ReserveObjectInstanceNameResponseMessage& rhs) const
+  bool operator==(const RequestAttributeUpdateMessage& rhs) const;
+  bool operator<(const RequestAttributeUpdateMessage& rhs) const;
+  bool operator!=(const RequestAttributeUpdateMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ReserveObjectInstanceNameResponseMessage& rhs) const
+  bool operator>(const RequestAttributeUpdateMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ReserveObjectInstanceNameResponseMessage& rhs) const
+  bool operator>=(const RequestAttributeUpdateMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ReserveObjectInstanceNameResponseMessage& rhs) const
+  bool operator<=(const RequestAttributeUpdateMessage& rhs) const
   { return !operator>(rhs); }
 
+  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
+
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -5939,65 +8650,65 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setFederateHandle(const FederateHandle& value)
-  { _federateHandle = value; }
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setFederateHandle(FederateHandle&& value)
-  { _federateHandle = std::move(value); }
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
 #endif
-  FederateHandle& getFederateHandle()
-  { return _federateHandle; }
-  const FederateHandle& getFederateHandle() const
-  { return _federateHandle; }
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
 
-  void setObjectInstanceHandleNamePair(const ObjectInstanceHandleNamePair& value)
-  { _objectInstanceHandleNamePair = value; }
+  void setAttributeHandles(const AttributeHandleVector& value)
+  { _attributeHandles = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectInstanceHandleNamePair(ObjectInstanceHandleNamePair&& value)
-  { _objectInstanceHandleNamePair = std::move(value); }
+  void setAttributeHandles(AttributeHandleVector&& value)
+  { _attributeHandles = std::move(value); }
 #endif
-  ObjectInstanceHandleNamePair& getObjectInstanceHandleNamePair()
-  { return _objectInstanceHandleNamePair; }
-  const ObjectInstanceHandleNamePair& getObjectInstanceHandleNamePair() const
-  { return _objectInstanceHandleNamePair; }
+  AttributeHandleVector& getAttributeHandles()
+  { return _attributeHandles; }
+  const AttributeHandleVector& getAttributeHandles() const
+  { return _attributeHandles; }
 
-  void setSuccess(const Bool& value)
-  { _success = value; }
+  void setTag(const VariableLengthData& value)
+  { _tag = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setSuccess(Bool&& value)
-  { _success = std::move(value); }
+  void setTag(VariableLengthData&& value)
+  { _tag = std::move(value); }
 #endif
-  Bool& getSuccess()
-  { return _success; }
-  const Bool& getSuccess() const
-  { return _success; }
+  VariableLengthData& getTag()
+  { return _tag; }
+  const VariableLengthData& getTag() const
+  { return _tag; }
 
 private:
   FederationHandle _federationHandle;
-  FederateHandle _federateHandle;
-  ObjectInstanceHandleNamePair _objectInstanceHandleNamePair;
-  Bool _success;
+  ObjectInstanceHandle _objectInstanceHandle;
+  AttributeHandleVector _attributeHandles;
+  VariableLengthData _tag;
 };
 
-class OPENRTI_API ReserveMultipleObjectInstanceNameRequestMessage : public AbstractMessage {
+class OPENRTI_API RequestClassAttributeUpdateMessage : public AbstractMessage {
 public:
-  ReserveMultipleObjectInstanceNameRequestMessage();
-  virtual ~ReserveMultipleObjectInstanceNameRequestMessage();
+  RequestClassAttributeUpdateMessage();
+  virtual ~RequestClassAttributeUpdateMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const;
-  bool operator<(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const;
-  bool operator!=(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
+  bool operator==(const RequestClassAttributeUpdateMessage& rhs) const;
+  bool operator<(const RequestClassAttributeUpdateMessage& rhs) const;
+  bool operator!=(const RequestClassAttributeUpdateMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
+  bool operator>(const RequestClassAttributeUpdateMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
+  bool operator>=(const RequestClassAttributeUpdateMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ReserveMultipleObjectInstanceNameRequestMessage& rhs) const
+  bool operator<=(const RequestClassAttributeUpdateMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -6011,53 +8722,65 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setFederateHandle(const FederateHandle& value)
-  { _federateHandle = value; }
+  void setObjectClassHandle(const ObjectClassHandle& value)
+  { _objectClassHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setFederateHandle(FederateHandle&& value)
-  { _federateHandle = std::move(value); }
+  void setObjectClassHandle(ObjectClassHandle&& value)
+  { _objectClassHandle = std::move(value); }
 #endif
-  FederateHandle& getFederateHandle()
-  { return _federateHandle; }
-  const FederateHandle& getFederateHandle() const
-  { return _federateHandle; }
+  ObjectClassHandle& getObjectClassHandle()
+  { return _objectClassHandle; }
+  const ObjectClassHandle& getObjectClassHandle() const
+  { return _objectClassHandle; }
 
-  void setNameList(const StringVector& value)
-  { _nameList = value; }
+  void setAttributeHandles(const AttributeHandleVector& value)
+  { _attributeHandles = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setNameList(StringVector&& value)
-  { _nameList = std::move(value); }
+  void setAttributeHandles(AttributeHandleVector&& value)
+  { _attributeHandles = std::move(value); }
 #endif
-  StringVector& getNameList()
-  { return _nameList; }
-  const StringVector& getNameList() const
-  { return _nameList; }
+  AttributeHandleVector& getAttributeHandles()
+  { return _attributeHandles; }
+  const AttributeHandleVector& getAttributeHandles() const
+  { return _attributeHandles; }
+
+  void setTag(const VariableLengthData& value)
+  { _tag = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTag(VariableLengthData&& value)
+  { _tag = std::move(value); }
+#endif
+  VariableLengthData& getTag()
+  { return _tag; }
+  const VariableLengthData& getTag() const
+  { return _tag; }
 
 private:
   FederationHandle _federationHandle;
-  FederateHandle _federateHandle;
-  StringVector _nameList;
+  ObjectClassHandle _objectClassHandle;
+  AttributeHandleVector _attributeHandles;
+  VariableLengthData _tag;
 };
 
-class OPENRTI_API ReserveMultipleObjectInstanceNameResponseMessage : public AbstractMessage {
+class OPENRTI_API ChangeAttributeTransportationTypeRequestMessage : public AbstractMessage {
 public:
-  ReserveMultipleObjectInstanceNameResponseMessage();
-  virtual ~ReserveMultipleObjectInstanceNameResponseMessage();
+  ChangeAttributeTransportationTypeRequestMessage();
+  virtual ~ChangeAttributeTransportationTypeRequestMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const;
-  bool operator<(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const;
-  bool operator!=(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
+  bool operator==(const ChangeAttributeTransportationTypeRequestMessage& rhs) const;
+  bool operator<(const ChangeAttributeTransportationTypeRequestMessage& rhs) const;
+  bool operator!=(const ChangeAttributeTransportationTypeRequestMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
+  bool operator>(const ChangeAttributeTransportationTypeRequestMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
+  bool operator>=(const ChangeAttributeTransportationTypeRequestMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const ReserveMultipleObjectInstanceNameResponseMessage& rhs) const
+  bool operator<=(const ChangeAttributeTransportationTypeRequestMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -6082,58 +8805,68 @@ public:
   const FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
-  void setObjectInstanceHandleNamePairVector(const ObjectInstanceHandleNamePairVector& value)
-  { _objectInstanceHandleNamePairVector = value; }
+  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
+  { _objectInstanceHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectInstanceHandleNamePairVector(ObjectInstanceHandleNamePairVector&& value)
-  { _objectInstanceHandleNamePairVector = std::move(value); }
+  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
+  { _objectInstanceHandle = std::move(value); }
 #endif
-  ObjectInstanceHandleNamePairVector& getObjectInstanceHandleNamePairVector()
-  { return _objectInstanceHandleNamePairVector; }
-  const ObjectInstanceHandleNamePairVector& getObjectInstanceHandleNamePairVector() const
-  { return _objectInstanceHandleNamePairVector; }
+  ObjectInstanceHandle& getObjectInstanceHandle()
+  { return _objectInstanceHandle; }
+  const ObjectInstanceHandle& getObjectInstanceHandle() const
+  { return _objectInstanceHandle; }
 
-  void setSuccess(const Bool& value)
-  { _success = value; }
+  void setAttributeHandles(const AttributeHandleVector& value)
+  { _attributeHandles = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setSuccess(Bool&& value)
-  { _success = std::move(value); }
+  void setAttributeHandles(AttributeHandleVector&& value)
+  { _attributeHandles = std::move(value); }
 #endif
-  Bool& getSuccess()
-  { return _success; }
-  const Bool& getSuccess() const
-  { return _success; }
+  AttributeHandleVector& getAttributeHandles()
+  { return _attributeHandles; }
+  const AttributeHandleVector& getAttributeHandles() const
+  { return _attributeHandles; }
+
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
+#endif
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
 
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
-  ObjectInstanceHandleNamePairVector _objectInstanceHandleNamePairVector;
-  Bool _success;
+  ObjectInstanceHandle _objectInstanceHandle;
+  AttributeHandleVector _attributeHandles;
+  TransportationType _transportationType;
 };
 
-class OPENRTI_API InsertObjectInstanceMessage : public AbstractMessage {
+class OPENRTI_API ChangeAttributeTransportationTypeResponseMessage : public AbstractMessage {
 public:
-  InsertObjectInstanceMessage();
-  virtual ~InsertObjectInstanceMessage();
+  ChangeAttributeTransportationTypeResponseMessage();
+  virtual ~ChangeAttributeTransportationTypeResponseMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const InsertObjectInstanceMessage& rhs) const;
-  bool operator<(const InsertObjectInstanceMessage& rhs) const;
-  bool operator!=(const InsertObjectInstanceMessage& rhs) const
+  bool operator==(const ChangeAttributeTransportationTypeResponseMessage& rhs) const;
+  bool operator<(const ChangeAttributeTransportationTypeResponseMessage& rhs) const;
+  bool operator!=(const ChangeAttributeTransportationTypeResponseMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const InsertObjectInstanceMessage& rhs) const
+  bool operator>(const ChangeAttributeTransportationTypeResponseMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const InsertObjectInstanceMessage& rhs) const
+  bool operator>=(const ChangeAttributeTransportationTypeResponseMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const InsertObjectInstanceMessage& rhs) const
+  bool operator<=(const ChangeAttributeTransportationTypeResponseMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
-
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -6145,16 +8878,16 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setObjectClassHandle(const ObjectClassHandle& value)
-  { _objectClassHandle = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectClassHandle(ObjectClassHandle&& value)
-  { _objectClassHandle = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  ObjectClassHandle& getObjectClassHandle()
-  { return _objectClassHandle; }
-  const ObjectClassHandle& getObjectClassHandle() const
-  { return _objectClassHandle; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
   void setObjectInstanceHandle(const ObjectInstanceHandle& value)
   { _objectInstanceHandle = value; }
@@ -6167,59 +8900,57 @@ public:
   const ObjectInstanceHandle& getObjectInstanceHandle() const
   { return _objectInstanceHandle; }
 
-  void setName(const String& value)
-  { _name = value; }
+  void setAttributeHandles(const AttributeHandleVector& value)
+  { _attributeHandles = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setName(String&& value)
-  { _name = std::move(value); }
+  void setAttributeHandles(AttributeHandleVector&& value)
+  { _attributeHandles = std::move(value); }
 #endif
-  String& getName()
-  { return _name; }
-  const String& getName() const
-  { return _name; }
+  AttributeHandleVector& getAttributeHandles()
+  { return _attributeHandles; }
+  const AttributeHandleVector& getAttributeHandles() const
+  { return _attributeHandles; }
 
-  void setAttributeStateVector(const AttributeStateVector& value)
-  { _attributeStateVector = value; }
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeStateVector(AttributeStateVector&& value)
-  { _attributeStateVector = std::move(value); }
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
 #endif
-  AttributeStateVector& getAttributeStateVector()
-  { return _attributeStateVector; }
-  const AttributeStateVector& getAttributeStateVector() const
-  { return _attributeStateVector; }
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
 
 private:
   FederationHandle _federationHandle;
-  ObjectClassHandle _objectClassHandle;
+  FederateHandle _federateHandle;
   ObjectInstanceHandle _objectInstanceHandle;
-  String _name;
-  AttributeStateVector _attributeStateVector;
+  AttributeHandleVector _attributeHandles;
+  TransportationType _transportationType;
 };
 
-class OPENRTI_API DeleteObjectInstanceMessage : public AbstractMessage {
+class OPENRTI_API ChangeInteractionTransportationTypeRequestMessage : public AbstractMessage {
 public:
-  DeleteObjectInstanceMessage();
-  virtual ~DeleteObjectInstanceMessage();
+  ChangeInteractionTransportationTypeRequestMessage();
+  virtual ~ChangeInteractionTransportationTypeRequestMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const DeleteObjectInstanceMessage& rhs) const;
-  bool operator<(const DeleteObjectInstanceMessage& rhs) const;
-  bool operator!=(const DeleteObjectInstanceMessage& rhs) const
+  bool operator==(const ChangeInteractionTransportationTypeRequestMessage& rhs) const;
+  bool operator<(const ChangeInteractionTransportationTypeRequestMessage& rhs) const;
+  bool operator!=(const ChangeInteractionTransportationTypeRequestMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const DeleteObjectInstanceMessage& rhs) const
+  bool operator>(const ChangeInteractionTransportationTypeRequestMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const DeleteObjectInstanceMessage& rhs) const
+  bool operator>=(const ChangeInteractionTransportationTypeRequestMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const DeleteObjectInstanceMessage& rhs) const
+  bool operator<=(const ChangeInteractionTransportationTypeRequestMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
-
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -6242,58 +8973,56 @@ public:
   const FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
-  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
-  { _objectInstanceHandle = value; }
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
-  { _objectInstanceHandle = std::move(value); }
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
 #endif
-  ObjectInstanceHandle& getObjectInstanceHandle()
-  { return _objectInstanceHandle; }
-  const ObjectInstanceHandle& getObjectInstanceHandle() const
-  { return _objectInstanceHandle; }
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
 
-  void setTag(const VariableLengthData& value)
-  { _tag = value; }
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTag(VariableLengthData&& value)
-  { _tag = std::move(value); }
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
 #endif
-  VariableLengthData& getTag()
-  { return _tag; }
-  const VariableLengthData& getTag() const
-  { return _tag; }
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
 
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
-  ObjectInstanceHandle _objectInstanceHandle;
-  VariableLengthData _tag;
+  InteractionClassHandle _interactionClassHandle;
+  TransportationType _transportationType;
 };
 
-class OPENRTI_API TimeStampedDeleteObjectInstanceMessage : public AbstractMessage {
+class OPENRTI_API ChangeInteractionTransportationTypeResponseMessage : public AbstractMessage {
 public:
-  TimeStampedDeleteObjectInstanceMessage();
-  virtual ~TimeStampedDeleteObjectInstanceMessage();
+  ChangeInteractionTransportationTypeResponseMessage();
+  virtual ~ChangeInteractionTransportationTypeResponseMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const TimeStampedDeleteObjectInstanceMessage& rhs) const;
-  bool operator<(const TimeStampedDeleteObjectInstanceMessage& rhs) const;
-  bool operator!=(const TimeStampedDeleteObjectInstanceMessage& rhs) const
+  bool operator==(const ChangeInteractionTransportationTypeResponseMessage& rhs) const;
+  bool operator<(const ChangeInteractionTransportationTypeResponseMessage& rhs) const;
+  bool operator!=(const ChangeInteractionTransportationTypeResponseMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const TimeStampedDeleteObjectInstanceMessage& rhs) const
+  bool operator>(const ChangeInteractionTransportationTypeResponseMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const TimeStampedDeleteObjectInstanceMessage& rhs) const
+  bool operator>=(const ChangeInteractionTransportationTypeResponseMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const TimeStampedDeleteObjectInstanceMessage& rhs) const
+  bool operator<=(const ChangeInteractionTransportationTypeResponseMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
-
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -6316,96 +9045,56 @@ public:
   const FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
-  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
-  { _objectInstanceHandle = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
-  { _objectInstanceHandle = std::move(value); }
-#endif
-  ObjectInstanceHandle& getObjectInstanceHandle()
-  { return _objectInstanceHandle; }
-  const ObjectInstanceHandle& getObjectInstanceHandle() const
-  { return _objectInstanceHandle; }
-
-  void setOrderType(const OrderType& value)
-  { _orderType = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setOrderType(OrderType&& value)
-  { _orderType = std::move(value); }
-#endif
-  OrderType& getOrderType()
-  { return _orderType; }
-  const OrderType& getOrderType() const
-  { return _orderType; }
-
-  void setTag(const VariableLengthData& value)
-  { _tag = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTag(VariableLengthData&& value)
-  { _tag = std::move(value); }
-#endif
-  VariableLengthData& getTag()
-  { return _tag; }
-  const VariableLengthData& getTag() const
-  { return _tag; }
-
-  void setTimeStamp(const VariableLengthData& value)
-  { _timeStamp = value; }
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTimeStamp(VariableLengthData&& value)
-  { _timeStamp = std::move(value); }
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
 #endif
-  VariableLengthData& getTimeStamp()
-  { return _timeStamp; }
-  const VariableLengthData& getTimeStamp() const
-  { return _timeStamp; }
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
 
-  void setMessageRetractionHandle(const MessageRetractionHandle& value)
-  { _messageRetractionHandle = value; }
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setMessageRetractionHandle(MessageRetractionHandle&& value)
-  { _messageRetractionHandle = std::move(value); }
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
 #endif
-  MessageRetractionHandle& getMessageRetractionHandle()
-  { return _messageRetractionHandle; }
-  const MessageRetractionHandle& getMessageRetractionHandle() const
-  { return _messageRetractionHandle; }
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
 
 private:
   FederationHandle _federationHandle;
-  FederateHandle _federateHandle;
-  ObjectInstanceHandle _objectInstanceHandle;
-  OrderType _orderType;
-  VariableLengthData _tag;
-  VariableLengthData _timeStamp;
-  MessageRetractionHandle _messageRetractionHandle;
+  FederateHandle _federateHandle;
+  InteractionClassHandle _interactionClassHandle;
+  TransportationType _transportationType;
 };
 
-class OPENRTI_API AttributeUpdateMessage : public AbstractMessage {
+class OPENRTI_API QueryAttributeTransportationTypeRequestMessage : public AbstractMessage {
 public:
-  AttributeUpdateMessage();
-  virtual ~AttributeUpdateMessage();
+  QueryAttributeTransportationTypeRequestMessage();
+  virtual ~QueryAttributeTransportationTypeRequestMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const AttributeUpdateMessage& rhs) const;
-  bool operator<(const AttributeUpdateMessage& rhs) const;
-  bool operator!=(const AttributeUpdateMessage& rhs) const
+  bool operator==(const QueryAttributeTransportationTypeRequestMessage& rhs) const;
+  bool operator<(const QueryAttributeTransportationTypeRequestMessage& rhs) const;
+  bool operator!=(const QueryAttributeTransportationTypeRequestMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const AttributeUpdateMessage& rhs) const
+  bool operator>(const QueryAttributeTransportationTypeRequestMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const AttributeUpdateMessage& rhs) const
+  bool operator>=(const QueryAttributeTransportationTypeRequestMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const AttributeUpdateMessage& rhs) const
+  bool operator<=(const QueryAttributeTransportationTypeRequestMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual bool getReliable() const;
-
-  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
-
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -6439,73 +9128,45 @@ public:
   const ObjectInstanceHandle& getObjectInstanceHandle() const
   { return _objectInstanceHandle; }
 
-  void setTag(const VariableLengthData& value)
-  { _tag = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTag(VariableLengthData&& value)
-  { _tag = std::move(value); }
-#endif
-  VariableLengthData& getTag()
-  { return _tag; }
-  const VariableLengthData& getTag() const
-  { return _tag; }
-
-  void setTransportationType(const TransportationType& value)
-  { _transportationType = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTransportationType(TransportationType&& value)
-  { _transportationType = std::move(value); }
-#endif
-  TransportationType& getTransportationType()
-  { return _transportationType; }
-  const TransportationType& getTransportationType() const
-  { return _transportationType; }
-
-  void setAttributeValues(const AttributeValueVector& value)
-  { _attributeValues = value; }
+  void setAttributeHandle(const AttributeHandle& value)
+  { _attributeHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeValues(AttributeValueVector&& value)
-  { _attributeValues = std::move(value); }
+  void setAttributeHandle(AttributeHandle&& value)
+  { _attributeHandle = std::move(value); }
 #endif
-  AttributeValueVector& getAttributeValues()
-  { return _attributeValues; }
-  const AttributeValueVector& getAttributeValues() const
-  { return _attributeValues; }
+  AttributeHandle& getAttributeHandle()
+  { return _attributeHandle; }
+  const AttributeHandle& getAttributeHandle() const
+  { return _attributeHandle; }
 
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
   ObjectInstanceHandle _objectInstanceHandle;
-  VariableLengthData _tag;
-  TransportationType _transportationType;
-  AttributeValueVector _attributeValues;
+  AttributeHandle _attributeHandle;
 };
 
-class OPENRTI_API TimeStampedAttributeUpdateMessage : public AbstractMessage {
+class OPENRTI_API QueryAttributeTransportationTypeResponseMessage : public AbstractMessage {
 public:
-  TimeStampedAttributeUpdateMessage();
-  virtual ~TimeStampedAttributeUpdateMessage();
+  QueryAttributeTransportationTypeResponseMessage();
+  virtual ~QueryAttributeTransportationTypeResponseMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const TimeStampedAttributeUpdateMessage& rhs) const;
-  bool operator<(const TimeStampedAttributeUpdateMessage& rhs) const;
-  bool operator!=(const TimeStampedAttributeUpdateMessage& rhs) const
+  bool operator==(const QueryAttributeTransportationTypeResponseMessage& rhs) const;
+  bool operator<(const QueryAttributeTransportationTypeResponseMessage& rhs) const;
+  bool operator!=(const QueryAttributeTransportationTypeResponseMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const TimeStampedAttributeUpdateMessage& rhs) const
+  bool operator>(const QueryAttributeTransportationTypeResponseMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const TimeStampedAttributeUpdateMessage& rhs) const
+  bool operator>=(const QueryAttributeTransportationTypeResponseMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const TimeStampedAttributeUpdateMessage& rhs) const
+  bool operator<=(const QueryAttributeTransportationTypeResponseMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual bool getReliable() const;
-
-  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
-
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -6539,107 +9200,129 @@ public:
   const ObjectInstanceHandle& getObjectInstanceHandle() const
   { return _objectInstanceHandle; }
 
-  void setTag(const VariableLengthData& value)
-  { _tag = value; }
+  void setAttributeHandle(const AttributeHandle& value)
+  { _attributeHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTag(VariableLengthData&& value)
-  { _tag = std::move(value); }
+  void setAttributeHandle(AttributeHandle&& value)
+  { _attributeHandle = std::move(value); }
 #endif
-  VariableLengthData& getTag()
-  { return _tag; }
-  const VariableLengthData& getTag() const
-  { return _tag; }
+  AttributeHandle& getAttributeHandle()
+  { return _attributeHandle; }
+  const AttributeHandle& getAttributeHandle() const
+  { return _attributeHandle; }
 
-  void setTimeStamp(const VariableLengthData& value)
-  { _timeStamp = value; }
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTimeStamp(VariableLengthData&& value)
-  { _timeStamp = std::move(value); }
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
 #endif
-  VariableLengthData& getTimeStamp()
-  { return _timeStamp; }
-  const VariableLengthData& getTimeStamp() const
-  { return _timeStamp; }
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
 
-  void setMessageRetractionHandle(const MessageRetractionHandle& value)
-  { _messageRetractionHandle = value; }
+private:
+  FederationHandle _federationHandle;
+  FederateHandle _federateHandle;
+  ObjectInstanceHandle _objectInstanceHandle;
+  AttributeHandle _attributeHandle;
+  TransportationType _transportationType;
+};
+
+class OPENRTI_API QueryInteractionTransportationTypeRequestMessage : public AbstractMessage {
+public:
+  QueryInteractionTransportationTypeRequestMessage();
+  virtual ~QueryInteractionTransportationTypeRequestMessage();
+
+  virtual const char* getTypeName() const;
+  virtual void out(std::ostream& os) const;
+  virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
+
+  virtual bool operator==(const AbstractMessage& rhs) const;
+  bool operator==(const QueryInteractionTransportationTypeRequestMessage& rhs) const;
+  bool operator<(const QueryInteractionTransportationTypeRequestMessage& rhs) const;
+  bool operator!=(const QueryInteractionTransportationTypeRequestMessage& rhs) const
+  { return !operator==(rhs); }
+  bool operator>(const QueryInteractionTransportationTypeRequestMessage& rhs) const
+  { return rhs.operator<(*this); }
+  bool operator>=(const QueryInteractionTransportationTypeRequestMessage& rhs) const
+  { return !operator<(rhs); }
+  bool operator<=(const QueryInteractionTransportationTypeRequestMessage& rhs) const
+  { return !operator>(rhs); }
+
+  void setFederationHandle(const FederationHandle& value)
+  { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setMessageRetractionHandle(MessageRetractionHandle&& value)
-  { _messageRetractionHandle = std::move(value); }
+  void setFederationHandle(FederationHandle&& value)
+  { _federationHandle = std::move(value); }
 #endif
-  MessageRetractionHandle& getMessageRetractionHandle()
-  { return _messageRetractionHandle; }
-  const MessageRetractionHandle& getMessageRetractionHandle() const
-  { return _messageRetractionHandle; }
+  FederationHandle& getFederationHandle()
+  { return _federationHandle; }
+  const FederationHandle& getFederationHandle() const
+  { return _federationHandle; }
 
-  void setOrderType(const OrderType& value)
-  { _orderType = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setOrderType(OrderType&& value)
-  { _orderType = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  OrderType& getOrderType()
-  { return _orderType; }
-  const OrderType& getOrderType() const
-  { return _orderType; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
-  void setTransportationType(const TransportationType& value)
-  { _transportationType = value; }
+  void setQueriedFederateHandle(const FederateHandle& value)
+  { _queriedFederateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTransportationType(TransportationType&& value)
-  { _transportationType = std::move(value); }
+  void setQueriedFederateHandle(FederateHandle&& value)
+  { _queriedFederateHandle = std::move(value); }
 #endif
-  TransportationType& getTransportationType()
-  { return _transportationType; }
-  const TransportationType& getTransportationType() const
-  { return _transportationType; }
+  FederateHandle& getQueriedFederateHandle()
+  { return _queriedFederateHandle; }
+  const FederateHandle& getQueriedFederateHandle() const
+  { return _queriedFederateHandle; }
 
-  void setAttributeValues(const AttributeValueVector& value)
-  { _attributeValues = value; }
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeValues(AttributeValueVector&& value)
-  { _attributeValues = std::move(value); }
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
 #endif
-  AttributeValueVector& getAttributeValues()
-  { return _attributeValues; }
-  const AttributeValueVector& getAttributeValues() const
-  { return _attributeValues; }
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
 
 private:
   FederationHandle _federationHandle;
   FederateHandle _federateHandle;
-  ObjectInstanceHandle _objectInstanceHandle;
-  VariableLengthData _tag;
-  VariableLengthData _timeStamp;
-  MessageRetractionHandle _messageRetractionHandle;
-  OrderType _orderType;
-  TransportationType _transportationType;
-  AttributeValueVector _attributeValues;
+  FederateHandle _queriedFederateHandle;
+  InteractionClassHandle _interactionClassHandle;
 };
 
-class OPENRTI_API RequestAttributeUpdateMessage : public AbstractMessage {
+class OPENRTI_API QueryInteractionTransportationTypeResponseMessage : public AbstractMessage {
 public:
-  RequestAttributeUpdateMessage();
-  virtual ~RequestAttributeUpdateMessage();
+  QueryInteractionTransportationTypeResponseMessage();
+  virtual ~QueryInteractionTransportationTypeResponseMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const RequestAttributeUpdateMessage& rhs) const;
-  bool operator<(const RequestAttributeUpdateMessage& rhs) const;
-  bool operator!=(const RequestAttributeUpdateMessage& rhs) const
+  bool operator==(const QueryInteractionTransportationTypeResponseMessage& rhs) const;
+  bool operator<(const QueryInteractionTransportationTypeResponseMessage& rhs) const;
+  bool operator!=(const QueryInteractionTransportationTypeResponseMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const RequestAttributeUpdateMessage& rhs) const
+  bool operator>(const QueryInteractionTransportationTypeResponseMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const RequestAttributeUpdateMessage& rhs) const
+  bool operator>=(const QueryInteractionTransportationTypeResponseMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const RequestAttributeUpdateMessage& rhs) const
+  bool operator<=(const QueryInteractionTransportationTypeResponseMessage& rhs) const
   { return !operator>(rhs); }
 
-  virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;
-
   void setFederationHandle(const FederationHandle& value)
   { _federationHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
@@ -6651,65 +9334,77 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setObjectInstanceHandle(const ObjectInstanceHandle& value)
-  { _objectInstanceHandle = value; }
+  void setFederateHandle(const FederateHandle& value)
+  { _federateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectInstanceHandle(ObjectInstanceHandle&& value)
-  { _objectInstanceHandle = std::move(value); }
+  void setFederateHandle(FederateHandle&& value)
+  { _federateHandle = std::move(value); }
 #endif
-  ObjectInstanceHandle& getObjectInstanceHandle()
-  { return _objectInstanceHandle; }
-  const ObjectInstanceHandle& getObjectInstanceHandle() const
-  { return _objectInstanceHandle; }
+  FederateHandle& getFederateHandle()
+  { return _federateHandle; }
+  const FederateHandle& getFederateHandle() const
+  { return _federateHandle; }
 
-  void setAttributeHandles(const AttributeHandleVector& value)
-  { _attributeHandles = value; }
+  void setQueriedFederateHandle(const FederateHandle& value)
+  { _queriedFederateHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeHandles(AttributeHandleVector&& value)
-  { _attributeHandles = std::move(value); }
+  void setQueriedFederateHandle(FederateHandle&& value)
+  { _queriedFederateHandle = std::move(value); }
 #endif
-  AttributeHandleVector& getAttributeHandles()
-  { return _attributeHandles; }
-  const AttributeHandleVector& getAttributeHandles() const
-  { return _attributeHandles; }
+  FederateHandle& getQueriedFederateHandle()
+  { return _queriedFederateHandle; }
+  const FederateHandle& getQueriedFederateHandle() const
+  { return _queriedFederateHandle; }
 
-  void setTag(const VariableLengthData& value)
-  { _tag = value; }
+  void setInteractionClassHandle(const InteractionClassHandle& value)
+  { _interactionClassHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTag(VariableLengthData&& value)
-  { _tag = std::move(value); }
+  void setInteractionClassHandle(InteractionClassHandle&& value)
+  { _interactionClassHandle = std::move(value); }
 #endif
-  VariableLengthData& getTag()
-  { return _tag; }
-  const VariableLengthData& getTag() const
-  { return _tag; }
+  InteractionClassHandle& getInteractionClassHandle()
+  { return _interactionClassHandle; }
+  const InteractionClassHandle& getInteractionClassHandle() const
+  { return _interactionClassHandle; }
+
+  void setTransportationType(const TransportationType& value)
+  { _transportationType = value; }
+#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
+  void setTransportationType(TransportationType&& value)
+  { _transportationType = std::move(value); }
+#endif
+  TransportationType& getTransportationType()
+  { return _transportationType; }
+  const TransportationType& getTransportationType() const
+  { return _transportationType; }
 
 private:
   FederationHandle _federationHandle;
-  ObjectInstanceHandle _objectInstanceHandle;
-  AttributeHandleVector _attributeHandles;
-  VariableLengthData _tag;
+  FederateHandle _federateHandle;
+  FederateHandle _queriedFederateHandle;
+  InteractionClassHandle _interactionClassHandle;
+  TransportationType _transportationType;
 };
 
-class OPENRTI_API RequestClassAttributeUpdateMessage : public AbstractMessage {
+class OPENRTI_API MessageRetractionMessage : public AbstractMessage {
 public:
-  RequestClassAttributeUpdateMessage();
-  virtual ~RequestClassAttributeUpdateMessage();
+  MessageRetractionMessage();
+  virtual ~MessageRetractionMessage();
 
   virtual const char* getTypeName() const;
   virtual void out(std::ostream& os) const;
   virtual void dispatch(const AbstractMessageDispatcher& dispatcher) const;
 
   virtual bool operator==(const AbstractMessage& rhs) const;
-  bool operator==(const RequestClassAttributeUpdateMessage& rhs) const;
-  bool operator<(const RequestClassAttributeUpdateMessage& rhs) const;
-  bool operator!=(const RequestClassAttributeUpdateMessage& rhs) const
+  bool operator==(const MessageRetractionMessage& rhs) const;
+  bool operator<(const MessageRetractionMessage& rhs) const;
+  bool operator!=(const MessageRetractionMessage& rhs) const
   { return !operator==(rhs); }
-  bool operator>(const RequestClassAttributeUpdateMessage& rhs) const
+  bool operator>(const MessageRetractionMessage& rhs) const
   { return rhs.operator<(*this); }
-  bool operator>=(const RequestClassAttributeUpdateMessage& rhs) const
+  bool operator>=(const MessageRetractionMessage& rhs) const
   { return !operator<(rhs); }
-  bool operator<=(const RequestClassAttributeUpdateMessage& rhs) const
+  bool operator<=(const MessageRetractionMessage& rhs) const
   { return !operator>(rhs); }
 
   void setFederationHandle(const FederationHandle& value)
@@ -6723,44 +9418,20 @@ public:
   const FederationHandle& getFederationHandle() const
   { return _federationHandle; }
 
-  void setObjectClassHandle(const ObjectClassHandle& value)
-  { _objectClassHandle = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setObjectClassHandle(ObjectClassHandle&& value)
-  { _objectClassHandle = std::move(value); }
-#endif
-  ObjectClassHandle& getObjectClassHandle()
-  { return _objectClassHandle; }
-  const ObjectClassHandle& getObjectClassHandle() const
-  { return _objectClassHandle; }
-
-  void setAttributeHandles(const AttributeHandleVector& value)
-  { _attributeHandles = value; }
-#if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setAttributeHandles(AttributeHandleVector&& value)
-  { _attributeHandles = std::move(value); }
-#endif
-  AttributeHandleVector& getAttributeHandles()
-  { return _attributeHandles; }
-  const AttributeHandleVector& getAttributeHandles() const
-  { return _attributeHandles; }
-
-  void setTag(const VariableLengthData& value)
-  { _tag = value; }
+  void setMessageRetractionHandle(const MessageRetractionHandle& value)
+  { _messageRetractionHandle = value; }
 #if 201103L <= __cplusplus || 200610L <= __cpp_rvalue_reference
-  void setTag(VariableLengthData&& value)
-  { _tag = std::move(value); }
+  void setMessageRetractionHandle(MessageRetractionHandle&& value)
+  { _messageRetractionHandle = std::move(value); }
 #endif
-  VariableLengthData& getTag()
-  { return _tag; }
-  const VariableLengthData& getTag() const
-  { return _tag; }
+  MessageRetractionHandle& getMessageRetractionHandle()
+  { return _messageRetractionHandle; }
+  const MessageRetractionHandle& getMessageRetractionHandle() const
+  { return _messageRetractionHandle; }
 
 private:
   FederationHandle _federationHandle;
-  ObjectClassHandle _objectClassHandle;
-  AttributeHandleVector _attributeHandles;
-  VariableLengthData _tag;
+  MessageRetractionHandle _messageRetractionHandle;
 };
 
 
@@ -6844,6 +9515,7 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const RestoreFailureR
   case FEDERATE_REPORTED_FAILURE_DURING_RESTORE: os << "FEDERATE_REPORTED_FAILURE_DURING_RESTORE"; break;
   case FEDERATE_RESIGNED_DURING_RESTORE: os << "FEDERATE_RESIGNED_DURING_RESTORE"; break;
   case RTI_DETECTED_FAILURE_DURING_RESTORE: os << "RTI_DETECTED_FAILURE_DURING_RESTORE"; break;
+  case RESTORE_ABORTED: os << "RESTORE_ABORTED"; break;
   }
   return os;
 }
@@ -6873,6 +9545,7 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const SaveFailureReas
   case FEDERATE_RESIGNED_DURING_SAVE: os << "FEDERATE_RESIGNED_DURING_SAVE"; break;
   case RTI_DETECTED_FAILURE_DURING_SAVE: os << "RTI_DETECTED_FAILURE_DURING_SAVE"; break;
   case SAVE_TIME_CANNOT_BE_HONORED: os << "SAVE_TIME_CANNOT_BE_HONORED"; break;
+  case SAVE_ABORTED: os << "SAVE_ABORTED"; break;
   }
   return os;
 }
@@ -7121,6 +9794,33 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const FederateHandleB
   return os;
 }
 
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederateHandleCommitIdPair& value)
+{
+  os << "{ ";
+  os << "first: " << value.first << ", ";
+  os << "second: " << value.second;
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederateHandleCommitIdPairVector& value)
+{
+  os << "{ ";
+  FederateHandleCommitIdPairVector::const_iterator i = value.begin();
+  if (i != value.end()) {
+    os << *i;
+    while (++i != value.end()) {
+      os << ", " << *i;
+    }
+  }
+  os << " }";
+  return os;
+}
+
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
 operator<<(std::basic_ostream<char_type, traits_type>& os, const RangeBoundsValue& value)
@@ -7305,6 +10005,38 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const AttributeStateV
   return os;
 }
 
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ObjectInstanceState& value)
+{
+  os << "{ ";
+  os << "objectClassHandle: " << value.getObjectClassHandle();
+  os << ", ";
+  os << "objectInstanceHandle: " << value.getObjectInstanceHandle();
+  os << ", ";
+  os << "name: " << value.getName();
+  os << ", ";
+  os << "attributeStateVector: " << value.getAttributeStateVector();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ObjectInstanceStateVector& value)
+{
+  os << "{ ";
+  ObjectInstanceStateVector::const_iterator i = value.begin();
+  if (i != value.end()) {
+    os << *i;
+    while (++i != value.end()) {
+      os << ", " << *i;
+    }
+  }
+  os << " }";
+  return os;
+}
+
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
 operator<<(std::basic_ostream<char_type, traits_type>& os, const ParameterValue& value)
@@ -7448,18 +10180,197 @@ std::basic_ostream<char_type, traits_type>&
 operator<<(std::basic_ostream<char_type, traits_type>& os, const ObjectInstanceHandleNamePair& value)
 {
   os << "{ ";
-  os << "first: " << value.first << ", ";
-  os << "second: " << value.second;
+  os << "first: " << value.first << ", ";
+  os << "second: " << value.second;
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ObjectInstanceHandleNamePairVector& value)
+{
+  os << "{ ";
+  ObjectInstanceHandleNamePairVector::const_iterator i = value.begin();
+  if (i != value.end()) {
+    os << *i;
+    while (++i != value.end()) {
+      os << ", " << *i;
+    }
+  }
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveFederate& value)
+{
+  os << "{ ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "name: " << value.getName();
+  os << ", ";
+  os << "federateType: " << value.getFederateType();
+  os << ", ";
+  os << "isTimeRegulating: " << value.getIsTimeRegulating();
+  os << ", ";
+  os << "timeAdvanceTimeStamp: " << value.getTimeAdvanceTimeStamp();
+  os << ", ";
+  os << "nextMessageTimeStamp: " << value.getNextMessageTimeStamp();
+  os << ", ";
+  os << "regionHandleDimensionHandleSetPairVector: " << value.getRegionHandleDimensionHandleSetPairVector();
+  os << ", ";
+  os << "regionHandleRegionValuePairVector: " << value.getRegionHandleRegionValuePairVector();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveFederateVector& value)
+{
+  os << "{ ";
+  FederationSaveFederateVector::const_iterator i = value.begin();
+  if (i != value.end()) {
+    os << *i;
+    while (++i != value.end()) {
+      os << ", " << *i;
+    }
+  }
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveInteractionClassSubscription& value)
+{
+  os << "{ ";
+  os << "interactionClassHandle: " << value.getInteractionClassHandle();
+  os << ", ";
+  os << "federateHandleVector: " << value.getFederateHandleVector();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveInteractionClassSubscriptionVector& value)
+{
+  os << "{ ";
+  FederationSaveInteractionClassSubscriptionVector::const_iterator i = value.begin();
+  if (i != value.end()) {
+    os << *i;
+    while (++i != value.end()) {
+      os << ", " << *i;
+    }
+  }
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveObjectClassSubscription& value)
+{
+  os << "{ ";
+  os << "objectClassHandle: " << value.getObjectClassHandle();
+  os << ", ";
+  os << "attributeHandle: " << value.getAttributeHandle();
+  os << ", ";
+  os << "federateHandleVector: " << value.getFederateHandleVector();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveObjectClassSubscriptionVector& value)
+{
+  os << "{ ";
+  FederationSaveObjectClassSubscriptionVector::const_iterator i = value.begin();
+  if (i != value.end()) {
+    os << *i;
+    while (++i != value.end()) {
+      os << ", " << *i;
+    }
+  }
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveHeader& value)
+{
+  os << "{ ";
+  os << "federationName: " << value.getFederationName();
+  os << ", ";
+  os << "logicalTimeFactoryName: " << value.getLogicalTimeFactoryName();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "federateVector: " << value.getFederateVector();
+  os << ", ";
+  os << "interactionClassSubscriptionVector: " << value.getInteractionClassSubscriptionVector();
+  os << ", ";
+  os << "objectClassSubscriptionVector: " << value.getObjectClassSubscriptionVector();
+  os << ", ";
+  os << "numObjectInstances: " << value.getNumObjectInstances();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const AttributeHandleFederateHandlePair& value)
+{
+  os << "{ ";
+  os << "first: " << value.first << ", ";
+  os << "second: " << value.second;
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const AttributeHandleFederateHandlePairVector& value)
+{
+  os << "{ ";
+  AttributeHandleFederateHandlePairVector::const_iterator i = value.begin();
+  if (i != value.end()) {
+    os << *i;
+    while (++i != value.end()) {
+      os << ", " << *i;
+    }
+  }
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveObjectInstance& value)
+{
+  os << "{ ";
+  os << "objectInstanceHandle: " << value.getObjectInstanceHandle();
+  os << ", ";
+  os << "name: " << value.getName();
+  os << ", ";
+  os << "objectClassHandle: " << value.getObjectClassHandle();
+  os << ", ";
+  os << "attributeHandleFederateHandlePairVector: " << value.getAttributeHandleFederateHandlePairVector();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const ObjectInstanceHandleNamePairVector& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSaveObjectInstanceVector& value)
 {
   os << "{ ";
-  ObjectInstanceHandleNamePairVector::const_iterator i = value.begin();
+  FederationSaveObjectInstanceVector::const_iterator i = value.begin();
   if (i != value.end()) {
     os << *i;
     while (++i != value.end()) {
@@ -7510,6 +10421,7 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const JoinFederationE
   case JoinFederationExecutionResponseSaveInProgress: os << "JoinFederationExecutionResponseSaveInProgress"; break;
   case JoinFederationExecutionResponseRestoreInProgress: os << "JoinFederationExecutionResponseRestoreInProgress"; break;
   case JoinFederationExecutionResponseInconsistentFDD: os << "JoinFederationExecutionResponseInconsistentFDD"; break;
+  case JoinFederationExecutionResponseMissingFOMModules: os << "JoinFederationExecutionResponseMissingFOMModules"; break;
   }
   return os;
 }
@@ -7811,6 +10723,8 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const FOMStringModule
   os << "{ ";
   os << "content: " << value.getContent();
   os << ", ";
+  os << "contentHash: " << value.getContentHash();
+  os << ", ";
   os << "transportationTypeList: " << value.getTransportationTypeList();
   os << ", ";
   os << "dimensionList: " << value.getDimensionList();
@@ -8247,6 +11161,25 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const EnumerateFedera
   return os;
 }
 
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const MetricsRequestMessage& value)
+{
+  os << "{ ";
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const MetricsResponseMessage& value)
+{
+  os << "{ ";
+  os << "metrics: " << value.getMetrics();
+  os << " }";
+  return os;
+}
+
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
 operator<<(std::basic_ostream<char_type, traits_type>& os, const InsertFederationExecutionMessage& value)
@@ -8265,155 +11198,395 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const InsertFederatio
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const ShutdownFederationExecutionMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ShutdownFederationExecutionMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const EraseFederationExecutionMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ReleaseFederationHandleMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const InsertModulesMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "fOMModuleList: " << value.getFOMModuleList();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const JoinFederationExecutionRequestMessage& value)
+{
+  os << "{ ";
+  os << "federationExecution: " << value.getFederationExecution();
+  os << ", ";
+  os << "federateType: " << value.getFederateType();
+  os << ", ";
+  os << "federateName: " << value.getFederateName();
+  os << ", ";
+  os << "fOMStringModuleList: " << value.getFOMStringModuleList();
+  os << ", ";
+  os << "fOMModuleContentHashVector: " << value.getFOMModuleContentHashVector();
+  os << ", ";
+  os << "configurationParameterMap: " << value.getConfigurationParameterMap();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const JoinFederationExecutionResponseMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "joinFederationExecutionResponseType: " << value.getJoinFederationExecutionResponseType();
+  os << ", ";
+  os << "exceptionString: " << value.getExceptionString();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "federateType: " << value.getFederateType();
+  os << ", ";
+  os << "federateName: " << value.getFederateName();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ResignFederationExecutionLeafRequestMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "resignAction: " << value.getResignAction();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ResignFederationExecutionRequestMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const JoinFederateNotifyMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "federateType: " << value.getFederateType();
+  os << ", ";
+  os << "federateName: " << value.getFederateName();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ResignFederateNotifyMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ChangeAutomaticResignDirectiveMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "resignAction: " << value.getResignAction();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const RegisterFederationSynchronizationPointMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "tag: " << value.getTag();
+  os << ", ";
+  os << "federateHandleVector: " << value.getFederateHandleVector();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const RegisterFederationSynchronizationPointResponseMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "registerFederationSynchronizationPointResponseType: " << value.getRegisterFederationSynchronizationPointResponseType();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const AnnounceSynchronizationPointMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "tag: " << value.getTag();
+  os << ", ";
+  os << "addJoiningFederates: " << value.getAddJoiningFederates();
+  os << ", ";
+  os << "federateHandleVector: " << value.getFederateHandleVector();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const SynchronizationPointAchievedMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "federateHandleBoolPairVector: " << value.getFederateHandleBoolPairVector();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSynchronizedMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "federateHandleBoolPairVector: " << value.getFederateHandleBoolPairVector();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const RequestFederationSaveMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "timeStamp: " << value.getTimeStamp();
+  os << ", ";
+  os << "timeStampValid: " << value.getTimeStampValid();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const EraseFederationExecutionMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const InitiateFederateSaveMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "timeStamp: " << value.getTimeStamp();
+  os << ", ";
+  os << "timeStampValid: " << value.getTimeStampValid();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const ReleaseFederationHandleMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederateSaveBegunMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const InsertModulesMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederateSaveCompleteMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
-  os << "fOMModuleList: " << value.getFOMModuleList();
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "successful: " << value.getSuccessful();
+  os << ", ";
+  os << "saveFailureReason: " << value.getSaveFailureReason();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const JoinFederationExecutionRequestMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSavedMessage& value)
 {
   os << "{ ";
-  os << "federationExecution: " << value.getFederationExecution();
-  os << ", ";
-  os << "federateType: " << value.getFederateType();
+  os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
-  os << "federateName: " << value.getFederateName();
+  os << "label: " << value.getLabel();
   os << ", ";
-  os << "fOMStringModuleList: " << value.getFOMStringModuleList();
+  os << "successful: " << value.getSuccessful();
   os << ", ";
-  os << "configurationParameterMap: " << value.getConfigurationParameterMap();
+  os << "saveFailureReason: " << value.getSaveFailureReason();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const JoinFederationExecutionResponseMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const AbortFederationSaveMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
-  os << "joinFederationExecutionResponseType: " << value.getJoinFederationExecutionResponseType();
-  os << ", ";
-  os << "exceptionString: " << value.getExceptionString();
-  os << ", ";
   os << "federateHandle: " << value.getFederateHandle();
-  os << ", ";
-  os << "federateType: " << value.getFederateType();
-  os << ", ";
-  os << "federateName: " << value.getFederateName();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const ResignFederationExecutionLeafRequestMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const QueryFederationSaveStatusRequestMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
   os << "federateHandle: " << value.getFederateHandle();
-  os << ", ";
-  os << "resignAction: " << value.getResignAction();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const ResignFederationExecutionRequestMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const QueryFederationSaveStatusResponseMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
   os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "federateHandleSaveStatusPairVector: " << value.getFederateHandleSaveStatusPairVector();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const JoinFederateNotifyMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const RequestFederationRestoreMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
   os << "federateHandle: " << value.getFederateHandle();
   os << ", ";
-  os << "federateType: " << value.getFederateType();
-  os << ", ";
-  os << "federateName: " << value.getFederateName();
+  os << "label: " << value.getLabel();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const ResignFederateNotifyMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const RequestFederationRestoreResponseMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
   os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "label: " << value.getLabel();
+  os << ", ";
+  os << "successful: " << value.getSuccessful();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const ChangeAutomaticResignDirectiveMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationRestoreBegunMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
-  os << "federateHandle: " << value.getFederateHandle();
-  os << ", ";
-  os << "resignAction: " << value.getResignAction();
+  os << "label: " << value.getLabel();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const RegisterFederationSynchronizationPointMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const InitiateFederateRestoreMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
@@ -8422,71 +11595,75 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const RegisterFederat
   os << ", ";
   os << "label: " << value.getLabel();
   os << ", ";
-  os << "tag: " << value.getTag();
-  os << ", ";
-  os << "federateHandleVector: " << value.getFederateHandleVector();
+  os << "federateName: " << value.getFederateName();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const RegisterFederationSynchronizationPointResponseMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederateRestoreCompleteMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
   os << "federateHandle: " << value.getFederateHandle();
   os << ", ";
-  os << "label: " << value.getLabel();
-  os << ", ";
-  os << "registerFederationSynchronizationPointResponseType: " << value.getRegisterFederationSynchronizationPointResponseType();
+  os << "successful: " << value.getSuccessful();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const AnnounceSynchronizationPointMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationRestoredMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
   os << "label: " << value.getLabel();
   os << ", ";
-  os << "tag: " << value.getTag();
-  os << ", ";
-  os << "addJoiningFederates: " << value.getAddJoiningFederates();
+  os << "successful: " << value.getSuccessful();
   os << ", ";
-  os << "federateHandleVector: " << value.getFederateHandleVector();
+  os << "restoreFailureReason: " << value.getRestoreFailureReason();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const SynchronizationPointAchievedMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const AbortFederationRestoreMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
-  os << "label: " << value.getLabel();
+  os << "federateHandle: " << value.getFederateHandle();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const QueryFederationRestoreStatusRequestMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
-  os << "federateHandleBoolPairVector: " << value.getFederateHandleBoolPairVector();
+  os << "federateHandle: " << value.getFederateHandle();
   os << " }";
   return os;
 }
 
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
-operator<<(std::basic_ostream<char_type, traits_type>& os, const FederationSynchronizedMessage& value)
+operator<<(std::basic_ostream<char_type, traits_type>& os, const QueryFederationRestoreStatusResponseMessage& value)
 {
   os << "{ ";
   os << "federationHandle: " << value.getFederationHandle();
   os << ", ";
-  os << "label: " << value.getLabel();
+  os << "federateHandle: " << value.getFederateHandle();
   os << ", ";
-  os << "federateHandleBoolPairVector: " << value.getFederateHandleBoolPairVector();
+  os << "federateHandleRestoreStatusPairVector: " << value.getFederateHandleRestoreStatusPairVector();
   os << " }";
   return os;
 }
@@ -8555,6 +11732,22 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const CommitLowerBoun
   return os;
 }
 
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const CollectedCommitLowerBoundTimeStampMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "timeStamp: " << value.getTimeStamp();
+  os << ", ";
+  os << "commitType: " << value.getCommitType();
+  os << ", ";
+  os << "federateHandleCommitIdPairVector: " << value.getFederateHandleCommitIdPairVector();
+  os << " }";
+  return os;
+}
+
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
 operator<<(std::basic_ostream<char_type, traits_type>& os, const CommitLowerBoundTimeStampResponseMessage& value)
@@ -8704,6 +11897,8 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const ChangeObjectCla
   os << "objectClassHandle: " << value.getObjectClassHandle();
   os << ", ";
   os << "attributeHandles: " << value.getAttributeHandles();
+  os << ", ";
+  os << "updateRate: " << value.getUpdateRate();
   os << " }";
   return os;
 }
@@ -8926,6 +12121,18 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const InsertObjectIns
   return os;
 }
 
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const InsertMultipleObjectInstancesMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "objectInstanceStateVector: " << value.getObjectInstanceStateVector();
+  os << " }";
+  return os;
+}
+
 template<typename char_type, typename traits_type>
 std::basic_ostream<char_type, traits_type>&
 operator<<(std::basic_ostream<char_type, traits_type>& os, const DeleteObjectInstanceMessage& value)
@@ -9042,6 +12249,154 @@ operator<<(std::basic_ostream<char_type, traits_type>& os, const RequestClassAtt
   return os;
 }
 
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ChangeAttributeTransportationTypeRequestMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "objectInstanceHandle: " << value.getObjectInstanceHandle();
+  os << ", ";
+  os << "attributeHandles: " << value.getAttributeHandles();
+  os << ", ";
+  os << "transportationType: " << value.getTransportationType();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ChangeAttributeTransportationTypeResponseMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "objectInstanceHandle: " << value.getObjectInstanceHandle();
+  os << ", ";
+  os << "attributeHandles: " << value.getAttributeHandles();
+  os << ", ";
+  os << "transportationType: " << value.getTransportationType();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ChangeInteractionTransportationTypeRequestMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "interactionClassHandle: " << value.getInteractionClassHandle();
+  os << ", ";
+  os << "transportationType: " << value.getTransportationType();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const ChangeInteractionTransportationTypeResponseMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "interactionClassHandle: " << value.getInteractionClassHandle();
+  os << ", ";
+  os << "transportationType: " << value.getTransportationType();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const QueryAttributeTransportationTypeRequestMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "objectInstanceHandle: " << value.getObjectInstanceHandle();
+  os << ", ";
+  os << "attributeHandle: " << value.getAttributeHandle();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const QueryAttributeTransportationTypeResponseMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "objectInstanceHandle: " << value.getObjectInstanceHandle();
+  os << ", ";
+  os << "attributeHandle: " << value.getAttributeHandle();
+  os << ", ";
+  os << "transportationType: " << value.getTransportationType();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const QueryInteractionTransportationTypeRequestMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "queriedFederateHandle: " << value.getQueriedFederateHandle();
+  os << ", ";
+  os << "interactionClassHandle: " << value.getInteractionClassHandle();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const QueryInteractionTransportationTypeResponseMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "federateHandle: " << value.getFederateHandle();
+  os << ", ";
+  os << "queriedFederateHandle: " << value.getQueriedFederateHandle();
+  os << ", ";
+  os << "interactionClassHandle: " << value.getInteractionClassHandle();
+  os << ", ";
+  os << "transportationType: " << value.getTransportationType();
+  os << " }";
+  return os;
+}
+
+template<typename char_type, typename traits_type>
+std::basic_ostream<char_type, traits_type>&
+operator<<(std::basic_ostream<char_type, traits_type>& os, const MessageRetractionMessage& value)
+{
+  os << "{ ";
+  os << "federationHandle: " << value.getFederationHandle();
+  os << ", ";
+  os << "messageRetractionHandle: " << value.getMessageRetractionHandle();
+  os << " }";
+  return os;
+}
+
 } // namespace OpenRTI
 
 #endif
@@ -22,12 +22,80 @@
 
 #include "AbstractMessageQueue.h"
 #include "Condition.h"
+#include "Metrics.h"
 #include "PooledMessageList.h"
 #include "Mutex.h"
 #include "ScopeLock.h"
 
 namespace OpenRTI {
 
+// The two lanes of messages sent to a network connect.
+// Messages that need to be delivered reliably stay in order on the first lane.
+// Best effort messages go to a second lane that is scheduled independently,
+// so that they never wait behind a backlog of reliable messages.
+// If both lanes have messages, the lanes take turns.
+// Messages for the same object instance still stay in order. A best effort message
+// waits on the reliable lane behind reliable messages for its object instance,
+// and a reliable message takes the best effort messages for its object instance
+// along to the reliable lane, so an update cannot pass the insert or delete of its instance.
+// The best effort lane is bounded, if the receiver cannot keep up,
+// the oldest best effort messages are dropped and counted in the metrics.
+class OPENRTI_LOCAL LaneMessageList {
+public:
+  enum { MaxBestEffortSize = 4096 };
+
+  LaneMessageList() :
+    _reliableList(true),
+    _bestEffortList(true),
+    _bestEffortSize(0),
+    _bestEffortTurn(true)
+  { }
+
+  bool empty() const
+  { return _reliableList.empty() && _bestEffortList.empty(); }
+  void push_back(const SharedPtr<const AbstractMessage>& message)
+  {
+    ObjectInstanceHandle objectInstanceHandle = message->getObjectInstanceHandleForMessage();
+    if (message->getReliable()) {
+      if (_bestEffortSize && objectInstanceHandle.valid())
+        _bestEffortSize -= _bestEffortList.splice(objectInstanceHandle, _reliableList);
+      _reliableList.push_back(message);
+    } else if (objectInstanceHandle.valid() && _reliableList.contains(objectInstanceHandle)) {
+      _reliableList.push_back(message);
+    } else {
+      if (MaxBestEffortSize <= _bestEffortSize) {
+        _bestEffortList.pop_front();
+        --_bestEffortSize;
+        Metrics::instance().getDroppedBestEffortMessages().inc();
+      }
+      _bestEffortList.push_back(message);
+      ++_bestEffortSize;
+    }
+  }
+  SharedPtr<const AbstractMessage> pop_front()
+  {
+    if (_bestEffortList.empty() || (!_bestEffortTurn && !_reliableList.empty())) {
+      _bestEffortTurn = true;
+      return _reliableList.pop_front();
+    }
+    _bestEffortTurn = false;
+    --_bestEffortSize;
+    return _bestEffortList.pop_front();
+  }
+  // Control messages are reliable, they are only taken if they are next in order
+  SharedPtr<const AbstractMessage> pop_front_control()
+  { return _reliableList.pop_front_control(); }
+  // Only time stamp order messages carry a retraction handle and these are always reliable
+  unsigned retract(const MessageRetractionHandle& messageRetractionHandle)
+  { return _reliableList.retract(messageRetractionHandle); }
+
+private:
+  PooledMessageList _reliableList;
+  PooledMessageList _bestEffortList;
+  size_t _bestEffortSize;
+  bool _bestEffortTurn;
+};
+
 // Unlocked queue implementation,
 // For single threaded use.
 // The timeout in the receive call is just ignored since
@@ -42,6 +110,8 @@ public:
   { return _messageList.pop_front(); }
   virtual SharedPtr<const AbstractMessage> receive(const Clock&)
   { return _messageList.pop_front(); }
+  virtual SharedPtr<const AbstractMessage> receiveControl()
+  { return _messageList.pop_front_control(); }
   virtual bool isOpen() const
   { return !_isClosed; }
   virtual bool empty() const
@@ -50,6 +120,8 @@ public:
 protected:
   virtual void append(const SharedPtr<const AbstractMessage>& message)
   { _messageList.push_back(message); }
+  virtual unsigned retract(const MessageRetractionHandle& messageRetractionHandle)
+  { return _messageList.retract(messageRetractionHandle); }
   virtual void close()
   { _isClosed = true; }
 
@@ -58,6 +130,37 @@ private:
   bool _isClosed;
 };
 
+// Unlocked queue for the connects to network peers, for single threaded use like the above.
+// Best effort messages are queued in a lane of their own.
+class OPENRTI_LOCAL NetworkMessageQueue : public AbstractMessageQueue {
+public:
+  NetworkMessageQueue() :
+    _isClosed(false)
+  { }
+  virtual SharedPtr<const AbstractMessage> receive()
+  { return _messageList.pop_front(); }
+  virtual SharedPtr<const AbstractMessage> receive(const Clock&)
+  { return _messageList.pop_front(); }
+  virtual SharedPtr<const AbstractMessage> receiveControl()
+  { return _messageList.pop_front_control(); }
+  virtual bool isOpen() const
+  { return !_isClosed; }
+  virtual bool empty() const
+  { return _messageList.empty(); }
+
+protected:
+  virtual void append(const SharedPtr<const AbstractMessage>& message)
+  { _messageList.push_back(message); }
+  virtual unsigned retract(const MessageRetractionHandle& messageRetractionHandle)
+  { return _messageList.retract(messageRetractionHandle); }
+  virtual void close()
+  { _isClosed = true; }
+
+private:
+  LaneMessageList _messageList;
+  bool _isClosed;
+};
+
 // Thread safe queue with condition/mutex based signaling of new messages
 class OPENRTI_LOCAL ThreadMessageQueue : public AbstractMessageQueue {
 public:
@@ -99,6 +202,11 @@ public:
     }
     return _messageList.pop_front();
   }
+  virtual SharedPtr<const AbstractMessage> receiveControl()
+  {
+    ScopeLock scopeLock(_mutex);
+    return _messageList.pop_front_control();
+  }
   virtual bool isOpen() const
   {
     ScopeLock scopeLock(_mutex);
@@ -119,6 +227,11 @@ protected:
     if (needSignal)
       _condition.notify_one();
   }
+  virtual unsigned retract(const MessageRetractionHandle& messageRetractionHandle)
+  {
+    ScopeLock scopeLock(_mutex);
+    return _messageList.retract(messageRetractionHandle);
+  }
   virtual void close()
   {
     ScopeLock scopeLock(_mutex);
@@ -0,0 +1,220 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "MessageTrace.h"
+
+#include <cstdlib>
+#include <fstream>
+#include "Clock.h"
+#include "LogStream.h"
+#include "ScopeLock.h"
+#include "StringUtils.h"
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace OpenRTI {
+
+Atomic MessageTrace::_enabled(0);
+
+struct OPENRTI_LOCAL MessageTraceFile {
+  MessageTraceFile() :
+    _first(true),
+    _processId(0),
+    _traceIdBase(0),
+    _traceCount(0)
+  {
+#if defined(_WIN32)
+    _processId = unsigned(_getpid());
+#else
+    _processId = unsigned(getpid());
+#endif
+    // Keep the ids in the 53 bits a json number can exactly represent
+    _traceIdBase = uint64_t((Clock::now().getNSec() ^ _processId) & 0xfffff) << 32;
+  }
+  // Intentionally leaked, the environment object below closes the file at exit
+  static MessageTraceFile& instance()
+  {
+    static MessageTraceFile* messageTraceFile = new MessageTraceFile;
+    return *messageTraceFile;
+  }
+
+  void open(const std::string& traceFile)
+  {
+    close();
+    if (traceFile.empty())
+      return;
+    _stream.open(utf8ToLocale(traceFile).c_str(), std::ios::out | std::ios::trunc);
+    if (!_stream.is_open()) {
+      Log(MessageCoding, Warning) << "Could not open trace file \"" << traceFile << "\"!" << std::endl;
+      return;
+    }
+    _stream << "[";
+    _first = true;
+  }
+  void close()
+  {
+    if (!_stream.is_open())
+      return;
+    _stream << "]" << std::endl;
+    _stream.close();
+  }
+
+  void write(const char* typeName, const MessageTrace& messageTrace, const MessageTrace::Stamp& dispatchStamp)
+  {
+    if (!_stream.is_open())
+      return;
+    MessageTrace::StampVector stampVector = messageTrace.getStampVector();
+    stampVector.push_back(dispatchStamp);
+    // Each step between two consecutive stamps is written as complete event
+    // on a track of its own per trace.
+    for (MessageTrace::StampVector::size_type i = 1; i < stampVector.size(); ++i) {
+      if (!_first)
+        _stream << ",";
+      _first = false;
+      uint64_t start = stampVector[i - 1]._nsec;
+      uint64_t end = stampVector[i]._nsec;
+      if (end < start)
+        end = start;
+      _stream << "\n{\"name\":\"" << MessageTrace::getPointName(stampVector[i - 1]._point)
+              << "->" << MessageTrace::getPointName(stampVector[i]._point) << "\""
+              << ",\"cat\":\"" << typeName << "\""
+              << ",\"ph\":\"X\""
+              << ",\"ts\":" << start/1000 << "." << (start/100) % 10
+              << ",\"dur\":" << (end - start)/1000 << "." << ((end - start)/100) % 10
+              << ",\"pid\":" << _processId
+              << ",\"tid\":" << messageTrace.getTraceId() << "}";
+    }
+  }
+
+  Mutex _mutex;
+  std::ofstream _stream;
+  bool _first;
+  unsigned _processId;
+  uint64_t _traceIdBase;
+  Atomic _traceCount;
+};
+
+// Pick up the environment variable at load time
+struct OPENRTI_LOCAL MessageTraceEnvironment {
+  MessageTraceEnvironment()
+  {
+    const char* traceFile = std::getenv("OPENRTI_TRACE_FILE");
+    if (traceFile && *traceFile)
+      MessageTrace::setTraceFile(localeToUtf8(traceFile));
+  }
+  ~MessageTraceEnvironment()
+  {
+    MessageTrace::setTraceFile(std::string());
+  }
+};
+
+static MessageTraceEnvironment messageTraceEnvironment;
+
+MessageTrace::MessageTrace(uint64_t traceId) :
+  _traceId(traceId)
+{
+}
+
+MessageTrace::MessageTrace(const MessageTrace& messageTrace) :
+  Referenced(),
+  _traceId(messageTrace.getTraceId()),
+  _stampVector(messageTrace.getStampVector())
+{
+}
+
+MessageTrace::~MessageTrace()
+{
+}
+
+void
+MessageTrace::stamp(Point point)
+{
+  Stamp stamp(point, Clock::now().getNSec());
+  ScopeLock scopeLock(_mutex);
+  _stampVector.push_back(stamp);
+}
+
+MessageTrace::StampVector
+MessageTrace::getStampVector() const
+{
+  ScopeLock scopeLock(_mutex);
+  return _stampVector;
+}
+
+void
+MessageTrace::setStampVector(const StampVector& stampVector)
+{
+  ScopeLock scopeLock(_mutex);
+  _stampVector = stampVector;
+}
+
+const char*
+MessageTrace::getPointName(unsigned point)
+{
+  switch (point) {
+  case SendPoint:
+    return "send";
+  case EncodePoint:
+    return "encode";
+  case DecodePoint:
+    return "decode";
+  case RoutePoint:
+    return "route";
+  case DispatchPoint:
+    return "dispatch";
+  default:
+    return "unknown";
+  }
+}
+
+MessageTrace*
+MessageTrace::create()
+{
+  if (!getEnabled())
+    return 0;
+  MessageTraceFile& messageTraceFile = MessageTraceFile::instance();
+  MessageTrace* messageTrace = new MessageTrace(messageTraceFile._traceIdBase | messageTraceFile._traceCount.incFetch(Atomic::MemoryOrderRelaxed));
+  messageTrace->stamp(SendPoint);
+  return messageTrace;
+}
+
+void
+MessageTrace::setTraceFile(const std::string& traceFile)
+{
+  MessageTraceFile& messageTraceFile = MessageTraceFile::instance();
+  ScopeLock scopeLock(messageTraceFile._mutex);
+  messageTraceFile.open(traceFile);
+  unsigned enabled = messageTraceFile._stream.is_open() ? 1 : 0;
+  while (unsigned(_enabled) != enabled && !_enabled.compareAndExchange(1 - enabled, enabled));
+}
+
+void
+MessageTrace::write(const char* typeName, const MessageTrace& messageTrace)
+{
+  Stamp dispatchStamp(DispatchPoint, Clock::now().getNSec());
+  MessageTraceFile& messageTraceFile = MessageTraceFile::instance();
+  ScopeLock scopeLock(messageTraceFile._mutex);
+  messageTraceFile.write(typeName, messageTrace, dispatchStamp);
+}
+
+} // namespace OpenRTI
@@ -0,0 +1,103 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_MessageTrace_h
+#define OpenRTI_MessageTrace_h
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "Atomic.h"
+#include "Export.h"
+#include "Mutex.h"
+#include "Referenced.h"
+#include "Types.h"
+
+namespace OpenRTI {
+
+/// Time stamps collected along the path of a single message.
+/// A trace is attached to a message when it is sent from an ambassador while
+/// tracing is enabled. Connects that negotiated the trace extension carry the
+/// stamps over the wire. The trace is written once the message is dispatched
+/// to the receiving federate.
+/// Messages are shared between several receivers, so only the owner of a
+/// message stamps into its trace. Stamps that happen per receiver are only
+/// added to copies.
+class OPENRTI_API MessageTrace : public Referenced {
+public:
+  enum Point {
+    SendPoint,
+    EncodePoint,
+    DecodePoint,
+    RoutePoint,
+    DispatchPoint
+  };
+
+  struct Stamp {
+    Stamp() : _point(0), _nsec(0) { }
+    Stamp(unsigned point, uint64_t nsec) : _point(point), _nsec(nsec) { }
+    unsigned _point;
+    uint64_t _nsec;
+  };
+  typedef std::vector<Stamp> StampVector;
+
+  MessageTrace(uint64_t traceId = 0);
+  MessageTrace(const MessageTrace& messageTrace);
+  ~MessageTrace();
+
+  uint64_t getTraceId() const
+  { return _traceId; }
+
+  void stamp(Point point);
+
+  StampVector getStampVector() const;
+  void setStampVector(const StampVector& stampVector);
+
+  static const char* getPointName(unsigned point);
+
+  /// Returns true if new traces should be started.
+  /// This is the only cost on the message path with tracing disabled.
+  static bool getEnabled()
+  { return 0 != unsigned(_enabled); }
+
+  /// Start a new trace if tracing is enabled
+  static MessageTrace* create();
+
+  /// Enables tracing and writes completed traces in the chrome trace event
+  /// format into the given file. An empty file name disables tracing.
+  /// Tracing can also be enabled with the OPENRTI_TRACE_FILE environment variable.
+  static void setTraceFile(const std::string& traceFile);
+
+  /// Write the trace of a message dispatched to the federate just now
+  static void write(const char* typeName, const MessageTrace& messageTrace);
+
+private:
+  MessageTrace& operator=(const MessageTrace&);
+
+  uint64_t _traceId;
+
+  mutable Mutex _mutex;
+  StampVector _stampVector;
+
+  static Atomic _enabled;
+};
+
+} // namespace OpenRTI
+
+#endif
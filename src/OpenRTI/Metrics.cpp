@@ -0,0 +1,176 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "Metrics.h"
+
+#include <ostream>
+#include <sstream>
+#include "ScopeLock.h"
+
+namespace OpenRTI {
+
+void
+MetricsHistogram::write(std::ostream& stream) const
+{
+  stream << "{\"count\":" << getCount() << ",\"sum\":" << getSum() << ",\"buckets\":[";
+  // Omit the trailing empty buckets
+  unsigned numBuckets = NumBuckets;
+  while (0 < numBuckets && getBucket(numBuckets - 1) == 0)
+    --numBuckets;
+  for (unsigned i = 0; i < numBuckets; ++i) {
+    if (i)
+      stream << ",";
+    stream << getBucket(i);
+  }
+  stream << "]}";
+}
+
+ConnectMetrics::ConnectMetrics(const std::string& name) :
+  _name(name)
+{
+  Metrics::instance().insert(*this);
+}
+
+ConnectMetrics::~ConnectMetrics()
+{
+  Metrics::instance().erase(*this);
+}
+
+void
+ConnectMetrics::write(std::ostream& stream) const
+{
+  stream << "{\"name\":\"" << _name << "\""
+         << ",\"messagesIn\":" << _messagesIn.get()
+         << ",\"messagesOut\":" << _messagesOut.get()
+         << ",\"bytesIn\":" << _bytesIn.get()
+         << ",\"bytesOut\":" << _bytesOut.get() << "}";
+}
+
+Metrics&
+Metrics::instance()
+{
+  // Never destroyed, connect metrics may still unregister during static destruction
+  static Metrics* metrics = new Metrics;
+  return *metrics;
+}
+
+void
+Metrics::readMessage(unsigned opcode, const char* typeName, uint64_t bytes)
+{
+  if (MaxOpcode <= opcode)
+    return;
+  MessageTypeMetrics& messageTypeMetrics = _messageTypeMetrics[opcode];
+  messageTypeMetrics.setTypeName(typeName);
+  messageTypeMetrics._messagesIn.inc();
+  messageTypeMetrics._bytesIn.add(bytes);
+}
+
+void
+Metrics::writeMessage(unsigned opcode, const char* typeName, uint64_t bytes)
+{
+  if (MaxOpcode <= opcode)
+    return;
+  MessageTypeMetrics& messageTypeMetrics = _messageTypeMetrics[opcode];
+  messageTypeMetrics.setTypeName(typeName);
+  messageTypeMetrics._messagesOut.inc();
+  messageTypeMetrics._bytesOut.add(bytes);
+}
+
+void
+Metrics::write(std::ostream& stream) const
+{
+  stream << "{\"timeNSec\":" << Clock::now().getNSec();
+
+  stream << ",\"messageTypes\":[";
+  bool first = true;
+  for (unsigned i = 0; i < MaxOpcode; ++i) {
+    const MessageTypeMetrics& messageTypeMetrics = _messageTypeMetrics[i];
+    const char* typeName = messageTypeMetrics.getTypeName();
+    if (!typeName)
+      continue;
+    if (!first)
+      stream << ",";
+    first = false;
+    stream << "{\"opcode\":" << i << ",\"name\":\"" << typeName << "\""
+           << ",\"messagesIn\":" << messageTypeMetrics._messagesIn.get()
+           << ",\"messagesOut\":" << messageTypeMetrics._messagesOut.get()
+           << ",\"bytesIn\":" << messageTypeMetrics._bytesIn.get()
+           << ",\"bytesOut\":" << messageTypeMetrics._bytesOut.get() << "}";
+  }
+  stream << "]";
+
+  stream << ",\"connects\":[";
+  {
+    ScopeLock scopeLock(_mutex);
+    for (std::list<ConnectMetrics*>::const_iterator i = _connectMetricsList.begin();
+         i != _connectMetricsList.end(); ++i) {
+      if (i != _connectMetricsList.begin())
+        stream << ",";
+      (*i)->write(stream);
+    }
+  }
+  stream << "]";
+
+  stream << ",\"decodeTimeNSec\":";
+  _decodeTime.write(stream);
+  stream << ",\"encodeTimeNSec\":";
+  _encodeTime.write(stream);
+  stream << ",\"queueDepth\":";
+  _queueDepth.write(stream);
+  stream << ",\"fanOut\":";
+  _fanOut.write(stream);
+  stream << ",\"commitLowerBoundTimeStamps\":" << _commitLowerBoundTimeStamps.get();
+  stream << ",\"timeManagementMessages\":" << _timeManagementMessages.get();
+  stream << ",\"deferredCommitLowerBoundTimeStamps\":" << _deferredCommitLowerBoundTimeStamps.get();
+  stream << ",\"retractedMessages\":" << _retractedMessages.get();
+  stream << ",\"droppedBestEffortMessages\":" << _droppedBestEffortMessages.get();
+  stream << "}";
+}
+
+std::string
+Metrics::str() const
+{
+  std::stringstream stream;
+  write(stream);
+  return stream.str();
+}
+
+Metrics::Metrics()
+{
+}
+
+Metrics::~Metrics()
+{
+}
+
+void
+Metrics::insert(ConnectMetrics& connectMetrics)
+{
+  ScopeLock scopeLock(_mutex);
+  _connectMetricsList.push_back(&connectMetrics);
+}
+
+void
+Metrics::erase(ConnectMetrics& connectMetrics)
+{
+  ScopeLock scopeLock(_mutex);
+  _connectMetricsList.remove(&connectMetrics);
+}
+
+} // namespace OpenRTI
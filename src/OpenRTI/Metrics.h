@@ -0,0 +1,271 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_Metrics_h
+#define OpenRTI_Metrics_h
+
+#include <iosfwd>
+#include <list>
+#include <string>
+#include "OpenRTIConfig.h"
+#include "Clock.h"
+#include "Export.h"
+#include "Mutex.h"
+#include "Referenced.h"
+#include "Types.h"
+
+#if defined(OpenRTI_ATOMIC_USE_STD_ATOMIC)
+# include <atomic>
+#endif
+
+namespace OpenRTI {
+
+/// A monotonic 64 bit counter.
+/// Updates are relaxed atomic increments, so it is fine to leave them
+/// enabled in production code. Without std::atomic the counter is only
+/// exact if updated from a single thread, which is what the server node does.
+class OPENRTI_API MetricsCounter {
+public:
+  MetricsCounter() : _value(0)
+  { }
+
+  void add(uint64_t value)
+  {
+#if defined(OpenRTI_ATOMIC_USE_STD_ATOMIC)
+    _value.fetch_add(value, std::memory_order_relaxed);
+#else
+    _value += value;
+#endif
+  }
+  void inc()
+  { add(1); }
+
+  uint64_t get() const
+  {
+#if defined(OpenRTI_ATOMIC_USE_STD_ATOMIC)
+    return _value.load(std::memory_order_relaxed);
+#else
+    return _value;
+#endif
+  }
+
+private:
+  MetricsCounter(const MetricsCounter&);
+  MetricsCounter& operator=(const MetricsCounter&);
+
+#if defined(OpenRTI_ATOMIC_USE_STD_ATOMIC)
+  std::atomic<uint64_t> _value;
+#else
+  uint64_t _value;
+#endif
+};
+
+/// A histogram with power of two buckets.
+/// Bucket i counts the values in [2^(i-1), 2^i), bucket 0 counts zeros.
+class OPENRTI_API MetricsHistogram {
+public:
+  enum { NumBuckets = 65 };
+
+  void record(uint64_t value)
+  {
+    _count.inc();
+    _sum.add(value);
+    _buckets[getBucketIndex(value)].inc();
+  }
+
+  uint64_t getCount() const
+  { return _count.get(); }
+  uint64_t getSum() const
+  { return _sum.get(); }
+  uint64_t getBucket(unsigned index) const
+  { return _buckets[index].get(); }
+
+  static unsigned getBucketIndex(uint64_t value)
+  {
+    unsigned index = 0;
+    while (value) {
+      value >>= 1;
+      ++index;
+    }
+    return index;
+  }
+
+  void write(std::ostream& stream) const;
+
+private:
+  MetricsCounter _count;
+  MetricsCounter _sum;
+  MetricsCounter _buckets[NumBuckets];
+};
+
+/// Records the time spent in a scope into a histogram if enabled.
+class OPENRTI_API MetricsScopeTimer {
+public:
+  MetricsScopeTimer(MetricsHistogram& histogram, bool enabled) :
+    _histogram(enabled ? &histogram : 0)
+  {
+    if (_histogram)
+      _start = Clock::now();
+  }
+  ~MetricsScopeTimer()
+  {
+    if (_histogram)
+      _histogram->record((Clock::now() - _start).getNSec());
+  }
+
+private:
+  MetricsScopeTimer(const MetricsScopeTimer&);
+  MetricsScopeTimer& operator=(const MetricsScopeTimer&);
+
+  MetricsHistogram* _histogram;
+  Clock _start;
+};
+
+/// Traffic counters of a single connect into a server node.
+/// The connect metrics register themselves with the Metrics registry
+/// for their lifetime.
+class OPENRTI_API ConnectMetrics : public Referenced {
+public:
+  ConnectMetrics(const std::string& name);
+  ~ConnectMetrics();
+
+  const std::string& getName() const
+  { return _name; }
+
+  /// Messages flowing into the server node
+  MetricsCounter& getMessagesIn()
+  { return _messagesIn; }
+  /// Messages the server node sends out through this connect
+  MetricsCounter& getMessagesOut()
+  { return _messagesOut; }
+  /// Bytes received from the wire, zero for in process connects
+  MetricsCounter& getBytesIn()
+  { return _bytesIn; }
+  /// Bytes written to the wire, zero for in process connects
+  MetricsCounter& getBytesOut()
+  { return _bytesOut; }
+
+  void write(std::ostream& stream) const;
+
+private:
+  ConnectMetrics(const ConnectMetrics&);
+  ConnectMetrics& operator=(const ConnectMetrics&);
+
+  std::string _name;
+
+  MetricsCounter _messagesIn;
+  MetricsCounter _messagesOut;
+  MetricsCounter _bytesIn;
+  MetricsCounter _bytesOut;
+};
+
+/// Process wide registry of the metrics the server nodes and encodings collect.
+/// Per message type counters are indexed by the wire opcode of the message.
+class OPENRTI_API Metrics {
+public:
+  enum { MaxOpcode = 128 };
+
+  static Metrics& instance();
+
+  /// Called from the message encodings for each message
+  void readMessage(unsigned opcode, const char* typeName, uint64_t bytes);
+  void writeMessage(unsigned opcode, const char* typeName, uint64_t bytes);
+
+  /// Sampled time the message encodings spend in decoding and encoding
+  MetricsHistogram& getDecodeTime()
+  { return _decodeTime; }
+  MetricsHistogram& getEncodeTime()
+  { return _encodeTime; }
+
+  /// Number of messages the server loop picks up at once
+  MetricsHistogram& getQueueDepth()
+  { return _queueDepth; }
+  /// Number of connects an update or interaction is sent to
+  MetricsHistogram& getFanOut()
+  { return _fanOut; }
+  /// Number of lower bound time stamp commits seen by federation servers
+  MetricsCounter& getCommitLowerBoundTimeStamps()
+  { return _commitLowerBoundTimeStamps; }
+  /// Number of commits, commit responses and locked by next message requests ambassadors sent
+  MetricsCounter& getTimeManagementMessages()
+  { return _timeManagementMessages; }
+  /// Number of lower bound time stamp commits ambassadors deferred since they could not raise any GALT
+  MetricsCounter& getDeferredCommitLowerBoundTimeStamps()
+  { return _deferredCommitLowerBoundTimeStamps; }
+  /// Number of retracted messages removed from send or receive queues before delivery
+  MetricsCounter& getRetractedMessages()
+  { return _retractedMessages; }
+  /// Number of best effort messages dropped from full network send queues
+  MetricsCounter& getDroppedBestEffortMessages()
+  { return _droppedBestEffortMessages; }
+
+  /// Write a json object with the current values.
+  /// Rates are derived from the time stamp and counters of two dumps.
+  void write(std::ostream& stream) const;
+  std::string str() const;
+
+private:
+  Metrics();
+  ~Metrics();
+  Metrics(const Metrics&);
+  Metrics& operator=(const Metrics&);
+
+  friend class ConnectMetrics;
+  void insert(ConnectMetrics& connectMetrics);
+  void erase(ConnectMetrics& connectMetrics);
+
+  struct MessageTypeMetrics {
+    MessageTypeMetrics() : _typeName(0) { }
+#if defined(OpenRTI_ATOMIC_USE_STD_ATOMIC)
+    void setTypeName(const char* typeName)
+    { _typeName.store(typeName, std::memory_order_relaxed); }
+    const char* getTypeName() const
+    { return _typeName.load(std::memory_order_relaxed); }
+    std::atomic<const char*> _typeName;
+#else
+    void setTypeName(const char* typeName)
+    { _typeName = typeName; }
+    const char* getTypeName() const
+    { return _typeName; }
+    const char* _typeName;
+#endif
+    MetricsCounter _messagesIn;
+    MetricsCounter _messagesOut;
+    MetricsCounter _bytesIn;
+    MetricsCounter _bytesOut;
+  };
+  MessageTypeMetrics _messageTypeMetrics[MaxOpcode];
+
+  MetricsHistogram _decodeTime;
+  MetricsHistogram _encodeTime;
+  MetricsHistogram _queueDepth;
+  MetricsHistogram _fanOut;
+  MetricsCounter _commitLowerBoundTimeStamps;
+  MetricsCounter _timeManagementMessages;
+  MetricsCounter _deferredCommitLowerBoundTimeStamps;
+  MetricsCounter _retractedMessages;
+  MetricsCounter _droppedBestEffortMessages;
+
+  mutable Mutex _mutex;
+  std::list<ConnectMetrics*> _connectMetricsList;
+};
+
+} // namespace OpenRTI
+
+#endif
@@ -27,7 +27,9 @@
 #include "Exception.h"
 #include "ExpatXMLReader.h"
 #include "InitialClientStreamProtocol.h"
+#include "LogStream.h"
 #include "MessageEncodingRegistry.h"
+#include "Metrics.h"
 #include "ScopeLock.h"
 #include "ScopeUnlock.h"
 #include "ServerNode.h"
@@ -47,19 +49,50 @@
 
 namespace OpenRTI {
 
+// Calls the server nodes timeout from within the socket event loop
+class OPENRTI_LOCAL NetworkServer::_TimeoutEvent : public AbstractSocketEvent {
+public:
+  _TimeoutEvent(NetworkServer& networkServer) :
+    _networkServer(networkServer)
+  { }
+  virtual ~_TimeoutEvent()
+  { }
+
+  virtual bool getEnableRead() const
+  { return false; }
+  virtual bool getEnableWrite() const
+  { return false; }
+  virtual Socket* getSocket() const
+  { return 0; }
+
+  virtual void timeout(SocketEventDispatcher& dispatcher)
+  {
+    _networkServer._sendTimeout(Clock::now());
+    setTimeout(_networkServer._getTimeout());
+  }
+
+private:
+  NetworkServer& _networkServer;
+};
+
 NetworkServer::NetworkServer() :
-  AbstractServer(new ServerNode)
+  AbstractServer(new ServerNode),
+  _timeoutEvent(new _TimeoutEvent(*this))
 {
+  _dispatcher.insert(_timeoutEvent);
 }
 
 NetworkServer::NetworkServer(const SharedPtr<AbstractServerNode>& serverNode) :
-  AbstractServer(serverNode)
+  AbstractServer(serverNode),
+  _timeoutEvent(new _TimeoutEvent(*this))
 {
+  _dispatcher.insert(_timeoutEvent);
 }
 
 NetworkServer::~NetworkServer()
 {
   _queue.send(*this);
+  _closeServerLoop();
 }
 
 void
@@ -109,6 +142,8 @@ NetworkServer::setUpFromConfig(std::istream& stream)
 
   getServerNode().getServerOptions()._preferCompression = contentHandler->getEnableZLibCompression();
   getServerNode().getServerOptions()._permitTimeRegulation = contentHandler->getPermitTimeRegulation();
+  getServerNode().getServerOptions()._timeAdvanceBarrier = contentHandler->getTimeAdvanceBarrier();
+  getServerNode().getServerOptions()._saveDirectory = contentHandler->getSaveDirectory();
 
   if (!contentHandler->getParentServerUrl().empty()) {
     URL url = URL::fromUrl(contentHandler->getParentServerUrl());
@@ -257,6 +292,7 @@ NetworkServer::connectParentStreamServer(const SharedPtr<SocketStream>& socketSt
   if (compress) {
     connectOptions["compression"].push_back("zlib");
     connectOptions["compression"].push_back("lzma");
+    connectOptions["deltaCompression"].push_back("yes");
   } else {
     connectOptions["compression"].push_back("no");
   }
@@ -281,21 +317,33 @@ NetworkServer::connectParentStreamServer(const SharedPtr<SocketStream>& socketSt
   }
 }
 
+void
+NetworkServer::setMetricsFile(const std::string& metricsFile, const Clock& interval)
+{
+  _metricsFile = metricsFile;
+  _metricsInterval = interval;
+}
+
 int
 NetworkServer::exec()
 {
+  Clock metricsTime = Clock::max();
+  if (!_metricsFile.empty())
+    metricsTime = Clock::now() + _metricsInterval;
+
   ScopeLock scopeLock(_mutex);
   while (!getDone()) {
     if (_queue.empty()) {
       ScopeUnlock scopeUnlock(_mutex);
 
-      _dispatcher.exec();
+      _dispatcher.exec(metricsTime);
 
     } else {
 
       // Get pending messages.
       _Queue queue;
       _queue.swap(queue);
+      Metrics::instance().getQueueDepth().record(queue.size());
 
       {
         // Unlock the ingoing message queue as long
@@ -309,11 +357,32 @@ NetworkServer::exec()
       // For recycling the queue entries, we need the lock again
       queue.recycle(_pool);
     }
+
+    if (metricsTime <= Clock::now()) {
+      ScopeUnlock scopeUnlock(_mutex);
+      _writeMetricsFile();
+      metricsTime = Clock::now() + _metricsInterval;
+    }
   }
 
+  if (!_metricsFile.empty())
+    _writeMetricsFile();
+
   return EXIT_SUCCESS;
 }
 
+void
+NetworkServer::_writeMetricsFile()
+{
+  std::ofstream stream(utf8ToLocale(_metricsFile).c_str(), std::ios::out | std::ios::trunc);
+  if (!stream.is_open()) {
+    Log(Network, Warning) << "Could not open metrics file \"" << _metricsFile << "\"!" << std::endl;
+    return;
+  }
+  Metrics::instance().write(stream);
+  stream << std::endl;
+}
+
 void
 NetworkServer::_sendDone(bool done)
 {
@@ -321,6 +390,13 @@ NetworkServer::_sendDone(bool done)
   _dispatcher.setDone(done);
 }
 
+void
+NetworkServer::_setTimeout(const Clock& timeout)
+{
+  AbstractServer::_setTimeout(timeout);
+  _timeoutEvent->setTimeout(_getTimeout());
+}
+
 void
 NetworkServer::_postMessage(const _MessageConnectHandlePair& messageConnectHandlePair)
 {
@@ -51,10 +51,14 @@ public:
   void connectParentPipeServer(const std::string& name, const Clock& abstime);
   void connectParentStreamServer(const SharedPtr<SocketStream>& socketStream, const Clock& abstime, bool compress);
 
+  /// Periodically write the process wide metrics as json into the given file
+  void setMetricsFile(const std::string& metricsFile, const Clock& interval);
+
   virtual int exec();
 
 protected:
   virtual void _sendDone(bool done);
+  virtual void _setTimeout(const Clock& timeout);
 
   virtual void _postMessage(const _MessageConnectHandlePair& messageConnectHandlePair);
   virtual void _postOperation(const SharedPtr<_Operation>& operation);
@@ -63,7 +67,15 @@ private:
   NetworkServer(const NetworkServer&);
   NetworkServer& operator=(const NetworkServer&);
 
+  void _writeMetricsFile();
+
+  class _TimeoutEvent;
+
   SocketEventDispatcher _dispatcher;
+  SharedPtr<_TimeoutEvent> _timeoutEvent;
+
+  std::string _metricsFile;
+  Clock _metricsInterval;
 
   Mutex _mutex;
   _Queue _queue;
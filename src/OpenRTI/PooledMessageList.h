@@ -20,23 +20,64 @@
 #ifndef OpenRTI_PooledMessageList_h
 #define OpenRTI_PooledMessageList_h
 
-#include <list>
+#include <vector>
 #include "AbstractMessage.h"
+#include "IntrusiveList.h"
+#include "IntrusiveUnorderedMap.h"
 
 namespace OpenRTI {
 
+/// List of messages with pooled list entries.
+/// Time stamp order messages are additionally indexed by their retraction handle,
+/// so that retracted messages can be removed from the list in constant time.
+/// On request, messages are also indexed by the object instance they target.
 class OPENRTI_API PooledMessageList {
 public:
+  PooledMessageList(bool objectInstanceIndex = false) :
+    _objectInstanceIndex(objectInstanceIndex),
+    _messageRetractionHandleEntryMap(64),
+    _objectInstanceHandleEntryMap(64)
+  { }
+  ~PooledMessageList()
+  {
+    _messageRetractionHandleEntryMap.unlink();
+    _objectInstanceHandleEntryMap.unlink();
+    _list.clear();
+    _pool.clear();
+  }
+
   bool empty() const
   { return _list.empty(); }
+  /// The first message, zero if the list is empty
+  const AbstractMessage* front() const
+  {
+    if (_list.empty())
+      return 0;
+    return _list.front()._message.get();
+  }
   void push_back(const SharedPtr<const AbstractMessage>& message)
   {
     // Take the list entry from the pool if possible
+    _Entry* entry;
     if (_pool.empty()) {
-      _list.push_back(message);
+      entry = new _Entry;
     } else {
-      _list.splice(_list.end(), _pool, _pool.begin());
-      _list.back() = message;
+      entry = &_pool.front();
+      _pool.unlink_front();
+    }
+    entry->_message = message;
+    _list.push_back(*entry);
+    MessageRetractionHandle messageRetractionHandle = message->getMessageRetractionHandleForMessage();
+    if (messageRetractionHandle.valid()) {
+      entry->setMessageRetractionHandle(messageRetractionHandle);
+      _messageRetractionHandleEntryMap.insert(*entry);
+    }
+    if (_objectInstanceIndex) {
+      ObjectInstanceHandle objectInstanceHandle = message->getObjectInstanceHandleForMessage();
+      if (objectInstanceHandle.valid()) {
+        entry->setObjectInstanceHandle(objectInstanceHandle);
+        _objectInstanceHandleEntryMap.insert(*entry);
+      }
     }
   }
   SharedPtr<const AbstractMessage> pop_front()
@@ -44,16 +85,96 @@ public:
     if (_list.empty())
       return 0;
     // take away the front message and move the empty list entry to the pool.
+    _Entry& entry = _list.front();
     SharedPtr<const AbstractMessage> message;
-    message.swap(_list.front());
-    _pool.splice(_pool.begin(), _list, _list.begin());
+    message.swap(entry._message);
+    _release(entry);
     return message;
   }
+  /// Take the front message only if it is a control message
+  SharedPtr<const AbstractMessage> pop_front_control()
+  {
+    const AbstractMessage* message = front();
+    if (!message || message->getPriority() != AbstractMessage::ControlPriority)
+      return 0;
+    return pop_front();
+  }
+
+  /// Remove all messages with this retraction handle, returns the number of removed messages
+  unsigned retract(const MessageRetractionHandle& messageRetractionHandle)
+  {
+    unsigned count = 0;
+    _MessageRetractionHandleEntryMap::iterator i = _messageRetractionHandleEntryMap.find(messageRetractionHandle);
+    while (i != _messageRetractionHandleEntryMap.end() && i->getMessageRetractionHandle() == messageRetractionHandle) {
+      _Entry& entry = *i++;
+      entry._message.clear();
+      _release(entry);
+      ++count;
+    }
+    return count;
+  }
+
+  /// True if a message for this object instance is in the list, needs the object instance index
+  bool contains(const ObjectInstanceHandle& objectInstanceHandle) const
+  { return _objectInstanceHandleEntryMap.find(objectInstanceHandle) != _objectInstanceHandleEntryMap.end(); }
+  /// Move all messages for this object instance to the end of list in their order,
+  /// needs the object instance index. Returns the number of moved messages.
+  unsigned splice(const ObjectInstanceHandle& objectInstanceHandle, PooledMessageList& list)
+  {
+    // Entries with the same key are grouped in reverse order of insertion
+    std::vector<_Entry*> entries;
+    _ObjectInstanceHandleEntryMap::iterator i = _objectInstanceHandleEntryMap.find(objectInstanceHandle);
+    while (i != _objectInstanceHandleEntryMap.end() && i->getObjectInstanceHandle() == objectInstanceHandle)
+      entries.push_back(&*i++);
+    for (std::vector<_Entry*>::reverse_iterator j = entries.rbegin(); j != entries.rend(); ++j) {
+      SharedPtr<const AbstractMessage> message;
+      message.swap((*j)->_message);
+      _release(**j);
+      list.push_back(message);
+    }
+    return unsigned(entries.size());
+  }
 
 private:
-  typedef std::list<SharedPtr<const AbstractMessage> > List;
-  List _list;
-  List _pool;
+  PooledMessageList(const PooledMessageList&);
+  PooledMessageList& operator=(const PooledMessageList&);
+
+  struct OPENRTI_LOCAL _Entry :
+         public IntrusiveList<_Entry>::Hook,
+         public IntrusiveUnorderedMap<MessageRetractionHandle, _Entry>::Hook,
+         public IntrusiveUnorderedMap<ObjectInstanceHandle, _Entry>::Hook {
+    void unlink()
+    {
+      IntrusiveList<_Entry>::unlink(*this);
+      IntrusiveUnorderedMap<MessageRetractionHandle, _Entry>::unlink(*this);
+      IntrusiveUnorderedMap<MessageRetractionHandle, _Entry>::Hook::setKey(MessageRetractionHandle());
+      IntrusiveUnorderedMap<ObjectInstanceHandle, _Entry>::unlink(*this);
+      IntrusiveUnorderedMap<ObjectInstanceHandle, _Entry>::Hook::setKey(ObjectInstanceHandle());
+    }
+    const MessageRetractionHandle& getMessageRetractionHandle() const
+    { return IntrusiveUnorderedMap<MessageRetractionHandle, _Entry>::Hook::getKey(); }
+    void setMessageRetractionHandle(const MessageRetractionHandle& messageRetractionHandle)
+    { IntrusiveUnorderedMap<MessageRetractionHandle, _Entry>::Hook::setKey(messageRetractionHandle); }
+    const ObjectInstanceHandle& getObjectInstanceHandle() const
+    { return IntrusiveUnorderedMap<ObjectInstanceHandle, _Entry>::Hook::getKey(); }
+    void setObjectInstanceHandle(const ObjectInstanceHandle& objectInstanceHandle)
+    { IntrusiveUnorderedMap<ObjectInstanceHandle, _Entry>::Hook::setKey(objectInstanceHandle); }
+    SharedPtr<const AbstractMessage> _message;
+  };
+  typedef IntrusiveUnorderedMap<MessageRetractionHandle, _Entry> _MessageRetractionHandleEntryMap;
+  typedef IntrusiveUnorderedMap<ObjectInstanceHandle, _Entry> _ObjectInstanceHandleEntryMap;
+
+  void _release(_Entry& entry)
+  {
+    entry.unlink();
+    _pool.push_front(entry);
+  }
+
+  IntrusiveList<_Entry> _list;
+  IntrusiveList<_Entry> _pool;
+  bool _objectInstanceIndex;
+  _MessageRetractionHandleEntryMap _messageRetractionHandleEntryMap;
+  _ObjectInstanceHandleEntryMap _objectInstanceHandleEntryMap;
 };
 
 } // namespace OpenRTI
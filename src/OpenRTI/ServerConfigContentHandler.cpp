@@ -47,7 +47,8 @@ static bool enableFlagToBool(const char* enableValue)
 
 ServerConfigContentHandler::ServerConfigContentHandler() :
   _permitTimeRegulation(true),
-  _enableZLibCompression(true)
+  _enableZLibCompression(true),
+  _timeAdvanceBarrier(false)
 {
 }
 
@@ -103,6 +104,21 @@ ServerConfigContentHandler::startElement(const char* uri, const char* name,
     bool enable = enableFlagToBool(atts->getValue("enable"));
     _enableZLibCompression = enable;
 
+  } else if (strcmp(name, "timeAdvanceBarrier") == 0) {
+    if (getCurrentMode() != OpenRTIServerConfigMode)
+      throw RTIinternalError("timeAdvanceBarrier tag not inside of OpenRTIServerConfig tag!");
+    _modeStack.push_back(TimeAdvanceBarrierMode);
+
+    bool enable = enableFlagToBool(atts->getValue("enable"));
+    _timeAdvanceBarrier = enable;
+
+  } else if (strcmp(name, "saveDirectory") == 0) {
+    if (getCurrentMode() != OpenRTIServerConfigMode)
+      throw RTIinternalError("saveDirectory tag not inside of OpenRTIServerConfig tag!");
+    _modeStack.push_back(SaveDirectoryMode);
+
+    _saveDirectory = trim(atts->getValue("path"));
+
   } else if (strcmp(name, "listen") == 0) {
     if (getCurrentMode() != OpenRTIServerConfigMode)
       throw RTIinternalError("listen tag not inside of OpenRTIServerConfig!");
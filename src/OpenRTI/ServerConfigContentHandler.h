@@ -52,6 +52,14 @@ public:
   bool getEnableZLibCompression() const
   { return _enableZLibCompression; }
 
+  /// Collect the time advance commits of lockstep federations at the root server
+  bool getTimeAdvanceBarrier() const
+  { return _timeAdvanceBarrier; }
+
+  /// The directory federation saves are written to
+  const std::string& getSaveDirectory() const
+  { return _saveDirectory; }
+
   /// Each listen tag in the config file is represented with such a struct
   struct ListenConfig {
     const std::string& getUrl() const
@@ -82,6 +90,8 @@ private:
     ParentServerMode,
     PermitTimeRegulationMode,
     EnableZLibCompressionMode,
+    TimeAdvanceBarrierMode,
+    SaveDirectoryMode,
     ListenMode
   };
 
@@ -101,6 +111,10 @@ private:
   /// Server defaults for time regulation and protocol compression
   bool _permitTimeRegulation;
   bool _enableZLibCompression;
+  bool _timeAdvanceBarrier;
+
+  /// The directory federation saves are written to
+  std::string _saveDirectory;
 
   /// The config file configured listens
   std::vector<ListenConfig> _listenConfig;
@@ -44,7 +44,8 @@ Region::setRegionHandle(const LocalRegionHandle& regionHandle)
 
 InstanceAttribute::InstanceAttribute(ObjectInstance& objectInstance, ClassAttribute& classAttribute) :
   _objectInstance(objectInstance),
-  _classAttribute(classAttribute)
+  _classAttribute(classAttribute),
+  _transportationType(classAttribute.getAttributeDefinition().getTransportationType())
 {
   setAttributeHandle(_classAttribute.getAttributeHandle());
   /// FIXME
@@ -61,6 +62,12 @@ InstanceAttribute::setAttributeHandle(const AttributeHandle& attributeHandle)
   HandleEntity<InstanceAttribute, AttributeHandle>::_setHandle(attributeHandle);
 }
 
+void
+InstanceAttribute::setTransportationType(TransportationType transportationType)
+{
+  _transportationType = transportationType;
+}
+
 ////////////////////////////////////////////////////////////
 
 ObjectInstanceConnect::ObjectInstanceConnect(ObjectInstance& objectInstance, FederationConnect& federationConnect) :
@@ -162,6 +169,56 @@ ObjectInstance::removeConnect(const ConnectHandle& connectHandle)
        i != _attributeHandleInstanceAttributeMap.end(); ++i) {
     i->removeConnect(connectHandle);
   }
+  _connectHandleUpdateRateReductionMap.erase(connectHandle);
+}
+
+bool
+ObjectInstance::reduceUpdateRate(const ConnectHandle& connectHandle, double updateRate, const Clock& now,
+                                 const AbstractMessage& message, AttributeValueVector& attributeValues, Clock& dueTime)
+{
+  ConnectHandleUpdateRateReductionMap::iterator i = _connectHandleUpdateRateReductionMap.find(connectHandle);
+  if (updateRate <= 0 && i == _connectHandleUpdateRateReductionMap.end())
+    return true;
+  if (i == _connectHandleUpdateRateReductionMap.end())
+    i = _connectHandleUpdateRateReductionMap.insert(std::make_pair(connectHandle, UpdateRateReduction())).first;
+
+  AttributeValueVector& heldAttributeValues = i->second._attributeValues;
+  if (0 < updateRate && now < i->second._nextUpdateTime) {
+    // Too early, just remember the latest values
+    for (AttributeValueVector::iterator j = attributeValues.begin(); j != attributeValues.end(); ++j) {
+      AttributeValueVector::iterator k = heldAttributeValues.begin();
+      for (; k != heldAttributeValues.end(); ++k) {
+        if (k->getAttributeHandle() == j->getAttributeHandle())
+          break;
+      }
+      if (k == heldAttributeValues.end())
+        heldAttributeValues.push_back(*j);
+      else
+        k->getValue().swap(j->getValue());
+    }
+    i->second._message = &message;
+    dueTime = i->second._nextUpdateTime;
+    return false;
+  }
+
+  // Send now, including the held back values that are not superseded by this update
+  for (AttributeValueVector::iterator j = heldAttributeValues.begin(); j != heldAttributeValues.end(); ++j) {
+    AttributeValueVector::const_iterator k = attributeValues.begin();
+    for (; k != attributeValues.end(); ++k) {
+      if (k->getAttributeHandle() == j->getAttributeHandle())
+        break;
+    }
+    if (k == attributeValues.end())
+      attributeValues.push_back(*j);
+  }
+  if (updateRate <= 0) {
+    _connectHandleUpdateRateReductionMap.erase(i);
+  } else {
+    heldAttributeValues.clear();
+    i->second._message.clear();
+    i->second._nextUpdateTime = now + Clock::fromSeconds(1/updateRate);
+  }
+  return true;
 }
 
 void
@@ -178,7 +235,31 @@ ObjectInstance::setObjectClass(ObjectClass* objectClass)
        i != attributeHandleClassAttributeMap.end(); ++i) {
     ServerModel::InstanceAttribute* instanceAttribute = new ServerModel::InstanceAttribute(*this, *i);
     insert(*instanceAttribute);
+    std::map<AttributeHandle, TransportationType>::iterator j = _attributeHandleTransportationTypeMap.find(i->getAttributeHandle());
+    if (j != _attributeHandleTransportationTypeMap.end())
+      instanceAttribute->setTransportationType(j->second);
   }
+  _attributeHandleTransportationTypeMap.clear();
+}
+
+TransportationType
+ObjectInstance::getTransportationType(const AttributeHandle& attributeHandle)
+{
+  if (InstanceAttribute* instanceAttribute = getInstanceAttribute(attributeHandle))
+    return instanceAttribute->getTransportationType();
+  std::map<AttributeHandle, TransportationType>::const_iterator i = _attributeHandleTransportationTypeMap.find(attributeHandle);
+  if (i != _attributeHandleTransportationTypeMap.end())
+    return i->second;
+  return RELIABLE;
+}
+
+void
+ObjectInstance::setTransportationType(const AttributeHandle& attributeHandle, TransportationType transportationType)
+{
+  if (InstanceAttribute* instanceAttribute = getInstanceAttribute(attributeHandle))
+    instanceAttribute->setTransportationType(transportationType);
+  else if (!_objectClass)
+    _attributeHandleTransportationTypeMap[attributeHandle] = transportationType;
 }
 
 ////////////////////////////////////////////////////////////
@@ -357,6 +438,22 @@ Federate::setCommitId(Unsigned commitId)
   _commitId = commitId;
 }
 
+TransportationType
+Federate::getTransportationType(const InteractionClass& interactionClass) const
+{
+  InteractionClassHandleTransportationTypeMap::const_iterator i;
+  i = _interactionClassHandleTransportationTypeMap.find(interactionClass.getInteractionClassHandle());
+  if (i == _interactionClassHandleTransportationTypeMap.end())
+    return interactionClass.getTransportationType();
+  return i->second;
+}
+
+void
+Federate::setTransportationType(const InteractionClassHandle& interactionClassHandle, TransportationType transportationType)
+{
+  _interactionClassHandleTransportationTypeMap[interactionClassHandle] = transportationType;
+}
+
 ConnectHandle
 Federate::getConnectHandle() const
 {
@@ -540,7 +637,8 @@ InteractionClass::InteractionClass(Federation& federation, InteractionClass* par
   _federation(federation),
   _parentInteractionClass(parentInteractionClass),
   _orderType(),
-  _transportationType()
+  _transportationType(),
+  _interactionRouteVectorValid(false)
 {
   if (_parentInteractionClass) {
     _parentInteractionClass->_childInteractionClassList.push_back(*this);
@@ -673,6 +771,8 @@ InteractionClass::insertClassParameterFor(ParameterDefinition& parameterDefiniti
   classParameter->setParameterHandle(parameterDefinition.getParameterHandle());
   _parameterHandleClassParameterMap.insert(*classParameter);
   parameterDefinition.insert(*classParameter);
+  // The parameter masks of the routing table are no longer complete
+  _interactionRouteVectorValid = false;
 
   for (ChildList::iterator i = _childInteractionClassList.begin(); i != _childInteractionClassList.end(); ++i)
     i->insertClassParameterFor(parameterDefinition);
@@ -687,6 +787,56 @@ InteractionClass::getClassParameter(const ParameterHandle& parameterHandle)
   return i.get();
 }
 
+const InteractionClass::InteractionRouteVector&
+InteractionClass::getInteractionRouteVector()
+{
+  if (_interactionRouteVectorValid)
+    return _interactionRouteVector;
+
+  _interactionRouteVector.clear();
+  for (ConnectHandleSet::const_iterator i = _cumulativeSubscribedConnectHandleSet.begin();
+       i != _cumulativeSubscribedConnectHandleSet.end(); ++i) {
+    // Find the most derived class this connect is subscribed at
+    InteractionClass* interactionClass = this;
+    while (interactionClass && interactionClass->getSubscriptionType(*i) == Unsubscribed)
+      interactionClass = interactionClass->getParentInteractionClass();
+    if (!interactionClass)
+      continue;
+
+    // Typically very few different classes, so just search linearly
+    InteractionRouteVector::iterator j = _interactionRouteVector.begin();
+    for (; j != _interactionRouteVector.end(); ++j) {
+      if (j->_interactionClass == interactionClass)
+        break;
+    }
+    if (j == _interactionRouteVector.end()) {
+      j = _interactionRouteVector.insert(j, InteractionRoute());
+      j->_interactionClass = interactionClass;
+      for (ClassParameter::HandleMap::iterator k = _parameterHandleClassParameterMap.begin();
+           k != _parameterHandleClassParameterMap.end(); ++k) {
+        if (!interactionClass->getClassParameter(k->getParameterHandle()))
+          continue;
+        std::size_t index = k->getParameterHandle().getHandle();
+        if (j->_parameterMask.size() <= index)
+          j->_parameterMask.resize(index + 1, false);
+        j->_parameterMask[index] = true;
+      }
+    }
+    j->_connectHandleVector.push_back(*i);
+  }
+  _interactionRouteVectorValid = true;
+
+  return _interactionRouteVector;
+}
+
+void
+InteractionClass::invalidateInteractionRouteVector()
+{
+  _interactionRouteVectorValid = false;
+  for (ChildList::iterator i = _childInteractionClassList.begin(); i != _childInteractionClassList.end(); ++i)
+    i->invalidateInteractionRouteVector();
+}
+
 ////////////////////////////////////////////////////////////
 
 ObjectClassModule::ObjectClassModule(ObjectClass& objectClass, Module& module) :
@@ -937,6 +1087,41 @@ ObjectClass::removeConnect(const ConnectHandle& connectHandle)
   for (ClassAttribute::HandleMap::iterator i = _attributeHandleClassAttributeMap.begin();
        i != _attributeHandleClassAttributeMap.end(); ++i)
     i->removeConnect(connectHandle);
+  eraseUpdateRate(connectHandle);
+}
+
+void
+ObjectClass::setUpdateRate(const ConnectHandle& connectHandle, double updateRate)
+{
+  double& currentUpdateRate = _connectHandleUpdateRateMap[connectHandle];
+  if (0 < currentUpdateRate)
+    _federation.unreferenceUpdateRateReduction();
+  currentUpdateRate = updateRate;
+  if (0 < currentUpdateRate)
+    _federation.referenceUpdateRateReduction();
+}
+
+void
+ObjectClass::eraseUpdateRate(const ConnectHandle& connectHandle)
+{
+  ConnectHandleUpdateRateMap::iterator i = _connectHandleUpdateRateMap.find(connectHandle);
+  if (i == _connectHandleUpdateRateMap.end())
+    return;
+  if (0 < i->second)
+    _federation.unreferenceUpdateRateReduction();
+  _connectHandleUpdateRateMap.erase(i);
+}
+
+double
+ObjectClass::getEffectiveUpdateRate(const ConnectHandle& connectHandle)
+{
+  // The subscription at the most derived class wins
+  for (ObjectClass* objectClass = this; objectClass; objectClass = objectClass->_parentObjectClass) {
+    ConnectHandleUpdateRateMap::const_iterator i = objectClass->_connectHandleUpdateRateMap.find(connectHandle);
+    if (i != objectClass->_connectHandleUpdateRateMap.end())
+      return i->second;
+  }
+  return 0;
 }
 
 ////////////////////////////////////////////////////////////
@@ -1237,11 +1422,20 @@ FederationConnect::send(const SharedPtr<const AbstractMessage>& message)
   _nodeConnect.send(message);
 }
 
+unsigned
+FederationConnect::retract(const MessageRetractionHandle& messageRetractionHandle)
+{
+  if (!_active)
+    return 0;
+  return _nodeConnect.retract(messageRetractionHandle);
+}
+
 ////////////////////////////////////////////////////////////
 
 Federation::Federation(Node& serverNode) :
   _serverNode(serverNode),
-  _objectInstanceHandleObjectInstanceMap(16384/*hash size*/)
+  _objectInstanceHandleObjectInstanceMap(16384/*hash size*/),
+  _updateRateReductionCount(0)
 {
 }
 
@@ -1859,6 +2053,11 @@ Federation::insert(ModuleHandleVector& moduleHandleVector, const FOMStringModule
     moduleHandleVector.clear();
     throw;
   }
+  // All of them are merged now, including those that did not add anything new
+  for (FOMStringModuleList::const_iterator i = stringModuleList.begin(); i != stringModuleList.end(); ++i) {
+    if (!i->getContentHash().empty())
+      _fomModuleContentHashSet.insert(i->getContentHash());
+  }
 }
 
 void
@@ -2526,6 +2725,14 @@ NodeConnect::send(const SharedPtr<const AbstractMessage>& message)
   _messageSender->send(message);
 }
 
+unsigned
+NodeConnect::retract(const MessageRetractionHandle& messageRetractionHandle)
+{
+  if (!_messageSender.valid())
+    return 0;
+  return _messageSender->retract(messageRetractionHandle);
+}
+
 ////////////////////////////////////////////////////////////
 
 Node::Node() :
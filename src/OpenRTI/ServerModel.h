@@ -21,9 +21,14 @@
 #define OpenRTI_ServerModel_h
 
 #include <list>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "AbstractMessageSender.h"
+#include "AbstractServerNode.h"
+#include "Clock.h"
 #include "Exception.h"
 #include "Handle.h"
 #include "HandleAllocator.h"
@@ -420,6 +425,11 @@ public:
       _ownerConnectHandle = ConnectHandle();
   }
 
+  /// The transportation type the owner sends updates with
+  TransportationType getTransportationType() const
+  { return _transportationType; }
+  void setTransportationType(TransportationType transportationType);
+
   // Because of attribute ownership, it is clear for an object attribute where the update
   // stems from, so just have a set of connect handles that want to receive the updates
   ConnectHandleSet _receivingConnects;
@@ -433,6 +443,8 @@ private:
 
   ObjectInstance& _objectInstance;
   ClassAttribute& _classAttribute;
+
+  TransportationType _transportationType;
 };
 
 ////////////////////////////////////////////////////////////
@@ -519,6 +531,11 @@ public:
   { return _objectClass; }
   void setObjectClass(ObjectClass* objectClass);
 
+  /// The transportation type of an attribute of this instance.
+  /// Changes may arrive before the object class is known here, these are applied once it is set.
+  TransportationType getTransportationType(const AttributeHandle& attributeHandle);
+  void setTransportationType(const AttributeHandle& attributeHandle, TransportationType transportationType);
+
   /// Return the connect that owns this object
   ConnectHandle getOwnerConnectHandle()
   {
@@ -535,6 +552,25 @@ public:
     instanceAttribute->setOwnerConnectHandle(connectHandle);
   }
 
+  /// The state of a rate reduced subscription of a connect to this object instance.
+  struct OPENRTI_LOCAL UpdateRateReduction {
+    /// The earliest time the next update may be sent to the connect
+    Clock _nextUpdateTime;
+    /// The latest values held back since the last update sent to the connect
+    AttributeValueVector _attributeValues;
+    /// The latest update message that values are held back from
+    SharedPtr<const AbstractMessage> _message;
+  };
+  typedef std::map<ConnectHandle, UpdateRateReduction> ConnectHandleUpdateRateReductionMap;
+  ConnectHandleUpdateRateReductionMap& getConnectHandleUpdateRateReductionMap()
+  { return _connectHandleUpdateRateReductionMap; }
+
+  /// Returns true if the attribute values may be sent to the connect at the given time.
+  /// Otherwise the values are kept as the latest values and are merged into the next update that passes,
+  /// or are sent on their own at dueTime if no update passes until then.
+  bool reduceUpdateRate(const ConnectHandle& connectHandle, double updateRate, const Clock& now,
+                        const AbstractMessage& message, AttributeValueVector& attributeValues, Clock& dueTime);
+
 private:
   ObjectInstance(const ObjectInstance&);
   ObjectInstance& operator=(const ObjectInstance&);
@@ -546,9 +582,14 @@ private:
 
   /// All the instance attributes here
   InstanceAttribute::HandleMap _attributeHandleInstanceAttributeMap;
+  /// Transportation types changed before the object class is known
+  std::map<AttributeHandle, TransportationType> _attributeHandleTransportationTypeMap;
 
   // List of object instance handle/name references at this connect.
   ObjectInstanceConnect::HandleMap _connectHandleObjectInstanceConnectMap;
+
+  // The connects that receive this instance with a reduced update rate
+  ConnectHandleUpdateRateReductionMap _connectHandleUpdateRateReductionMap;
 };
 
 ////////////////////////////////////////////////////////////
@@ -640,6 +681,7 @@ private:
 class NodeConnect;
 class Federation;
 class FederationConnect;
+class InteractionClass;
 
 class OPENRTI_LOCAL Federate : public HandleStringEntity<Federate, FederateHandle>, public IntrusiveList<Federate, 0>::Hook, public IntrusiveList<Federate, 1>::Hook {
 public:
@@ -702,6 +744,10 @@ public:
   { return _commitId; }
   void setCommitId(Unsigned commitId);
 
+  /// The transportation type this federate sends interactions of this class with
+  TransportationType getTransportationType(const InteractionClass& interactionClass) const;
+  void setTransportationType(const InteractionClassHandle& interactionClassHandle, TransportationType transportationType);
+
   void setFederationConnect(FederationConnect* federationConnect)
   {
     OpenRTIAssert(federationConnect || !getIsTimeRegulating());
@@ -734,6 +780,10 @@ private:
   VariableLengthData _timeAdvanceTimeStamp;
   VariableLengthData _nextMessageTimeStamp;
   Unsigned _commitId;
+
+  // Only the interaction classes this federate changed from the fom default
+  typedef std::map<InteractionClassHandle, TransportationType> InteractionClassHandleTransportationTypeMap;
+  InteractionClassHandleTransportationTypeMap _interactionClassHandleTransportationTypeMap;
 };
 
 ////////////////////////////////////////////////////////////
@@ -1115,6 +1165,8 @@ public:
       parentSubscribed = true;
 
     _updateCumulativeSubscription(connectHandle, parentSubscribed);
+    // Even if the cumulative set did not change, the class an interaction is delivered as might have changed
+    invalidateInteractionRouteVector();
   }
   void _updateCumulativeSubscription(const ConnectHandle& connectHandle, bool subscribe /*Replace with regionset or something*/)
   {
@@ -1127,6 +1179,34 @@ public:
     }
   }
 
+  void removeConnect(const ConnectHandle& connectHandle)
+  {
+    PublishSubscribe::removeConnect(connectHandle);
+    invalidateInteractionRouteVector();
+  }
+
+  /// The routing table for interactions sent with this class.
+  /// Each entry holds the class the interaction is delivered as, the connects that subscribed at that class
+  /// and a mask, indexed by parameter handle, telling which parameters are visible at the delivered class.
+  struct OPENRTI_LOCAL InteractionRoute {
+    InteractionClass* _interactionClass;
+    std::vector<ConnectHandle> _connectHandleVector;
+    std::vector<bool> _parameterMask;
+
+    bool getParameterVisible(const ParameterHandle& parameterHandle) const
+    {
+      if (_parameterMask.size() <= parameterHandle.getHandle())
+        return false;
+      return _parameterMask[parameterHandle.getHandle()];
+    }
+  };
+  typedef std::vector<InteractionRoute> InteractionRouteVector;
+
+  /// Returns the routing table, rebuilds it if subscriptions changed since the last call
+  const InteractionRouteVector& getInteractionRouteVector();
+  /// Drop the routing table of this class and all derived classes
+  void invalidateInteractionRouteVector();
+
 private:
   InteractionClass(const InteractionClass&);
   InteractionClass& operator=(const InteractionClass&);
@@ -1146,6 +1226,9 @@ private:
   ParameterDefinition::NameMap _parameterNameParameterMap;
 
   ClassParameter::HandleMap _parameterHandleClassParameterMap;
+
+  InteractionRouteVector _interactionRouteVector;
+  bool _interactionRouteVectorValid;
 };
 
 ////////////////////////////////////////////////////////////
@@ -1357,6 +1440,12 @@ public:
 
   void removeConnect(const ConnectHandle& connectHandle);
 
+  /// The update rate in Hz the connect subscribed this class with, zero means unlimited.
+  void setUpdateRate(const ConnectHandle& connectHandle, double updateRate);
+  void eraseUpdateRate(const ConnectHandle& connectHandle);
+  /// Returns the update rate of the most derived class the connect subscribed with.
+  double getEffectiveUpdateRate(const ConnectHandle& connectHandle);
+
   typedef std::list<ObjectInstance*> ObjectInstanceList;
 
   /// since we might end in different depths for different attributes, this is done per attribute
@@ -1448,6 +1537,10 @@ private:
 
   /// All instances of this particular class
   ObjectInstance::FirstList _objectInstanceList;
+
+  /// The update rates of the connects subscribed to this class
+  typedef std::map<ConnectHandle, double> ConnectHandleUpdateRateMap;
+  ConnectHandleUpdateRateMap _connectHandleUpdateRateMap;
 };
 
 ////////////////////////////////////////////////////////////
@@ -1638,6 +1731,8 @@ public:
 
   /// We can actually send something there
   void send(const SharedPtr<const AbstractMessage>& message);
+  /// Remove retracted messages still waiting to be sent there
+  unsigned retract(const MessageRetractionHandle& messageRetractionHandle);
 
 private:
   FederationConnect(const FederationConnect&);
@@ -1740,6 +1835,10 @@ public:
   void insert(const FOMStringModuleList& stringModuleList);
   void insert(ModuleHandleVector& moduleHandleVector, const FOMStringModuleList& stringModuleList);
 
+  /// Returns true if a module with this content hash is already merged into the object model
+  bool getIsFOMModuleContentHashKnown(const std::string& contentHash) const
+  { return _fomModuleContentHashSet.find(contentHash) != _fomModuleContentHashSet.end(); }
+
   /// Either insert a new entity or creates a new one.
   /// Throws a message error if an existing one does not match the provided.
   void insert(Module& module, const FOMDimension& fomDimension);
@@ -1804,6 +1903,14 @@ public:
   /// FIXME
   ObjectInstance* insertObjectInstance(const ObjectInstanceHandle& objectInstanceHandle, const std::string& objectInstanceName);
 
+  /// Returns true if any connect subscribed to any object class with a reduced update rate
+  bool getHasUpdateRateReductions() const
+  { return 0 != _updateRateReductionCount; }
+  void referenceUpdateRateReduction()
+  { ++_updateRateReductionCount; }
+  void unreferenceUpdateRateReduction()
+  { OpenRTIAssert(0 < _updateRateReductionCount); --_updateRateReductionCount; }
+
   /// Syncronization state FIXME
   Synchronization::NameMap _synchronizationNameSynchronizationMap;
 
@@ -1828,6 +1935,8 @@ private:
   // Module/ObjectModel dependent
   Module::HandleMap _moduleHandleModuleMap;
   HandleAllocator<ModuleHandle> _moduleHandleAllocator;
+  // The content hashes of the string modules merged at the root server
+  std::set<std::string> _fomModuleContentHashSet;
 
   /// FIXME, take these to map any name type string combination to one of the two fixed backend types
   // OrderType::NameMap _orderTypeNameOrderTypeMap;
@@ -1867,6 +1976,8 @@ private:
   ObjectInstance::HandleMap _objectInstanceHandleObjectInstanceMap;
   ObjectInstance::NameMap _objectInstanceNameObjectInstanceMap;
   HandleAllocator<ObjectInstanceHandle> _objectInstanceHandleAllocator;
+  // Number of object class subscriptions with a reduced update rate
+  std::size_t _updateRateReductionCount;
 };
 
 ////////////////////////////////////////////////////////////
@@ -1911,6 +2022,8 @@ public:
 
   /// We can actually send messages through a connect
   void send(const SharedPtr<const AbstractMessage>& message);
+  /// Remove retracted messages still waiting to be sent through the connect
+  unsigned retract(const MessageRetractionHandle& messageRetractionHandle);
 
 private:
   NodeConnect(const NodeConnect&);
@@ -1971,6 +2084,15 @@ public:
   const ServerOptions& getServerOptions() const
   { return *_serverOptions; }
 
+  /// The event loop running this node, may be zero
+  const SharedPtr<AbstractServerNode::ServerLoop>& getServerLoop() const
+  { return _serverLoop; }
+  void setServerLoop(const SharedPtr<AbstractServerNode::ServerLoop>& serverLoop)
+  { _serverLoop = serverLoop; }
+  /// Have the event loop call timeout not before the given time
+  void setTimeout(const Clock& timeout)
+  { if (_serverLoop.valid()) _serverLoop->setTimeout(timeout); }
+
   const std::string& getServerName() const
   { return _serverOptions->getServerName(); }
   const std::string& getServerPath() const
@@ -1990,6 +2112,9 @@ protected:
   // The ServerOptions for this server component
   SharedPtr<ServerOptions> _serverOptions;
 
+  // The event loop running this server component
+  SharedPtr<AbstractServerNode::ServerLoop> _serverLoop;
+
 private:
   Node(const Node&);
   Node& operator=(const Node&);
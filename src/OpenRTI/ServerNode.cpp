@@ -20,23 +20,63 @@
 #include "ServerNode.h"
 
 #include <algorithm>
+#include <fstream>
 #include <iterator>
+#include <map>
+#include <set>
 #include "Message.h"
 #include "AbstractMessageSender.h"
+#include "Clock.h"
+#include "FederationSnapshot.h"
 #include "LogStream.h"
+#include "Metrics.h"
 #include "ServerModel.h"
 #include "ServerOptions.h"
 
 namespace OpenRTI {
 
+/// Hands the written snapshot of a federation save back to its federation
+class OPENRTI_LOCAL FederationServerSnapshotWriter : public FederationSnapshotWriter {
+public:
+  FederationServerSnapshotWriter(ServerModel::Node& serverNode, const FederationHandle& federationHandle,
+                                 const SharedPtr<const FederationSnapshot>& federationSnapshot, const std::string& fileName) :
+    FederationSnapshotWriter(federationSnapshot, fileName, serverNode.getServerLoop()),
+    _serverNode(serverNode),
+    _federationHandle(federationHandle)
+  { }
+
+protected:
+  virtual void written();
+
+private:
+  // Only used from within the event loop running the server node
+  ServerModel::Node& _serverNode;
+  FederationHandle _federationHandle;
+};
+
 class OPENRTI_LOCAL FederationServer : public ServerModel::Federation {
 public:
+  /// Object instances per InsertMultipleObjectInstancesMessage, bounds the size of
+  /// the single messages so that other traffic can still interleave with the transfer.
+  enum { InsertMultipleObjectInstancesBlockSize = 1024 };
+
   FederationServer(ServerModel::Node& serverNode) :
     ServerModel::Federation(serverNode),
-    _parentPermitTimeRegulation(true)
+    _parentPermitTimeRegulation(true),
+    _timeAdvanceBarrier(serverNode.getServerOptions().getTimeAdvanceBarrier()),
+    _saveSuccessful(false),
+    _saveFailureReason(RTI_UNABLE_TO_SAVE),
+    _federationSnapshotWritten(false),
+    _federationSnapshotAbandoned(false),
+    _restoreSuccessful(false),
+    _restoreFailureReason(RTI_UNABLE_TO_RESTORE)
   { }
   virtual ~FederationServer()
-  { }
+  {
+    // A still running writer removes its file once it finds the federation gone
+    if (_federationSnapshotWriter.valid() && _federationSnapshotWritten)
+      _federationSnapshotWriter->commit(false);
+  }
 
   void setParentConfigurationParameterMap(const ConfigurationParameterMap& configurationParameterMap)
   {
@@ -48,6 +88,9 @@ public:
     } else {
       _parentPermitTimeRegulation = true;
     }
+    // The root server decides on the time advance barrier for the whole tree
+    i = configurationParameterMap.find("timeAdvanceBarrier");
+    _timeAdvanceBarrier = (i != configurationParameterMap.end() && !i->second.empty() && i->second.front() == "true");
   }
 
   void accept(const ConnectHandle& connectHandle, const InsertModulesMessage* message)
@@ -69,6 +112,31 @@ public:
       return;
     }
 
+    // No joins while the federation is saved or restored
+    if (!_federateHandleSaveStatusMap.empty() || !_federateHandleRestoreStatusMap.empty()) {
+      SharedPtr<JoinFederationExecutionResponseMessage> response;
+      response = new JoinFederationExecutionResponseMessage;
+      if (!_federateHandleSaveStatusMap.empty())
+        response->setJoinFederationExecutionResponseType(JoinFederationExecutionResponseSaveInProgress);
+      else
+        response->setJoinFederationExecutionResponseType(JoinFederationExecutionResponseRestoreInProgress);
+      getServerNode().send(connectHandle, response);
+      return;
+    }
+
+    // Modules offered by their content hash must already be merged
+    for (StringVector::const_iterator i = message->getFOMModuleContentHashVector().begin();
+         i != message->getFOMModuleContentHashVector().end(); ++i) {
+      if (getIsFOMModuleContentHashKnown(*i))
+        continue;
+      SharedPtr<JoinFederationExecutionResponseMessage> response;
+      response = new JoinFederationExecutionResponseMessage;
+      response->setJoinFederationExecutionResponseType(JoinFederationExecutionResponseMissingFOMModules);
+      response->setExceptionString(*i);
+      getServerNode().send(connectHandle, response);
+      return;
+    }
+
     // Try to extend the object model
     if (!message->getFOMStringModuleList().empty()) {
       ModuleHandleVector moduleHandleVector;
@@ -181,6 +249,7 @@ public:
 
     // remove from time management
     if (federate->getIsTimeRegulating()) {
+      releaseTimeAdvanceBarrier();
       eraseTimeRegulating(*federate);
       SharedPtr<DisableTimeRegulationRequestMessage> request = new DisableTimeRegulationRequestMessage;
       request->setFederationHandle(getFederationHandle());
@@ -610,6 +679,640 @@ public:
     ServerModel::Synchronization::NameMap::erase(*i);
   }
 
+  // Federation save and restore.
+  // Both are coordinated by the root server, the other servers just pass the messages.
+  void accept(const ConnectHandle& connectHandle, const RequestFederationSaveMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    // Requests crossing an already running save or restore are dropped
+    if (!_federateHandleSaveStatusMap.empty() || !_federateHandleRestoreStatusMap.empty())
+      return;
+
+    for (ServerModel::Federate::HandleMap::iterator i = getFederateHandleFederateMap().begin();
+         i != getFederateHandleFederateMap().end(); ++i) {
+      if (i->getResignPending())
+        continue;
+      _federateHandleSaveStatusMap[i->getFederateHandle()] = FEDERATE_INSTRUCTED_TO_SAVE;
+    }
+    if (_federateHandleSaveStatusMap.empty())
+      return;
+    _saveLabel = message->getLabel();
+    _saveSuccessful = true;
+    _saveFailureReason = RTI_UNABLE_TO_SAVE;
+
+    SharedPtr<InitiateFederateSaveMessage> initiate = new InitiateFederateSaveMessage;
+    initiate->setFederationHandle(getFederationHandle());
+    initiate->setLabel(message->getLabel());
+    initiate->setTimeStamp(message->getTimeStamp());
+    initiate->setTimeStampValid(message->getTimeStampValid());
+    broadcastToChildren(initiate);
+  }
+  void accept(const ConnectHandle& connectHandle, const InitiateFederateSaveMessage* message)
+  {
+    broadcastToChildren(message);
+  }
+  void accept(const ConnectHandle& connectHandle, const FederateSaveBegunMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    std::map<FederateHandle, SaveStatus>::iterator i = _federateHandleSaveStatusMap.find(message->getFederateHandle());
+    if (i == _federateHandleSaveStatusMap.end())
+      return;
+    i->second = FEDERATE_SAVING;
+    checkFederationSave();
+  }
+  void accept(const ConnectHandle& connectHandle, const FederateSaveCompleteMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    std::map<FederateHandle, SaveStatus>::iterator i = _federateHandleSaveStatusMap.find(message->getFederateHandle());
+    if (i == _federateHandleSaveStatusMap.end())
+      return;
+    i->second = FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE;
+    if (!message->getSuccessful() && _saveSuccessful) {
+      _saveSuccessful = false;
+      _saveFailureReason = message->getSaveFailureReason();
+    }
+    checkFederationSave();
+  }
+  void accept(const ConnectHandle& connectHandle, const FederationSavedMessage* message)
+  {
+    broadcastToChildren(message);
+  }
+  void accept(const ConnectHandle& connectHandle, const AbortFederationSaveMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    if (_federateHandleSaveStatusMap.empty())
+      return;
+    _saveSuccessful = false;
+    _saveFailureReason = SAVE_ABORTED;
+    finishFederationSave();
+  }
+  void accept(const ConnectHandle& connectHandle, const QueryFederationSaveStatusRequestMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    SharedPtr<QueryFederationSaveStatusResponseMessage> response = new QueryFederationSaveStatusResponseMessage;
+    response->setFederationHandle(getFederationHandle());
+    response->setFederateHandle(message->getFederateHandle());
+    FederateHandleSaveStatusPairVector& federateHandleSaveStatusPairVector = response->getFederateHandleSaveStatusPairVector();
+    federateHandleSaveStatusPairVector.reserve(getFederateHandleFederateMap().size());
+    for (ServerModel::Federate::HandleMap::iterator i = getFederateHandleFederateMap().begin();
+         i != getFederateHandleFederateMap().end(); ++i) {
+      SaveStatus saveStatus = NO_SAVE_IN_PROGRESS;
+      std::map<FederateHandle, SaveStatus>::iterator j = _federateHandleSaveStatusMap.find(i->getFederateHandle());
+      if (j != _federateHandleSaveStatusMap.end())
+        saveStatus = j->second;
+      federateHandleSaveStatusPairVector.push_back(FederateHandleSaveStatusPair(i->getFederateHandle(), saveStatus));
+    }
+    send(connectHandle, response);
+  }
+  void accept(const ConnectHandle& connectHandle, const QueryFederationSaveStatusResponseMessage* message)
+  {
+    send(message->getFederateHandle(), message);
+  }
+
+  /// Take the snapshot once all federates have begun to save and finish the save once all are complete.
+  /// From the point where all federates are saving, they cannot advance time or change the federation state anymore.
+  void checkFederationSave()
+  {
+    bool begun = true;
+    bool complete = true;
+    for (std::map<FederateHandle, SaveStatus>::const_iterator i = _federateHandleSaveStatusMap.begin();
+         i != _federateHandleSaveStatusMap.end(); ++i) {
+      if (i->second == FEDERATE_INSTRUCTED_TO_SAVE)
+        begun = false;
+      if (i->second != FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE)
+        complete = false;
+    }
+    // A writer still running for an aborted save delays the next one until it is done
+    if (begun && _saveSuccessful && !_federationSnapshotWriter.valid()) {
+      std::string fileName = FederationSnapshot::getFileName(getServerNode().getServerOptions().getSaveDirectory(), getName(), _saveLabel);
+      if (getServerNode().getServerLoop().valid())
+        _federationSnapshotWriter = new FederationServerSnapshotWriter(getServerNode(), getFederationHandle(), takeFederationSnapshot(), fileName);
+      if (!_federationSnapshotWriter.valid() || !_federationSnapshotWriter->start()) {
+        _federationSnapshotWriter.clear();
+        _saveSuccessful = false;
+        _saveFailureReason = RTI_UNABLE_TO_SAVE;
+      }
+    }
+    // Usually the writer is long done once the federates have saved their own state,
+    // if not, the save finishes once the writer posted that it is done.
+    if (complete && _saveSuccessful && _federationSnapshotWriter.valid() && !_federationSnapshotWritten)
+      return;
+    if (complete)
+      finishFederationSave();
+  }
+  /// Called from the event loop once the writer is done
+  void federationSnapshotWritten(FederationSnapshotWriter& federationSnapshotWriter)
+  {
+    if (&federationSnapshotWriter != _federationSnapshotWriter.get()) {
+      federationSnapshotWriter.commit(false);
+      return;
+    }
+    if (_federationSnapshotAbandoned) {
+      _federationSnapshotWriter->commit(false);
+      _federationSnapshotWriter.clear();
+      _federationSnapshotAbandoned = false;
+    } else {
+      _federationSnapshotWritten = true;
+    }
+    if (!_federateHandleSaveStatusMap.empty())
+      checkFederationSave();
+  }
+  void finishFederationSave()
+  {
+    if (_federationSnapshotWriter.valid()) {
+      if (!_federationSnapshotWritten) {
+        // Failed or aborted while writing, the file is removed once written
+        _federationSnapshotAbandoned = true;
+      } else {
+        if (!_federationSnapshotWriter->commit(_saveSuccessful) && _saveSuccessful) {
+          _saveSuccessful = false;
+          _saveFailureReason = RTI_UNABLE_TO_SAVE;
+        }
+        _federationSnapshotWriter.clear();
+        _federationSnapshotWritten = false;
+      }
+    }
+
+    SharedPtr<FederationSavedMessage> saved = new FederationSavedMessage;
+    saved->setFederationHandle(getFederationHandle());
+    saved->setLabel(_saveLabel);
+    saved->setSuccessful(_saveSuccessful);
+    saved->setSaveFailureReason(_saveFailureReason);
+    broadcastToChildren(saved);
+
+    _federateHandleSaveStatusMap.clear();
+    _saveLabel.clear();
+  }
+  /// Copy the rti side federation state, everything that may need to walk all
+  /// object instances is kept flat here. Encoding happens in the writer thread.
+  SharedPtr<const FederationSnapshot> takeFederationSnapshot()
+  {
+    Clock start = Clock::now();
+    SharedPtr<FederationSnapshot> federationSnapshot = new FederationSnapshot;
+    FederationSaveHeader& header = federationSnapshot->getHeader();
+    header.setFederationName(getName());
+    header.setLogicalTimeFactoryName(getLogicalTimeFactoryName());
+    header.setLabel(_saveLabel);
+
+    std::map<ConnectHandle, FederateHandle> connectHandleFederateHandleMap;
+    getConnectHandleFederateHandleMap(connectHandleFederateHandleMap);
+
+    FederationSaveFederateVector& federateVector = header.getFederateVector();
+    federateVector.reserve(getFederateHandleFederateMap().size());
+    for (ServerModel::Federate::HandleMap::iterator i = getFederateHandleFederateMap().begin();
+         i != getFederateHandleFederateMap().end(); ++i) {
+      federateVector.push_back(FederationSaveFederate());
+      FederationSaveFederate& federate = federateVector.back();
+      federate.setFederateHandle(i->getFederateHandle());
+      federate.setName(i->getName());
+      federate.setFederateType(i->getFederateType());
+      federate.setIsTimeRegulating(i->getIsTimeRegulating());
+      federate.setTimeAdvanceTimeStamp(i->getTimeAdvanceTimeStamp().toString());
+      federate.setNextMessageTimeStamp(i->getNextMessageTimeStamp().toString());
+      for (ServerModel::Region::HandleMap::iterator j = i->getRegionHandleRegionMap().begin();
+           j != i->getRegionHandleRegionMap().end(); ++j) {
+        RegionHandle regionHandle(i->getFederateHandle(), j->getRegionHandle());
+        federate.getRegionHandleDimensionHandleSetPairVector().push_back(RegionHandleDimensionHandleSetPair(regionHandle, j->_dimensionHandleSet));
+        federate.getRegionHandleRegionValuePairVector().push_back(RegionHandleRegionValuePair(regionHandle, j->_regionValue));
+      }
+    }
+
+    for (ServerModel::InteractionClass::HandleMap::iterator i = getInteractionClassHandleInteractionClassMap().begin();
+         i != getInteractionClassHandleInteractionClassMap().end(); ++i) {
+      if (i->getSubscribedConnectHandleSet().empty())
+        continue;
+      header.getInteractionClassSubscriptionVector().push_back(FederationSaveInteractionClassSubscription());
+      FederationSaveInteractionClassSubscription& subscription = header.getInteractionClassSubscriptionVector().back();
+      subscription.setInteractionClassHandle(i->getInteractionClassHandle());
+      getFederateHandleVector(subscription.getFederateHandleVector(), i->getSubscribedConnectHandleSet());
+    }
+    for (ServerModel::ObjectClass::HandleMap::iterator i = getObjectClassHandleObjectClassMap().begin();
+         i != getObjectClassHandleObjectClassMap().end(); ++i) {
+      for (ServerModel::ClassAttribute::HandleMap::iterator j = i->getAttributeHandleClassAttributeMap().begin();
+           j != i->getAttributeHandleClassAttributeMap().end(); ++j) {
+        if (j->getSubscribedConnectHandleSet().empty())
+          continue;
+        header.getObjectClassSubscriptionVector().push_back(FederationSaveObjectClassSubscription());
+        FederationSaveObjectClassSubscription& subscription = header.getObjectClassSubscriptionVector().back();
+        subscription.setObjectClassHandle(i->getObjectClassHandle());
+        subscription.setAttributeHandle(j->getAttributeHandle());
+        getFederateHandleVector(subscription.getFederateHandleVector(), j->getSubscribedConnectHandleSet());
+      }
+    }
+
+    federationSnapshot->reserveObjectInstances(getObjectInstanceHandleObjectInstanceMap().size());
+    for (ServerModel::ObjectInstance::HandleMap::iterator i = getObjectInstanceHandleObjectInstanceMap().begin();
+         i != getObjectInstanceHandleObjectInstanceMap().end(); ++i) {
+      ObjectClassHandle objectClassHandle;
+      if (ServerModel::ObjectClass* objectClass = i->getObjectClass())
+        objectClassHandle = objectClass->getObjectClassHandle();
+      federationSnapshot->insertObjectInstance(i->getObjectInstanceHandle(), i->getName(), objectClassHandle);
+      for (ServerModel::InstanceAttribute::HandleMap::iterator j = i->getAttributeHandleInstanceAttributeMap().begin();
+           j != i->getAttributeHandleInstanceAttributeMap().end(); ++j) {
+        std::map<ConnectHandle, FederateHandle>::const_iterator k = connectHandleFederateHandleMap.find(j->getOwnerConnectHandle());
+        if (k == connectHandleFederateHandleMap.end())
+          continue;
+        federationSnapshot->insertAttributeOwner(j->getAttributeHandle(), k->second);
+      }
+    }
+
+    Log(ServerFederation, Info) << getServerPath() << ": Snapshot of " << federationSnapshot->getNumObjectInstances()
+                                << " object instances for federation save \"" << _saveLabel << "\" took "
+                                << (Clock::now() - start).getNSec()*1e-6 << " msec." << std::endl;
+    return federationSnapshot;
+  }
+  /// Ownership is tracked per connect, it maps to a federate if only a single one is behind that connect
+  void getConnectHandleFederateHandleMap(std::map<ConnectHandle, FederateHandle>& connectHandleFederateHandleMap)
+  {
+    for (ServerModel::FederationConnect::HandleMap::iterator i = getConnectHandleFederationConnectMap().begin();
+         i != getConnectHandleFederationConnectMap().end(); ++i) {
+      ServerModel::Federate::FirstList::iterator j = i->getFederateList().begin();
+      if (j == i->getFederateList().end())
+        continue;
+      FederateHandle federateHandle = j->getFederateHandle();
+      if (++j != i->getFederateList().end())
+        continue;
+      connectHandleFederateHandleMap[i->getConnectHandle()] = federateHandle;
+    }
+  }
+  void getFederateHandleVector(FederateHandleVector& federateHandleVector, const ConnectHandleSet& connectHandleSet)
+  {
+    for (ConnectHandleSet::const_iterator i = connectHandleSet.begin(); i != connectHandleSet.end(); ++i) {
+      ServerModel::FederationConnect* federationConnect = getFederationConnect(*i);
+      if (!federationConnect)
+        continue;
+      for (ServerModel::Federate::FirstList::iterator j = federationConnect->getFederateList().begin();
+           j != federationConnect->getFederateList().end(); ++j)
+        federateHandleVector.push_back(j->getFederateHandle());
+    }
+  }
+
+  void accept(const ConnectHandle& connectHandle, const RequestFederationRestoreMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+
+    std::map<FederateHandle, std::string> federateHandleNameMap;
+    bool successful = _federateHandleSaveStatusMap.empty() && _federateHandleRestoreStatusMap.empty();
+    if (successful)
+      successful = readFederationRestore(federateHandleNameMap, message->getLabel());
+
+    SharedPtr<RequestFederationRestoreResponseMessage> response = new RequestFederationRestoreResponseMessage;
+    response->setFederationHandle(getFederationHandle());
+    response->setFederateHandle(message->getFederateHandle());
+    response->setLabel(message->getLabel());
+    response->setSuccessful(successful);
+    send(connectHandle, response);
+    if (!successful)
+      return;
+
+    _restoreLabel = message->getLabel();
+    _restoreSuccessful = true;
+    _restoreFailureReason = RTI_UNABLE_TO_RESTORE;
+
+    SharedPtr<FederationRestoreBegunMessage> begun = new FederationRestoreBegunMessage;
+    begun->setFederationHandle(getFederationHandle());
+    begun->setLabel(_restoreLabel);
+    broadcastToChildren(begun);
+
+    for (std::map<FederateHandle, std::string>::const_iterator i = federateHandleNameMap.begin();
+         i != federateHandleNameMap.end(); ++i) {
+      _federateHandleRestoreStatusMap[i->first] = FEDERATE_RESTORING;
+      SharedPtr<InitiateFederateRestoreMessage> initiate = new InitiateFederateRestoreMessage;
+      initiate->setFederationHandle(getFederationHandle());
+      initiate->setFederateHandle(i->first);
+      initiate->setLabel(_restoreLabel);
+      initiate->setFederateName(i->second);
+      send(i->first, initiate);
+    }
+  }
+  /// Check the save against the current federation and assign the saved federate names to the joined federates.
+  /// Each saved federate type needs the same number of joined federates, federates keep their name if possible.
+  /// Only the time management state is rolled back by a restore, object instances, ownership,
+  /// subscriptions and regions must be the saved ones, otherwise the restore is refused.
+  bool readFederationRestore(std::map<FederateHandle, std::string>& federateHandleNameMap, const std::string& label)
+  {
+    std::string fileName = FederationSnapshot::getFileName(getServerNode().getServerOptions().getSaveDirectory(), getName(), label);
+    std::ifstream stream(fileName.c_str(), std::ios::in | std::ios::binary);
+    if (!stream.is_open())
+      return false;
+    FederationSaveHeader header;
+    try {
+      if (!FederationSnapshot::readHeader(header, stream))
+        return false;
+    } catch (const OpenRTI::Exception& e) {
+      Log(ServerFederation, Warning) << getServerPath() << ": Cannot read federation save \"" << fileName << "\": " << e.what() << std::endl;
+      return false;
+    }
+    if (header.getFederationName() != getName() || header.getLabel() != label)
+      return false;
+    if (header.getLogicalTimeFactoryName() != getLogicalTimeFactoryName())
+      return false;
+
+    std::map<std::string, StringSet> typeNameSetMap;
+    for (FederationSaveFederateVector::const_iterator i = header.getFederateVector().begin();
+         i != header.getFederateVector().end(); ++i)
+      typeNameSetMap[i->getFederateType()].insert(i->getName());
+
+    std::map<std::string, std::vector<FederateHandle> > typeFederateHandleVectorMap;
+    for (ServerModel::Federate::HandleMap::iterator i = getFederateHandleFederateMap().begin();
+         i != getFederateHandleFederateMap().end(); ++i) {
+      if (i->getResignPending())
+        continue;
+      StringSet& nameSet = typeNameSetMap[i->getFederateType()];
+      if (nameSet.erase(i->getName()))
+        federateHandleNameMap[i->getFederateHandle()] = i->getName();
+      else
+        typeFederateHandleVectorMap[i->getFederateType()].push_back(i->getFederateHandle());
+    }
+    for (std::map<std::string, StringSet>::iterator i = typeNameSetMap.begin(); i != typeNameSetMap.end(); ++i) {
+      std::vector<FederateHandle>& federateHandleVector = typeFederateHandleVectorMap[i->first];
+      if (federateHandleVector.size() != i->second.size())
+        return false;
+      StringSet::const_iterator k = i->second.begin();
+      for (std::vector<FederateHandle>::const_iterator j = federateHandleVector.begin(); j != federateHandleVector.end(); ++j, ++k)
+        federateHandleNameMap[*j] = *k;
+    }
+    if (federateHandleNameMap.empty())
+      return false;
+
+    // The rti side state is not rebuilt from the save, so it must still be the saved one.
+    // Saved federates are compared as the joined federates that take over their names.
+    std::map<std::string, FederateHandle> nameFederateHandleMap;
+    for (std::map<FederateHandle, std::string>::const_iterator i = federateHandleNameMap.begin();
+         i != federateHandleNameMap.end(); ++i)
+      nameFederateHandleMap[i->second] = i->first;
+    FederateHandleMap federateHandleMap;
+    for (FederationSaveFederateVector::const_iterator i = header.getFederateVector().begin();
+         i != header.getFederateVector().end(); ++i)
+      federateHandleMap[i->getFederateHandle()] = nameFederateHandleMap[i->getName()];
+    try {
+      if (!matchFederationSaveHeader(header, federateHandleMap) || !matchFederationSaveObjectInstances(stream, federateHandleMap)) {
+        Log(ServerFederation, Warning) << getServerPath() << ": Cannot restore federation save \"" << fileName
+                                       << "\": Object instances, ownership, subscriptions or regions changed since the save." << std::endl;
+        return false;
+      }
+    } catch (const OpenRTI::Exception& e) {
+      Log(ServerFederation, Warning) << getServerPath() << ": Cannot read federation save \"" << fileName << "\": " << e.what() << std::endl;
+      return false;
+    }
+    return true;
+  }
+  /// Maps the federate handles of a save to the ones of the joined federates
+  typedef std::map<FederateHandle, FederateHandle> FederateHandleMap;
+  static FederateHandle mapFederateHandle(const FederateHandleMap& federateHandleMap, const FederateHandle& federateHandle)
+  {
+    FederateHandleMap::const_iterator i = federateHandleMap.find(federateHandle);
+    if (i == federateHandleMap.end())
+      return FederateHandle();
+    return i->second;
+  }
+  bool matchFederateHandleVector(const FederateHandleVector& savedFederateHandleVector, const ConnectHandleSet& connectHandleSet,
+                                 const FederateHandleMap& federateHandleMap)
+  {
+    FederateHandleVector federateHandleVector;
+    getFederateHandleVector(federateHandleVector, connectHandleSet);
+    std::set<FederateHandle> federateHandleSet(federateHandleVector.begin(), federateHandleVector.end());
+    std::set<FederateHandle> savedFederateHandleSet;
+    for (FederateHandleVector::const_iterator i = savedFederateHandleVector.begin(); i != savedFederateHandleVector.end(); ++i)
+      savedFederateHandleSet.insert(mapFederateHandle(federateHandleMap, *i));
+    return federateHandleSet == savedFederateHandleSet;
+  }
+  /// Compare the regions and subscriptions of a save with the current ones
+  bool matchFederationSaveHeader(const FederationSaveHeader& header, const FederateHandleMap& federateHandleMap)
+  {
+    for (FederationSaveFederateVector::const_iterator i = header.getFederateVector().begin();
+         i != header.getFederateVector().end(); ++i) {
+      ServerModel::Federate* federate = getFederate(mapFederateHandle(federateHandleMap, i->getFederateHandle()));
+      if (!federate)
+        return false;
+      if (federate->getRegionHandleRegionMap().size() != i->getRegionHandleDimensionHandleSetPairVector().size())
+        return false;
+      for (RegionHandleDimensionHandleSetPairVector::const_iterator j = i->getRegionHandleDimensionHandleSetPairVector().begin();
+           j != i->getRegionHandleDimensionHandleSetPairVector().end(); ++j) {
+        ServerModel::Region* region = federate->getRegion(j->first.getLocalRegionHandle());
+        if (!region || region->_dimensionHandleSet != j->second)
+          return false;
+      }
+      for (RegionHandleRegionValuePairVector::const_iterator j = i->getRegionHandleRegionValuePairVector().begin();
+           j != i->getRegionHandleRegionValuePairVector().end(); ++j) {
+        ServerModel::Region* region = federate->getRegion(j->first.getLocalRegionHandle());
+        if (!region || region->_regionValue != j->second)
+          return false;
+      }
+    }
+
+    size_t numSubscriptions = 0;
+    for (ServerModel::InteractionClass::HandleMap::iterator i = getInteractionClassHandleInteractionClassMap().begin();
+         i != getInteractionClassHandleInteractionClassMap().end(); ++i) {
+      if (!i->getSubscribedConnectHandleSet().empty())
+        ++numSubscriptions;
+    }
+    if (numSubscriptions != header.getInteractionClassSubscriptionVector().size())
+      return false;
+    for (FederationSaveInteractionClassSubscriptionVector::const_iterator i = header.getInteractionClassSubscriptionVector().begin();
+         i != header.getInteractionClassSubscriptionVector().end(); ++i) {
+      ServerModel::InteractionClass* interactionClass = getInteractionClass(i->getInteractionClassHandle());
+      if (!interactionClass)
+        return false;
+      if (!matchFederateHandleVector(i->getFederateHandleVector(), interactionClass->getSubscribedConnectHandleSet(), federateHandleMap))
+        return false;
+    }
+
+    numSubscriptions = 0;
+    for (ServerModel::ObjectClass::HandleMap::iterator i = getObjectClassHandleObjectClassMap().begin();
+         i != getObjectClassHandleObjectClassMap().end(); ++i) {
+      for (ServerModel::ClassAttribute::HandleMap::iterator j = i->getAttributeHandleClassAttributeMap().begin();
+           j != i->getAttributeHandleClassAttributeMap().end(); ++j) {
+        if (!j->getSubscribedConnectHandleSet().empty())
+          ++numSubscriptions;
+      }
+    }
+    if (numSubscriptions != header.getObjectClassSubscriptionVector().size())
+      return false;
+    for (FederationSaveObjectClassSubscriptionVector::const_iterator i = header.getObjectClassSubscriptionVector().begin();
+         i != header.getObjectClassSubscriptionVector().end(); ++i) {
+      ServerModel::ObjectClass* objectClass = getObjectClass(i->getObjectClassHandle());
+      if (!objectClass)
+        return false;
+      ServerModel::ClassAttribute* classAttribute = objectClass->getClassAttribute(i->getAttributeHandle());
+      if (!classAttribute)
+        return false;
+      if (!matchFederateHandleVector(i->getFederateHandleVector(), classAttribute->getSubscribedConnectHandleSet(), federateHandleMap))
+        return false;
+    }
+    return true;
+  }
+  /// Compare the object instances and their owners of a save with the current ones, one block at a time
+  bool matchFederationSaveObjectInstances(std::istream& stream, const FederateHandleMap& federateHandleMap)
+  {
+    std::map<ConnectHandle, FederateHandle> connectHandleFederateHandleMap;
+    getConnectHandleFederateHandleMap(connectHandleFederateHandleMap);
+
+    size_t numObjectInstances = 0;
+    FederationSaveObjectInstanceVector objectInstanceVector;
+    AttributeHandleFederateHandlePairVector ownerVector;
+    AttributeHandleFederateHandlePairVector savedOwnerVector;
+    while (FederationSnapshot::readObjectInstanceVector(objectInstanceVector, stream)) {
+      for (FederationSaveObjectInstanceVector::const_iterator i = objectInstanceVector.begin(); i != objectInstanceVector.end(); ++i) {
+        ServerModel::ObjectInstance* objectInstance = getObjectInstance(i->getObjectInstanceHandle());
+        if (!objectInstance || objectInstance->getName() != i->getName())
+          return false;
+        ObjectClassHandle objectClassHandle;
+        if (ServerModel::ObjectClass* objectClass = objectInstance->getObjectClass())
+          objectClassHandle = objectClass->getObjectClassHandle();
+        if (objectClassHandle != i->getObjectClassHandle())
+          return false;
+
+        ownerVector.clear();
+        for (ServerModel::InstanceAttribute::HandleMap::iterator j = objectInstance->getAttributeHandleInstanceAttributeMap().begin();
+             j != objectInstance->getAttributeHandleInstanceAttributeMap().end(); ++j) {
+          std::map<ConnectHandle, FederateHandle>::const_iterator k = connectHandleFederateHandleMap.find(j->getOwnerConnectHandle());
+          if (k == connectHandleFederateHandleMap.end())
+            continue;
+          ownerVector.push_back(AttributeHandleFederateHandlePair(j->getAttributeHandle(), k->second));
+        }
+        savedOwnerVector.clear();
+        for (AttributeHandleFederateHandlePairVector::const_iterator j = i->getAttributeHandleFederateHandlePairVector().begin();
+             j != i->getAttributeHandleFederateHandlePairVector().end(); ++j)
+          savedOwnerVector.push_back(AttributeHandleFederateHandlePair(j->first, mapFederateHandle(federateHandleMap, j->second)));
+        std::sort(ownerVector.begin(), ownerVector.end());
+        std::sort(savedOwnerVector.begin(), savedOwnerVector.end());
+        if (ownerVector != savedOwnerVector)
+          return false;
+      }
+      numObjectInstances += objectInstanceVector.size();
+    }
+    return numObjectInstances == getObjectInstanceHandleObjectInstanceMap().size();
+  }
+  void accept(const ConnectHandle& connectHandle, const RequestFederationRestoreResponseMessage* message)
+  {
+    send(message->getFederateHandle(), message);
+  }
+  void accept(const ConnectHandle& connectHandle, const FederationRestoreBegunMessage* message)
+  {
+    broadcastToChildren(message);
+  }
+  void accept(const ConnectHandle& connectHandle, const InitiateFederateRestoreMessage* message)
+  {
+    send(message->getFederateHandle(), message);
+  }
+  void accept(const ConnectHandle& connectHandle, const FederateRestoreCompleteMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    std::map<FederateHandle, RestoreStatus>::iterator i = _federateHandleRestoreStatusMap.find(message->getFederateHandle());
+    if (i == _federateHandleRestoreStatusMap.end())
+      return;
+    i->second = FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE;
+    if (!message->getSuccessful() && _restoreSuccessful) {
+      _restoreSuccessful = false;
+      _restoreFailureReason = FEDERATE_REPORTED_FAILURE_DURING_RESTORE;
+    }
+    checkFederationRestore();
+  }
+  void accept(const ConnectHandle& connectHandle, const FederationRestoredMessage* message)
+  {
+    broadcastToChildren(message);
+  }
+  void accept(const ConnectHandle& connectHandle, const AbortFederationRestoreMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    if (_federateHandleRestoreStatusMap.empty())
+      return;
+    _restoreSuccessful = false;
+    _restoreFailureReason = RESTORE_ABORTED;
+    finishFederationRestore();
+  }
+  void accept(const ConnectHandle& connectHandle, const QueryFederationRestoreStatusRequestMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    SharedPtr<QueryFederationRestoreStatusResponseMessage> response = new QueryFederationRestoreStatusResponseMessage;
+    response->setFederationHandle(getFederationHandle());
+    response->setFederateHandle(message->getFederateHandle());
+    FederateHandleRestoreStatusPairVector& federateHandleRestoreStatusPairVector = response->getFederateHandleRestoreStatusPairVector();
+    federateHandleRestoreStatusPairVector.reserve(getFederateHandleFederateMap().size());
+    for (ServerModel::Federate::HandleMap::iterator i = getFederateHandleFederateMap().begin();
+         i != getFederateHandleFederateMap().end(); ++i) {
+      RestoreStatus restoreStatus = NO_RESTORE_IN_PROGRESS;
+      std::map<FederateHandle, RestoreStatus>::iterator j = _federateHandleRestoreStatusMap.find(i->getFederateHandle());
+      if (j != _federateHandleRestoreStatusMap.end())
+        restoreStatus = j->second;
+      federateHandleRestoreStatusPairVector.push_back(FederateHandleRestoreStatusPair(i->getFederateHandle(), restoreStatus));
+    }
+    send(connectHandle, response);
+  }
+  void accept(const ConnectHandle& connectHandle, const QueryFederationRestoreStatusResponseMessage* message)
+  {
+    send(message->getFederateHandle(), message);
+  }
+
+  void checkFederationRestore()
+  {
+    for (std::map<FederateHandle, RestoreStatus>::const_iterator i = _federateHandleRestoreStatusMap.begin();
+         i != _federateHandleRestoreStatusMap.end(); ++i) {
+      if (i->second != FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE)
+        return;
+    }
+    finishFederationRestore();
+  }
+  void finishFederationRestore()
+  {
+    SharedPtr<FederationRestoredMessage> restored = new FederationRestoredMessage;
+    restored->setFederationHandle(getFederationHandle());
+    restored->setLabel(_restoreLabel);
+    restored->setSuccessful(_restoreSuccessful);
+    restored->setRestoreFailureReason(_restoreFailureReason);
+    broadcastToChildren(restored);
+
+    _federateHandleRestoreStatusMap.clear();
+    _restoreLabel.clear();
+  }
+
+  /// A federate leaving during a save or restore lets these fail
+  void eraseFederateFromSaveRestore(const FederateHandle& federateHandle)
+  {
+    if (_federateHandleSaveStatusMap.erase(federateHandle)) {
+      if (_saveSuccessful) {
+        _saveSuccessful = false;
+        _saveFailureReason = FEDERATE_RESIGNED_DURING_SAVE;
+      }
+      checkFederationSave();
+    }
+    if (_federateHandleRestoreStatusMap.erase(federateHandle)) {
+      if (_restoreSuccessful) {
+        _restoreSuccessful = false;
+        _restoreFailureReason = FEDERATE_RESIGNED_DURING_RESTORE;
+      }
+      checkFederationRestore();
+    }
+  }
+
   // Time management
   void accept(const ConnectHandle& connectHandle, const EnableTimeRegulationRequestMessage* message)
   {
@@ -633,6 +1336,7 @@ public:
 
       if (federate->getIsTimeRegulating())
         throw MessageError("EnableTimeRegulationRequestMessage for already time regulaitng federate!");
+      releaseTimeAdvanceBarrier();
       insertTimeRegulating(*federate);
       federate->setTimeAdvanceTimeStamp(message->getTimeStamp());
       federate->setNextMessageTimeStamp(message->getTimeStamp());
@@ -658,16 +1362,30 @@ public:
     if (!federate->getIsTimeRegulating())
       throw MessageError("DisableTimeRegulationRequestMessage for non time regulating Federate!");
     // Don't bail out on anything. If the federate dies in between, we might need to clean up somehow
+    releaseTimeAdvanceBarrier();
     broadcast(connectHandle, message);
     eraseTimeRegulating(*federate);
   }
   void accept(const ConnectHandle& connectHandle, const CommitLowerBoundTimeStampMessage* message)
   {
     ServerModel::Federate* federate = getFederate(message->getFederateHandle());
+    // Commits coming down from the root server in time advance barrier mode may
+    // be overtaken by a disable or resign that took the direct way. Just pass them on,
+    // the ambassadors ignore commits of federates they do not know as regulating.
+    if (_timeAdvanceBarrier && isParentConnect(connectHandle) && (!federate || !federate->getIsTimeRegulating())) {
+      broadcastToChildren(message);
+      return;
+    }
     if (!federate)
       throw MessageError("Received CommitLowerBoundTimeStampMessage from unknown Federate!");
     if (!federate->getIsTimeRegulating())
       throw MessageError("Received CommitLowerBoundTimeStampMessage for non time regulating Federate!");
+    Metrics::instance().getCommitLowerBoundTimeStamps().inc();
+
+    // The time barrier needs to know where the federate comes from
+    VariableLengthData previousTimeStamp;
+    if (_timeAdvanceBarrier && isRootServer())
+      previousTimeStamp = federate->getTimeAdvanceTimeStamp();
 
     switch (message->getCommitType()) {
     case TimeAdvanceCommit:
@@ -688,18 +1406,76 @@ public:
       break;
     }
 
+    if (_timeAdvanceBarrier) {
+      // All commits travel through the root server that collects them if possible.
+      // On the way down the commits go to all connects, the originating
+      // ambassador just ignores its own commit.
+      if (isParentConnect(connectHandle)) {
+        broadcastToChildren(message);
+      } else if (!isRootServer()) {
+        sendToParent(message);
+      } else if (message->getCommitType() == TimeAdvanceAndNextMessageCommit) {
+        collectTimeAdvanceBarrier(*federate, previousTimeStamp, *message);
+      } else {
+        releaseTimeAdvanceBarrier();
+        broadcastToChildren(message);
+      }
+      return;
+    }
+
     // send to all time constrainted connects except to where it originates
     // Hmm, send to all federates. The problem is that non time constrained federates
     // must be able to query the GALT for itself, which is only possible if they know the time advances
     // of each regulating federate, thus just broadcast
     broadcast(connectHandle, message);
   }
+  void accept(const ConnectHandle& connectHandle, const CollectedCommitLowerBoundTimeStampMessage* message)
+  {
+    // Only sent from the root server in time advance barrier mode
+    if (!isParentConnect(connectHandle))
+      throw MessageError("Received CollectedCommitLowerBoundTimeStampMessage not from the parent server!");
+    for (FederateHandleCommitIdPairVector::const_iterator i = message->getFederateHandleCommitIdPairVector().begin();
+         i != message->getFederateHandleCommitIdPairVector().end(); ++i) {
+      ServerModel::Federate* federate = getFederate(i->first);
+      if (!federate || !federate->getIsTimeRegulating())
+        continue;
+      if (message->getCommitType() & TimeAdvanceCommit)
+        federate->setTimeAdvanceTimeStamp(message->getTimeStamp());
+      if (message->getCommitType() & NextMessageCommit)
+        federate->setNextMessageTimeStamp(message->getTimeStamp());
+      federate->setCommitId(i->second);
+    }
+    broadcastToChildren(message);
+  }
   void accept(const ConnectHandle& connectHandle, const CommitLowerBoundTimeStampResponseMessage* message)
   {
+    if (_timeAdvanceBarrier) {
+      // Keep these in order with the commits that travel through the root server
+      if (!isRootServer() && !isParentConnect(connectHandle)) {
+        sendToParent(message);
+        return;
+      }
+      releaseTimeAdvanceBarrier();
+    }
     send(message->getFederateHandle(), message);
   }
   void accept(const ConnectHandle& connectHandle, const LockedByNextMessageRequestMessage* message)
   {
+    if (_timeAdvanceBarrier) {
+      // Keep these in order with the commits that travel through the root server
+      if (!isRootServer() && !isParentConnect(connectHandle)) {
+        sendToParent(message);
+        return;
+      }
+      if (isRootServer()) {
+        releaseTimeAdvanceBarrier();
+        for (ServerModel::FederationConnect::SecondList::iterator i = getTimeRegulatingFederationConnectList().begin();
+             i != getTimeRegulatingFederationConnectList().end(); ++i)
+          i->send(message);
+        return;
+      }
+    }
+
     // Only time regulating federates are interrested in this message.
     // May be we should at one point track and store this connect handle set.
     for (ServerModel::FederationConnect::SecondList::iterator i = getTimeRegulatingFederationConnectList().begin();
@@ -974,6 +1750,15 @@ public:
       objectClass->updateCumulativeSubscription(connectHandle, *i, objectInstanceList);
     }
 
+    // Keep track of the update rate this connect wants to receive instances of this class.
+    // The rate is only honoured at the server node the subscribing ambassador is connected to,
+    // so the requests propagated further below never carry a rate.
+    ServerModel::ClassAttribute* privilegeToDeleteAttribute = objectClass->getPrivilegeToDeleteClassAttribute();
+    if (!privilegeToDeleteAttribute || privilegeToDeleteAttribute->getSubscriptionType(connectHandle) == Unsubscribed)
+      objectClass->eraseUpdateRate(connectHandle);
+    else if (message->getSubscriptionType() != Unsubscribed)
+      objectClass->setUpdateRate(connectHandle, message->getUpdateRate());
+
     // Now propagate the subscription change further
     for (std::map<ConnectHandle, AttributeHandleVector>::iterator i = sendAttributeHandlesMap.begin();
          i != sendAttributeHandlesMap.end(); ++i) {
@@ -986,26 +1771,42 @@ public:
       send(i->first, request);
     }
 
-    // Insert all object instances that are now new to this connect
+    // Insert all object instances that are now new to this connect.
+    // These go out in blocks of object instance states, a late subscriber to a class
+    // with many object instances would otherwise get one message per object instance.
     if (message->getSubscriptionType() != Unsubscribed) {
+      SharedPtr<InsertMultipleObjectInstancesMessage> request;
       for (ServerModel::ObjectClass::ObjectInstanceList::iterator j = objectInstanceList.begin(); j != objectInstanceList.end(); ++j) {
-        SharedPtr<InsertObjectInstanceMessage> request = new InsertObjectInstanceMessage;
-        request->setFederationHandle(getFederationHandle());
-        request->setObjectInstanceHandle((*j)->getObjectInstanceHandle());
-        request->setObjectClassHandle((*j)->getObjectClass()->getObjectClassHandle());
-        request->setName((*j)->getName());
-        request->getAttributeStateVector().reserve((*j)->getAttributeHandleInstanceAttributeMap().size());
-        for (ServerModel::InstanceAttribute::HandleMap::iterator k = (*j)->getAttributeHandleInstanceAttributeMap().begin();
-             k != (*j)->getAttributeHandleInstanceAttributeMap().end(); ++k) {
-          AttributeState attributeState;
-          attributeState.setAttributeHandle(k->getAttributeHandle());
-          request->getAttributeStateVector().push_back(attributeState);
+        if (!request.valid()) {
+          request = new InsertMultipleObjectInstancesMessage;
+          request->setFederationHandle(getFederationHandle());
+          request->getObjectInstanceStateVector().reserve(std::min(objectInstanceList.size(), size_t(InsertMultipleObjectInstancesBlockSize)));
         }
+        request->getObjectInstanceStateVector().push_back(ObjectInstanceState());
+        getObjectInstanceState(request->getObjectInstanceStateVector().back(), **j);
         if (!isParentConnect(connectHandle)) {
           (*j)->reference(*federationConnect);
         }
+        if (request->getObjectInstanceStateVector().size() < InsertMultipleObjectInstancesBlockSize)
+          continue;
         federationConnect->send(request);
+        request.clear();
       }
+      if (request.valid())
+        federationConnect->send(request);
+    }
+  }
+  void getObjectInstanceState(ObjectInstanceState& objectInstanceState, ServerModel::ObjectInstance& objectInstance)
+  {
+    objectInstanceState.setObjectInstanceHandle(objectInstance.getObjectInstanceHandle());
+    objectInstanceState.setObjectClassHandle(objectInstance.getObjectClass()->getObjectClassHandle());
+    objectInstanceState.setName(objectInstance.getName());
+    objectInstanceState.getAttributeStateVector().reserve(objectInstance.getAttributeHandleInstanceAttributeMap().size());
+    for (ServerModel::InstanceAttribute::HandleMap::iterator k = objectInstance.getAttributeHandleInstanceAttributeMap().begin();
+         k != objectInstance.getAttributeHandleInstanceAttributeMap().end(); ++k) {
+      AttributeState attributeState;
+      attributeState.setAttributeHandle(k->getAttributeHandle());
+      objectInstanceState.getAttributeStateVector().push_back(attributeState);
     }
   }
   void unsubscribeConnect(const ConnectHandle& connectHandle)
@@ -1263,8 +2064,68 @@ public:
   // Object instance messages
   void accept(const ConnectHandle& connectHandle, const InsertObjectInstanceMessage* message)
   {
-    ObjectInstanceHandle objectInstanceHandle = message->getObjectInstanceHandle();
-    ObjectClassHandle objectClassHandle = message->getObjectClassHandle();
+    ServerModel::ObjectInstance* objectInstance;
+    objectInstance = insertReferencedObjectInstance(connectHandle, message->getObjectClassHandle(), message->getObjectInstanceHandle(),
+                                                    message->getName(), message->getAttributeStateVector());
+
+    // If still unreferenced, ignore the insert and unref again in the parent
+    // this can happen if we subscribed and unsubscribed at the server before we received the insert that is triggered by the subscribe request.
+    if (!objectInstance) {
+      OpenRTIAssert(isParentConnect(connectHandle));
+
+      SharedPtr<ReleaseMultipleObjectInstanceNameHandlePairsMessage> releaseMessage;
+      releaseMessage = new ReleaseMultipleObjectInstanceNameHandlePairsMessage;
+      releaseMessage->setFederationHandle(getFederationHandle());
+      releaseMessage->getObjectInstanceHandleVector().push_back(message->getObjectInstanceHandle());
+
+      sendToParent(releaseMessage);
+
+    } else {
+      send(objectInstance->getPrivilegeToDeleteInstanceAttribute()->_receivingConnects, message);
+    }
+  }
+  void accept(const ConnectHandle& connectHandle, const InsertMultipleObjectInstancesMessage* message)
+  {
+    // Same as above for each object instance, but pass the inserts on again in blocks
+    SharedPtr<ReleaseMultipleObjectInstanceNameHandlePairsMessage> releaseMessage;
+    std::map<ConnectHandle, SharedPtr<InsertMultipleObjectInstancesMessage> > connectHandleMessageMap;
+    for (ObjectInstanceStateVector::const_iterator i = message->getObjectInstanceStateVector().begin();
+         i != message->getObjectInstanceStateVector().end(); ++i) {
+      ServerModel::ObjectInstance* objectInstance;
+      objectInstance = insertReferencedObjectInstance(connectHandle, i->getObjectClassHandle(), i->getObjectInstanceHandle(),
+                                                      i->getName(), i->getAttributeStateVector());
+      if (!objectInstance) {
+        OpenRTIAssert(isParentConnect(connectHandle));
+        if (!releaseMessage.valid()) {
+          releaseMessage = new ReleaseMultipleObjectInstanceNameHandlePairsMessage;
+          releaseMessage->setFederationHandle(getFederationHandle());
+        }
+        releaseMessage->getObjectInstanceHandleVector().push_back(i->getObjectInstanceHandle());
+        continue;
+      }
+
+      const ConnectHandleSet& receivingConnects = objectInstance->getPrivilegeToDeleteInstanceAttribute()->_receivingConnects;
+      for (ConnectHandleSet::const_iterator j = receivingConnects.begin(); j != receivingConnects.end(); ++j) {
+        SharedPtr<InsertMultipleObjectInstancesMessage>& request = connectHandleMessageMap[*j];
+        if (!request.valid()) {
+          request = new InsertMultipleObjectInstancesMessage;
+          request->setFederationHandle(getFederationHandle());
+        }
+        request->getObjectInstanceStateVector().push_back(*i);
+      }
+    }
+
+    if (releaseMessage.valid())
+      sendToParent(releaseMessage);
+    for (std::map<ConnectHandle, SharedPtr<InsertMultipleObjectInstancesMessage> >::iterator i = connectHandleMessageMap.begin();
+         i != connectHandleMessageMap.end(); ++i)
+      send(i->first, i->second);
+  }
+  // Returns the object instance if any connect besides the inserting one subscribes it
+  ServerModel::ObjectInstance* insertReferencedObjectInstance(const ConnectHandle& connectHandle, const ObjectClassHandle& objectClassHandle,
+                                                              const ObjectInstanceHandle& objectInstanceHandle, const std::string& name,
+                                                              const AttributeStateVector& attributeStateVector)
+  {
     ServerModel::ObjectClass* objectClass = ServerModel::Federation::getObjectClass(objectClassHandle);
     if (!objectClass)
       throw MessageError("InsertObjectInstanceMessage for unknown ObjectClass.");
@@ -1281,37 +2142,24 @@ public:
         if (*j == connectHandle)
           continue;
         if (!objectInstance)
-          objectInstance = insertObjectInstance(objectInstanceHandle, message->getName());
+          objectInstance = insertObjectInstance(objectInstanceHandle, name);
         ServerModel::FederationConnect* federationConnect = getFederationConnect(*j);
         if (!federationConnect)
           continue;
         objectInstance->reference(*federationConnect);
       }
     }
+    if (!objectInstance)
+      return 0;
 
-    // If still unreferenced, ignore the insert and unref again in the parent
-    // this can happen if we subscribed and unsubscribed at the server before we received the insert that is triggered by the subscribe request.
-    if (!objectInstance) {
-      OpenRTIAssert(isParentConnect(connectHandle));
-
-      SharedPtr<ReleaseMultipleObjectInstanceNameHandlePairsMessage> message;
-      message = new ReleaseMultipleObjectInstanceNameHandlePairsMessage;
-      message->setFederationHandle(getFederationHandle());
-      message->getObjectInstanceHandleVector().push_back(objectInstanceHandle);
-
-      sendToParent(message);
-
-    } else {
-      OpenRTIAssert(!objectInstance->getConnectHandleObjectInstanceConnectMap().empty());
-
-      objectInstance->setObjectClass(objectClass);
-      for (size_t j = 0; j < message->getAttributeStateVector().size(); ++j) {
-        ServerModel::InstanceAttribute* instanceAttribute = objectInstance->getInstanceAttribute(message->getAttributeStateVector()[j].getAttributeHandle());
-        instanceAttribute->setOwnerConnectHandle(connectHandle);
-      }
+    OpenRTIAssert(!objectInstance->getConnectHandleObjectInstanceConnectMap().empty());
 
-      send(objectInstance->getPrivilegeToDeleteInstanceAttribute()->_receivingConnects, message);
+    objectInstance->setObjectClass(objectClass);
+    for (size_t j = 0; j < attributeStateVector.size(); ++j) {
+      ServerModel::InstanceAttribute* instanceAttribute = objectInstance->getInstanceAttribute(attributeStateVector[j].getAttributeHandle());
+      instanceAttribute->setOwnerConnectHandle(connectHandle);
     }
+    return objectInstance;
   }
   void accept(const ConnectHandle& connectHandle, const DeleteObjectInstanceMessage* message)
   {
@@ -1368,9 +2216,27 @@ public:
       }
     }
 
+    // Only pay for the clock if there is any rate reduced subscription at all
+    bool reduceUpdateRate = getHasUpdateRateReductions() && objectInstance->getObjectClass();
+    Clock now;
+    if (reduceUpdateRate)
+      now = Clock::now();
+
+    Metrics::instance().getFanOut().record(connectHandleAttributeValueVectorMap.size());
     for (ConnectHandleAttributeValueVectorMap::iterator i = connectHandleAttributeValueVectorMap.begin();
           i != connectHandleAttributeValueVectorMap.end(); ++i) {
+      if (reduceUpdateRate) {
+        double updateRate = objectInstance->getObjectClass()->getEffectiveUpdateRate(i->first);
+        Clock dueTime;
+        if (!objectInstance->reduceUpdateRate(i->first, updateRate, now, *message, i->second, dueTime)) {
+          // Make sure the held back values are sent even if no further update arrives
+          _updateRateReducedObjectInstanceHandleSet.insert(message->getObjectInstanceHandle());
+          getServerNode().setTimeout(dueTime);
+          continue;
+        }
+      }
       SharedPtr<AttributeUpdateMessage> update = new AttributeUpdateMessage;
+      update->copyMessageTrace(*message);
       update->setFederationHandle(getFederationHandle());
       update->setFederateHandle(message->getFederateHandle());
       update->setObjectInstanceHandle(message->getObjectInstanceHandle());
@@ -1380,6 +2246,80 @@ public:
       send(i->first, update);
     }
   }
+  /// Send the values held back by rate reduced subscriptions that are due and no update took along.
+  /// Returns the time the next held back values are due.
+  Clock flushUpdateRateReductions(const Clock& now)
+  {
+    Clock timeout = Clock::max();
+    ObjectInstanceHandleSet::iterator i = _updateRateReducedObjectInstanceHandleSet.begin();
+    while (i != _updateRateReducedObjectInstanceHandleSet.end()) {
+      ServerModel::ObjectInstance* objectInstance = getObjectInstance(*i);
+      Clock dueTime = Clock::max();
+      if (objectInstance && objectInstance->getObjectClass())
+        dueTime = flushUpdateRateReductions(*objectInstance, now);
+      if (dueTime == Clock::max()) {
+        _updateRateReducedObjectInstanceHandleSet.erase(i++);
+      } else {
+        timeout = std::min(timeout, dueTime);
+        ++i;
+      }
+    }
+    return timeout;
+  }
+  Clock flushUpdateRateReductions(ServerModel::ObjectInstance& objectInstance, const Clock& now)
+  {
+    Clock timeout = Clock::max();
+    ServerModel::ObjectInstance::ConnectHandleUpdateRateReductionMap& updateRateReductionMap = objectInstance.getConnectHandleUpdateRateReductionMap();
+    ServerModel::ObjectInstance::ConnectHandleUpdateRateReductionMap::iterator i = updateRateReductionMap.begin();
+    while (i != updateRateReductionMap.end()) {
+      ServerModel::ObjectInstance::UpdateRateReduction& updateRateReduction = i->second;
+      if (updateRateReduction._attributeValues.empty()) {
+        ++i;
+        continue;
+      }
+      if (now < updateRateReduction._nextUpdateTime) {
+        timeout = std::min(timeout, updateRateReduction._nextUpdateTime);
+        ++i;
+        continue;
+      }
+
+      // Only what the connect still subscribes to
+      const AttributeUpdateMessage* message = static_cast<const AttributeUpdateMessage*>(updateRateReduction._message.get());
+      SharedPtr<AttributeUpdateMessage> update = new AttributeUpdateMessage;
+      update->copyMessageTrace(*message);
+      update->setFederationHandle(getFederationHandle());
+      update->setFederateHandle(message->getFederateHandle());
+      update->setObjectInstanceHandle(message->getObjectInstanceHandle());
+      update->setTag(message->getTag());
+      update->setTransportationType(message->getTransportationType());
+      update->getAttributeValues().reserve(updateRateReduction._attributeValues.size());
+      for (AttributeValueVector::iterator j = updateRateReduction._attributeValues.begin();
+           j != updateRateReduction._attributeValues.end(); ++j) {
+        ServerModel::InstanceAttribute* instanceAttribute = objectInstance.getInstanceAttribute(j->getAttributeHandle());
+        if (!instanceAttribute)
+          continue;
+        if (instanceAttribute->_receivingConnects.find(i->first) == instanceAttribute->_receivingConnects.end())
+          continue;
+        update->getAttributeValues().push_back(AttributeValue());
+        update->getAttributeValues().back().setAttributeHandle(j->getAttributeHandle());
+        update->getAttributeValues().back().getValue().swap(j->getValue());
+      }
+      ConnectHandle connectHandle = i->first;
+      double updateRate = objectInstance.getObjectClass()->getEffectiveUpdateRate(connectHandle);
+      if (updateRate <= 0) {
+        updateRateReductionMap.erase(i++);
+      } else {
+        updateRateReduction._attributeValues.clear();
+        updateRateReduction._message.clear();
+        updateRateReduction._nextUpdateTime = now + Clock::fromSeconds(1/updateRate);
+        ++i;
+      }
+      if (!update->getAttributeValues().empty())
+        send(connectHandle, update);
+    }
+    return timeout;
+  }
+
   void accept(const ConnectHandle& connectHandle, const TimeStampedAttributeUpdateMessage* message)
   {
     ServerModel::ObjectInstance* objectInstance = getObjectInstance(message->getObjectInstanceHandle());
@@ -1402,9 +2342,11 @@ public:
       }
     }
 
+    Metrics::instance().getFanOut().record(connectHandleAttributeValueVectorMap.size());
     for (ConnectHandleAttributeValueVectorMap::iterator i = connectHandleAttributeValueVectorMap.begin();
           i != connectHandleAttributeValueVectorMap.end(); ++i) {
       SharedPtr<TimeStampedAttributeUpdateMessage> update = new TimeStampedAttributeUpdateMessage;
+      update->copyMessageTrace(*message);
       update->setFederationHandle(getFederationHandle());
       update->setFederateHandle(message->getFederateHandle());
       update->setObjectInstanceHandle(message->getObjectInstanceHandle());
@@ -1423,39 +2365,50 @@ public:
   void accept(const ConnectHandle& connectHandle, const InteractionMessage* message)
   {
     ServerModel::InteractionClass* interactionClass = getInteractionClass(message->getInteractionClassHandle());
-    if (!interactionClass)
+    if (!interactionClass) {
+      // Best effort interactions may overtake the messages telling about the class
+      if (!message->getReliable())
+        return;
       throw MessageError("Received InteractionMessage for unknown interaction class!");
+    }
     // Send to all subscribed connects except the originating one
-    for (ConnectHandleSet::const_iterator i = interactionClass->_cumulativeSubscribedConnectHandleSet.begin();
-         i != interactionClass->_cumulativeSubscribedConnectHandleSet.end(); ++i) {
-      if (*i == connectHandle)
+    const ServerModel::InteractionClass::InteractionRouteVector& routeVector = interactionClass->getInteractionRouteVector();
+    uint64_t fanOut = 0;
+    for (ServerModel::InteractionClass::InteractionRouteVector::const_iterator i = routeVector.begin();
+         i != routeVector.end(); ++i) {
+      // Do not bother if only the originating connect is routed here
+      if (i->_connectHandleVector.size() == 1 && i->_connectHandleVector.front() == connectHandle)
         continue;
-      ServerModel::InteractionClass* currentInteractionClass = interactionClass;
-      while (currentInteractionClass) {
-        if (currentInteractionClass->getSubscriptionType(*i) != Unsubscribed) {
-          if (currentInteractionClass == interactionClass) {
-            send(*i, message);
-          } else {
-            SharedPtr<InteractionMessage> message2 = new InteractionMessage;
-            message2->setFederationHandle(message->getFederationHandle());
-            message2->setFederateHandle(message->getFederateHandle());
-            message2->setTransportationType(message->getTransportationType());
-            message2->setTag(message->getTag());
-            message2->getParameterValues().reserve(message->getParameterValues().size());
-            for (ParameterValueVector::const_iterator j = message->getParameterValues().begin();
-                 j != message->getParameterValues().end(); ++j) {
-              if (!currentInteractionClass->getClassParameter(j->getParameterHandle()))
-                continue;
-              message2->getParameterValues().push_back(*j);
-            }
-            message2->setInteractionClassHandle(currentInteractionClass->getInteractionClassHandle());
-            send(*i, message2);
-          }
-          break;
+      SharedPtr<const InteractionMessage> message2;
+      if (i->_interactionClass == interactionClass) {
+        message2 = message;
+      } else {
+        // Build the base class variant once for all connects subscribed at that class
+        SharedPtr<InteractionMessage> baseMessage = new InteractionMessage;
+        baseMessage->copyMessageTrace(*message);
+        baseMessage->setFederationHandle(message->getFederationHandle());
+        baseMessage->setFederateHandle(message->getFederateHandle());
+        baseMessage->setTransportationType(message->getTransportationType());
+        baseMessage->setTag(message->getTag());
+        baseMessage->getParameterValues().reserve(message->getParameterValues().size());
+        for (ParameterValueVector::const_iterator j = message->getParameterValues().begin();
+             j != message->getParameterValues().end(); ++j) {
+          if (!i->getParameterVisible(j->getParameterHandle()))
+            continue;
+          baseMessage->getParameterValues().push_back(*j);
         }
-        currentInteractionClass = currentInteractionClass->getParentInteractionClass();
+        baseMessage->setInteractionClassHandle(i->_interactionClass->getInteractionClassHandle());
+        message2 = baseMessage;
+      }
+      for (std::vector<ConnectHandle>::const_iterator j = i->_connectHandleVector.begin();
+           j != i->_connectHandleVector.end(); ++j) {
+        if (*j == connectHandle)
+          continue;
+        send(*j, message2);
+        ++fanOut;
       }
     }
+    Metrics::instance().getFanOut().record(fanOut);
   }
   void accept(const ConnectHandle& connectHandle, const TimeStampedInteractionMessage* message)
   {
@@ -1463,39 +2416,61 @@ public:
     if (!interactionClass)
       throw MessageError("Received TimeStampedInteractionMessage for unknown interaction class!");
     // Send to all subscribed connects except the originating one
-    for (ConnectHandleSet::const_iterator i = interactionClass->_cumulativeSubscribedConnectHandleSet.begin();
-         i != interactionClass->_cumulativeSubscribedConnectHandleSet.end(); ++i) {
-      if (*i == connectHandle)
+    const ServerModel::InteractionClass::InteractionRouteVector& routeVector = interactionClass->getInteractionRouteVector();
+    uint64_t fanOut = 0;
+    for (ServerModel::InteractionClass::InteractionRouteVector::const_iterator i = routeVector.begin();
+         i != routeVector.end(); ++i) {
+      // Do not bother if only the originating connect is routed here
+      if (i->_connectHandleVector.size() == 1 && i->_connectHandleVector.front() == connectHandle)
         continue;
-      ServerModel::InteractionClass* currentInteractionClass = interactionClass;
-      while (currentInteractionClass) {
-        if (currentInteractionClass->getSubscriptionType(*i) != Unsubscribed) {
-          if (currentInteractionClass == interactionClass) {
-            send(*i, message);
-          } else {
-            SharedPtr<TimeStampedInteractionMessage> message2 = new TimeStampedInteractionMessage;
-            message2->setFederationHandle(message->getFederationHandle());
-            message2->setFederateHandle(message->getFederateHandle());
-            message2->setOrderType(message->getOrderType());
-            message2->setTransportationType(message->getTransportationType());
-            message2->setTag(message->getTag());
-            message2->setTimeStamp(message->getTimeStamp());
-            message2->setMessageRetractionHandle(message->getMessageRetractionHandle());
-            message2->getParameterValues().reserve(message->getParameterValues().size());
-            for (ParameterValueVector::const_iterator j = message->getParameterValues().begin();
-                 j != message->getParameterValues().end(); ++j) {
-              if (!currentInteractionClass->getClassParameter(j->getParameterHandle()))
-                continue;
-              message2->getParameterValues().push_back(*j);
-            }
-            message2->setInteractionClassHandle(currentInteractionClass->getInteractionClassHandle());
-            send(*i, message2);
-          }
-          break;
+      SharedPtr<const TimeStampedInteractionMessage> message2;
+      if (i->_interactionClass == interactionClass) {
+        message2 = message;
+      } else {
+        // Build the base class variant once for all connects subscribed at that class
+        SharedPtr<TimeStampedInteractionMessage> baseMessage = new TimeStampedInteractionMessage;
+        baseMessage->copyMessageTrace(*message);
+        baseMessage->setFederationHandle(message->getFederationHandle());
+        baseMessage->setFederateHandle(message->getFederateHandle());
+        baseMessage->setOrderType(message->getOrderType());
+        baseMessage->setTransportationType(message->getTransportationType());
+        baseMessage->setTag(message->getTag());
+        baseMessage->setTimeStamp(message->getTimeStamp());
+        baseMessage->setMessageRetractionHandle(message->getMessageRetractionHandle());
+        baseMessage->getParameterValues().reserve(message->getParameterValues().size());
+        for (ParameterValueVector::const_iterator j = message->getParameterValues().begin();
+             j != message->getParameterValues().end(); ++j) {
+          if (!i->getParameterVisible(j->getParameterHandle()))
+            continue;
+          baseMessage->getParameterValues().push_back(*j);
         }
-        currentInteractionClass = currentInteractionClass->getParentInteractionClass();
+        baseMessage->setInteractionClassHandle(i->_interactionClass->getInteractionClassHandle());
+        message2 = baseMessage;
+      }
+      for (std::vector<ConnectHandle>::const_iterator j = i->_connectHandleVector.begin();
+           j != i->_connectHandleVector.end(); ++j) {
+        if (*j == connectHandle)
+          continue;
+        send(*j, message2);
+        ++fanOut;
       }
     }
+    Metrics::instance().getFanOut().record(fanOut);
+  }
+
+  void accept(const ConnectHandle& connectHandle, const MessageRetractionMessage* message)
+  {
+    // The retracted messages may have been routed to any connect except the originating one.
+    // Throw out what still waits in the send queues, but forward the retraction anyway since
+    // parts of the retracted messages may already be on their way.
+    for (ServerModel::FederationConnect::HandleMap::iterator i = getConnectHandleFederationConnectMap().begin();
+         i != getConnectHandleFederationConnectMap().end(); ++i) {
+      if (i->getConnectHandle() == connectHandle)
+        continue;
+      if (unsigned count = i->retract(message->getMessageRetractionHandle()))
+        Metrics::instance().getRetractedMessages().add(count);
+      i->send(message);
+    }
   }
 
   void accept(const ConnectHandle& connectHandle, const RequestAttributeUpdateMessage* message)
@@ -1544,6 +2519,98 @@ public:
     send(connectHandleSet, connectHandle, message);
   }
 
+  // Transportation type changes, every server on the way up to the root keeps track of them
+  void accept(const ConnectHandle& connectHandle, const ChangeAttributeTransportationTypeRequestMessage* message)
+  {
+    if (ServerModel::ObjectInstance* objectInstance = getObjectInstance(message->getObjectInstanceHandle())) {
+      for (AttributeHandleVector::const_iterator i = message->getAttributeHandles().begin();
+           i != message->getAttributeHandles().end(); ++i)
+        objectInstance->setTransportationType(*i, message->getTransportationType());
+    }
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    SharedPtr<ChangeAttributeTransportationTypeResponseMessage> response = new ChangeAttributeTransportationTypeResponseMessage;
+    response->setFederationHandle(getFederationHandle());
+    response->setFederateHandle(message->getFederateHandle());
+    response->setObjectInstanceHandle(message->getObjectInstanceHandle());
+    response->setAttributeHandles(message->getAttributeHandles());
+    response->setTransportationType(message->getTransportationType());
+    send(connectHandle, response);
+  }
+  void accept(const ConnectHandle& connectHandle, const ChangeAttributeTransportationTypeResponseMessage* message)
+  {
+    send(message->getFederateHandle(), message);
+  }
+  void accept(const ConnectHandle& connectHandle, const ChangeInteractionTransportationTypeRequestMessage* message)
+  {
+    if (ServerModel::Federate* federate = getFederate(message->getFederateHandle()))
+      federate->setTransportationType(message->getInteractionClassHandle(), message->getTransportationType());
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    SharedPtr<ChangeInteractionTransportationTypeResponseMessage> response = new ChangeInteractionTransportationTypeResponseMessage;
+    response->setFederationHandle(getFederationHandle());
+    response->setFederateHandle(message->getFederateHandle());
+    response->setInteractionClassHandle(message->getInteractionClassHandle());
+    response->setTransportationType(message->getTransportationType());
+    send(connectHandle, response);
+  }
+  void accept(const ConnectHandle& connectHandle, const ChangeInteractionTransportationTypeResponseMessage* message)
+  {
+    send(message->getFederateHandle(), message);
+  }
+  // Only the root server sees all changes, so only that one answers queries
+  void accept(const ConnectHandle& connectHandle, const QueryAttributeTransportationTypeRequestMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    // An object instance deleted in the mean time reports the default
+    TransportationType transportationType = RELIABLE;
+    if (ServerModel::ObjectInstance* objectInstance = getObjectInstance(message->getObjectInstanceHandle()))
+      transportationType = objectInstance->getTransportationType(message->getAttributeHandle());
+    SharedPtr<QueryAttributeTransportationTypeResponseMessage> response = new QueryAttributeTransportationTypeResponseMessage;
+    response->setFederationHandle(getFederationHandle());
+    response->setFederateHandle(message->getFederateHandle());
+    response->setObjectInstanceHandle(message->getObjectInstanceHandle());
+    response->setAttributeHandle(message->getAttributeHandle());
+    response->setTransportationType(transportationType);
+    send(connectHandle, response);
+  }
+  void accept(const ConnectHandle& connectHandle, const QueryAttributeTransportationTypeResponseMessage* message)
+  {
+    send(message->getFederateHandle(), message);
+  }
+  void accept(const ConnectHandle& connectHandle, const QueryInteractionTransportationTypeRequestMessage* message)
+  {
+    if (!isRootServer()) {
+      sendToParent(message);
+      return;
+    }
+    ServerModel::InteractionClass* interactionClass = getInteractionClass(message->getInteractionClassHandle());
+    if (!interactionClass)
+      throw MessageError("Received QueryInteractionTransportationTypeRequestMessage for unknown interaction class!");
+    // A federate that is not or no longer joined reports the default
+    TransportationType transportationType = interactionClass->getTransportationType();
+    if (ServerModel::Federate* federate = getFederate(message->getQueriedFederateHandle()))
+      transportationType = federate->getTransportationType(*interactionClass);
+    SharedPtr<QueryInteractionTransportationTypeResponseMessage> response = new QueryInteractionTransportationTypeResponseMessage;
+    response->setFederationHandle(getFederationHandle());
+    response->setFederateHandle(message->getFederateHandle());
+    response->setQueriedFederateHandle(message->getQueriedFederateHandle());
+    response->setInteractionClassHandle(message->getInteractionClassHandle());
+    response->setTransportationType(transportationType);
+    send(connectHandle, response);
+  }
+  void accept(const ConnectHandle& connectHandle, const QueryInteractionTransportationTypeResponseMessage* message)
+  {
+    send(message->getFederateHandle(), message);
+  }
+
   template<typename M>
   void acceptFederationMessage(const ConnectHandle& connectHandle, const M* message)
   {
@@ -1587,6 +2654,8 @@ public:
     message->setLogicalTimeFactoryName(getLogicalTimeFactoryName());
     if (!federationConnect->getPermitTimeRegulation())
       message->getConfigurationParameterMap()["permitTimeRegulation"].push_back("false");
+    if (_timeAdvanceBarrier)
+      message->getConfigurationParameterMap()["timeAdvanceBarrier"].push_back("true");
     // FIXME add the server options
     federationConnect->send(message);
 
@@ -1766,6 +2835,7 @@ public:
 
         // Remove from time management, needs to happen before the federation connect is removed
         if (federate->getIsTimeRegulating()) {
+          releaseTimeAdvanceBarrier();
           eraseTimeRegulating(*federate);
           SharedPtr<DisableTimeRegulationRequestMessage> request = new DisableTimeRegulationRequestMessage;
           request->setFederationHandle(getFederationHandle());
@@ -1851,7 +2921,10 @@ public:
     if (federationConnect)
       federationConnect->erase(federate);
 
+    FederateHandle federateHandle = federate.getFederateHandle();
     ServerModel::Federation::erase(federate);
+
+    eraseFederateFromSaveRestore(federateHandle);
   }
 
   using ServerModel::Federation::broadcastToChildren;
@@ -1894,8 +2967,86 @@ public:
       send(*i, message);
   }
 
+  /// Time advance barrier at the root server.
+  /// Lockstep federations have all regulating federates commit the same time stamp
+  /// once per step. The root server holds back these commits until all regulating
+  /// federates have committed and then sends a single collected commit down the tree.
+  /// Since the server cannot compare logical times, a group of commits is only
+  /// collected as long as every regulating federate is either at the common
+  /// previous time stamp of the group or at the new time stamp. Anything else,
+  /// like next message commits or differing time stamps, releases the group.
+  void collectTimeAdvanceBarrier(const ServerModel::Federate& federate, const VariableLengthData& previousTimeStamp,
+                                 const CommitLowerBoundTimeStampMessage& message)
+  {
+    if (!_barrierFederateHandleCommitIdPairVector.empty()) {
+      if (message.getTimeStamp() != _barrierTimeStamp || previousTimeStamp != _barrierPreviousTimeStamp)
+        releaseTimeAdvanceBarrier();
+    }
+    if (_barrierFederateHandleCommitIdPairVector.empty()) {
+      _barrierTimeStamp = message.getTimeStamp();
+      _barrierPreviousTimeStamp = previousTimeStamp;
+    }
+    _barrierFederateHandleCommitIdPairVector.push_back(FederateHandleCommitIdPair(federate.getFederateHandle(), message.getCommitId()));
+
+    bool complete = true;
+    for (ServerModel::FederationConnect::SecondList::iterator i = getTimeRegulatingFederationConnectList().begin();
+         i != getTimeRegulatingFederationConnectList().end(); ++i) {
+      for (ServerModel::Federate::SecondList::iterator j = i->getTimeRegulatingFederateList().begin();
+           j != i->getTimeRegulatingFederateList().end(); ++j) {
+        if (j->getTimeAdvanceTimeStamp() == _barrierTimeStamp && j->getNextMessageTimeStamp() == _barrierTimeStamp)
+          continue;
+        // Not a lockstep federation, do not block anybody
+        if (j->getTimeAdvanceTimeStamp() != _barrierPreviousTimeStamp || j->getNextMessageTimeStamp() != _barrierPreviousTimeStamp) {
+          releaseTimeAdvanceBarrier();
+          return;
+        }
+        complete = false;
+      }
+    }
+    if (complete)
+      releaseTimeAdvanceBarrier();
+  }
+  void releaseTimeAdvanceBarrier()
+  {
+    if (_barrierFederateHandleCommitIdPairVector.empty())
+      return;
+    SharedPtr<CollectedCommitLowerBoundTimeStampMessage> message = new CollectedCommitLowerBoundTimeStampMessage;
+    message->setFederationHandle(getFederationHandle());
+    message->setTimeStamp(_barrierTimeStamp);
+    message->setCommitType(TimeAdvanceAndNextMessageCommit);
+    message->getFederateHandleCommitIdPairVector().swap(_barrierFederateHandleCommitIdPairVector);
+    broadcastToChildren(message);
+  }
+
   /// The parents policy if we are allowed to get time regulating
   bool _parentPermitTimeRegulation;
+
+  /// The time advance barrier setting as given by the root server
+  bool _timeAdvanceBarrier;
+  /// The commits collected in the time advance barrier
+  VariableLengthData _barrierTimeStamp;
+  VariableLengthData _barrierPreviousTimeStamp;
+  FederateHandleCommitIdPairVector _barrierFederateHandleCommitIdPairVector;
+
+  /// The object instances with values held back by rate reduced subscriptions
+  ObjectInstanceHandleSet _updateRateReducedObjectInstanceHandleSet;
+
+  /// The federation save in progress at the root server
+  std::string _saveLabel;
+  std::map<FederateHandle, SaveStatus> _federateHandleSaveStatusMap;
+  bool _saveSuccessful;
+  SaveFailureReason _saveFailureReason;
+  SharedPtr<FederationSnapshotWriter> _federationSnapshotWriter;
+  /// The writer posted that it is done
+  bool _federationSnapshotWritten;
+  /// The save finished before the writer, so its file is removed
+  bool _federationSnapshotAbandoned;
+
+  /// The federation restore in progress at the root server
+  std::string _restoreLabel;
+  std::map<FederateHandle, RestoreStatus> _federateHandleRestoreStatusMap;
+  bool _restoreSuccessful;
+  RestoreFailureReason _restoreFailureReason;
 };
 
 class OPENRTI_LOCAL ServerMessageDispatcher : public ServerModel::Node {
@@ -1948,6 +3099,14 @@ public:
     broadcastToChildren(message);
   }
 
+  // Metrics requests are answered by the server node that is asked
+  void accept(const ConnectHandle& connectHandle, const MetricsRequestMessage* message)
+  {
+    SharedPtr<MetricsResponseMessage> response = new MetricsResponseMessage;
+    response->setMetrics(Metrics::instance().str());
+    send(connectHandle, response);
+  }
+
   // Create messages
   void acceptAsRoot(const ConnectHandle& connectHandle, const CreateFederationExecutionRequestMessage* message)
   {
@@ -2368,6 +3527,42 @@ public:
   void accept(const ConnectHandle& connectHandle, const FederationSynchronizedMessage* message)
   { acceptDownstreamFederationMessage(connectHandle, message); }
 
+  // Federation save and restore
+  void accept(const ConnectHandle& connectHandle, const RequestFederationSaveMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const InitiateFederateSaveMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const FederateSaveBegunMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const FederateSaveCompleteMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const FederationSavedMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const AbortFederationSaveMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const QueryFederationSaveStatusRequestMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const QueryFederationSaveStatusResponseMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const RequestFederationRestoreMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const RequestFederationRestoreResponseMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const FederationRestoreBegunMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const InitiateFederateRestoreMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const FederateRestoreCompleteMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const FederationRestoredMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const AbortFederationRestoreMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const QueryFederationRestoreStatusRequestMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const QueryFederationRestoreStatusResponseMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+
   // Time Management
   void accept(const ConnectHandle& connectHandle, const EnableTimeRegulationRequestMessage* message)
   { acceptFederationMessage(connectHandle, message); }
@@ -2377,6 +3572,8 @@ public:
   { acceptFederationMessage(connectHandle, message); }
   void accept(const ConnectHandle& connectHandle, const CommitLowerBoundTimeStampMessage* message)
   { acceptFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const CollectedCommitLowerBoundTimeStampMessage* message)
+  { acceptFederationMessage(connectHandle, message); }
   void accept(const ConnectHandle& connectHandle, const CommitLowerBoundTimeStampResponseMessage* message)
   { acceptFederationMessage(connectHandle, message); }
   void accept(const ConnectHandle& connectHandle, const LockedByNextMessageRequestMessage* message)
@@ -2423,6 +3620,8 @@ public:
   // Object instance messages
   void accept(const ConnectHandle& connectHandle, const InsertObjectInstanceMessage* message)
   { acceptFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const InsertMultipleObjectInstancesMessage* message)
+  { acceptFederationMessage(connectHandle, message); }
   void accept(const ConnectHandle& connectHandle, const DeleteObjectInstanceMessage* message)
   { acceptFederationMessage(connectHandle, message); }
   void accept(const ConnectHandle& connectHandle, const TimeStampedDeleteObjectInstanceMessage* message)
@@ -2437,6 +3636,8 @@ public:
   { acceptFederationMessage(connectHandle, message); }
   void accept(const ConnectHandle& connectHandle, const TimeStampedInteractionMessage* message)
   { acceptFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const MessageRetractionMessage* message)
+  { acceptFederationMessage(connectHandle, message); }
 
   // AttributeUpdateRequest messages
   void accept(const ConnectHandle& connectHandle, const RequestAttributeUpdateMessage* message)
@@ -2444,6 +3645,24 @@ public:
   void accept(const ConnectHandle& connectHandle, const RequestClassAttributeUpdateMessage* message)
   { acceptFederationMessage(connectHandle, message); }
 
+  // Transportation type messages
+  void accept(const ConnectHandle& connectHandle, const ChangeAttributeTransportationTypeRequestMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const ChangeAttributeTransportationTypeResponseMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const ChangeInteractionTransportationTypeRequestMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const ChangeInteractionTransportationTypeResponseMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const QueryAttributeTransportationTypeRequestMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const QueryAttributeTransportationTypeResponseMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const QueryInteractionTransportationTypeRequestMessage* message)
+  { acceptUpstreamFederationMessage(connectHandle, message); }
+  void accept(const ConnectHandle& connectHandle, const QueryInteractionTransportationTypeResponseMessage* message)
+  { acceptDownstreamFederationMessage(connectHandle, message); }
+
   void accept(const ConnectHandle&, const AbstractMessage* message)
   { throw MessageError("Received unexpected message???"); }
 
@@ -2463,6 +3682,7 @@ public:
   void dispatch(const AbstractMessage& message, const ConnectHandle& connectHandle)
   {
     Log(ServerMessage, Debug3) << getServerPath() << ": Received " << message << "!" << std::endl;
+    message.stampMessageTrace(MessageTrace::RoutePoint);
     try {
       message.dispatchFunctor(DispatchFunctor(*this, connectHandle));
     } catch (MessageError& messageError) {
@@ -2482,6 +3702,17 @@ public:
     getServerOptions().setParentOptionMap(options);
     return nodeConnect->getConnectHandle();
   }
+  /// Called from the event loop at the time requested with setTimeout
+  void timeout(const Clock& now)
+  {
+    Clock timeout = Clock::max();
+    for (ServerModel::Federation::HandleMap::iterator i = getFederationHandleFederationMap().begin();
+         i != getFederationHandleFederationMap().end(); ++i)
+      timeout = std::min(timeout, static_cast<FederationServer*>(i.get())->flushUpdateRateReductions(now));
+    if (timeout != Clock::max())
+      setTimeout(timeout);
+  }
+
   void removeConnect(const ConnectHandle& connectHandle)
   {
     bool isParent = isParentConnect(connectHandle);
@@ -2570,6 +3801,16 @@ private:
   ConnectHandleMessagePairList _pendingMessageList;
 };
 
+void
+FederationServerSnapshotWriter::written()
+{
+  ServerModel::Federation* federation = _serverNode.getFederation(_federationHandle);
+  if (federation)
+    static_cast<FederationServer*>(federation)->federationSnapshotWritten(*this);
+  else
+    commit(false);
+}
+
 ServerNode::ServerNode() :
   _serverMessageDispatcher(new ServerMessageDispatcher)
 {
@@ -2635,4 +3876,16 @@ ServerNode::_dispatchMessage(const AbstractMessage* message, const ConnectHandle
   _serverMessageDispatcher->dispatch(*message, connectHandle);
 }
 
+void
+ServerNode::_setServerLoop(const SharedPtr<ServerLoop>& serverLoop)
+{
+  _serverMessageDispatcher->setServerLoop(serverLoop);
+}
+
+void
+ServerNode::_timeout(const Clock& now)
+{
+  _serverMessageDispatcher->timeout(now);
+}
+
 } // namespace OpenRTI
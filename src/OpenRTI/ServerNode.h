@@ -54,6 +54,8 @@ public:
   virtual ConnectHandle _insertParentConnect(const SharedPtr<AbstractMessageSender>& messageSender, const StringStringListMap& parentOptions);
   virtual void _eraseConnect(const ConnectHandle& connectHandle);
   virtual void _dispatchMessage(const AbstractMessage* message, const ConnectHandle& connectHandle);
+  virtual void _setServerLoop(const SharedPtr<ServerLoop>& serverLoop);
+  virtual void _timeout(const Clock& now);
 
 private:
   ServerNode(const ServerNode&);
@@ -33,7 +33,8 @@ class OPENRTI_API ServerOptions : public Referenced {
 public:
   ServerOptions() :
     _preferCompression(true), // Default to compression for now FIXME
-    _permitTimeRegulation(true)
+    _permitTimeRegulation(true),
+    _timeAdvanceBarrier(false)
   { }
 
   const std::string& getServerName() const
@@ -67,6 +68,12 @@ public:
   bool getPermitTimeRegulation(/*FIXME add something where we can distinguish which client connect*/) const
   { return _permitTimeRegulation; }
 
+  bool getTimeAdvanceBarrier() const
+  { return _timeAdvanceBarrier; }
+
+  const std::string& getSaveDirectory() const
+  { return _saveDirectory; }
+
 private:
   void _setServerPath(const StringList& serverPath)
   {
@@ -98,6 +105,12 @@ public:
   /// See if this server permits us to have time regulating clients
   bool _permitTimeRegulation;
 
+  /// Collect the time advance commits of lockstep federations at the root server
+  bool _timeAdvanceBarrier;
+
+  /// Where the root server writes federation saves, empty for the current directory
+  std::string _saveDirectory;
+
   /// Connection options
   // bool _enableUDP;
   // bool _enableMulticast;
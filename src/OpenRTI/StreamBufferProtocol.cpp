@@ -19,6 +19,7 @@
 
 #include "StreamBufferProtocol.h"
 
+#include <cstring>
 #include "LogStream.h"
 
 namespace OpenRTI {
@@ -102,15 +103,7 @@ StreamBufferProtocol::write(AbstractProtocolSocket& protocolSocket)
     }
 
     // We are ready with this packet, reset state
-    for (std::list<Buffer::iterator>::iterator i = _outputScratchBufferList.begin();
-         i != _outputScratchBufferList.end(); ++i) {
-      _scratchPool.splice(_scratchPool.end(), _outputBuffer, *i);
-    }
-
-    _iteratorPool.splice(_iteratorPool.end(), _outputScratchBufferList);
-    _outputBuffer.clear();
-
-    _outputIterator = _outputBuffer.byte_begin();
+    resetOutputBuffer();
   }
 }
 
@@ -164,6 +157,23 @@ StreamBufferProtocol::addWriteBuffer(const VariableLengthData& value)
     _outputBuffer.push_back(value);
 }
 
+void
+StreamBufferProtocol::takeOutputBuffer(VariableLengthData& variableLengthData)
+{
+  size_t size = 0;
+  for (Buffer::const_iterator i = _outputBuffer.begin(); i != _outputBuffer.end(); ++i)
+    size += i->size();
+  variableLengthData.resize(size);
+  size_t offset = 0;
+  for (Buffer::const_iterator i = _outputBuffer.begin(); i != _outputBuffer.end(); ++i) {
+    if (!i->size())
+      continue;
+    std::memcpy(variableLengthData.charData() + offset, i->charData(), i->size());
+    offset += i->size();
+  }
+  resetOutputBuffer();
+}
+
 VariableLengthData&
 StreamBufferProtocol::addScratchWriteBuffer()
 {
@@ -187,4 +197,18 @@ StreamBufferProtocol::addScratchWriteBuffer()
   return _outputBuffer.back();
 }
 
+void
+StreamBufferProtocol::resetOutputBuffer()
+{
+  for (std::list<Buffer::iterator>::iterator i = _outputScratchBufferList.begin();
+       i != _outputScratchBufferList.end(); ++i) {
+    _scratchPool.splice(_scratchPool.end(), _outputBuffer, *i);
+  }
+
+  _iteratorPool.splice(_iteratorPool.end(), _outputScratchBufferList);
+  _outputBuffer.clear();
+
+  _outputIterator = _outputBuffer.byte_begin();
+}
+
 } // namespace OpenRTI
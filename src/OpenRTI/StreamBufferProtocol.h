@@ -52,7 +52,16 @@ public:
   void addWriteBuffer(const VariableLengthData& value);
   VariableLengthData& addScratchWriteBuffer();
 
+protected:
+  const Buffer& getOutputBuffer() const
+  { return _outputBuffer; }
+  /// Move the not yet sent output buffer into a single contiguous buffer.
+  /// Must be called before any byte of the output buffer is sent.
+  void takeOutputBuffer(VariableLengthData& variableLengthData);
+
 private:
+  void resetOutputBuffer();
+
   // Buffer for the incomming data
   Buffer _inputBuffer;
   Buffer::byte_iterator _inputIterator;
@@ -25,6 +25,8 @@
 #include "FederateHandleLowerBoundTimeStampMap.h"
 #include "IntrusiveList.h"
 #include "IntrusiveUnorderedMap.h"
+#include "Metrics.h"
+#include "TimeStampOrderQueue.h"
 
 namespace OpenRTI {
 
@@ -57,6 +59,9 @@ public:
   TemplateTimeManagement(const LogicalTimeFactory& logicalTimeFactory) :
     _timeAdvanceToBeScheduled(false),
     _commitId(-17), // make sure we test wraparound regularily
+    _commitCoalescing(false),
+    _timeAdvanceBarrier(false),
+    _restoreInProgress(false),
     _logicalTimeFactory(logicalTimeFactory)
   {
     _logicalTime.first = _logicalTimeFactory.initialLogicalTime();
@@ -71,12 +76,14 @@ public:
   }
   virtual ~TemplateTimeManagement()
   {
-    while (!_logicalTimeMessageListMap.empty()) {
-      _logicalTimeMessageListMap.begin()->second.clear();
-      _logicalTimeMessageListMap.erase(_logicalTimeMessageListMap.begin());
-    }
-    _receiveOrderMessages.clear();
-    _messageListPool.clear();
+    // The list elements are owned by the slabs
+    _timeStampOrderQueue.unlink();
+    _receiveOrderMessages.unlink();
+    _messageListPool.unlink();
+    _messageRetractionHandleMessageListElementMap.unlink();
+    for (typename std::vector<_MessageListElement*>::iterator i = _messageListElementSlabs.begin();
+         i != _messageListElementSlabs.end(); ++i)
+      delete [] *i;
   }
 
   /// This is: don't do time advance to the past
@@ -95,6 +102,58 @@ public:
       return logicalTime < _logicalTimeFactory.getLogicalTime(_outboundLowerBoundTimeStamp.first);
     }
   }
+  bool logicalTimeAlreadyPassed(const LogicalTime& logicalTime) const
+  {
+    if (_outboundLowerBoundTimeStamp.second) {
+      return logicalTime <= _outboundLowerBoundTimeStamp.first;
+    } else {
+      return logicalTime < _outboundLowerBoundTimeStamp.first;
+    }
+  }
+
+  virtual void insertRetractableMessage(const MessageRetractionHandle& messageRetractionHandle, const NativeLogicalTime& nativeLogicalTime)
+  {
+    _eraseUnretractableMessages();
+    uint32_t serial = messageRetractionHandle.getSerial();
+    typename RetractableMessageMap::iterator i = _retractableMessageMap.find(serial);
+    if (i != _retractableMessageMap.end()) {
+      _retractableMessageTimeStampMap.erase(i->second);
+      _retractableMessageMap.erase(i);
+    }
+    LogicalTime logicalTime = _logicalTimeFactory.getLogicalTime(nativeLogicalTime);
+    _retractableMessageMap[serial] = _retractableMessageTimeStampMap.insert(std::make_pair(logicalTime, serial));
+  }
+
+  virtual bool retract(InternalAmbassador& ambassador, const MessageRetractionHandle& messageRetractionHandle)
+  {
+    _eraseUnretractableMessages();
+    typename RetractableMessageMap::iterator i = _retractableMessageMap.find(messageRetractionHandle.getSerial());
+    if (i == _retractableMessageMap.end())
+      return false;
+    // As long as we could still send a message with this time stamp,
+    // no other federate can have delivered it in time stamp order.
+    if (logicalTimeAlreadyPassed(i->second->first))
+      return false;
+    _retractableMessageTimeStampMap.erase(i->second);
+    _retractableMessageMap.erase(i);
+
+    SharedPtr<MessageRetractionMessage> request;
+    request = new MessageRetractionMessage;
+    request->setFederationHandle(ambassador.getFederate()->getFederationHandle());
+    request->setMessageRetractionHandle(messageRetractionHandle);
+    ambassador.send(request);
+    return true;
+  }
+
+  // Throw out all messages with a time stamp the outbound lower bound time stamp has already passed.
+  // These are walked in time stamp order, so only the ones to be thrown out are visited.
+  void _eraseUnretractableMessages()
+  {
+    while (!_retractableMessageTimeStampMap.empty() && logicalTimeAlreadyPassed(_retractableMessageTimeStampMap.begin()->first)) {
+      _retractableMessageMap.erase(_retractableMessageTimeStampMap.begin()->second);
+      _retractableMessageTimeStampMap.erase(_retractableMessageTimeStampMap.begin());
+    }
+  }
 
   virtual void enableTimeRegulation(InternalAmbassador& ambassador, const NativeLogicalTimeInterval& nativeLookahead)
   {
@@ -253,10 +312,10 @@ public:
 
     } else if (InternalTimeManagement::getIsAnyNextMessageMode()) {
       if (InternalTimeManagement::getTimeConstrainedEnabled()) {
-        if (!_logicalTimeMessageListMap.empty()) {
-          if (_logicalTimeMessageListMap.begin()->first.first < _pendingLogicalTime.first) {
-            OpenRTIAssert(_logicalTime.first <= _logicalTimeMessageListMap.begin()->first.first);
-            _pendingLogicalTime.first = _logicalTimeMessageListMap.begin()->first.first;
+        if (!_timeStampOrderQueue.empty()) {
+          if (_timeStampOrderQueue.frontKey().first < _pendingLogicalTime.first) {
+            OpenRTIAssert(_logicalTime.first <= _timeStampOrderQueue.frontKey().first);
+            _pendingLogicalTime.first = _timeStampOrderQueue.frontKey().first;
           }
         }
 
@@ -275,10 +334,10 @@ public:
       }
     } else if (InternalTimeManagement::getFlushQueueMode()) {
       if (InternalTimeManagement::getTimeConstrainedEnabled()) {
-        if (!_logicalTimeMessageListMap.empty()) {
-          if (_logicalTimeMessageListMap.begin()->first.first < _pendingLogicalTime.first) {
-            OpenRTIAssert(_logicalTime.first <= _logicalTimeMessageListMap.begin()->first.first);
-            _pendingLogicalTime.first = _logicalTimeMessageListMap.begin()->first.first;
+        if (!_timeStampOrderQueue.empty()) {
+          if (_timeStampOrderQueue.frontKey().first < _pendingLogicalTime.first) {
+            OpenRTIAssert(_logicalTime.first <= _timeStampOrderQueue.frontKey().first);
+            _pendingLogicalTime.first = _timeStampOrderQueue.frontKey().first;
           }
         }
       }
@@ -324,7 +383,7 @@ public:
 
   virtual bool queryLITS(InternalAmbassador& ambassador, NativeLogicalTime& logicalTime)
   {
-    if (_logicalTimeMessageListMap.empty()) {
+    if (_timeStampOrderQueue.empty()) {
       if (_federateLowerBoundMap.empty()) {
         return false;
       } else {
@@ -333,13 +392,13 @@ public:
       }
     } else {
       if (_federateLowerBoundMap.empty()) {
-        logicalTime = _logicalTimeFactory.getLogicalTime(_logicalTimeMessageListMap.begin()->first.first);
+        logicalTime = _logicalTimeFactory.getLogicalTime(_timeStampOrderQueue.frontKey().first);
         return true;
       } else {
-        if (_federateLowerBoundMap.getGALT() < _logicalTimeMessageListMap.begin()->first.first)
+        if (_federateLowerBoundMap.getGALT() < _timeStampOrderQueue.frontKey().first)
           logicalTime = _logicalTimeFactory.getLogicalTime(_federateLowerBoundMap.getGALT());
         else
-          logicalTime = _logicalTimeFactory.getLogicalTime(_logicalTimeMessageListMap.begin()->first.first);
+          logicalTime = _logicalTimeFactory.getLogicalTime(_timeStampOrderQueue.frontKey().first);
         return true;
       }
     }
@@ -520,6 +579,11 @@ public:
 
   virtual void acceptInternalMessage(InternalAmbassador& ambassador, const CommitLowerBoundTimeStampMessage& message)
   {
+    // In time advance barrier mode we also see our own commits and commits
+    // of federates that already disabled time regulation
+    if (_timeAdvanceBarrier && !_federateLowerBoundMap.contains(message.getFederateHandle()))
+      return;
+
     LogicalTime logicalTime = _logicalTimeFactory.decodeLogicalTime(message.getTimeStamp());
 
     bool previousLockedByNextMessage = getLockedByNextMessage();
@@ -536,6 +600,29 @@ public:
 
     checkForPendingTimeAdvance(ambassador);
   }
+  virtual void acceptInternalMessage(InternalAmbassador& ambassador, const CollectedCommitLowerBoundTimeStampMessage& message)
+  {
+    LogicalTime logicalTime = _logicalTimeFactory.decodeLogicalTime(message.getTimeStamp());
+
+    bool previousLockedByNextMessage = getLockedByNextMessage();
+
+    for (FederateHandleCommitIdPairVector::const_iterator i = message.getFederateHandleCommitIdPairVector().begin();
+         i != message.getFederateHandleCommitIdPairVector().end(); ++i) {
+      // Collected commits include our own and may be overtaken by a disable time regulation
+      if (!_federateLowerBoundMap.contains(i->first))
+        continue;
+      std::pair<bool, bool> changePair = _federateLowerBoundMap.commit(i->first, logicalTime, message.getCommitType(), i->second);
+      if (changePair.second)
+        _sendCommitLowerBoundTimeStampResponse(ambassador, i->first, i->second);
+    }
+
+    bool lockedByNextMessage = getLockedByNextMessage();
+    if (previousLockedByNextMessage != lockedByNextMessage) {
+      _sendLockedByNextMessageRequest(ambassador, lockedByNextMessage);
+    }
+
+    checkForPendingTimeAdvance(ambassador);
+  }
   virtual void acceptInternalMessage(InternalAmbassador& ambassador, const CommitLowerBoundTimeStampResponseMessage& message)
   {
     bool previousLockedByNextMessage = getLockedByNextMessage();
@@ -563,8 +650,41 @@ public:
     checkForPendingTimeAdvance(ambassador);
   }
 
+  virtual void acceptInternalMessage(InternalAmbassador& ambassador, const MessageRetractionMessage& message)
+  {
+    // Throw out the retracted messages that are not yet delivered.
+    // Time stamp order messages that are already delivered in receive order, since this federate
+    // is not time constrained, are not tracked and stay delivered. The federate did not see
+    // the retraction handle with these and cannot make sense of a request retraction callback.
+    unsigned count = 0;
+    typename _MessageRetractionHandleMessageListElementMap::iterator i;
+    i = _messageRetractionHandleMessageListElementMap.find(message.getMessageRetractionHandle());
+    while (i != _messageRetractionHandleMessageListElementMap.end() && i->getMessageRetractionHandle() == message.getMessageRetractionHandle()) {
+      _MessageListElement& messageListElement = *i++;
+      messageListElement.unlink();
+      messageListElement._message.clear();
+      _messageListPool.push_back(messageListElement);
+      ++count;
+    }
+    if (count)
+      Metrics::instance().getRetractedMessages().add(count);
+
+    // Messages that are delivered ahead of the current logical time by a flush queue request
+    // need to be undone by the federate
+    typename FlushQueueDeliveredMessageMap::iterator j = _flushQueueDeliveredMessageMap.find(message.getMessageRetractionHandle());
+    if (j == _flushQueueDeliveredMessageMap.end())
+      return;
+    bool requestRetraction = _logicalTime.first < j->second;
+    _flushQueueDeliveredMessageMap.erase(j);
+    if (requestRetraction)
+      ambassador.queueCallback(message);
+  }
+
   virtual void queueTimeStampedMessage(InternalAmbassador& ambassador, const VariableLengthData& timeStamp, const AbstractMessage& message)
   {
+    // Messages sent before the federation restore are from an abandoned past
+    if (_restoreInProgress)
+      return;
     queueTimeStampedMessage(ambassador, _logicalTimeFactory.decodeLogicalTime(timeStamp), message);
   }
   void queueTimeStampedMessage(InternalAmbassador& ambassador, const LogicalTime& logicalTime, const AbstractMessage& message)
@@ -603,49 +723,137 @@ public:
 
         checkForPendingTimeAdvance(ambassador);
 
-        OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || _pendingLogicalTime.first <= _logicalTimeMessageListMap.begin()->first.first);
+        OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || _pendingLogicalTime.first <= _timeStampOrderQueue.frontKey().first);
       }
     }
   }
   void queueTimeStampedMessage(const LogicalTimePair& logicalTimePair, const AbstractMessage& message)
   {
-    if (_messageListPool.empty()) {
-      _MessageListElement* messageListElement = new _MessageListElement(&message);
-      _logicalTimeMessageListMap[logicalTimePair].push_back(*messageListElement);
-      if (message.getObjectInstanceHandleForMessage().valid()) {
-        messageListElement->setObjectInstanceHandle(message.getObjectInstanceHandleForMessage());
-        _objectInstanceHandleMessageListElementMap.insert(*messageListElement);
-      }
-    } else {
-      _MessageListElement& messageListElement = _messageListPool.front();
-      messageListElement.unlink();
-      messageListElement._message = &message;
-      _logicalTimeMessageListMap[logicalTimePair].push_back(messageListElement);
-      if (message.getObjectInstanceHandleForMessage().valid()) {
-        messageListElement.setObjectInstanceHandle(message.getObjectInstanceHandleForMessage());
-        _objectInstanceHandleMessageListElementMap.insert(messageListElement);
-      }
-    }
+    _timeStampOrderQueue.push(logicalTimePair, _getMessageListElement(message));
   }
   virtual void queueReceiveOrderMessage(InternalAmbassador& ambassador, const AbstractMessage& message)
   {
-    if (_messageListPool.empty()) {
-      _MessageListElement* messageListElement = new _MessageListElement(&message);
-      _receiveOrderMessages.push_back(*messageListElement);
-      if (message.getObjectInstanceHandleForMessage().valid()) {
-        messageListElement->setObjectInstanceHandle(message.getObjectInstanceHandleForMessage());
-        _objectInstanceHandleMessageListElementMap.insert(*messageListElement);
+    // Receive order passels share the retraction handle of their update, but only the
+    // time stamp order passels are retracted. So, do not index these by the handle.
+    _receiveOrderMessages.push_back(_getMessageListElement(message, false));
+  }
+
+  virtual bool queueTimeStampedSave(InternalAmbassador& ambassador, const InitiateFederateSaveMessage& message)
+  {
+    if (!InternalTimeManagement::getTimeConstrainedEnabled()) {
+      ambassador.queueCallback(message);
+      return true;
+    }
+    LogicalTime logicalTime = _logicalTimeFactory.decodeLogicalTime(message.getTimeStamp());
+    if (LogicalTimePair(logicalTime, -1) < _logicalTime)
+      return false;
+    // Ordered like a time stamp order message, so the federate is instructed
+    // once it advances to the save time
+    queueTimeStampedMessage(ambassador, LogicalTimePair(logicalTime, -1), message);
+    return true;
+  }
+
+  virtual void saveState(const std::string& label)
+  {
+    _pendingSaveLabel = label;
+    _pendingSavedState._logicalTime = _logicalTime;
+    // A pending time advance is not part of the saved state
+    if (InternalTimeManagement::getTimeAdvancePending())
+      _pendingSavedState._outboundLowerBoundTimeStamp = _lastOutboundLowerBoundTimeStamp;
+    else
+      _pendingSavedState._outboundLowerBoundTimeStamp = _outboundLowerBoundTimeStamp;
+    _pendingSavedState._currentLookahead = _currentLookahead;
+    _pendingSavedState._targetLookahead = _targetLookahead;
+    _pendingSavedState._timeRegulationMode = InternalTimeManagement::getTimeRegulationMode();
+    _pendingSavedState._timeConstrainedMode = InternalTimeManagement::getTimeConstrainedMode();
+
+    // The messages are immutable, so just keep a reference to the queued ones.
+    // Internal callbacks are scheduled with a non negative second field and are not saved.
+    _pendingSavedState._messageVector.clear();
+    typename _TimeStampOrderQueue::KeyListPairVector keyListPairVector;
+    _timeStampOrderQueue.getKeyListPairVector(keyListPairVector);
+    for (typename _TimeStampOrderQueue::KeyListPairVector::const_iterator i = keyListPairVector.begin();
+         i != keyListPairVector.end(); ++i) {
+      if (0 <= i->first.second)
+        continue;
+      for (typename _MessageList::const_iterator j = i->second->begin(); j != i->second->end(); ++j) {
+        if (dynamic_cast<const InitiateFederateSaveMessage*>(j->_message.get()))
+          continue;
+        _pendingSavedState._messageVector.push_back(_SavedMessage(i->first, j->_message));
       }
-    } else {
-      _MessageListElement& messageListElement = _messageListPool.front();
+    }
+  }
+
+  virtual void acceptInternalMessage(InternalAmbassador& ambassador, const FederationSavedMessage& message)
+  {
+    if (_pendingSaveLabel != message.getLabel())
+      return;
+    // A successful save replaces the previous one, the saved messages are not kept longer than needed
+    if (message.getSuccessful()) {
+      _labelSavedStateMap.clear();
+      _labelSavedStateMap[_pendingSaveLabel] = _pendingSavedState;
+    }
+    _pendingSaveLabel.clear();
+    _pendingSavedState._messageVector.clear();
+  }
+
+  virtual bool restoreState(InternalAmbassador& ambassador, const std::string& label)
+  {
+    typename _LabelSavedStateMap::const_iterator i = _labelSavedStateMap.find(label);
+    if (i == _labelSavedStateMap.end())
+      return false;
+    const _SavedState& savedState = i->second;
+    if (InternalTimeManagement::getTimeRegulationMode() != savedState._timeRegulationMode)
+      return false;
+    if (InternalTimeManagement::getTimeConstrainedMode() != savedState._timeConstrainedMode)
+      return false;
+    if (InternalTimeManagement::getTimeRegulationEnablePending() || InternalTimeManagement::getTimeConstrainedEnablePending())
+      return false;
+
+    bool previousLockedByNextMessage = getLockedByNextMessage();
+
+    // Drop everything queued, also a pending time advance
+    _timeStampOrderQueue.unlink();
+    while (!_receiveOrderMessages.empty()) {
+      _MessageListElement& messageListElement = _receiveOrderMessages.front();
       messageListElement.unlink();
-      messageListElement._message = &message;
-      _receiveOrderMessages.push_back(messageListElement);
-      if (message.getObjectInstanceHandleForMessage().valid()) {
-        messageListElement.setObjectInstanceHandle(message.getObjectInstanceHandleForMessage());
-        _objectInstanceHandleMessageListElementMap.insert(messageListElement);
-      }
+      messageListElement._message.clear();
+      _messageListPool.push_back(messageListElement);
+    }
+    _retractableMessageMap.clear();
+    _retractableMessageTimeStampMap.clear();
+    _flushQueueDeliveredMessageMap.clear();
+    _timeAdvanceToBeScheduled = false;
+    InternalTimeManagement::setTimeAdvanceMode(InternalTimeManagement::TimeAdvanceGranted);
+
+    _logicalTime = savedState._logicalTime;
+    _pendingLogicalTime = _logicalTime;
+    _outboundLowerBoundTimeStamp = savedState._outboundLowerBoundTimeStamp;
+    _lastOutboundLowerBoundTimeStamp = _outboundLowerBoundTimeStamp;
+    _currentLookahead = savedState._currentLookahead;
+    _targetLookahead = savedState._targetLookahead;
+
+    // The other federates must accept the commit going back in time,
+    // keep the commit id so nobody expects a next message response.
+    if (InternalTimeManagement::getTimeRegulationEnabled()) {
+      _committedOutboundLowerBoundTimeStamp = _toLogicalTime(_outboundLowerBoundTimeStamp);
+      _committedNextMessageLowerBoundTimeStamp = _committedOutboundLowerBoundTimeStamp;
+      _sendCommitLowerBoundTimeStamp(ambassador, _committedOutboundLowerBoundTimeStamp, TimeAdvanceAndNextMessageCommit);
     }
+    if (previousLockedByNextMessage != getLockedByNextMessage())
+      _sendLockedByNextMessageRequest(ambassador, getLockedByNextMessage());
+
+    for (typename _SavedMessageVector::const_iterator j = savedState._messageVector.begin();
+         j != savedState._messageVector.end(); ++j)
+      queueTimeStampedMessage(j->first, *j->second);
+
+    _restoreInProgress = true;
+    return true;
+  }
+
+  virtual void acceptInternalMessage(InternalAmbassador& ambassador, const FederationRestoredMessage& message)
+  {
+    _restoreInProgress = false;
   }
 
   void removeFederateFromTimeManagement(InternalAmbassador& ambassador, const FederateHandle& federateHandle)
@@ -719,7 +927,7 @@ public:
       return;
     if (InternalTimeManagement::getIsAnyNextMessageMode()) {
 
-      OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || _logicalTimeMessageListMap.empty() || _pendingLogicalTime.first <= _logicalTimeMessageListMap.begin()->first.first);
+      OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || _timeStampOrderQueue.empty() || _pendingLogicalTime.first <= _timeStampOrderQueue.frontKey().first);
 
       if (allowNextMessage && getIsSaveToAdvanceToNextMessage()) {
         if (canAdvanceToNextMessage(LogicalTimePair(_pendingLogicalTime.first, 0))) {
@@ -757,7 +965,7 @@ public:
 
   void checkForPendingFlushQueue()
   {
-    if (_logicalTimeMessageListMap.empty() && InternalTimeManagement::getFlushQueueMode() && _timeAdvanceToBeScheduled) {
+    if (_timeStampOrderQueue.empty() && InternalTimeManagement::getFlushQueueMode() && _timeAdvanceToBeScheduled) {
       OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || canAdvanceTo(_pendingLogicalTime));
       _timeAdvanceToBeScheduled = false;
       SharedPtr<TimeAdvanceGrantedMessage> message = new TimeAdvanceGrantedMessage;
@@ -826,6 +1034,15 @@ public:
     }
     if (!commitType)
       return;
+    // A plain time advance commit that does not change anything the other federates decide on
+    // is just deferred. Each commit we receive ends up in checkForPendingTimeAdvance which
+    // recomputes and retries the commit. The federates with the two lowest commits never defer,
+    // so the federation still advances. Leaving next message mode is never deferred.
+    if (commitType == TimeAdvanceCommit && _commitCoalescing && logicalTime < _committedNextMessageLowerBoundTimeStamp &&
+        _federateLowerBoundMap.getIsTimeAdvanceCommitInvisible(_committedOutboundLowerBoundTimeStamp, logicalTime)) {
+      Metrics::instance().getDeferredCommitLowerBoundTimeStamps().inc();
+      return;
+    }
     _sendCommitLowerBoundTimeStamp(ambassador, logicalTime, commitType);
   }
 
@@ -859,6 +1076,7 @@ public:
     request->setCommitType(commitType);
     request->setCommitId(_commitId);
     ambassador.send(request);
+    Metrics::instance().getTimeManagementMessages().inc();
   }
 
   void _sendCommitLowerBoundTimeStampResponse(InternalAmbassador& ambassador)
@@ -884,6 +1102,7 @@ public:
     request->setCommitId(commitId);
     request->setSendingFederateHandle(ambassador.getFederate()->getFederateHandle());
     ambassador.send(request);
+    Metrics::instance().getTimeManagementMessages().inc();
   }
 
   void _sendLockedByNextMessageRequest(InternalAmbassador& ambassador, bool lockedByNextMessage)
@@ -894,6 +1113,7 @@ public:
     request->setLockedByNextMessage(lockedByNextMessage);
     request->setSendingFederateHandle(ambassador.getFederate()->getFederateHandle());
     ambassador.send(request);
+    Metrics::instance().getTimeManagementMessages().inc();
   }
 
   int _getPendingTimeSecondField() const
@@ -933,7 +1153,7 @@ public:
   {
     OpenRTIAssert(InternalTimeManagement::getTimeConstrainedEnablePending());
     OpenRTIAssert(canAdvanceTo(_pendingLogicalTime));
-    OpenRTIAssert(_logicalTimeMessageListMap.empty() || _pendingLogicalTime <= _logicalTimeMessageListMap.begin()->first);
+    OpenRTIAssert(_timeStampOrderQueue.empty() || _pendingLogicalTime <= _timeStampOrderQueue.frontKey());
     OpenRTIAssert(!InternalTimeManagement::getTimeRegulationEnabled() || _committedOutboundLowerBoundTimeStamp <= _toLogicalTime(_outboundLowerBoundTimeStamp));
 
     InternalTimeManagement::setTimeConstrainedMode(InternalTimeManagement::TimeConstrainedEnabled);
@@ -944,7 +1164,7 @@ public:
   {
     OpenRTIAssert(InternalTimeManagement::getTimeRegulationEnablePending());
     OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || canAdvanceTo(_pendingLogicalTime));
-    OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || _logicalTimeMessageListMap.empty() || _pendingLogicalTime <= _logicalTimeMessageListMap.begin()->first);
+    OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || _timeStampOrderQueue.empty() || _pendingLogicalTime <= _timeStampOrderQueue.frontKey());
     OpenRTIAssert(_committedOutboundLowerBoundTimeStamp <= _toLogicalTime(_outboundLowerBoundTimeStamp));
 
     InternalTimeManagement::setTimeRegulationMode(InternalTimeManagement::TimeRegulationEnabled);
@@ -959,7 +1179,7 @@ public:
   {
     OpenRTIAssert(InternalTimeManagement::getTimeAdvancePending());
     OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || canAdvanceTo(_pendingLogicalTime));
-    OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || _logicalTimeMessageListMap.empty() || _pendingLogicalTime <= _logicalTimeMessageListMap.begin()->first);
+    OpenRTIAssert(!InternalTimeManagement::getTimeConstrainedEnabled() || _timeStampOrderQueue.empty() || _pendingLogicalTime <= _timeStampOrderQueue.frontKey());
     OpenRTIAssert(!InternalTimeManagement::getTimeRegulationEnabled() || _committedOutboundLowerBoundTimeStamp <= _toLogicalTime(_outboundLowerBoundTimeStamp));
     OpenRTIAssert(!_timeAdvanceToBeScheduled);
 
@@ -971,22 +1191,49 @@ public:
 
     _logicalTime = _pendingLogicalTime;
     InternalTimeManagement::setTimeAdvanceMode(InternalTimeManagement::TimeAdvanceGranted);
+
+    // Messages delivered by a flush queue request that are not ahead of the granted time can no longer be retracted.
+    // This is only non empty if flush queue requests are used.
+    typename FlushQueueDeliveredMessageMap::iterator i = _flushQueueDeliveredMessageMap.begin();
+    while (i != _flushQueueDeliveredMessageMap.end()) {
+      if (_logicalTime.first < i->second)
+        ++i;
+      else
+        _flushQueueDeliveredMessageMap.erase(i++);
+    }
+
     ambassador.timeAdvanceGrant(_logicalTimeFactory.getLogicalTime(_logicalTime.first));
   }
 
+  virtual void acceptCallbackMessage(Ambassador<T>& ambassador, const InitiateFederateSaveMessage& message)
+  {
+    LogicalTime logicalTime = _logicalTimeFactory.decodeLogicalTime(message.getTimeStamp());
+    ambassador.initiateFederateSave(message.getLabel(), _logicalTimeFactory.getLogicalTime(logicalTime));
+  }
+
   virtual void reflectAttributeValues(Ambassador<T>& ambassador, const Federate::ObjectClass& objectClass,
                                       const TimeStampedAttributeUpdateMessage& message)
   {
     OrderType orderType = InternalTimeManagement::getTimeStampOrderDelivery(message.getOrderType());
     LogicalTime logicalTime = _logicalTimeFactory.decodeLogicalTime(message.getTimeStamp());
     OpenRTIAssert(orderType == RECEIVE || _logicalTime <= LogicalTimePair(logicalTime, 0));
-    if (InternalTimeManagement::getFlushQueueMode()) {
-      ambassador.reflectAttributeValues(objectClass, message.getObjectInstanceHandle(), message.getAttributeValues(),
+    bool flushQueueMode = InternalTimeManagement::getFlushQueueMode();
+    if (flushQueueMode)
+      _insertFlushQueueDeliveredMessage(message.getMessageRetractionHandleForMessage(), logicalTime);
+    // Values going to the attribute cache are delivered at their time stamp too
+    AttributeValueVector uncachedAttributeValueVector;
+    const AttributeValueVector* attributeValueVector;
+    attributeValueVector = ambassador._cacheAttributeValues(objectClass, message.getObjectInstanceHandle(), message.getAttributeValues(),
+                                                            uncachedAttributeValueVector);
+    if (!attributeValueVector)
+      return;
+    if (flushQueueMode) {
+      ambassador.reflectAttributeValues(objectClass, message.getObjectInstanceHandle(), *attributeValueVector,
                                         message.getTag(), message.getOrderType(), message.getTransportationType(),
                                         _logicalTimeFactory.getLogicalTime(logicalTime), orderType, message.getFederateHandle(),
                                         message.getMessageRetractionHandle());
     } else {
-      ambassador.reflectAttributeValues(objectClass, message.getObjectInstanceHandle(), message.getAttributeValues(),
+      ambassador.reflectAttributeValues(objectClass, message.getObjectInstanceHandle(), *attributeValueVector,
                                         message.getTag(), message.getOrderType(), message.getTransportationType(),
                                         _logicalTimeFactory.getLogicalTime(logicalTime), orderType, message.getFederateHandle());
     }
@@ -998,6 +1245,7 @@ public:
     LogicalTime logicalTime = _logicalTimeFactory.decodeLogicalTime(message.getTimeStamp());
     OpenRTIAssert(orderType == RECEIVE || _logicalTime <= LogicalTimePair(logicalTime, 0));
     if (InternalTimeManagement::getFlushQueueMode()) {
+      _insertFlushQueueDeliveredMessage(message.getMessageRetractionHandleForMessage(), logicalTime);
       ambassador.removeObjectInstance(message.getObjectInstanceHandle(), message.getTag(), message.getOrderType(),
                                       _logicalTimeFactory.getLogicalTime(logicalTime), orderType, message.getFederateHandle(),
                                       message.getMessageRetractionHandle());
@@ -1007,6 +1255,15 @@ public:
     }
   }
 
+  void _insertFlushQueueDeliveredMessage(const MessageRetractionHandle& messageRetractionHandle, const LogicalTime& logicalTime)
+  {
+    if (!messageRetractionHandle.valid())
+      return;
+    if (!(_logicalTime.first < logicalTime))
+      return;
+    _flushQueueDeliveredMessageMap[messageRetractionHandle] = logicalTime;
+  }
+
   virtual void eraseMessagesForObjectInstance(Ambassador<T>& ambassador, const ObjectInstanceHandle& objectInstanceHandle)
   {
     // Remove messages targeting this object instance from the pending messages
@@ -1027,6 +1284,7 @@ public:
     LogicalTime logicalTime = _logicalTimeFactory.decodeLogicalTime(message.getTimeStamp());
     OpenRTIAssert(orderType == RECEIVE || _logicalTime <= LogicalTimePair(logicalTime, 0));
     if (InternalTimeManagement::getFlushQueueMode()) {
+      _insertFlushQueueDeliveredMessage(message.getMessageRetractionHandleForMessage(), logicalTime);
       ambassador.receiveInteraction(interactionClass, interactionClassHandle, message.getParameterValues(),
                                     message.getTag(), message.getOrderType(), message.getTransportationType(),
                                     _logicalTimeFactory.getLogicalTime(logicalTime), orderType, message.getFederateHandle(),
@@ -1048,34 +1306,54 @@ public:
         message.swap(messageListElement._message);
         _messageListPool.push_back(messageListElement);
 
+        message->writeMessageTrace();
         message->dispatch(dispatcher);
         return true;
       }
     }
     checkForPendingFlushQueue();
-    while (!_logicalTimeMessageListMap.empty()) {
-      if (_logicalTimeMessageListMap.begin()->second.empty()) {
-        _logicalTimeMessageListMap.erase(_logicalTimeMessageListMap.begin());
+    while (!_timeStampOrderQueue.empty()) {
+      if (_timeStampOrderQueue.frontList().empty()) {
+        _timeStampOrderQueue.popFront();
         checkForPendingFlushQueue();
         continue;
       }
       if (!_timeStampOrderMessagesPermitted())
         break;
 
-      _MessageListElement& messageListElement = _logicalTimeMessageListMap.begin()->second.front();
+      _MessageListElement& messageListElement = _timeStampOrderQueue.frontList().front();
       messageListElement.unlink();
       SharedPtr<const AbstractMessage> message;
       message.swap(messageListElement._message);
       _messageListPool.push_back(messageListElement);
-      if (_logicalTimeMessageListMap.begin()->second.empty())
-        _logicalTimeMessageListMap.erase(_logicalTimeMessageListMap.begin());
+      if (_timeStampOrderQueue.frontList().empty())
+        _timeStampOrderQueue.popFront();
 
+      message->writeMessageTrace();
       message->dispatch(dispatcher);
       return true;
     }
     return false;
   }
 
+  virtual void setTimeStampOrderQueueType(InternalTimeManagement::TimeStampOrderQueueType timeStampOrderQueueType)
+  {
+    if (timeStampOrderQueueType == InternalTimeManagement::HeapTimeStampOrderQueue)
+      _timeStampOrderQueue.setType(_TimeStampOrderQueue::HeapType);
+    else
+      _timeStampOrderQueue.setType(_TimeStampOrderQueue::MapType);
+  }
+
+  virtual void setCommitCoalescing(bool commitCoalescing)
+  {
+    _commitCoalescing = commitCoalescing;
+  }
+
+  virtual void setTimeAdvanceBarrier(bool timeAdvanceBarrier)
+  {
+    _timeAdvanceBarrier = timeAdvanceBarrier;
+  }
+
   virtual bool callbackMessageAvailable()
   {
     if (_receiveOrderMessagesPermitted()) {
@@ -1084,9 +1362,9 @@ public:
       }
     }
     checkForPendingFlushQueue();
-    while (!_logicalTimeMessageListMap.empty()) {
-      if (_logicalTimeMessageListMap.begin()->second.empty()) {
-        _logicalTimeMessageListMap.erase(_logicalTimeMessageListMap.begin());
+    while (!_timeStampOrderQueue.empty()) {
+      if (_timeStampOrderQueue.frontList().empty()) {
+        _timeStampOrderQueue.popFront();
         checkForPendingFlushQueue();
         continue;
       }
@@ -1103,9 +1381,9 @@ public:
       return true;
     if (!InternalTimeManagement::getTimeConstrainedEnabledOrPending())
       return true;
-    if (_pendingLogicalTime < _logicalTimeMessageListMap.begin()->first)
+    if (_pendingLogicalTime < _timeStampOrderQueue.frontKey())
       return false;
-    return canAdvanceTo(_logicalTimeMessageListMap.begin()->first);
+    return canAdvanceTo(_timeStampOrderQueue.frontKey());
   }
 
   bool _receiveOrderMessagesPermitted() const
@@ -1162,40 +1440,116 @@ public:
 
   Unsigned _commitId;
 
+  // Defer time advance commits that cannot raise the GALT of any other federate
+  bool _commitCoalescing;
+  // Commits are routed through the root server
+  bool _timeAdvanceBarrier;
+
+  // The sent time stamp order messages that can still be retracted, by time stamp and by serial
+  typedef std::multimap<LogicalTime, uint32_t> RetractableMessageTimeStampMap;
+  RetractableMessageTimeStampMap _retractableMessageTimeStampMap;
+  typedef std::map<uint32_t, typename RetractableMessageTimeStampMap::iterator> RetractableMessageMap;
+  RetractableMessageMap _retractableMessageMap;
+  // The time stamps of the messages delivered ahead of the logical time by a flush queue request
+  typedef std::map<MessageRetractionHandle, LogicalTime> FlushQueueDeliveredMessageMap;
+  FlushQueueDeliveredMessageMap _flushQueueDeliveredMessageMap;
+
+  // The time management state saved with a federation save
+  typedef std::pair<LogicalTimePair, SharedPtr<const AbstractMessage> > _SavedMessage;
+  typedef std::vector<_SavedMessage> _SavedMessageVector;
+  struct OPENRTI_LOCAL _SavedState {
+    _SavedState() :
+      _timeRegulationMode(InternalTimeManagement::TimeRegulationDisabled),
+      _timeConstrainedMode(InternalTimeManagement::TimeConstrainedDisabled)
+    { }
+    LogicalTimePair _logicalTime;
+    LogicalTimePair _outboundLowerBoundTimeStamp;
+    LogicalTimeInterval _currentLookahead;
+    LogicalTimeInterval _targetLookahead;
+    InternalTimeManagement::TimeRegulationMode _timeRegulationMode;
+    InternalTimeManagement::TimeConstrainedMode _timeConstrainedMode;
+    _SavedMessageVector _messageVector;
+  };
+  // The saved state by save label, holds only the state of the latest successful save
+  typedef std::map<std::string, _SavedState> _LabelSavedStateMap;
+  _LabelSavedStateMap _labelSavedStateMap;
+  // Taken when the federate completes its save, kept once the whole federation saved
+  std::string _pendingSaveLabel;
+  _SavedState _pendingSavedState;
+  // Is true from restoring the saved state until the whole federation is restored
+  bool _restoreInProgress;
+
   // Holds a message to be queued into a list
   struct OPENRTI_LOCAL _MessageListElement :
          public IntrusiveList<_MessageListElement>::Hook,
-         public IntrusiveUnorderedMap<ObjectInstanceHandle, _MessageListElement>::Hook {
-    _MessageListElement(const AbstractMessage* message) : _message(message)
+         public IntrusiveUnorderedMap<ObjectInstanceHandle, _MessageListElement>::Hook,
+         public IntrusiveUnorderedMap<MessageRetractionHandle, _MessageListElement>::Hook {
+    _MessageListElement(const AbstractMessage* message = 0) : _message(message)
     { }
     void unlink()
     {
       IntrusiveList<_MessageListElement>::unlink(*this);
       IntrusiveUnorderedMap<ObjectInstanceHandle, _MessageListElement>::unlink(*this);
       IntrusiveUnorderedMap<ObjectInstanceHandle, _MessageListElement>::Hook::setKey(ObjectInstanceHandle());
+      IntrusiveUnorderedMap<MessageRetractionHandle, _MessageListElement>::unlink(*this);
+      IntrusiveUnorderedMap<MessageRetractionHandle, _MessageListElement>::Hook::setKey(MessageRetractionHandle());
     }
     const ObjectInstanceHandle& getObjectInstanceHandle() const
     { return IntrusiveUnorderedMap<ObjectInstanceHandle, _MessageListElement>::Hook::getKey(); }
     void setObjectInstanceHandle(const ObjectInstanceHandle& objectInstanceHandle)
     { IntrusiveUnorderedMap<ObjectInstanceHandle, _MessageListElement>::Hook::setKey(objectInstanceHandle); }
+    const MessageRetractionHandle& getMessageRetractionHandle() const
+    { return IntrusiveUnorderedMap<MessageRetractionHandle, _MessageListElement>::Hook::getKey(); }
+    void setMessageRetractionHandle(const MessageRetractionHandle& messageRetractionHandle)
+    { IntrusiveUnorderedMap<MessageRetractionHandle, _MessageListElement>::Hook::setKey(messageRetractionHandle); }
     SharedPtr<const AbstractMessage> _message;
   };
   typedef IntrusiveList<_MessageListElement> _MessageList;
 
   // The timestamped queued messages
-  typedef std::map<LogicalTimePair, _MessageList> LogicalTimeMessageListMap;
-  LogicalTimeMessageListMap _logicalTimeMessageListMap;
+  typedef TimeStampOrderQueue<LogicalTimePair, _MessageListElement> _TimeStampOrderQueue;
+  _TimeStampOrderQueue _timeStampOrderQueue;
 
   // List of receive order messages ready to be queued for callback
   _MessageList _receiveOrderMessages;
 
-  // List elements for reuse
+  // List elements for reuse, allocated in slabs
   _MessageList _messageListPool;
+  enum { MessageListElementSlabSize = 64 };
+  std::vector<_MessageListElement*> _messageListElementSlabs;
 
   // List elements that reference a specific object instance
   typedef IntrusiveUnorderedMap<ObjectInstanceHandle, _MessageListElement> _ObjectInstanceHandleMessageListElementMap;
   _ObjectInstanceHandleMessageListElementMap _objectInstanceHandleMessageListElementMap;
 
+  // List elements of time stamp order messages by their retraction handle
+  typedef IntrusiveUnorderedMap<MessageRetractionHandle, _MessageListElement> _MessageRetractionHandleMessageListElementMap;
+  _MessageRetractionHandleMessageListElementMap _messageRetractionHandleMessageListElementMap;
+
+  // Get a list element for the message from the pool
+  _MessageListElement& _getMessageListElement(const AbstractMessage& message, bool retractable = true)
+  {
+    if (_messageListPool.empty()) {
+      // Allocate the list elements in slabs, they are reused from the pool later
+      _MessageListElement* slab = new _MessageListElement[MessageListElementSlabSize];
+      _messageListElementSlabs.push_back(slab);
+      for (unsigned i = 0; i < MessageListElementSlabSize; ++i)
+        _messageListPool.push_back(slab[i]);
+    }
+    _MessageListElement& messageListElement = _messageListPool.front();
+    messageListElement.unlink();
+    messageListElement._message = &message;
+    if (message.getObjectInstanceHandleForMessage().valid()) {
+      messageListElement.setObjectInstanceHandle(message.getObjectInstanceHandleForMessage());
+      _objectInstanceHandleMessageListElementMap.insert(messageListElement);
+    }
+    if (retractable && message.getMessageRetractionHandleForMessage().valid()) {
+      messageListElement.setMessageRetractionHandle(message.getMessageRetractionHandleForMessage());
+      _messageRetractionHandleMessageListElementMap.insert(messageListElement);
+    }
+    return messageListElement;
+  }
+
   // The logical time factory required to do our job
   LogicalTimeFactory _logicalTimeFactory;
 };
@@ -33,6 +33,7 @@
 #include <ScopeUnlock.h>
 #include <NetworkServer.h>
 #include <Rand.h>
+#include <ServerOptions.h>
 #include <SharedPtr.h>
 #include <StringUtils.h>
 #include <Thread.h>
@@ -46,7 +47,8 @@ namespace OpenRTI {
 
 class OPENRTI_LOCAL ServerPool {
 public:
-  ServerPool()
+  ServerPool() :
+    _timeAdvanceBarrier(false)
   {
 #if !defined(_WIN32)
     struct rlimit limit;
@@ -58,6 +60,9 @@ public:
   ~ServerPool()
   { stopServerPool(); }
 
+  void setTimeAdvanceBarrier(bool timeAdvanceBarrier)
+  { _timeAdvanceBarrier = timeAdvanceBarrier; }
+
   void startServerPool(unsigned numServers, unsigned numClientsPerServers)
   {
     if (numServers <= 0)
@@ -103,8 +108,10 @@ public:
 private:
   class OPENRTI_LOCAL ServerThread : public Thread {
   public:
-    void setupServer(const std::string& host, const SocketAddress& parentAddress, bool compress)
+    void setupServer(const std::string& host, const SocketAddress& parentAddress, bool compress, bool timeAdvanceBarrier)
     {
+      _server.getServerNode().getServerOptions()._timeAdvanceBarrier = timeAdvanceBarrier;
+
       std::list<SocketAddress> addressList = SocketAddress::resolve(host, "0", true);
       // Set up a stream socket for the server connect
       bool success = false;
@@ -150,13 +157,15 @@ private:
   SocketAddress startServer(const SocketAddress& parentAddress, bool compress)
   {
     SharedPtr<ServerThread> serverThread = new ServerThread;
-    serverThread->setupServer("localhost", parentAddress, compress);
+    serverThread->setupServer("localhost", parentAddress, compress, _timeAdvanceBarrier);
     _serverThreadList.push_back(serverThread);
     return serverThread->getAddress();
   }
 
   typedef std::vector<SharedPtr<ServerThread> > ServerThreadList;
   ServerThreadList _serverThreadList;
+
+  bool _timeAdvanceBarrier;
 };
 
 class OPENRTI_LOCAL RTITest {
@@ -406,7 +415,7 @@ public:
   };
 
   RTITest(int argc, const char* const argv[], bool disjointFederations) :
-    _optionString("A:C:F:JM:O:S:"),
+    _optionString("A:BC:F:JM:O:S:"),
     _options(argc, argv),
     _federationExecution(L"FederationExecution"),
     _numServers(1),
@@ -437,6 +446,9 @@ public:
     case 'A':
       _numAmbassadorThreads = atoi(argument.c_str());
       return true;
+    case 'B':
+      _serverPool.setTimeAdvanceBarrier(true);
+      return true;
     case 'C':
       _numClientsPerServers = atoi(argument.c_str());
       return true;
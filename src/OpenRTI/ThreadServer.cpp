@@ -32,6 +32,7 @@ ThreadServer::ThreadServer(const SharedPtr<AbstractServerNode>& serverNode) :
 ThreadServer::~ThreadServer()
 {
   _queue.send(*this);
+  _closeServerLoop();
 }
 
 int
@@ -40,7 +41,10 @@ ThreadServer::exec()
   ScopeLock scopeLock(_mutex);
   while (!getDone()) {
     if (_queue.empty()) {
-      _condition.wait(scopeLock);
+      if (_getTimeout() == Clock::max())
+        _condition.wait(scopeLock);
+      else
+        _condition.wait_until(scopeLock, _getTimeout());
     } else {
       // Get pending messages.
       _Queue queue;
@@ -58,6 +62,11 @@ ThreadServer::exec()
       // For recycling the queue entries, we need the lock again
       queue.recycle(_pool);
     }
+
+    if (_getTimeout() != Clock::max()) {
+      ScopeUnlock scopeUnlock(_mutex);
+      _sendTimeout(Clock::now());
+    }
   }
 
   return EXIT_SUCCESS;
@@ -22,11 +22,14 @@
 
 
 #include "TightBE1MessageEncoding.h"
+
+#include <iterator>
 #include "AbstractMessageEncoding.h"
 #include "DecodeDataStream.h"
 #include "EncodeDataStream.h"
 #include "Export.h"
 #include "Message.h"
+#include "Metrics.h"
 
 namespace OpenRTI {
 
@@ -156,9 +159,12 @@ public:
     case RTI_DETECTED_FAILURE_DURING_RESTORE:
       writeUInt32Compressed(3);
       break;
-    default:
+    case RESTORE_ABORTED:
       writeUInt32Compressed(4);
       break;
+    default:
+      writeUInt32Compressed(5);
+      break;
     }
   }
 
@@ -207,9 +213,12 @@ public:
     case SAVE_TIME_CANNOT_BE_HONORED:
       writeUInt32Compressed(4);
       break;
-    default:
+    case SAVE_ABORTED:
       writeUInt32Compressed(5);
       break;
+    default:
+      writeUInt32Compressed(6);
+      break;
     }
   }
 
@@ -511,6 +520,20 @@ public:
     }
   }
 
+  void writeFederateHandleCommitIdPair(const FederateHandleCommitIdPair& value)
+  {
+    writeFederateHandle(value.first);
+    writeUnsigned(value.second);
+  }
+
+  void writeFederateHandleCommitIdPairVector(const FederateHandleCommitIdPairVector& value)
+  {
+    writeSizeTCompressed(value.size());
+    for (FederateHandleCommitIdPairVector::const_iterator i = value.begin(); i != value.end(); ++i) {
+      writeFederateHandleCommitIdPair(*i);
+    }
+  }
+
   void writeRangeBoundsValue(const RangeBoundsValue& value)
   {
     writeUnsigned(value.getLowerBound());
@@ -606,6 +629,22 @@ public:
     }
   }
 
+  void writeObjectInstanceState(const ObjectInstanceState& value)
+  {
+    writeObjectClassHandle(value.getObjectClassHandle());
+    writeObjectInstanceHandle(value.getObjectInstanceHandle());
+    writeString(value.getName());
+    writeAttributeStateVector(value.getAttributeStateVector());
+  }
+
+  void writeObjectInstanceStateVector(const ObjectInstanceStateVector& value)
+  {
+    writeSizeTCompressed(value.size());
+    for (ObjectInstanceStateVector::const_iterator i = value.begin(); i != value.end(); ++i) {
+      writeObjectInstanceState(*i);
+    }
+  }
+
   void writeParameterValue(const ParameterValue& value)
   {
     writeParameterHandle(value.getParameterHandle());
@@ -690,6 +729,96 @@ public:
     }
   }
 
+  void writeFederationSaveFederate(const FederationSaveFederate& value)
+  {
+    writeFederateHandle(value.getFederateHandle());
+    writeString(value.getName());
+    writeString(value.getFederateType());
+    writeBool(value.getIsTimeRegulating());
+    writeString(value.getTimeAdvanceTimeStamp());
+    writeString(value.getNextMessageTimeStamp());
+    writeRegionHandleDimensionHandleSetPairVector(value.getRegionHandleDimensionHandleSetPairVector());
+    writeRegionHandleRegionValuePairVector(value.getRegionHandleRegionValuePairVector());
+  }
+
+  void writeFederationSaveFederateVector(const FederationSaveFederateVector& value)
+  {
+    writeSizeTCompressed(value.size());
+    for (FederationSaveFederateVector::const_iterator i = value.begin(); i != value.end(); ++i) {
+      writeFederationSaveFederate(*i);
+    }
+  }
+
+  void writeFederationSaveInteractionClassSubscription(const FederationSaveInteractionClassSubscription& value)
+  {
+    writeInteractionClassHandle(value.getInteractionClassHandle());
+    writeFederateHandleVector(value.getFederateHandleVector());
+  }
+
+  void writeFederationSaveInteractionClassSubscriptionVector(const FederationSaveInteractionClassSubscriptionVector& value)
+  {
+    writeSizeTCompressed(value.size());
+    for (FederationSaveInteractionClassSubscriptionVector::const_iterator i = value.begin(); i != value.end(); ++i) {
+      writeFederationSaveInteractionClassSubscription(*i);
+    }
+  }
+
+  void writeFederationSaveObjectClassSubscription(const FederationSaveObjectClassSubscription& value)
+  {
+    writeObjectClassHandle(value.getObjectClassHandle());
+    writeAttributeHandle(value.getAttributeHandle());
+    writeFederateHandleVector(value.getFederateHandleVector());
+  }
+
+  void writeFederationSaveObjectClassSubscriptionVector(const FederationSaveObjectClassSubscriptionVector& value)
+  {
+    writeSizeTCompressed(value.size());
+    for (FederationSaveObjectClassSubscriptionVector::const_iterator i = value.begin(); i != value.end(); ++i) {
+      writeFederationSaveObjectClassSubscription(*i);
+    }
+  }
+
+  void writeFederationSaveHeader(const FederationSaveHeader& value)
+  {
+    writeString(value.getFederationName());
+    writeString(value.getLogicalTimeFactoryName());
+    writeString(value.getLabel());
+    writeFederationSaveFederateVector(value.getFederateVector());
+    writeFederationSaveInteractionClassSubscriptionVector(value.getInteractionClassSubscriptionVector());
+    writeFederationSaveObjectClassSubscriptionVector(value.getObjectClassSubscriptionVector());
+    writeUnsigned(value.getNumObjectInstances());
+  }
+
+  void writeAttributeHandleFederateHandlePair(const AttributeHandleFederateHandlePair& value)
+  {
+    writeAttributeHandle(value.first);
+    writeFederateHandle(value.second);
+  }
+
+  void writeAttributeHandleFederateHandlePairVector(const AttributeHandleFederateHandlePairVector& value)
+  {
+    writeSizeTCompressed(value.size());
+    for (AttributeHandleFederateHandlePairVector::const_iterator i = value.begin(); i != value.end(); ++i) {
+      writeAttributeHandleFederateHandlePair(*i);
+    }
+  }
+
+  void writeFederationSaveObjectInstance(const FederationSaveObjectInstance& value)
+  {
+    writeObjectInstanceHandle(value.getObjectInstanceHandle());
+    writeString(value.getName());
+    writeObjectClassHandle(value.getObjectClassHandle());
+    writeAttributeHandleFederateHandlePairVector(value.getAttributeHandleFederateHandlePairVector());
+  }
+
+  void writeFederationSaveObjectInstanceVector(const FederationSaveObjectInstanceVector& value)
+  {
+    writeSizeTCompressed(value.size());
+    for (FederationSaveObjectInstanceVector::const_iterator i = value.begin(); i != value.end(); ++i) {
+      writeFederationSaveObjectInstance(*i);
+    }
+  }
+
   void writeCreateFederationExecutionResponseType(const CreateFederationExecutionResponseType& value)
   {
     switch (value) {
@@ -762,9 +891,12 @@ public:
     case JoinFederationExecutionResponseInconsistentFDD:
       writeUInt32Compressed(5);
       break;
-    default:
+    case JoinFederationExecutionResponseMissingFOMModules:
       writeUInt32Compressed(6);
       break;
+    default:
+      writeUInt32Compressed(7);
+      break;
     }
   }
 
@@ -929,6 +1061,7 @@ public:
   void writeFOMStringModule(const FOMStringModule& value)
   {
     writeString(value.getContent());
+    writeString(value.getContentHash());
     writeFOMStringTransportationTypeList(value.getTransportationTypeList());
     writeFOMStringDimensionList(value.getDimensionList());
     writeFOMStringRoutingSpaceList(value.getRoutingSpaceList());
@@ -1147,6 +1280,15 @@ public:
     writeFederationExecutionInformationVector(value.getFederationExecutionInformationVector());
   }
 
+  void writeMetricsRequestMessage(const MetricsRequestMessage& value)
+  {
+  }
+
+  void writeMetricsResponseMessage(const MetricsResponseMessage& value)
+  {
+    writeString(value.getMetrics());
+  }
+
   void writeInsertFederationExecutionMessage(const InsertFederationExecutionMessage& value)
   {
     writeFederationHandle(value.getFederationHandle());
@@ -1182,6 +1324,7 @@ public:
     writeString(value.getFederateType());
     writeString(value.getFederateName());
     writeFOMStringModuleList(value.getFOMStringModuleList());
+    writeStringVector(value.getFOMModuleContentHashVector());
     writeConfigurationParameterMap(value.getConfigurationParameterMap());
   }
 
@@ -1269,6 +1412,127 @@ public:
     writeFederateHandleBoolPairVector(value.getFederateHandleBoolPairVector());
   }
 
+  void writeRequestFederationSaveMessage(const RequestFederationSaveMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeString(value.getLabel());
+    writeVariableLengthData(value.getTimeStamp());
+    writeBool(value.getTimeStampValid());
+  }
+
+  void writeInitiateFederateSaveMessage(const InitiateFederateSaveMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeString(value.getLabel());
+    writeVariableLengthData(value.getTimeStamp());
+    writeBool(value.getTimeStampValid());
+  }
+
+  void writeFederateSaveBegunMessage(const FederateSaveBegunMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+  }
+
+  void writeFederateSaveCompleteMessage(const FederateSaveCompleteMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeBool(value.getSuccessful());
+    writeSaveFailureReason(value.getSaveFailureReason());
+  }
+
+  void writeFederationSavedMessage(const FederationSavedMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeString(value.getLabel());
+    writeBool(value.getSuccessful());
+    writeSaveFailureReason(value.getSaveFailureReason());
+  }
+
+  void writeAbortFederationSaveMessage(const AbortFederationSaveMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+  }
+
+  void writeQueryFederationSaveStatusRequestMessage(const QueryFederationSaveStatusRequestMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+  }
+
+  void writeQueryFederationSaveStatusResponseMessage(const QueryFederationSaveStatusResponseMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeFederateHandleSaveStatusPairVector(value.getFederateHandleSaveStatusPairVector());
+  }
+
+  void writeRequestFederationRestoreMessage(const RequestFederationRestoreMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeString(value.getLabel());
+  }
+
+  void writeRequestFederationRestoreResponseMessage(const RequestFederationRestoreResponseMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeString(value.getLabel());
+    writeBool(value.getSuccessful());
+  }
+
+  void writeFederationRestoreBegunMessage(const FederationRestoreBegunMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeString(value.getLabel());
+  }
+
+  void writeInitiateFederateRestoreMessage(const InitiateFederateRestoreMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeString(value.getLabel());
+    writeString(value.getFederateName());
+  }
+
+  void writeFederateRestoreCompleteMessage(const FederateRestoreCompleteMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeBool(value.getSuccessful());
+  }
+
+  void writeFederationRestoredMessage(const FederationRestoredMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeString(value.getLabel());
+    writeBool(value.getSuccessful());
+    writeRestoreFailureReason(value.getRestoreFailureReason());
+  }
+
+  void writeAbortFederationRestoreMessage(const AbortFederationRestoreMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+  }
+
+  void writeQueryFederationRestoreStatusRequestMessage(const QueryFederationRestoreStatusRequestMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+  }
+
+  void writeQueryFederationRestoreStatusResponseMessage(const QueryFederationRestoreStatusResponseMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeFederateHandleRestoreStatusPairVector(value.getFederateHandleRestoreStatusPairVector());
+  }
+
   void writeEnableTimeRegulationRequestMessage(const EnableTimeRegulationRequestMessage& value)
   {
     writeFederationHandle(value.getFederationHandle());
@@ -1301,6 +1565,14 @@ public:
     writeUnsigned(value.getCommitId());
   }
 
+  void writeCollectedCommitLowerBoundTimeStampMessage(const CollectedCommitLowerBoundTimeStampMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeVariableLengthData(value.getTimeStamp());
+    writeLowerBoundTimeStampCommitType(value.getCommitType());
+    writeFederateHandleCommitIdPairVector(value.getFederateHandleCommitIdPairVector());
+  }
+
   void writeCommitLowerBoundTimeStampResponseMessage(const CommitLowerBoundTimeStampResponseMessage& value)
   {
     writeFederationHandle(value.getFederationHandle());
@@ -1374,6 +1646,7 @@ public:
     writeSubscriptionType(value.getSubscriptionType());
     writeObjectClassHandle(value.getObjectClassHandle());
     writeAttributeHandleVector(value.getAttributeHandles());
+    writeDouble(value.getUpdateRate());
   }
 
   void writeRegistrationForObjectClassMessage(const RegistrationForObjectClassMessage& value)
@@ -1485,6 +1758,12 @@ public:
     writeAttributeStateVector(value.getAttributeStateVector());
   }
 
+  void writeInsertMultipleObjectInstancesMessage(const InsertMultipleObjectInstancesMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeObjectInstanceStateVector(value.getObjectInstanceStateVector());
+  }
+
   void writeDeleteObjectInstanceMessage(const DeleteObjectInstanceMessage& value)
   {
     writeFederationHandle(value.getFederationHandle());
@@ -1543,49 +1822,123 @@ public:
     writeVariableLengthData(value.getTag());
   }
 
-  TightBE1MessageEncoding& _messageEncoding;
-};
-
-class OPENRTI_LOCAL TightBE1MessageEncoding::DispatchFunctor {
-public:
-  DispatchFunctor(TightBE1MessageEncoding& messageEncoding) :
-    _messageEncoding(messageEncoding)
-  { }
-
-  template<typename M>
-  void operator()(const M& message) const
-  { encode(_messageEncoding, message); }
+  void writeChangeAttributeTransportationTypeRequestMessage(const ChangeAttributeTransportationTypeRequestMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeObjectInstanceHandle(value.getObjectInstanceHandle());
+    writeAttributeHandleVector(value.getAttributeHandles());
+    writeTransportationType(value.getTransportationType());
+  }
 
-  void
-  encode(TightBE1MessageEncoding&, const AbstractMessage&) const
+  void writeChangeAttributeTransportationTypeResponseMessage(const ChangeAttributeTransportationTypeResponseMessage& value)
   {
-    throw RTIinternalError("Invalid message dispatched to encoding!");
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeObjectInstanceHandle(value.getObjectInstanceHandle());
+    writeAttributeHandleVector(value.getAttributeHandles());
+    writeTransportationType(value.getTransportationType());
   }
 
-  void
-  encode(TightBE1MessageEncoding& messageEncoding, const ConnectionLostMessage& message) const
+  void writeChangeInteractionTransportationTypeRequestMessage(const ChangeInteractionTransportationTypeRequestMessage& value)
   {
-    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
-    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
-    encodeStream.writeUInt16Compressed(1);
-    encodeStream.writeConnectionLostMessage(message);
-    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeInteractionClassHandle(value.getInteractionClassHandle());
+    writeTransportationType(value.getTransportationType());
   }
 
-  void
-  encode(TightBE1MessageEncoding& messageEncoding, const CreateFederationExecutionRequestMessage& message) const
+  void writeChangeInteractionTransportationTypeResponseMessage(const ChangeInteractionTransportationTypeResponseMessage& value)
   {
-    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
-    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
-    encodeStream.writeUInt16Compressed(2);
-    encodeStream.writeCreateFederationExecutionRequestMessage(message);
-    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeInteractionClassHandle(value.getInteractionClassHandle());
+    writeTransportationType(value.getTransportationType());
   }
 
-  void
-  encode(TightBE1MessageEncoding& messageEncoding, const CreateFederationExecutionResponseMessage& message) const
+  void writeQueryAttributeTransportationTypeRequestMessage(const QueryAttributeTransportationTypeRequestMessage& value)
   {
-    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeObjectInstanceHandle(value.getObjectInstanceHandle());
+    writeAttributeHandle(value.getAttributeHandle());
+  }
+
+  void writeQueryAttributeTransportationTypeResponseMessage(const QueryAttributeTransportationTypeResponseMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeObjectInstanceHandle(value.getObjectInstanceHandle());
+    writeAttributeHandle(value.getAttributeHandle());
+    writeTransportationType(value.getTransportationType());
+  }
+
+  void writeQueryInteractionTransportationTypeRequestMessage(const QueryInteractionTransportationTypeRequestMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeFederateHandle(value.getQueriedFederateHandle());
+    writeInteractionClassHandle(value.getInteractionClassHandle());
+  }
+
+  void writeQueryInteractionTransportationTypeResponseMessage(const QueryInteractionTransportationTypeResponseMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeFederateHandle(value.getFederateHandle());
+    writeFederateHandle(value.getQueriedFederateHandle());
+    writeInteractionClassHandle(value.getInteractionClassHandle());
+    writeTransportationType(value.getTransportationType());
+  }
+
+  void writeMessageRetractionMessage(const MessageRetractionMessage& value)
+  {
+    writeFederationHandle(value.getFederationHandle());
+    writeMessageRetractionHandle(value.getMessageRetractionHandle());
+  }
+
+  TightBE1MessageEncoding& _messageEncoding;
+};
+
+class OPENRTI_LOCAL TightBE1MessageEncoding::DispatchFunctor {
+public:
+  DispatchFunctor(TightBE1MessageEncoding& messageEncoding) :
+    _messageEncoding(messageEncoding)
+  { }
+
+  template<typename M>
+  void operator()(const M& message) const
+  { encode(_messageEncoding, message); }
+
+  void
+  encode(TightBE1MessageEncoding&, const AbstractMessage&) const
+  {
+    throw RTIinternalError("Invalid message dispatched to encoding!");
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const ConnectionLostMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(1);
+    encodeStream.writeConnectionLostMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const CreateFederationExecutionRequestMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(2);
+    encodeStream.writeCreateFederationExecutionRequestMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const CreateFederationExecutionResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
     EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
     encodeStream.writeUInt16Compressed(3);
     encodeStream.writeCreateFederationExecutionResponseMessage(message);
@@ -1632,6 +1985,26 @@ public:
     headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
   }
 
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const MetricsRequestMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(19);
+    encodeStream.writeMetricsRequestMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const MetricsResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(20);
+    encodeStream.writeMetricsResponseMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
   void
   encode(TightBE1MessageEncoding& messageEncoding, const InsertFederationExecutionMessage& message) const
   {
@@ -1792,6 +2165,176 @@ public:
     headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
   }
 
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const RequestFederationSaveMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(101);
+    encodeStream.writeRequestFederationSaveMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const InitiateFederateSaveMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(102);
+    encodeStream.writeInitiateFederateSaveMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const FederateSaveBegunMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(103);
+    encodeStream.writeFederateSaveBegunMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const FederateSaveCompleteMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(104);
+    encodeStream.writeFederateSaveCompleteMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const FederationSavedMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(105);
+    encodeStream.writeFederationSavedMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const AbortFederationSaveMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(106);
+    encodeStream.writeAbortFederationSaveMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const QueryFederationSaveStatusRequestMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(107);
+    encodeStream.writeQueryFederationSaveStatusRequestMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const QueryFederationSaveStatusResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(108);
+    encodeStream.writeQueryFederationSaveStatusResponseMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const RequestFederationRestoreMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(109);
+    encodeStream.writeRequestFederationRestoreMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const RequestFederationRestoreResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(110);
+    encodeStream.writeRequestFederationRestoreResponseMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const FederationRestoreBegunMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(111);
+    encodeStream.writeFederationRestoreBegunMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const InitiateFederateRestoreMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(112);
+    encodeStream.writeInitiateFederateRestoreMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const FederateRestoreCompleteMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(113);
+    encodeStream.writeFederateRestoreCompleteMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const FederationRestoredMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(114);
+    encodeStream.writeFederationRestoredMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const AbortFederationRestoreMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(115);
+    encodeStream.writeAbortFederationRestoreMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const QueryFederationRestoreStatusRequestMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(116);
+    encodeStream.writeQueryFederationRestoreStatusRequestMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const QueryFederationRestoreStatusResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(117);
+    encodeStream.writeQueryFederationRestoreStatusResponseMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
   void
   encode(TightBE1MessageEncoding& messageEncoding, const EnableTimeRegulationRequestMessage& message) const
   {
@@ -1832,6 +2375,16 @@ public:
     headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
   }
 
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const CollectedCommitLowerBoundTimeStampMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(49);
+    encodeStream.writeCollectedCommitLowerBoundTimeStampMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
   void
   encode(TightBE1MessageEncoding& messageEncoding, const CommitLowerBoundTimeStampResponseMessage& message) const
   {
@@ -2022,6 +2575,16 @@ public:
     headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
   }
 
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const InsertMultipleObjectInstancesMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(100);
+    encodeStream.writeInsertMultipleObjectInstancesMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
   void
   encode(TightBE1MessageEncoding& messageEncoding, const DeleteObjectInstanceMessage& message) const
   {
@@ -2082,6 +2645,96 @@ public:
     headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
   }
 
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const ChangeAttributeTransportationTypeRequestMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(118);
+    encodeStream.writeChangeAttributeTransportationTypeRequestMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const ChangeAttributeTransportationTypeResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(119);
+    encodeStream.writeChangeAttributeTransportationTypeResponseMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const ChangeInteractionTransportationTypeRequestMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(120);
+    encodeStream.writeChangeInteractionTransportationTypeRequestMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const ChangeInteractionTransportationTypeResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(121);
+    encodeStream.writeChangeInteractionTransportationTypeResponseMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const QueryAttributeTransportationTypeRequestMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(122);
+    encodeStream.writeQueryAttributeTransportationTypeRequestMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const QueryAttributeTransportationTypeResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(123);
+    encodeStream.writeQueryAttributeTransportationTypeResponseMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const QueryInteractionTransportationTypeRequestMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(124);
+    encodeStream.writeQueryInteractionTransportationTypeRequestMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const QueryInteractionTransportationTypeResponseMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(125);
+    encodeStream.writeQueryInteractionTransportationTypeResponseMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
+  void
+  encode(TightBE1MessageEncoding& messageEncoding, const MessageRetractionMessage& message) const
+  {
+    EncodeDataStream headerStream(messageEncoding.addScratchWriteBuffer());
+    EncodeStream encodeStream(messageEncoding.addScratchWriteBuffer(), messageEncoding);
+    encodeStream.writeUInt16Compressed(99);
+    encodeStream.writeMessageRetractionMessage(message);
+    headerStream.writeUInt32BE(uint32_t(encodeStream.size()));
+  }
+
 private:
   TightBE1MessageEncoding& _messageEncoding;
 };
@@ -2212,8 +2865,11 @@ public:
     case 3:
       value = RTI_DETECTED_FAILURE_DURING_RESTORE;
       break;
+    case 4:
+      value = RESTORE_ABORTED;
+      break;
     default:
-      value = RTI_DETECTED_FAILURE_DURING_RESTORE;
+      value = RESTORE_ABORTED;
       break;
     }
   }
@@ -2263,8 +2919,11 @@ public:
     case 4:
       value = SAVE_TIME_CANNOT_BE_HONORED;
       break;
+    case 5:
+      value = SAVE_ABORTED;
+      break;
     default:
-      value = SAVE_TIME_CANNOT_BE_HONORED;
+      value = SAVE_ABORTED;
       break;
     }
   }
@@ -2572,6 +3231,20 @@ public:
     }
   }
 
+  void readFederateHandleCommitIdPair(FederateHandleCommitIdPair& value)
+  {
+    readFederateHandle(value.first);
+    readUnsigned(value.second);
+  }
+
+  void readFederateHandleCommitIdPairVector(FederateHandleCommitIdPairVector& value)
+  {
+    value.resize(readSizeTCompressed());
+    for (FederateHandleCommitIdPairVector::iterator i = value.begin(); i != value.end(); ++i) {
+      readFederateHandleCommitIdPair(*i);
+    }
+  }
+
   void readRangeBoundsValue(RangeBoundsValue& value)
   {
     readUnsigned(value.getLowerBound());
@@ -2667,6 +3340,22 @@ public:
     }
   }
 
+  void readObjectInstanceState(ObjectInstanceState& value)
+  {
+    readObjectClassHandle(value.getObjectClassHandle());
+    readObjectInstanceHandle(value.getObjectInstanceHandle());
+    readString(value.getName());
+    readAttributeStateVector(value.getAttributeStateVector());
+  }
+
+  void readObjectInstanceStateVector(ObjectInstanceStateVector& value)
+  {
+    value.resize(readSizeTCompressed());
+    for (ObjectInstanceStateVector::iterator i = value.begin(); i != value.end(); ++i) {
+      readObjectInstanceState(*i);
+    }
+  }
+
   void readParameterValue(ParameterValue& value)
   {
     readParameterHandle(value.getParameterHandle());
@@ -2743,11 +3432,101 @@ public:
     readString(value.second);
   }
 
-  void readObjectInstanceHandleNamePairVector(ObjectInstanceHandleNamePairVector& value)
+  void readObjectInstanceHandleNamePairVector(ObjectInstanceHandleNamePairVector& value)
+  {
+    value.resize(readSizeTCompressed());
+    for (ObjectInstanceHandleNamePairVector::iterator i = value.begin(); i != value.end(); ++i) {
+      readObjectInstanceHandleNamePair(*i);
+    }
+  }
+
+  void readFederationSaveFederate(FederationSaveFederate& value)
+  {
+    readFederateHandle(value.getFederateHandle());
+    readString(value.getName());
+    readString(value.getFederateType());
+    readBool(value.getIsTimeRegulating());
+    readString(value.getTimeAdvanceTimeStamp());
+    readString(value.getNextMessageTimeStamp());
+    readRegionHandleDimensionHandleSetPairVector(value.getRegionHandleDimensionHandleSetPairVector());
+    readRegionHandleRegionValuePairVector(value.getRegionHandleRegionValuePairVector());
+  }
+
+  void readFederationSaveFederateVector(FederationSaveFederateVector& value)
+  {
+    value.resize(readSizeTCompressed());
+    for (FederationSaveFederateVector::iterator i = value.begin(); i != value.end(); ++i) {
+      readFederationSaveFederate(*i);
+    }
+  }
+
+  void readFederationSaveInteractionClassSubscription(FederationSaveInteractionClassSubscription& value)
+  {
+    readInteractionClassHandle(value.getInteractionClassHandle());
+    readFederateHandleVector(value.getFederateHandleVector());
+  }
+
+  void readFederationSaveInteractionClassSubscriptionVector(FederationSaveInteractionClassSubscriptionVector& value)
+  {
+    value.resize(readSizeTCompressed());
+    for (FederationSaveInteractionClassSubscriptionVector::iterator i = value.begin(); i != value.end(); ++i) {
+      readFederationSaveInteractionClassSubscription(*i);
+    }
+  }
+
+  void readFederationSaveObjectClassSubscription(FederationSaveObjectClassSubscription& value)
+  {
+    readObjectClassHandle(value.getObjectClassHandle());
+    readAttributeHandle(value.getAttributeHandle());
+    readFederateHandleVector(value.getFederateHandleVector());
+  }
+
+  void readFederationSaveObjectClassSubscriptionVector(FederationSaveObjectClassSubscriptionVector& value)
+  {
+    value.resize(readSizeTCompressed());
+    for (FederationSaveObjectClassSubscriptionVector::iterator i = value.begin(); i != value.end(); ++i) {
+      readFederationSaveObjectClassSubscription(*i);
+    }
+  }
+
+  void readFederationSaveHeader(FederationSaveHeader& value)
+  {
+    readString(value.getFederationName());
+    readString(value.getLogicalTimeFactoryName());
+    readString(value.getLabel());
+    readFederationSaveFederateVector(value.getFederateVector());
+    readFederationSaveInteractionClassSubscriptionVector(value.getInteractionClassSubscriptionVector());
+    readFederationSaveObjectClassSubscriptionVector(value.getObjectClassSubscriptionVector());
+    readUnsigned(value.getNumObjectInstances());
+  }
+
+  void readAttributeHandleFederateHandlePair(AttributeHandleFederateHandlePair& value)
+  {
+    readAttributeHandle(value.first);
+    readFederateHandle(value.second);
+  }
+
+  void readAttributeHandleFederateHandlePairVector(AttributeHandleFederateHandlePairVector& value)
+  {
+    value.resize(readSizeTCompressed());
+    for (AttributeHandleFederateHandlePairVector::iterator i = value.begin(); i != value.end(); ++i) {
+      readAttributeHandleFederateHandlePair(*i);
+    }
+  }
+
+  void readFederationSaveObjectInstance(FederationSaveObjectInstance& value)
+  {
+    readObjectInstanceHandle(value.getObjectInstanceHandle());
+    readString(value.getName());
+    readObjectClassHandle(value.getObjectClassHandle());
+    readAttributeHandleFederateHandlePairVector(value.getAttributeHandleFederateHandlePairVector());
+  }
+
+  void readFederationSaveObjectInstanceVector(FederationSaveObjectInstanceVector& value)
   {
     value.resize(readSizeTCompressed());
-    for (ObjectInstanceHandleNamePairVector::iterator i = value.begin(); i != value.end(); ++i) {
-      readObjectInstanceHandleNamePair(*i);
+    for (FederationSaveObjectInstanceVector::iterator i = value.begin(); i != value.end(); ++i) {
+      readFederationSaveObjectInstance(*i);
     }
   }
 
@@ -2823,8 +3602,11 @@ public:
     case 5:
       value = JoinFederationExecutionResponseInconsistentFDD;
       break;
+    case 6:
+      value = JoinFederationExecutionResponseMissingFOMModules;
+      break;
     default:
-      value = JoinFederationExecutionResponseInconsistentFDD;
+      value = JoinFederationExecutionResponseMissingFOMModules;
       break;
     }
   }
@@ -2991,6 +3773,7 @@ public:
   void readFOMStringModule(FOMStringModule& value)
   {
     readString(value.getContent());
+    readString(value.getContentHash());
     readFOMStringTransportationTypeList(value.getTransportationTypeList());
     readFOMStringDimensionList(value.getDimensionList());
     readFOMStringRoutingSpaceList(value.getRoutingSpaceList());
@@ -3209,6 +3992,15 @@ public:
     readFederationExecutionInformationVector(value.getFederationExecutionInformationVector());
   }
 
+  void readMetricsRequestMessage(MetricsRequestMessage& value)
+  {
+  }
+
+  void readMetricsResponseMessage(MetricsResponseMessage& value)
+  {
+    readString(value.getMetrics());
+  }
+
   void readInsertFederationExecutionMessage(InsertFederationExecutionMessage& value)
   {
     readFederationHandle(value.getFederationHandle());
@@ -3244,6 +4036,7 @@ public:
     readString(value.getFederateType());
     readString(value.getFederateName());
     readFOMStringModuleList(value.getFOMStringModuleList());
+    readStringVector(value.getFOMModuleContentHashVector());
     readConfigurationParameterMap(value.getConfigurationParameterMap());
   }
 
@@ -3331,6 +4124,127 @@ public:
     readFederateHandleBoolPairVector(value.getFederateHandleBoolPairVector());
   }
 
+  void readRequestFederationSaveMessage(RequestFederationSaveMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readString(value.getLabel());
+    readVariableLengthData(value.getTimeStamp());
+    readBool(value.getTimeStampValid());
+  }
+
+  void readInitiateFederateSaveMessage(InitiateFederateSaveMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readString(value.getLabel());
+    readVariableLengthData(value.getTimeStamp());
+    readBool(value.getTimeStampValid());
+  }
+
+  void readFederateSaveBegunMessage(FederateSaveBegunMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+  }
+
+  void readFederateSaveCompleteMessage(FederateSaveCompleteMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readBool(value.getSuccessful());
+    readSaveFailureReason(value.getSaveFailureReason());
+  }
+
+  void readFederationSavedMessage(FederationSavedMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readString(value.getLabel());
+    readBool(value.getSuccessful());
+    readSaveFailureReason(value.getSaveFailureReason());
+  }
+
+  void readAbortFederationSaveMessage(AbortFederationSaveMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+  }
+
+  void readQueryFederationSaveStatusRequestMessage(QueryFederationSaveStatusRequestMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+  }
+
+  void readQueryFederationSaveStatusResponseMessage(QueryFederationSaveStatusResponseMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readFederateHandleSaveStatusPairVector(value.getFederateHandleSaveStatusPairVector());
+  }
+
+  void readRequestFederationRestoreMessage(RequestFederationRestoreMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readString(value.getLabel());
+  }
+
+  void readRequestFederationRestoreResponseMessage(RequestFederationRestoreResponseMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readString(value.getLabel());
+    readBool(value.getSuccessful());
+  }
+
+  void readFederationRestoreBegunMessage(FederationRestoreBegunMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readString(value.getLabel());
+  }
+
+  void readInitiateFederateRestoreMessage(InitiateFederateRestoreMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readString(value.getLabel());
+    readString(value.getFederateName());
+  }
+
+  void readFederateRestoreCompleteMessage(FederateRestoreCompleteMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readBool(value.getSuccessful());
+  }
+
+  void readFederationRestoredMessage(FederationRestoredMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readString(value.getLabel());
+    readBool(value.getSuccessful());
+    readRestoreFailureReason(value.getRestoreFailureReason());
+  }
+
+  void readAbortFederationRestoreMessage(AbortFederationRestoreMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+  }
+
+  void readQueryFederationRestoreStatusRequestMessage(QueryFederationRestoreStatusRequestMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+  }
+
+  void readQueryFederationRestoreStatusResponseMessage(QueryFederationRestoreStatusResponseMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readFederateHandleRestoreStatusPairVector(value.getFederateHandleRestoreStatusPairVector());
+  }
+
   void readEnableTimeRegulationRequestMessage(EnableTimeRegulationRequestMessage& value)
   {
     readFederationHandle(value.getFederationHandle());
@@ -3363,6 +4277,14 @@ public:
     readUnsigned(value.getCommitId());
   }
 
+  void readCollectedCommitLowerBoundTimeStampMessage(CollectedCommitLowerBoundTimeStampMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readVariableLengthData(value.getTimeStamp());
+    readLowerBoundTimeStampCommitType(value.getCommitType());
+    readFederateHandleCommitIdPairVector(value.getFederateHandleCommitIdPairVector());
+  }
+
   void readCommitLowerBoundTimeStampResponseMessage(CommitLowerBoundTimeStampResponseMessage& value)
   {
     readFederationHandle(value.getFederationHandle());
@@ -3436,6 +4358,7 @@ public:
     readSubscriptionType(value.getSubscriptionType());
     readObjectClassHandle(value.getObjectClassHandle());
     readAttributeHandleVector(value.getAttributeHandles());
+    readDouble(value.getUpdateRate());
   }
 
   void readRegistrationForObjectClassMessage(RegistrationForObjectClassMessage& value)
@@ -3547,6 +4470,12 @@ public:
     readAttributeStateVector(value.getAttributeStateVector());
   }
 
+  void readInsertMultipleObjectInstancesMessage(InsertMultipleObjectInstancesMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readObjectInstanceStateVector(value.getObjectInstanceStateVector());
+  }
+
   void readDeleteObjectInstanceMessage(DeleteObjectInstanceMessage& value)
   {
     readFederationHandle(value.getFederationHandle());
@@ -3605,6 +4534,80 @@ public:
     readVariableLengthData(value.getTag());
   }
 
+  void readChangeAttributeTransportationTypeRequestMessage(ChangeAttributeTransportationTypeRequestMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readObjectInstanceHandle(value.getObjectInstanceHandle());
+    readAttributeHandleVector(value.getAttributeHandles());
+    readTransportationType(value.getTransportationType());
+  }
+
+  void readChangeAttributeTransportationTypeResponseMessage(ChangeAttributeTransportationTypeResponseMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readObjectInstanceHandle(value.getObjectInstanceHandle());
+    readAttributeHandleVector(value.getAttributeHandles());
+    readTransportationType(value.getTransportationType());
+  }
+
+  void readChangeInteractionTransportationTypeRequestMessage(ChangeInteractionTransportationTypeRequestMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readInteractionClassHandle(value.getInteractionClassHandle());
+    readTransportationType(value.getTransportationType());
+  }
+
+  void readChangeInteractionTransportationTypeResponseMessage(ChangeInteractionTransportationTypeResponseMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readInteractionClassHandle(value.getInteractionClassHandle());
+    readTransportationType(value.getTransportationType());
+  }
+
+  void readQueryAttributeTransportationTypeRequestMessage(QueryAttributeTransportationTypeRequestMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readObjectInstanceHandle(value.getObjectInstanceHandle());
+    readAttributeHandle(value.getAttributeHandle());
+  }
+
+  void readQueryAttributeTransportationTypeResponseMessage(QueryAttributeTransportationTypeResponseMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readObjectInstanceHandle(value.getObjectInstanceHandle());
+    readAttributeHandle(value.getAttributeHandle());
+    readTransportationType(value.getTransportationType());
+  }
+
+  void readQueryInteractionTransportationTypeRequestMessage(QueryInteractionTransportationTypeRequestMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readFederateHandle(value.getQueriedFederateHandle());
+    readInteractionClassHandle(value.getInteractionClassHandle());
+  }
+
+  void readQueryInteractionTransportationTypeResponseMessage(QueryInteractionTransportationTypeResponseMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readFederateHandle(value.getFederateHandle());
+    readFederateHandle(value.getQueriedFederateHandle());
+    readInteractionClassHandle(value.getInteractionClassHandle());
+    readTransportationType(value.getTransportationType());
+  }
+
+  void readMessageRetractionMessage(MessageRetractionMessage& value)
+  {
+    readFederationHandle(value.getFederationHandle());
+    readMessageRetractionHandle(value.getMessageRetractionHandle());
+  }
+
 private:
   TightBE1MessageEncoding& _messageEncoding;
 };
@@ -3656,6 +4659,16 @@ public:
     readPayloadVariableLengthData(value.getTag());
   }
 
+  void readPayloadRequestFederationSaveMessage(RequestFederationSaveMessage& value)
+  {
+    readPayloadVariableLengthData(value.getTimeStamp());
+  }
+
+  void readPayloadInitiateFederateSaveMessage(InitiateFederateSaveMessage& value)
+  {
+    readPayloadVariableLengthData(value.getTimeStamp());
+  }
+
   void readPayloadEnableTimeRegulationRequestMessage(EnableTimeRegulationRequestMessage& value)
   {
     readPayloadVariableLengthData(value.getTimeStamp());
@@ -3671,6 +4684,11 @@ public:
     readPayloadVariableLengthData(value.getTimeStamp());
   }
 
+  void readPayloadCollectedCommitLowerBoundTimeStampMessage(CollectedCommitLowerBoundTimeStampMessage& value)
+  {
+    readPayloadVariableLengthData(value.getTimeStamp());
+  }
+
   void readPayloadInteractionMessage(InteractionMessage& value)
   {
     readPayloadVariableLengthData(value.getTag());
@@ -3744,12 +4762,17 @@ TightBE1MessageEncoding::readPacket(const Buffer& buffer)
   } else if (++i == buffer.end()) {
     addScratchReadBuffer(buffer.front().getUInt32BE(0));
   } else if (++i == buffer.end()) {
+    MetricsScopeTimer metricsScopeTimer(Metrics::instance().getDecodeTime(), getSampleTime());
     decodeBody(*(--i));
   } else {
     decodePayload(i);
   }
-  if (getInputBufferComplete())
+  if (getInputBufferComplete() && _message.valid()) {
+    DecodeDataStream decodeStream(*(++buffer.begin()));
+    readMessageMetrics(decodeStream.readUInt16Compressed(), *_message, buffer);
+    attachMessageTrace(*_message);
     getConnect()->send(SharedPtr<AbstractMessage>().swap(_message));
+  }
 }
 
 void
@@ -3786,6 +4809,14 @@ TightBE1MessageEncoding::decodeBody(const VariableLengthData& variableLengthData
     _message = new EnumerateFederationExecutionsResponseMessage;
     decodeStream.readEnumerateFederationExecutionsResponseMessage(static_cast<EnumerateFederationExecutionsResponseMessage&>(*_message));
     break;
+  case 19:
+    _message = new MetricsRequestMessage;
+    decodeStream.readMetricsRequestMessage(static_cast<MetricsRequestMessage&>(*_message));
+    break;
+  case 20:
+    _message = new MetricsResponseMessage;
+    decodeStream.readMetricsResponseMessage(static_cast<MetricsResponseMessage&>(*_message));
+    break;
   case 8:
     _message = new InsertFederationExecutionMessage;
     decodeStream.readInsertFederationExecutionMessage(static_cast<InsertFederationExecutionMessage&>(*_message));
@@ -3850,6 +4881,74 @@ TightBE1MessageEncoding::decodeBody(const VariableLengthData& variableLengthData
     _message = new FederationSynchronizedMessage;
     decodeStream.readFederationSynchronizedMessage(static_cast<FederationSynchronizedMessage&>(*_message));
     break;
+  case 101:
+    _message = new RequestFederationSaveMessage;
+    decodeStream.readRequestFederationSaveMessage(static_cast<RequestFederationSaveMessage&>(*_message));
+    break;
+  case 102:
+    _message = new InitiateFederateSaveMessage;
+    decodeStream.readInitiateFederateSaveMessage(static_cast<InitiateFederateSaveMessage&>(*_message));
+    break;
+  case 103:
+    _message = new FederateSaveBegunMessage;
+    decodeStream.readFederateSaveBegunMessage(static_cast<FederateSaveBegunMessage&>(*_message));
+    break;
+  case 104:
+    _message = new FederateSaveCompleteMessage;
+    decodeStream.readFederateSaveCompleteMessage(static_cast<FederateSaveCompleteMessage&>(*_message));
+    break;
+  case 105:
+    _message = new FederationSavedMessage;
+    decodeStream.readFederationSavedMessage(static_cast<FederationSavedMessage&>(*_message));
+    break;
+  case 106:
+    _message = new AbortFederationSaveMessage;
+    decodeStream.readAbortFederationSaveMessage(static_cast<AbortFederationSaveMessage&>(*_message));
+    break;
+  case 107:
+    _message = new QueryFederationSaveStatusRequestMessage;
+    decodeStream.readQueryFederationSaveStatusRequestMessage(static_cast<QueryFederationSaveStatusRequestMessage&>(*_message));
+    break;
+  case 108:
+    _message = new QueryFederationSaveStatusResponseMessage;
+    decodeStream.readQueryFederationSaveStatusResponseMessage(static_cast<QueryFederationSaveStatusResponseMessage&>(*_message));
+    break;
+  case 109:
+    _message = new RequestFederationRestoreMessage;
+    decodeStream.readRequestFederationRestoreMessage(static_cast<RequestFederationRestoreMessage&>(*_message));
+    break;
+  case 110:
+    _message = new RequestFederationRestoreResponseMessage;
+    decodeStream.readRequestFederationRestoreResponseMessage(static_cast<RequestFederationRestoreResponseMessage&>(*_message));
+    break;
+  case 111:
+    _message = new FederationRestoreBegunMessage;
+    decodeStream.readFederationRestoreBegunMessage(static_cast<FederationRestoreBegunMessage&>(*_message));
+    break;
+  case 112:
+    _message = new InitiateFederateRestoreMessage;
+    decodeStream.readInitiateFederateRestoreMessage(static_cast<InitiateFederateRestoreMessage&>(*_message));
+    break;
+  case 113:
+    _message = new FederateRestoreCompleteMessage;
+    decodeStream.readFederateRestoreCompleteMessage(static_cast<FederateRestoreCompleteMessage&>(*_message));
+    break;
+  case 114:
+    _message = new FederationRestoredMessage;
+    decodeStream.readFederationRestoredMessage(static_cast<FederationRestoredMessage&>(*_message));
+    break;
+  case 115:
+    _message = new AbortFederationRestoreMessage;
+    decodeStream.readAbortFederationRestoreMessage(static_cast<AbortFederationRestoreMessage&>(*_message));
+    break;
+  case 116:
+    _message = new QueryFederationRestoreStatusRequestMessage;
+    decodeStream.readQueryFederationRestoreStatusRequestMessage(static_cast<QueryFederationRestoreStatusRequestMessage&>(*_message));
+    break;
+  case 117:
+    _message = new QueryFederationRestoreStatusResponseMessage;
+    decodeStream.readQueryFederationRestoreStatusResponseMessage(static_cast<QueryFederationRestoreStatusResponseMessage&>(*_message));
+    break;
   case 40:
     _message = new EnableTimeRegulationRequestMessage;
     decodeStream.readEnableTimeRegulationRequestMessage(static_cast<EnableTimeRegulationRequestMessage&>(*_message));
@@ -3866,6 +4965,10 @@ TightBE1MessageEncoding::decodeBody(const VariableLengthData& variableLengthData
     _message = new CommitLowerBoundTimeStampMessage;
     decodeStream.readCommitLowerBoundTimeStampMessage(static_cast<CommitLowerBoundTimeStampMessage&>(*_message));
     break;
+  case 49:
+    _message = new CollectedCommitLowerBoundTimeStampMessage;
+    decodeStream.readCollectedCommitLowerBoundTimeStampMessage(static_cast<CollectedCommitLowerBoundTimeStampMessage&>(*_message));
+    break;
   case 44:
     _message = new CommitLowerBoundTimeStampResponseMessage;
     decodeStream.readCommitLowerBoundTimeStampResponseMessage(static_cast<CommitLowerBoundTimeStampResponseMessage&>(*_message));
@@ -3942,6 +5045,10 @@ TightBE1MessageEncoding::decodeBody(const VariableLengthData& variableLengthData
     _message = new InsertObjectInstanceMessage;
     decodeStream.readInsertObjectInstanceMessage(static_cast<InsertObjectInstanceMessage&>(*_message));
     break;
+  case 100:
+    _message = new InsertMultipleObjectInstancesMessage;
+    decodeStream.readInsertMultipleObjectInstancesMessage(static_cast<InsertMultipleObjectInstancesMessage&>(*_message));
+    break;
   case 91:
     _message = new DeleteObjectInstanceMessage;
     decodeStream.readDeleteObjectInstanceMessage(static_cast<DeleteObjectInstanceMessage&>(*_message));
@@ -3966,6 +5073,51 @@ TightBE1MessageEncoding::decodeBody(const VariableLengthData& variableLengthData
     _message = new RequestClassAttributeUpdateMessage;
     decodeStream.readRequestClassAttributeUpdateMessage(static_cast<RequestClassAttributeUpdateMessage&>(*_message));
     break;
+  case 118:
+    _message = new ChangeAttributeTransportationTypeRequestMessage;
+    decodeStream.readChangeAttributeTransportationTypeRequestMessage(static_cast<ChangeAttributeTransportationTypeRequestMessage&>(*_message));
+    break;
+  case 119:
+    _message = new ChangeAttributeTransportationTypeResponseMessage;
+    decodeStream.readChangeAttributeTransportationTypeResponseMessage(static_cast<ChangeAttributeTransportationTypeResponseMessage&>(*_message));
+    break;
+  case 120:
+    _message = new ChangeInteractionTransportationTypeRequestMessage;
+    decodeStream.readChangeInteractionTransportationTypeRequestMessage(static_cast<ChangeInteractionTransportationTypeRequestMessage&>(*_message));
+    break;
+  case 121:
+    _message = new ChangeInteractionTransportationTypeResponseMessage;
+    decodeStream.readChangeInteractionTransportationTypeResponseMessage(static_cast<ChangeInteractionTransportationTypeResponseMessage&>(*_message));
+    break;
+  case 122:
+    _message = new QueryAttributeTransportationTypeRequestMessage;
+    decodeStream.readQueryAttributeTransportationTypeRequestMessage(static_cast<QueryAttributeTransportationTypeRequestMessage&>(*_message));
+    break;
+  case 123:
+    _message = new QueryAttributeTransportationTypeResponseMessage;
+    decodeStream.readQueryAttributeTransportationTypeResponseMessage(static_cast<QueryAttributeTransportationTypeResponseMessage&>(*_message));
+    break;
+  case 124:
+    _message = new QueryInteractionTransportationTypeRequestMessage;
+    decodeStream.readQueryInteractionTransportationTypeRequestMessage(static_cast<QueryInteractionTransportationTypeRequestMessage&>(*_message));
+    break;
+  case 125:
+    _message = new QueryInteractionTransportationTypeResponseMessage;
+    decodeStream.readQueryInteractionTransportationTypeResponseMessage(static_cast<QueryInteractionTransportationTypeResponseMessage&>(*_message));
+    break;
+  case 99:
+    _message = new MessageRetractionMessage;
+    decodeStream.readMessageRetractionMessage(static_cast<MessageRetractionMessage&>(*_message));
+    break;
+  case MessageTraceOpcode:
+    readMessageTrace(decodeStream);
+    break;
+  case MessageFragmentOpcode:
+    readMessageFragment(decodeStream, variableLengthData);
+    break;
+  case MessageDeltaOpcode:
+    _message = readMessageDelta(decodeStream);
+    break;
   default:
     break;
   }
@@ -3985,6 +5137,12 @@ TightBE1MessageEncoding::decodePayload(const Buffer::const_iterator& i)
   case 32:
     payloadDecoder.readPayloadAnnounceSynchronizationPointMessage(static_cast<AnnounceSynchronizationPointMessage&>(*_message));
     break;
+  case 101:
+    payloadDecoder.readPayloadRequestFederationSaveMessage(static_cast<RequestFederationSaveMessage&>(*_message));
+    break;
+  case 102:
+    payloadDecoder.readPayloadInitiateFederateSaveMessage(static_cast<InitiateFederateSaveMessage&>(*_message));
+    break;
   case 40:
     payloadDecoder.readPayloadEnableTimeRegulationRequestMessage(static_cast<EnableTimeRegulationRequestMessage&>(*_message));
     break;
@@ -3994,6 +5152,9 @@ TightBE1MessageEncoding::decodePayload(const Buffer::const_iterator& i)
   case 43:
     payloadDecoder.readPayloadCommitLowerBoundTimeStampMessage(static_cast<CommitLowerBoundTimeStampMessage&>(*_message));
     break;
+  case 49:
+    payloadDecoder.readPayloadCollectedCommitLowerBoundTimeStampMessage(static_cast<CollectedCommitLowerBoundTimeStampMessage&>(*_message));
+    break;
   case 80:
     payloadDecoder.readPayloadInteractionMessage(static_cast<InteractionMessage&>(*_message));
     break;
@@ -4026,7 +5187,72 @@ TightBE1MessageEncoding::decodePayload(const Buffer::const_iterator& i)
 void
 TightBE1MessageEncoding::writeMessage(const AbstractMessage& message)
 {
-  message.dispatchFunctor(DispatchFunctor(*this));
+  bool messageTrace;
+  {
+    MetricsScopeTimer metricsScopeTimer(Metrics::instance().getEncodeTime(), getSampleTime());
+    messageTrace = writeMessageTrace(message);
+    message.dispatchFunctor(DispatchFunctor(*this));
+  }
+  // Skip the header and body of the trace packet
+  Buffer::const_iterator i = getOutputBuffer().begin();
+  if (messageTrace)
+    std::advance(i, 2);
+  DecodeDataStream decodeStream(*(++i));
+  writeMessageMetrics(decodeStream.readUInt16Compressed(), message, getOutputBuffer());
+}
+
+void
+TightBE1MessageEncoding::encodeFederationSaveHeader(VariableLengthData& variableLengthData, const FederationSaveHeader& value)
+{
+  TightBE1MessageEncoding messageEncoding;
+  EncodeStream encodeStream(variableLengthData, messageEncoding);
+  encodeStream.writeFederationSaveHeader(value);
+}
+
+void
+TightBE1MessageEncoding::decodeFederationSaveHeader(FederationSaveHeader& value, const VariableLengthData& variableLengthData)
+{
+  TightBE1MessageEncoding messageEncoding;
+  DecodeStream decodeStream(variableLengthData, messageEncoding);
+  decodeStream.readFederationSaveHeader(value);
+  if (decodeStream.offset() != decodeStream.size())
+    throw RTIinternalError("Trailing data after FederationSaveHeader!");
+}
+
+void
+TightBE1MessageEncoding::encodeFederationSaveObjectInstanceVector(VariableLengthData& variableLengthData, const FederationSaveObjectInstanceVector& value)
+{
+  TightBE1MessageEncoding messageEncoding;
+  EncodeStream encodeStream(variableLengthData, messageEncoding);
+  encodeStream.writeFederationSaveObjectInstanceVector(value);
+}
+
+void
+TightBE1MessageEncoding::decodeFederationSaveObjectInstanceVector(FederationSaveObjectInstanceVector& value, const VariableLengthData& variableLengthData)
+{
+  TightBE1MessageEncoding messageEncoding;
+  DecodeStream decodeStream(variableLengthData, messageEncoding);
+  decodeStream.readFederationSaveObjectInstanceVector(value);
+  if (decodeStream.offset() != decodeStream.size())
+    throw RTIinternalError("Trailing data after FederationSaveObjectInstanceVector!");
+}
+
+void
+TightBE1MessageEncoding::encodeFOMStringModuleList(VariableLengthData& variableLengthData, const FOMStringModuleList& value)
+{
+  TightBE1MessageEncoding messageEncoding;
+  EncodeStream encodeStream(variableLengthData, messageEncoding);
+  encodeStream.writeFOMStringModuleList(value);
+}
+
+void
+TightBE1MessageEncoding::decodeFOMStringModuleList(FOMStringModuleList& value, const VariableLengthData& variableLengthData)
+{
+  TightBE1MessageEncoding messageEncoding;
+  DecodeStream decodeStream(variableLengthData, messageEncoding);
+  decodeStream.readFOMStringModuleList(value);
+  if (decodeStream.offset() != decodeStream.size())
+    throw RTIinternalError("Trailing data after FOMStringModuleList!");
 }
 
 } // namespace OpenRTI
@@ -25,6 +25,7 @@
 
 #include "AbstractMessageEncoding.h"
 #include "Export.h"
+#include "Message.h"
 
 namespace OpenRTI {
 
@@ -40,6 +41,14 @@ public:
   void decodePayload(const Buffer::const_iterator& i);
   virtual void writeMessage(const AbstractMessage& message);
 
+  // Encode and decode values outside of a message, for example into files
+  static void encodeFederationSaveHeader(VariableLengthData& variableLengthData, const FederationSaveHeader& value);
+  static void decodeFederationSaveHeader(FederationSaveHeader& value, const VariableLengthData& variableLengthData);
+  static void encodeFederationSaveObjectInstanceVector(VariableLengthData& variableLengthData, const FederationSaveObjectInstanceVector& value);
+  static void decodeFederationSaveObjectInstanceVector(FederationSaveObjectInstanceVector& value, const VariableLengthData& variableLengthData);
+  static void encodeFOMStringModuleList(VariableLengthData& variableLengthData, const FOMStringModuleList& value);
+  static void decodeFOMStringModuleList(FOMStringModuleList& value, const VariableLengthData& variableLengthData);
+
 private:
   class DecodeStream;
   class DispatchFunctor;
@@ -58,6 +58,9 @@ public:
   virtual void modifyLookahead(InternalAmbassador& ambassador, const NativeLogicalTimeInterval& nativeLookahead) = 0;
   virtual void queryLookahead(InternalAmbassador& ambassador, NativeLogicalTimeInterval& logicalTimeInterval) = 0;
 
+  virtual void insertRetractableMessage(const MessageRetractionHandle& messageRetractionHandle, const NativeLogicalTime& nativeLogicalTime) = 0;
+  virtual bool retract(InternalAmbassador& ambassador, const MessageRetractionHandle& messageRetractionHandle) = 0;
+
   virtual std::string logicalTimeToString(const NativeLogicalTime& nativeLogicalTime) = 0;
   virtual std::string logicalTimeIntervalToString(const NativeLogicalTimeInterval& nativeLogicalTimeInterval) = 0;
   virtual bool isPositiveLogicalTimeInterval(const NativeLogicalTimeInterval& nativeLogicalTimeInterval) = 0;
@@ -67,6 +70,7 @@ public:
   virtual void acceptCallbackMessage(Ambassador<T>& ambassador, const TimeConstrainedEnabledMessage& message) = 0;
   virtual void acceptCallbackMessage(Ambassador<T>& ambassador, const TimeRegulationEnabledMessage& message) = 0;
   virtual void acceptCallbackMessage(Ambassador<T>& ambassador, const TimeAdvanceGrantedMessage& message) = 0;
+  virtual void acceptCallbackMessage(Ambassador<T>& ambassador, const InitiateFederateSaveMessage& message) = 0;
   virtual void reflectAttributeValues(Ambassador<T>& ambassador, const Federate::ObjectClass& objectClass,
                                       const TimeStampedAttributeUpdateMessage& message) = 0;
   virtual void removeObjectInstance(Ambassador<T>& ambassador, const TimeStampedDeleteObjectInstanceMessage& message) = 0;
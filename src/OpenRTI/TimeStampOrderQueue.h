@@ -0,0 +1,282 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_TimeStampOrderQueue_h
+#define OpenRTI_TimeStampOrderQueue_h
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Exception.h"
+#include "IntrusiveList.h"
+#include "Types.h"
+
+namespace OpenRTI {
+
+/// Queue of intrusive lists of elements sorted by a time stamp key.
+/// Elements with the same key are kept in the order they are pushed.
+/// Elements can be unlinked from their list at any time, the front list
+/// may thus be empty and is then just popped by the user.
+///
+/// Two implementations are available. The default one keeps a std::map
+/// with a list per key, which costs a tree lookup on each push.
+/// The heap implementation keeps the lists in a pairing heap. Pushes are
+/// constant time and append to the most recently pushed list if the key
+/// matches. The lists are allocated in slabs and reused. That way clustered
+/// time stamps are dispatched from one list in constant time and only moving
+/// on to the next list costs a logarithmic heap pop.
+template<typename K, typename T>
+class OPENRTI_LOCAL TimeStampOrderQueue {
+public:
+  typedef K key_type;
+  typedef IntrusiveList<T> List;
+
+  enum Type {
+    MapType,
+    HeapType
+  };
+
+  TimeStampOrderQueue(Type type = MapType) :
+    _type(type),
+    _root(0),
+    _backBucket(0),
+    _freeBuckets(0),
+    _serial(0)
+  { }
+  ~TimeStampOrderQueue()
+  {
+    unlink();
+    for (typename std::vector<_Bucket*>::iterator i = _slabs.begin(); i != _slabs.end(); ++i)
+      delete [] *i;
+  }
+
+  Type getType() const
+  { return _type; }
+  /// Only possible on an empty queue
+  void setType(Type type)
+  {
+    OpenRTIAssert(empty());
+    _type = type;
+  }
+
+  bool empty() const
+  {
+    if (_type == MapType)
+      return _map.empty();
+    else
+      return !_root;
+  }
+
+  const key_type& frontKey() const
+  {
+    OpenRTIAssert(!empty());
+    if (_type == MapType)
+      return _map.begin()->first;
+    else
+      return _root->_key;
+  }
+  List& frontList()
+  {
+    OpenRTIAssert(!empty());
+    if (_type == MapType)
+      return _map.begin()->second;
+    else
+      return _root->_list;
+  }
+  /// Remove the front list, which must be empty already
+  void popFront()
+  {
+    OpenRTIAssert(!empty());
+    OpenRTIAssert(frontList().empty());
+    if (_type == MapType) {
+      _map.erase(_map.begin());
+    } else {
+      _Bucket* bucket = _root;
+      _root = _mergePairs(bucket->_child);
+      if (_backBucket == bucket)
+        _backBucket = 0;
+      bucket->_child = 0;
+      bucket->_sibling = _freeBuckets;
+      _freeBuckets = bucket;
+    }
+  }
+
+  void push(const key_type& key, T& t)
+  {
+    if (_type == MapType) {
+      _map[key].push_back(t);
+    } else {
+      // Still the same time stamp than the last one, just append
+      if (_backBucket && !(_backBucket->_key < key) && !(key < _backBucket->_key)) {
+        _backBucket->_list.push_back(t);
+        return;
+      }
+      _Bucket* bucket = _allocateBucket();
+      bucket->_key = key;
+      bucket->_serial = ++_serial;
+      bucket->_list.push_back(t);
+      _root = _meld(_root, bucket);
+      _backBucket = bucket;
+    }
+  }
+
+  /// Unlink all elements and remove all lists
+  void unlink()
+  {
+    while (!empty()) {
+      frontList().unlink();
+      popFront();
+    }
+  }
+
+  typedef std::pair<key_type, const List*> KeyListPair;
+  typedef std::vector<KeyListPair> KeyListPairVector;
+
+  /// Collect all lists in the order they are popped without modifying the queue.
+  /// Lists may be empty. This is meant for snapshots and not for the dispatch path.
+  void getKeyListPairVector(KeyListPairVector& keyListPairVector) const
+  {
+    keyListPairVector.clear();
+    if (_type == MapType) {
+      keyListPairVector.reserve(_map.size());
+      for (typename _Map::const_iterator i = _map.begin(); i != _map.end(); ++i)
+        keyListPairVector.push_back(KeyListPair(i->first, &i->second));
+    } else {
+      std::vector<const _Bucket*> buckets;
+      std::vector<const _Bucket*> stack;
+      if (_root)
+        stack.push_back(_root);
+      while (!stack.empty()) {
+        const _Bucket* bucket = stack.back();
+        stack.pop_back();
+        buckets.push_back(bucket);
+        if (bucket->_child)
+          stack.push_back(bucket->_child);
+        if (bucket->_sibling)
+          stack.push_back(bucket->_sibling);
+      }
+      std::sort(buckets.begin(), buckets.end(), _less);
+      keyListPairVector.reserve(buckets.size());
+      for (typename std::vector<const _Bucket*>::const_iterator i = buckets.begin(); i != buckets.end(); ++i)
+        keyListPairVector.push_back(KeyListPair((*i)->_key, &(*i)->_list));
+    }
+  }
+
+private:
+  TimeStampOrderQueue(const TimeStampOrderQueue&);
+  TimeStampOrderQueue& operator=(const TimeStampOrderQueue&);
+
+  struct _Bucket {
+    _Bucket() : _serial(0), _child(0), _sibling(0)
+    { }
+    key_type _key;
+    // Orders lists with the same key in the order they are created
+    uint64_t _serial;
+    List _list;
+    _Bucket* _child;
+    _Bucket* _sibling;
+  };
+
+  enum { SlabSize = 64 };
+
+  _Bucket* _allocateBucket()
+  {
+    if (!_freeBuckets) {
+      _Bucket* slab = new _Bucket[SlabSize];
+      _slabs.push_back(slab);
+      for (unsigned i = 0; i < SlabSize; ++i) {
+        slab[i]._sibling = _freeBuckets;
+        _freeBuckets = slab + i;
+      }
+    }
+    _Bucket* bucket = _freeBuckets;
+    _freeBuckets = bucket->_sibling;
+    bucket->_sibling = 0;
+    return bucket;
+  }
+
+  static bool _less(const _Bucket* bucket0, const _Bucket* bucket1)
+  {
+    if (bucket0->_key < bucket1->_key)
+      return true;
+    if (bucket1->_key < bucket0->_key)
+      return false;
+    return bucket0->_serial < bucket1->_serial;
+  }
+  static _Bucket* _meld(_Bucket* bucket0, _Bucket* bucket1)
+  {
+    if (!bucket0)
+      return bucket1;
+    if (!bucket1)
+      return bucket0;
+    if (_less(bucket1, bucket0))
+      std::swap(bucket0, bucket1);
+    bucket1->_sibling = bucket0->_child;
+    bucket0->_child = bucket1;
+    return bucket0;
+  }
+  /// The usual two pass pairing of the children of a popped root
+  static _Bucket* _mergePairs(_Bucket* bucket)
+  {
+    // Meld pairs from the left, collect the results in reverse order
+    _Bucket* pairs = 0;
+    while (bucket) {
+      _Bucket* bucket0 = bucket;
+      _Bucket* bucket1 = bucket0->_sibling;
+      if (bucket1) {
+        bucket = bucket1->_sibling;
+        bucket0->_sibling = 0;
+        bucket1->_sibling = 0;
+        bucket0 = _meld(bucket0, bucket1);
+      } else {
+        bucket = 0;
+      }
+      bucket0->_sibling = pairs;
+      pairs = bucket0;
+    }
+    // And meld these from the right
+    _Bucket* root = 0;
+    while (pairs) {
+      _Bucket* next = pairs->_sibling;
+      pairs->_sibling = 0;
+      root = _meld(root, pairs);
+      pairs = next;
+    }
+    return root;
+  }
+
+  Type _type;
+
+  // The map implementation
+  typedef std::map<key_type, List> _Map;
+  _Map _map;
+
+  // The heap implementation
+  _Bucket* _root;
+  _Bucket* _backBucket;
+  _Bucket* _freeBuckets;
+  std::vector<_Bucket*> _slabs;
+  uint64_t _serial;
+};
+
+} // namespace OpenRTI
+
+#endif
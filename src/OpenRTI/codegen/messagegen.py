@@ -74,10 +74,18 @@ class DataType(object):
         self.__name = name
         self.__hasSwap = hasSwap
         self._hasPayload = None
+        self.__standalone = False
 
     def getName(self):
         return self.__name
 
+    # Standalone types get encode and decode functions outside of messages
+    def setStandalone(self, standalone):
+        self.__standalone = standalone
+
+    def isStandalone(self):
+        return self.__standalone
+
     def isMessage(self):
         return False
 
@@ -675,6 +683,8 @@ class MessageDataType(StructDataType):
         StructDataType.__init__(self, name, parentTypeName)
         self.__reliableExpression = None
         self.__objectInstanceExpression = None
+        self.__messageRetractionExpression = None
+        self.__priorityExpression = None
          
     def isMessage(self):
         return True
@@ -691,6 +701,18 @@ class MessageDataType(StructDataType):
     def getObjectInstanceExpression(self):
         return self.__objectInstanceExpression
 
+    def setMessageRetractionExpression(self, messageRetractionExpression):
+        self.__messageRetractionExpression = messageRetractionExpression
+
+    def getMessageRetractionExpression(self):
+        return self.__messageRetractionExpression
+
+    def setPriorityExpression(self, priorityExpression):
+        self.__priorityExpression = priorityExpression
+
+    def getPriorityExpression(self):
+        return self.__priorityExpression
+
     def writeForwardDeclaration(self, sourceStream):
         sourceStream.writeline('class {name};'.format(name = self.getName()))
 
@@ -731,6 +753,14 @@ class MessageDataType(StructDataType):
             sourceStream.writeline('virtual ObjectInstanceHandle getObjectInstanceHandleForMessage() const;')
             sourceStream.writeline()
 
+        if self.getMessageRetractionExpression():
+            sourceStream.writeline('virtual MessageRetractionHandle getMessageRetractionHandleForMessage() const;')
+            sourceStream.writeline()
+
+        if self.getPriorityExpression():
+            sourceStream.writeline('virtual Priority getPriority() const;')
+            sourceStream.writeline()
+
         for field in self.getFieldList():
             field.writeSetter(sourceStream, '')
             field.writeGetter(sourceStream, '')
@@ -834,6 +864,22 @@ class MessageDataType(StructDataType):
             sourceStream.writeline('  return {expression};'.format(expression = self.getObjectInstanceExpression()))
             sourceStream.writeline('}')
 
+        if self.getMessageRetractionExpression():
+            sourceStream.writeline()
+            sourceStream.writeline('MessageRetractionHandle')
+            sourceStream.writeline('{name}::getMessageRetractionHandleForMessage() const'.format(name = self.getName()))
+            sourceStream.writeline('{')
+            sourceStream.writeline('  return {expression};'.format(expression = self.getMessageRetractionExpression()))
+            sourceStream.writeline('}')
+
+        if self.getPriorityExpression():
+            sourceStream.writeline()
+            sourceStream.writeline('AbstractMessage::Priority')
+            sourceStream.writeline('{name}::getPriority() const'.format(name = self.getName()))
+            sourceStream.writeline('{')
+            sourceStream.writeline('  return {expression};'.format(expression = self.getPriorityExpression()))
+            sourceStream.writeline('}')
+
         sourceStream.writeline()
 
 
@@ -862,6 +908,8 @@ class MessageEncoding(object):
             'JoinFederateNotifyMessage' : 16,
             'ResignFederateNotifyMessage' : 17,
             'ChangeAutomaticResignDirectiveMessage' : 18,
+            'MetricsRequestMessage' : 19,
+            'MetricsResponseMessage' : 20,
             'RegisterFederationSynchronizationPointMessage' : 30,
             'RegisterFederationSynchronizationPointResponseMessage' : 31,
             'AnnounceSynchronizationPointMessage' : 32,
@@ -876,6 +924,7 @@ class MessageEncoding(object):
             'InsertRegionMessage' : 46,
             'CommitRegionMessage' : 47,
             'EraseRegionMessage' : 48,
+            'CollectedCommitLowerBoundTimeStampMessage' : 49,
             'ChangeInteractionClassPublicationMessage' : 50,
             'ChangeObjectClassPublicationMessage' : 51,
             'ChangeInteractionClassSubscriptionMessage' : 52,
@@ -897,7 +946,34 @@ class MessageEncoding(object):
             'AttributeUpdateMessage' : 94,
             'TimeStampedAttributeUpdateMessage' : 96,
             'RequestAttributeUpdateMessage' : 97,
-            'RequestClassAttributeUpdateMessage' : 98
+            'RequestClassAttributeUpdateMessage' : 98,
+            'MessageRetractionMessage' : 99,
+            'InsertMultipleObjectInstancesMessage' : 100,
+            'RequestFederationSaveMessage' : 101,
+            'InitiateFederateSaveMessage' : 102,
+            'FederateSaveBegunMessage' : 103,
+            'FederateSaveCompleteMessage' : 104,
+            'FederationSavedMessage' : 105,
+            'AbortFederationSaveMessage' : 106,
+            'QueryFederationSaveStatusRequestMessage' : 107,
+            'QueryFederationSaveStatusResponseMessage' : 108,
+            'RequestFederationRestoreMessage' : 109,
+            'RequestFederationRestoreResponseMessage' : 110,
+            'FederationRestoreBegunMessage' : 111,
+            'InitiateFederateRestoreMessage' : 112,
+            'FederateRestoreCompleteMessage' : 113,
+            'FederationRestoredMessage' : 114,
+            'AbortFederationRestoreMessage' : 115,
+            'QueryFederationRestoreStatusRequestMessage' : 116,
+            'QueryFederationRestoreStatusResponseMessage' : 117,
+            'ChangeAttributeTransportationTypeRequestMessage' : 118,
+            'ChangeAttributeTransportationTypeResponseMessage' : 119,
+            'ChangeInteractionTransportationTypeRequestMessage' : 120,
+            'ChangeInteractionTransportationTypeResponseMessage' : 121,
+            'QueryAttributeTransportationTypeRequestMessage' : 122,
+            'QueryAttributeTransportationTypeResponseMessage' : 123,
+            'QueryInteractionTransportationTypeRequestMessage' : 124,
+            'QueryInteractionTransportationTypeResponseMessage' : 125
         }
 
     def getName(self):
@@ -1211,6 +1287,7 @@ class MessageEncoding(object):
         sourceStream.writeline()
         sourceStream.writeline('#include "AbstractMessageEncoding.h"')
         sourceStream.writeline('#include "Export.h"')
+        sourceStream.writeline('#include "Message.h"')
         sourceStream.writeline()
         sourceStream.writeline('namespace OpenRTI {')
         sourceStream.writeline()
@@ -1231,6 +1308,15 @@ class MessageEncoding(object):
         sourceStream.writeline('virtual void writeMessage(const AbstractMessage& message);')
         sourceStream.writeline()
 
+        standaloneTypeList = [t for t in messageMap.getTypeList() if t.isStandalone()]
+        if standaloneTypeList:
+            sourceStream.writeline('// Encode and decode values outside of a message, for example into files')
+        for t in standaloneTypeList:
+            sourceStream.writeline('static void encode{typeName}(VariableLengthData& variableLengthData, const {typeName}& value);'.format(typeName = t.getName()))
+            sourceStream.writeline('static void decode{typeName}({typeName}& value, const VariableLengthData& variableLengthData);'.format(typeName = t.getName()))
+        if standaloneTypeList:
+            sourceStream.writeline()
+
         sourceStream.popIndent()
         sourceStream.writeline('private:')
         sourceStream.pushIndent()
@@ -1254,11 +1340,14 @@ class MessageEncoding(object):
         sourceStream.writeCopyright()
         sourceStream.writeline()
         sourceStream.writeline('#include "' + encodingName + 'MessageEncoding.h"')
+        sourceStream.writeline()
+        sourceStream.writeline('#include <iterator>')
         sourceStream.writeline('#include "AbstractMessageEncoding.h"')
         sourceStream.writeline('#include "DecodeDataStream.h"')
         sourceStream.writeline('#include "EncodeDataStream.h"')
         sourceStream.writeline('#include "Export.h"')
         sourceStream.writeline('#include "Message.h"')
+        sourceStream.writeline('#include "Metrics.h"')
         sourceStream.writeline()
         sourceStream.writeline('namespace OpenRTI {')
         sourceStream.writeline()
@@ -1389,12 +1478,19 @@ class MessageEncoding(object):
         sourceStream.writeline('} else if (++i == buffer.end()) {')
         sourceStream.writeline('  addScratchReadBuffer(buffer.front().getUInt32BE(0));')
         sourceStream.writeline('} else if (++i == buffer.end()) {')
+        sourceStream.writeline('  MetricsScopeTimer metricsScopeTimer(Metrics::instance().getDecodeTime(), getSampleTime());')
         sourceStream.writeline('  decodeBody(*(--i));')
         sourceStream.writeline('} else {')
         sourceStream.writeline('  decodePayload(i);')
         sourceStream.writeline('}')
-        sourceStream.writeline('if (getInputBufferComplete())')
-        sourceStream.writeline('  getConnect()->send(SharedPtr<AbstractMessage>().swap(_message));')
+        sourceStream.writeline('if (getInputBufferComplete() && _message.valid()) {')
+        sourceStream.pushIndent()
+        sourceStream.writeline('DecodeDataStream decodeStream(*(++buffer.begin()));')
+        sourceStream.writeline('readMessageMetrics(decodeStream.readUInt16Compressed(), *_message, buffer);')
+        sourceStream.writeline('attachMessageTrace(*_message);')
+        sourceStream.writeline('getConnect()->send(SharedPtr<AbstractMessage>().swap(_message));')
+        sourceStream.popIndent()
+        sourceStream.writeline('}')
         sourceStream.popIndent()
         sourceStream.writeline('}')
         sourceStream.writeline()
@@ -1419,6 +1515,15 @@ class MessageEncoding(object):
             sourceStream.writeline('break;')
             sourceStream.popIndent()
 
+        sourceStream.writeline('case MessageTraceOpcode:')
+        sourceStream.writeline('  readMessageTrace(decodeStream);')
+        sourceStream.writeline('  break;')
+        sourceStream.writeline('case MessageFragmentOpcode:')
+        sourceStream.writeline('  readMessageFragment(decodeStream, variableLengthData);')
+        sourceStream.writeline('  break;')
+        sourceStream.writeline('case MessageDeltaOpcode:')
+        sourceStream.writeline('  _message = readMessageDelta(decodeStream);')
+        sourceStream.writeline('  break;')
         sourceStream.writeline('default:')
         sourceStream.writeline('  break;')
         sourceStream.writeline('}')
@@ -1457,10 +1562,49 @@ class MessageEncoding(object):
         sourceStream.writeline('void')
         sourceStream.writeline(encodingName + 'MessageEncoding::writeMessage(const AbstractMessage& message)')
         sourceStream.writeline('{')
+        sourceStream.pushIndent()
+        sourceStream.writeline('bool messageTrace;')
+        sourceStream.writeline('{')
+        sourceStream.writeline('  MetricsScopeTimer metricsScopeTimer(Metrics::instance().getEncodeTime(), getSampleTime());')
+        sourceStream.writeline('  messageTrace = writeMessageTrace(message);')
         sourceStream.writeline('  message.dispatchFunctor(DispatchFunctor(*this));')
         sourceStream.writeline('}')
+        sourceStream.writeline('// Skip the header and body of the trace packet')
+        sourceStream.writeline('Buffer::const_iterator i = getOutputBuffer().begin();')
+        sourceStream.writeline('if (messageTrace)')
+        sourceStream.writeline('  std::advance(i, 2);')
+        sourceStream.writeline('DecodeDataStream decodeStream(*(++i));')
+        sourceStream.writeline('writeMessageMetrics(decodeStream.readUInt16Compressed(), message, getOutputBuffer());')
+        sourceStream.popIndent()
+        sourceStream.writeline('}')
         sourceStream.writeline()
 
+        for t in messageMap.getTypeList():
+            if not t.isStandalone():
+                continue
+            sourceStream.writeline('void')
+            sourceStream.writeline(encodingClass + '::encode{typeName}(VariableLengthData& variableLengthData, const {typeName}& value)'.format(typeName = t.getName()))
+            sourceStream.writeline('{')
+            sourceStream.pushIndent()
+            sourceStream.writeline(encodingClass + ' messageEncoding;')
+            sourceStream.writeline('EncodeStream encodeStream(variableLengthData, messageEncoding);')
+            sourceStream.writeline('encodeStream.write{typeName}(value);'.format(typeName = t.getName()))
+            sourceStream.popIndent()
+            sourceStream.writeline('}')
+            sourceStream.writeline()
+            sourceStream.writeline('void')
+            sourceStream.writeline(encodingClass + '::decode{typeName}({typeName}& value, const VariableLengthData& variableLengthData)'.format(typeName = t.getName()))
+            sourceStream.writeline('{')
+            sourceStream.pushIndent()
+            sourceStream.writeline(encodingClass + ' messageEncoding;')
+            sourceStream.writeline('DecodeStream decodeStream(variableLengthData, messageEncoding);')
+            sourceStream.writeline('decodeStream.read{typeName}(value);'.format(typeName = t.getName()))
+            sourceStream.writeline('if (decodeStream.offset() != decodeStream.size())')
+            sourceStream.writeline('  throw RTIinternalError("Trailing data after {typeName}!");'.format(typeName = t.getName()))
+            sourceStream.popIndent()
+            sourceStream.writeline('}')
+            sourceStream.writeline()
+
         sourceStream.writeline('} // namespace OpenRTI')
         sourceStream.writeline()
 
@@ -1498,6 +1642,10 @@ class TypeMap(object):
                             message.setReliableExpression(field.prop('expression'))
                         elif field.type == 'element' and field.name == 'objectInstance':
                             message.setObjectInstanceExpression(field.prop('expression'))
+                        elif field.type == 'element' and field.name == 'messageRetraction':
+                            message.setMessageRetractionExpression(field.prop('expression'))
+                        elif field.type == 'element' and field.name == 'priority':
+                            message.setPriorityExpression(field.prop('expression'))
                         field = field.next
                     self.addType(message)
 
@@ -1536,11 +1684,16 @@ class TypeMap(object):
                     else:
                         dataType = CDataType(node.prop('name'), node.prop('encoding'), node.prop('ctype'))
                         self.addType(dataType)
+                    self.__typeList[-1].setStandalone(node.prop('standalone') == 'true')
             node = node.next
 
         for t in self.__typeList:
             t.resolveHasPayloadAndHasSwap(self)
 
+        for t in self.__typeList:
+            if t.isStandalone() and t.hasPayload():
+                raise Exception('Standalone type ' + t.getName() + ' must not contain payload')
+
     def addType(self, t):
         self.__typeList.append(t)
         self.__typeMap[t.getName()] = t
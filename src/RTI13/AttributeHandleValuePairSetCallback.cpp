@@ -83,6 +83,16 @@ AttributeHandleValuePairSetCallback::getValuePointer(RTI::ULong index, RTI::ULon
   return _attributeValues[index].getValue().charData();
 }
 
+const OpenRTI::VariableLengthData&
+AttributeHandleValuePairSetCallback::constData(RTI::ULong index) const
+  RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+{
+  if (_attributeValues.size() <= index)
+    throw RTI::ArrayIndexOutOfBounds("Array Index out of bounds in constData()");
+  // The value may be shared with the received message, so do not make it private
+  return _attributeValues[index].getValue();
+}
+
 RTI::TransportType
 AttributeHandleValuePairSetCallback::getTransportType(RTI::ULong index) const
   RTI_THROW ((RTI::InvalidHandleValuePairSetContext))
@@ -66,6 +66,10 @@ public:
   std::vector<OpenRTI::AttributeValue>& getAttributeValues()
   { return _attributeValues; }
 
+  // Read only access to the value without making it private
+  const OpenRTI::VariableLengthData& constData(RTI::ULong index) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds));
+
 private:
   mutable std::vector<OpenRTI::AttributeValue> _attributeValues;
   RTI::TransportType _transportType;
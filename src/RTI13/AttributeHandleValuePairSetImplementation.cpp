@@ -82,6 +82,16 @@ AttributeHandleValuePairSetImplementation::getValuePointer(RTI::ULong index, RTI
   return _attributeValues[index].getValue().charData();
 }
 
+const OpenRTI::VariableLengthData&
+AttributeHandleValuePairSetImplementation::constData(RTI::ULong index) const
+  RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+{
+  if (_attributeValues.size() <= index)
+    throw RTI::ArrayIndexOutOfBounds("Array Index out of bounds in constData()");
+  // The value may be shared with other copies, so do not make it private
+  return _attributeValues[index].getValue();
+}
+
 RTI::TransportType
 AttributeHandleValuePairSetImplementation::getTransportType(RTI::ULong index) const
   RTI_THROW ((RTI::InvalidHandleValuePairSetContext))
@@ -85,6 +85,16 @@ ParameterHandleValuePairSetCallback::getValuePointer(RTI::ULong index, RTI::ULon
   return _parameterValues[index].getValue().charData();
 }
 
+const OpenRTI::VariableLengthData&
+ParameterHandleValuePairSetCallback::constData(RTI::ULong index) const
+  RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+{
+  if (_parameterValues.size() <= index)
+    throw RTI::ArrayIndexOutOfBounds("Array Index out of bounds in constData()");
+  // The value may be shared with the received message, so do not make it private
+  return _parameterValues[index].getValue();
+}
+
 RTI::TransportType
 ParameterHandleValuePairSetCallback::getTransportType() const
   RTI_THROW ((RTI::InvalidHandleValuePairSetContext))
@@ -62,6 +62,10 @@ public:
   std::vector<OpenRTI::ParameterValue>& getParameterValues()
   { return _parameterValues; }
 
+  // Read only access to the value without making it private
+  const OpenRTI::VariableLengthData& constData(RTI::ULong index) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds));
+
 private:
   mutable std::vector<OpenRTI::ParameterValue> _parameterValues;
   RTI::TransportType _transportType;
@@ -82,6 +82,16 @@ ParameterHandleValuePairSetImplementation::getValuePointer(RTI::ULong index, RTI
   return _parameterValues[index].getValue().charData();
 }
 
+const OpenRTI::VariableLengthData&
+ParameterHandleValuePairSetImplementation::constData(RTI::ULong index) const
+  RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+{
+  if (_parameterValues.size() <= index)
+    throw RTI::ArrayIndexOutOfBounds("Array Index out of bounds in constData()");
+  // The value may be shared with other copies, so do not make it private
+  return _parameterValues[index].getValue();
+}
+
 RTI::TransportType
 ParameterHandleValuePairSetImplementation::getTransportType() const
   RTI_THROW ((RTI::InvalidHandleValuePairSetContext))
@@ -58,6 +58,10 @@ public:
   virtual RTI::ULong valid(RTI::ULong i) const;
   virtual RTI::ULong next(RTI::ULong i) const;
 
+  // Read only access to the value without making it private
+  const OpenRTI::VariableLengthData& constData(RTI::ULong index) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds));
+
 private:
   mutable std::vector<OpenRTI::ParameterValue> _parameterValues;
 };
@@ -29,8 +29,7 @@
 #include "AttributeHandleValuePairSetCallback.h"
 #include "AttributeHandleValuePairSetImplementation.h"
 #include "FederateHandleSetImplementation.h"
-#include "FDD1516FileReader.h"
-#include "FEDFileReader.h"
+#include "FOMModuleCache.h"
 #include "LogStream.h"
 #include "ParameterHandleValuePairSetCallback.h"
 #include "ParameterHandleValuePairSetImplementation.h"
@@ -38,14 +37,36 @@
 #include "StringUtils.h"
 #include "TemplateTimeManagement.h"
 
+static OpenRTI::FOMModuleCache::Format getFormat(std::istream& stream)
+{
+  stream >> std::skipws;
+  if (stream.peek() == '<')
+    return OpenRTI::FOMModuleCache::FDD1516Format;
+  else
+    return OpenRTI::FOMModuleCache::FEDFormat;
+}
+
 static void loadModule(OpenRTI::FOMStringModuleList& fomModuleList, std::istream& stream)
 {
   try {
-    stream >> std::skipws;
-    if (stream.peek() == '<')
-      fomModuleList.push_back(OpenRTI::FDD1516FileReader::read(stream, std::string()));
-    else
-      fomModuleList.push_back(OpenRTI::FEDFileReader::read(stream));
+    fomModuleList.push_back(OpenRTI::FOMModuleCache::read(getFormat(stream), stream, std::string()));
+  } catch (const OpenRTI::Exception& e) {
+    throw RTI::ErrorReadingFED(e.what());
+  } catch (...) {
+    throw RTI::RTIinternalError("Unknown error while reading fed file");
+  }
+}
+
+// Returns false if the file cannot be opened
+static bool loadModuleFile(OpenRTI::FOMStringModuleList& fomModuleList, const std::string& fileName)
+{
+  std::ifstream stream(fileName.c_str());
+  if (!stream.is_open())
+    return false;
+  OpenRTI::FOMModuleCache::Format format = getFormat(stream);
+  stream.close();
+  try {
+    return OpenRTI::FOMModuleCache::readFile(fomModuleList, format, fileName, std::string());
   } catch (const OpenRTI::Exception& e) {
     throw RTI::ErrorReadingFED(e.what());
   } catch (...) {
@@ -57,9 +78,7 @@ static void loadModule(OpenRTI::FOMStringModuleList& fomModuleList, const std::s
 {
   if (fomModule.empty())
     throw RTI::CouldNotOpenFED("Empty module.");
-  std::ifstream stream(OpenRTI::utf8ToLocale(fomModule).c_str());
-  if (stream.is_open()) {
-    loadModule(fomModuleList, stream);
+  if (loadModuleFile(fomModuleList, OpenRTI::utf8ToLocale(fomModule))) {
   } else if (fomModule.compare(0, 8, "file:///") == 0) {
     loadModule(fomModuleList, fomModule.substr(8));
   } else if (fomModule.compare(0, 16, "data:text/plain,") == 0) {
@@ -190,14 +209,25 @@ class OPENRTI_LOCAL _I13AttributeValueVector : public OpenRTI::AttributeValueVec
 public:
   _I13AttributeValueVector(const RTI::AttributeHandleValuePairSet& attributeHandleValuePairSet)
   {
+    // The sets of this implementation share their values, any other set is copied
+    const AttributeHandleValuePairSetImplementation* implementation;
+    implementation = dynamic_cast<const AttributeHandleValuePairSetImplementation*>(&attributeHandleValuePairSet);
+    const AttributeHandleValuePairSetCallback* callback;
+    callback = dynamic_cast<const AttributeHandleValuePairSetCallback*>(&attributeHandleValuePairSet);
     RTI::ULong attributeHandleValuePairSetSize = attributeHandleValuePairSet.size();
     reserve(attributeHandleValuePairSetSize);
     for (RTI::ULong i = 0; i < attributeHandleValuePairSetSize; ++i) {
       push_back(OpenRTI::AttributeValue());
       back().setAttributeHandle(attributeHandleValuePairSet.getHandle(i));
-      RTI::ULong length;
-      char* value = attributeHandleValuePairSet.getValuePointer(i, length);
-      back().getValue().setData(value, length);
+      if (implementation) {
+        back().setValue(implementation->constData(i));
+      } else if (callback) {
+        back().setValue(callback->constData(i));
+      } else {
+        RTI::ULong length;
+        char* value = attributeHandleValuePairSet.getValuePointer(i, length);
+        back().getValue().setData(value, length);
+      }
     }
   }
 };
@@ -205,14 +235,25 @@ class OPENRTI_LOCAL _I13ParameterValueVector : public OpenRTI::ParameterValueVec
 public:
   _I13ParameterValueVector(const RTI::ParameterHandleValuePairSet& parameterHandleValuePairSet)
   {
+    // The sets of this implementation share their values, any other set is copied
+    const ParameterHandleValuePairSetImplementation* implementation;
+    implementation = dynamic_cast<const ParameterHandleValuePairSetImplementation*>(&parameterHandleValuePairSet);
+    const ParameterHandleValuePairSetCallback* callback;
+    callback = dynamic_cast<const ParameterHandleValuePairSetCallback*>(&parameterHandleValuePairSet);
     RTI::ULong parameterHandleValuePairSetSize = parameterHandleValuePairSet.size();
     reserve(parameterHandleValuePairSetSize);
     for (RTI::ULong i = 0; i < parameterHandleValuePairSetSize; ++i) {
       push_back(OpenRTI::ParameterValue());
       back().setParameterHandle(parameterHandleValuePairSet.getHandle(i));
-      RTI::ULong length;
-      char* value = parameterHandleValuePairSet.getValuePointer(i, length);
-      back().getValue().setData(value, length);
+      if (implementation) {
+        back().setValue(implementation->constData(i));
+      } else if (callback) {
+        back().setValue(callback->constData(i));
+      } else {
+        RTI::ULong length;
+        char* value = parameterHandleValuePairSet.getValuePointer(i, length);
+        back().getValue().setData(value, length);
+      }
     }
   }
 };
@@ -290,201 +331,166 @@ public:
     }
   }
 
-  // // 4.12
-  // virtual void
-  // initiateFederateSave(std::string const& label)
-  //   RTI_THROW ((OpenRTI::UnableToPerformSave,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->initiateFederateSave(OpenRTI::utf8ToLocale(label).c_str());
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   }
-  // }
-
-  // virtual
-  // void
-  // initiateFederateSave(std::string const& label,
-  //                      OpenRTI::LogicalTime const&)
-  //   RTI_THROW ((OpenRTI::UnableToPerformSave,
-  //          OpenRTI::InvalidLogicalTime,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->initiateFederateSave(OpenRTI::utf8ToLocale(label).c_str());
-  //   } catch (const RTI::UnableToPerformSave& e) {
-  //     throw OpenRTI::UnableToPerformSave(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-  // // 4.15
-  // virtual void
-  // federationSaved()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationSaved();
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-  // virtual void
-  // federationNotSaved(OpenRTI::SaveFailureReason theSaveFailureReason)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationNotSaved();
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-  // // 4.17
-  // virtual void
-  // federationSaveStatusResponse(OpenRTI::FederateHandleSaveStatusPairVector const& theFederateStatusVector)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   /// Should never be called since there is also no queryFederationSaveStatus call in RTI13
-  //   throw OpenRTI::FederateInternalError();
-  // }
-
-  // // 4.19
-  // virtual void
-  // requestFederationRestoreSucceeded(std::string const& label)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->requestFederationRestoreSucceeded(OpenRTI::utf8ToLocale(label).c_str());
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-  // virtual void
-  // requestFederationRestoreFailed(std::string const& label)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     /// FIXME, we might route that second argument through the internal interface
-  //     _federateAmbassador->requestFederationRestoreFailed(OpenRTI::utf8ToLocale(label).c_str(), "Don't know why");
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-
-  // // 4.20
-  // virtual void
-  // federationRestoreBegun()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationRestoreBegun();
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-  // // 4.21
-  // virtual void
-  // initiateFederateRestore(std::string const & label,
-  //                         OpenRTI::FederateHandle handle)
-  //   RTI_THROW ((OpenRTI::SpecifiedSaveLabelDoesNotExist,
-  //          OpenRTI::CouldNotInitiateRestore,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->initiateFederateRestore(OpenRTI::utf8ToLocale(label).c_str(), rti13Handle(handle));
-  //   } catch (const RTI::SpecifiedSaveLabelDoesNotExist& e) {
-  //     throw OpenRTI::SpecifiedSaveLabelDoesNotExist(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (const RTI::CouldNotRestore& e) {
-  //     throw OpenRTI::CouldNotInitiateRestore(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-  // // 4.23
-  // virtual
-  // void federationRestored()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationRestored();
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-  // virtual void
-  // federationNotRestored(OpenRTI::RestoreFailureReason)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationNotRestored();
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
-
-  // // 4.25
-  // virtual void
-  // federationRestoreStatusResponse(OpenRTI::FederateHandleRestoreStatusPairVector const& theFederateStatusVector)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     throw RTI::FederateInternalError("Not implemented");
-  //     // _federateAmbassador
-  //   } catch (const RTI::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(OpenRTI::localeToUtf8(e._reason));
-  //   } catch (...) {
-  //     throw OpenRTI::FederateInternalError("Unknown exception");
-  //   }
-  // }
+  // 4.12
+  virtual void initiateFederateSave(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->initiateFederateSave(OpenRTI::utf8ToLocale(label).c_str());
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  virtual void initiateFederateSave(const std::string& label, const RTI::FedTime&)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      // There is no timed variant of this callback in RTI13
+      _federateAmbassador->initiateFederateSave(OpenRTI::utf8ToLocale(label).c_str());
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  // 4.15
+  virtual void federationSaved()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationSaved();
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  virtual void federationNotSaved(OpenRTI::SaveFailureReason)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationNotSaved();
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  // 4.17
+  virtual void federationSaveStatusResponse(const OpenRTI::FederateHandleSaveStatusPairVector&)
+    RTI_NOEXCEPT
+  {
+    // Not available in RTI13
+  }
+
+  // 4.19
+  virtual void requestFederationRestoreSucceeded(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->requestFederationRestoreSucceeded(OpenRTI::utf8ToLocale(label).c_str());
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  virtual void requestFederationRestoreFailed(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->requestFederationRestoreFailed(OpenRTI::utf8ToLocale(label).c_str(), "Save label does not exist or restore in progress");
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  // 4.20
+  virtual void federationRestoreBegun()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationRestoreBegun();
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  // 4.21
+  virtual void initiateFederateRestore(const std::string& label, const std::string&, const OpenRTI::FederateHandle& federateHandle)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->initiateFederateRestore(OpenRTI::utf8ToLocale(label).c_str(), rti13Handle(federateHandle));
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  // 4.23
+  virtual void federationRestored()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationRestored();
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  virtual void federationNotRestored(OpenRTI::RestoreFailureReason)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationNotRestored();
+    } catch (const RTI::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
+    }
+  }
+
+  // 4.25
+  virtual void federationRestoreStatusResponse(const OpenRTI::FederateHandleRestoreStatusPairVector&)
+    RTI_NOEXCEPT
+  {
+    // Not available in RTI13
+  }
 
   /////////////////////////////////////
   // Declaration Management Services //
@@ -1069,8 +1075,7 @@ public:
       return;
     }
     try {
-      // _federateAmbassador
-      throw RTI::FederateInternalError("Not implemented");
+      _federateAmbassador->requestRetraction(rti13MessageRetractionHandle(theHandle));
     } catch (const RTI::Exception& e) {
       Log(FederateAmbassador, Warning) << "Caught an RTI exception in callback: " << e._reason << std::endl;
     }
@@ -35,7 +35,7 @@
 #include <RTI/RangeBounds.h>
 
 #include "Ambassador.h"
-#include "FDD1516FileReader.h"
+#include "FOMModuleCache.h"
 #include "LogStream.h"
 #include "TemplateTimeManagement.h"
 
@@ -50,7 +50,19 @@ namespace OpenRTI {
 static void loadModule(OpenRTI::FOMStringModuleList& fomModuleList, std::istream& stream, const std::string& encoding)
 {
   try {
-    fomModuleList.push_back(OpenRTI::FDD1516FileReader::read(stream, encoding));
+    fomModuleList.push_back(OpenRTI::FOMModuleCache::read(OpenRTI::FOMModuleCache::FDD1516Format, stream, encoding));
+  } catch (const OpenRTI::Exception& e) {
+    throw rti1516::ErrorReadingFDD(OpenRTI::utf8ToUcs(e.what()));
+  } catch (...) {
+    throw rti1516::RTIinternalError(L"Unknown error while reading fdd file");
+  }
+}
+
+// Returns false if the file cannot be opened
+static bool loadModuleFile(OpenRTI::FOMStringModuleList& fomModuleList, const std::string& fileName)
+{
+  try {
+    return OpenRTI::FOMModuleCache::readFile(fomModuleList, OpenRTI::FOMModuleCache::FDD1516Format, fileName, std::string());
   } catch (const OpenRTI::Exception& e) {
     throw rti1516::ErrorReadingFDD(OpenRTI::utf8ToUcs(e.what()));
   } catch (...) {
@@ -62,9 +74,7 @@ static void loadModule(OpenRTI::FOMStringModuleList& fomModuleList, const std::w
 {
   if (fomModule.empty())
     throw rti1516::CouldNotOpenFDD(L"Empty module.");
-  std::ifstream stream(OpenRTI::ucsToLocale(fomModule).c_str());
-  if (stream.is_open()) {
-    loadModule(fomModuleList, stream, std::string());
+  if (loadModuleFile(fomModuleList, OpenRTI::ucsToLocale(fomModule))) {
   } else if (fomModule.compare(0, 8, L"file:///") == 0) {
     loadModule(fomModuleList, fomModule.substr(8));
   } else if (fomModule.compare(0, 16, L"data:text/plain,") == 0) {
@@ -487,253 +497,270 @@ public:
     }
   }
 
-  // // 4.12
-  // virtual void
-  // initiateFederateSave(std::string const& label)
-  //   RTI_THROW ((OpenRTI::UnableToPerformSave,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->initiateFederateSave(label);
-  //   } catch (const rti1516::UnableToPerformSave& e) {
-  //     throw OpenRTI::UnableToPerformSave(e.what());
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // virtual void
-  // initiateFederateSave(const std::string& label,
-  //                      const LogicalTime& logicalTime)
-  //   RTI_THROW ((OpenRTI::UnableToPerformSave,
-  //          OpenRTI::InvalidLogicalTime,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->initiateFederateSave(label, RTI1516LogicalTimeImplementation::getLogicalTime(logicalTime));
-  //   } catch (const rti1516::UnableToPerformSave& e) {
-  //     throw OpenRTI::UnableToPerformSave(e.what());
-  //   } catch (const rti1516::InvalidLogicalTime& e) {
-  //     throw OpenRTI::InvalidLogicalTime(e.what());
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.15
-  // virtual void
-  // federationSaved()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationSaved();
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // virtual void
-  // federationNotSaved(OpenRTI::SaveFailureReason reason)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-
-  //   rti1516::SaveFailureReason rti1516Reason;
-  //   switch (reason) {
-  //   case OpenRTI::RTI_UNABLE_TO_SAVE:
-  //     rti1516Reason = rti1516::RTI_UNABLE_TO_SAVE;
-  //     break;
-  //   case OpenRTI::FEDERATE_REPORTED_FAILURE_DURING_SAVE:
-  //     rti1516Reason = rti1516::FEDERATE_REPORTED_FAILURE_DURING_SAVE;
-  //     break;
-  //   case OpenRTI::FEDERATE_RESIGNED_DURING_SAVE:
-  //     rti1516Reason = rti1516::FEDERATE_RESIGNED_DURING_SAVE;
-  //     break;
-  //   case OpenRTI::RTI_DETECTED_FAILURE_DURING_SAVE:
-  //     rti1516Reason = rti1516::RTI_DETECTED_FAILURE_DURING_SAVE;
-  //     break;
-  //   case OpenRTI::SAVE_TIME_CANNOT_BE_HONORED:
-  //     rti1516Reason = rti1516::SAVE_TIME_CANNOT_BE_HONORED;
-  //     break;
-  //   default:
-  //     throw OpenRTI::FederateInternalError();
-  //   }
-
-  //   try {
-  //     _federateAmbassador->federationNotSaved(rti1516Reason);
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-
-  // // 4.17
-  // virtual void
-  // federationSaveStatusResponse(OpenRTI::FederateHandleSaveStatusPairVector const& federateStatusVector)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //  /* enum SaveStatus */
-  //  /* { */
-  //  /*    NO_SAVE_IN_PROGRESS, */
-  //  /*    FEDERATE_INSTRUCTED_TO_SAVE, */
-  //  /*    FEDERATE_SAVING, */
-  //  /*    FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE */
-  //  /* }; */
-
-  //   try {
-  //     throw rti1516::FederateInternalError(L"Not implemented");
-  //     // _federateAmbassador
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.19
-  // virtual void
-  // requestFederationRestoreSucceeded(std::string const& label)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->requestFederationRestoreSucceeded(label);
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // virtual void
-  // requestFederationRestoreFailed(std::string const& label)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->requestFederationRestoreFailed(label);
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-
-  // // 4.20
-  // virtual void
-  // federationRestoreBegun()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationRestoreBegun();
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.21
-  // virtual void
-  // initiateFederateRestore(std::string const & label,
-  //                         FederateHandle handle)
-  //   RTI_THROW ((OpenRTI::SpecifiedSaveLabelDoesNotExist,
-  //          OpenRTI::CouldNotInitiateRestore,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     rti1516::FederateHandle rti1516Handle = rti1516::FederateHandleFriend::createHandle(handle);
-  //     _federateAmbassador->initiateFederateRestore(label, rti1516Handle);
-  //   } catch (const rti1516::SpecifiedSaveLabelDoesNotExist& e) {
-  //     throw OpenRTI::SpecifiedSaveLabelDoesNotExist(e.what());
-  //   } catch (const rti1516::CouldNotInitiateRestore& e) {
-  //     throw OpenRTI::CouldNotInitiateRestore(e.what());
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.23
-  // virtual
-  // void federationRestored()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationRestored();
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // virtual void
-  // federationNotRestored(RestoreFailureReason reason)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-
-  //   rti1516::RestoreFailureReason rti1516Reason;
-  //   switch (reason) {
-  //   case OpenRTI::RTI_UNABLE_TO_RESTORE:
-  //     rti1516Reason = rti1516::RTI_UNABLE_TO_RESTORE;
-  //     break;
-  //   case OpenRTI::FEDERATE_REPORTED_FAILURE_DURING_RESTORE:
-  //     rti1516Reason = rti1516::FEDERATE_REPORTED_FAILURE_DURING_RESTORE;
-  //     break;
-  //   case OpenRTI::FEDERATE_RESIGNED_DURING_RESTORE:
-  //     rti1516Reason = rti1516::FEDERATE_RESIGNED_DURING_RESTORE;
-  //     break;
-  //   case OpenRTI::RTI_DETECTED_FAILURE_DURING_RESTORE:
-  //     rti1516Reason = rti1516::RTI_DETECTED_FAILURE_DURING_RESTORE;
-  //     break;
-  //   default:
-  //     throw OpenRTI::FederateInternalError();
-  //   }
-
-  //   try {
-  //     _federateAmbassador->federationNotRestored(rti1516Reason);
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.25
-  // virtual void
-  // federationRestoreStatusResponse(FederateHandleRestoreStatusPairVector const& theFederateStatusVector)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-
-
-  //  /* enum RestoreStatus */
-  //  /* { */
-  //  /*    NO_RESTORE_IN_PROGRESS, */
-  //  /*    FEDERATE_RESTORE_REQUEST_PENDING, */
-  //  /*    FEDERATE_WAITING_FOR_RESTORE_TO_BEGIN, */
-  //  /*    FEDERATE_PREPARED_TO_RESTORE, */
-  //  /*    FEDERATE_RESTORING, */
-  //  /*    FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE */
-  //  /* }; */
-
-
-  //   try {
-  //     throw rti1516::FederateInternalError(L"Not implemented");
-  //     // _federateAmbassador
-  //   } catch (const rti1516::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
+  // 4.12
+  virtual void initiateFederateSave(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516String rti1516Label(label);
+      _federateAmbassador->initiateFederateSave(rti1516Label);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  virtual void initiateFederateSave(const std::string& label, const rti1516::LogicalTime& logicalTime)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516String rti1516Label(label);
+      _federateAmbassador->initiateFederateSave(rti1516Label, logicalTime);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.15
+  virtual void federationSaved()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationSaved();
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  virtual void federationNotSaved(OpenRTI::SaveFailureReason reason)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      // There is no aborted save in this standard
+      rti1516::SaveFailureReason rti1516Reason;
+      switch (reason) {
+      case OpenRTI::RTI_UNABLE_TO_SAVE:
+        rti1516Reason = rti1516::RTI_UNABLE_TO_SAVE;
+        break;
+      case OpenRTI::FEDERATE_REPORTED_FAILURE_DURING_SAVE:
+        rti1516Reason = rti1516::FEDERATE_REPORTED_FAILURE_DURING_SAVE;
+        break;
+      case OpenRTI::FEDERATE_RESIGNED_DURING_SAVE:
+        rti1516Reason = rti1516::FEDERATE_RESIGNED_DURING_SAVE;
+        break;
+      case OpenRTI::SAVE_TIME_CANNOT_BE_HONORED:
+        rti1516Reason = rti1516::SAVE_TIME_CANNOT_BE_HONORED;
+        break;
+      default:
+        rti1516Reason = rti1516::RTI_DETECTED_FAILURE_DURING_SAVE;
+        break;
+      }
+      _federateAmbassador->federationNotSaved(rti1516Reason);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.17
+  virtual void federationSaveStatusResponse(const OpenRTI::FederateHandleSaveStatusPairVector& federateHandleSaveStatusPairVector)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      rti1516::FederateHandleSaveStatusPairVector rti1516FederateStatusVector;
+      rti1516FederateStatusVector.reserve(federateHandleSaveStatusPairVector.size());
+      for (OpenRTI::FederateHandleSaveStatusPairVector::const_iterator i = federateHandleSaveStatusPairVector.begin();
+           i != federateHandleSaveStatusPairVector.end(); ++i) {
+        rti1516::SaveStatus saveStatus;
+        switch (i->second) {
+        case OpenRTI::FEDERATE_INSTRUCTED_TO_SAVE:
+          saveStatus = rti1516::FEDERATE_INSTRUCTED_TO_SAVE;
+          break;
+        case OpenRTI::FEDERATE_SAVING:
+          saveStatus = rti1516::FEDERATE_SAVING;
+          break;
+        case OpenRTI::FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE:
+          saveStatus = rti1516::FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE;
+          break;
+        default:
+          saveStatus = rti1516::NO_SAVE_IN_PROGRESS;
+          break;
+        }
+        rti1516FederateStatusVector.push_back(rti1516::FederateHandleSaveStatusPair(OpenRTI::_O1516FederateHandle(i->first), saveStatus));
+      }
+      _federateAmbassador->federationSaveStatusResponse(rti1516FederateStatusVector);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.19
+  virtual void requestFederationRestoreSucceeded(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516String rti1516Label(label);
+      _federateAmbassador->requestFederationRestoreSucceeded(rti1516Label);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  virtual void requestFederationRestoreFailed(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516String rti1516Label(label);
+      _federateAmbassador->requestFederationRestoreFailed(rti1516Label);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.20
+  virtual void federationRestoreBegun()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationRestoreBegun();
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.21
+  virtual void initiateFederateRestore(const std::string& label, const std::string&, const OpenRTI::FederateHandle& federateHandle)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516String rti1516Label(label);
+      OpenRTI::_O1516FederateHandle rti1516Handle(federateHandle);
+      _federateAmbassador->initiateFederateRestore(rti1516Label, rti1516Handle);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.23
+  virtual void federationRestored()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationRestored();
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  virtual void federationNotRestored(OpenRTI::RestoreFailureReason reason)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      // There is no aborted restore in this standard
+      rti1516::RestoreFailureReason rti1516Reason;
+      switch (reason) {
+      case OpenRTI::RTI_UNABLE_TO_RESTORE:
+        rti1516Reason = rti1516::RTI_UNABLE_TO_RESTORE;
+        break;
+      case OpenRTI::FEDERATE_REPORTED_FAILURE_DURING_RESTORE:
+        rti1516Reason = rti1516::FEDERATE_REPORTED_FAILURE_DURING_RESTORE;
+        break;
+      case OpenRTI::FEDERATE_RESIGNED_DURING_RESTORE:
+        rti1516Reason = rti1516::FEDERATE_RESIGNED_DURING_RESTORE;
+        break;
+      default:
+        rti1516Reason = rti1516::RTI_DETECTED_FAILURE_DURING_RESTORE;
+        break;
+      }
+      _federateAmbassador->federationNotRestored(rti1516Reason);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.25
+  virtual void federationRestoreStatusResponse(const OpenRTI::FederateHandleRestoreStatusPairVector& federateHandleRestoreStatusPairVector)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      rti1516::FederateHandleRestoreStatusPairVector rti1516FederateStatusVector;
+      rti1516FederateStatusVector.reserve(federateHandleRestoreStatusPairVector.size());
+      for (OpenRTI::FederateHandleRestoreStatusPairVector::const_iterator i = federateHandleRestoreStatusPairVector.begin();
+           i != federateHandleRestoreStatusPairVector.end(); ++i) {
+        rti1516::RestoreStatus restoreStatus;
+        switch (i->second) {
+        case OpenRTI::FEDERATE_RESTORE_REQUEST_PENDING:
+          restoreStatus = rti1516::FEDERATE_RESTORE_REQUEST_PENDING;
+          break;
+        case OpenRTI::FEDERATE_WAITING_FOR_RESTORE_TO_BEGIN:
+          restoreStatus = rti1516::FEDERATE_WAITING_FOR_RESTORE_TO_BEGIN;
+          break;
+        case OpenRTI::FEDERATE_PREPARED_TO_RESTORE:
+          restoreStatus = rti1516::FEDERATE_PREPARED_TO_RESTORE;
+          break;
+        case OpenRTI::FEDERATE_RESTORING:
+          restoreStatus = rti1516::FEDERATE_RESTORING;
+          break;
+        case OpenRTI::FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE:
+          restoreStatus = rti1516::FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE;
+          break;
+        default:
+          restoreStatus = rti1516::NO_RESTORE_IN_PROGRESS;
+          break;
+        }
+        rti1516FederateStatusVector.push_back(rti1516::FederateHandleRestoreStatusPair(OpenRTI::_O1516FederateHandle(i->first), restoreStatus));
+      }
+      _federateAmbassador->federationRestoreStatusResponse(rti1516FederateStatusVector);
+    } catch (const rti1516::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516 exception in callback: " << e.what() << std::endl;
+    }
+  }
 
   /////////////////////////////////////
   // Declaration Management Services //
@@ -34,7 +34,7 @@
 namespace rti1516e
 {
 
-#define IMPLEMENT_ENCODING_HELPER_CLASS(EncodableDataType, SimpleDataType, encoder) \
+#define IMPLEMENT_ENCODING_HELPER_CLASS(EncodableDataType, SimpleDataType, DataElementCoderType, encoder) \
                                                                         \
 class OPENRTI_LOCAL EncodableDataType##Implementation {                 \
 public:                                                                 \
@@ -69,7 +69,8 @@ public:                                                                 \
   size_t align(size_t offset, size_t alignment) const                   \
   { return (offset + alignment - 1) & ~(alignment - 1); }               \
                                                                         \
-  void align(std::vector<Octet>& buffer, size_t alignment) const        \
+  template<typename B>                                                  \
+  void align(B& buffer, size_t alignment) const                         \
   {                                                                     \
     while (buffer.size() % alignment)                                   \
       buffer.push_back(0);                                              \
@@ -202,10 +203,13 @@ EncodableDataType::operator=(SimpleDataType rhs)                        \
 EncodableDataType::operator SimpleDataType() const                      \
 {                                                                       \
   return _impl->get();                                                  \
-}
+}                                                                       \
+                                                                        \
+static const DataElementCoderType<EncodableDataType, EncodableDataType##Implementation> \
+EncodableDataType##Coder;
 
 // 8 bit values
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAASCIIchar, char,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAASCIIchar, char, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -221,7 +225,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setChar(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   if (buffer.size() < index + 1)
     throw EncoderException(L"Insufficient buffer size for decoding!");
@@ -229,7 +233,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 1;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   buffer.push_back(_value);
 }
@@ -251,7 +256,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAboolean, bool,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAboolean, bool, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -267,7 +272,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt32BE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 4);
   if (buffer.size() < index + 4)
@@ -281,7 +286,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 4;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 4);
   uint32_t u = uint32_t(_value);
@@ -308,7 +314,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAbyte, Octet,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAbyte, Octet, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -324,7 +330,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt8(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   if (buffer.size() < index + 1)
     throw EncoderException(L"Insufficient buffer size for decoding!");
@@ -332,7 +338,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 1;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   buffer.push_back(_value);
 }
@@ -354,7 +361,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAoctet, Octet,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAoctet, Octet, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -370,7 +377,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt8(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   if (buffer.size() < index + 1)
     throw EncoderException(L"Insufficient buffer size for decoding!");
@@ -378,7 +385,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 1;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   buffer.push_back(_value);
 }
@@ -402,7 +410,7 @@ Integer64 hash() const
 )
 
 // > 8 bit values, fixed endianess
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAunicodeChar, wchar_t,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAunicodeChar, wchar_t, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -418,7 +426,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setUInt16BE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 2);
   if (buffer.size() < index + 2)
@@ -430,7 +438,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 2;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 2);
   uint16_t u = uint16_t(_value);
@@ -457,7 +466,7 @@ Integer64 hash() const
 )
 
 // > 8 bit values, both endianess
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger16BE, Integer16,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger16BE, Integer16, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -473,7 +482,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt16BE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 2);
   if (buffer.size() < index + 2)
@@ -485,7 +494,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 2;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 2);
   uint16_t u = _value;
@@ -510,7 +520,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger16LE, Integer16,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger16LE, Integer16, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -526,7 +536,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt16LE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 2);
   if (buffer.size() < index + 2)
@@ -538,7 +548,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 2;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 2);
   uint16_t u = uint16_t(_value);
@@ -563,7 +574,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger32BE, Integer32,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger32BE, Integer32, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -579,7 +590,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt32BE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 4);
   if (buffer.size() < index + 4)
@@ -593,7 +604,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 4;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 4);
   uint32_t u = uint32_t(_value);
@@ -620,7 +632,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger32LE, Integer32,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger32LE, Integer32, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -636,7 +648,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt32LE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 4);
   if (buffer.size() < index + 4)
@@ -650,7 +662,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 4;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 4);
   uint32_t u = uint32_t(_value);
@@ -677,7 +690,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger64BE, Integer64,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger64BE, Integer64, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -693,7 +706,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt64BE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 8);
   if (buffer.size() < index + 8)
@@ -711,7 +724,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 8;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 8);
   uint64_t u = uint64_t(_value);
@@ -742,7 +756,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger64LE, Integer64,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAinteger64LE, Integer64, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -758,7 +772,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setInt64LE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 8);
   if (buffer.size() < index + 8)
@@ -776,7 +790,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 8;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 8);
   uint64_t u = uint64_t(_value);
@@ -807,7 +822,7 @@ Integer64 hash() const
   return Integer64(_value);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAoctetPairBE, OctetPair,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAoctetPairBE, OctetPair, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -825,7 +840,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setChar(_value.second, 1);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 2);
   if (buffer.size() < index + 2)
@@ -835,7 +850,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 2;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 2);
   buffer.push_back(_value.first);
@@ -859,7 +875,7 @@ Integer64 hash() const
   return (Integer64(_value.first) << 8) | Integer64(_value.second);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAoctetPairLE, OctetPair,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAoctetPairLE, OctetPair, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -877,7 +893,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setChar(_value.first, 1);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 2);
   if (buffer.size() < index + 2)
@@ -887,7 +903,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 2;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 2);
   buffer.push_back(_value.second);
@@ -913,7 +930,7 @@ Integer64 hash() const
 )
 
 // float, > 8 bit values, both endianess
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAfloat32BE, float,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAfloat32BE, float, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -929,7 +946,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setFloat32BE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 4);
   if (buffer.size() < index + 4)
@@ -946,7 +963,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 4;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 4);
   union {
@@ -982,7 +1000,7 @@ Integer64 hash() const
   return Integer64(u.u);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAfloat32LE, float,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAfloat32LE, float, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -998,7 +1016,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setFloat32LE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 4);
   if (buffer.size() < index + 4)
@@ -1015,7 +1033,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 4;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 4);
   union {
@@ -1051,7 +1070,7 @@ Integer64 hash() const
   return Integer64(u.u);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAfloat64BE, double,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAfloat64BE, double, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -1067,7 +1086,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setFloat64BE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 8);
   if (buffer.size() < index + 8)
@@ -1088,7 +1107,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 8;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 8);
   union {
@@ -1128,7 +1148,7 @@ Integer64 hash() const
   return Integer64(u.u);
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAfloat64LE, double,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAfloat64LE, double, DataElementArrayCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -1144,7 +1164,7 @@ encode(OpenRTI::VariableLengthData& inData) const
   inData.setFloat64LE(_value, 0);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 8);
   if (buffer.size() < index + 8)
@@ -1165,7 +1185,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index + 8;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 8);
   union {
@@ -1207,7 +1228,7 @@ Integer64 hash() const
 )
 
 // Array values
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAASCIIstring, std::string,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAASCIIstring, std::string, DataElementImplementationCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -1239,7 +1260,7 @@ encode(OpenRTI::VariableLengthData& inData) const
     inData.setChar(_value[i], 4 + i);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 4);
   if (buffer.size() < index + 4)
@@ -1264,7 +1285,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 4);
   size_t length = _value.size();
@@ -1300,7 +1322,7 @@ Integer64 hash() const
   return hash;
 }
 )
-IMPLEMENT_ENCODING_HELPER_CLASS(HLAunicodeString, std::wstring,
+IMPLEMENT_ENCODING_HELPER_CLASS(HLAunicodeString, std::wstring, DataElementImplementationCoder,
 void
 decode(OpenRTI::VariableLengthData const & inData)
 {
@@ -1332,7 +1354,7 @@ encode(OpenRTI::VariableLengthData& inData) const
     inData.setUInt16BE(_value[i], 4 + 2*i);
 }
 
-size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
 {
   index = align(index, 4);
   if (buffer.size() < index + 4)
@@ -1362,7 +1384,8 @@ size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
   return index;
 }
 
-void encodeInto(std::vector<Octet>& buffer) const
+template<typename B>
+void encodeInto(B& buffer) const
 {
   align(buffer, 4);
   size_t length = _value.size();
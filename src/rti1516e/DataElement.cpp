@@ -19,11 +19,120 @@
 
 #include <RTI/encoding/DataElement.h>
 
+#include <map>
 #include <typeinfo>
 
+#include "Encoding.h"
+
 namespace rti1516e
 {
 
+struct OPENRTI_LOCAL TypeInfoLess {
+  bool operator()(const std::type_info* typeInfo0, const std::type_info* typeInfo1) const
+  { return typeInfo0->before(*typeInfo1); }
+};
+
+// The type_info objects of the types implemented here are unique within this
+// library, so most lookups are done by just comparing the addresses. Only
+// type_info objects from elsewhere need the slower comparison of their names.
+typedef std::map<const std::type_info*, const DataElementCoder*> DataElementCoderAddressMap;
+typedef std::map<const std::type_info*, const DataElementCoder*, TypeInfoLess> DataElementCoderMap;
+
+// Both filled during static initialization only, read only afterwards
+static DataElementCoderAddressMap&
+getDataElementCoderAddressMap()
+{
+  static DataElementCoderAddressMap dataElementCoderAddressMap;
+  return dataElementCoderAddressMap;
+}
+
+static DataElementCoderMap&
+getDataElementCoderMap()
+{
+  static DataElementCoderMap dataElementCoderMap;
+  return dataElementCoderMap;
+}
+
+DataElementCoder::DataElementCoder(const std::type_info& typeInfo)
+{
+  getDataElementCoderAddressMap()[&typeInfo] = this;
+  getDataElementCoderMap()[&typeInfo] = this;
+}
+
+const DataElementCoder*
+DataElementCoder::get(const DataElement& dataElement)
+{
+  const std::type_info* typeInfo = &typeid(dataElement);
+  const DataElementCoderAddressMap& dataElementCoderAddressMap = getDataElementCoderAddressMap();
+  DataElementCoderAddressMap::const_iterator i = dataElementCoderAddressMap.find(typeInfo);
+  if (i != dataElementCoderAddressMap.end())
+    return i->second;
+  const DataElementCoderMap& dataElementCoderMap = getDataElementCoderMap();
+  DataElementCoderMap::const_iterator j = dataElementCoderMap.find(typeInfo);
+  if (j == dataElementCoderMap.end())
+    return 0;
+  return j->second;
+}
+
+const DataElementCoder*
+getArrayDataElementCoder(const std::vector<DataElement*>& dataElementVector)
+{
+  if (dataElementVector.empty() || !dataElementVector.front())
+    return 0;
+  const std::type_info& typeInfo = typeid(*dataElementVector.front());
+  for (std::vector<DataElement*>::const_iterator i = dataElementVector.begin() + 1; i != dataElementVector.end(); ++i) {
+    if (!*i || typeid(**i) != typeInfo)
+      return 0;
+  }
+  const DataElementCoder* dataElementCoder = DataElementCoder::get(*dataElementVector.front());
+  if (!dataElementCoder || !dataElementCoder->getArrayOctetSize())
+    return 0;
+  return dataElementCoder;
+}
+
+size_t
+decodeDataElementFrom(DataElement& dataElement, const ConstOctetBuffer& buffer, size_t index,
+                      DataElementCoderCache& dataElementCoderCache)
+{
+  if (const DataElementCoder* dataElementCoder = dataElementCoderCache.get(dataElement))
+    return dataElementCoder->decodeFrom(dataElement, buffer, index);
+  std::vector<Octet> scratch;
+  return dataElement.decodeFrom(buffer.getVector(scratch), index);
+}
+
+void
+encodeDataElementInto(const DataElement& dataElement, VariableLengthDataOctetBuffer& buffer,
+                      DataElementCoderCache& dataElementCoderCache)
+{
+  if (const DataElementCoder* dataElementCoder = dataElementCoderCache.get(dataElement)) {
+    dataElementCoder->encodeInto(dataElement, buffer);
+    return;
+  }
+  // Data elements of the application just need to see the current offset
+  // modulo any sensible octet boundary to align themselves the same way
+  size_t size = buffer.size() % 64;
+  std::vector<Octet> vector(size);
+  dataElement.encodeInto(vector);
+  if (size < vector.size())
+    buffer.append(&vector[size], vector.size() - size);
+}
+
+void
+encodeDataElementInto(const DataElement& dataElement, HashOctetBuffer& buffer,
+                      DataElementCoderCache& dataElementCoderCache)
+{
+  if (const DataElementCoder* dataElementCoder = dataElementCoderCache.get(dataElement)) {
+    dataElementCoder->encodeInto(dataElement, buffer);
+    return;
+  }
+  // Same as above, hash what the data element appends behind the padding
+  size_t size = buffer.size() % 64;
+  std::vector<Octet> vector(size);
+  dataElement.encodeInto(vector);
+  if (size < vector.size())
+    buffer.append(&vector[size], vector.size() - size);
+}
+
 DataElement::~DataElement()
 {
 }
@@ -38,6 +147,12 @@ Integer64
 DataElement::hash() const
 {
   try {
+    // Hash the encoding while it is produced if the type is implemented here
+    if (const DataElementCoder* dataElementCoder = DataElementCoder::get(*this)) {
+      HashOctetBuffer hashOctetBuffer;
+      dataElementCoder->encodeInto(*this, hashOctetBuffer);
+      return hashOctetBuffer.getHash();
+    }
     std::vector<Octet> buffer;
     encodeInto(buffer);
     Integer64 hash = 8191;
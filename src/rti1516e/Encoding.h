@@ -20,9 +20,457 @@
 #ifndef Encoding_h
 #define Encoding_h
 
+#include <algorithm>
+#include <cstring>
+#include <typeinfo>
+#include <vector>
+
+#include <RTI/encoding/DataElement.h>
+#include <RTI/encoding/EncodingExceptions.h>
+
+#include "Export.h"
+#include "VariableLengthData.h"
+
 static inline size_t align(size_t offset, size_t octetBoundary)
 { return (offset + octetBoundary - 1) & ~(octetBoundary - 1); }
-static inline void align(std::vector<rti1516e::Octet>& buffer, size_t octetBoundary)
+template<typename B>
+static inline void align(B& buffer, size_t octetBoundary)
 { buffer.resize(align(buffer.size(), octetBoundary), 0); }
 
+namespace rti1516e
+{
+
+/// Read access to encoded data.
+/// Either refers to the std::vector of the standard api or directly to the
+/// bytes of a VariableLengthData, so decoding does not need to copy them.
+class OPENRTI_LOCAL ConstOctetBuffer {
+public:
+  ConstOctetBuffer(const std::vector<Octet>& buffer) :
+    _data(buffer.empty() ? 0 : &buffer.front()),
+    _size(buffer.size()),
+    _vector(&buffer)
+  { }
+  ConstOctetBuffer(const Octet* data, size_t size) :
+    _data(data),
+    _size(size),
+    _vector(0)
+  { }
+  ConstOctetBuffer(const OpenRTI::VariableLengthData& variableLengthData) :
+    _data(variableLengthData.empty() ? 0 : static_cast<const Octet*>(variableLengthData.data())),
+    _size(variableLengthData.size()),
+    _vector(0)
+  { }
+
+  size_t size() const
+  { return _size; }
+  const Octet& operator[](size_t index) const
+  { return _data[index]; }
+  const Octet* data(size_t index) const
+  { return _data + index; }
+
+  /// The std::vector for data elements only providing the standard api.
+  /// Without an originating vector the data is copied into scratch.
+  const std::vector<Octet>& getVector(std::vector<Octet>& scratch) const
+  {
+    if (_vector)
+      return *_vector;
+    scratch.assign(_data, _data + _size);
+    return scratch;
+  }
+
+private:
+  const Octet* _data;
+  size_t _size;
+  const std::vector<Octet>* _vector;
+};
+
+/// Write access appending directly to a VariableLengthData.
+/// Provides the part of the std::vector api the encoders use.
+/// The VariableLengthData gets its final size when the buffer goes away.
+class OPENRTI_LOCAL VariableLengthDataOctetBuffer {
+public:
+  VariableLengthDataOctetBuffer(OpenRTI::VariableLengthData& variableLengthData) :
+    _variableLengthData(variableLengthData),
+    _data(0),
+    _size(0),
+    _capacity(0)
+  { }
+  ~VariableLengthDataOctetBuffer()
+  { _variableLengthData.resize(_size); }
+
+  size_t size() const
+  { return _size; }
+  Octet& operator[](size_t index)
+  { return _data[index]; }
+
+  void reserve(size_t capacity)
+  {
+    if (_capacity < capacity)
+      grow(capacity);
+  }
+  void resize(size_t size, Octet octet)
+  {
+    reserve(size);
+    if (_size < size)
+      std::memset(_data + _size, octet, size - _size);
+    _size = size;
+  }
+  void push_back(Octet octet)
+  {
+    if (_size == _capacity)
+      grow(_size + 1);
+    _data[_size++] = octet;
+  }
+  void append(const Octet* data, size_t size)
+  {
+    if (!size)
+      return;
+    reserve(_size + size);
+    std::memcpy(_data + _size, data, size);
+    _size += size;
+  }
+
+private:
+  VariableLengthDataOctetBuffer(const VariableLengthDataOctetBuffer&);
+  VariableLengthDataOctetBuffer& operator=(const VariableLengthDataOctetBuffer&);
+
+  void grow(size_t capacity)
+  {
+    if (capacity < 2*_capacity)
+      capacity = 2*_capacity;
+    // Use the whole capacity as size while encoding, this also unshares the data
+    _variableLengthData.resize(capacity);
+    _data = static_cast<Octet*>(_variableLengthData.data());
+    _capacity = capacity;
+  }
+
+  OpenRTI::VariableLengthData& _variableLengthData;
+  Octet* _data;
+  size_t _size;
+  size_t _capacity;
+};
+
+/// Write access to memory already sized for the encoding
+class OPENRTI_LOCAL OctetPointerBuffer {
+public:
+  OctetPointerBuffer(Octet* data) :
+    _begin(data),
+    _data(data)
+  { }
+
+  size_t size() const
+  { return _data - _begin; }
+  void push_back(Octet octet)
+  { *_data++ = octet; }
+
+private:
+  Octet* _begin;
+  Octet* _data;
+};
+
+/// Computes the hash of DataElement::hash over the octets of an encoding
+/// while they are produced, without storing them anywhere
+class OPENRTI_LOCAL HashOctetBuffer {
+public:
+  HashOctetBuffer() :
+    _hash(8191),
+    _size(0)
+  { }
+
+  Integer64 getHash() const
+  {
+    // Unsigned arithmetic to wrap around like the signed original did in practice
+    OpenRTI::uint64_t hash = _hash;
+    for (size_t i = 0; i < _size % 8; ++i)
+      hash = hash*127u + OpenRTI::uint64_t(Integer64(_octets[i]));
+    return Integer64(hash);
+  }
+
+  size_t size() const
+  { return _size; }
+
+  void resize(size_t size, Octet octet)
+  {
+    while (_size < size)
+      push_back(octet);
+  }
+  void push_back(Octet octet)
+  {
+    _octets[_size % 8] = octet;
+    if (++_size % 8 == 0)
+      flush();
+  }
+  void append(const Octet* data, size_t size)
+  {
+    for (; size && _size % 8; --size)
+      push_back(*data++);
+    for (; 8 <= size; size -= 8, data += 8, _size += 8)
+      flush(data);
+    for (; size; --size)
+      push_back(*data++);
+  }
+
+private:
+  void flush()
+  { flush(_octets); }
+  // Fold in eight octets at once, the products do not depend on each other
+  void flush(const Octet* octets)
+  {
+    OpenRTI::uint64_t sum = OpenRTI::uint64_t(Integer64(octets[0]))*0x1e4a5d45ac37full;
+    sum += OpenRTI::uint64_t(Integer64(octets[1]))*0x3d0ed83bd01ull;
+    sum += OpenRTI::uint64_t(Integer64(octets[2]))*0x7b13d827full;
+    sum += OpenRTI::uint64_t(Integer64(octets[3]))*0xf817e01ull;
+    sum += OpenRTI::uint64_t(Integer64(octets[4]))*0x1f417full;
+    sum += OpenRTI::uint64_t(Integer64(octets[5]))*0x3f01ull;
+    sum += OpenRTI::uint64_t(Integer64(octets[6]))*0x7full;
+    sum += OpenRTI::uint64_t(Integer64(octets[7]));
+    // 127 to the power of 8
+    _hash = _hash*0xf06e445906fc01ull + sum;
+  }
+
+  OpenRTI::uint64_t _hash;
+  size_t _size;
+  Octet _octets[8];
+};
+
+static inline void append(std::vector<Octet>& buffer, const Octet* data, size_t size)
+{ buffer.insert(buffer.end(), data, data + size); }
+static inline void append(VariableLengthDataOctetBuffer& buffer, const Octet* data, size_t size)
+{ buffer.append(data, size); }
+static inline void append(HashOctetBuffer& buffer, const Octet* data, size_t size)
+{ buffer.append(data, size); }
+
+/// Encodes and decodes the data elements implemented here without going
+/// through the std::vector based virtual api of the DataElement.
+/// Coders are registered for the exact type of a data element, so
+/// derived classes of applications keep their overridden methods.
+class OPENRTI_LOCAL DataElementCoder {
+public:
+  virtual ~DataElementCoder() {}
+
+  virtual size_t decodeFrom(DataElement& dataElement, const ConstOctetBuffer& buffer, size_t index) const = 0;
+  virtual void encodeInto(const DataElement& dataElement, VariableLengthDataOctetBuffer& buffer) const = 0;
+  virtual void encodeInto(const DataElement& dataElement, HashOctetBuffer& buffer) const = 0;
+
+  /// The octets of a single element if arrays of the type can be coded in bulk, zero otherwise.
+  /// Such elements always encode to this size with the same octet boundary.
+  virtual size_t getArrayOctetSize() const
+  { return 0; }
+  /// Encode count data elements of this type into data sized for all of them
+  virtual void encodeArray(Octet* data, const DataElement* const* dataElements, size_t count) const
+  { }
+  /// Decode count data elements of this type, the buffer is checked to hold all of them
+  virtual void decodeArray(DataElement* const* dataElements, size_t count, const ConstOctetBuffer& buffer, size_t index) const
+  { }
+  /// Hash count data elements of this type
+  virtual void encodeArray(HashOctetBuffer& buffer, const DataElement* const* dataElements, size_t count) const
+  { }
+
+  /// The octets of the data element if it encodes to a fixed size with its current
+  /// elements, zero otherwise. Such elements can be laid out once and written in place.
+  virtual size_t getFixedOctetSize(DataElement& dataElement) const
+  { return getArrayOctetSize(); }
+  /// Encode a data element of fixed size into zeroed data sized for it
+  virtual void encodeFixed(DataElement& dataElement, Octet* data) const
+  {
+    const DataElement* dataElements[1] = { &dataElement };
+    encodeArray(data, dataElements, 1);
+  }
+
+  /// The coder for exactly the type of the data element, zero if there is none
+  static const DataElementCoder* get(const DataElement& dataElement);
+
+protected:
+  DataElementCoder(const std::type_info& typeInfo);
+};
+
+/// The coder calling into the implementation of the public class T
+template<typename T, typename I>
+class OPENRTI_LOCAL DataElementImplementationCoder : public DataElementCoder {
+public:
+  DataElementImplementationCoder() :
+    DataElementCoder(typeid(T))
+  { }
+
+  virtual size_t decodeFrom(DataElement& dataElement, const ConstOctetBuffer& buffer, size_t index) const
+  { return Access::getImplementation(static_cast<const T&>(dataElement)).decodeFrom(buffer, index); }
+  virtual void encodeInto(const DataElement& dataElement, VariableLengthDataOctetBuffer& buffer) const
+  { Access::getImplementation(static_cast<const T&>(dataElement)).encodeInto(buffer); }
+  virtual void encodeInto(const DataElement& dataElement, HashOctetBuffer& buffer) const
+  { Access::getImplementation(static_cast<const T&>(dataElement)).encodeInto(buffer); }
+
+protected:
+  // The implementation pointer is a protected member of the public classes
+  struct Access : public T {
+    static I& getImplementation(const T& dataElement)
+    { return *(dataElement.*(&Access::_impl)); }
+  };
+};
+
+/// The coder for types of fixed size, calling into the implementation
+/// without virtual calls for all elements of an array
+template<typename T, typename I>
+class OPENRTI_LOCAL DataElementArrayCoder : public DataElementImplementationCoder<T, I> {
+public:
+  DataElementArrayCoder() :
+    _arrayOctetSize(I().getEncodedLength())
+  { }
+
+  virtual size_t getArrayOctetSize() const
+  { return _arrayOctetSize; }
+  virtual void encodeArray(Octet* data, const DataElement* const* dataElements, size_t count) const
+  {
+    OctetPointerBuffer buffer(data);
+    for (size_t i = 0; i < count; ++i)
+      Access::getImplementation(static_cast<const T&>(*dataElements[i])).encodeInto(buffer);
+  }
+  virtual void decodeArray(DataElement* const* dataElements, size_t count, const ConstOctetBuffer& buffer, size_t index) const
+  {
+    for (size_t i = 0; i < count; ++i)
+      index = Access::getImplementation(static_cast<const T&>(*dataElements[i])).decodeFrom(buffer, index);
+  }
+  virtual void encodeArray(HashOctetBuffer& buffer, const DataElement* const* dataElements, size_t count) const
+  {
+    // Encode chunks of elements on the stack and hash these in one go
+    Octet chunk[256];
+    size_t chunkCount = sizeof(chunk)/_arrayOctetSize;
+    align(buffer, _arrayOctetSize);
+    while (count) {
+      size_t n = std::min(count, chunkCount);
+      encodeArray(chunk, dataElements, n);
+      buffer.append(chunk, n*_arrayOctetSize);
+      dataElements += n;
+      count -= n;
+    }
+  }
+
+private:
+  typedef typename DataElementImplementationCoder<T, I>::Access Access;
+  size_t _arrayOctetSize;
+};
+
+/// The coder for composite types, that may be of fixed size depending on their elements
+template<typename T, typename I>
+class OPENRTI_LOCAL DataElementFixedCoder : public DataElementImplementationCoder<T, I> {
+public:
+  virtual size_t getFixedOctetSize(DataElement& dataElement) const
+  { return Access::getImplementation(static_cast<const T&>(dataElement)).getFixedOctetSize(); }
+  virtual void encodeFixed(DataElement& dataElement, Octet* data) const
+  { Access::getImplementation(static_cast<const T&>(dataElement)).encodeFixed(data); }
+
+private:
+  typedef typename DataElementImplementationCoder<T, I>::Access Access;
+};
+
+/// Remembers the coder for the type of the last data element.
+/// The elements of an array usually share their type.
+class OPENRTI_LOCAL DataElementCoderCache {
+public:
+  DataElementCoderCache() :
+    _typeInfo(0),
+    _dataElementCoder(0)
+  { }
+
+  const DataElementCoder* get(const DataElement& dataElement)
+  {
+    const std::type_info* typeInfo = &typeid(dataElement);
+    if (typeInfo != _typeInfo) {
+      _dataElementCoder = DataElementCoder::get(dataElement);
+      _typeInfo = typeInfo;
+    }
+    return _dataElementCoder;
+  }
+
+private:
+  const std::type_info* _typeInfo;
+  const DataElementCoder* _dataElementCoder;
+};
+
+/// Decode a child data element, directly where a coder is registered
+OPENRTI_LOCAL size_t decodeDataElementFrom(DataElement& dataElement, const ConstOctetBuffer& buffer, size_t index,
+                                           DataElementCoderCache& dataElementCoderCache);
+static inline size_t decodeDataElementFrom(DataElement& dataElement, const ConstOctetBuffer& buffer, size_t index)
+{
+  DataElementCoderCache dataElementCoderCache;
+  return decodeDataElementFrom(dataElement, buffer, index, dataElementCoderCache);
+}
+
+/// Encode a child data element, directly where a coder is registered
+OPENRTI_LOCAL void encodeDataElementInto(const DataElement& dataElement, VariableLengthDataOctetBuffer& buffer,
+                                         DataElementCoderCache& dataElementCoderCache);
+OPENRTI_LOCAL void encodeDataElementInto(const DataElement& dataElement, HashOctetBuffer& buffer,
+                                         DataElementCoderCache& dataElementCoderCache);
+static inline void encodeDataElementInto(const DataElement& dataElement, std::vector<Octet>& buffer,
+                                         DataElementCoderCache&)
+{ dataElement.encodeInto(buffer); }
+template<typename B>
+static inline void encodeDataElementInto(const DataElement& dataElement, B& buffer)
+{
+  DataElementCoderCache dataElementCoderCache;
+  encodeDataElementInto(dataElement, buffer, dataElementCoderCache);
+}
+
+/// The coder if all data elements are of the same type that can be coded in bulk, zero otherwise
+OPENRTI_LOCAL const DataElementCoder* getArrayDataElementCoder(const std::vector<DataElement*>& dataElementVector);
+
+/// Encode all elements of an array in bulk if possible, returns false if not
+template<typename B>
+static inline bool encodeArrayInto(const std::vector<DataElement*>& dataElementVector, B& buffer)
+{
+  const DataElementCoder* dataElementCoder = getArrayDataElementCoder(dataElementVector);
+  if (!dataElementCoder)
+    return false;
+  size_t octetSize = dataElementCoder->getArrayOctetSize();
+  align(buffer, octetSize);
+  size_t offset = buffer.size();
+  buffer.resize(offset + dataElementVector.size()*octetSize, 0);
+  dataElementCoder->encodeArray(&buffer[offset], &dataElementVector.front(), dataElementVector.size());
+  return true;
+}
+
+/// Encode a composite data element at once if it is of fixed size, returns false if not
+template<typename B, typename I>
+static inline bool encodeFixedInto(I& implementation, B& buffer)
+{
+  size_t octetSize = implementation.getFixedOctetSize();
+  if (!octetSize)
+    return false;
+  align(buffer, implementation.getOctetBoundary());
+  size_t offset = buffer.size();
+  buffer.resize(offset + octetSize, 0);
+  implementation.encodeFixed(&buffer[offset]);
+  return true;
+}
+/// The hash streams the octets anyway, there is nothing to gain
+template<typename I>
+static inline bool encodeFixedInto(I&, HashOctetBuffer&)
+{ return false; }
+
+/// Hash all elements of an array in bulk if possible, returns false if not
+static inline bool encodeArrayInto(const std::vector<DataElement*>& dataElementVector, HashOctetBuffer& buffer)
+{
+  const DataElementCoder* dataElementCoder = getArrayDataElementCoder(dataElementVector);
+  if (!dataElementCoder)
+    return false;
+  dataElementCoder->encodeArray(buffer, &dataElementVector.front(), dataElementVector.size());
+  return true;
+}
+
+/// Decode all elements of an array in bulk if possible, returns false if not
+static inline bool decodeArrayFrom(const std::vector<DataElement*>& dataElementVector, const ConstOctetBuffer& buffer, size_t& index)
+{
+  const DataElementCoder* dataElementCoder = getArrayDataElementCoder(dataElementVector);
+  if (!dataElementCoder)
+    return false;
+  size_t octetSize = dataElementCoder->getArrayOctetSize();
+  size_t offset = align(index, octetSize);
+  if (buffer.size() < offset || (buffer.size() - offset)/octetSize < dataElementVector.size())
+    throw EncoderException(L"Insufficient buffer size for decoding!");
+  dataElementCoder->decodeArray(&dataElementVector.front(), dataElementVector.size(), buffer, offset);
+  index = offset + dataElementVector.size()*octetSize;
+  return true;
+}
+
+}
+
 #endif
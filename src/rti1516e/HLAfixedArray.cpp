@@ -27,6 +27,7 @@
 
 #include "Encoding.h"
 #include "Export.h"
+#include "VariableLengthDataFriend.h"
 
 namespace rti1516e
 {
@@ -58,6 +59,8 @@ public:
 
   size_t getEncodedLength() const
   {
+    if (const DataElementCoder* dataElementCoder = getArrayDataElementCoder(_dataElementVector))
+      return _dataElementVector.size()*dataElementCoder->getArrayOctetSize();
     size_t encodedLength = 0;
     for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       const DataElement* dataElement = *i;
@@ -68,21 +71,43 @@ public:
     return encodedLength;
   }
 
-  void encodeInto(std::vector<Octet>& buffer) const
+  /// The octets of the array if its elements are of one fixed size basic type, zero otherwise
+  size_t getFixedOctetSize() const
   {
+    const DataElementCoder* dataElementCoder = getArrayDataElementCoder(_dataElementVector);
+    if (!dataElementCoder)
+      return 0;
+    return _dataElementVector.size()*dataElementCoder->getArrayOctetSize();
+  }
+
+  void encodeFixed(Octet* data) const
+  {
+    const DataElementCoder* dataElementCoder = getArrayDataElementCoder(_dataElementVector);
+    dataElementCoder->encodeArray(data, &_dataElementVector.front(), _dataElementVector.size());
+  }
+
+  template<typename B>
+  void encodeInto(B& buffer) const
+  {
+    if (encodeArrayInto(_dataElementVector, buffer))
+      return;
+    DataElementCoderCache dataElementCoderCache;
     for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       if (!*i)
         throw EncoderException(L"HLAfixedArray::encodeInto(): dataElement is zero!");
-      (*i)->encodeInto(buffer);
+      encodeDataElementInto(**i, buffer, dataElementCoderCache);
     }
   }
 
-  size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+  size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
   {
+    if (decodeArrayFrom(_dataElementVector, buffer, index))
+      return index;
+    DataElementCoderCache dataElementCoderCache;
     for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       if (!*i)
         throw EncoderException(L"HLAfixedArray::decodeFrom(): dataElement is zero!");
-      index = (*i)->decodeFrom(buffer, index);
+      index = decodeDataElementFrom(**i, buffer, index, dataElementCoderCache);
     }
     return index;
   }
@@ -143,6 +168,8 @@ public:
   DataElementVector _dataElementVector;
 };
 
+static const DataElementFixedCoder<HLAfixedArray, HLAfixedArrayImplementation> HLAfixedArrayCoder;
+
 HLAfixedArray::HLAfixedArray(const DataElement& protoType, size_t length) :
   _impl(new HLAfixedArrayImplementation(protoType, length))
 {
@@ -178,11 +205,9 @@ void
 HLAfixedArray::encode(VariableLengthData& inData) const
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer;
+  VariableLengthDataOctetBuffer buffer(VariableLengthDataFriend::writePointer(inData));
   buffer.reserve(getEncodedLength());
-  encodeInto(buffer);
-  if (!buffer.empty())
-    inData.setData(&buffer.front(), buffer.size());
+  encodeDataElementInto(*this, buffer);
 }
 
 void
@@ -195,10 +220,7 @@ HLAfixedArray::encodeInto(std::vector<Octet>& buffer) const
 void HLAfixedArray::decode(VariableLengthData const & inData)
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer(inData.size());
-  if (!buffer.empty())
-    std::memcpy(&buffer.front(), inData.data(), inData.size());
-  decodeFrom(buffer, 0);
+  decodeDataElementFrom(*this, ConstOctetBuffer(VariableLengthDataFriend::readPointer(inData)), 0);
 }
 
 size_t
@@ -27,6 +27,7 @@
 
 #include "Encoding.h"
 #include "Export.h"
+#include "VariableLengthDataFriend.h"
 
 namespace rti1516e
 {
@@ -36,11 +37,15 @@ typedef std::vector<DataElement*> DataElementVector;
 class OPENRTI_LOCAL HLAfixedRecordImplementation {
 public:
   HLAfixedRecordImplementation() :
-    _octetBoundary(0)
+    _octetBoundary(0),
+    _fieldLayoutValid(false),
+    _fixedOctetSize(0)
   {
   }
   HLAfixedRecordImplementation(const HLAfixedRecordImplementation& rhs) :
-    _octetBoundary(0)
+    _octetBoundary(0),
+    _fieldLayoutValid(false),
+    _fixedOctetSize(0)
   {
     _dataElementVector.reserve(rhs._dataElementVector.size());
     for (DataElementVector::const_iterator i = rhs._dataElementVector.begin();
@@ -56,27 +61,34 @@ public:
     }
   }
 
-  void encodeInto(std::vector<Octet>& buffer)
+  template<typename B>
+  void encodeInto(B& buffer)
   {
+    if (encodeFixedInto(*this, buffer))
+      return;
     align(buffer, getOctetBoundary());
+    DataElementCoderCache dataElementCoderCache;
     for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       align(buffer, (*i)->getOctetBoundary());
-      (*i)->encodeInto(buffer);
+      encodeDataElementInto(**i, buffer, dataElementCoderCache);
     }
   }
 
-  size_t decodeFrom(std::vector<Octet> const& buffer, size_t index)
+  size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
   {
     index = align(index, getOctetBoundary());
+    DataElementCoderCache dataElementCoderCache;
     for (DataElementVector::iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       index = align(index, (*i)->getOctetBoundary());
-      index = (*i)->decodeFrom(buffer, index);
+      index = decodeDataElementFrom(**i, buffer, index, dataElementCoderCache);
     }
     return index;
   }
 
-  size_t getEncodedLength() const
+  size_t getEncodedLength()
   {
+    if (size_t fixedOctetSize = getFixedOctetSize())
+      return fixedOctetSize;
     size_t length = 0;
     for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       length = align(length, (*i)->getOctetBoundary());
@@ -100,6 +112,59 @@ public:
     return _octetBoundary;
   }
 
+  /// The octets of the record if all fields are of fixed size, zero otherwise.
+  /// The layout is computed once, fields of fixed size records and arrays are
+  /// checked against it since their elements may change behind our back.
+  size_t getFixedOctetSize()
+  {
+    if (!_fieldLayoutValid)
+      return updateFieldLayout();
+    for (FieldLayoutVector::const_iterator i = _fieldLayoutVector.begin(); i != _fieldLayoutVector.end(); ++i) {
+      if (!i->_composite)
+        continue;
+      DataElement& dataElement = *_dataElementVector[i - _fieldLayoutVector.begin()];
+      if (i->_dataElementCoder->getFixedOctetSize(dataElement) != i->_octetSize ||
+          dataElement.getOctetBoundary() != i->_octetBoundary)
+        return updateFieldLayout();
+    }
+    return _fixedOctetSize;
+  }
+
+  /// Write all fields at their precomputed offsets into zeroed data
+  void encodeFixed(Octet* data)
+  {
+    for (FieldLayoutVector::const_iterator i = _fieldLayoutVector.begin(); i != _fieldLayoutVector.end(); ++i)
+      i->_dataElementCoder->encodeFixed(*_dataElementVector[i - _fieldLayoutVector.begin()], data + i->_offset);
+  }
+
+  size_t updateFieldLayout()
+  {
+    _fieldLayoutValid = true;
+    _fieldLayoutVector.clear();
+    _fixedOctetSize = 0;
+    size_t offset = 0;
+    for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
+      FieldLayout fieldLayout;
+      fieldLayout._dataElementCoder = DataElementCoder::get(**i);
+      if (!fieldLayout._dataElementCoder)
+        break;
+      fieldLayout._octetSize = fieldLayout._dataElementCoder->getFixedOctetSize(**i);
+      if (!fieldLayout._octetSize)
+        break;
+      fieldLayout._octetBoundary = (*i)->getOctetBoundary();
+      fieldLayout._offset = offset = align(offset, fieldLayout._octetBoundary);
+      fieldLayout._composite = !fieldLayout._dataElementCoder->getArrayOctetSize();
+      _fieldLayoutVector.push_back(fieldLayout);
+      offset += fieldLayout._octetSize;
+    }
+    if (_fieldLayoutVector.empty() || _fieldLayoutVector.size() != _dataElementVector.size()) {
+      _fieldLayoutVector.clear();
+      return 0;
+    }
+    _fixedOctetSize = offset;
+    return _fixedOctetSize;
+  }
+
   bool isSameTypeAs(const HLAfixedRecordImplementation& rhs) const
   {
     if (_dataElementVector.size() != rhs._dataElementVector.size())
@@ -126,6 +191,7 @@ public:
   {
     _dataElementVector.push_back(dataElement.clone().release());
     _octetBoundary = 0;
+    _fieldLayoutValid = false;
   }
 
   void appendElementPointer(DataElement* dataElement)
@@ -134,6 +200,7 @@ public:
       throw EncoderException(L"HLAfixedRecord::appendElementPointer: Null pointer given!");
     _dataElementVector.push_back(dataElement);
     _octetBoundary = 0;
+    _fieldLayoutValid = false;
   }
 
   void set(size_t index, const DataElement& dataElement)
@@ -145,6 +212,7 @@ public:
     delete _dataElementVector[index];
     _dataElementVector[index] = dataElement.clone().release();
     _octetBoundary = 0;
+    _fieldLayoutValid = false;
   }
 
   void setElementPointer(size_t index, DataElement* dataElement)
@@ -158,6 +226,7 @@ public:
     delete _dataElementVector[index];
     _dataElementVector[index] = dataElement;
     _octetBoundary = 0;
+    _fieldLayoutValid = false;
   }
 
   const DataElement& get(size_t index) const
@@ -174,10 +243,25 @@ public:
     return *_dataElementVector[index];
   }
 
+  // Where a field of fixed size goes in the encoding of the record
+  struct FieldLayout {
+    const DataElementCoder* _dataElementCoder;
+    size_t _offset;
+    size_t _octetSize;
+    unsigned _octetBoundary;
+    bool _composite;
+  };
+  typedef std::vector<FieldLayout> FieldLayoutVector;
+
   DataElementVector _dataElementVector;
   unsigned _octetBoundary;
+  bool _fieldLayoutValid;
+  FieldLayoutVector _fieldLayoutVector;
+  size_t _fixedOctetSize;
 };
 
+static const DataElementFixedCoder<HLAfixedRecord, HLAfixedRecordImplementation> HLAfixedRecordCoder;
+
 HLAfixedRecord::HLAfixedRecord() :
   _impl(new HLAfixedRecordImplementation)
 {
@@ -213,11 +297,9 @@ void
 HLAfixedRecord::encode(VariableLengthData& inData) const
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer;
+  VariableLengthDataOctetBuffer buffer(VariableLengthDataFriend::writePointer(inData));
   buffer.reserve(getEncodedLength());
-  encodeInto(buffer);
-  if (!buffer.empty())
-    inData.setData(&buffer.front(), buffer.size());
+  encodeDataElementInto(*this, buffer);
 }
 
 void
@@ -231,10 +313,7 @@ void
 HLAfixedRecord::decode(VariableLengthData const& inData)
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer(inData.size());
-  if (!buffer.empty())
-    std::memcpy(&buffer.front(), inData.data(), inData.size());
-  decodeFrom(buffer, 0);
+  decodeDataElementFrom(*this, ConstOctetBuffer(VariableLengthDataFriend::readPointer(inData)), 0);
 }
 
 size_t
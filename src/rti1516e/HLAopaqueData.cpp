@@ -28,6 +28,7 @@
 #include "Export.h"
 #include "Encoding.h"
 #include "Types.h"
+#include "VariableLengthDataFriend.h"
 
 namespace rti1516e
 {
@@ -61,7 +62,8 @@ public:
   {
   }
 
-  void encodeInto(std::vector<Octet>& buffer) const
+  template<typename B>
+  void encodeInto(B& buffer) const
   {
     align(buffer, 4);
     size_t length = _buffer.size();
@@ -72,10 +74,11 @@ public:
     buffer.push_back(uint8_t(length >> 8));
     buffer.push_back(uint8_t(length));
 
-    buffer.insert(buffer.end(), _buffer.begin(), _buffer.end());
+    if (!_buffer.empty())
+      append(buffer, &_buffer.front(), _buffer.size());
   }
 
-  size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+  size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
   {
     index = align(index, 4);
     if (buffer.size() < index + 4)
@@ -86,12 +89,9 @@ public:
     length |= size_t(uint8_t(buffer[index + 3]));
     index = index + 4;
 
-    std::vector<Octet>::const_iterator b = buffer.begin();
-    std::advance(b, index);
-    std::vector<Octet>::const_iterator e = b;
-    std::advance(e, length);
-    _buffer.resize(0);
-    _buffer.insert(_buffer.end(), b, e);
+    if (buffer.size() - index < length)
+      throw EncoderException(L"HLAopaqueData::decodeFrom(): Insufficient buffer size for decoding!");
+    _buffer.assign(buffer.data(index), buffer.data(index) + length);
 
     return index + length;
   }
@@ -127,6 +127,8 @@ public:
   std::vector<Octet> _buffer;
 };
 
+static const DataElementImplementationCoder<HLAopaqueData, HLAopaqueDataImplementation> HLAopaqueDataCoder;
+
 HLAopaqueData::HLAopaqueData() :
   _impl(new HLAopaqueDataImplementation())
 {
@@ -173,10 +175,9 @@ void
 HLAopaqueData::encode(VariableLengthData& inData) const
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer;
+  VariableLengthDataOctetBuffer buffer(VariableLengthDataFriend::writePointer(inData));
   buffer.reserve(getEncodedLength());
-  encodeInto(buffer);
-  inData.setData(&buffer.front(), buffer.size());
+  encodeDataElementInto(*this, buffer);
 }
 
 void
@@ -189,10 +190,7 @@ HLAopaqueData::encodeInto(std::vector<Octet>& buffer) const
 void HLAopaqueData::decode(VariableLengthData const & inData)
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer(inData.size());
-  if (inData.size())
-    std::memcpy(&buffer.front(), inData.data(), inData.size());
-  decodeFrom(buffer, 0);
+  decodeDataElementFrom(*this, ConstOctetBuffer(VariableLengthDataFriend::readPointer(inData)), 0);
 }
 
 size_t
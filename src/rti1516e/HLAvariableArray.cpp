@@ -30,6 +30,7 @@
 #include "Encoding.h"
 #include "Export.h"
 #include "Types.h"
+#include "VariableLengthDataFriend.h"
 
 namespace rti1516e
 {
@@ -60,7 +61,8 @@ public:
     _protoType = 0;
   }
 
-  void encodeInto(std::vector<Octet>& buffer) const
+  template<typename B>
+  void encodeInto(B& buffer) const
   {
     unsigned int octetBoundary = getOctetBoundary();
     align(buffer, octetBoundary);
@@ -73,14 +75,17 @@ public:
     buffer.push_back(uint8_t(length));
     align(buffer, octetBoundary);
 
+    if (encodeArrayInto(_dataElementVector, buffer))
+      return;
+    DataElementCoderCache dataElementCoderCache;
     for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       if (!*i)
         throw EncoderException(L"HLAvariableArray::encodeInto(): dataElement is zero!");
-      (*i)->encodeInto(buffer);
+      encodeDataElementInto(**i, buffer, dataElementCoderCache);
     }
   }
 
-  size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+  size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
   {
     unsigned int octetBoundary = getOctetBoundary();
     index = align(index, octetBoundary);
@@ -102,10 +107,13 @@ public:
     while (_dataElementVector.size() < length)
       _dataElementVector.push_back(_protoType->clone().release());
 
+    if (decodeArrayFrom(_dataElementVector, buffer, index))
+      return index;
+    DataElementCoderCache dataElementCoderCache;
     for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       if (!*i)
         throw EncoderException(L"HLAvariableArray::decodeFrom(): dataElement is zero!");
-      index = (*i)->decodeFrom(buffer, index);
+      index = decodeDataElementFrom(**i, buffer, index, dataElementCoderCache);
     }
 
     return index;
@@ -116,6 +124,10 @@ public:
     size_t encodedLength = 4;
     if (_protoType)
       encodedLength = align(encodedLength, _protoType->getOctetBoundary());
+    if (const DataElementCoder* dataElementCoder = getArrayDataElementCoder(_dataElementVector)) {
+      size_t octetSize = dataElementCoder->getArrayOctetSize();
+      return align(encodedLength, octetSize) + _dataElementVector.size()*octetSize;
+    }
     for (DataElementVector::const_iterator i = _dataElementVector.begin(); i != _dataElementVector.end(); ++i) {
       const DataElement* dataElement = *i;
       if (!dataElement)
@@ -191,6 +203,8 @@ public:
   DataElementVector _dataElementVector;
 };
 
+static const DataElementImplementationCoder<HLAvariableArray, HLAvariableArrayImplementation> HLAvariableArrayCoder;
+
 HLAvariableArray::HLAvariableArray(const DataElement& protoType) :
   _impl(new HLAvariableArrayImplementation(protoType))
 {
@@ -226,11 +240,9 @@ void
 HLAvariableArray::encode(VariableLengthData& inData) const
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer;
+  VariableLengthDataOctetBuffer buffer(VariableLengthDataFriend::writePointer(inData));
   buffer.reserve(getEncodedLength());
-  encodeInto(buffer);
-  if (!buffer.empty())
-    inData.setData(&buffer.front(), buffer.size());
+  encodeDataElementInto(*this, buffer);
 }
 
 void
@@ -243,10 +255,7 @@ HLAvariableArray::encodeInto(std::vector<Octet>& buffer) const
 void HLAvariableArray::decode(VariableLengthData const & inData)
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer(inData.size());
-  if (!buffer.empty())
-    std::memcpy(&buffer.front(), inData.data(), inData.size());
-  decodeFrom(buffer, 0);
+  decodeDataElementFrom(*this, ConstOctetBuffer(VariableLengthDataFriend::readPointer(inData)), 0);
 }
 
 size_t
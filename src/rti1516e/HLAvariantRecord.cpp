@@ -27,6 +27,7 @@
 
 #include "Encoding.h"
 #include "Export.h"
+#include "VariableLengthDataFriend.h"
 
 namespace rti1516e
 {
@@ -47,12 +48,13 @@ public:
   {
   }
 
-  void encodeInto(std::vector<Octet>& buffer)
+  template<typename B>
+  void encodeInto(B& buffer)
   {
     /* FIXME */
   }
 
-  size_t decodeFrom(std::vector<Octet> const & buffer, size_t index)
+  size_t decodeFrom(const ConstOctetBuffer& buffer, size_t index)
   {
     /* FIXME */
     return index;
@@ -127,6 +129,8 @@ public:
   unsigned _octetBoundary;
 };
 
+static const DataElementImplementationCoder<HLAvariantRecord, HLAvariantRecordImplementation> HLAvariantRecordCoder;
+
 HLAvariantRecord::HLAvariantRecord(DataElement const& discriminantPrototype) :
     /*FIXME*/
   // _impl(new HLAvariantRecordImplementation(discriminantPrototype))
@@ -166,10 +170,9 @@ void
 HLAvariantRecord::encode(VariableLengthData& inData) const
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer;
+  VariableLengthDataOctetBuffer buffer(VariableLengthDataFriend::writePointer(inData));
   buffer.reserve(getEncodedLength());
-  encodeInto(buffer);
-  inData.setData(&buffer.front(), buffer.size());
+  encodeDataElementInto(*this, buffer);
 }
 
 void
@@ -182,9 +185,7 @@ HLAvariantRecord::encodeInto(std::vector<Octet>& buffer) const
 void HLAvariantRecord::decode(VariableLengthData const & inData)
   RTI_THROW ((EncoderException))
 {
-  std::vector<Octet> buffer(inData.size());
-  std::memcpy(&buffer.front(), inData.data(), inData.size());
-  decodeFrom(buffer, 0);
+  decodeDataElementFrom(*this, ConstOctetBuffer(VariableLengthDataFriend::readPointer(inData)), 0);
 }
 
 size_t
@@ -32,10 +32,11 @@
 #include <RTI/LogicalTimeInterval.h>
 #include <RTI/LogicalTimeFactory.h>
 #include <RTI/RangeBounds.h>
+#include <OpenRTI/RTIambassadorFriend.h>
 
 #include "Ambassador.h"
 #include "DynamicModule.h"
-#include "FDD1516EFileReader.h"
+#include "FOMModuleCache.h"
 #include "LogStream.h"
 #include "TemplateTimeManagement.h"
 
@@ -72,7 +73,19 @@ static std::list<std::string> findHLAstandardMIMCandidates()
 static void loadModule(OpenRTI::FOMStringModuleList& fomModuleList, std::istream& stream, const std::string& encoding)
 {
   try {
-    fomModuleList.push_back(OpenRTI::FDD1516EFileReader::read(stream, encoding));
+    fomModuleList.push_back(OpenRTI::FOMModuleCache::read(OpenRTI::FOMModuleCache::FDD1516EFormat, stream, encoding));
+  } catch (const OpenRTI::Exception& e) {
+    throw rti1516e::ErrorReadingFDD(OpenRTI::utf8ToUcs(e.what()));
+  } catch (...) {
+    throw rti1516e::RTIinternalError(L"Unknown error while reading fdd file");
+  }
+}
+
+// Returns false if the file cannot be opened
+static bool loadModuleFile(OpenRTI::FOMStringModuleList& fomModuleList, const std::string& fileName)
+{
+  try {
+    return OpenRTI::FOMModuleCache::readFile(fomModuleList, OpenRTI::FOMModuleCache::FDD1516EFormat, fileName, std::string());
   } catch (const OpenRTI::Exception& e) {
     throw rti1516e::ErrorReadingFDD(OpenRTI::utf8ToUcs(e.what()));
   } catch (...) {
@@ -84,12 +97,8 @@ static void loadHLAstandardMIM(OpenRTI::FOMStringModuleList& fomModuleList)
 {
   std::list<std::string> candidates = findHLAstandardMIMCandidates();
   for (std::list<std::string>::const_iterator i = candidates.begin(); i != candidates.end(); ++i) {
-    std::ifstream stream(utf8ToLocale(*i).c_str());
-    if (!stream.is_open())
-      continue;
-
-    loadModule(fomModuleList, stream, std::string());
-    break;
+    if (loadModuleFile(fomModuleList, utf8ToLocale(*i)))
+      break;
   }
   if (fomModuleList.empty()) {
     std::string s(HLAstandardMIM_xml, sizeof(HLAstandardMIM_xml));
@@ -102,9 +111,7 @@ static void loadModule(OpenRTI::FOMStringModuleList& fomModuleList, const std::w
 {
   if (fomModule.empty())
     throw rti1516e::CouldNotOpenFDD(L"Empty module.");
-  std::ifstream stream(OpenRTI::ucsToLocale(fomModule).c_str());
-  if (stream.is_open()) {
-    loadModule(fomModuleList, stream, std::string());
+  if (loadModuleFile(fomModuleList, OpenRTI::ucsToLocale(fomModule))) {
   } else if (fomModule.compare(0, 8, L"file:///") == 0) {
     loadModule(fomModuleList, fomModule.substr(8));
   } else if (fomModule.compare(0, 16, L"data:text/plain,") == 0) {
@@ -716,253 +723,277 @@ public:
     }
   }
 
-  // // 4.12
-  // virtual void
-  // initiateFederateSave(std::string const& label)
-  //   RTI_THROW ((OpenRTI::UnableToPerformSave,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->initiateFederateSave(label);
-  //   } catch (const rti1516e::UnableToPerformSave& e) {
-  //     throw OpenRTI::UnableToPerformSave(e.what());
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // virtual void
-  // initiateFederateSave(const std::string& label,
-  //                      const LogicalTime& logicalTime)
-  //   RTI_THROW ((OpenRTI::UnableToPerformSave,
-  //          OpenRTI::InvalidLogicalTime,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->initiateFederateSave(label, RTI1516ELogicalTimeImplementation::getLogicalTime(logicalTime));
-  //   } catch (const rti1516e::UnableToPerformSave& e) {
-  //     throw OpenRTI::UnableToPerformSave(e.what());
-  //   } catch (const rti1516e::InvalidLogicalTime& e) {
-  //     throw OpenRTI::InvalidLogicalTime(e.what());
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.15
-  // virtual void
-  // federationSaved()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationSaved();
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // virtual void
-  // federationNotSaved(OpenRTI::SaveFailureReason reason)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-
-  //   rti1516e::SaveFailureReason rti1516Reason;
-  //   switch (reason) {
-  //   case OpenRTI::RTI_UNABLE_TO_SAVE:
-  //     rti1516Reason = rti1516e::RTI_UNABLE_TO_SAVE;
-  //     break;
-  //   case OpenRTI::FEDERATE_REPORTED_FAILURE_DURING_SAVE:
-  //     rti1516Reason = rti1516e::FEDERATE_REPORTED_FAILURE_DURING_SAVE;
-  //     break;
-  //   case OpenRTI::FEDERATE_RESIGNED_DURING_SAVE:
-  //     rti1516Reason = rti1516e::FEDERATE_RESIGNED_DURING_SAVE;
-  //     break;
-  //   case OpenRTI::RTI_DETECTED_FAILURE_DURING_SAVE:
-  //     rti1516Reason = rti1516e::RTI_DETECTED_FAILURE_DURING_SAVE;
-  //     break;
-  //   case OpenRTI::SAVE_TIME_CANNOT_BE_HONORED:
-  //     rti1516Reason = rti1516e::SAVE_TIME_CANNOT_BE_HONORED;
-  //     break;
-  //   default:
-  //     throw OpenRTI::FederateInternalError();
-  //   }
-
-  //   try {
-  //     _federateAmbassador->federationNotSaved(rti1516Reason);
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-
-  // // 4.17
-  // virtual void
-  // federationSaveStatusResponse(OpenRTI::FederateHandleSaveStatusPairVector const& federateStatusVector)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //  /* enum SaveStatus */
-  //  /* { */
-  //  /*    NO_SAVE_IN_PROGRESS, */
-  //  /*    FEDERATE_INSTRUCTED_TO_SAVE, */
-  //  /*    FEDERATE_SAVING, */
-  //  /*    FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE */
-  //  /* }; */
-
-  //   try {
-  //     throw rti1516e::FederateInternalError(L"Not implemented");
-  //     // _federateAmbassador
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.19
-  // virtual void
-  // requestFederationRestoreSucceeded(std::string const& label)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->requestFederationRestoreSucceeded(label);
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // virtual void
-  // requestFederationRestoreFailed(std::string const& label)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->requestFederationRestoreFailed(label);
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-
-  // // 4.20
-  // virtual void
-  // federationRestoreBegun()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationRestoreBegun();
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.21
-  // virtual void
-  // initiateFederateRestore(std::string const & label,
-  //                         FederateHandle handle)
-  //   RTI_THROW ((OpenRTI::SpecifiedSaveLabelDoesNotExist,
-  //          OpenRTI::CouldNotInitiateRestore,
-  //          OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     OpenRTI::_O1516EFederateHandle rti1516Handle(handle);
-  //     _federateAmbassador->initiateFederateRestore(label, rti1516Handle);
-  //   } catch (const rti1516e::SpecifiedSaveLabelDoesNotExist& e) {
-  //     throw OpenRTI::SpecifiedSaveLabelDoesNotExist(e.what());
-  //   } catch (const rti1516e::CouldNotInitiateRestore& e) {
-  //     throw OpenRTI::CouldNotInitiateRestore(e.what());
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.23
-  // virtual
-  // void federationRestored()
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-  //   try {
-  //     _federateAmbassador->federationRestored();
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // virtual void
-  // federationNotRestored(RestoreFailureReason reason)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-
-  //   rti1516e::RestoreFailureReason rti1516Reason;
-  //   switch (reason) {
-  //   case OpenRTI::RTI_UNABLE_TO_RESTORE:
-  //     rti1516Reason = rti1516e::RTI_UNABLE_TO_RESTORE;
-  //     break;
-  //   case OpenRTI::FEDERATE_REPORTED_FAILURE_DURING_RESTORE:
-  //     rti1516Reason = rti1516e::FEDERATE_REPORTED_FAILURE_DURING_RESTORE;
-  //     break;
-  //   case OpenRTI::FEDERATE_RESIGNED_DURING_RESTORE:
-  //     rti1516Reason = rti1516e::FEDERATE_RESIGNED_DURING_RESTORE;
-  //     break;
-  //   case OpenRTI::RTI_DETECTED_FAILURE_DURING_RESTORE:
-  //     rti1516Reason = rti1516e::RTI_DETECTED_FAILURE_DURING_RESTORE;
-  //     break;
-  //   default:
-  //     throw OpenRTI::FederateInternalError();
-  //   }
-
-  //   try {
-  //     _federateAmbassador->federationNotRestored(rti1516Reason);
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
-
-  // // 4.25
-  // virtual void
-  // federationRestoreStatusResponse(FederateHandleRestoreStatusPairVector const& theFederateStatusVector)
-  //   RTI_THROW ((OpenRTI::FederateInternalError))
-  // {
-  //   if (!_federateAmbassador)
-  //     throw OpenRTI::FederateInternalError();
-
-
-  //  /* enum RestoreStatus */
-  //  /* { */
-  //  /*    NO_RESTORE_IN_PROGRESS, */
-  //  /*    FEDERATE_RESTORE_REQUEST_PENDING, */
-  //  /*    FEDERATE_WAITING_FOR_RESTORE_TO_BEGIN, */
-  //  /*    FEDERATE_PREPARED_TO_RESTORE, */
-  //  /*    FEDERATE_RESTORING, */
-  //  /*    FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE */
-  //  /* }; */
-
-
-  //   try {
-  //     throw rti1516e::FederateInternalError(L"Not implemented");
-  //     // _federateAmbassador
-  //   } catch (const rti1516e::Exception& e) {
-  //     throw OpenRTI::FederateInternalError(e.what());
-  //   }
-  // }
+  // 4.12
+  virtual void initiateFederateSave(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EString rti1516Label(label);
+      _federateAmbassador->initiateFederateSave(rti1516Label);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  virtual void initiateFederateSave(const std::string& label, const rti1516e::LogicalTime& logicalTime)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EString rti1516Label(label);
+      _federateAmbassador->initiateFederateSave(rti1516Label, logicalTime);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.15
+  virtual void federationSaved()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationSaved();
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  virtual void federationNotSaved(OpenRTI::SaveFailureReason reason)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      rti1516e::SaveFailureReason rti1516Reason;
+      switch (reason) {
+      case OpenRTI::RTI_UNABLE_TO_SAVE:
+        rti1516Reason = rti1516e::RTI_UNABLE_TO_SAVE;
+        break;
+      case OpenRTI::FEDERATE_REPORTED_FAILURE_DURING_SAVE:
+        rti1516Reason = rti1516e::FEDERATE_REPORTED_FAILURE_DURING_SAVE;
+        break;
+      case OpenRTI::FEDERATE_RESIGNED_DURING_SAVE:
+        rti1516Reason = rti1516e::FEDERATE_RESIGNED_DURING_SAVE;
+        break;
+      case OpenRTI::SAVE_TIME_CANNOT_BE_HONORED:
+        rti1516Reason = rti1516e::SAVE_TIME_CANNOT_BE_HONORED;
+        break;
+      case OpenRTI::SAVE_ABORTED:
+        rti1516Reason = rti1516e::SAVE_ABORTED;
+        break;
+      default:
+        rti1516Reason = rti1516e::RTI_DETECTED_FAILURE_DURING_SAVE;
+        break;
+      }
+      _federateAmbassador->federationNotSaved(rti1516Reason);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.17
+  virtual void federationSaveStatusResponse(const OpenRTI::FederateHandleSaveStatusPairVector& federateHandleSaveStatusPairVector)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      rti1516e::FederateHandleSaveStatusPairVector rti1516FederateStatusVector;
+      rti1516FederateStatusVector.reserve(federateHandleSaveStatusPairVector.size());
+      for (OpenRTI::FederateHandleSaveStatusPairVector::const_iterator i = federateHandleSaveStatusPairVector.begin();
+           i != federateHandleSaveStatusPairVector.end(); ++i) {
+        rti1516e::SaveStatus saveStatus;
+        switch (i->second) {
+        case OpenRTI::FEDERATE_INSTRUCTED_TO_SAVE:
+          saveStatus = rti1516e::FEDERATE_INSTRUCTED_TO_SAVE;
+          break;
+        case OpenRTI::FEDERATE_SAVING:
+          saveStatus = rti1516e::FEDERATE_SAVING;
+          break;
+        case OpenRTI::FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE:
+          saveStatus = rti1516e::FEDERATE_WAITING_FOR_FEDERATION_TO_SAVE;
+          break;
+        default:
+          saveStatus = rti1516e::NO_SAVE_IN_PROGRESS;
+          break;
+        }
+        rti1516FederateStatusVector.push_back(rti1516e::FederateHandleSaveStatusPair(OpenRTI::_O1516EFederateHandle(i->first), saveStatus));
+      }
+      _federateAmbassador->federationSaveStatusResponse(rti1516FederateStatusVector);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.19
+  virtual void requestFederationRestoreSucceeded(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EString rti1516Label(label);
+      _federateAmbassador->requestFederationRestoreSucceeded(rti1516Label);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  virtual void requestFederationRestoreFailed(const std::string& label)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EString rti1516Label(label);
+      _federateAmbassador->requestFederationRestoreFailed(rti1516Label);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.20
+  virtual void federationRestoreBegun()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationRestoreBegun();
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.21
+  virtual void initiateFederateRestore(const std::string& label, const std::string& federateName, const OpenRTI::FederateHandle& federateHandle)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EString rti1516Label(label);
+      OpenRTI::_O1516EString rti1516FederateName(federateName);
+      OpenRTI::_O1516EFederateHandle rti1516Handle(federateHandle);
+      _federateAmbassador->initiateFederateRestore(rti1516Label, rti1516FederateName, rti1516Handle);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.23
+  virtual void federationRestored()
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      _federateAmbassador->federationRestored();
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  virtual void federationNotRestored(OpenRTI::RestoreFailureReason reason)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      rti1516e::RestoreFailureReason rti1516Reason;
+      switch (reason) {
+      case OpenRTI::RTI_UNABLE_TO_RESTORE:
+        rti1516Reason = rti1516e::RTI_UNABLE_TO_RESTORE;
+        break;
+      case OpenRTI::FEDERATE_REPORTED_FAILURE_DURING_RESTORE:
+        rti1516Reason = rti1516e::FEDERATE_REPORTED_FAILURE_DURING_RESTORE;
+        break;
+      case OpenRTI::FEDERATE_RESIGNED_DURING_RESTORE:
+        rti1516Reason = rti1516e::FEDERATE_RESIGNED_DURING_RESTORE;
+        break;
+      case OpenRTI::RESTORE_ABORTED:
+        rti1516Reason = rti1516e::RESTORE_ABORTED;
+        break;
+      default:
+        rti1516Reason = rti1516e::RTI_DETECTED_FAILURE_DURING_RESTORE;
+        break;
+      }
+      _federateAmbassador->federationNotRestored(rti1516Reason);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 4.25
+  virtual void federationRestoreStatusResponse(const OpenRTI::FederateHandleRestoreStatusPairVector& federateHandleRestoreStatusPairVector)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      rti1516e::FederateRestoreStatusVector rti1516FederateStatusVector;
+      rti1516FederateStatusVector.reserve(federateHandleRestoreStatusPairVector.size());
+      for (OpenRTI::FederateHandleRestoreStatusPairVector::const_iterator i = federateHandleRestoreStatusPairVector.begin();
+           i != federateHandleRestoreStatusPairVector.end(); ++i) {
+        rti1516e::RestoreStatus restoreStatus;
+        switch (i->second) {
+        case OpenRTI::FEDERATE_RESTORE_REQUEST_PENDING:
+          restoreStatus = rti1516e::FEDERATE_RESTORE_REQUEST_PENDING;
+          break;
+        case OpenRTI::FEDERATE_WAITING_FOR_RESTORE_TO_BEGIN:
+          restoreStatus = rti1516e::FEDERATE_WAITING_FOR_RESTORE_TO_BEGIN;
+          break;
+        case OpenRTI::FEDERATE_PREPARED_TO_RESTORE:
+          restoreStatus = rti1516e::FEDERATE_PREPARED_TO_RESTORE;
+          break;
+        case OpenRTI::FEDERATE_RESTORING:
+          restoreStatus = rti1516e::FEDERATE_RESTORING;
+          break;
+        case OpenRTI::FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE:
+          restoreStatus = rti1516e::FEDERATE_WAITING_FOR_FEDERATION_TO_RESTORE;
+          break;
+        default:
+          restoreStatus = rti1516e::NO_RESTORE_IN_PROGRESS;
+          break;
+        }
+        // Federate handles are kept across a restore
+        OpenRTI::_O1516EFederateHandle rti1516Handle(i->first);
+        rti1516FederateStatusVector.push_back(rti1516e::FederateRestoreStatus(rti1516Handle, rti1516Handle, restoreStatus));
+      }
+      _federateAmbassador->federationRestoreStatusResponse(rti1516FederateStatusVector);
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
 
   /////////////////////////////////////
   // Declaration Management Services //
@@ -1414,6 +1445,87 @@ public:
     }
   }
 
+  // 6.24
+  virtual
+  void
+  confirmAttributeTransportationTypeChange(ObjectInstanceHandle objectInstanceHandle, const AttributeHandleVector& attributeHandleVector,
+                                           TransportationType transportationType)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EObjectInstanceHandle rti1516ObjectInstanceHandle(objectInstanceHandle);
+      OpenRTI::_O1516EAttributeHandleSet rti1516AttributeHandleSet(attributeHandleVector);
+      _federateAmbassador->confirmAttributeTransportationTypeChange(rti1516ObjectInstanceHandle, rti1516AttributeHandleSet,
+                                                                    translate(transportationType));
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 6.26
+  virtual
+  void
+  reportAttributeTransportationType(ObjectInstanceHandle objectInstanceHandle, AttributeHandle attributeHandle,
+                                    TransportationType transportationType)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EObjectInstanceHandle rti1516ObjectInstanceHandle(objectInstanceHandle);
+      OpenRTI::_O1516EAttributeHandle rti1516AttributeHandle(attributeHandle);
+      _federateAmbassador->reportAttributeTransportationType(rti1516ObjectInstanceHandle, rti1516AttributeHandle,
+                                                             translate(transportationType));
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 6.28
+  virtual
+  void
+  confirmInteractionTransportationTypeChange(InteractionClassHandle interactionClassHandle, TransportationType transportationType)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EInteractionClassHandle rti1516InteractionClassHandle(interactionClassHandle);
+      _federateAmbassador->confirmInteractionTransportationTypeChange(rti1516InteractionClassHandle, translate(transportationType));
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
+  // 6.30
+  virtual
+  void
+  reportInteractionTransportationType(FederateHandle federateHandle, InteractionClassHandle interactionClassHandle,
+                                      TransportationType transportationType)
+    RTI_NOEXCEPT
+  {
+    if (!_federateAmbassador) {
+      Log(FederateAmbassador, Warning) << "Calling callback with zero ambassador!" << std::endl;
+      return;
+    }
+    try {
+      OpenRTI::_O1516EFederateHandle rti1516FederateHandle(federateHandle);
+      OpenRTI::_O1516EInteractionClassHandle rti1516InteractionClassHandle(interactionClassHandle);
+      _federateAmbassador->reportInteractionTransportationType(rti1516FederateHandle, rti1516InteractionClassHandle,
+                                                               translate(transportationType));
+    } catch (const rti1516e::Exception& e) {
+      Log(FederateAmbassador, Warning) << "Caught an rti1516e exception in callback: " << e.what() << std::endl;
+    }
+  }
+
   ///////////////////////////////////
   // Ownership Management Services //
   ///////////////////////////////////
@@ -6460,4 +6572,195 @@ RTIambassadorImplementation::decodeRegionHandle(rti1516e::VariableLengthData con
   }
 }
 
+void
+RTIambassadorImplementation::enableAttributeCache(rti1516e::ObjectClassHandle rti1516ObjectClassHandle,
+                                                  rti1516e::AttributeHandle rti1516AttributeHandle, size_t octetSize)
+  RTI_THROW ((rti1516e::ObjectClassNotDefined,
+         rti1516e::AttributeNotDefined,
+         rti1516e::FederateNotExecutionMember,
+         rti1516e::NotConnected,
+         rti1516e::RTIinternalError))
+{
+  try {
+    OpenRTI::_I1516EObjectClassHandle objectClassHandle(rti1516ObjectClassHandle);
+    OpenRTI::_I1516EAttributeHandle attributeHandle(rti1516AttributeHandle);
+    _ambassadorInterface->enableAttributeCache(objectClassHandle, attributeHandle, octetSize);
+  } catch (const OpenRTI::ObjectClassNotDefined& e) {
+    throw rti1516e::ObjectClassNotDefined(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const OpenRTI::AttributeNotDefined& e) {
+    throw rti1516e::AttributeNotDefined(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const OpenRTI::FederateNotExecutionMember& e) {
+    throw rti1516e::FederateNotExecutionMember(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const OpenRTI::NotConnected& e) {
+    throw rti1516e::NotConnected(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const std::exception& e) {
+    throw rti1516e::RTIinternalError(OpenRTI::utf8ToUcs(e.what()));
+  } catch (...) {
+    throw rti1516e::RTIinternalError(L"Unknown internal error!");
+  }
+}
+
+void
+RTIambassadorImplementation::disableAttributeCache(rti1516e::ObjectClassHandle rti1516ObjectClassHandle)
+  RTI_THROW ((rti1516e::ObjectClassNotDefined,
+         rti1516e::FederateNotExecutionMember,
+         rti1516e::NotConnected,
+         rti1516e::RTIinternalError))
+{
+  try {
+    OpenRTI::_I1516EObjectClassHandle objectClassHandle(rti1516ObjectClassHandle);
+    _ambassadorInterface->disableAttributeCache(objectClassHandle);
+  } catch (const OpenRTI::ObjectClassNotDefined& e) {
+    throw rti1516e::ObjectClassNotDefined(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const OpenRTI::FederateNotExecutionMember& e) {
+    throw rti1516e::FederateNotExecutionMember(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const OpenRTI::NotConnected& e) {
+    throw rti1516e::NotConnected(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const std::exception& e) {
+    throw rti1516e::RTIinternalError(OpenRTI::utf8ToUcs(e.what()));
+  } catch (...) {
+    throw rti1516e::RTIinternalError(L"Unknown internal error!");
+  }
+}
+
+const AttributeCache*
+RTIambassadorImplementation::getAttributeCache(rti1516e::ObjectClassHandle rti1516ObjectClassHandle) const
+  RTI_THROW ((rti1516e::ObjectClassNotDefined,
+         rti1516e::FederateNotExecutionMember,
+         rti1516e::NotConnected,
+         rti1516e::RTIinternalError))
+{
+  try {
+    OpenRTI::_I1516EObjectClassHandle objectClassHandle(rti1516ObjectClassHandle);
+    return _ambassadorInterface->getAttributeCache(objectClassHandle);
+  } catch (const OpenRTI::ObjectClassNotDefined& e) {
+    throw rti1516e::ObjectClassNotDefined(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const OpenRTI::FederateNotExecutionMember& e) {
+    throw rti1516e::FederateNotExecutionMember(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const OpenRTI::NotConnected& e) {
+    throw rti1516e::NotConnected(OpenRTI::utf8ToUcs(e.what()));
+  } catch (const std::exception& e) {
+    throw rti1516e::RTIinternalError(OpenRTI::utf8ToUcs(e.what()));
+  } catch (...) {
+    throw rti1516e::RTIinternalError(L"Unknown internal error!");
+  }
+}
+
+}
+
+namespace rti1516e
+{
+
+static OpenRTI::RTIambassadorImplementation&
+getRTIambassadorImplementation(const RTIambassador& ambassador)
+{
+  const OpenRTI::RTIambassadorImplementation* implementation;
+  implementation = dynamic_cast<const OpenRTI::RTIambassadorImplementation*>(&ambassador);
+  if (!implementation)
+    throw RTIinternalError(L"RTIambassador is not an OpenRTI ambassador!");
+  return const_cast<OpenRTI::RTIambassadorImplementation&>(*implementation);
+}
+
+void
+RTIambassadorFriend::enableAttributeCache(RTIambassador& ambassador, ObjectClassHandle objectClassHandle,
+                                          AttributeHandle attributeHandle, size_t octetSize)
+{
+  getRTIambassadorImplementation(ambassador).enableAttributeCache(objectClassHandle, attributeHandle, octetSize);
+}
+
+void
+RTIambassadorFriend::disableAttributeCache(RTIambassador& ambassador, ObjectClassHandle objectClassHandle)
+{
+  getRTIambassadorImplementation(ambassador).disableAttributeCache(objectClassHandle);
+}
+
+AttributeCacheView
+RTIambassadorFriend::getAttributeCache(const RTIambassador& ambassador, ObjectClassHandle objectClassHandle)
+{
+  return AttributeCacheView(getRTIambassadorImplementation(ambassador).getAttributeCache(objectClassHandle));
+}
+
+bool
+AttributeCacheView::isColumnCached(AttributeHandle attributeHandle) const
+{
+  if (!_attributeCache)
+    return false;
+  return _attributeCache->isColumnCached(OpenRTI::_I1516EAttributeHandle(attributeHandle));
+}
+
+size_t
+AttributeCacheView::getNumRows() const
+{
+  if (!_attributeCache)
+    return 0;
+  return _attributeCache->getNumRows();
+}
+
+ObjectInstanceHandle
+AttributeCacheView::getObjectInstanceHandle(size_t row) const
+{
+  if (!_attributeCache || _attributeCache->getNumRows() <= row)
+    return ObjectInstanceHandle();
+  return OpenRTI::_O1516EObjectInstanceHandle(_attributeCache->getObjectInstanceHandles()[row]);
+}
+
+bool
+AttributeCacheView::getRow(ObjectInstanceHandle objectInstanceHandle, size_t& row) const
+{
+  if (!_attributeCache)
+    return false;
+  return _attributeCache->getRow(OpenRTI::_I1516EObjectInstanceHandle(objectInstanceHandle), row);
+}
+
+uint64_t
+AttributeCacheView::getSerial() const
+{
+  if (!_attributeCache)
+    return 0;
+  return _attributeCache->getSerial();
+}
+
+size_t
+AttributeCacheView::getColumnOctetSize(AttributeHandle attributeHandle) const
+{
+  if (!_attributeCache)
+    return 0;
+  return _attributeCache->getColumnOctetSize(OpenRTI::_I1516EAttributeHandle(attributeHandle));
+}
+
+const void*
+AttributeCacheView::getColumnData(AttributeHandle attributeHandle) const
+{
+  if (!_attributeCache)
+    return 0;
+  return _attributeCache->getColumnData(OpenRTI::_I1516EAttributeHandle(attributeHandle));
+}
+
+const void*
+AttributeCacheView::getValue(AttributeHandle attributeHandle, size_t row, size_t& size) const
+{
+  size = 0;
+  if (!_attributeCache || _attributeCache->getNumRows() <= row)
+    return 0;
+  OpenRTI::_I1516EAttributeHandle handle(attributeHandle);
+  if (!_attributeCache->isColumnCached(handle))
+    return 0;
+  size_t octetSize = _attributeCache->getColumnOctetSize(handle);
+  if (octetSize) {
+    size = octetSize;
+    return static_cast<const char*>(_attributeCache->getColumnData(handle)) + row*octetSize;
+  }
+  const OpenRTI::VariableLengthData& value = _attributeCache->getVariableColumnData(handle)[row];
+  size = value.size();
+  return value.constData();
+}
+
+const uint64_t*
+AttributeCacheView::getColumnSerials(AttributeHandle attributeHandle) const
+{
+  if (!_attributeCache)
+    return 0;
+  return _attributeCache->getColumnSerials(OpenRTI::_I1516EAttributeHandle(attributeHandle));
+}
+
 }
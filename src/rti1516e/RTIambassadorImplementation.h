@@ -25,6 +25,8 @@
 
 namespace OpenRTI {
 
+class AttributeCache;
+
 class OPENRTI_LOCAL RTIambassadorImplementation : public rti1516e::RTIambassador {
 public:
   RTIambassadorImplementation() RTI_NOEXCEPT;
@@ -1676,6 +1678,26 @@ public:
            rti1516e::NotConnected,
            rti1516e::RTIinternalError));
 
+  // OpenRTI extensions, see RTIambassadorFriend
+  void enableAttributeCache(rti1516e::ObjectClassHandle objectClassHandle, rti1516e::AttributeHandle attributeHandle, size_t octetSize)
+    RTI_THROW ((rti1516e::ObjectClassNotDefined,
+           rti1516e::AttributeNotDefined,
+           rti1516e::FederateNotExecutionMember,
+           rti1516e::NotConnected,
+           rti1516e::RTIinternalError));
+
+  void disableAttributeCache(rti1516e::ObjectClassHandle objectClassHandle)
+    RTI_THROW ((rti1516e::ObjectClassNotDefined,
+           rti1516e::FederateNotExecutionMember,
+           rti1516e::NotConnected,
+           rti1516e::RTIinternalError));
+
+  const AttributeCache* getAttributeCache(rti1516e::ObjectClassHandle objectClassHandle) const
+    RTI_THROW ((rti1516e::ObjectClassNotDefined,
+           rti1516e::FederateNotExecutionMember,
+           rti1516e::NotConnected,
+           rti1516e::RTIinternalError));
+
 private:
   class RTI1516EAmbassadorInterface;
   RTI1516EAmbassadorInterface* _ambassadorInterface;
@@ -0,0 +1,994 @@
+#!/usr/bin/python
+#
+# This file is part of OpenRTI.
+#
+# OpenRTI is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 2.1 of the License, or
+# (at your option) any later version.
+#
+# OpenRTI is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+# Generates plain C++ types together with inline codecs from the
+# dataTypes section of rti1516e fdd files. The codecs produce the same
+# bytes as the rti1516e encoding helpers, but encode and decode in
+# straight line code without virtual calls or allocations.
+#
+# Usage: datatypegen.py [-n namespace] [-o header] [-r fdd]... fdd...
+#
+# All data types of the fdd files given as arguments are generated.
+# Data types of fdd files given with -r, typically the HLAstandardMIM,
+# are only generated if they are used. Next to the header the common
+# DataTypeCodec.h is written, that the generated headers include.
+
+import re
+import sys
+
+class SourceStream(object):
+    def __init__(self, stream):
+        self.__stream = stream
+        self.__indent = 0
+
+    def pushIndent(self):
+        self.__indent += 1
+
+    def popIndent(self):
+        self.__indent -= 1
+
+    def write(self, data):
+        self.__stream.write(data)
+
+    def writeline(self, line = None):
+        if line is not None:
+            count = self.__indent
+            while 0 < count:
+                self.write('  ')
+                count = count - 1
+            self.write(line)
+        self.write('\n')
+
+    def writeCopyright(self):
+        self.writeline('/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich')
+        self.writeline(' *')
+        self.writeline(' *')
+        self.writeline(' * This file is part of OpenRTI.')
+        self.writeline(' *')
+        self.writeline(' * OpenRTI is free software: you can redistribute it and/or modify')
+        self.writeline(' * it under the terms of the GNU Lesser General Public License as published by')
+        self.writeline(' * the Free Software Foundation, either version 2.1 of the License, or')
+        self.writeline(' * (at your option) any later version.')
+        self.writeline(' *')
+        self.writeline(' * OpenRTI is distributed in the hope that it will be useful,')
+        self.writeline(' * but WITHOUT ANY WARRANTY; without even the implied warranty of')
+        self.writeline(' * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the')
+        self.writeline(' * GNU Lesser General Public License for more details.')
+        self.writeline(' *')
+        self.writeline(' * You should have received a copy of the GNU Lesser General Public License')
+        self.writeline(' * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.')
+        self.writeline(' *')
+        self.writeline(' * This file is autogenerated by datatypegen.py. Do not edit!')
+        self.writeline(' *')
+        self.writeline(' */')
+        self.writeline()
+
+
+def identifier(name):
+    name = re.sub('[^A-Za-z0-9_]', '_', name)
+    if re.match('[0-9]', name):
+        name = '_' + name
+    return name
+
+def align(offset, octetBoundary):
+    return (offset + octetBoundary - 1) & ~(octetBoundary - 1)
+
+
+###############################################################################
+class DataType(object):
+    def __init__(self, name):
+        self.__name = name
+        self._typeMap = None
+        self.__visiting = False
+
+    def getName(self):
+        return self.__name
+
+    def getIdentifier(self):
+        return identifier(self.__name)
+
+    def setTypeMap(self, typeMap):
+        self._typeMap = typeMap
+
+    def getType(self, name):
+        return self._typeMap.getType(name)
+
+    # The C++ type holding values of this data type
+    def getCppType(self):
+        return self.getIdentifier()
+
+    # The struct with the static encode and decode functions
+    def getCodec(self):
+        return self.getIdentifier() + 'Codec'
+
+    # Names of the data types this one needs to be declared
+    def getDependencies(self):
+        return []
+
+    def getOctetBoundary(self):
+        if self.__visiting:
+            raise Exception('Data type ' + self.getName() + ' contains itself')
+        self.__visiting = True
+        try:
+            return self._getOctetBoundary()
+        finally:
+            self.__visiting = False
+
+    # The size of the encoding if it does not depend on the value, None otherwise
+    def getEncodedSize(self):
+        return None
+
+    def isBuiltin(self):
+        return False
+
+    def writeDeclaration(self, s):
+        pass
+
+    def writeCodec(self, s):
+        pass
+
+    def _writeCodecHead(self, s, base = None):
+        if base:
+            s.writeline('struct {codec} : public {base} {{'.format(codec = self.getCodec(), base = base))
+        else:
+            s.writeline('struct {codec} {{'.format(codec = self.getCodec()))
+        s.pushIndent()
+        s.writeline('typedef {type} value_type;'.format(type = self.getCppType()))
+        if self.getEncodedSize() is None:
+            s.writeline('enum {{ octetBoundary = {boundary} }};'.format(boundary = self.getOctetBoundary()))
+        else:
+            s.writeline('enum {{ octetBoundary = {boundary}, encodedSize = {size} }};'.format(boundary = self.getOctetBoundary(), size = self.getEncodedSize()))
+        s.writeline()
+
+    def _writeFixedSizeCodec(self, s):
+        s.writeline('static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)')
+        s.writeline('{ write(encoder.extend(octetBoundary, encodedSize), value); }')
+        s.writeline('static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)')
+        s.writeline('{ read(decoder.consume(octetBoundary, encodedSize), value); }')
+
+    def _writeCodecTail(self, s):
+        s.popIndent()
+        s.writeline('};')
+        s.writeline()
+
+
+class BasicDataType(DataType):
+    def __init__(self, name, cppType):
+        DataType.__init__(self, name)
+        self.__cppType = cppType
+
+    def getCppType(self):
+        return self.__cppType
+
+    def getCodec(self):
+        return 'OpenRTI::' + self.getName() + 'Codec'
+
+    def _getOctetBoundary(self):
+        return BASIC_DATA_TYPE_SIZES[self.getName()]
+
+    def getEncodedSize(self):
+        return BASIC_DATA_TYPE_SIZES[self.getName()]
+
+    def isBuiltin(self):
+        return True
+
+# The basic data representations implemented in DataTypeCodec.h
+BASIC_DATA_TYPES = [
+    ('HLAoctet', 'rti1516e::Octet', 1),
+    ('HLAoctetPairBE', 'rti1516e::OctetPair', 2),
+    ('HLAoctetPairLE', 'rti1516e::OctetPair', 2),
+    ('HLAinteger16BE', 'rti1516e::Integer16', 2),
+    ('HLAinteger16LE', 'rti1516e::Integer16', 2),
+    ('HLAinteger32BE', 'rti1516e::Integer32', 4),
+    ('HLAinteger32LE', 'rti1516e::Integer32', 4),
+    ('HLAinteger64BE', 'rti1516e::Integer64', 8),
+    ('HLAinteger64LE', 'rti1516e::Integer64', 8),
+    ('HLAfloat32BE', 'float', 4),
+    ('HLAfloat32LE', 'float', 4),
+    ('HLAfloat64BE', 'double', 8),
+    ('HLAfloat64LE', 'double', 8),
+    # Like the rti1516e encoding helpers, map unicode characters to wchar_t
+    ('HLAunicodeChar', 'wchar_t', 2)
+    ]
+BASIC_DATA_TYPE_SIZES = dict([(name, size) for (name, cppType, size) in BASIC_DATA_TYPES])
+
+
+class SimpleDataType(DataType):
+    def __init__(self, name, representation):
+        DataType.__init__(self, name)
+        self.__representation = representation
+
+    def getDependencies(self):
+        return [self.__representation]
+
+    def _getOctetBoundary(self):
+        return self.getType(self.__representation).getOctetBoundary()
+
+    def getEncodedSize(self):
+        return self.getType(self.__representation).getEncodedSize()
+
+    def writeDeclaration(self, s):
+        s.writeline('typedef {type} {name};'.format(type = self.getType(self.__representation).getCppType(), name = self.getCppType()))
+        s.writeline()
+
+    def writeCodec(self, s):
+        s.writeline('struct {codec} : public {base} {{ }};'.format(codec = self.getCodec(), base = self.getType(self.__representation).getCodec()))
+        s.writeline()
+
+
+class EnumeratedDataType(DataType):
+    def __init__(self, name, representation):
+        DataType.__init__(self, name)
+        self.__representation = representation
+        self.__enumerators = []
+
+    def addEnumerator(self, name, value):
+        self.__enumerators.append((name, value))
+
+    def getEnumeratorNames(self):
+        return [name for (name, value) in self.__enumerators]
+
+    def getEnumerator(self, name):
+        return self.getIdentifier() + '_' + identifier(name)
+
+    def getDependencies(self):
+        return [self.__representation]
+
+    def _getOctetBoundary(self):
+        return self.getType(self.__representation).getOctetBoundary()
+
+    def getEncodedSize(self):
+        return self.getType(self.__representation).getEncodedSize()
+
+    def writeDeclaration(self, s):
+        s.writeline('enum {name} {{'.format(name = self.getCppType()))
+        s.pushIndent()
+        for (name, value) in self.__enumerators:
+            separator = ','
+            if (name, value) == self.__enumerators[-1]:
+                separator = ''
+            s.writeline('{enumerator} = {value}{separator}'.format(enumerator = self.getEnumerator(name), value = value, separator = separator))
+        s.popIndent()
+        s.writeline('};')
+        s.writeline()
+
+    def writeCodec(self, s):
+        representation = self.getType(self.__representation)
+        self._writeCodecHead(s)
+        s.writeline('static void write(rti1516e::Octet* data, const value_type& value)')
+        s.writeline('{{ {codec}::write(data, {type}(value)); }}'.format(codec = representation.getCodec(), type = representation.getCppType()))
+        s.writeline('static void read(const rti1516e::Octet* data, value_type& value)')
+        if representation.getCppType() == 'rti1516e::Octet':
+            # Do not sign extend octets
+            s.writeline('{{ {type} representation; {codec}::read(data, representation); value = value_type(static_cast<unsigned char>(representation)); }}'.format(codec = representation.getCodec(), type = representation.getCppType()))
+        else:
+            s.writeline('{{ {type} representation; {codec}::read(data, representation); value = value_type(representation); }}'.format(codec = representation.getCodec(), type = representation.getCppType()))
+        self._writeFixedSizeCodec(s)
+        self._writeCodecTail(s)
+
+
+class ArrayDataType(DataType):
+    def __init__(self, name, dataType, cardinality, encoding):
+        DataType.__init__(self, name)
+        self.__dataType = dataType
+        self.__cardinality = cardinality
+        self.__encoding = encoding
+
+    def isVariable(self):
+        return self.__encoding == 'HLAvariableArray'
+
+    def getCardinality(self):
+        return int(self.__cardinality)
+
+    def getDependencies(self):
+        return [self.__dataType]
+
+    def getElementType(self):
+        return self.getType(self.__dataType)
+
+    # The element in memory if the array is a string or octet vector
+    def getStringType(self):
+        if not self.isVariable():
+            return None
+        name = self.__dataType
+        while True:
+            if name in ('HLAASCIIchar', 'HLAbyte', 'HLAoctet'):
+                if name == 'HLAASCIIchar':
+                    return 'std::string'
+                return 'std::vector<rti1516e::Octet>'
+            if name == 'HLAunicodeChar':
+                return 'std::wstring'
+            dataType = self.getType(name)
+            if not isinstance(dataType, SimpleDataType):
+                return None
+            name = dataType.getDependencies()[0]
+
+    def _getOctetBoundary(self):
+        octetBoundary = self.getElementType().getOctetBoundary()
+        if self.isVariable():
+            octetBoundary = max(4, octetBoundary)
+        return octetBoundary
+
+    def getStride(self):
+        elementType = self.getElementType()
+        return align(elementType.getEncodedSize(), elementType.getOctetBoundary())
+
+    def getEncodedSize(self):
+        if self.isVariable():
+            return None
+        elementSize = self.getElementType().getEncodedSize()
+        if elementSize is None:
+            return None
+        if self.getCardinality() == 0:
+            return 0
+        return (self.getCardinality() - 1)*self.getStride() + elementSize
+
+    def writeDeclaration(self, s):
+        elementType = self.getElementType().getCppType()
+        if self.isVariable():
+            cppType = self.getStringType()
+            if not cppType:
+                cppType = 'std::vector<{type} >'.format(type = elementType)
+        else:
+            cppType = 'OpenRTI::DataTypeFixedArray<{type}, {cardinality}>'.format(type = elementType, cardinality = self.getCardinality())
+        s.writeline('typedef {type} {name};'.format(type = cppType, name = self.getCppType()))
+        s.writeline()
+
+    def writeCodec(self, s):
+        elementType = self.getElementType()
+        elementCodec = elementType.getCodec()
+        self._writeCodecHead(s)
+        if not self.isVariable():
+            if self.getEncodedSize() is not None:
+                s.writeline('static void write(rti1516e::Octet* data, const value_type& value)')
+                s.writeline('{')
+                s.pushIndent()
+                s.writeline('for (std::size_t i = 0; i < {cardinality}; ++i)'.format(cardinality = self.getCardinality()))
+                s.writeline('  {codec}::write(data + i*{stride}, value[i]);'.format(codec = elementCodec, stride = self.getStride()))
+                s.popIndent()
+                s.writeline('}')
+                s.writeline('static void read(const rti1516e::Octet* data, value_type& value)')
+                s.writeline('{')
+                s.pushIndent()
+                s.writeline('for (std::size_t i = 0; i < {cardinality}; ++i)'.format(cardinality = self.getCardinality()))
+                s.writeline('  {codec}::read(data + i*{stride}, value[i]);'.format(codec = elementCodec, stride = self.getStride()))
+                s.popIndent()
+                s.writeline('}')
+                self._writeFixedSizeCodec(s)
+            else:
+                s.writeline('static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)')
+                s.writeline('{')
+                s.pushIndent()
+                s.writeline('for (std::size_t i = 0; i < {cardinality}; ++i)'.format(cardinality = self.getCardinality()))
+                s.writeline('  {codec}::encode(encoder, value[i]);'.format(codec = elementCodec))
+                s.popIndent()
+                s.writeline('}')
+                s.writeline('static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)')
+                s.writeline('{')
+                s.pushIndent()
+                s.writeline('for (std::size_t i = 0; i < {cardinality}; ++i)'.format(cardinality = self.getCardinality()))
+                s.writeline('  {codec}::decode(decoder, value[i]);'.format(codec = elementCodec))
+                s.popIndent()
+                s.writeline('}')
+            self._writeCodecTail(s)
+            return
+
+        stringType = self.getStringType()
+        s.writeline('static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)')
+        s.writeline('{')
+        s.pushIndent()
+        s.writeline('std::size_t size = value.size();')
+        s.writeline('encoder.encodeLength(octetBoundary, size);')
+        if elementType.getEncodedSize() is not None:
+            if stringType in ('std::string', 'std::vector<rti1516e::Octet>'):
+                s.writeline('rti1516e::Octet* data = encoder.extend(octetBoundary, size);')
+                s.writeline('if (size)')
+                s.writeline('  std::memcpy(data, &value[0], size);')
+            else:
+                s.writeline('rti1516e::Octet* data = encoder.extend(octetBoundary, size*{stride});'.format(stride = self.getStride()))
+                s.writeline('for (std::size_t i = 0; i < size; ++i)')
+                s.writeline('  {codec}::write(data + i*{stride}, value[i]);'.format(codec = elementCodec, stride = self.getStride()))
+        else:
+            s.writeline('encoder.align(octetBoundary);')
+            s.writeline('for (std::size_t i = 0; i < size; ++i)')
+            s.writeline('  {codec}::encode(encoder, value[i]);'.format(codec = elementCodec))
+        s.popIndent()
+        s.writeline('}')
+
+        s.writeline('static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)')
+        s.writeline('{')
+        s.pushIndent()
+        s.writeline('std::size_t size = decoder.decodeLength(octetBoundary);')
+        if elementType.getEncodedSize() is not None:
+            # The trailing padding of the last element is not part of the encoding
+            s.writeline('const rti1516e::Octet* data = decoder.consume(octetBoundary, size ? (size - 1)*{stride} + {size} : 0);'.format(stride = self.getStride(), size = elementType.getEncodedSize()))
+            s.writeline('value.resize(size);')
+            if stringType in ('std::string', 'std::vector<rti1516e::Octet>'):
+                s.writeline('if (size)')
+                s.writeline('  std::memcpy(&value[0], data, size);')
+            else:
+                s.writeline('for (std::size_t i = 0; i < size; ++i)')
+                s.writeline('  {codec}::read(data + i*{stride}, value[i]);'.format(codec = elementCodec, stride = self.getStride()))
+        else:
+            s.writeline('decoder.align(octetBoundary);')
+            s.writeline('value.resize(size);')
+            s.writeline('for (std::size_t i = 0; i < size; ++i)')
+            s.writeline('  {codec}::decode(decoder, value[i]);'.format(codec = elementCodec))
+        s.popIndent()
+        s.writeline('}')
+        self._writeCodecTail(s)
+
+
+class FixedRecordDataType(DataType):
+    def __init__(self, name):
+        DataType.__init__(self, name)
+        self.__fields = []
+
+    def addField(self, name, dataType):
+        self.__fields.append((name, dataType))
+
+    def getDependencies(self):
+        return [dataType for (name, dataType) in self.__fields]
+
+    def _getOctetBoundary(self):
+        octetBoundary = 1
+        for (name, dataType) in self.__fields:
+            octetBoundary = max(octetBoundary, self.getType(dataType).getOctetBoundary())
+        return octetBoundary
+
+    # The offsets of the fields if all of them have a fixed size, None otherwise
+    def getFieldOffsets(self):
+        offsets = []
+        offset = 0
+        for (name, dataType) in self.__fields:
+            fieldType = self.getType(dataType)
+            if fieldType.getEncodedSize() is None:
+                return None
+            offset = align(offset, fieldType.getOctetBoundary())
+            offsets.append(offset)
+            offset += fieldType.getEncodedSize()
+        offsets.append(offset)
+        return offsets
+
+    def getEncodedSize(self):
+        offsets = self.getFieldOffsets()
+        if offsets is None:
+            return None
+        return offsets[-1]
+
+    def writeDeclaration(self, s):
+        s.writeline('struct {name} {{'.format(name = self.getCppType()))
+        s.pushIndent()
+        for (name, dataType) in self.__fields:
+            s.writeline('{type} {name};'.format(type = self.getType(dataType).getCppType(), name = identifier(name)))
+        s.popIndent()
+        s.writeline('};')
+        s.writeline()
+
+    def writeCodec(self, s):
+        self._writeCodecHead(s)
+        offsets = self.getFieldOffsets()
+        if offsets is not None:
+            s.writeline('static void write(rti1516e::Octet* data, const value_type& value)')
+            s.writeline('{')
+            s.pushIndent()
+            for ((name, dataType), offset) in zip(self.__fields, offsets):
+                s.writeline('{codec}::write(data + {offset}, value.{name});'.format(codec = self.getType(dataType).getCodec(), offset = offset, name = identifier(name)))
+            s.popIndent()
+            s.writeline('}')
+            s.writeline('static void read(const rti1516e::Octet* data, value_type& value)')
+            s.writeline('{')
+            s.pushIndent()
+            for ((name, dataType), offset) in zip(self.__fields, offsets):
+                s.writeline('{codec}::read(data + {offset}, value.{name});'.format(codec = self.getType(dataType).getCodec(), offset = offset, name = identifier(name)))
+            s.popIndent()
+            s.writeline('}')
+            self._writeFixedSizeCodec(s)
+        else:
+            s.writeline('static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)')
+            s.writeline('{')
+            s.pushIndent()
+            s.writeline('encoder.align(octetBoundary);')
+            for (name, dataType) in self.__fields:
+                s.writeline('{codec}::encode(encoder, value.{name});'.format(codec = self.getType(dataType).getCodec(), name = identifier(name)))
+            s.popIndent()
+            s.writeline('}')
+            s.writeline('static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)')
+            s.writeline('{')
+            s.pushIndent()
+            s.writeline('decoder.align(octetBoundary);')
+            for (name, dataType) in self.__fields:
+                s.writeline('{codec}::decode(decoder, value.{name});'.format(codec = self.getType(dataType).getCodec(), name = identifier(name)))
+            s.popIndent()
+            s.writeline('}')
+        self._writeCodecTail(s)
+
+
+class VariantRecordDataType(DataType):
+    def __init__(self, name, discriminant, dataType):
+        DataType.__init__(self, name)
+        self.__discriminant = discriminant
+        self.__dataType = dataType
+        self.__alternatives = []
+
+    def addAlternative(self, enumerators, name, dataType):
+        self.__alternatives.append((enumerators, name, dataType))
+
+    def getDependencies(self):
+        return [self.__dataType] + [dataType for (enumerators, name, dataType) in self.__alternatives if dataType]
+
+    def _getOctetBoundary(self):
+        octetBoundary = self.getType(self.__dataType).getOctetBoundary()
+        for (enumerators, name, dataType) in self.__alternatives:
+            if dataType:
+                octetBoundary = max(octetBoundary, self.getType(dataType).getOctetBoundary())
+        return octetBoundary
+
+    # The enumerators an alternative stands for, None for HLAother
+    def getEnumerators(self, enumerators):
+        discriminantType = self.getType(self.__dataType)
+        names = discriminantType.getEnumeratorNames()
+        result = []
+        for enumerator in enumerators.split(','):
+            enumerator = enumerator.strip()
+            if enumerator == 'HLAother':
+                return None
+            match = re.match(r'\[\s*(\S+)\s*\.\.\s*(\S+)\s*\]', enumerator)
+            if match:
+                result += names[names.index(match.group(1)):names.index(match.group(2)) + 1]
+            else:
+                result.append(enumerator)
+        return [discriminantType.getEnumerator(name) for name in result]
+
+    def writeDeclaration(self, s):
+        s.writeline('struct {name} {{'.format(name = self.getCppType()))
+        s.pushIndent()
+        s.writeline('{type} {name};'.format(type = self.getType(self.__dataType).getCppType(), name = identifier(self.__discriminant)))
+        for (enumerators, name, dataType) in self.__alternatives:
+            if dataType:
+                s.writeline('{type} {name};'.format(type = self.getType(dataType).getCppType(), name = identifier(name)))
+        s.popIndent()
+        s.writeline('};')
+        s.writeline()
+
+    def __writeSwitch(self, s, function, stream):
+        s.writeline('switch (value.{name}) {{'.format(name = identifier(self.__discriminant)))
+        default = None
+        for (enumerators, name, dataType) in self.__alternatives:
+            cases = self.getEnumerators(enumerators)
+            if cases is None:
+                default = (name, dataType)
+                continue
+            for case in cases:
+                s.writeline('case {case}:'.format(case = case))
+            if dataType:
+                s.writeline('  {codec}::{function}({stream}, value.{name});'.format(codec = self.getType(dataType).getCodec(), function = function, stream = stream, name = identifier(name)))
+            s.writeline('  break;')
+        s.writeline('default:')
+        if default and default[1]:
+            s.writeline('  {codec}::{function}({stream}, value.{name});'.format(codec = self.getType(default[1]).getCodec(), function = function, stream = stream, name = identifier(default[0])))
+        s.writeline('  break;')
+        s.writeline('}')
+
+    def writeCodec(self, s):
+        discriminantCodec = self.getType(self.__dataType).getCodec()
+        self._writeCodecHead(s)
+        s.writeline('static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)')
+        s.writeline('{')
+        s.pushIndent()
+        s.writeline('encoder.align(octetBoundary);')
+        s.writeline('{codec}::encode(encoder, value.{name});'.format(codec = discriminantCodec, name = identifier(self.__discriminant)))
+        self.__writeSwitch(s, 'encode', 'encoder')
+        s.popIndent()
+        s.writeline('}')
+        s.writeline('static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)')
+        s.writeline('{')
+        s.pushIndent()
+        s.writeline('decoder.align(octetBoundary);')
+        s.writeline('{codec}::decode(decoder, value.{name});'.format(codec = discriminantCodec, name = identifier(self.__discriminant)))
+        self.__writeSwitch(s, 'decode', 'decoder')
+        s.popIndent()
+        s.writeline('}')
+        self._writeCodecTail(s)
+
+
+###############################################################################
+class TypeMap(object):
+    def __init__(self):
+        self.__typeList = []
+        self.__typeMap = {}
+        self.__generate = []
+        for (name, cppType, size) in BASIC_DATA_TYPES:
+            self.addType(BasicDataType(name, cppType))
+
+    def addType(self, dataType):
+        if dataType.getName() in self.__typeMap:
+            # Modules may repeat data types, the first one wins
+            return
+        dataType.setTypeMap(self)
+        self.__typeList.append(dataType)
+        self.__typeMap[dataType.getName()] = dataType
+
+    def getType(self, name):
+        if name not in self.__typeMap:
+            raise Exception('Unknown data type ' + name)
+        return self.__typeMap[name]
+
+    def readFile(self, fileName, generate):
+        import xml.etree.ElementTree as ElementTree
+        root = ElementTree.parse(fileName).getroot()
+
+        def tag(element):
+            return element.tag.split('}')[-1]
+        def child(element, name):
+            for c in element:
+                if tag(c) == name:
+                    return c
+            return None
+        def text(element, name):
+            c = child(element, name)
+            if c is None or c.text is None:
+                return None
+            return c.text.strip()
+
+        dataTypes = child(root, 'dataTypes')
+        if dataTypes is None:
+            return
+        for section in dataTypes:
+            for node in section:
+                name = text(node, 'name')
+                if not name:
+                    continue
+                if tag(section) == 'basicDataRepresentations':
+                    if name not in self.__typeMap:
+                        raise Exception('Basic data representation ' + name + ' is not supported')
+                    continue
+                elif tag(section) == 'simpleDataTypes':
+                    dataType = SimpleDataType(name, text(node, 'representation'))
+                elif tag(section) == 'enumeratedDataTypes':
+                    dataType = EnumeratedDataType(name, text(node, 'representation'))
+                    for enumerator in node:
+                        if tag(enumerator) == 'enumerator':
+                            dataType.addEnumerator(text(enumerator, 'name'), text(enumerator, 'value'))
+                elif tag(section) == 'arrayDataTypes':
+                    encoding = text(node, 'encoding')
+                    if encoding not in ('HLAfixedArray', 'HLAvariableArray'):
+                        sys.stderr.write('Skipping ' + name + ', array encoding ' + str(encoding) + ' is not supported\n')
+                        continue
+                    dataType = ArrayDataType(name, text(node, 'dataType'), text(node, 'cardinality'), encoding)
+                elif tag(section) == 'fixedRecordDataTypes':
+                    dataType = FixedRecordDataType(name)
+                    for field in node:
+                        if tag(field) == 'field':
+                            dataType.addField(text(field, 'name'), text(field, 'dataType'))
+                elif tag(section) == 'variantRecordDataTypes':
+                    dataType = VariantRecordDataType(name, text(node, 'discriminant'), text(node, 'dataType'))
+                    for alternative in node:
+                        if tag(alternative) == 'alternative':
+                            alternativeType = text(alternative, 'dataType')
+                            if alternativeType == 'HLAnoDataType':
+                                alternativeType = None
+                            dataType.addAlternative(text(alternative, 'enumerator'), text(alternative, 'name'), alternativeType)
+                else:
+                    continue
+                self.addType(dataType)
+                if generate:
+                    self.__generate.append(name)
+
+    # The data types to generate, each one after all it depends on
+    def getSortedTypes(self):
+        result = []
+        visited = {}
+        def visit(name):
+            if name in visited:
+                if not visited[name]:
+                    raise Exception('Data type ' + name + ' contains itself')
+                return
+            visited[name] = False
+            dataType = self.getType(name)
+            for dependency in dataType.getDependencies():
+                visit(dependency)
+            visited[name] = True
+            if not dataType.isBuiltin():
+                result.append(dataType)
+        for name in self.__generate:
+            visit(name)
+        return result
+
+    def writeHeader(self, s, headerName, namespace):
+        guard = identifier(namespace + '_' + headerName)
+        s.writeCopyright()
+        s.writeline('#ifndef {guard}'.format(guard = guard))
+        s.writeline('#define {guard}'.format(guard = guard))
+        s.writeline()
+        s.writeline('#include <cstring>')
+        s.writeline('#include <string>')
+        s.writeline('#include <vector>')
+        s.writeline()
+        s.writeline('#include "DataTypeCodec.h"')
+        s.writeline()
+        s.writeline('namespace {namespace} {{'.format(namespace = namespace))
+        s.writeline()
+        for dataType in self.getSortedTypes():
+            dataType.writeDeclaration(s)
+            dataType.writeCodec(s)
+        s.writeline('}} // namespace {namespace}'.format(namespace = namespace))
+        s.writeline()
+        s.writeline('#endif')
+
+
+###############################################################################
+def writeCodecHeader(s):
+    s.writeCopyright()
+    s.writeline('#ifndef OpenRTI_DataTypeCodec_h')
+    s.writeline('#define OpenRTI_DataTypeCodec_h')
+    s.writeline()
+    s.writeline('#include <cstddef>')
+    s.writeline('#include <cstring>')
+    s.writeline('#include <vector>')
+    s.writeline()
+    s.writeline('#include <RTI/encoding/EncodingConfig.h>')
+    s.writeline('#include <RTI/encoding/EncodingExceptions.h>')
+    s.writeline()
+    s.writeline('namespace OpenRTI {')
+    s.writeline()
+    s.writeline('/// Appends encoded data types to a buffer, keeps the capacity of the buffer')
+    s.writeline('class DataTypeEncoder {')
+    s.writeline('public:')
+    s.pushIndent()
+    s.writeline('DataTypeEncoder(std::vector<rti1516e::Octet>& buffer) :')
+    s.writeline('  _buffer(buffer)')
+    s.writeline('{ }')
+    s.writeline()
+    s.writeline('std::size_t size() const')
+    s.writeline('{ return _buffer.size(); }')
+    s.writeline()
+    s.writeline('void align(std::size_t octetBoundary)')
+    s.writeline('{ _buffer.resize((_buffer.size() + octetBoundary - 1) & ~(octetBoundary - 1), 0); }')
+    s.writeline()
+    s.writeline('/// Align and append size octets to be written')
+    s.writeline('rti1516e::Octet* extend(std::size_t octetBoundary, std::size_t size)')
+    s.writeline('{')
+    s.writeline('  std::size_t offset = (_buffer.size() + octetBoundary - 1) & ~(octetBoundary - 1);')
+    s.writeline('  _buffer.resize(offset + size, 0);')
+    s.writeline('  if (_buffer.empty())')
+    s.writeline('    return 0;')
+    s.writeline('  return &_buffer.front() + offset;')
+    s.writeline('}')
+    s.writeline()
+    s.writeline('/// The element count of variable arrays')
+    s.writeline('void encodeLength(std::size_t octetBoundary, std::size_t length);')
+    s.popIndent()
+    s.writeline()
+    s.writeline('private:')
+    s.pushIndent()
+    s.writeline('std::vector<rti1516e::Octet>& _buffer;')
+    s.popIndent()
+    s.writeline('};')
+    s.writeline()
+    s.writeline('/// Reads encoded data types from a buffer')
+    s.writeline('class DataTypeDecoder {')
+    s.writeline('public:')
+    s.pushIndent()
+    s.writeline('DataTypeDecoder(const void* data, std::size_t size) :')
+    s.writeline('  _data(static_cast<const rti1516e::Octet*>(data)),')
+    s.writeline('  _size(size),')
+    s.writeline('  _offset(0)')
+    s.writeline('{ }')
+    s.writeline()
+    s.writeline('std::size_t getOffset() const')
+    s.writeline('{ return _offset; }')
+    s.writeline()
+    s.writeline('void align(std::size_t octetBoundary)')
+    s.writeline('{ _offset = (_offset + octetBoundary - 1) & ~(octetBoundary - 1); }')
+    s.writeline()
+    s.writeline('/// Align and return the next size octets')
+    s.writeline('const rti1516e::Octet* consume(std::size_t octetBoundary, std::size_t size)')
+    s.writeline('{')
+    s.writeline('  std::size_t offset = (_offset + octetBoundary - 1) & ~(octetBoundary - 1);')
+    s.writeline('  if (_size < offset || _size - offset < size)')
+    s.writeline('    throw rti1516e::EncoderException(L"Insufficient buffer size for decoding!");')
+    s.writeline('  _offset = offset + size;')
+    s.writeline('  return _data + offset;')
+    s.writeline('}')
+    s.writeline()
+    s.writeline('/// The element count of variable arrays')
+    s.writeline('std::size_t decodeLength(std::size_t octetBoundary);')
+    s.popIndent()
+    s.writeline()
+    s.writeline('private:')
+    s.pushIndent()
+    s.writeline('const rti1516e::Octet* _data;')
+    s.writeline('std::size_t _size;')
+    s.writeline('std::size_t _offset;')
+    s.popIndent()
+    s.writeline('};')
+    s.writeline()
+    s.writeline('/// The values of fixed arrays')
+    s.writeline('template<typename T, std::size_t N>')
+    s.writeline('struct DataTypeFixedArray {')
+    s.pushIndent()
+    s.writeline('std::size_t size() const')
+    s.writeline('{ return N; }')
+    s.writeline('T& operator[](std::size_t index)')
+    s.writeline('{ return _values[index]; }')
+    s.writeline('const T& operator[](std::size_t index) const')
+    s.writeline('{ return _values[index]; }')
+    s.writeline('T _values[N ? N : 1];')
+    s.popIndent()
+    s.writeline('};')
+    s.writeline()
+
+    # The basic data representations
+    def writeBasic(name, cppType, size, bigEndian, unsignedType, conversion):
+        s.writeline('struct {name}Codec {{'.format(name = name))
+        s.pushIndent()
+        s.writeline('typedef {type} value_type;'.format(type = cppType))
+        s.writeline('enum {{ octetBoundary = {size}, encodedSize = {size} }};'.format(size = size))
+        s.writeline()
+        s.writeline('static void write(rti1516e::Octet* data, const value_type& value)')
+        s.writeline('{')
+        s.pushIndent()
+        if conversion == 'union':
+            s.writeline('union {{ {unsigned} u; value_type s; }} u;'.format(unsigned = unsignedType))
+            s.writeline('u.s = value;')
+            value = 'u.u'
+        elif conversion == 'pair':
+            value = None
+        else:
+            s.writeline('{unsigned} u = static_cast<{unsigned}>(value);'.format(unsigned = unsignedType))
+            value = 'u'
+        if value:
+            for i in range(size):
+                shift = 8*(size - 1 - i) if bigEndian else 8*i
+                if shift:
+                    s.writeline('data[{index}] = rti1516e::Octet({value} >> {shift});'.format(index = i, value = value, shift = shift))
+                else:
+                    s.writeline('data[{index}] = rti1516e::Octet({value});'.format(index = i, value = value))
+        else:
+            if bigEndian:
+                s.writeline('data[0] = value.first;')
+                s.writeline('data[1] = value.second;')
+            else:
+                s.writeline('data[0] = value.second;')
+                s.writeline('data[1] = value.first;')
+        s.popIndent()
+        s.writeline('}')
+        s.writeline('static void read(const rti1516e::Octet* data, value_type& value)')
+        s.writeline('{')
+        s.pushIndent()
+        if value:
+            terms = []
+            for i in range(size):
+                shift = 8*(size - 1 - i) if bigEndian else 8*i
+                term = 'static_cast<unsigned char>(data[{index}])'.format(index = i)
+                if unsignedType != 'unsigned char':
+                    term = 'static_cast<{unsigned}>({term})'.format(unsigned = unsignedType, term = term)
+                if shift:
+                    term = term + ' << ' + str(shift)
+                terms.append(term)
+            if conversion == 'union':
+                s.writeline('union {{ {unsigned} u; value_type s; }} u;'.format(unsigned = unsignedType))
+                s.writeline('u.u = ' + terms[0] + ';')
+                for term in terms[1:]:
+                    s.writeline('u.u |= ' + term + ';')
+                s.writeline('value = u.s;')
+            else:
+                s.writeline('{unsigned} u = '.format(unsigned = unsignedType) + terms[0] + ';')
+                for term in terms[1:]:
+                    s.writeline('u |= ' + term + ';')
+                s.writeline('value = value_type(u);')
+        else:
+            if bigEndian:
+                s.writeline('value.first = data[0];')
+                s.writeline('value.second = data[1];')
+            else:
+                s.writeline('value.second = data[0];')
+                s.writeline('value.first = data[1];')
+        s.popIndent()
+        s.writeline('}')
+        s.writeline()
+        s.writeline('static void encode(DataTypeEncoder& encoder, const value_type& value)')
+        s.writeline('{ write(encoder.extend(octetBoundary, encodedSize), value); }')
+        s.writeline('static void decode(DataTypeDecoder& decoder, value_type& value)')
+        s.writeline('{ read(decoder.consume(octetBoundary, encodedSize), value); }')
+        s.popIndent()
+        s.writeline('};')
+        s.writeline()
+
+    unsignedTypes = { 1 : 'unsigned char', 2 : 'unsigned short', 4 : 'unsigned int', 8 : 'unsigned long long' }
+    for (name, cppType, size) in BASIC_DATA_TYPES:
+        bigEndian = not name.endswith('LE')
+        if name.startswith('HLAoctetPair'):
+            conversion = 'pair'
+        elif name.startswith('HLAfloat'):
+            conversion = 'union'
+        else:
+            conversion = 'cast'
+        writeBasic(name, cppType, size, bigEndian, unsignedTypes[size], conversion)
+
+    s.writeline('inline void')
+    s.writeline('DataTypeEncoder::encodeLength(std::size_t octetBoundary, std::size_t length)')
+    s.writeline('{')
+    s.writeline('  if (0x7fffffffu < length)')
+    s.writeline('    throw rti1516e::EncoderException(L"Array size is too big to encode!");')
+    s.writeline('  HLAinteger32BECodec::write(extend(octetBoundary, 4), rti1516e::Integer32(length));')
+    s.writeline('}')
+    s.writeline()
+    s.writeline('inline std::size_t')
+    s.writeline('DataTypeDecoder::decodeLength(std::size_t octetBoundary)')
+    s.writeline('{')
+    s.writeline('  rti1516e::Integer32 length;')
+    s.writeline('  HLAinteger32BECodec::read(consume(octetBoundary, 4), length);')
+    s.writeline('  // Every element takes at least one octet')
+    s.writeline('  if (_size - _offset < std::size_t(unsigned(length)))')
+    s.writeline('    throw rti1516e::EncoderException(L"Insufficient buffer size for decoding!");')
+    s.writeline('  return std::size_t(unsigned(length));')
+    s.writeline('}')
+    s.writeline()
+    s.writeline('/// Encode a value with the codec C into buffer, replacing its content')
+    s.writeline('template<typename C>')
+    s.writeline('inline void')
+    s.writeline('encodeDataType(std::vector<rti1516e::Octet>& buffer, const typename C::value_type& value)')
+    s.writeline('{')
+    s.writeline('  buffer.clear();')
+    s.writeline('  DataTypeEncoder encoder(buffer);')
+    s.writeline('  C::encode(encoder, value);')
+    s.writeline('}')
+    s.writeline()
+    s.writeline('/// Decode a value with the codec C, returns the number of octets decoded')
+    s.writeline('template<typename C>')
+    s.writeline('inline std::size_t')
+    s.writeline('decodeDataType(typename C::value_type& value, const void* data, std::size_t size)')
+    s.writeline('{')
+    s.writeline('  DataTypeDecoder decoder(data, size);')
+    s.writeline('  C::decode(decoder, value);')
+    s.writeline('  return decoder.getOffset();')
+    s.writeline('}')
+    s.writeline()
+    s.writeline('} // namespace OpenRTI')
+    s.writeline()
+    s.writeline('#endif')
+
+
+# The main application
+
+import os
+import getopt
+
+namespace = 'DataTypes'
+headerFile = 'DataTypes.h'
+referenceFiles = []
+
+(args, files) = getopt.getopt(sys.argv[1:], 'n:o:r:')
+for (arg, val) in args:
+    if arg == '-n':
+        namespace = val
+    elif arg == '-o':
+        headerFile = val
+    elif arg == '-r':
+        referenceFiles.append(val)
+
+typeMap = TypeMap()
+for fileName in files:
+    typeMap.readFile(fileName, True)
+for fileName in referenceFiles:
+    typeMap.readFile(fileName, False)
+
+typeMap.writeHeader(SourceStream(open(headerFile, 'w')), os.path.basename(headerFile), namespace)
+writeCodecHeader(SourceStream(open(os.path.join(os.path.dirname(headerFile), 'DataTypeCodec.h'), 'w')))
@@ -0,0 +1,106 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Exception.h"
+#include "FOMModuleCache.h"
+#include "Message.h"
+#include "Options.h"
+#include "StringUtils.h"
+
+static void usage(const char* argv0)
+{
+  std::cerr << argv0 << ": [-1] [-e] [-f] [-h] -o outputfile inputfile..." << std::endl;
+  std::cerr << "  Compile the given fdd or fed files into a precompiled FOM module file." << std::endl;
+  std::cerr << "  -1 read rti1516 fdd files, -e read rti1516e fdd files (the default), -f read fed files" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::FOMModuleCache::Format format = OpenRTI::FOMModuleCache::FDD1516EFormat;
+  std::string outputFile;
+  std::vector<std::string> inputFiles;
+
+  OpenRTI::Options options(argc, argv);
+  while (options.next("1efho:")) {
+    switch (options.getOptChar()) {
+    case '1':
+      format = OpenRTI::FOMModuleCache::FDD1516Format;
+      break;
+    case 'e':
+      format = OpenRTI::FOMModuleCache::FDD1516EFormat;
+      break;
+    case 'f':
+      format = OpenRTI::FOMModuleCache::FEDFormat;
+      break;
+    case 'h':
+      usage(argv[0]);
+      return EXIT_SUCCESS;
+    case 'o':
+      outputFile = options.getArgument();
+      break;
+    case 0:
+      // Empty for illegal options
+      if (options.getArgument().empty()) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+      }
+      inputFiles.push_back(options.getArgument());
+      break;
+    }
+  }
+
+  if (outputFile.empty() || inputFiles.empty()) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  OpenRTI::FOMStringModuleList moduleList;
+  for (std::vector<std::string>::const_iterator i = inputFiles.begin(); i != inputFiles.end(); ++i) {
+    try {
+      if (!OpenRTI::FOMModuleCache::readFile(moduleList, format, *i, std::string())) {
+        std::cerr << "Could not open \"" << *i << "\"!" << std::endl;
+        return EXIT_FAILURE;
+      }
+    } catch (const OpenRTI::Exception& e) {
+      std::cerr << "Could not read \"" << *i << "\":" << std::endl;
+      std::cerr << OpenRTI::utf8ToLocale(e.getReason()) << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::ofstream stream(outputFile.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!stream.is_open()) {
+    std::cerr << "Could not open \"" << outputFile << "\" for writing!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  OpenRTI::FOMModuleCache::writeCompiled(stream, moduleList);
+  stream.close();
+  if (stream.fail()) {
+    std::cerr << "Could not write \"" << outputFile << "\"!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
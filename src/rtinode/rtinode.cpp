@@ -33,7 +33,7 @@
 
 static void usage(const char* argv0)
 {
-  std::cerr << argv0 << ": [-b] [-c configfile] [-f file] [-h] [-i address] [-p parent]" << std::endl;
+  std::cerr << argv0 << ": [-b] [-c configfile] [-f file] [-h] [-i address] [-m metricsfile] [-p parent]" << std::endl;
 }
 
 class SignalNetworkServer : public OpenRTI::NetworkServer {
@@ -92,7 +92,7 @@ main(int argc, char* argv[])
   bool defaultListen = true;
 
   OpenRTI::Options options(argc, argv);
-  while (options.next("bc:f:hi:p:s")) {
+  while (options.next("bc:f:hi:m:p:s")) {
     switch (options.getOptChar()) {
     case 'b':
       background = true;
@@ -135,6 +135,10 @@ main(int argc, char* argv[])
         return EXIT_FAILURE;
       }
       break;
+    case 'm':
+      // Periodically dump the metrics as json
+      networkServer.setMetricsFile(OpenRTI::localeToUtf8(options.getArgument()), OpenRTI::Clock::fromSeconds(10));
+      break;
     case 'p':
       try {
         OpenRTI::URL url = OpenRTI::URL::fromUrl(OpenRTI::localeToUtf8(options.getArgument()));
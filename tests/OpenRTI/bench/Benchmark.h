@@ -0,0 +1,184 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OpenRTI_Benchmark_h
+#define OpenRTI_Benchmark_h
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Clock.h"
+#include "Export.h"
+#include "Options.h"
+#include "Types.h"
+
+namespace OpenRTI {
+
+/// Collects the results of one benchmark executable and writes them as json.
+/// The output of every benchmark looks like
+///   {"suite":"<suite>","results":[{"name":"<name>","<key>":<number>,...},...]}
+/// so that results of different runs can be compared by a script.
+class OPENRTI_LOCAL BenchmarkReport {
+public:
+  BenchmarkReport(const std::string& suite) :
+    _suite(suite)
+  { }
+
+  /// Record count operations that took duration altogether.
+  /// If octets is not zero, the octets moved by these operations.
+  void addThroughput(const std::string& name, uint64_t count, const Clock& duration, uint64_t octets = 0)
+  {
+    Result result(name);
+    double nsec = double(duration.getNSec());
+    result.add("count", double(count));
+    result.add("nsec", nsec);
+    if (count)
+      result.add("nsecPerOp", nsec/double(count));
+    if (0 < nsec) {
+      result.add("opsPerSec", 1e9*double(count)/nsec);
+      if (octets) {
+        result.add("octets", double(octets));
+        result.add("octetsPerSec", 1e9*double(octets)/nsec);
+      }
+    }
+    _resultVector.push_back(result);
+  }
+
+  /// Record the distribution of single operation latencies
+  void addLatency(const std::string& name, std::vector<Clock> samples)
+  {
+    Result result(name);
+    result.add("count", double(samples.size()));
+    if (!samples.empty()) {
+      std::sort(samples.begin(), samples.end());
+      double sum = 0;
+      for (std::vector<Clock>::const_iterator i = samples.begin(); i != samples.end(); ++i)
+        sum += double(i->getNSec());
+      result.add("minNsec", double(samples.front().getNSec()));
+      result.add("meanNsec", sum/double(samples.size()));
+      result.add("p50Nsec", _getPercentile(samples, 50));
+      result.add("p90Nsec", _getPercentile(samples, 90));
+      result.add("p99Nsec", _getPercentile(samples, 99));
+      result.add("maxNsec", double(samples.back().getNSec()));
+    }
+    _resultVector.push_back(result);
+  }
+
+  void write(std::ostream& stream) const
+  {
+    stream << std::setprecision(12) << "{\"suite\":\"" << _suite << "\",\"results\":[";
+    for (std::vector<Result>::const_iterator i = _resultVector.begin(); i != _resultVector.end(); ++i) {
+      if (i != _resultVector.begin())
+        stream << ",";
+      stream << "\n{\"name\":\"" << i->_name << "\"";
+      for (std::vector<std::pair<std::string, double> >::const_iterator j = i->_values.begin();
+           j != i->_values.end(); ++j)
+        stream << ",\"" << j->first << "\":" << j->second;
+      stream << "}";
+    }
+    stream << "\n]}" << std::endl;
+  }
+
+  /// Write to the given file, an empty file name or "-" writes to stdout
+  bool write(const std::string& file) const
+  {
+    if (file.empty() || file == "-") {
+      write(std::cout);
+      return true;
+    }
+    std::ofstream stream(file.c_str());
+    if (!stream.is_open()) {
+      std::cerr << "Cannot open \"" << file << "\" for writing!" << std::endl;
+      return false;
+    }
+    write(stream);
+    return stream.good();
+  }
+
+private:
+  struct Result {
+    Result(const std::string& name) :
+      _name(name)
+    { }
+    void add(const std::string& key, double value)
+    { _values.push_back(std::pair<std::string, double>(key, value)); }
+
+    std::string _name;
+    std::vector<std::pair<std::string, double> > _values;
+  };
+
+  // Nearest rank percentile of the sorted samples
+  static double _getPercentile(const std::vector<Clock>& samples, unsigned percent)
+  {
+    size_t rank = (percent*samples.size() + 99)/100;
+    if (rank)
+      --rank;
+    return double(samples[std::min(rank, samples.size() - 1)].getNSec());
+  }
+
+  std::string _suite;
+  std::vector<Result> _resultVector;
+};
+
+/// The options common to all benchmarks: -n <count> and -o <json file>.
+/// Additional option characters with arguments can be given in optionString.
+class OPENRTI_LOCAL BenchmarkOptions : public Options {
+public:
+  BenchmarkOptions(int argc, const char* const argv[], unsigned count) :
+    Options(argc, argv),
+    _count(count)
+  { }
+
+  bool next(const std::string& optionString = std::string())
+  {
+    std::string opts = "n:o:" + optionString;
+    while (Options::next(opts.c_str())) {
+      switch (getOptChar()) {
+      case 'n':
+        _count = std::max(1, atoi(getArgument().c_str()));
+        break;
+      case 'o':
+        _file = getArgument();
+        break;
+      default:
+        return true;
+      }
+    }
+    return false;
+  }
+
+  unsigned getCount() const
+  { return _count; }
+  const std::string& getFile() const
+  { return _file; }
+
+private:
+  unsigned _count;
+  std::string _file;
+};
+
+} // namespace OpenRTI
+
+#endif
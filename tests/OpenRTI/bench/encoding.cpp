@@ -0,0 +1,322 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Encode and decode throughput of the TightBE1 encoding for the messages
+// that make up the bulk of the traffic of a running federation.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "AbstractConnect.h"
+#include "AbstractProtocolSocket.h"
+#include "Benchmark.h"
+#include "Clock.h"
+#include "Message.h"
+#include "MessageEncodingRegistry.h"
+#include "MessageQueue.h"
+
+// Both ends of an encoding, the messages to write and the messages read
+class OPENRTI_LOCAL Connect : public OpenRTI::AbstractConnect {
+public:
+  Connect() :
+    _writeQueue(new OpenRTI::LocalMessageQueue),
+    _readQueue(new OpenRTI::LocalMessageQueue)
+  {
+    _writeSender = _writeQueue->getMessageSender();
+    _readSender = _readQueue->getMessageSender();
+  }
+  virtual OpenRTI::AbstractMessageSender* getMessageSender()
+  { return _readSender.get(); }
+  virtual OpenRTI::AbstractMessageReceiver* getMessageReceiver()
+  { return _writeQueue.get(); }
+
+  void write(const OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>& message)
+  { _writeSender->send(message); }
+  OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> read()
+  { return _readQueue->receive(); }
+
+private:
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _writeQueue;
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _readQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _writeSender;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _readSender;
+};
+
+// A socket in memory that keeps everything written to it
+class OPENRTI_LOCAL Pipe : public OpenRTI::AbstractProtocolSocket {
+public:
+  Pipe() :
+    _offset(0)
+  { }
+
+  virtual ssize_t recv(const OpenRTI::BufferRange& bufferRange, bool)
+  {
+    if (_data.size() <= _offset)
+      return -1;
+    ssize_t bytesRead = 0;
+    OpenRTI::Buffer::byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second && _offset < _data.size()) {
+      size_t size = std::min(i.chunk_size(bufferRange.second), _data.size() - _offset);
+      std::memcpy(i.data(), &_data[_offset], size);
+      _offset += size;
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesRead += size;
+    }
+    return bytesRead;
+  }
+  virtual ssize_t send(const OpenRTI::ConstBufferRange& bufferRange, bool)
+  {
+    ssize_t bytesWritten = 0;
+    OpenRTI::Buffer::const_byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second) {
+      size_t size = i.chunk_size(bufferRange.second);
+      const char* data = static_cast<const char*>(i.data());
+      _data.insert(_data.end(), data, data + size);
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesWritten += size;
+    }
+    return bytesWritten;
+  }
+  virtual void close()
+  { }
+  virtual void replaceProtocol(const OpenRTI::SharedPtr<OpenRTI::AbstractProtocolLayer>&)
+  { }
+
+  size_t size() const
+  { return _data.size(); }
+  void clear()
+  {
+    _data.clear();
+    _offset = 0;
+  }
+
+private:
+  std::vector<char> _data;
+  size_t _offset;
+};
+
+static OpenRTI::VariableLengthData
+createTimeStamp()
+{
+  OpenRTI::VariableLengthData timeStamp(8);
+  timeStamp.setUInt64BE(1234567, 0);
+  return timeStamp;
+}
+
+static OpenRTI::SharedPtr<OpenRTI::AbstractMessage>
+createAttributeUpdate()
+{
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = new OpenRTI::AttributeUpdateMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setObjectInstanceHandle(3);
+  message->setTransportationType(OpenRTI::RELIABLE);
+  message->getTag().setData("tag", 3);
+  message->getAttributeValues().resize(10);
+  for (unsigned i = 0; i < 10; ++i) {
+    message->getAttributeValues()[i].setAttributeHandle(i + 1);
+    message->getAttributeValues()[i].getValue().setData("some attribute value", 20);
+  }
+  return message;
+}
+
+static OpenRTI::SharedPtr<OpenRTI::AbstractMessage>
+createTimeStampedAttributeUpdate()
+{
+  OpenRTI::SharedPtr<OpenRTI::TimeStampedAttributeUpdateMessage> message = new OpenRTI::TimeStampedAttributeUpdateMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setObjectInstanceHandle(3);
+  message->getTag().setData("tag", 3);
+  message->setTimeStamp(createTimeStamp());
+  message->setMessageRetractionHandle(OpenRTI::MessageRetractionHandle(2, 17));
+  message->setOrderType(OpenRTI::TIMESTAMP);
+  message->setTransportationType(OpenRTI::RELIABLE);
+  message->getAttributeValues().resize(10);
+  for (unsigned i = 0; i < 10; ++i) {
+    message->getAttributeValues()[i].setAttributeHandle(i + 1);
+    message->getAttributeValues()[i].getValue().setData("some attribute value", 20);
+  }
+  return message;
+}
+
+static OpenRTI::SharedPtr<OpenRTI::AbstractMessage>
+createInteraction()
+{
+  OpenRTI::SharedPtr<OpenRTI::InteractionMessage> message = new OpenRTI::InteractionMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setInteractionClassHandle(4);
+  message->setTransportationType(OpenRTI::RELIABLE);
+  message->getTag().setData("tag", 3);
+  message->getParameterValues().resize(10);
+  for (unsigned i = 0; i < 10; ++i) {
+    message->getParameterValues()[i].setParameterHandle(i + 1);
+    message->getParameterValues()[i].getValue().setData("some parameter value", 20);
+  }
+  return message;
+}
+
+static OpenRTI::SharedPtr<OpenRTI::AbstractMessage>
+createTimeStampedInteraction()
+{
+  OpenRTI::SharedPtr<OpenRTI::TimeStampedInteractionMessage> message = new OpenRTI::TimeStampedInteractionMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setInteractionClassHandle(4);
+  message->setOrderType(OpenRTI::TIMESTAMP);
+  message->setTransportationType(OpenRTI::RELIABLE);
+  message->getTag().setData("tag", 3);
+  message->setTimeStamp(createTimeStamp());
+  message->setMessageRetractionHandle(OpenRTI::MessageRetractionHandle(2, 17));
+  message->getParameterValues().resize(10);
+  for (unsigned i = 0; i < 10; ++i) {
+    message->getParameterValues()[i].setParameterHandle(i + 1);
+    message->getParameterValues()[i].getValue().setData("some parameter value", 20);
+  }
+  return message;
+}
+
+static OpenRTI::SharedPtr<OpenRTI::AbstractMessage>
+createInsertObjectInstance()
+{
+  OpenRTI::SharedPtr<OpenRTI::InsertObjectInstanceMessage> message = new OpenRTI::InsertObjectInstanceMessage;
+  message->setFederationHandle(1);
+  message->setObjectClassHandle(5);
+  message->setObjectInstanceHandle(3);
+  message->setName("HLAobjectInstance3");
+  message->getAttributeStateVector().resize(10);
+  for (unsigned i = 0; i < 10; ++i)
+    message->getAttributeStateVector()[i].setAttributeHandle(i + 1);
+  return message;
+}
+
+static OpenRTI::SharedPtr<OpenRTI::AbstractMessage>
+createDeleteObjectInstance()
+{
+  OpenRTI::SharedPtr<OpenRTI::DeleteObjectInstanceMessage> message = new OpenRTI::DeleteObjectInstanceMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setObjectInstanceHandle(3);
+  message->getTag().setData("tag", 3);
+  return message;
+}
+
+static OpenRTI::SharedPtr<OpenRTI::AbstractMessage>
+createRequestAttributeUpdate()
+{
+  OpenRTI::SharedPtr<OpenRTI::RequestAttributeUpdateMessage> message = new OpenRTI::RequestAttributeUpdateMessage;
+  message->setFederationHandle(1);
+  message->setObjectInstanceHandle(3);
+  for (unsigned i = 0; i < 10; ++i)
+    message->getAttributeHandles().push_back(i + 1);
+  message->getTag().setData("tag", 3);
+  return message;
+}
+
+static OpenRTI::SharedPtr<OpenRTI::AbstractMessage>
+createCommitLowerBoundTimeStamp()
+{
+  OpenRTI::SharedPtr<OpenRTI::CommitLowerBoundTimeStampMessage> message = new OpenRTI::CommitLowerBoundTimeStampMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setTimeStamp(createTimeStamp());
+  message->setCommitType(OpenRTI::TimeAdvanceCommit);
+  message->setCommitId(42);
+  return message;
+}
+
+typedef OpenRTI::SharedPtr<OpenRTI::AbstractMessage> (*CreateMessageFunction)();
+
+static const CreateMessageFunction createMessageFunctions[] = {
+  createAttributeUpdate,
+  createTimeStampedAttributeUpdate,
+  createInteraction,
+  createTimeStampedInteraction,
+  createInsertObjectInstance,
+  createDeleteObjectInstance,
+  createRequestAttributeUpdate,
+  createCommitLowerBoundTimeStamp
+};
+
+static bool
+benchmark(OpenRTI::BenchmarkReport& report, const char* encodingName, const OpenRTI::AbstractMessage& message, unsigned count)
+{
+  OpenRTI::SharedPtr<Connect> connect = new Connect;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> writer;
+  writer = OpenRTI::MessageEncodingRegistry::instance().getEncoding(encodingName);
+  writer->setConnect(connect);
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> reader;
+  reader = OpenRTI::MessageEncodingRegistry::instance().getEncoding(encodingName);
+  reader->setConnect(connect);
+  Pipe pipe;
+
+  std::string name = std::string(encodingName) + "/";
+  name += message.getTypeName();
+
+  // The message is shared with the caller, so drop the encoding kept
+  // at the message to encode each message again
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i) {
+    message.setEncodedMessage(0);
+    connect->write(&message);
+    writer->write(pipe);
+  }
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+  report.addThroughput(name + "/encode", count, stop - start, pipe.size());
+
+  start = OpenRTI::Clock::now();
+  reader->read(pipe);
+  stop = OpenRTI::Clock::now();
+  report.addThroughput(name + "/decode", count, stop - start, pipe.size());
+
+  for (unsigned i = 0; i < count; ++i) {
+    OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> readMessage = connect->read();
+    if (!readMessage.valid() || *readMessage != message) {
+      std::cerr << "Message " << message.getTypeName() << " did not survive encoding!" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::BenchmarkOptions options(argc, argv, 20000);
+  while (options.next());
+
+  OpenRTI::BenchmarkReport report("encoding");
+  for (unsigned i = 0; i < sizeof(createMessageFunctions)/sizeof(createMessageFunctions[0]); ++i) {
+    OpenRTI::SharedPtr<OpenRTI::AbstractMessage> message = createMessageFunctions[i]();
+    if (!benchmark(report, "TightBE1", *message, options.getCount()))
+      return EXIT_FAILURE;
+  }
+
+  if (!report.write(options.getFile()))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,288 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// End to end latency from updateAttributeValues in one rti1516e federate
+// to the reflectAttributeValues callback in an other federate.
+// Both federates live in this thread, so the latency is measured with the
+// same clock without any synchronization between the federates.
+
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <RTI/NullFederateAmbassador.h>
+#include <RTI/RTIambassador.h>
+#include <RTI/RTIambassadorFactory.h>
+
+#include "Benchmark.h"
+#include "Clock.h"
+#include "Exception.h"
+#include "NetworkServer.h"
+#include "SocketAddress.h"
+#include "StringUtils.h"
+#include "Thread.h"
+
+// A server for the rti:// and pipe:// protocols
+class OPENRTI_LOCAL ServerThread : public OpenRTI::Thread {
+public:
+  std::wstring listenInet()
+  {
+    std::list<OpenRTI::SocketAddress> addressList = OpenRTI::SocketAddress::resolve("localhost", "0", true);
+    while (!addressList.empty()) {
+      try {
+        OpenRTI::SocketAddress address = _server.listenInet(addressList.front(), 20);
+        return L"rti://" + OpenRTI::utf8ToUcs(address.getNumericName()) + L"/";
+      } catch (const OpenRTI::Exception&) {
+        addressList.pop_front();
+        if (addressList.empty())
+          throw;
+      }
+    }
+    throw OpenRTI::RTIinternalError("Cannot resolve localhost!");
+  }
+  std::wstring listenPipe(const std::string& file)
+  {
+    _server.listenPipe(file, 20);
+    return L"pipe://" + OpenRTI::localeToUcs(file);
+  }
+
+  void stop()
+  {
+    _server.postDone();
+    wait();
+  }
+
+protected:
+  virtual void run()
+  { _server.exec(); }
+
+private:
+  OpenRTI::NetworkServer _server;
+};
+
+class OPENRTI_LOCAL FederateAmbassador : public rti1516e::NullFederateAmbassador {
+public:
+  FederateAmbassador() :
+    _numReflected(0)
+  { }
+
+  virtual void discoverObjectInstance(rti1516e::ObjectInstanceHandle objectInstanceHandle,
+                                      rti1516e::ObjectClassHandle,
+                                      std::wstring const &)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  { _objectInstanceHandle = objectInstanceHandle; }
+  virtual void discoverObjectInstance(rti1516e::ObjectInstanceHandle objectInstanceHandle,
+                                      rti1516e::ObjectClassHandle objectClassHandle,
+                                      std::wstring const & objectInstanceName,
+                                      rti1516e::FederateHandle)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  { discoverObjectInstance(objectInstanceHandle, objectClassHandle, objectInstanceName); }
+
+  virtual void reflectAttributeValues(rti1516e::ObjectInstanceHandle,
+                                      rti1516e::AttributeHandleValueMap const &,
+                                      rti1516e::VariableLengthData const &,
+                                      rti1516e::OrderType,
+                                      rti1516e::TransportationType,
+                                      rti1516e::SupplementalReflectInfo)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  { ++_numReflected; }
+
+  rti1516e::ObjectInstanceHandle _objectInstanceHandle;
+  unsigned _numReflected;
+};
+
+class OPENRTI_LOCAL Federate {
+public:
+  void join(const std::wstring& url, const std::wstring& fddFile)
+  {
+    rti1516e::RTIambassadorFactory factory;
+    _ambassador = factory.createRTIambassador();
+    _ambassador->connect(_federateAmbassador, rti1516e::HLA_EVOKED, url);
+    try {
+      _ambassador->createFederationExecution(L"bench", fddFile);
+    } catch (const rti1516e::FederationExecutionAlreadyExists&) {
+    }
+    _ambassador->joinFederationExecution(L"bench", L"bench");
+
+    _objectClassHandle = _ambassador->getObjectClassHandle(L"ObjectClass");
+    _attributeHandleSet.insert(_ambassador->getAttributeHandle(_objectClassHandle, L"Attribute0"));
+  }
+
+  void resign()
+  {
+    _ambassador->resignFederationExecution(rti1516e::DELETE_OBJECTS_THEN_DIVEST);
+    try {
+      _ambassador->destroyFederationExecution(L"bench");
+    } catch (const rti1516e::FederatesCurrentlyJoined&) {
+    }
+    _ambassador->disconnect();
+    _ambassador.reset();
+  }
+
+  // Evoke callbacks until the condition is met, false on timeout
+  bool evokeUntilDiscovered()
+  {
+    OpenRTI::Clock timeout = OpenRTI::Clock::now() + OpenRTI::Clock::fromSeconds(10);
+    while (!_federateAmbassador._objectInstanceHandle.isValid()) {
+      _ambassador->evokeCallback(0.1);
+      if (timeout < OpenRTI::Clock::now())
+        return false;
+    }
+    return true;
+  }
+  bool evokeUntilReflected(unsigned numReflected)
+  {
+    OpenRTI::Clock timeout = OpenRTI::Clock::now() + OpenRTI::Clock::fromSeconds(10);
+    while (_federateAmbassador._numReflected < numReflected) {
+      _ambassador->evokeCallback(0.1);
+      if (timeout < OpenRTI::Clock::now())
+        return false;
+    }
+    return true;
+  }
+
+  FederateAmbassador _federateAmbassador;
+  RTI_UNIQUE_PTR<rti1516e::RTIambassador> _ambassador;
+  rti1516e::ObjectClassHandle _objectClassHandle;
+  rti1516e::AttributeHandleSet _attributeHandleSet;
+};
+
+static bool
+benchmark(OpenRTI::BenchmarkReport& report, const std::string& protocol, const std::wstring& fddFile, unsigned count)
+{
+  OpenRTI::SharedPtr<ServerThread> serverThread;
+  std::wstring url;
+  if (protocol == "thread") {
+    url = L"thread:///";
+  } else if (protocol == "rti") {
+    serverThread = new ServerThread;
+    url = serverThread->listenInet();
+  } else if (protocol == "pipe") {
+    std::stringstream file;
+    file << "/tmp/OpenRTI-bench-" << OpenRTI::Clock::now().getNSec();
+    serverThread = new ServerThread;
+    url = serverThread->listenPipe(file.str());
+  } else {
+    std::cerr << "Unknown protocol \"" << protocol << "\"!" << std::endl;
+    return false;
+  }
+  if (serverThread.valid())
+    serverThread->start();
+
+  bool success = true;
+  try {
+    // Federates in one process connecting to the same url share their leaf server.
+    // Give each one its own, so that the updates travel through the server.
+    Federate publisher;
+    Federate subscriber;
+    if (serverThread.valid()) {
+      publisher.join(url + L"?leaf=publisher", fddFile);
+      subscriber.join(url + L"?leaf=subscriber", fddFile);
+    } else {
+      publisher.join(url, fddFile);
+      subscriber.join(url, fddFile);
+    }
+
+    subscriber._ambassador->subscribeObjectClassAttributes(subscriber._objectClassHandle, subscriber._attributeHandleSet);
+    publisher._ambassador->publishObjectClassAttributes(publisher._objectClassHandle, publisher._attributeHandleSet);
+    rti1516e::ObjectInstanceHandle objectInstanceHandle;
+    objectInstanceHandle = publisher._ambassador->registerObjectInstance(publisher._objectClassHandle);
+
+    if (!subscriber.evokeUntilDiscovered()) {
+      std::cerr << "Object instance was not discovered!" << std::endl;
+      success = false;
+    }
+
+    rti1516e::AttributeHandleValueMap attributeValues;
+    attributeValues[*publisher._attributeHandleSet.begin()].setData("some attribute value", 20);
+    rti1516e::VariableLengthData tag;
+
+    // Warm up the caches and buffers along the way
+    const unsigned warmup = 10;
+    std::vector<OpenRTI::Clock> samples;
+    samples.reserve(count);
+    for (unsigned i = 0; success && i < warmup + count; ++i) {
+      OpenRTI::Clock start = OpenRTI::Clock::now();
+      publisher._ambassador->updateAttributeValues(objectInstanceHandle, attributeValues, tag);
+      if (!subscriber.evokeUntilReflected(i + 1)) {
+        std::cerr << "Attribute update was not reflected!" << std::endl;
+        success = false;
+        break;
+      }
+      if (warmup <= i)
+        samples.push_back(OpenRTI::Clock::now() - start);
+    }
+
+    if (success)
+      report.addLatency(protocol + "/updateAttributeValues", samples);
+
+    subscriber.resign();
+    publisher.resign();
+
+  } catch (const rti1516e::Exception& e) {
+    std::wcerr << L"rti1516e::Exception: \"" << e.what() << L"\"" << std::endl;
+    success = false;
+  } catch (const OpenRTI::Exception& e) {
+    std::cerr << "Caught exception: " << e.what() << std::endl;
+    success = false;
+  }
+
+  if (serverThread.valid())
+    serverThread->stop();
+  return success;
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::wstring fddFile;
+  std::vector<std::string> protocols;
+  OpenRTI::BenchmarkOptions options(argc, argv, 2000);
+  while (options.next("O:P:")) {
+    switch (options.getOptChar()) {
+    case 'O':
+      fddFile = OpenRTI::localeToUcs(options.getArgument());
+      break;
+    case 'P':
+      protocols.push_back(options.getArgument());
+      break;
+    }
+  }
+  if (protocols.empty()) {
+    protocols.push_back("thread");
+    protocols.push_back("rti");
+#if !defined(_WIN32)
+    protocols.push_back("pipe");
+#endif
+  }
+
+  OpenRTI::BenchmarkReport report("latency");
+  for (std::vector<std::string>::const_iterator i = protocols.begin(); i != protocols.end(); ++i) {
+    if (!benchmark(report, *i, fddFile, options.getCount()))
+      return EXIT_FAILURE;
+  }
+
+  if (!report.write(options.getFile()))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
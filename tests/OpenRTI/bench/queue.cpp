@@ -0,0 +1,160 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Hand off of messages between threads through the ThreadMessageQueue,
+// the queue between the ambassadors and the server thread of thread:// connects.
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Clock.h"
+#include "Message.h"
+#include "MessageQueue.h"
+#include "Thread.h"
+
+static OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>
+createUpdate()
+{
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = new OpenRTI::AttributeUpdateMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setObjectInstanceHandle(3);
+  message->setTransportationType(OpenRTI::RELIABLE);
+  message->getAttributeValues().resize(1);
+  message->getAttributeValues()[0].setAttributeHandle(1);
+  message->getAttributeValues()[0].getValue().setData("some attribute value", 20);
+  return message;
+}
+
+// Sends count messages as fast as possible
+class OPENRTI_LOCAL ProducerThread : public OpenRTI::Thread {
+public:
+  ProducerThread(const OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender>& messageSender, unsigned count) :
+    _messageSender(messageSender),
+    _count(count)
+  { }
+
+protected:
+  virtual void run()
+  {
+    OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = createUpdate();
+    for (unsigned i = 0; i < _count; ++i)
+      _messageSender->send(message);
+  }
+
+private:
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _messageSender;
+  unsigned _count;
+};
+
+// Sends back each of count messages received
+class OPENRTI_LOCAL EchoThread : public OpenRTI::Thread {
+public:
+  EchoThread(const OpenRTI::SharedPtr<OpenRTI::ThreadMessageQueue>& messageQueue,
+             const OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender>& messageSender, unsigned count) :
+    _messageQueue(messageQueue),
+    _messageSender(messageSender),
+    _count(count)
+  { }
+
+protected:
+  virtual void run()
+  {
+    for (unsigned i = 0; i < _count; ++i) {
+      OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = _messageQueue->receive(OpenRTI::Clock::max());
+      if (!message.valid())
+        return;
+      _messageSender->send(message);
+    }
+  }
+
+private:
+  OpenRTI::SharedPtr<OpenRTI::ThreadMessageQueue> _messageQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _messageSender;
+  unsigned _count;
+};
+
+static bool
+benchmarkThroughput(OpenRTI::BenchmarkReport& report, unsigned count)
+{
+  OpenRTI::SharedPtr<OpenRTI::ThreadMessageQueue> messageQueue = new OpenRTI::ThreadMessageQueue;
+  OpenRTI::SharedPtr<ProducerThread> producerThread = new ProducerThread(messageQueue->getMessageSender(), count);
+
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  if (!producerThread->start())
+    return false;
+  for (unsigned i = 0; i < count; ++i) {
+    if (!messageQueue->receive(OpenRTI::Clock::max()).valid()) {
+      std::cerr << "Message queue closed unexpectedly!" << std::endl;
+      return false;
+    }
+  }
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+  producerThread->wait();
+
+  report.addThroughput("ThreadMessageQueue/handoff", count, stop - start);
+  return true;
+}
+
+static bool
+benchmarkRoundTrip(OpenRTI::BenchmarkReport& report, unsigned count)
+{
+  OpenRTI::SharedPtr<OpenRTI::ThreadMessageQueue> pingQueue = new OpenRTI::ThreadMessageQueue;
+  OpenRTI::SharedPtr<OpenRTI::ThreadMessageQueue> pongQueue = new OpenRTI::ThreadMessageQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> pingSender = pingQueue->getMessageSender();
+  OpenRTI::SharedPtr<EchoThread> echoThread = new EchoThread(pingQueue, pongQueue->getMessageSender(), count);
+  if (!echoThread->start())
+    return false;
+
+  OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = createUpdate();
+  std::vector<OpenRTI::Clock> samples;
+  samples.reserve(count);
+  for (unsigned i = 0; i < count; ++i) {
+    OpenRTI::Clock start = OpenRTI::Clock::now();
+    pingSender->send(message);
+    if (!pongQueue->receive(OpenRTI::Clock::max()).valid()) {
+      std::cerr << "Message queue closed unexpectedly!" << std::endl;
+      return false;
+    }
+    samples.push_back(OpenRTI::Clock::now() - start);
+  }
+  echoThread->wait();
+
+  report.addLatency("ThreadMessageQueue/roundtrip", samples);
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::BenchmarkOptions options(argc, argv, 100000);
+  while (options.next());
+
+  OpenRTI::BenchmarkReport report("queue");
+  if (!benchmarkThroughput(report, options.getCount()))
+    return EXIT_FAILURE;
+  if (!benchmarkRoundTrip(report, options.getCount()/10 + 1))
+    return EXIT_FAILURE;
+
+  if (!report.write(options.getFile()))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,267 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Routing of attribute updates through the server node.
+// The federates are plain connects to a server that is not running its
+// event loop. Messages sent through such a connect are dispatched by the
+// server node in the calling thread, so what is measured is the routing
+// from the publishing federate to the queues of the subscribed federates.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "AbstractConnect.h"
+#include "Benchmark.h"
+#include "Clock.h"
+#include "Exception.h"
+#include "FDD1516EFileReader.h"
+#include "Message.h"
+#include "NetworkServer.h"
+
+// A federate that is just a connect to the server
+struct OPENRTI_LOCAL Federate {
+  OpenRTI::SharedPtr<OpenRTI::AbstractConnect> _connect;
+  OpenRTI::FederationHandle _federationHandle;
+  OpenRTI::FederateHandle _federateHandle;
+  OpenRTI::ObjectClassHandle _objectClassHandle;
+  OpenRTI::AttributeHandleVector _attributeHandleVector;
+
+  // Receive the pending messages, returns the number of attribute updates seen
+  unsigned receive()
+  {
+    unsigned count = 0;
+    for (;;) {
+      OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = _connect->receive();
+      if (!message.valid())
+        return count;
+      if (dynamic_cast<const OpenRTI::AttributeUpdateMessage*>(message.get())) {
+        ++count;
+      } else if (const OpenRTI::JoinFederationExecutionResponseMessage* response
+                 = dynamic_cast<const OpenRTI::JoinFederationExecutionResponseMessage*>(message.get())) {
+        _federationHandle = response->getFederationHandle();
+        _federateHandle = response->getFederateHandle();
+      } else if (const OpenRTI::InsertModulesMessage* insertModules
+                 = dynamic_cast<const OpenRTI::InsertModulesMessage*>(message.get())) {
+        insert(insertModules->getFOMModuleList());
+      }
+    }
+  }
+
+  // Pick the object class of the benchmark from the object model
+  void insert(const OpenRTI::FOMModuleList& moduleList)
+  {
+    for (OpenRTI::FOMModuleList::const_iterator i = moduleList.begin(); i != moduleList.end(); ++i) {
+      for (OpenRTI::FOMObjectClassList::const_iterator j = i->getObjectClassList().begin();
+           j != i->getObjectClassList().end(); ++j) {
+        if (j->getName() != "ObjectClass")
+          continue;
+        _objectClassHandle = j->getObjectClassHandle();
+        for (OpenRTI::FOMAttributeList::const_iterator k = j->getAttributeList().begin();
+             k != j->getAttributeList().end(); ++k)
+          _attributeHandleVector.push_back(k->getAttributeHandle());
+      }
+    }
+  }
+};
+
+static bool
+join(Federate& federate, OpenRTI::NetworkServer& networkServer, const std::string& federateName)
+{
+  federate._connect = networkServer.sendConnect(OpenRTI::StringStringListMap(), false);
+  if (!federate._connect.valid())
+    return false;
+  OpenRTI::SharedPtr<OpenRTI::JoinFederationExecutionRequestMessage> request;
+  request = new OpenRTI::JoinFederationExecutionRequestMessage;
+  request->setFederationExecution("bench");
+  request->setFederateType("bench");
+  request->setFederateName(federateName);
+  federate._connect->send(request);
+  federate.receive();
+  if (!federate._federateHandle.valid()) {
+    std::cerr << "Could not join federate \"" << federateName << "\"!" << std::endl;
+    return false;
+  }
+  if (!federate._objectClassHandle.valid() || federate._attributeHandleVector.empty()) {
+    std::cerr << "Object class is not in the object model!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+static bool
+benchmark(OpenRTI::BenchmarkReport& report, const OpenRTI::FOMStringModule& module,
+          unsigned numSubscribers, unsigned count)
+{
+  OpenRTI::NetworkServer networkServer;
+
+  // Create the federation
+  OpenRTI::SharedPtr<OpenRTI::AbstractConnect> connect;
+  connect = networkServer.sendConnect(OpenRTI::StringStringListMap(), false);
+  if (!connect.valid())
+    return false;
+  OpenRTI::SharedPtr<OpenRTI::CreateFederationExecutionRequestMessage> create;
+  create = new OpenRTI::CreateFederationExecutionRequestMessage;
+  create->setFederationExecution("bench");
+  create->setLogicalTimeFactoryName("HLAinteger64Time");
+  create->getFOMStringModuleList().push_back(module);
+  connect->send(create);
+  OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = connect->receive();
+  const OpenRTI::CreateFederationExecutionResponseMessage* createResponse;
+  createResponse = dynamic_cast<const OpenRTI::CreateFederationExecutionResponseMessage*>(message.get());
+  if (!createResponse || createResponse->getCreateFederationExecutionResponseType() != OpenRTI::CreateFederationExecutionResponseSuccess) {
+    std::cerr << "Could not create federation execution!" << std::endl;
+    return false;
+  }
+
+  // The subscribers
+  std::vector<Federate> subscribers(numSubscribers);
+  for (unsigned i = 0; i < numSubscribers; ++i) {
+    std::stringstream federateName;
+    federateName << "subscriber" << i;
+    if (!join(subscribers[i], networkServer, federateName.str()))
+      return false;
+    OpenRTI::SharedPtr<OpenRTI::ChangeObjectClassSubscriptionMessage> subscribe;
+    subscribe = new OpenRTI::ChangeObjectClassSubscriptionMessage;
+    subscribe->setFederationHandle(subscribers[i]._federationHandle);
+    subscribe->setObjectClassHandle(subscribers[i]._objectClassHandle);
+    subscribe->setAttributeHandles(subscribers[i]._attributeHandleVector);
+    subscribe->setSubscriptionType(OpenRTI::SubscribedActive);
+    subscribers[i]._connect->send(subscribe);
+  }
+
+  // The publisher with a registered object instance
+  Federate publisher;
+  if (!join(publisher, networkServer, "publisher"))
+    return false;
+  OpenRTI::SharedPtr<OpenRTI::ChangeObjectClassPublicationMessage> publish;
+  publish = new OpenRTI::ChangeObjectClassPublicationMessage;
+  publish->setFederationHandle(publisher._federationHandle);
+  publish->setObjectClassHandle(publisher._objectClassHandle);
+  publish->setAttributeHandles(publisher._attributeHandleVector);
+  publish->setPublicationType(OpenRTI::Published);
+  publisher._connect->send(publish);
+  publisher.receive();
+
+  OpenRTI::SharedPtr<OpenRTI::ObjectInstanceHandlesRequestMessage> handlesRequest;
+  handlesRequest = new OpenRTI::ObjectInstanceHandlesRequestMessage;
+  handlesRequest->setFederationHandle(publisher._federationHandle);
+  handlesRequest->setFederateHandle(publisher._federateHandle);
+  handlesRequest->setCount(1);
+  publisher._connect->send(handlesRequest);
+  message = publisher._connect->receive();
+  const OpenRTI::ObjectInstanceHandlesResponseMessage* handlesResponse;
+  handlesResponse = dynamic_cast<const OpenRTI::ObjectInstanceHandlesResponseMessage*>(message.get());
+  if (!handlesResponse || handlesResponse->getObjectInstanceHandleNamePairVector().empty()) {
+    std::cerr << "Could not reserve an object instance handle!" << std::endl;
+    return false;
+  }
+  OpenRTI::ObjectInstanceHandleNamePair handleNamePair = handlesResponse->getObjectInstanceHandleNamePairVector().front();
+
+  OpenRTI::SharedPtr<OpenRTI::InsertObjectInstanceMessage> insert;
+  insert = new OpenRTI::InsertObjectInstanceMessage;
+  insert->setFederationHandle(publisher._federationHandle);
+  insert->setObjectClassHandle(publisher._objectClassHandle);
+  insert->setObjectInstanceHandle(handleNamePair.first);
+  insert->setName(handleNamePair.second);
+  for (OpenRTI::AttributeHandleVector::const_iterator i = publisher._attributeHandleVector.begin();
+       i != publisher._attributeHandleVector.end(); ++i) {
+    OpenRTI::AttributeState attributeState;
+    attributeState.setAttributeHandle(*i);
+    insert->getAttributeStateVector().push_back(attributeState);
+  }
+  publisher._connect->send(insert);
+  publisher.receive();
+  for (unsigned i = 0; i < numSubscribers; ++i)
+    subscribers[i].receive();
+
+  // Route the updates, each one is a new message like the ambassador sends
+  uint64_t numReceived = 0;
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i) {
+    OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> update = new OpenRTI::AttributeUpdateMessage;
+    update->setFederationHandle(publisher._federationHandle);
+    update->setFederateHandle(publisher._federateHandle);
+    update->setObjectInstanceHandle(handleNamePair.first);
+    update->setTransportationType(OpenRTI::RELIABLE);
+    update->getAttributeValues().resize(publisher._attributeHandleVector.size());
+    for (unsigned j = 0; j < publisher._attributeHandleVector.size(); ++j) {
+      update->getAttributeValues()[j].setAttributeHandle(publisher._attributeHandleVector[j]);
+      update->getAttributeValues()[j].getValue().setData("some attribute value", 20);
+    }
+    publisher._connect->send(update);
+    for (unsigned j = 0; j < numSubscribers; ++j)
+      numReceived += subscribers[j].receive();
+  }
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+
+  if (numReceived != uint64_t(count)*numSubscribers) {
+    std::cerr << "Expected " << uint64_t(count)*numSubscribers << " updates, received "
+              << numReceived << "!" << std::endl;
+    return false;
+  }
+
+  std::stringstream name;
+  name << "ServerNode/AttributeUpdateMessage/fanout" << numSubscribers;
+  report.addThroughput(name.str(), count, stop - start);
+
+  for (unsigned i = 0; i < numSubscribers; ++i)
+    subscribers[i]._connect->close();
+  publisher._connect->close();
+  connect->close();
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::string fddFile;
+  OpenRTI::BenchmarkOptions options(argc, argv, 20000);
+  while (options.next("O:")) {
+    switch (options.getOptChar()) {
+    case 'O':
+      fddFile = options.getArgument();
+      break;
+    }
+  }
+
+  std::ifstream stream(fddFile.c_str());
+  if (!stream.is_open()) {
+    std::cerr << "Cannot open fdd file \"" << fddFile << "\"!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  OpenRTI::BenchmarkReport report("servernode");
+  try {
+    OpenRTI::FOMStringModule module = OpenRTI::FDD1516EFileReader::read(stream, std::string());
+    if (!benchmark(report, module, 1, options.getCount()))
+      return EXIT_FAILURE;
+    if (!benchmark(report, module, 16, options.getCount()/4 + 1))
+      return EXIT_FAILURE;
+  } catch (const OpenRTI::Exception& e) {
+    std::cerr << "Caught exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!report.write(options.getFile()))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Throughput of the StreamBufferProtocol of the TightBE1 encoding
+// through a connected pair of local stream sockets.
+// The messages are shared with the benchmark, so they are encoded only once
+// and what is measured is the buffer handling, the socket calls and the decoding.
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+#include "AbstractConnect.h"
+#include "AbstractProtocolSocket.h"
+#include "Benchmark.h"
+#include "Clock.h"
+#include "Exception.h"
+#include "Message.h"
+#include "MessageEncodingRegistry.h"
+#include "MessageQueue.h"
+#include "SocketPipe.h"
+#include "SocketServerPipe.h"
+
+// One end of an encoding, the messages to write or the messages read
+class OPENRTI_LOCAL Connect : public OpenRTI::AbstractConnect {
+public:
+  Connect() :
+    _writeQueue(new OpenRTI::LocalMessageQueue),
+    _readQueue(new OpenRTI::LocalMessageQueue)
+  {
+    _writeSender = _writeQueue->getMessageSender();
+    _readSender = _readQueue->getMessageSender();
+  }
+  virtual OpenRTI::AbstractMessageSender* getMessageSender()
+  { return _readSender.get(); }
+  virtual OpenRTI::AbstractMessageReceiver* getMessageReceiver()
+  { return _writeQueue.get(); }
+
+  void write(const OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>& message)
+  { _writeSender->send(message); }
+  OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> read()
+  { return _readQueue->receive(); }
+
+private:
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _writeQueue;
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _readQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _writeSender;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _readSender;
+};
+
+// The protocol socket view of a non blocking socket stream
+class OPENRTI_LOCAL ProtocolSocket : public OpenRTI::AbstractProtocolSocket {
+public:
+  ProtocolSocket(const OpenRTI::SharedPtr<OpenRTI::SocketStream>& socketStream) :
+    _socketStream(socketStream),
+    _octetsSent(0),
+    _closed(false)
+  { }
+
+  virtual ssize_t recv(const OpenRTI::BufferRange& bufferRange, bool peek)
+  { return _socketStream->recv(bufferRange, peek); }
+  virtual ssize_t send(const OpenRTI::ConstBufferRange& bufferRange, bool more)
+  {
+    ssize_t ret = _socketStream->send(bufferRange, more);
+    if (0 < ret)
+      _octetsSent += ret;
+    return ret;
+  }
+  virtual void close()
+  { _closed = true; }
+  virtual void replaceProtocol(const OpenRTI::SharedPtr<OpenRTI::AbstractProtocolLayer>&)
+  { }
+
+  uint64_t getOctetsSent() const
+  { return _octetsSent; }
+  bool getClosed() const
+  { return _closed; }
+
+private:
+  OpenRTI::SharedPtr<OpenRTI::SocketStream> _socketStream;
+  uint64_t _octetsSent;
+  bool _closed;
+};
+
+static OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage>
+createUpdate(unsigned numAttributes, unsigned valueSize)
+{
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = new OpenRTI::AttributeUpdateMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setObjectInstanceHandle(3);
+  message->setTransportationType(OpenRTI::RELIABLE);
+  message->getAttributeValues().resize(numAttributes);
+  for (unsigned i = 0; i < numAttributes; ++i) {
+    message->getAttributeValues()[i].setAttributeHandle(i + 1);
+    message->getAttributeValues()[i].getValue().resize(valueSize);
+    for (unsigned j = 0; j < valueSize; ++j)
+      message->getAttributeValues()[i].getValue().setUInt8(uint8_t(i + j), j);
+  }
+  return message;
+}
+
+static bool
+benchmark(OpenRTI::BenchmarkReport& report, const std::string& name, const std::string& file,
+          unsigned numAttributes, unsigned valueSize, unsigned count)
+{
+  // Get a connected pair of sockets through a listening socket
+  OpenRTI::SharedPtr<OpenRTI::SocketServerPipe> socketServer = new OpenRTI::SocketServerPipe;
+  socketServer->bind(file);
+  socketServer->listen(1);
+  OpenRTI::SharedPtr<OpenRTI::SocketPipe> socketPipe = new OpenRTI::SocketPipe;
+  socketPipe->connect(file);
+  OpenRTI::SharedPtr<OpenRTI::SocketStream> acceptedSocket = socketServer->accept();
+  socketServer->close();
+
+  ProtocolSocket writeSocket(socketPipe.get());
+  ProtocolSocket readSocket(acceptedSocket.get());
+
+  OpenRTI::SharedPtr<Connect> writeConnect = new Connect;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> writer;
+  writer = OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1");
+  writer->setConnect(writeConnect);
+  OpenRTI::SharedPtr<Connect> readConnect = new Connect;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> reader;
+  reader = OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1");
+  reader->setConnect(readConnect);
+
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = createUpdate(numAttributes, valueSize);
+
+  // Keep a bounded number of messages in flight, like a connect that is serviced by the event loop
+  const unsigned window = 64;
+  unsigned sent = 0;
+  unsigned received = 0;
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  while (received < count) {
+    for (; sent < count && sent - received < window; ++sent)
+      writeConnect->write(message);
+    writer->write(writeSocket);
+    reader->read(readSocket);
+    while (readConnect->read().valid())
+      ++received;
+    if (writeSocket.getClosed() || readSocket.getClosed()) {
+      std::cerr << "Socket closed unexpectedly!" << std::endl;
+      return false;
+    }
+  }
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+  report.addThroughput(name, count, stop - start, writeSocket.getOctetsSent());
+
+  socketPipe->shutdown();
+  acceptedSocket->close();
+  socketPipe->close();
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::BenchmarkOptions options(argc, argv, 20000);
+  while (options.next());
+
+  // Something unique in the current directory
+  std::stringstream file;
+  file << "stream-bench-" << OpenRTI::Clock::now().getNSec();
+
+  OpenRTI::BenchmarkReport report("stream");
+  try {
+    if (!benchmark(report, "TightBE1/AttributeUpdateMessage/10x20", file.str(), 10, 20, options.getCount()))
+      return EXIT_FAILURE;
+    if (!benchmark(report, "TightBE1/AttributeUpdateMessage/1x65536", file.str(), 1, 65536, options.getCount()/20 + 1))
+      return EXIT_FAILURE;
+  } catch (const OpenRTI::Exception& e) {
+    std::cerr << "Caught exception: " << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!report.write(options.getFile()))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,353 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "AbstractConnect.h"
+#include "AbstractProtocolSocket.h"
+#include "Clock.h"
+#include "DecodeDataStream.h"
+#include "DeltaCompression.h"
+#include "EncodeDataStream.h"
+#include "Message.h"
+#include "MessageEncodingRegistry.h"
+#include "MessageQueue.h"
+#include "Options.h"
+#include "Rand.h"
+#include "ZLibProtocolLayer.h"
+
+// Both ends of an encoding, the messages to write and the messages read
+class OPENRTI_LOCAL Connect : public OpenRTI::AbstractConnect {
+public:
+  Connect() :
+    _writeQueue(new OpenRTI::LocalMessageQueue),
+    _readQueue(new OpenRTI::LocalMessageQueue)
+  {
+    _writeSender = _writeQueue->getMessageSender();
+    _readSender = _readQueue->getMessageSender();
+  }
+  virtual OpenRTI::AbstractMessageSender* getMessageSender()
+  { return _readSender.get(); }
+  virtual OpenRTI::AbstractMessageReceiver* getMessageReceiver()
+  { return _writeQueue.get(); }
+
+  void write(const OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>& message)
+  { _writeSender->send(message); }
+  OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> read()
+  { return _readQueue->receive(); }
+
+private:
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _writeQueue;
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _readQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _writeSender;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _readSender;
+};
+
+// A socket pair in memory, counting the bytes on the wire
+class OPENRTI_LOCAL Pipe : public OpenRTI::AbstractProtocolSocket {
+public:
+  Pipe() :
+    _offset(0),
+    _bytes(0)
+  { }
+
+  virtual ssize_t recv(const OpenRTI::BufferRange& bufferRange, bool)
+  {
+    if (_data.size() <= _offset)
+      return -1;
+    ssize_t bytesRead = 0;
+    OpenRTI::Buffer::byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second && _offset < _data.size()) {
+      size_t size = std::min(i.chunk_size(bufferRange.second), _data.size() - _offset);
+      std::memcpy(i.data(), &_data[_offset], size);
+      _offset += size;
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesRead += size;
+    }
+    if (_offset == _data.size()) {
+      _data.clear();
+      _offset = 0;
+    }
+    return bytesRead;
+  }
+  virtual ssize_t send(const OpenRTI::ConstBufferRange& bufferRange, bool)
+  {
+    ssize_t bytesWritten = 0;
+    OpenRTI::Buffer::const_byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second) {
+      size_t size = i.chunk_size(bufferRange.second);
+      const char* data = static_cast<const char*>(i.data());
+      _data.insert(_data.end(), data, data + size);
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesWritten += size;
+    }
+    _bytes += bytesWritten;
+    return bytesWritten;
+  }
+  virtual void close()
+  { }
+  virtual void replaceProtocol(const OpenRTI::SharedPtr<OpenRTI::AbstractProtocolLayer>&)
+  { }
+
+  uint64_t getBytes() const
+  { return _bytes; }
+
+private:
+  std::vector<char> _data;
+  size_t _offset;
+  uint64_t _bytes;
+};
+
+// Object instances moving around, each update sends all attributes
+class OPENRTI_LOCAL Scenario {
+public:
+  Scenario(unsigned numObjectInstances) :
+    _state(numObjectInstances)
+  {
+    for (unsigned i = 0; i < numObjectInstances; ++i) {
+      for (unsigned j = 0; j < 6; ++j)
+        _state[i]._position[j] = double(_rand.get() % 10000);
+      _state[i]._name = "Object instance ";
+      _state[i]._name.push_back(char('a' + i % 26));
+    }
+  }
+
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> next(unsigned i)
+  {
+    i = i % _state.size();
+    for (unsigned j = 0; j < 3; ++j) {
+      _state[i]._position[j + 3] += 0.001*double(int(_rand.get() % 100) - 50);
+      _state[i]._position[j] += 0.01*_state[i]._position[j + 3];
+    }
+
+    OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = new OpenRTI::AttributeUpdateMessage;
+    message->setFederationHandle(1);
+    message->setFederateHandle(2);
+    message->setObjectInstanceHandle(100 + i);
+    message->setTag(OpenRTI::VariableLengthData("position"));
+    message->setTransportationType(OpenRTI::RELIABLE);
+    OpenRTI::AttributeValueVector& attributeValues = message->getAttributeValues();
+    attributeValues.resize(4);
+    // Position and velocity
+    for (unsigned j = 0; j < 2; ++j) {
+      attributeValues[j].setAttributeHandle(j + 1);
+      attributeValues[j].getValue().resize(24);
+      for (unsigned k = 0; k < 3; ++k)
+        attributeValues[j].getValue().setFloat64BE(_state[i]._position[3*j + k], 8*k);
+    }
+    // Name and a status that rarely change
+    attributeValues[2].setAttributeHandle(5);
+    attributeValues[2].getValue() = OpenRTI::VariableLengthData(_state[i]._name);
+    attributeValues[3].setAttributeHandle(7);
+    attributeValues[3].getValue().resize(4);
+    attributeValues[3].getValue().setUInt32BE(_rand.get() % 64 == 0, 0);
+    return message;
+  }
+
+private:
+  struct _State {
+    double _position[6];
+    std::string _name;
+  };
+  std::vector<_State> _state;
+  OpenRTI::Rand _rand;
+};
+
+struct OPENRTI_LOCAL Result {
+  Result() : _bytes(0), _nsec(0) { }
+  uint64_t _bytes;
+  uint64_t _nsec;
+};
+
+// Send the updates through an encoding, optionally delta and or zlib compressed
+static bool
+transfer(Result& result, unsigned numObjectInstances, unsigned numMessages, bool deltaCompression, bool zlibCompression)
+{
+  OpenRTI::SharedPtr<Connect> connect = new Connect;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> writer = OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1");
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> reader = OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1");
+  writer->setConnect(connect);
+  writer->setEnableDeltaCompression(deltaCompression);
+  reader->setConnect(connect);
+  reader->setEnableDeltaCompression(deltaCompression);
+
+  OpenRTI::SharedPtr<OpenRTI::AbstractProtocolLayer> writeLayer = writer;
+  OpenRTI::SharedPtr<OpenRTI::AbstractProtocolLayer> readLayer = reader;
+#if defined(OPENRTI_HAVE_ZLIB)
+  if (zlibCompression) {
+    OpenRTI::SharedPtr<OpenRTI::ZLibProtocolLayer> layer = new OpenRTI::ZLibProtocolLayer;
+    layer->setProtocolLayer(writeLayer);
+    writeLayer = layer;
+    layer = new OpenRTI::ZLibProtocolLayer;
+    layer->setProtocolLayer(readLayer);
+    readLayer = layer;
+  }
+#endif
+
+  Scenario scenario(numObjectInstances);
+  Pipe pipe;
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < numMessages; ++i) {
+    OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = scenario.next(i);
+    connect->write(message);
+    writeLayer->write(pipe);
+    readLayer->read(pipe);
+    OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> readMessage = connect->read();
+    if (!readMessage.valid() || *readMessage != *message) {
+      std::cerr << "Attribute update did not survive the transfer!" << std::endl;
+      return false;
+    }
+  }
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+  result._bytes = pipe.getBytes();
+  result._nsec = (stop - start).getNSec();
+  return true;
+}
+
+// The decoder follows the encoder through resets and overflowing dictionaries
+static bool
+testResync()
+{
+  OpenRTI::DeltaCompressionEncoder encoder;
+  OpenRTI::DeltaCompressionDecoder decoder;
+  Scenario scenario(20000);
+  OpenRTI::VariableLengthData variableLengthData;
+  for (unsigned i = 0; i < 50000; ++i) {
+    OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = scenario.next(i);
+    // A tag per update overflows the tag dictionary
+    message->setTag(OpenRTI::VariableLengthData(&i, sizeof(i)));
+    if (i % 7 == 0)
+      message->getAttributeValues().resize(i % 3);
+    if (i == 1234)
+      encoder.reset();
+
+    variableLengthData.resize(0);
+    OpenRTI::EncodeDataStream encodeStream(variableLengthData);
+    encoder.encode(encodeStream, *message);
+    OpenRTI::DecodeDataStream decodeStream(variableLengthData);
+    OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> readMessage = decoder.decode(decodeStream);
+    if (*readMessage != *message || decodeStream.offset() != variableLengthData.size()) {
+      std::cerr << "Decoder lost track of the encoder state at update " << i << "!" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Values larger than a fragment are decoded by the fragment decoder, sharing the state
+static bool
+testFragments()
+{
+  OpenRTI::SharedPtr<Connect> connect = new Connect;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> writer = OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1");
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> reader = OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1");
+  writer->setConnect(connect);
+  writer->setEnableFragmentExtension(true);
+  writer->setEnableDeltaCompression(true);
+  reader->setConnect(connect);
+  reader->setEnableFragmentExtension(true);
+  reader->setEnableDeltaCompression(true);
+
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = new OpenRTI::AttributeUpdateMessage;
+  message->setObjectInstanceHandle(3);
+  message->setTransportationType(OpenRTI::RELIABLE);
+  message->getAttributeValues().resize(1);
+  message->getAttributeValues().back().setAttributeHandle(1);
+  message->getAttributeValues().back().getValue().resize(1024*1024);
+  for (unsigned i = 0; i < 1024*1024; ++i)
+    message->getAttributeValues().back().getValue().charData()[i] = char(i*7);
+
+  Pipe pipe;
+  for (unsigned i = 0; i < 3; ++i) {
+    connect->write(message);
+    while (writer->getMoreToSend())
+      writer->write(pipe);
+    reader->read(pipe);
+    OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> readMessage = connect->read();
+    if (!readMessage.valid() || *readMessage != *message) {
+      std::cerr << "Large attribute update did not survive the transfer!" << std::endl;
+      return false;
+    }
+    OpenRTI::AttributeUpdateMessage* next = new OpenRTI::AttributeUpdateMessage(*message);
+    next->getAttributeValues().back().getValue().charData()[i*1000] = 'x';
+    message = next;
+  }
+  // Only the first update is large on the wire
+  if (2*1024*1024 < pipe.getBytes()) {
+    std::cerr << "Large attribute update is not delta compressed!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned numObjectInstances = 100;
+  unsigned numMessages = 100000;
+  OpenRTI::Options options(argc, argv);
+  while (options.next("n:o:")) {
+    switch (options.getOptChar()) {
+    case 'n':
+      numMessages = atoi(options.getArgument().c_str());
+      break;
+    case 'o':
+      numObjectInstances = atoi(options.getArgument().c_str());
+      break;
+    }
+  }
+
+  if (!testResync())
+    return EXIT_FAILURE;
+  if (!testFragments())
+    return EXIT_FAILURE;
+
+  // Compare bandwidth and cpu time of the compression modes
+  Result plain;
+  for (unsigned mode = 0; mode < 4; ++mode) {
+    bool deltaCompression = mode & 1;
+    bool zlibCompression = mode & 2;
+#if !defined(OPENRTI_HAVE_ZLIB)
+    if (zlibCompression)
+      continue;
+#endif
+    Result result;
+    if (!transfer(result, numObjectInstances, numMessages, deltaCompression, zlibCompression))
+      return EXIT_FAILURE;
+    if (!mode)
+      plain = result;
+    std::cout << (deltaCompression ? "delta" : "no delta") << ", " << (zlibCompression ? "zlib" : "no zlib") << ": "
+              << double(result._bytes)/numMessages << " bytes, "
+              << double(result._nsec)/numMessages << " nsec per update" << std::endl;
+    if (deltaCompression && plain._bytes <= result._bytes) {
+      std::cerr << "Delta compression does not reduce the bytes on the wire!" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,246 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "AbstractConnect.h"
+#include "AbstractProtocolSocket.h"
+#include "Clock.h"
+#include "Message.h"
+#include "MessageEncodingRegistry.h"
+#include "MessageQueue.h"
+#include "Options.h"
+
+// Both ends of an encoding, the messages to write and the messages read
+class OPENRTI_LOCAL Connect : public OpenRTI::AbstractConnect {
+public:
+  Connect() :
+    _writeQueue(new OpenRTI::LocalMessageQueue),
+    _readQueue(new OpenRTI::LocalMessageQueue)
+  {
+    _writeSender = _writeQueue->getMessageSender();
+    _readSender = _readQueue->getMessageSender();
+  }
+  virtual OpenRTI::AbstractMessageSender* getMessageSender()
+  { return _readSender.get(); }
+  virtual OpenRTI::AbstractMessageReceiver* getMessageReceiver()
+  { return _writeQueue.get(); }
+
+  void write(const OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>& message)
+  { _writeSender->send(message); }
+  OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> read()
+  { return _readQueue->receive(); }
+
+private:
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _writeQueue;
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _readQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _writeSender;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _readSender;
+};
+
+// A socket in memory that keeps everything written to it
+class OPENRTI_LOCAL Pipe : public OpenRTI::AbstractProtocolSocket {
+public:
+  Pipe() :
+    _offset(0)
+  { }
+
+  virtual ssize_t recv(const OpenRTI::BufferRange& bufferRange, bool)
+  {
+    if (_data.size() <= _offset)
+      return -1;
+    ssize_t bytesRead = 0;
+    OpenRTI::Buffer::byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second && _offset < _data.size()) {
+      size_t size = std::min(i.chunk_size(bufferRange.second), _data.size() - _offset);
+      std::memcpy(i.data(), &_data[_offset], size);
+      _offset += size;
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesRead += size;
+    }
+    return bytesRead;
+  }
+  virtual ssize_t send(const OpenRTI::ConstBufferRange& bufferRange, bool)
+  {
+    ssize_t bytesWritten = 0;
+    OpenRTI::Buffer::const_byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second) {
+      size_t size = i.chunk_size(bufferRange.second);
+      const char* data = static_cast<const char*>(i.data());
+      _data.insert(_data.end(), data, data + size);
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesWritten += size;
+    }
+    return bytesWritten;
+  }
+  virtual void close()
+  { }
+  virtual void replaceProtocol(const OpenRTI::SharedPtr<OpenRTI::AbstractProtocolLayer>&)
+  { }
+
+  const std::vector<char>& getData() const
+  { return _data; }
+  void clear()
+  {
+    _data.clear();
+    _offset = 0;
+  }
+
+private:
+  std::vector<char> _data;
+  size_t _offset;
+};
+
+// A server side connect, writing into a pipe
+struct OPENRTI_LOCAL Receiver : public OpenRTI::Referenced {
+  Receiver() :
+    _connect(new Connect),
+    _writer(OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1")),
+    _reader(OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1"))
+  {
+    _writer->setConnect(_connect);
+    _reader->setConnect(_connect);
+  }
+  OpenRTI::SharedPtr<Connect> _connect;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> _writer;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> _reader;
+  Pipe _pipe;
+};
+
+static OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage>
+createUpdate(unsigned numAttributes)
+{
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = new OpenRTI::AttributeUpdateMessage;
+  message->setFederationHandle(1);
+  message->setFederateHandle(2);
+  message->setObjectInstanceHandle(3);
+  message->setTransportationType(OpenRTI::RELIABLE);
+  message->getAttributeValues().resize(numAttributes);
+  for (unsigned i = 0; i < numAttributes; ++i) {
+    message->getAttributeValues()[i].setAttributeHandle(i + 1);
+    message->getAttributeValues()[i].getValue().setData("some attribute value", 20);
+  }
+  return message;
+}
+
+// A message sent to several connects is encoded once and results in the same bytes on each connect
+static bool
+testEncodeOnce()
+{
+  std::vector<OpenRTI::SharedPtr<Receiver> > receivers;
+  for (unsigned i = 0; i < 3; ++i)
+    receivers.push_back(new Receiver);
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = createUpdate(10);
+  for (unsigned i = 0; i < receivers.size(); ++i)
+    receivers[i]->_connect->write(message);
+
+  for (unsigned i = 0; i < receivers.size(); ++i) {
+    receivers[i]->_writer->write(receivers[i]->_pipe);
+    if (!message->getEncodedMessage()) {
+      std::cerr << "Shared message is not kept encoded!" << std::endl;
+      return false;
+    }
+    if (receivers[i]->_pipe.getData() != receivers[0]->_pipe.getData()) {
+      std::cerr << "Different bytes for the same message!" << std::endl;
+      return false;
+    }
+    receivers[i]->_reader->read(receivers[i]->_pipe);
+    OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> readMessage = receivers[i]->_connect->read();
+    if (!readMessage.valid() || *readMessage != *message) {
+      std::cerr << "Message did not survive encoding!" << std::endl;
+      return false;
+    }
+  }
+
+  // A message not shared with an other connect is just encoded
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> single = createUpdate(10);
+  receivers[0]->_connect->write(single);
+  single.clear();
+  receivers[0]->_pipe.clear();
+  receivers[0]->_writer->write(receivers[0]->_pipe);
+  if (receivers[0]->_pipe.getData() != receivers[1]->_pipe.getData()) {
+    std::cerr << "Different bytes for the same message!" << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+// Fan out of one update to many connects, with and without reusing the encoded message
+static double
+benchmark(unsigned numReceivers, unsigned numAttributes, unsigned numMessages, bool encodeOnce)
+{
+  std::vector<OpenRTI::SharedPtr<Receiver> > receivers;
+  for (unsigned i = 0; i < numReceivers; ++i)
+    receivers.push_back(new Receiver);
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < numMessages; ++i) {
+    OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = createUpdate(numAttributes);
+    for (unsigned j = 0; j < numReceivers; ++j) {
+      receivers[j]->_connect->write(message);
+      if (!encodeOnce)
+        message->setEncodedMessage(0);
+      receivers[j]->_writer->write(receivers[j]->_pipe);
+      receivers[j]->_pipe.clear();
+    }
+  }
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+  return double((stop - start).getNSec())/(double(numMessages)*numReceivers);
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned numReceivers = 60;
+  unsigned numAttributes = 20;
+  unsigned numMessages = 2000;
+  OpenRTI::Options options(argc, argv);
+  while (options.next("a:n:r:")) {
+    switch (options.getOptChar()) {
+    case 'a':
+      numAttributes = atoi(options.getArgument().c_str());
+      break;
+    case 'n':
+      numMessages = atoi(options.getArgument().c_str());
+      break;
+    case 'r':
+      numReceivers = atoi(options.getArgument().c_str());
+      break;
+    }
+  }
+
+  if (!testEncodeOnce())
+    return EXIT_FAILURE;
+
+  for (unsigned encodeOnce = 0; encodeOnce < 2; ++encodeOnce) {
+    double nsec = benchmark(numReceivers, numAttributes, numMessages, encodeOnce);
+    std::cout << (encodeOnce ? "encode once" : "encode per connect") << ": " << numReceivers << " connects, "
+              << nsec << " nsec per message and connect" << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,195 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "Clock.h"
+#include "Exception.h"
+#include "FOMModuleCache.h"
+#include "Message.h"
+#include "Options.h"
+
+// A module of a size comparable to the modules of the rpr fom
+static std::string
+getFDD(unsigned module, unsigned numObjectClasses, unsigned numInteractionClasses)
+{
+  std::stringstream stream;
+  stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+         << "<objectModel xmlns=\"http://standards.ieee.org/IEEE1516-2010\">\n"
+         << " <objects>\n"
+         << "  <objectClass>\n"
+         << "   <name>HLAobjectRoot</name>\n";
+  for (unsigned i = 0; i < numObjectClasses; ++i) {
+    stream << "   <objectClass>\n"
+           << "    <name>ObjectClass" << module << "_" << i << "</name>\n"
+           << "    <sharing>PublishSubscribe</sharing>\n";
+    for (unsigned j = 0; j < 20; ++j) {
+      stream << "    <attribute>\n"
+             << "     <name>attribute" << j << "</name>\n"
+             << "     <dataType>HLAinteger32BE</dataType>\n"
+             << "     <updateType>Conditional</updateType>\n"
+             << "     <updateCondition>On change</updateCondition>\n"
+             << "     <ownership>DivestAcquire</ownership>\n"
+             << "     <sharing>PublishSubscribe</sharing>\n"
+             << "     <transportation>" << (j % 2 ? "HLAreliable" : "HLAbestEffort") << "</transportation>\n"
+             << "     <order>" << (j % 3 ? "Receive" : "TimeStamp") << "</order>\n"
+             << "     <semantics>Some lengthy description of the attribute that is just skipped by the reader.</semantics>\n"
+             << "    </attribute>\n";
+    }
+    stream << "   </objectClass>\n";
+  }
+  stream << "  </objectClass>\n"
+         << " </objects>\n"
+         << " <interactions>\n"
+         << "  <interactionClass>\n"
+         << "   <name>HLAinteractionRoot</name>\n";
+  for (unsigned i = 0; i < numInteractionClasses; ++i) {
+    stream << "   <interactionClass>\n"
+           << "    <name>InteractionClass" << module << "_" << i << "</name>\n"
+           << "    <sharing>PublishSubscribe</sharing>\n"
+           << "    <transportation>HLAreliable</transportation>\n"
+           << "    <order>TimeStamp</order>\n";
+    for (unsigned j = 0; j < 10; ++j) {
+      stream << "    <parameter>\n"
+             << "     <name>parameter" << j << "</name>\n"
+             << "     <dataType>HLAinteger32BE</dataType>\n"
+             << "     <semantics>Some lengthy description of the parameter that is just skipped by the reader.</semantics>\n"
+             << "    </parameter>\n";
+    }
+    stream << "   </interactionClass>\n";
+  }
+  stream << "  </interactionClass>\n"
+         << " </interactions>\n"
+         << "</objectModel>\n";
+  return stream.str();
+}
+
+static bool
+testFOMCompile(const std::string& fileName, unsigned numModules)
+{
+  std::vector<std::string> contentList;
+  size_t contentSize = 0;
+  for (unsigned i = 0; i < numModules; ++i) {
+    contentList.push_back(getFDD(i, 40, 60));
+    contentSize += contentList.back().size();
+  }
+
+  // Parse the xml modules
+  OpenRTI::FOMStringModuleList moduleList;
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  for (std::vector<std::string>::const_iterator i = contentList.begin(); i != contentList.end(); ++i) {
+    std::istringstream stream(*i);
+    moduleList.push_back(OpenRTI::FOMModuleCache::read(OpenRTI::FOMModuleCache::FDD1516EFormat, stream, std::string()));
+  }
+  OpenRTI::Clock parseTime = OpenRTI::Clock::now() - start;
+
+  std::stringstream compiledStream;
+  OpenRTI::FOMModuleCache::writeCompiled(compiledStream, moduleList);
+  std::string compiled = compiledStream.str();
+
+  // Decode the precompiled modules
+  start = OpenRTI::Clock::now();
+  std::istringstream stream(compiled);
+  OpenRTI::FOMStringModuleList compiledModuleList = OpenRTI::FOMModuleCache::readCompiled(stream);
+  OpenRTI::Clock decodeTime = OpenRTI::Clock::now() - start;
+
+  if (compiledModuleList != moduleList) {
+    std::cerr << "Precompiled modules differ from the parsed ones!" << std::endl;
+    return false;
+  }
+  if (compiledModuleList.front().getContentHash() != OpenRTI::FOMModuleCache::getContentHash(OpenRTI::FOMModuleCache::FDD1516EFormat, contentList.front())) {
+    std::cerr << "Precompiled modules lost their content hash!" << std::endl;
+    return false;
+  }
+
+  std::cout << numModules << " modules, " << contentSize << " bytes xml, " << compiled.size() << " bytes precompiled" << std::endl;
+  std::cout << "parse: " << parseTime.getNSec()*1e-6 << " msec, decode precompiled: " << decodeTime.getNSec()*1e-6 << " msec" << std::endl;
+
+  // The file loader detects precompiled files and appends all modules
+  {
+    std::ofstream fileStream(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+    fileStream << compiled;
+  }
+  OpenRTI::FOMModuleCache::clear();
+  OpenRTI::FOMStringModuleList fileModuleList(1, moduleList.back());
+  if (!OpenRTI::FOMModuleCache::readFile(fileModuleList, OpenRTI::FOMModuleCache::FDD1516EFormat, fileName, std::string())) {
+    std::cerr << "Could not read precompiled file \"" << fileName << "\"!" << std::endl;
+    return false;
+  }
+  if (fileModuleList.size() != numModules + 1 || !std::equal(moduleList.begin(), moduleList.end(), fileModuleList.begin() + 1)) {
+    std::cerr << "Precompiled file modules differ from the parsed ones!" << std::endl;
+    return false;
+  }
+
+  // A single module is only returned for files with exactly one module
+  OpenRTI::FOMStringModule module;
+  try {
+    OpenRTI::FOMModuleCache::readFile(module, OpenRTI::FOMModuleCache::FDD1516EFormat, fileName, std::string());
+    if (numModules != 1) {
+      std::cerr << "Expected an exception reading multiple modules as one!" << std::endl;
+      return false;
+    }
+  } catch (const OpenRTI::Exception&) {
+    if (numModules == 1)
+      return false;
+  }
+
+  // Truncated files must be rejected
+  try {
+    std::istringstream truncatedStream(compiled.substr(0, compiled.size() - 1));
+    OpenRTI::FOMModuleCache::readCompiled(truncatedStream);
+    std::cerr << "Expected an exception reading a truncated precompiled file!" << std::endl;
+    return false;
+  } catch (const OpenRTI::Exception&) {
+  }
+
+  OpenRTI::FOMModuleCache::clear();
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::string fileName = "fomcompiled.bin";
+  unsigned numModules = 8;
+  OpenRTI::Options options(argc, argv);
+  while (options.next("f:n:")) {
+    switch (options.getOptChar()) {
+    case 'f':
+      fileName = options.getArgument();
+      break;
+    case 'n':
+      numModules = atoi(options.getArgument().c_str());
+      break;
+    }
+  }
+  if (numModules == 0)
+    return EXIT_FAILURE;
+
+  bool success = testFOMCompile(fileName, numModules);
+  std::remove(fileName.c_str());
+  if (!success)
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
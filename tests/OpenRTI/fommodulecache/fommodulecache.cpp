@@ -0,0 +1,145 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "Exception.h"
+#include "FOMModuleCache.h"
+#include "Message.h"
+
+static std::string
+getFDD(const std::string& interactionClassName)
+{
+  return "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<objectModel xmlns=\"http://standards.ieee.org/IEEE1516-2010\">\n"
+    " <interactions>\n"
+    "  <interactionClass>\n"
+    "   <name>HLAinteractionRoot</name>\n"
+    "   <interactionClass>\n"
+    "    <name>" + interactionClassName + "</name>\n"
+    "    <sharing>PublishSubscribe</sharing>\n"
+    "    <transportation>HLAreliable</transportation>\n"
+    "    <order>TimeStamp</order>\n"
+    "   </interactionClass>\n"
+    "  </interactionClass>\n"
+    " </interactions>\n"
+    "</objectModel>\n";
+}
+
+static bool
+writeFile(const std::string& fileName, const std::string& content)
+{
+  std::ofstream stream(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!stream.is_open()) {
+    std::cerr << "Could not write \"" << fileName << "\"!" << std::endl;
+    return false;
+  }
+  stream << content;
+  return true;
+}
+
+static bool
+hasInteractionClass(const OpenRTI::FOMStringModule& module, const std::string& name)
+{
+  for (OpenRTI::FOMStringInteractionClassList::const_iterator i = module.getInteractionClassList().begin();
+       i != module.getInteractionClassList().end(); ++i) {
+    if (!i->getName().empty() && i->getName().back() == name)
+      return true;
+  }
+  return false;
+}
+
+static bool
+testFOMModuleCache(const std::string& fileName)
+{
+  if (!writeFile(fileName, getFDD("InteractionClass0")))
+    return false;
+
+  OpenRTI::FOMStringModule module0;
+  if (!OpenRTI::FOMModuleCache::readFile(module0, OpenRTI::FOMModuleCache::FDD1516EFormat, fileName, std::string()))
+    return false;
+  if (module0.getContentHash().empty() || !hasInteractionClass(module0, "InteractionClass0"))
+    return false;
+
+  // Cached or not, the same file gives the same module
+  OpenRTI::FOMStringModule module1;
+  if (!OpenRTI::FOMModuleCache::readFile(module1, OpenRTI::FOMModuleCache::FDD1516EFormat, fileName, std::string()))
+    return false;
+  if (module1.getContentHash() != module0.getContentHash())
+    return false;
+
+  // Read from a stream, the same content has the same hash
+  std::istringstream stream(getFDD("InteractionClass0"));
+  OpenRTI::FOMStringModule module2 = OpenRTI::FOMModuleCache::read(OpenRTI::FOMModuleCache::FDD1516EFormat, stream, std::string());
+  if (module2.getContentHash() != module0.getContentHash())
+    return false;
+
+  // But not in an other format
+  if (OpenRTI::FOMModuleCache::getContentHash(OpenRTI::FOMModuleCache::FDD1516Format, getFDD("InteractionClass0")) == module0.getContentHash())
+    return false;
+
+  // A changed file is read again
+  if (!writeFile(fileName, getFDD("ChangedInteractionClass0")))
+    return false;
+  OpenRTI::FOMStringModule module3;
+  if (!OpenRTI::FOMModuleCache::readFile(module3, OpenRTI::FOMModuleCache::FDD1516EFormat, fileName, std::string()))
+    return false;
+  if (module3.getContentHash() == module0.getContentHash())
+    return false;
+  if (!hasInteractionClass(module3, "ChangedInteractionClass0")) {
+    std::cerr << "Did not read the changed module!" << std::endl;
+    return false;
+  }
+
+  // Broken files still throw
+  if (!writeFile(fileName, "<objectModel>"))
+    return false;
+  try {
+    OpenRTI::FOMStringModule module4;
+    OpenRTI::FOMModuleCache::readFile(module4, OpenRTI::FOMModuleCache::FDD1516EFormat, fileName, std::string());
+    std::cerr << "Read a broken module!" << std::endl;
+    return false;
+  } catch (const OpenRTI::Exception&) {
+  }
+
+  // Missing files are reported
+  std::remove(fileName.c_str());
+  OpenRTI::FOMStringModule module5;
+  if (OpenRTI::FOMModuleCache::readFile(module5, OpenRTI::FOMModuleCache::FDD1516EFormat, fileName, std::string()))
+    return false;
+
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::string fileName = "fommodulecache.xml";
+  if (1 < argc)
+    fileName = argv[1];
+  bool success = testFOMModuleCache(fileName);
+  std::remove(fileName.c_str());
+  if (!success)
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
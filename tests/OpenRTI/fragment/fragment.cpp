@@ -0,0 +1,271 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "AbstractConnect.h"
+#include "AbstractProtocolSocket.h"
+#include "Message.h"
+#include "MessageEncodingRegistry.h"
+#include "MessageQueue.h"
+#include "Options.h"
+
+// Both ends of an encoding, the messages to write and the messages read
+class OPENRTI_LOCAL Connect : public OpenRTI::AbstractConnect {
+public:
+  Connect() :
+    _writeQueue(new OpenRTI::LocalMessageQueue),
+    _readQueue(new OpenRTI::LocalMessageQueue)
+  {
+    _writeSender = _writeQueue->getMessageSender();
+    _readSender = _readQueue->getMessageSender();
+  }
+  virtual OpenRTI::AbstractMessageSender* getMessageSender()
+  { return _readSender.get(); }
+  virtual OpenRTI::AbstractMessageReceiver* getMessageReceiver()
+  { return _writeQueue.get(); }
+
+  void write(const OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>& message)
+  { _writeSender->send(message); }
+  OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> read()
+  { return _readQueue->receive(); }
+
+private:
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _writeQueue;
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> _readQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _writeSender;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> _readSender;
+};
+
+// A socket pair in memory, that accepts a limited number of bytes per step
+class OPENRTI_LOCAL Pipe : public OpenRTI::AbstractProtocolSocket {
+public:
+  Pipe() :
+    _budget(0),
+    _offset(0),
+    _bytes(0)
+  { }
+
+  virtual ssize_t recv(const OpenRTI::BufferRange& bufferRange, bool)
+  {
+    if (_data.size() <= _offset)
+      return -1;
+    ssize_t bytesRead = 0;
+    OpenRTI::Buffer::byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second && _offset < _data.size()) {
+      size_t size = std::min(i.chunk_size(bufferRange.second), _data.size() - _offset);
+      std::memcpy(i.data(), &_data[_offset], size);
+      _offset += size;
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesRead += size;
+    }
+    if (_offset == _data.size()) {
+      _data.clear();
+      _offset = 0;
+    }
+    return bytesRead;
+  }
+  virtual ssize_t send(const OpenRTI::ConstBufferRange& bufferRange, bool)
+  {
+    ssize_t bytesWritten = 0;
+    OpenRTI::Buffer::const_byte_iterator i = bufferRange.first;
+    i.skip_empty_chunks(bufferRange.second);
+    while (i != bufferRange.second && _budget) {
+      size_t size = std::min(i.chunk_size(bufferRange.second), _budget);
+      const char* data = static_cast<const char*>(i.data());
+      _data.insert(_data.end(), data, data + size);
+      _budget -= size;
+      i += size;
+      i.skip_empty_chunks(bufferRange.second);
+      bytesWritten += size;
+    }
+    _bytes += bytesWritten;
+    return bytesWritten;
+  }
+  virtual void close()
+  { }
+  virtual void replaceProtocol(const OpenRTI::SharedPtr<OpenRTI::AbstractProtocolLayer>&)
+  { }
+
+  void setBudget(size_t budget)
+  { _budget = budget; }
+  uint64_t getBytes() const
+  { return _bytes; }
+
+private:
+  std::vector<char> _data;
+  size_t _budget;
+  size_t _offset;
+  uint64_t _bytes;
+};
+
+// The bytes the pipe transfers per step
+static const size_t PipeStepSize = 16*1024;
+
+struct OPENRTI_LOCAL Result {
+  Result() : _commitBytes(0), _commitSteps(0), _commitFirst(false) { }
+  // Bytes on the wire and pipe steps until the commit was received
+  uint64_t _commitBytes;
+  unsigned _commitSteps;
+  bool _commitFirst;
+};
+
+// Send a large message followed by a commit and a small update through a
+// pipe that transfers a fixed number of bytes per step.
+static bool
+transfer(Result& result, bool enableFragments, unsigned size, bool timeStamped)
+{
+  OpenRTI::SharedPtr<Connect> connect = new Connect;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> writer = OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1");
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageEncoding> reader = OpenRTI::MessageEncodingRegistry::instance().getEncoding("TightBE1");
+  writer->setConnect(connect);
+  writer->setEnableFragmentExtension(enableFragments);
+  reader->setConnect(connect);
+  reader->setEnableFragmentExtension(enableFragments);
+
+  OpenRTI::ParameterValueVector parameterValues(1);
+  parameterValues.back().setParameterHandle(3);
+  parameterValues.back().getValue().resize(size);
+  for (unsigned i = 0; i < size; ++i)
+    parameterValues.back().getValue().charData()[i] = char(i*7);
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessage> bulk;
+  if (timeStamped) {
+    OpenRTI::SharedPtr<OpenRTI::TimeStampedInteractionMessage> message = new OpenRTI::TimeStampedInteractionMessage;
+    message->setInteractionClassHandle(5);
+    message->setOrderType(OpenRTI::TIMESTAMP);
+    message->setTransportationType(OpenRTI::RELIABLE);
+    message->setParameterValues(parameterValues);
+    bulk = message;
+  } else {
+    OpenRTI::SharedPtr<OpenRTI::InteractionMessage> message = new OpenRTI::InteractionMessage;
+    message->setInteractionClassHandle(5);
+    message->setTransportationType(OpenRTI::RELIABLE);
+    message->setParameterValues(parameterValues);
+    bulk = message;
+  }
+  OpenRTI::SharedPtr<OpenRTI::CommitLowerBoundTimeStampMessage> commit = new OpenRTI::CommitLowerBoundTimeStampMessage;
+  commit->setCommitType(OpenRTI::TimeAdvanceCommit);
+  commit->setCommitId(17);
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> update = new OpenRTI::AttributeUpdateMessage;
+  update->setObjectInstanceHandle(11);
+  update->setTransportationType(OpenRTI::RELIABLE);
+
+  connect->write(bulk);
+  connect->write(commit);
+  connect->write(update);
+
+  Pipe pipe;
+  std::vector<OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> > messages;
+  for (unsigned step = 0; messages.size() < 3; ++step) {
+    if (4*size/PipeStepSize + 100 < step) {
+      std::cerr << "Messages did not arrive!" << std::endl;
+      return false;
+    }
+    pipe.setBudget(PipeStepSize);
+    writer->write(pipe);
+    reader->read(pipe);
+    for (;;) {
+      OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = connect->read();
+      if (!message.valid())
+        break;
+      if (*message == *commit) {
+        result._commitBytes = pipe.getBytes();
+        result._commitSteps = step + 1;
+        result._commitFirst = messages.empty();
+      }
+      messages.push_back(message);
+    }
+  }
+
+  // Whatever the order, the messages must arrive unchanged
+  if (*messages.back() != *update) {
+    std::cerr << "Update did not arrive last!" << std::endl;
+    return false;
+  }
+  for (unsigned i = 0; i < 2; ++i) {
+    if (*messages[i] != *bulk && *messages[i] != *commit) {
+      std::cerr << "Corrupt message after transfer!" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned size = 10*1024*1024;
+  OpenRTI::Options options(argc, argv);
+  while (options.next("s:")) {
+    switch (options.getOptChar()) {
+    case 's':
+      size = atoi(options.getArgument().c_str());
+      break;
+    }
+  }
+
+  // Without fragments the commit waits for the whole message
+  Result result;
+  if (!transfer(result, false, size, false))
+    return EXIT_FAILURE;
+  if (result._commitFirst) {
+    std::cerr << "Commit overtook a message without fragments!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "in order: commit after " << result._commitBytes << " bytes, "
+            << result._commitSteps << " steps" << std::endl;
+
+  // With fragments the commit only waits for the fragment in transit
+  if (!transfer(result, true, size, false))
+    return EXIT_FAILURE;
+  if (!result._commitFirst) {
+    std::cerr << "Commit did not overtake the fragmented receive order message!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (size/2 < result._commitBytes) {
+    std::cerr << "Commit still waits for the bulk message!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "fragmented: commit after " << result._commitBytes << " bytes, "
+            << result._commitSteps << " steps" << std::endl;
+
+  // Time stamp order messages must never be overtaken by commits
+  if (!transfer(result, true, size, true))
+    return EXIT_FAILURE;
+  if (result._commitFirst) {
+    std::cerr << "Commit overtook a time stamp order message!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Small messages are not fragmented
+  if (!transfer(result, true, 100, false))
+    return EXIT_FAILURE;
+  if (result._commitFirst) {
+    std::cerr << "Commit overtook a small message!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
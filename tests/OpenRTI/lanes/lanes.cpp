@@ -0,0 +1,188 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "Message.h"
+#include "MessageQueue.h"
+#include "Metrics.h"
+
+static OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>
+createInsert(unsigned objectInstance)
+{
+  OpenRTI::SharedPtr<OpenRTI::InsertObjectInstanceMessage> message = new OpenRTI::InsertObjectInstanceMessage;
+  message->setObjectInstanceHandle(objectInstance);
+  return message;
+}
+
+static OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>
+createDelete(unsigned objectInstance)
+{
+  OpenRTI::SharedPtr<OpenRTI::DeleteObjectInstanceMessage> message = new OpenRTI::DeleteObjectInstanceMessage;
+  message->setObjectInstanceHandle(objectInstance);
+  return message;
+}
+
+// Best effort update, the tag holds the sequence number of the update
+static OpenRTI::SharedPtr<const OpenRTI::AbstractMessage>
+createUpdate(unsigned objectInstance, unsigned sequence)
+{
+  OpenRTI::SharedPtr<OpenRTI::AttributeUpdateMessage> message = new OpenRTI::AttributeUpdateMessage;
+  message->setObjectInstanceHandle(objectInstance);
+  message->setTransportationType(OpenRTI::BEST_EFFORT);
+  message->getTag().setData(&sequence, sizeof(sequence));
+  return message;
+}
+
+static unsigned
+getSequence(const OpenRTI::AttributeUpdateMessage& message)
+{
+  unsigned sequence;
+  std::memcpy(&sequence, message.getTag().data(), sizeof(sequence));
+  return sequence;
+}
+
+// Receives all messages and checks that the messages for each object instance
+// are an optional insert, the updates in sequence and an optional delete
+static bool
+checkOrder(OpenRTI::AbstractMessageQueue& messageQueue, unsigned numUpdates)
+{
+  // The state per object instance, the next expected sequence number or the deleted flag
+  std::map<unsigned, unsigned> sequenceMap;
+  std::map<unsigned, bool> deletedMap;
+  unsigned count = 0;
+  for (;;) {
+    OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = messageQueue.receive();
+    if (!message.valid())
+      break;
+    unsigned objectInstance = message->getObjectInstanceHandleForMessage().getHandle();
+    if (deletedMap[objectInstance]) {
+      std::cerr << "Message for object instance " << objectInstance << " after its delete!" << std::endl;
+      return false;
+    }
+    if (dynamic_cast<const OpenRTI::InsertObjectInstanceMessage*>(message.get())) {
+      if (sequenceMap.find(objectInstance) != sequenceMap.end()) {
+        std::cerr << "Insert of object instance " << objectInstance << " after its updates!" << std::endl;
+        return false;
+      }
+      sequenceMap[objectInstance] = 0;
+    } else if (dynamic_cast<const OpenRTI::DeleteObjectInstanceMessage*>(message.get())) {
+      deletedMap[objectInstance] = true;
+    } else if (const OpenRTI::AttributeUpdateMessage* update = dynamic_cast<const OpenRTI::AttributeUpdateMessage*>(message.get())) {
+      unsigned sequence = getSequence(*update);
+      if (sequence != sequenceMap[objectInstance]) {
+        std::cerr << "Update " << sequence << " of object instance " << objectInstance << " out of order!" << std::endl;
+        return false;
+      }
+      ++sequenceMap[objectInstance];
+      ++count;
+    }
+  }
+  if (count != numUpdates) {
+    std::cerr << "Received " << count << " updates, expected " << numUpdates << "!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Updates do not pass the insert or the delete of their object instance
+static bool
+testInstanceOrder()
+{
+  OpenRTI::SharedPtr<OpenRTI::NetworkMessageQueue> messageQueue = new OpenRTI::NetworkMessageQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> messageSender = messageQueue->getMessageSender();
+
+  // Object instance 1 has best effort updates queued when it is deleted,
+  // object instance 2 is inserted while unrelated best effort updates are queued.
+  messageSender->send(createUpdate(1, 0));
+  messageSender->send(createUpdate(3, 0));
+  messageSender->send(createInsert(2));
+  messageSender->send(createUpdate(2, 0));
+  messageSender->send(createUpdate(1, 1));
+  messageSender->send(createUpdate(2, 1));
+  messageSender->send(createUpdate(3, 1));
+  messageSender->send(createDelete(1));
+  messageSender->send(createUpdate(2, 2));
+  messageSender->send(createUpdate(3, 2));
+
+  return checkOrder(*messageQueue, 8);
+}
+
+// A full best effort lane drops the oldest messages and counts them
+static bool
+testDrop()
+{
+  OpenRTI::SharedPtr<OpenRTI::NetworkMessageQueue> messageQueue = new OpenRTI::NetworkMessageQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> messageSender = messageQueue->getMessageSender();
+
+  unsigned numDrops = 10;
+  unsigned numUpdates = OpenRTI::LaneMessageList::MaxBestEffortSize + numDrops;
+  uint64_t droppedMessages = OpenRTI::Metrics::instance().getDroppedBestEffortMessages().get();
+  for (unsigned i = 0; i < numUpdates; ++i)
+    messageSender->send(createUpdate(1, i));
+
+  droppedMessages = OpenRTI::Metrics::instance().getDroppedBestEffortMessages().get() - droppedMessages;
+  if (droppedMessages != numDrops) {
+    std::cerr << "Dropped " << droppedMessages << " best effort messages, expected " << numDrops << "!" << std::endl;
+    return false;
+  }
+
+  // The oldest ones are gone
+  for (unsigned i = numDrops; i < numUpdates; ++i) {
+    OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = messageQueue->receive();
+    const OpenRTI::AttributeUpdateMessage* update = dynamic_cast<const OpenRTI::AttributeUpdateMessage*>(message.get());
+    if (!update || getSequence(*update) != i) {
+      std::cerr << "Expected best effort update " << i << "!" << std::endl;
+      return false;
+    }
+  }
+  return messageQueue->empty();
+}
+
+// The queues between the threads of a process keep every message
+static bool
+testLocal()
+{
+  OpenRTI::SharedPtr<OpenRTI::LocalMessageQueue> messageQueue = new OpenRTI::LocalMessageQueue;
+  OpenRTI::SharedPtr<OpenRTI::AbstractMessageSender> messageSender = messageQueue->getMessageSender();
+
+  unsigned numUpdates = 2*OpenRTI::LaneMessageList::MaxBestEffortSize;
+  messageSender->send(createInsert(1));
+  for (unsigned i = 0; i < numUpdates; ++i)
+    messageSender->send(createUpdate(1, i));
+  messageSender->send(createDelete(1));
+
+  return checkOrder(*messageQueue, numUpdates);
+}
+
+int
+main(int argc, char* argv[])
+{
+  if (!testInstanceOrder())
+    return EXIT_FAILURE;
+  if (!testDrop())
+    return EXIT_FAILURE;
+  if (!testLocal())
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
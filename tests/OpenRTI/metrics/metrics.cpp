@@ -0,0 +1,95 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <iostream>
+
+#include "AbstractConnect.h"
+#include "Message.h"
+#include "Metrics.h"
+#include "NetworkServer.h"
+
+static bool
+testHistogram()
+{
+  OpenRTI::MetricsHistogram histogram;
+  histogram.record(0);
+  histogram.record(1);
+  histogram.record(2);
+  histogram.record(3);
+  histogram.record(1024);
+  if (histogram.getCount() != 5)
+    return false;
+  if (histogram.getSum() != 1030)
+    return false;
+  if (histogram.getBucket(0) != 1)
+    return false;
+  if (histogram.getBucket(1) != 1)
+    return false;
+  if (histogram.getBucket(2) != 2)
+    return false;
+  if (histogram.getBucket(11) != 1)
+    return false;
+  if (OpenRTI::MetricsHistogram::getBucketIndex(~uint64_t(0)) != OpenRTI::MetricsHistogram::NumBuckets - 1)
+    return false;
+  return true;
+}
+
+static bool
+testMetricsRequest()
+{
+  OpenRTI::NetworkServer networkServer;
+  OpenRTI::SharedPtr<OpenRTI::AbstractConnect> connect;
+  connect = networkServer.sendConnect(OpenRTI::StringStringListMap(), false);
+  if (!connect.valid())
+    return false;
+  if (!connect->getConnectMetrics())
+    return false;
+
+  connect->send(new OpenRTI::MetricsRequestMessage);
+  OpenRTI::SharedPtr<const OpenRTI::AbstractMessage> message = connect->receive();
+  const OpenRTI::MetricsResponseMessage* response;
+  response = dynamic_cast<const OpenRTI::MetricsResponseMessage*>(message.get());
+  if (!response) {
+    std::cerr << "Expected a MetricsResponseMessage!" << std::endl;
+    return false;
+  }
+  if (response->getMetrics().find("\"connects\":[{\"name\":\"ConnectHandle(") == std::string::npos) {
+    std::cerr << "Connect missing in metrics: " << response->getMetrics() << std::endl;
+    return false;
+  }
+
+  if (connect->getConnectMetrics()->getMessagesIn().get() != 1)
+    return false;
+  if (connect->getConnectMetrics()->getMessagesOut().get() != 1)
+    return false;
+
+  connect->close();
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  if (!testHistogram())
+    return EXIT_FAILURE;
+  if (!testMetricsRequest())
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,214 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "Clock.h"
+#include "IntrusiveList.h"
+#include "Options.h"
+#include "TimeStampOrderQueue.h"
+
+// Same key layout than the time management uses
+typedef std::pair<double, int> Key;
+
+struct OPENRTI_LOCAL Event : public OpenRTI::IntrusiveList<Event>::Hook {
+  Event() : _serial(0) { }
+  Key _key;
+  unsigned _serial;
+};
+
+typedef OpenRTI::TimeStampOrderQueue<Key, Event> Queue;
+
+// Small deterministic random number generator
+class Random {
+public:
+  Random(unsigned seed) : _state(seed) { }
+  double uniform()
+  {
+    _state = _state*6364136223846793005ull + 1442695040888963407ull;
+    return (double(_state >> 11) + 0.5)/double(1ull << 53);
+  }
+  // Inter arrival time of a poisson process with the given rate
+  double exponential(double rate)
+  { return -std::log(uniform())/rate; }
+private:
+  uint64_t _state;
+};
+
+static const char*
+getTypeName(Queue::Type type)
+{
+  return type == Queue::HeapType ? "heap" : "map";
+}
+
+// Pops the next event like the time management does, skipping empty lists
+static Event*
+pop(Queue& queue)
+{
+  while (!queue.empty()) {
+    if (queue.frontList().empty()) {
+      queue.popFront();
+      continue;
+    }
+    Event& event = queue.frontList().front();
+    queue.frontList().unlink(event);
+    if (queue.frontList().empty())
+      queue.popFront();
+    return &event;
+  }
+  return 0;
+}
+
+// Check time stamp order and the first in first out order for equal keys
+// including events that are unlinked from the queue before being dispatched.
+static bool
+testOrder(Queue::Type type, bool clustered)
+{
+  Queue queue(type);
+  Random random(17);
+  std::vector<Event> events(10000);
+  double time = 0;
+  unsigned serial = 0;
+  unsigned dispatched = 0;
+  Key lastKey(-1, 0);
+  unsigned lastSerial = 0;
+  for (unsigned i = 0; i < events.size(); ++i) {
+    time += random.exponential(1);
+    events[i]._key = Key(clustered ? std::floor(time*0.1) : time, random.uniform() < 0.1);
+    // Messages cannot be queued into the past
+    if (events[i]._key < lastKey)
+      events[i]._key = lastKey;
+    events[i]._serial = ++serial;
+    queue.push(events[i]._key, events[i]);
+    // Arbitrary removal, like for deleted object instances
+    if (random.uniform() < 0.05) {
+      Event& event = events[unsigned(random.uniform()*i)];
+      Queue::List::unlink(event);
+    }
+    // The snapshot of the queue must see the lists in dispatch order
+    if (i % 1000 == 999) {
+      Queue::KeyListPairVector keyListPairVector;
+      queue.getKeyListPairVector(keyListPairVector);
+      for (unsigned j = 1; j < keyListPairVector.size(); ++j) {
+        if (keyListPairVector[j].first < keyListPairVector[j - 1].first) {
+          std::cerr << "Out of order snapshot of " << getTypeName(type) << " queue!" << std::endl;
+          return false;
+        }
+      }
+    }
+    // Dispatch some of them
+    while (random.uniform() < 0.4) {
+      Event* event = pop(queue);
+      if (!event)
+        break;
+      if (event->_key < lastKey || (event->_key == lastKey && event->_serial < lastSerial)) {
+        std::cerr << "Out of order event in " << getTypeName(type) << " queue!" << std::endl;
+        return false;
+      }
+      lastKey = event->_key;
+      lastSerial = event->_serial;
+      ++dispatched;
+    }
+  }
+  while (Event* event = pop(queue)) {
+    if (event->_key < lastKey || (event->_key == lastKey && event->_serial < lastSerial)) {
+      std::cerr << "Out of order event in " << getTypeName(type) << " queue!" << std::endl;
+      return false;
+    }
+    lastKey = event->_key;
+    lastSerial = event->_serial;
+    ++dispatched;
+  }
+  if (!queue.empty())
+    return false;
+  if (dispatched == 0 || events.size() < dispatched)
+    return false;
+  return true;
+}
+
+// The classic hold model: keep a population of pending events, pop the
+// earliest one and schedule a new one a poisson distributed time later.
+// Clustered time stamps model a fixed step federation instead, where each
+// event is rescheduled exactly one step later.
+static double
+benchmark(Queue::Type type, unsigned population, unsigned operations, bool clustered)
+{
+  Queue queue(type);
+  Random random(23);
+  std::vector<Event> events(population);
+  double time = 0;
+  for (unsigned i = 0; i < population; ++i) {
+    time += random.exponential(1);
+    events[i]._key = Key(clustered ? std::ceil(time*0.01) : time, -1);
+    queue.push(events[i]._key, events[i]);
+  }
+
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < operations; ++i) {
+    Event* event = pop(queue);
+    if (clustered)
+      event->_key.first += 1;
+    else
+      event->_key.first += random.exponential(1.0/population);
+    queue.push(event->_key, *event);
+  }
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+  queue.unlink();
+  return double((stop - start).getNSec())/operations;
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned population = 1000;
+  unsigned operations = 100000;
+  OpenRTI::Options options(argc, argv);
+  while (options.next("n:p:")) {
+    switch (options.getOptChar()) {
+    case 'n':
+      operations = atoi(options.getArgument().c_str());
+      break;
+    case 'p':
+      population = atoi(options.getArgument().c_str());
+      break;
+    }
+  }
+
+  Queue::Type types[] = { Queue::MapType, Queue::HeapType };
+  for (unsigned i = 0; i < 2; ++i) {
+    if (!testOrder(types[i], false))
+      return EXIT_FAILURE;
+    if (!testOrder(types[i], true))
+      return EXIT_FAILURE;
+  }
+
+  for (unsigned i = 0; i < 2; ++i) {
+    for (unsigned clustered = 0; clustered < 2; ++clustered) {
+      double nsec = benchmark(types[i], population, operations, clustered);
+      std::cout << getTypeName(types[i]) << (clustered ? " clustered" : "") << ": population " << population
+                << ", " << nsec << " nsec per hold operation" << std::endl;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
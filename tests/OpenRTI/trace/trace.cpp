@@ -0,0 +1,96 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "Message.h"
+#include "MessageTrace.h"
+
+static bool
+testMessageTrace(const std::string& traceFile)
+{
+  // Nothing is traced unless enabled
+  OpenRTI::MessageTrace::setTraceFile(std::string());
+  if (OpenRTI::MessageTrace::getEnabled())
+    return false;
+  if (OpenRTI::MessageTrace::create())
+    return false;
+
+  OpenRTI::MessageTrace::setTraceFile(traceFile);
+  if (!OpenRTI::MessageTrace::getEnabled()) {
+    std::cerr << "Could not enable tracing into \"" << traceFile << "\"!" << std::endl;
+    return false;
+  }
+
+  OpenRTI::SharedPtr<OpenRTI::InteractionMessage> message = new OpenRTI::InteractionMessage;
+  message->setMessageTrace(OpenRTI::MessageTrace::create());
+  if (!message->getMessageTrace())
+    return false;
+  message->stampMessageTrace(OpenRTI::MessageTrace::RoutePoint);
+
+  // Routed copies continue on their own
+  OpenRTI::SharedPtr<OpenRTI::InteractionMessage> baseMessage = new OpenRTI::InteractionMessage;
+  baseMessage->copyMessageTrace(*message);
+  if (!baseMessage->getMessageTrace() || baseMessage->getMessageTrace() == message->getMessageTrace())
+    return false;
+  if (baseMessage->getMessageTrace()->getTraceId() != message->getMessageTrace()->getTraceId())
+    return false;
+  baseMessage->stampMessageTrace(OpenRTI::MessageTrace::RoutePoint);
+  if (message->getMessageTrace()->getStampVector().size() != 2)
+    return false;
+  if (baseMessage->getMessageTrace()->getStampVector().size() != 3)
+    return false;
+
+  message->writeMessageTrace();
+  OpenRTI::MessageTrace::setTraceFile(std::string());
+  if (OpenRTI::MessageTrace::getEnabled())
+    return false;
+
+  std::ifstream stream(traceFile.c_str());
+  std::stringstream content;
+  content << stream.rdbuf();
+  if (content.str().find("{\"name\":\"send->route\",\"cat\":\"InteractionMessage\",\"ph\":\"X\"") == std::string::npos) {
+    std::cerr << "Missing send to route step in trace: " << content.str() << std::endl;
+    return false;
+  }
+  if (content.str().find("{\"name\":\"route->dispatch\"") == std::string::npos) {
+    std::cerr << "Missing route to dispatch step in trace: " << content.str() << std::endl;
+    return false;
+  }
+  if (content.str()[content.str().find_last_not_of("\n")] != ']')
+    return false;
+  return true;
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::string traceFile = "trace.json";
+  if (1 < argc)
+    traceFile = argv[1];
+  bool success = testMessageTrace(traceFile);
+  std::remove(traceFile.c_str());
+  if (!success)
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,360 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <Options.h>
+#include <StringUtils.h>
+
+#include <RTI13TestLib.h>
+
+namespace OpenRTI {
+
+typedef std::map<RTI::Handle, std::string> HandleStringMap;
+
+// A value set implemented by the application, the ambassador can only copy these values
+template<typename T>
+class OPENRTI_LOCAL ApplicationValueSet : public T {
+public:
+  virtual RTI::ULong size() const
+  { return RTI::ULong(_handleValueVector.size()); }
+  virtual RTI::Handle getHandle(RTI::ULong index) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+  { return _at(index).first; }
+  virtual RTI::ULong getValueLength(RTI::ULong index) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+  { return RTI::ULong(_at(index).second.size()); }
+  virtual void getValue(RTI::ULong index, char* data, RTI::ULong& length) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+  {
+    length = getValueLength(index);
+    std::memcpy(data, _at(index).second.data(), length);
+  }
+  virtual char* getValuePointer(RTI::ULong index, RTI::ULong& length) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+  {
+    length = getValueLength(index);
+    return const_cast<char*>(_at(index).second.data());
+  }
+  virtual void add(RTI::Handle handle, const char* data, RTI::ULong length)
+    RTI_THROW ((RTI::ValueLengthExceeded, RTI::ValueCountExceeded))
+  { _handleValueVector.push_back(std::make_pair(handle, std::string(data, length))); }
+  virtual void remove(RTI::Handle handle)
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds))
+  {
+    for (typename HandleValueVector::iterator i = _handleValueVector.begin(); i != _handleValueVector.end(); ++i) {
+      if (i->first != handle)
+        continue;
+      _handleValueVector.erase(i);
+      return;
+    }
+    throw RTI::ArrayIndexOutOfBounds("Handle not in the value set!");
+  }
+  virtual void empty()
+  { _handleValueVector.clear(); }
+  virtual RTI::ULong start() const
+  { return 0; }
+  virtual RTI::ULong valid(RTI::ULong i) const
+  { return i < size(); }
+  virtual RTI::ULong next(RTI::ULong i) const
+  { return i + 1; }
+
+private:
+  typedef std::vector<std::pair<RTI::Handle, std::string> > HandleValueVector;
+
+  const std::pair<RTI::Handle, std::string>& _at(RTI::ULong index) const
+  {
+    if (_handleValueVector.size() <= index)
+      throw RTI::ArrayIndexOutOfBounds("Array Index out of bounds!");
+    return _handleValueVector[index];
+  }
+
+  HandleValueVector _handleValueVector;
+};
+
+class OPENRTI_LOCAL ApplicationAttributeSet : public ApplicationValueSet<RTI::AttributeHandleValuePairSet> {
+public:
+  virtual RTI::TransportType getTransportType(RTI::ULong) const
+    RTI_THROW ((RTI::InvalidHandleValuePairSetContext))
+  { throw RTI::InvalidHandleValuePairSetContext("Not a received value set!"); }
+  virtual RTI::OrderType getOrderType(RTI::ULong) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds, RTI::InvalidHandleValuePairSetContext))
+  { throw RTI::InvalidHandleValuePairSetContext("Not a received value set!"); }
+  virtual RTI::Region* getRegion(RTI::ULong) const
+    RTI_THROW ((RTI::ArrayIndexOutOfBounds, RTI::InvalidHandleValuePairSetContext))
+  { throw RTI::InvalidHandleValuePairSetContext("Not a received value set!"); }
+  virtual void moveFrom(const RTI::AttributeHandleValuePairSet&, RTI::ULong&)
+    RTI_THROW ((RTI::ValueCountExceeded, RTI::ArrayIndexOutOfBounds))
+  { throw RTI::ValueCountExceeded("Not implemented!"); }
+};
+
+class OPENRTI_LOCAL ApplicationParameterSet : public ApplicationValueSet<RTI::ParameterHandleValuePairSet> {
+public:
+  virtual RTI::TransportType getTransportType() const
+    RTI_THROW ((RTI::InvalidHandleValuePairSetContext))
+  { throw RTI::InvalidHandleValuePairSetContext("Not a received value set!"); }
+  virtual RTI::OrderType getOrderType() const
+    RTI_THROW ((RTI::InvalidHandleValuePairSetContext))
+  { throw RTI::InvalidHandleValuePairSetContext("Not a received value set!"); }
+  virtual RTI::Region* getRegion() const
+    RTI_THROW ((RTI::InvalidHandleValuePairSetContext))
+  { throw RTI::InvalidHandleValuePairSetContext("Not a received value set!"); }
+  virtual void moveFrom(const RTI::ParameterHandleValuePairSet&, RTI::ULong&)
+    RTI_THROW ((RTI::ValueCountExceeded, RTI::ArrayIndexOutOfBounds))
+  { throw RTI::ValueCountExceeded("Not implemented!"); }
+};
+
+template<typename T>
+static HandleStringMap
+toHandleStringMap(const T& valueSet)
+{
+  HandleStringMap handleStringMap;
+  for (RTI::ULong i = 0; i < valueSet.size(); ++i) {
+    std::vector<char> value(valueSet.getValueLength(i) + 1);
+    RTI::ULong length;
+    valueSet.getValue(i, &value.front(), length);
+    handleStringMap[valueSet.getHandle(i)] = std::string(&value.front(), length);
+  }
+  return handleStringMap;
+}
+
+class OPENRTI_LOCAL ValueSetAmbassador : public RTI13SimpleAmbassador {
+public:
+  ValueSetAmbassador() :
+    _objectHandle(0),
+    _discovered(false),
+    _reflectCount(0),
+    _receiveCount(0)
+  { }
+
+  virtual void discoverObjectInstance(RTI::ObjectHandle objectHandle, RTI::ObjectClassHandle, const char*)
+    RTI_THROW ((RTI::CouldNotDiscover,
+           RTI::ObjectClassNotKnown,
+           RTI::FederateInternalError))
+  {
+    _objectHandle = objectHandle;
+    _discovered = true;
+  }
+
+  virtual void reflectAttributeValues(RTI::ObjectHandle, const RTI::AttributeHandleValuePairSet& attributeHandleValuePairSet, const char*)
+    RTI_THROW ((RTI::ObjectNotKnown,
+           RTI::AttributeNotKnown,
+           RTI::FederateOwnsAttributes,
+           RTI::FederateInternalError))
+  {
+    _values = toHandleStringMap(attributeHandleValuePairSet);
+    ++_reflectCount;
+  }
+
+  virtual void receiveInteraction(RTI::InteractionClassHandle, const RTI::ParameterHandleValuePairSet& parameterHandleValuePairSet,
+                                  const char*)
+    RTI_THROW ((RTI::InteractionClassNotKnown,
+           RTI::InteractionParameterNotKnown,
+           RTI::FederateInternalError))
+  {
+    _values = toHandleStringMap(parameterHandleValuePairSet);
+    ++_receiveCount;
+  }
+
+  bool waitFor(const unsigned& count, unsigned expected)
+  {
+    Clock timeout = Clock::now() + Clock::fromSeconds(10);
+    while (count < expected) {
+      evokeCallback(0.1);
+      if (timeout < Clock::now())
+        return false;
+    }
+    return true;
+  }
+
+  RTI::ObjectHandle _objectHandle;
+  bool _discovered;
+  unsigned _reflectCount;
+  unsigned _receiveCount;
+  HandleStringMap _values;
+};
+
+static bool
+checkValues(const HandleStringMap& values, RTI::Handle handle0, RTI::Handle handle1, const std::string& prefix)
+{
+  HandleStringMap::const_iterator i = values.find(handle0);
+  if (i == values.end() || i->second != prefix + "0")
+    return false;
+  i = values.find(handle1);
+  if (i == values.end() || i->second != prefix + "1")
+    return false;
+  return values.size() == 2;
+}
+
+static bool
+test(const std::string& federationExecutionName, const std::string& fddFile)
+{
+  RTI13SimpleAmbassador publisher;
+  publisher.connect(std::vector<std::string>());
+  ValueSetAmbassador subscriber;
+  subscriber.connect(std::vector<std::string>());
+
+  publisher.createFederationExecution(federationExecutionName, fddFile);
+  publisher.joinFederationExecution("publisher", federationExecutionName);
+  subscriber.joinFederationExecution("subscriber", federationExecutionName);
+
+  RTI::ObjectClassHandle objectClassHandle = publisher.getObjectClassHandle("ObjectClass");
+  RTI::AttributeHandle attributeHandle0 = publisher.getAttributeHandle(objectClassHandle, "Attribute0");
+  RTI::AttributeHandle attributeHandle1 = publisher.getAttributeHandle(objectClassHandle, "Attribute1");
+  RTI_UNIQUE_PTR<RTI::AttributeHandleSet> attributeHandleSet(RTI::AttributeHandleSetFactory::create(2));
+  attributeHandleSet->add(attributeHandle0);
+  attributeHandleSet->add(attributeHandle1);
+  RTI::InteractionClassHandle interactionClassHandle = publisher.getInteractionClassHandle("InteractionClass");
+  RTI::ParameterHandle parameterHandle0 = publisher.getParameterHandle(interactionClassHandle, "Parameter0");
+  RTI::ParameterHandle parameterHandle1 = publisher.getParameterHandle(interactionClassHandle, "Parameter1");
+
+  publisher.publishObjectClass(objectClassHandle, *attributeHandleSet);
+  publisher.publishInteractionClass(interactionClassHandle);
+  subscriber.subscribeObjectClassAttributes(objectClassHandle, *attributeHandleSet);
+  subscriber.subscribeInteractionClass(interactionClassHandle);
+
+  RTI::ObjectHandle objectHandle = publisher.registerObjectInstance(objectClassHandle);
+  Clock timeout = Clock::now() + Clock::fromSeconds(10);
+  while (!subscriber._discovered) {
+    subscriber.evokeCallback(0.1);
+    if (timeout < Clock::now()) {
+      std::cout << "Timeout waiting for object instance discovery!" << std::endl;
+      return false;
+    }
+  }
+  if (subscriber._objectHandle != objectHandle) {
+    std::cout << "Discovered the wrong object instance!" << std::endl;
+    return false;
+  }
+
+  // The values of the implementation sets are passed on without copying them.
+  // Writing through getValuePointer after sending must not change what was sent.
+  {
+    RTI_UNIQUE_PTR<RTI::AttributeHandleValuePairSet> attributeValues(RTI::AttributeSetFactory::create(2));
+    attributeValues->add(attributeHandle0, "implementation0", 15);
+    attributeValues->add(attributeHandle1, "implementation1", 15);
+    publisher.updateAttributeValues(objectHandle, *attributeValues, "");
+    RTI::ULong length;
+    attributeValues->getValuePointer(0, length)[0] = 'X';
+    if (!subscriber.waitFor(subscriber._reflectCount, 1)) {
+      std::cout << "Timeout waiting for attribute reflection!" << std::endl;
+      return false;
+    }
+    if (!checkValues(subscriber._values, attributeHandle0, attributeHandle1, "implementation")) {
+      std::cout << "Wrong values reflected from an implementation attribute set!" << std::endl;
+      return false;
+    }
+    if (toHandleStringMap(*attributeValues)[attributeHandle0] != "Xmplementation0") {
+      std::cout << "Value written through getValuePointer is lost!" << std::endl;
+      return false;
+    }
+  }
+  {
+    RTI_UNIQUE_PTR<RTI::ParameterHandleValuePairSet> parameterValues(RTI::ParameterSetFactory::create(2));
+    parameterValues->add(parameterHandle0, "implementation0", 15);
+    parameterValues->add(parameterHandle1, "implementation1", 15);
+    publisher.sendInteraction(interactionClassHandle, *parameterValues, "");
+    RTI::ULong length;
+    parameterValues->getValuePointer(0, length)[0] = 'X';
+    if (!subscriber.waitFor(subscriber._receiveCount, 1)) {
+      std::cout << "Timeout waiting for interaction!" << std::endl;
+      return false;
+    }
+    if (!checkValues(subscriber._values, parameterHandle0, parameterHandle1, "implementation")) {
+      std::cout << "Wrong values received from an implementation parameter set!" << std::endl;
+      return false;
+    }
+  }
+
+  // Sets of the application are copied through getValuePointer
+  {
+    ApplicationAttributeSet attributeValues;
+    attributeValues.add(attributeHandle0, "application0", 12);
+    attributeValues.add(attributeHandle1, "application1", 12);
+    publisher.updateAttributeValues(objectHandle, attributeValues, "");
+    if (!subscriber.waitFor(subscriber._reflectCount, 2)) {
+      std::cout << "Timeout waiting for attribute reflection!" << std::endl;
+      return false;
+    }
+    if (!checkValues(subscriber._values, attributeHandle0, attributeHandle1, "application")) {
+      std::cout << "Wrong values reflected from an application attribute set!" << std::endl;
+      return false;
+    }
+  }
+  {
+    ApplicationParameterSet parameterValues;
+    parameterValues.add(parameterHandle0, "application0", 12);
+    parameterValues.add(parameterHandle1, "application1", 12);
+    publisher.sendInteraction(interactionClassHandle, parameterValues, "");
+    if (!subscriber.waitFor(subscriber._receiveCount, 2)) {
+      std::cout << "Timeout waiting for interaction!" << std::endl;
+      return false;
+    }
+    if (!checkValues(subscriber._values, parameterHandle0, parameterHandle1, "application")) {
+      std::cout << "Wrong values received from an application parameter set!" << std::endl;
+      return false;
+    }
+  }
+
+  subscriber.resignFederationExecution(RTI::NO_ACTION);
+  publisher.resignFederationExecution(RTI::DELETE_OBJECTS);
+  publisher.destroyFederationExecution(federationExecutionName);
+
+  return true;
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::string federationExecutionName("thread://valueset");
+  std::string fullPathNameToTheFDDfile("fdd.fed");
+
+  OpenRTI::Options options(argc, argv);
+  while (options.next("F:O:")) {
+    switch (options.getOptChar()) {
+    case 'F':
+      federationExecutionName = options.getArgument();
+      break;
+    case 'O':
+      fullPathNameToTheFDDfile = options.getArgument();
+      break;
+    }
+  }
+
+  try {
+    if (!OpenRTI::test(federationExecutionName, fullPathNameToTheFDDfile))
+      return EXIT_FAILURE;
+  } catch (const RTI::Exception& e) {
+    std::cout << "RTI::Exception: \"" << e._reason << "\"" << std::endl;
+    return EXIT_FAILURE;
+  } catch (...) {
+    std::cout << "Unknown Exception!" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,154 @@
+# -*-python-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+#
+# This file is part of OpenRTI.
+#
+# OpenRTI is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 2.1 of the License, or
+# (at your option) any later version.
+#
+# OpenRTI is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+# Buffer views and batched delivery of the reflections in the python bindings.
+
+import sys
+import time
+import rti1516e
+
+class FederateAmbassador(object):
+    def __init__(self):
+        self.objectInstanceHandle = None
+        self.values = []
+
+    def discoverObjectInstance(self, objectInstanceHandle, *args):
+        self.objectInstanceHandle = objectInstanceHandle
+
+    def reflectAttributeValues(self, objectInstanceHandle, attributeValues, tag, *args):
+        self.values.extend(attributeValues.values())
+
+# Takes the reflections as lists, raises on the first batch if asked to
+class BatchFederateAmbassador(FederateAmbassador):
+    def __init__(self):
+        FederateAmbassador.__init__(self)
+        self.batchSizes = []
+        self.failedValues = None
+
+    def reflectAttributeValuesBatch(self, batch):
+        values = []
+        for args in batch:
+            values.extend(args[1].values())
+        self.batchSizes.append(len(batch))
+        if self.failedValues is None:
+            self.failedValues = values
+            raise RuntimeError("Failing callback batch")
+        self.values.extend(values)
+
+class TestFailure(Exception):
+    pass
+
+def evokeUntil(ambassador, condition):
+    timeout = time.time() + 10
+    while not condition():
+        ambassador.evokeMultipleCallbacks(0.1, 0.2)
+        if timeout < time.time():
+            raise TestFailure("Timeout waiting for callbacks!")
+
+class Federate(object):
+    def __init__(self, federateAmbassador, fddFile):
+        self.federateAmbassador = federateAmbassador
+        self.ambassador = rti1516e.RTIambassador()
+        self.ambassador.connect(federateAmbassador, "HLA_EVOKED", "thread://")
+        try:
+            self.ambassador.createFederationExecution("python", fddFile)
+        except rti1516e.FederationExecutionAlreadyExists:
+            pass
+        self.ambassador.joinFederationExecution("python", "python")
+        self.objectClassHandle = self.ambassador.getObjectClassHandle("ObjectClass")
+        self.attributeHandle = self.ambassador.getAttributeHandle(self.objectClassHandle, "Attribute0")
+
+    def resign(self):
+        self.ambassador.resignFederationExecution(rti1516e.NO_ACTION)
+        try:
+            self.ambassador.destroyFederationExecution("python")
+        except rti1516e.FederatesCurrentlyJoined:
+            pass
+        self.ambassador.disconnect()
+
+def update(publisher, objectInstanceHandle, value):
+    publisher.ambassador.updateAttributeValues(objectInstanceHandle, { publisher.attributeHandle : value }, bytearray())
+
+def testBufferViews(publisher, objectInstanceHandle, subscriber):
+    subscriber.ambassador.enableBufferViews()
+    update(publisher, objectInstanceHandle, b"view")
+    evokeUntil(subscriber.ambassador, lambda: len(subscriber.federateAmbassador.values) == 1)
+    value = subscriber.federateAmbassador.values.pop()
+    if 3 <= sys.version_info[0] and not isinstance(value, memoryview):
+        raise TestFailure("Expected a memoryview, got %s!" % type(value))
+    if bytes(value) != b"view":
+        raise TestFailure("Wrong value seen through the buffer view!")
+    value.release()
+
+    subscriber.ambassador.disableBufferViews()
+    update(publisher, objectInstanceHandle, b"copy")
+    evokeUntil(subscriber.ambassador, lambda: len(subscriber.federateAmbassador.values) == 1)
+    value = subscriber.federateAmbassador.values.pop()
+    if not isinstance(value, bytearray):
+        raise TestFailure("Expected a bytearray, got %s!" % type(value))
+    if bytes(value) != b"copy":
+        raise TestFailure("Wrong value seen in the copy!")
+
+def testBatching(publisher, objectInstanceHandle, subscriber):
+    subscriber.ambassador.enableCallbackBatching(4)
+    sent = [("%03d" % i).encode() for i in range(20)]
+    for value in sent:
+        update(publisher, objectInstanceHandle, value)
+
+    # The first batch raises out of the evoke call, the batch is dropped
+    timeout = time.time() + 10
+    while subscriber.federateAmbassador.failedValues is None:
+        try:
+            subscriber.ambassador.evokeMultipleCallbacks(0.1, 0.2)
+        except RuntimeError:
+            pass
+        if timeout < time.time():
+            raise TestFailure("Timeout waiting for callbacks!")
+
+    failed = [bytes(value) for value in subscriber.federateAmbassador.failedValues]
+    evokeUntil(subscriber.ambassador, lambda: len(failed) + len(subscriber.federateAmbassador.values) == len(sent))
+
+    received = [bytes(value) for value in subscriber.federateAmbassador.values]
+    if failed + received != sent:
+        raise TestFailure("Dropped callback batch reappeared or reflections out of order!")
+    if max(subscriber.federateAmbassador.batchSizes) > 4:
+        raise TestFailure("Callback batch exceeds the maximum batch size!")
+    subscriber.ambassador.disableCallbackBatching()
+
+def main(fddFile):
+    publisher = Federate(FederateAmbassador(), fddFile)
+    subscriber = Federate(BatchFederateAmbassador(), fddFile)
+    subscriber.ambassador.subscribeObjectClassAttributes(subscriber.objectClassHandle, [subscriber.attributeHandle])
+    publisher.ambassador.publishObjectClassAttributes(publisher.objectClassHandle, [publisher.attributeHandle])
+    objectInstanceHandle = publisher.ambassador.registerObjectInstance(publisher.objectClassHandle)
+    evokeUntil(subscriber.ambassador, lambda: subscriber.federateAmbassador.objectInstanceHandle is not None)
+
+    try:
+        # Without batching the single callbacks are delivered
+        testBufferViews(publisher, objectInstanceHandle, subscriber)
+        testBatching(publisher, objectInstanceHandle, subscriber)
+    finally:
+        subscriber.resign()
+        publisher.resign()
+
+if __name__ == "__main__":
+    try:
+        main(sys.argv[1])
+    except TestFailure as e:
+        sys.stderr.write("%s\n" % e)
+        sys.exit(1)
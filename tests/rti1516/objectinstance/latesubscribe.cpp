@@ -0,0 +1,175 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <cstdlib>
+#include <string>
+#include <memory>
+#include <vector>
+#include <iostream>
+
+#include <Clock.h>
+#include <LogStream.h>
+#include <Options.h>
+#include <StringUtils.h>
+
+#include <RTI1516TestLib.h>
+
+namespace OpenRTI {
+
+// Each federate registers a lot of object instances before anybody subscribes.
+// The late subscription then needs to discover all of the object instances
+// of the other federates at once.
+class OPENRTI_LOCAL TestAmbassador : public RTI1516TestAmbassador {
+public:
+  TestAmbassador(const RTITest::ConstructorArgs& constructorArgs, unsigned numObjectInstances) :
+    RTI1516TestAmbassador(constructorArgs),
+    _numObjectInstances(numObjectInstances),
+    _fail(false)
+  { }
+  virtual ~TestAmbassador()
+    RTI_NOEXCEPT
+  { }
+
+  virtual bool execJoined(rti1516::RTIambassador& ambassador)
+  {
+    _foreignObjectInstanceHandles.clear();
+    std::vector<rti1516::ObjectInstanceHandle> objectInstanceHandles;
+
+    try {
+      _objectClassHandle = ambassador.getObjectClassHandle(L"ObjectClass0");
+      rti1516::AttributeHandleSet attributeHandleSet;
+      attributeHandleSet.insert(ambassador.getAttributeHandle(_objectClassHandle, L"attribute0"));
+      ambassador.publishObjectClassAttributes(_objectClassHandle, attributeHandleSet);
+
+      for (unsigned i = 0; i < _numObjectInstances; ++i)
+        objectInstanceHandles.push_back(ambassador.registerObjectInstance(_objectClassHandle));
+
+      if (!waitForAllFederates(ambassador))
+        return false;
+
+      Clock start = Clock::now();
+      ambassador.subscribeObjectClassAttributes(_objectClassHandle, attributeHandleSet);
+
+      size_t expectedObjectInstances = (getFederateList().size() - 1)*_numObjectInstances;
+      Clock timeout = Clock::now() + Clock::fromSeconds(60);
+      while (_foreignObjectInstanceHandles.size() < expectedObjectInstances && !_fail) {
+        if (ambassador.evokeCallback(1.0))
+          continue;
+        if (timeout < Clock::now()) {
+          std::wcout << L"Timeout waiting for discoverObjectInstance, got " << _foreignObjectInstanceHandles.size()
+                     << L" of " << expectedObjectInstances << std::endl;
+          return false;
+        }
+      }
+      if (_fail)
+        return false;
+      if (getFederateList().front() == getFederateType())
+        std::cout << "Discovered " << expectedObjectInstances << " object instances in "
+                  << (Clock::now() - start).getNSec()*1e-9 << " seconds" << std::endl;
+
+      if (!waitForAllFederates(ambassador))
+        return false;
+
+      ambassador.unsubscribeObjectClass(_objectClassHandle);
+
+      if (!waitForAllFederates(ambassador))
+        return false;
+
+      for (std::vector<rti1516::ObjectInstanceHandle>::const_iterator i = objectInstanceHandles.begin();
+           i != objectInstanceHandles.end(); ++i)
+        ambassador.deleteObjectInstance(*i, toVariableLengthData("tag"));
+      ambassador.unpublishObjectClass(_objectClassHandle);
+
+      if (!waitForAllFederates(ambassador))
+        return false;
+
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    return !_fail;
+  }
+
+  void discoverObjectInstance(rti1516::ObjectInstanceHandle objectInstanceHandle,
+                              rti1516::ObjectClassHandle objectClassHandle,
+                              const std::wstring& objectInstanceName)
+      RTI_THROW ((rti1516::CouldNotDiscover,
+             rti1516::ObjectClassNotKnown,
+             rti1516::FederateInternalError))
+  {
+    if (_objectClassHandle != objectClassHandle) {
+      Log(Assert, Error) << "Expected object class " << _objectClassHandle.toString()
+                         << ", but discovered object class "  << objectClassHandle.toString() << std::endl;
+      _fail = true;
+    }
+    if (!_foreignObjectInstanceHandles.insert(objectInstanceHandle).second) {
+      Log(Assert, Error) << "Duplicate discoverObjectInstance callback for object instance "
+                         << objectInstanceHandle.toString() << std::endl;
+      _fail = true;
+    }
+  }
+
+private:
+  unsigned _numObjectInstances;
+  bool _fail;
+
+  rti1516::ObjectClassHandle _objectClassHandle;
+  std::set<rti1516::ObjectInstanceHandle> _foreignObjectInstanceHandles;
+};
+
+class OPENRTI_LOCAL Test : public RTITest {
+public:
+  Test(int argc, const char* const argv[]) :
+    RTITest(argc, argv, false),
+    _numObjectInstances(1100)
+  {
+    insertOptionString("N:");
+  }
+
+  virtual bool processOption(char optchar, const std::string& argument)
+  {
+    switch (optchar) {
+    case 'N':
+      _numObjectInstances = atoi(argument.c_str());
+      return true;
+    default:
+      return RTITest::processOption(optchar, argument);
+    }
+  }
+
+  virtual Ambassador* createAmbassador(const ConstructorArgs& constructorArgs)
+  {
+    return new TestAmbassador(constructorArgs, _numObjectInstances);
+  }
+
+private:
+  unsigned _numObjectInstances;
+};
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::Test test(argc, argv);
+  return test.exec();
+}
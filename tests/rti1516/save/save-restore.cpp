@@ -0,0 +1,427 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <memory>
+#include <vector>
+#include <iostream>
+
+#include <RTI/HLAinteger64Time.h>
+#include <RTI/HLAinteger64Interval.h>
+
+#include <Clock.h>
+#include <FederationSnapshot.h>
+#include <Options.h>
+#include <StringUtils.h>
+
+#include <RTI1516TestLib.h>
+
+namespace OpenRTI {
+
+// Each federate sends a time stamped interaction, then the federation is saved
+// with these interactions still pending in the time stamp order queues.
+// After advancing past the interactions the federation is restored. Every federate
+// must then be back at the saved logical time and receive the same interactions again.
+class OPENRTI_LOCAL TestAmbassador : public RTI1516TestAmbassador {
+public:
+  TestAmbassador(const RTITest::ConstructorArgs& constructorArgs) :
+    RTI1516TestAmbassador(constructorArgs),
+    _saveTime(10),
+    _sendTime(15),
+    _endTime(20),
+    _numReceived(0),
+    _timeRegulationEnabled(false),
+    _timeConstrainedEnabled(false),
+    _timeAdvancePending(false),
+    _saveInitiated(false),
+    _federationSaved(false),
+    _restoreRequestSucceeded(false),
+    _restoreInitiated(false),
+    _federationRestored(false),
+    _restoreRequestFailExpected(false),
+    _restoreRequestFailed(false),
+    _fail(false)
+  { }
+  virtual ~TestAmbassador()
+    RTI_NOEXCEPT
+  { }
+
+  virtual bool execJoined(rti1516::RTIambassador& ambassador)
+  {
+    _numReceived = 0;
+    _timeRegulationEnabled = false;
+    _timeConstrainedEnabled = false;
+    _timeAdvancePending = false;
+
+    bool first = getFederateList().front() == getFederateType();
+    unsigned numExpected = unsigned(getFederateList().size() - 1);
+    std::wstring label = L"save-restore";
+
+    try {
+      _interactionClassHandle = ambassador.getInteractionClassHandle(L"InteractionClass0");
+      _parameterHandle = ambassador.getParameterHandle(_interactionClassHandle, L"parameter0");
+
+      ambassador.enableTimeRegulation(HLAinteger64Interval(1));
+      if (!waitFor(ambassador, _timeRegulationEnabled))
+        return false;
+      ambassador.enableTimeConstrained();
+      if (!waitFor(ambassador, _timeConstrainedEnabled))
+        return false;
+
+      ambassador.subscribeInteractionClass(_interactionClassHandle);
+      ambassador.publishInteractionClass(_interactionClassHandle);
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    try {
+      if (!advance(ambassador, _saveTime))
+        return false;
+
+      rti1516::ParameterHandleValueMap parameterValues;
+      parameterValues[_parameterHandle] = toVariableLengthData(getFederateType());
+      ambassador.sendInteraction(_interactionClassHandle, parameterValues, rti1516::VariableLengthData(), _sendTime);
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    // Now all interactions are queued at the receivers
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    // Save the federation
+    _saveInitiated = false;
+    _federationSaved = false;
+    try {
+      if (first)
+        ambassador.requestFederationSave(label);
+      if (!waitFor(ambassador, _saveInitiated))
+        return false;
+      ambassador.federateSaveBegun();
+      _savedLogicalTime = _logicalTime;
+      ambassador.federateSaveComplete();
+      if (!waitFor(ambassador, _federationSaved))
+        return false;
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    // Move on past the interactions
+    if (!advance(ambassador, _endTime))
+      return false;
+    if (_numReceived != numExpected) {
+      std::wcout << L"Received " << _numReceived << L" interactions before the restore, expected " << numExpected << L"!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    // Restore the federation and redo the time advance
+    _restoreRequestSucceeded = false;
+    _restoreInitiated = false;
+    _federationRestored = false;
+    try {
+      if (first) {
+        ambassador.requestFederationRestore(label);
+        if (!waitFor(ambassador, _restoreRequestSucceeded))
+          return false;
+      }
+      if (!waitFor(ambassador, _restoreInitiated))
+        return false;
+      _logicalTime = _savedLogicalTime;
+      _numReceived = 0;
+      ambassador.federateRestoreComplete();
+      if (!waitFor(ambassador, _federationRestored))
+        return false;
+
+      HLAinteger64Time logicalTime;
+      ambassador.queryLogicalTime(logicalTime);
+      if (logicalTime != _saveTime) {
+        std::wcout << L"Logical time " << logicalTime.toString() << L" after restore, expected "
+                   << _saveTime.toString() << L"!" << std::endl;
+        return false;
+      }
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    if (!advance(ambassador, _endTime))
+      return false;
+    if (_numReceived != numExpected) {
+      std::wcout << L"Received " << _numReceived << L" interactions after the restore, expected " << numExpected << L"!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    // Subscriptions are not rolled back, so a restore after changing them is refused
+    try {
+      if (first) {
+        ambassador.unsubscribeInteractionClass(_interactionClassHandle);
+        _restoreRequestFailExpected = true;
+        ambassador.requestFederationRestore(label);
+        if (!waitFor(ambassador, _restoreRequestFailed))
+          return false;
+      }
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    try {
+      ambassador.disableTimeRegulation();
+      ambassador.disableTimeConstrained();
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    // The save file is written relative to the servers working directory
+    if (first)
+      std::remove(FederationSnapshot::getFileName(std::string(), ucsToUtf8(getFederationExecution()), ucsToUtf8(label)).c_str());
+
+    return !_fail;
+  }
+
+  bool waitFor(rti1516::RTIambassador& ambassador, const bool& flag, bool value = true)
+  {
+    Clock timeout = Clock::now() + Clock::fromSeconds(50);
+    while (flag != value) {
+      if (ambassador.evokeCallback(1.0))
+        continue;
+      if (_fail)
+        return false;
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for callback" << std::endl;
+        return false;
+      }
+    }
+    return !_fail;
+  }
+
+  bool advance(rti1516::RTIambassador& ambassador, const HLAinteger64Time& logicalTime)
+  {
+    try {
+      _timeAdvancePending = true;
+      ambassador.timeAdvanceRequest(logicalTime);
+      if (!waitFor(ambassador, _timeAdvancePending, false))
+        return false;
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  virtual void initiateFederateSave(const std::wstring& label)
+    RTI_THROW ((rti1516::UnableToPerformSave,
+           rti1516::FederateInternalError))
+  {
+    _saveInitiated = true;
+  }
+
+  virtual void federationSaved()
+    RTI_THROW ((rti1516::FederateInternalError))
+  {
+    _federationSaved = true;
+  }
+
+  virtual void federationNotSaved(rti1516::SaveFailureReason theSaveFailureReason)
+    RTI_THROW ((rti1516::FederateInternalError))
+  {
+    std::wcout << L"Federation not saved!" << std::endl;
+    _fail = true;
+  }
+
+  virtual void requestFederationRestoreSucceeded(const std::wstring& label)
+    RTI_THROW ((rti1516::FederateInternalError))
+  {
+    _restoreRequestSucceeded = true;
+  }
+
+  virtual void requestFederationRestoreFailed(const std::wstring& label)
+    RTI_THROW ((rti1516::FederateInternalError))
+  {
+    if (!_restoreRequestFailExpected) {
+      std::wcout << L"Request federation restore failed!" << std::endl;
+      _fail = true;
+    }
+    _restoreRequestFailed = true;
+  }
+
+  virtual void initiateFederateRestore(const std::wstring& label, rti1516::FederateHandle handle)
+    RTI_THROW ((rti1516::SpecifiedSaveLabelDoesNotExist,
+           rti1516::CouldNotInitiateRestore,
+           rti1516::FederateInternalError))
+  {
+    _restoreInitiated = true;
+  }
+
+  virtual void federationRestored()
+    RTI_THROW ((rti1516::FederateInternalError))
+  {
+    _federationRestored = true;
+  }
+
+  virtual void federationNotRestored(rti1516::RestoreFailureReason theRestoreFailureReason)
+    RTI_THROW ((rti1516::FederateInternalError))
+  {
+    std::wcout << L"Federation not restored!" << std::endl;
+    _fail = true;
+  }
+
+  virtual void timeRegulationEnabled(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::NoRequestToEnableTimeRegulationWasPending,
+           rti1516::FederateInternalError))
+  {
+    _timeRegulationEnabled = true;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void timeConstrainedEnabled(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::NoRequestToEnableTimeConstrainedWasPending,
+           rti1516::FederateInternalError))
+  {
+    _timeConstrainedEnabled = true;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void timeAdvanceGrant(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::JoinedFederateIsNotInTimeAdvancingState,
+           rti1516::FederateInternalError))
+  {
+    if (logicalTime < _logicalTime) {
+      std::wcout << L"Time advance grant for a time in the past!" << std::endl;
+      _fail = true;
+    }
+    _timeAdvancePending = false;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void receiveInteraction(rti1516::InteractionClassHandle interactionClassHandle,
+                                  const rti1516::ParameterHandleValueMap& parameterValues,
+                                  const rti1516::VariableLengthData&,
+                                  rti1516::OrderType,
+                                  rti1516::TransportationType,
+                                  const rti1516::LogicalTime& logicalTime,
+                                  rti1516::OrderType)
+    RTI_THROW ((rti1516::InteractionClassNotRecognized,
+           rti1516::InteractionParameterNotRecognized,
+           rti1516::InteractionClassNotSubscribed,
+           rti1516::InvalidLogicalTime,
+           rti1516::FederateInternalError))
+  {
+    if (logicalTime < _logicalTime) {
+      std::wcout << L"Received interaction in the past!" << std::endl;
+      _fail = true;
+    }
+    if (HLAinteger64Time(logicalTime) != _sendTime) {
+      std::wcout << L"Received interaction with unexpected time stamp!" << std::endl;
+      _fail = true;
+    }
+    ++_numReceived;
+  }
+
+private:
+  HLAinteger64Time _saveTime;
+  HLAinteger64Time _sendTime;
+  HLAinteger64Time _endTime;
+  unsigned _numReceived;
+
+  rti1516::InteractionClassHandle _interactionClassHandle;
+  rti1516::ParameterHandle _parameterHandle;
+
+  HLAinteger64Time _logicalTime;
+  HLAinteger64Time _savedLogicalTime;
+
+  bool _timeRegulationEnabled;
+  bool _timeConstrainedEnabled;
+  bool _timeAdvancePending;
+  bool _saveInitiated;
+  bool _federationSaved;
+  bool _restoreRequestSucceeded;
+  bool _restoreInitiated;
+  bool _federationRestored;
+  bool _restoreRequestFailExpected;
+  bool _restoreRequestFailed;
+  bool _fail;
+};
+
+class OPENRTI_LOCAL Test : public RTITest {
+public:
+  Test(int argc, const char* const argv[]) :
+    RTITest(argc, argv, false)
+  { }
+
+  virtual Ambassador* createAmbassador(const ConstructorArgs& constructorArgs)
+  {
+    return new TestAmbassador(constructorArgs);
+  }
+};
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::Test test(argc, argv);
+  return test.exec();
+}
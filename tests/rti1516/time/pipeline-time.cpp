@@ -0,0 +1,340 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <memory>
+#include <vector>
+#include <iostream>
+
+#include <RTI/HLAinteger64Time.h>
+#include <RTI/HLAinteger64Interval.h>
+
+#include <Atomic.h>
+#include <Clock.h>
+#include <Metrics.h>
+#include <Options.h>
+#include <StringUtils.h>
+
+#include <RTI1516TestLib.h>
+
+namespace OpenRTI {
+
+// Number of time advance grants of all federates
+static Atomic timeAdvanceGrants(0);
+
+// A pipeline of federates in next message request mode with sparse events.
+// The first federate sends interactions with stage 0 at every period.
+// Federate i forwards the interactions of stage i - 1 lookahead later as stage i.
+// All federates subscribe everything, so each one sees the whole traffic.
+class OPENRTI_LOCAL TestAmbassador : public RTI1516TestAmbassador {
+public:
+  TestAmbassador(const RTITest::ConstructorArgs& constructorArgs, unsigned lookahead, unsigned period, unsigned numEvents) :
+    RTI1516TestAmbassador(constructorArgs),
+    _lookahead(lookahead),
+    _period(period),
+    _numEvents(numEvents),
+    _stage(0),
+    _numReceived(0),
+    _numRounds(0),
+    _timeRegulationEnabled(false),
+    _timeConstrainedEnabled(false),
+    _timeAdvancePending(false),
+    _fail(false)
+  {
+    for (std::vector<std::wstring>::const_iterator i = getFederateList().begin(); i != getFederateList().end(); ++i) {
+      if (*i == getFederateType())
+        break;
+      ++_stage;
+    }
+  }
+  virtual ~TestAmbassador()
+    RTI_NOEXCEPT
+  { }
+
+  virtual bool execJoined(rti1516::RTIambassador& ambassador)
+  {
+    _numReceived = 0;
+    _sendTimes.clear();
+    _timeRegulationEnabled = false;
+    _timeConstrainedEnabled = false;
+    _timeAdvancePending = false;
+
+    try {
+      _interactionClassHandle = ambassador.getInteractionClassHandle(L"InteractionClass0");
+      _parameterHandle = ambassador.getParameterHandle(_interactionClassHandle, L"parameter0");
+
+      ambassador.enableTimeRegulation(_lookahead);
+      if (!waitFor(ambassador, _timeRegulationEnabled))
+        return false;
+      ambassador.enableTimeConstrained();
+      if (!waitFor(ambassador, _timeConstrainedEnabled))
+        return false;
+
+      ambassador.subscribeInteractionClass(_interactionClassHandle);
+      ambassador.publishInteractionClass(_interactionClassHandle);
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    Clock start = Clock::now();
+    uint64_t messages = Metrics::instance().getTimeManagementMessages().get();
+    uint64_t deferred = Metrics::instance().getDeferredCommitLowerBoundTimeStamps().get();
+    unsigned grants = timeAdvanceGrants;
+
+    HLAinteger64Time endTime((_numEvents + 1)*_period + getFederateList().size()*_lookahead.getInterval());
+    try {
+      // The source of the pipeline
+      if (_stage == 0) {
+        for (unsigned i = 1; i <= _numEvents; ++i) {
+          if (!send(ambassador, HLAinteger64Time(i*_period)))
+            return false;
+        }
+      }
+
+      while (_logicalTime < endTime) {
+        _timeAdvancePending = true;
+        ambassador.nextMessageRequest(endTime);
+        if (!waitFor(ambassador, _timeAdvancePending, false))
+          return false;
+        timeAdvanceGrants.incFetch(Atomic::MemoryOrderRelaxed);
+
+        for (std::vector<HLAinteger64Time>::const_iterator i = _sendTimes.begin(); i != _sendTimes.end(); ++i) {
+          if (!send(ambassador, *i))
+            return false;
+        }
+        _sendTimes.clear();
+      }
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    if (_stage != 0 && _numReceived != _numEvents) {
+      std::wcout << L"Received " << _numReceived << L" interactions of the previous stage, expected " << _numEvents << L"!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    // Print the numbers of the first round
+    if (_stage == 0 && _numRounds++ == 0) {
+      double seconds = (Clock::now() - start).getNSec()*1e-9;
+      grants = timeAdvanceGrants - grants;
+      messages = Metrics::instance().getTimeManagementMessages().get() - messages;
+      deferred = Metrics::instance().getDeferredCommitLowerBoundTimeStamps().get() - deferred;
+      std::cout << "Pipeline of " << getFederateList().size() << " federates: " << grants << " grants, "
+                << double(messages)/grants << " time management messages per grant, "
+                << double(deferred)/grants << " deferred commits per grant, "
+                << seconds << " seconds" << std::endl;
+    }
+
+    try {
+      ambassador.disableTimeRegulation();
+      ambassador.disableTimeConstrained();
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    // Make sure the next round starts again at the initial logical time
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    return !_fail;
+  }
+
+  bool waitFor(rti1516::RTIambassador& ambassador, const bool& flag, bool value = true)
+  {
+    Clock timeout = Clock::now() + Clock::fromSeconds(50);
+    while (flag != value) {
+      if (ambassador.evokeCallback(1.0))
+        continue;
+      if (_fail)
+        return false;
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for callback" << std::endl;
+        return false;
+      }
+    }
+    return !_fail;
+  }
+
+  bool send(rti1516::RTIambassador& ambassador, const HLAinteger64Time& logicalTime)
+  {
+    rti1516::ParameterHandleValueMap parameterValues;
+    parameterValues[_parameterHandle] = rti1516::VariableLengthData(&_stage, sizeof(_stage));
+    try {
+      ambassador.sendInteraction(_interactionClassHandle, parameterValues, rti1516::VariableLengthData(), logicalTime);
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  virtual void timeRegulationEnabled(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::NoRequestToEnableTimeRegulationWasPending,
+           rti1516::FederateInternalError))
+  {
+    _timeRegulationEnabled = true;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void timeConstrainedEnabled(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::NoRequestToEnableTimeConstrainedWasPending,
+           rti1516::FederateInternalError))
+  {
+    _timeConstrainedEnabled = true;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void timeAdvanceGrant(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::JoinedFederateIsNotInTimeAdvancingState,
+           rti1516::FederateInternalError))
+  {
+    if (logicalTime < _logicalTime) {
+      std::wcout << L"Time advance grant for a time in the past!" << std::endl;
+      _fail = true;
+    }
+    _timeAdvancePending = false;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void receiveInteraction(rti1516::InteractionClassHandle interactionClassHandle,
+                                  const rti1516::ParameterHandleValueMap& parameterValues,
+                                  const rti1516::VariableLengthData&,
+                                  rti1516::OrderType,
+                                  rti1516::TransportationType,
+                                  const rti1516::LogicalTime& logicalTime,
+                                  rti1516::OrderType)
+    RTI_THROW ((rti1516::InteractionClassNotRecognized,
+           rti1516::InteractionParameterNotRecognized,
+           rti1516::InteractionClassNotSubscribed,
+           rti1516::InvalidLogicalTime,
+           rti1516::FederateInternalError))
+  {
+    if (logicalTime < _logicalTime) {
+      std::wcout << L"Received interaction in the past!" << std::endl;
+      _fail = true;
+    }
+    rti1516::ParameterHandleValueMap::const_iterator i = parameterValues.find(_parameterHandle);
+    if (i == parameterValues.end() || i->second.size() != sizeof(unsigned)) {
+      std::wcout << L"Received interaction without stage!" << std::endl;
+      _fail = true;
+      return;
+    }
+    unsigned stage;
+    std::memcpy(&stage, i->second.data(), sizeof(stage));
+    if (stage + 1 != _stage)
+      return;
+    ++_numReceived;
+    HLAinteger64Time sendTime(logicalTime);
+    sendTime += _lookahead;
+    _sendTimes.push_back(sendTime);
+  }
+
+private:
+  HLAinteger64Interval _lookahead;
+  unsigned _period;
+  unsigned _numEvents;
+  unsigned _stage;
+  unsigned _numReceived;
+  unsigned _numRounds;
+
+  rti1516::InteractionClassHandle _interactionClassHandle;
+  rti1516::ParameterHandle _parameterHandle;
+
+  HLAinteger64Time _logicalTime;
+  std::vector<HLAinteger64Time> _sendTimes;
+
+  bool _timeRegulationEnabled;
+  bool _timeConstrainedEnabled;
+  bool _timeAdvancePending;
+  bool _fail;
+};
+
+class OPENRTI_LOCAL Test : public RTITest {
+public:
+  Test(int argc, const char* const argv[]) :
+    RTITest(argc, argv, false),
+    _lookahead(1),
+    _period(20),
+    _numEvents(50)
+  {
+    insertOptionString("E:L:P:");
+  }
+
+  virtual bool processOption(char optchar, const std::string& argument)
+  {
+    switch (optchar) {
+    case 'E':
+      _numEvents = atoi(argument.c_str());
+      return true;
+    case 'L':
+      _lookahead = atoi(argument.c_str());
+      return 0 < _lookahead;
+    case 'P':
+      _period = atoi(argument.c_str());
+      return true;
+    default:
+      return RTITest::processOption(optchar, argument);
+    }
+  }
+
+  virtual Ambassador* createAmbassador(const ConstructorArgs& constructorArgs)
+  {
+    return new TestAmbassador(constructorArgs, _lookahead, _period, _numEvents);
+  }
+
+private:
+  unsigned _lookahead;
+  unsigned _period;
+  unsigned _numEvents;
+};
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::Test test(argc, argv);
+  return test.exec();
+}
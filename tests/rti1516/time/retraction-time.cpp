@@ -0,0 +1,311 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <memory>
+#include <vector>
+#include <iostream>
+
+#include <RTI/HLAinteger64Time.h>
+#include <RTI/HLAinteger64Interval.h>
+
+#include <Clock.h>
+#include <Options.h>
+#include <StringUtils.h>
+
+#include <RTI1516TestLib.h>
+
+namespace OpenRTI {
+
+// The first federate sends time stamp order interactions and retracts every odd one
+// before advancing. All other federates must only see the even ones.
+class OPENRTI_LOCAL TestAmbassador : public RTI1516TestAmbassador {
+public:
+  TestAmbassador(const RTITest::ConstructorArgs& constructorArgs, unsigned period, unsigned numEvents) :
+    RTI1516TestAmbassador(constructorArgs),
+    _period(period),
+    _numEvents(numEvents),
+    _sender(false),
+    _numReceived(0),
+    _timeRegulationEnabled(false),
+    _timeConstrainedEnabled(false),
+    _timeAdvancePending(false),
+    _fail(false)
+  {
+    _sender = getFederateList().front() == getFederateType();
+  }
+  virtual ~TestAmbassador()
+    RTI_NOEXCEPT
+  { }
+
+  virtual bool execJoined(rti1516::RTIambassador& ambassador)
+  {
+    _numReceived = 0;
+    _timeRegulationEnabled = false;
+    _timeConstrainedEnabled = false;
+    _timeAdvancePending = false;
+
+    try {
+      _interactionClassHandle = ambassador.getInteractionClassHandle(L"InteractionClass0");
+      _parameterHandle = ambassador.getParameterHandle(_interactionClassHandle, L"parameter0");
+
+      ambassador.enableTimeRegulation(HLAinteger64Interval(1));
+      if (!waitFor(ambassador, _timeRegulationEnabled))
+        return false;
+      ambassador.enableTimeConstrained();
+      if (!waitFor(ambassador, _timeConstrainedEnabled))
+        return false;
+
+      if (_sender)
+        ambassador.publishInteractionClass(_interactionClassHandle);
+      else
+        ambassador.subscribeInteractionClass(_interactionClassHandle);
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    HLAinteger64Time endTime((_numEvents + 1)*_period);
+    try {
+      std::vector<rti1516::MessageRetractionHandle> messageRetractionHandles;
+      if (_sender) {
+        for (unsigned i = 0; i < _numEvents; ++i) {
+          rti1516::ParameterHandleValueMap parameterValues;
+          parameterValues[_parameterHandle] = rti1516::VariableLengthData(&i, sizeof(i));
+          // Descending time stamps, so the serials do not match the time stamp order
+          HLAinteger64Time logicalTime((_numEvents - i)*_period);
+          messageRetractionHandles.push_back(ambassador.sendInteraction(_interactionClassHandle, parameterValues,
+                                                                        rti1516::VariableLengthData(), logicalTime));
+        }
+        for (unsigned i = 1; i < _numEvents; i += 2)
+          ambassador.retract(messageRetractionHandles[i]);
+
+        // A retracted message cannot be retracted twice
+        if (1 < _numEvents && !canNoLongerBeRetracted(ambassador, messageRetractionHandles[1]))
+          return false;
+      }
+
+      while (_logicalTime < endTime) {
+        _timeAdvancePending = true;
+        ambassador.nextMessageRequest(endTime);
+        if (!waitFor(ambassador, _timeAdvancePending, false))
+          return false;
+      }
+
+      // Messages in the past cannot be retracted anymore
+      if (_sender && 0 < _numEvents && !canNoLongerBeRetracted(ambassador, messageRetractionHandles[0]))
+        return false;
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    if (!_sender && _numReceived != (_numEvents + 1)/2) {
+      std::wcout << L"Received " << _numReceived << L" interactions, expected " << (_numEvents + 1)/2 << L"!" << std::endl;
+      return false;
+    }
+
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    try {
+      ambassador.disableTimeRegulation();
+      ambassador.disableTimeConstrained();
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+
+    // Make sure the next round starts again at the initial logical time
+    if (!waitForAllFederates(ambassador))
+      return false;
+
+    return !_fail;
+  }
+
+  bool waitFor(rti1516::RTIambassador& ambassador, const bool& flag, bool value = true)
+  {
+    Clock timeout = Clock::now() + Clock::fromSeconds(50);
+    while (flag != value) {
+      if (ambassador.evokeCallback(1.0))
+        continue;
+      if (_fail)
+        return false;
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for callback" << std::endl;
+        return false;
+      }
+    }
+    return !_fail;
+  }
+
+  bool canNoLongerBeRetracted(rti1516::RTIambassador& ambassador, const rti1516::MessageRetractionHandle& messageRetractionHandle)
+  {
+    try {
+      ambassador.retract(messageRetractionHandle);
+      std::wcout << L"Retracted a message that can no longer be retracted!" << std::endl;
+      return false;
+    } catch (const rti1516::MessageCanNoLongerBeRetracted&) {
+      return true;
+    } catch (const rti1516::Exception& e) {
+      std::wcout << L"rti1516::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+  }
+
+  virtual void timeRegulationEnabled(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::NoRequestToEnableTimeRegulationWasPending,
+           rti1516::FederateInternalError))
+  {
+    _timeRegulationEnabled = true;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void timeConstrainedEnabled(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::NoRequestToEnableTimeConstrainedWasPending,
+           rti1516::FederateInternalError))
+  {
+    _timeConstrainedEnabled = true;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void timeAdvanceGrant(const rti1516::LogicalTime& logicalTime)
+    RTI_THROW ((rti1516::InvalidLogicalTime,
+           rti1516::JoinedFederateIsNotInTimeAdvancingState,
+           rti1516::FederateInternalError))
+  {
+    _timeAdvancePending = false;
+    _logicalTime = logicalTime;
+  }
+
+  virtual void receiveInteraction(rti1516::InteractionClassHandle interactionClassHandle,
+                                  const rti1516::ParameterHandleValueMap& parameterValues,
+                                  const rti1516::VariableLengthData&,
+                                  rti1516::OrderType,
+                                  rti1516::TransportationType,
+                                  const rti1516::LogicalTime& logicalTime,
+                                  rti1516::OrderType)
+    RTI_THROW ((rti1516::InteractionClassNotRecognized,
+           rti1516::InteractionParameterNotRecognized,
+           rti1516::InteractionClassNotSubscribed,
+           rti1516::InvalidLogicalTime,
+           rti1516::FederateInternalError))
+  {
+    rti1516::ParameterHandleValueMap::const_iterator i = parameterValues.find(_parameterHandle);
+    if (i == parameterValues.end() || i->second.size() != sizeof(unsigned)) {
+      std::wcout << L"Received interaction without index!" << std::endl;
+      _fail = true;
+      return;
+    }
+    unsigned index;
+    std::memcpy(&index, i->second.data(), sizeof(index));
+    if (index % 2) {
+      std::wcout << L"Received retracted interaction " << index << L"!" << std::endl;
+      _fail = true;
+      return;
+    }
+    ++_numReceived;
+  }
+
+  virtual void requestRetraction(rti1516::MessageRetractionHandle)
+    RTI_THROW ((rti1516::FederateInternalError))
+  {
+    // Interactions are only delivered in time stamp order here
+    std::wcout << L"Unexpected retraction request!" << std::endl;
+    _fail = true;
+  }
+
+private:
+  unsigned _period;
+  unsigned _numEvents;
+  bool _sender;
+  unsigned _numReceived;
+
+  rti1516::InteractionClassHandle _interactionClassHandle;
+  rti1516::ParameterHandle _parameterHandle;
+
+  HLAinteger64Time _logicalTime;
+
+  bool _timeRegulationEnabled;
+  bool _timeConstrainedEnabled;
+  bool _timeAdvancePending;
+  bool _fail;
+};
+
+class OPENRTI_LOCAL Test : public RTITest {
+public:
+  Test(int argc, const char* const argv[]) :
+    RTITest(argc, argv, false),
+    _period(10),
+    _numEvents(100)
+  {
+    insertOptionString("E:P:");
+  }
+
+  virtual bool processOption(char optchar, const std::string& argument)
+  {
+    switch (optchar) {
+    case 'E':
+      _numEvents = atoi(argument.c_str());
+      return true;
+    case 'P':
+      _period = atoi(argument.c_str());
+      return 0 < _period;
+    default:
+      return RTITest::processOption(optchar, argument);
+    }
+  }
+
+  virtual Ambassador* createAmbassador(const ConstructorArgs& constructorArgs)
+  {
+    return new TestAmbassador(constructorArgs, _period, _numEvents);
+  }
+
+private:
+  unsigned _period;
+  unsigned _numEvents;
+};
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::Test test(argc, argv);
+  return test.exec();
+}
@@ -0,0 +1,319 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <map>
+#include <vector>
+#include <iostream>
+
+#include <RTI/RTIambassadorFactory.h>
+#include <RTI/RTIambassador.h>
+
+#include <OpenRTI/RTIambassadorFriend.h>
+
+#include <TestLib.h>
+#include <RTI1516ETestLib.h>
+
+namespace OpenRTI {
+
+class OPENRTI_LOCAL CachingAmbassador : public RTI1516ESimpleAmbassador {
+public:
+  CachingAmbassador() :
+    _discoverCount(0),
+    _reflectCount(0),
+    _removeCount(0)
+  { }
+  virtual ~CachingAmbassador()
+    RTI_NOEXCEPT
+  { }
+
+  virtual void discoverObjectInstance(rti1516e::ObjectInstanceHandle theObject, rti1516e::ObjectClassHandle theObjectClass,
+                                      std::wstring const & theObjectInstanceName)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    ++_discoverCount;
+  }
+
+  virtual void reflectAttributeValues(rti1516e::ObjectInstanceHandle theObject, rti1516e::AttributeHandleValueMap const & theAttributeValues,
+                                      rti1516e::VariableLengthData const & theUserSuppliedTag, rti1516e::OrderType sentOrder,
+                                      rti1516e::TransportationType theType, rti1516e::SupplementalReflectInfo theReflectInfo)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    ++_reflectCount;
+    for (rti1516e::AttributeHandleValueMap::const_iterator i = theAttributeValues.begin(); i != theAttributeValues.end(); ++i)
+      _attributeValues[i->first] = i->second;
+  }
+
+  virtual void removeObjectInstance(rti1516e::ObjectInstanceHandle theObject, rti1516e::VariableLengthData const & theUserSuppliedTag,
+                                    rti1516e::OrderType sentOrder, rti1516e::SupplementalRemoveInfo theRemoveInfo)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    ++_removeCount;
+  }
+
+  unsigned _discoverCount;
+  unsigned _reflectCount;
+  unsigned _removeCount;
+  rti1516e::AttributeHandleValueMap _attributeValues;
+};
+
+class OPENRTI_LOCAL TestAmbassador : public RTITest::Ambassador {
+public:
+  TestAmbassador(const RTITest::ConstructorArgs& constructorArgs) :
+    RTITest::Ambassador(constructorArgs)
+  { }
+
+  virtual bool exec()
+  {
+    try {
+      return execConnected();
+    } catch (const rti1516e::Exception& e) {
+      std::wcout << L"rti1516e::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+  }
+
+  // Returns true if the cache holds value + row for each instance in the fixed size column
+  static bool checkColumn(const rti1516e::AttributeCacheView& attributeCache, rti1516e::AttributeHandle attributeHandle,
+                          const std::vector<rti1516e::ObjectInstanceHandle>& objectInstanceHandles, unsigned value)
+  {
+    if (attributeCache.getNumRows() != objectInstanceHandles.size())
+      return false;
+    if (attributeCache.getColumnOctetSize(attributeHandle) != sizeof(unsigned))
+      return false;
+    const unsigned* column = static_cast<const unsigned*>(attributeCache.getColumnData(attributeHandle));
+    if (!column)
+      return false;
+    for (size_t i = 0; i < objectInstanceHandles.size(); ++i) {
+      size_t row;
+      if (!attributeCache.getRow(objectInstanceHandles[i], row))
+        return false;
+      if (attributeCache.getObjectInstanceHandle(row) != objectInstanceHandles[i])
+        return false;
+      if (column[row] != value + i)
+        return false;
+      size_t size;
+      const void* data = attributeCache.getValue(attributeHandle, row, size);
+      if (size != sizeof(unsigned) || data != column + row)
+        return false;
+    }
+    return true;
+  }
+
+  bool execConnected()
+  {
+    RTI1516ESimpleAmbassador publisher;
+    publisher.connect(getConnectUrl());
+    CachingAmbassador subscriber;
+    subscriber.connect(getConnectUrl());
+
+    publisher.createFederationExecution(getFederationExecution(), getFddFile());
+    publisher.joinFederationExecution(L"publisher", getFederationExecution());
+    subscriber.joinFederationExecution(L"subscriber", getFederationExecution());
+
+    rti1516e::ObjectClassHandle objectClassHandle = publisher.getObjectClassHandle(L"ObjectClass");
+    rti1516e::AttributeHandle attributeHandle0 = publisher.getAttributeHandle(objectClassHandle, L"Attribute0");
+    rti1516e::AttributeHandle attributeHandle1 = publisher.getAttributeHandle(objectClassHandle, L"Attribute1");
+    rti1516e::AttributeHandleSet attributeHandleSet;
+    attributeHandleSet.insert(attributeHandle0);
+    attributeHandleSet.insert(attributeHandle1);
+
+    // Attribute0 goes to the cache, Attribute1 is still reflected
+    rti1516e::RTIambassadorFriend::enableAttributeCache(subscriber.getRTIambassador(), objectClassHandle, attributeHandle0, sizeof(unsigned));
+    rti1516e::AttributeCacheView attributeCache;
+    attributeCache = rti1516e::RTIambassadorFriend::getAttributeCache(subscriber.getRTIambassador(), objectClassHandle);
+    if (!attributeCache.isValid()) {
+      std::wcout << L"No attribute cache!" << std::endl;
+      return false;
+    }
+    if (!attributeCache.isColumnCached(attributeHandle0) || attributeCache.isColumnCached(attributeHandle1)) {
+      std::wcout << L"Wrong attribute cache columns!" << std::endl;
+      return false;
+    }
+
+    publisher.publishObjectClassAttributes(objectClassHandle, attributeHandleSet);
+    subscriber.subscribeObjectClassAttributes(objectClassHandle, attributeHandleSet);
+
+    std::vector<rti1516e::ObjectInstanceHandle> objectInstanceHandles;
+    unsigned count = 16;
+    for (unsigned i = 0; i < count; ++i)
+      objectInstanceHandles.push_back(publisher.registerObjectInstance(objectClassHandle));
+    Clock timeout = Clock::now() + Clock::fromSeconds(10);
+    while (subscriber._discoverCount < count) {
+      subscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for object instance discovery!" << std::endl;
+        return false;
+      }
+    }
+    // Discovered instances already have their row
+    if (attributeCache.getNumRows() != count) {
+      std::wcout << L"Discovered instances are not in the attribute cache!" << std::endl;
+      return false;
+    }
+
+    // Several rounds of updates of the cached attribute, none of them must end in a callback
+    uint64_t serial = attributeCache.getSerial();
+    unsigned rounds = 3;
+    for (unsigned j = 0; j < rounds; ++j) {
+      for (unsigned i = 0; i < count; ++i) {
+        rti1516e::AttributeHandleValueMap attributeValues;
+        attributeValues[attributeHandle0] = toVariableLengthData(100*j + i);
+        publisher.updateAttributeValues(objectInstanceHandles[i], attributeValues, rti1516e::VariableLengthData());
+      }
+    }
+    timeout = Clock::now() + Clock::fromSeconds(10);
+    while (attributeCache.getSerial() < serial + rounds*count) {
+      subscriber.evokeMultipleCallbacks(0.01, 0.1);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for cached attribute reflections!" << std::endl;
+        return false;
+      }
+    }
+    if (subscriber._reflectCount != 0) {
+      std::wcout << L"Cached attribute values are reflected through callbacks!" << std::endl;
+      return false;
+    }
+    if (!checkColumn(attributeCache, attributeHandle0, objectInstanceHandles, 100*(rounds - 1))) {
+      std::wcout << L"Attribute cache does not contain the latest values!" << std::endl;
+      return false;
+    }
+    const uint64_t* serials = attributeCache.getColumnSerials(attributeHandle0);
+    for (unsigned i = 0; i < count; ++i) {
+      if (serial + (rounds - 1)*count < serials[i])
+        continue;
+      std::wcout << L"Attribute cache serials are not updated!" << std::endl;
+      return false;
+    }
+
+    // Mixed updates store the cached part and reflect the rest
+    {
+      rti1516e::AttributeHandleValueMap attributeValues;
+      attributeValues[attributeHandle0] = toVariableLengthData(1000u);
+      attributeValues[attributeHandle1] = toVariableLengthData("uncached");
+      publisher.updateAttributeValues(objectInstanceHandles[0], attributeValues, rti1516e::VariableLengthData());
+    }
+    timeout = Clock::now() + Clock::fromSeconds(10);
+    while (subscriber._reflectCount < 1) {
+      subscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for uncached attribute reflections!" << std::endl;
+        return false;
+      }
+    }
+    if (subscriber._attributeValues.find(attributeHandle0) != subscriber._attributeValues.end()) {
+      std::wcout << L"Cached attribute value is reflected through a callback!" << std::endl;
+      return false;
+    }
+    if (toString(subscriber._attributeValues[attributeHandle1]) != "uncached") {
+      std::wcout << L"Uncached attribute value is not reflected!" << std::endl;
+      return false;
+    }
+    size_t row;
+    rti1516e::ObjectInstanceHandle objectInstanceHandle = objectInstanceHandles[0];
+    if (!attributeCache.getRow(objectInstanceHandle, row) ||
+        static_cast<const unsigned*>(attributeCache.getColumnData(attributeHandle0))[row] != 1000) {
+      std::wcout << L"Attribute cache does not contain the value of a mixed update!" << std::endl;
+      return false;
+    }
+
+    // A value that does not fit the fixed size column is reflected instead
+    subscriber._attributeValues.clear();
+    {
+      rti1516e::AttributeHandleValueMap attributeValues;
+      attributeValues[attributeHandle0] = rti1516e::VariableLengthData("ab", 2);
+      publisher.updateAttributeValues(objectInstanceHandles[0], attributeValues, rti1516e::VariableLengthData());
+    }
+    timeout = Clock::now() + Clock::fromSeconds(10);
+    while (subscriber._reflectCount < 2) {
+      subscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for the reflection of a value of an other size!" << std::endl;
+        return false;
+      }
+    }
+    if (subscriber._attributeValues[attributeHandle0].size() != 2) {
+      std::wcout << L"Value of an other size is not reflected!" << std::endl;
+      return false;
+    }
+    if (static_cast<const unsigned*>(attributeCache.getColumnData(attributeHandle0))[row] != 1000) {
+      std::wcout << L"Value of an other size changed the attribute cache!" << std::endl;
+      return false;
+    }
+
+    // Deleting an instance keeps the rows dense
+    publisher.deleteObjectInstance(objectInstanceHandles[0], rti1516e::VariableLengthData());
+    timeout = Clock::now() + Clock::fromSeconds(10);
+    while (subscriber._removeCount < 1) {
+      subscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for object instance removal!" << std::endl;
+        return false;
+      }
+    }
+    objectInstanceHandles.erase(objectInstanceHandles.begin());
+    if (attributeCache.getRow(objectInstanceHandle, row)) {
+      std::wcout << L"Removed object instance is still in the attribute cache!" << std::endl;
+      return false;
+    }
+    // The remaining instances were written with 200 + i, i starting from 1
+    if (!checkColumn(attributeCache, attributeHandle0, objectInstanceHandles, 100*(rounds - 1) + 1)) {
+      std::wcout << L"Attribute cache rows are broken after removing an instance!" << std::endl;
+      return false;
+    }
+
+    rti1516e::RTIambassadorFriend::disableAttributeCache(subscriber.getRTIambassador(), objectClassHandle);
+    if (rti1516e::RTIambassadorFriend::getAttributeCache(subscriber.getRTIambassador(), objectClassHandle).isValid()) {
+      std::wcout << L"Attribute cache is not disabled!" << std::endl;
+      return false;
+    }
+
+    subscriber.resignFederationExecution(rti1516e::NO_ACTION);
+    publisher.resignFederationExecution(rti1516e::DELETE_OBJECTS);
+    publisher.destroyFederationExecution(getFederationExecution());
+
+    return true;
+  }
+};
+
+class OPENRTI_LOCAL Test : public RTITest {
+public:
+  Test(int argc, const char* const argv[]) :
+    RTITest(argc, argv, false)
+  { }
+
+  virtual Ambassador* createAmbassador(const ConstructorArgs& constructorArgs)
+  {
+    return new TestAmbassador(constructorArgs);
+  }
+};
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::Test test(argc, argv);
+  return test.exec();
+}
@@ -0,0 +1,540 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * This file is autogenerated by datatypegen.py. Do not edit!
+ *
+ */
+
+#ifndef OpenRTI_DataTypeCodec_h
+#define OpenRTI_DataTypeCodec_h
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <RTI/encoding/EncodingConfig.h>
+#include <RTI/encoding/EncodingExceptions.h>
+
+namespace OpenRTI {
+
+/// Appends encoded data types to a buffer, keeps the capacity of the buffer
+class DataTypeEncoder {
+public:
+  DataTypeEncoder(std::vector<rti1516e::Octet>& buffer) :
+    _buffer(buffer)
+  { }
+
+  std::size_t size() const
+  { return _buffer.size(); }
+
+  void align(std::size_t octetBoundary)
+  { _buffer.resize((_buffer.size() + octetBoundary - 1) & ~(octetBoundary - 1), 0); }
+
+  /// Align and append size octets to be written
+  rti1516e::Octet* extend(std::size_t octetBoundary, std::size_t size)
+  {
+    std::size_t offset = (_buffer.size() + octetBoundary - 1) & ~(octetBoundary - 1);
+    _buffer.resize(offset + size, 0);
+    if (_buffer.empty())
+      return 0;
+    return &_buffer.front() + offset;
+  }
+
+  /// The element count of variable arrays
+  void encodeLength(std::size_t octetBoundary, std::size_t length);
+
+private:
+  std::vector<rti1516e::Octet>& _buffer;
+};
+
+/// Reads encoded data types from a buffer
+class DataTypeDecoder {
+public:
+  DataTypeDecoder(const void* data, std::size_t size) :
+    _data(static_cast<const rti1516e::Octet*>(data)),
+    _size(size),
+    _offset(0)
+  { }
+
+  std::size_t getOffset() const
+  { return _offset; }
+
+  void align(std::size_t octetBoundary)
+  { _offset = (_offset + octetBoundary - 1) & ~(octetBoundary - 1); }
+
+  /// Align and return the next size octets
+  const rti1516e::Octet* consume(std::size_t octetBoundary, std::size_t size)
+  {
+    std::size_t offset = (_offset + octetBoundary - 1) & ~(octetBoundary - 1);
+    if (_size < offset || _size - offset < size)
+      throw rti1516e::EncoderException(L"Insufficient buffer size for decoding!");
+    _offset = offset + size;
+    return _data + offset;
+  }
+
+  /// The element count of variable arrays
+  std::size_t decodeLength(std::size_t octetBoundary);
+
+private:
+  const rti1516e::Octet* _data;
+  std::size_t _size;
+  std::size_t _offset;
+};
+
+/// The values of fixed arrays
+template<typename T, std::size_t N>
+struct DataTypeFixedArray {
+  std::size_t size() const
+  { return N; }
+  T& operator[](std::size_t index)
+  { return _values[index]; }
+  const T& operator[](std::size_t index) const
+  { return _values[index]; }
+  T _values[N ? N : 1];
+};
+
+struct HLAoctetCodec {
+  typedef rti1516e::Octet value_type;
+  enum { octetBoundary = 1, encodedSize = 1 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    unsigned char u = static_cast<unsigned char>(value);
+    data[0] = rti1516e::Octet(u);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    unsigned char u = static_cast<unsigned char>(data[0]);
+    value = value_type(u);
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAoctetPairBECodec {
+  typedef rti1516e::OctetPair value_type;
+  enum { octetBoundary = 2, encodedSize = 2 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    data[0] = value.first;
+    data[1] = value.second;
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    value.first = data[0];
+    value.second = data[1];
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAoctetPairLECodec {
+  typedef rti1516e::OctetPair value_type;
+  enum { octetBoundary = 2, encodedSize = 2 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    data[0] = value.second;
+    data[1] = value.first;
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    value.second = data[0];
+    value.first = data[1];
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAinteger16BECodec {
+  typedef rti1516e::Integer16 value_type;
+  enum { octetBoundary = 2, encodedSize = 2 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    unsigned short u = static_cast<unsigned short>(value);
+    data[0] = rti1516e::Octet(u >> 8);
+    data[1] = rti1516e::Octet(u);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    unsigned short u = static_cast<unsigned short>(static_cast<unsigned char>(data[0])) << 8;
+    u |= static_cast<unsigned short>(static_cast<unsigned char>(data[1]));
+    value = value_type(u);
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAinteger16LECodec {
+  typedef rti1516e::Integer16 value_type;
+  enum { octetBoundary = 2, encodedSize = 2 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    unsigned short u = static_cast<unsigned short>(value);
+    data[0] = rti1516e::Octet(u);
+    data[1] = rti1516e::Octet(u >> 8);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    unsigned short u = static_cast<unsigned short>(static_cast<unsigned char>(data[0]));
+    u |= static_cast<unsigned short>(static_cast<unsigned char>(data[1])) << 8;
+    value = value_type(u);
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAinteger32BECodec {
+  typedef rti1516e::Integer32 value_type;
+  enum { octetBoundary = 4, encodedSize = 4 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    unsigned int u = static_cast<unsigned int>(value);
+    data[0] = rti1516e::Octet(u >> 24);
+    data[1] = rti1516e::Octet(u >> 16);
+    data[2] = rti1516e::Octet(u >> 8);
+    data[3] = rti1516e::Octet(u);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    unsigned int u = static_cast<unsigned int>(static_cast<unsigned char>(data[0])) << 24;
+    u |= static_cast<unsigned int>(static_cast<unsigned char>(data[1])) << 16;
+    u |= static_cast<unsigned int>(static_cast<unsigned char>(data[2])) << 8;
+    u |= static_cast<unsigned int>(static_cast<unsigned char>(data[3]));
+    value = value_type(u);
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAinteger32LECodec {
+  typedef rti1516e::Integer32 value_type;
+  enum { octetBoundary = 4, encodedSize = 4 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    unsigned int u = static_cast<unsigned int>(value);
+    data[0] = rti1516e::Octet(u);
+    data[1] = rti1516e::Octet(u >> 8);
+    data[2] = rti1516e::Octet(u >> 16);
+    data[3] = rti1516e::Octet(u >> 24);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    unsigned int u = static_cast<unsigned int>(static_cast<unsigned char>(data[0]));
+    u |= static_cast<unsigned int>(static_cast<unsigned char>(data[1])) << 8;
+    u |= static_cast<unsigned int>(static_cast<unsigned char>(data[2])) << 16;
+    u |= static_cast<unsigned int>(static_cast<unsigned char>(data[3])) << 24;
+    value = value_type(u);
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAinteger64BECodec {
+  typedef rti1516e::Integer64 value_type;
+  enum { octetBoundary = 8, encodedSize = 8 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    unsigned long long u = static_cast<unsigned long long>(value);
+    data[0] = rti1516e::Octet(u >> 56);
+    data[1] = rti1516e::Octet(u >> 48);
+    data[2] = rti1516e::Octet(u >> 40);
+    data[3] = rti1516e::Octet(u >> 32);
+    data[4] = rti1516e::Octet(u >> 24);
+    data[5] = rti1516e::Octet(u >> 16);
+    data[6] = rti1516e::Octet(u >> 8);
+    data[7] = rti1516e::Octet(u);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    unsigned long long u = static_cast<unsigned long long>(static_cast<unsigned char>(data[0])) << 56;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[1])) << 48;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[2])) << 40;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[3])) << 32;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[4])) << 24;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[5])) << 16;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[6])) << 8;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[7]));
+    value = value_type(u);
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAinteger64LECodec {
+  typedef rti1516e::Integer64 value_type;
+  enum { octetBoundary = 8, encodedSize = 8 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    unsigned long long u = static_cast<unsigned long long>(value);
+    data[0] = rti1516e::Octet(u);
+    data[1] = rti1516e::Octet(u >> 8);
+    data[2] = rti1516e::Octet(u >> 16);
+    data[3] = rti1516e::Octet(u >> 24);
+    data[4] = rti1516e::Octet(u >> 32);
+    data[5] = rti1516e::Octet(u >> 40);
+    data[6] = rti1516e::Octet(u >> 48);
+    data[7] = rti1516e::Octet(u >> 56);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    unsigned long long u = static_cast<unsigned long long>(static_cast<unsigned char>(data[0]));
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[1])) << 8;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[2])) << 16;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[3])) << 24;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[4])) << 32;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[5])) << 40;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[6])) << 48;
+    u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[7])) << 56;
+    value = value_type(u);
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAfloat32BECodec {
+  typedef float value_type;
+  enum { octetBoundary = 4, encodedSize = 4 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    union { unsigned int u; value_type s; } u;
+    u.s = value;
+    data[0] = rti1516e::Octet(u.u >> 24);
+    data[1] = rti1516e::Octet(u.u >> 16);
+    data[2] = rti1516e::Octet(u.u >> 8);
+    data[3] = rti1516e::Octet(u.u);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    union { unsigned int u; value_type s; } u;
+    u.u = static_cast<unsigned int>(static_cast<unsigned char>(data[0])) << 24;
+    u.u |= static_cast<unsigned int>(static_cast<unsigned char>(data[1])) << 16;
+    u.u |= static_cast<unsigned int>(static_cast<unsigned char>(data[2])) << 8;
+    u.u |= static_cast<unsigned int>(static_cast<unsigned char>(data[3]));
+    value = u.s;
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAfloat32LECodec {
+  typedef float value_type;
+  enum { octetBoundary = 4, encodedSize = 4 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    union { unsigned int u; value_type s; } u;
+    u.s = value;
+    data[0] = rti1516e::Octet(u.u);
+    data[1] = rti1516e::Octet(u.u >> 8);
+    data[2] = rti1516e::Octet(u.u >> 16);
+    data[3] = rti1516e::Octet(u.u >> 24);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    union { unsigned int u; value_type s; } u;
+    u.u = static_cast<unsigned int>(static_cast<unsigned char>(data[0]));
+    u.u |= static_cast<unsigned int>(static_cast<unsigned char>(data[1])) << 8;
+    u.u |= static_cast<unsigned int>(static_cast<unsigned char>(data[2])) << 16;
+    u.u |= static_cast<unsigned int>(static_cast<unsigned char>(data[3])) << 24;
+    value = u.s;
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAfloat64BECodec {
+  typedef double value_type;
+  enum { octetBoundary = 8, encodedSize = 8 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    union { unsigned long long u; value_type s; } u;
+    u.s = value;
+    data[0] = rti1516e::Octet(u.u >> 56);
+    data[1] = rti1516e::Octet(u.u >> 48);
+    data[2] = rti1516e::Octet(u.u >> 40);
+    data[3] = rti1516e::Octet(u.u >> 32);
+    data[4] = rti1516e::Octet(u.u >> 24);
+    data[5] = rti1516e::Octet(u.u >> 16);
+    data[6] = rti1516e::Octet(u.u >> 8);
+    data[7] = rti1516e::Octet(u.u);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    union { unsigned long long u; value_type s; } u;
+    u.u = static_cast<unsigned long long>(static_cast<unsigned char>(data[0])) << 56;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[1])) << 48;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[2])) << 40;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[3])) << 32;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[4])) << 24;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[5])) << 16;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[6])) << 8;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[7]));
+    value = u.s;
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAfloat64LECodec {
+  typedef double value_type;
+  enum { octetBoundary = 8, encodedSize = 8 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    union { unsigned long long u; value_type s; } u;
+    u.s = value;
+    data[0] = rti1516e::Octet(u.u);
+    data[1] = rti1516e::Octet(u.u >> 8);
+    data[2] = rti1516e::Octet(u.u >> 16);
+    data[3] = rti1516e::Octet(u.u >> 24);
+    data[4] = rti1516e::Octet(u.u >> 32);
+    data[5] = rti1516e::Octet(u.u >> 40);
+    data[6] = rti1516e::Octet(u.u >> 48);
+    data[7] = rti1516e::Octet(u.u >> 56);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    union { unsigned long long u; value_type s; } u;
+    u.u = static_cast<unsigned long long>(static_cast<unsigned char>(data[0]));
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[1])) << 8;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[2])) << 16;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[3])) << 24;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[4])) << 32;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[5])) << 40;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[6])) << 48;
+    u.u |= static_cast<unsigned long long>(static_cast<unsigned char>(data[7])) << 56;
+    value = u.s;
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct HLAunicodeCharCodec {
+  typedef wchar_t value_type;
+  enum { octetBoundary = 2, encodedSize = 2 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    unsigned short u = static_cast<unsigned short>(value);
+    data[0] = rti1516e::Octet(u >> 8);
+    data[1] = rti1516e::Octet(u);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    unsigned short u = static_cast<unsigned short>(static_cast<unsigned char>(data[0])) << 8;
+    u |= static_cast<unsigned short>(static_cast<unsigned char>(data[1]));
+    value = value_type(u);
+  }
+
+  static void encode(DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+inline void
+DataTypeEncoder::encodeLength(std::size_t octetBoundary, std::size_t length)
+{
+  if (0x7fffffffu < length)
+    throw rti1516e::EncoderException(L"Array size is too big to encode!");
+  HLAinteger32BECodec::write(extend(octetBoundary, 4), rti1516e::Integer32(length));
+}
+
+inline std::size_t
+DataTypeDecoder::decodeLength(std::size_t octetBoundary)
+{
+  rti1516e::Integer32 length;
+  HLAinteger32BECodec::read(consume(octetBoundary, 4), length);
+  // Every element takes at least one octet
+  if (_size - _offset < std::size_t(unsigned(length)))
+    throw rti1516e::EncoderException(L"Insufficient buffer size for decoding!");
+  return std::size_t(unsigned(length));
+}
+
+/// Encode a value with the codec C into buffer, replacing its content
+template<typename C>
+inline void
+encodeDataType(std::vector<rti1516e::Octet>& buffer, const typename C::value_type& value)
+{
+  buffer.clear();
+  DataTypeEncoder encoder(buffer);
+  C::encode(encoder, value);
+}
+
+/// Decode a value with the codec C, returns the number of octets decoded
+template<typename C>
+inline std::size_t
+decodeDataType(typename C::value_type& value, const void* data, std::size_t size)
+{
+  DataTypeDecoder decoder(data, size);
+  C::decode(decoder, value);
+  return decoder.getOffset();
+}
+
+} // namespace OpenRTI
+
+#endif
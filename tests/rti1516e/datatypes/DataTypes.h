@@ -0,0 +1,356 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * This file is autogenerated by datatypegen.py. Do not edit!
+ *
+ */
+
+#ifndef DataTypes_DataTypes_h
+#define DataTypes_DataTypes_h
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "DataTypeCodec.h"
+
+namespace DataTypes {
+
+typedef double Meter;
+
+struct MeterCodec : public OpenRTI::HLAfloat64BECodec { };
+
+enum SensorKind {
+  SensorKind_Radar = 1,
+  SensorKind_Sonar = 2,
+  SensorKind_Infrared = 3,
+  SensorKind_Visual = 4
+};
+
+struct SensorKindCodec {
+  typedef SensorKind value_type;
+  enum { octetBoundary = 1, encodedSize = 1 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  { OpenRTI::HLAoctetCodec::write(data, rti1516e::Octet(value)); }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  { rti1516e::Octet representation; OpenRTI::HLAoctetCodec::read(data, representation); value = value_type(static_cast<unsigned char>(representation)); }
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+typedef std::vector<double > Float64Array;
+
+struct Float64ArrayCodec {
+  typedef Float64Array value_type;
+  enum { octetBoundary = 8 };
+
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  {
+    std::size_t size = value.size();
+    encoder.encodeLength(octetBoundary, size);
+    rti1516e::Octet* data = encoder.extend(octetBoundary, size*8);
+    for (std::size_t i = 0; i < size; ++i)
+      OpenRTI::HLAfloat64LECodec::write(data + i*8, value[i]);
+  }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  {
+    std::size_t size = decoder.decodeLength(octetBoundary);
+    const rti1516e::Octet* data = decoder.consume(octetBoundary, size ? (size - 1)*8 + 8 : 0);
+    value.resize(size);
+    for (std::size_t i = 0; i < size; ++i)
+      OpenRTI::HLAfloat64LECodec::read(data + i*8, value[i]);
+  }
+};
+
+typedef OpenRTI::DataTypeFixedArray<float, 9> Matrix3;
+
+struct Matrix3Codec {
+  typedef Matrix3 value_type;
+  enum { octetBoundary = 4, encodedSize = 36 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    for (std::size_t i = 0; i < 9; ++i)
+      OpenRTI::HLAfloat32LECodec::write(data + i*4, value[i]);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    for (std::size_t i = 0; i < 9; ++i)
+      OpenRTI::HLAfloat32LECodec::read(data + i*4, value[i]);
+  }
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct Vector3 {
+  Meter x;
+  Meter y;
+  Meter z;
+};
+
+struct Vector3Codec {
+  typedef Vector3 value_type;
+  enum { octetBoundary = 8, encodedSize = 24 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    MeterCodec::write(data + 0, value.x);
+    MeterCodec::write(data + 8, value.y);
+    MeterCodec::write(data + 16, value.z);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    MeterCodec::read(data + 0, value.x);
+    MeterCodec::read(data + 8, value.y);
+    MeterCodec::read(data + 16, value.z);
+  }
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+struct Orientation {
+  float heading;
+  float pitch;
+  float roll;
+  rti1516e::Integer16 quality;
+};
+
+struct OrientationCodec {
+  typedef Orientation value_type;
+  enum { octetBoundary = 4, encodedSize = 14 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  {
+    OpenRTI::HLAfloat32BECodec::write(data + 0, value.heading);
+    OpenRTI::HLAfloat32BECodec::write(data + 4, value.pitch);
+    OpenRTI::HLAfloat32BECodec::write(data + 8, value.roll);
+    OpenRTI::HLAinteger16LECodec::write(data + 12, value.quality);
+  }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  {
+    OpenRTI::HLAfloat32BECodec::read(data + 0, value.heading);
+    OpenRTI::HLAfloat32BECodec::read(data + 4, value.pitch);
+    OpenRTI::HLAfloat32BECodec::read(data + 8, value.roll);
+    OpenRTI::HLAinteger16LECodec::read(data + 12, value.quality);
+  }
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+typedef rti1516e::Octet HLAASCIIchar;
+
+struct HLAASCIIcharCodec : public OpenRTI::HLAoctetCodec { };
+
+typedef std::string HLAASCIIstring;
+
+struct HLAASCIIstringCodec {
+  typedef HLAASCIIstring value_type;
+  enum { octetBoundary = 4 };
+
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  {
+    std::size_t size = value.size();
+    encoder.encodeLength(octetBoundary, size);
+    rti1516e::Octet* data = encoder.extend(octetBoundary, size);
+    if (size)
+      std::memcpy(data, &value[0], size);
+  }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  {
+    std::size_t size = decoder.decodeLength(octetBoundary);
+    const rti1516e::Octet* data = decoder.consume(octetBoundary, size ? (size - 1)*1 + 1 : 0);
+    value.resize(size);
+    if (size)
+      std::memcpy(&value[0], data, size);
+  }
+};
+
+typedef std::wstring HLAunicodeString;
+
+struct HLAunicodeStringCodec {
+  typedef HLAunicodeString value_type;
+  enum { octetBoundary = 4 };
+
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  {
+    std::size_t size = value.size();
+    encoder.encodeLength(octetBoundary, size);
+    rti1516e::Octet* data = encoder.extend(octetBoundary, size*2);
+    for (std::size_t i = 0; i < size; ++i)
+      OpenRTI::HLAunicodeCharCodec::write(data + i*2, value[i]);
+  }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  {
+    std::size_t size = decoder.decodeLength(octetBoundary);
+    const rti1516e::Octet* data = decoder.consume(octetBoundary, size ? (size - 1)*2 + 2 : 0);
+    value.resize(size);
+    for (std::size_t i = 0; i < size; ++i)
+      OpenRTI::HLAunicodeCharCodec::read(data + i*2, value[i]);
+  }
+};
+
+enum HLAboolean {
+  HLAboolean_HLAfalse = 0,
+  HLAboolean_HLAtrue = 1
+};
+
+struct HLAbooleanCodec {
+  typedef HLAboolean value_type;
+  enum { octetBoundary = 4, encodedSize = 4 };
+
+  static void write(rti1516e::Octet* data, const value_type& value)
+  { OpenRTI::HLAinteger32BECodec::write(data, rti1516e::Integer32(value)); }
+  static void read(const rti1516e::Octet* data, value_type& value)
+  { rti1516e::Integer32 representation; OpenRTI::HLAinteger32BECodec::read(data, representation); value = value_type(representation); }
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  { write(encoder.extend(octetBoundary, encodedSize), value); }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  { read(decoder.consume(octetBoundary, encodedSize), value); }
+};
+
+typedef rti1516e::Octet HLAbyte;
+
+struct HLAbyteCodec : public OpenRTI::HLAoctetCodec { };
+
+typedef std::vector<rti1516e::Octet> HLAopaqueData;
+
+struct HLAopaqueDataCodec {
+  typedef HLAopaqueData value_type;
+  enum { octetBoundary = 4 };
+
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  {
+    std::size_t size = value.size();
+    encoder.encodeLength(octetBoundary, size);
+    rti1516e::Octet* data = encoder.extend(octetBoundary, size);
+    if (size)
+      std::memcpy(data, &value[0], size);
+  }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  {
+    std::size_t size = decoder.decodeLength(octetBoundary);
+    const rti1516e::Octet* data = decoder.consume(octetBoundary, size ? (size - 1)*1 + 1 : 0);
+    value.resize(size);
+    if (size)
+      std::memcpy(&value[0], data, size);
+  }
+};
+
+struct SensorState {
+  SensorKind kind;
+  Vector3 position;
+  Orientation orientation;
+  HLAASCIIstring name;
+  HLAunicodeString label;
+  HLAboolean active;
+  Float64Array samples;
+  Matrix3 rotation;
+  HLAopaqueData payload;
+  rti1516e::Integer64 timeStamp;
+};
+
+struct SensorStateCodec {
+  typedef SensorState value_type;
+  enum { octetBoundary = 8 };
+
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  {
+    encoder.align(octetBoundary);
+    SensorKindCodec::encode(encoder, value.kind);
+    Vector3Codec::encode(encoder, value.position);
+    OrientationCodec::encode(encoder, value.orientation);
+    HLAASCIIstringCodec::encode(encoder, value.name);
+    HLAunicodeStringCodec::encode(encoder, value.label);
+    HLAbooleanCodec::encode(encoder, value.active);
+    Float64ArrayCodec::encode(encoder, value.samples);
+    Matrix3Codec::encode(encoder, value.rotation);
+    HLAopaqueDataCodec::encode(encoder, value.payload);
+    OpenRTI::HLAinteger64BECodec::encode(encoder, value.timeStamp);
+  }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  {
+    decoder.align(octetBoundary);
+    SensorKindCodec::decode(decoder, value.kind);
+    Vector3Codec::decode(decoder, value.position);
+    OrientationCodec::decode(decoder, value.orientation);
+    HLAASCIIstringCodec::decode(decoder, value.name);
+    HLAunicodeStringCodec::decode(decoder, value.label);
+    HLAbooleanCodec::decode(decoder, value.active);
+    Float64ArrayCodec::decode(decoder, value.samples);
+    Matrix3Codec::decode(decoder, value.rotation);
+    HLAopaqueDataCodec::decode(decoder, value.payload);
+    OpenRTI::HLAinteger64BECodec::decode(decoder, value.timeStamp);
+  }
+};
+
+struct SensorData {
+  SensorKind kind;
+  Meter range;
+  Vector3 position;
+};
+
+struct SensorDataCodec {
+  typedef SensorData value_type;
+  enum { octetBoundary = 8 };
+
+  static void encode(OpenRTI::DataTypeEncoder& encoder, const value_type& value)
+  {
+    encoder.align(octetBoundary);
+    SensorKindCodec::encode(encoder, value.kind);
+    switch (value.kind) {
+    case SensorKind_Radar:
+      MeterCodec::encode(encoder, value.range);
+      break;
+    case SensorKind_Sonar:
+    case SensorKind_Infrared:
+      Vector3Codec::encode(encoder, value.position);
+      break;
+    default:
+      break;
+    }
+  }
+  static void decode(OpenRTI::DataTypeDecoder& decoder, value_type& value)
+  {
+    decoder.align(octetBoundary);
+    SensorKindCodec::decode(decoder, value.kind);
+    switch (value.kind) {
+    case SensorKind_Radar:
+      MeterCodec::decode(decoder, value.range);
+      break;
+    case SensorKind_Sonar:
+    case SensorKind_Infrared:
+      Vector3Codec::decode(decoder, value.position);
+      break;
+    default:
+      break;
+    }
+  }
+};
+
+} // namespace DataTypes
+
+#endif
@@ -0,0 +1,291 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include <RTI/VariableLengthData.h>
+#include <RTI/encoding/BasicDataElements.h>
+#include <RTI/encoding/EncodingExceptions.h>
+#include <RTI/encoding/HLAfixedArray.h>
+#include <RTI/encoding/HLAfixedRecord.h>
+#include <RTI/encoding/HLAopaqueData.h>
+#include <RTI/encoding/HLAvariableArray.h>
+
+#include "Clock.h"
+#include "Options.h"
+
+// Generated from DataTypes.xml with
+// datatypegen.py -n DataTypes -r HLAstandardMIM.xml DataTypes.xml
+#include "DataTypes.h"
+
+static void
+createSensorState(DataTypes::SensorState& sensorState, unsigned seed)
+{
+  sensorState.kind = DataTypes::SensorKind(1 + seed % 4);
+  sensorState.position.x = seed + 0.25;
+  sensorState.position.y = seed - 1e7;
+  sensorState.position.z = -0.5*seed;
+  sensorState.orientation.heading = 0.125f*seed;
+  sensorState.orientation.pitch = -0.5f;
+  sensorState.orientation.roll = 3.5f;
+  sensorState.orientation.quality = rti1516e::Integer16(-3*int(seed));
+  sensorState.name = "sensor";
+  sensorState.label = L"\x263a label";
+  sensorState.active = (seed & 1) ? DataTypes::HLAboolean_HLAtrue : DataTypes::HLAboolean_HLAfalse;
+  sensorState.samples.resize(50);
+  for (unsigned i = 0; i < sensorState.samples.size(); ++i)
+    sensorState.samples[i] = seed + 0.5*i;
+  for (unsigned i = 0; i < sensorState.rotation.size(); ++i)
+    sensorState.rotation[i] = float(i) - seed;
+  sensorState.payload.resize(33);
+  for (unsigned i = 0; i < sensorState.payload.size(); ++i)
+    sensorState.payload[i] = rti1516e::Octet(seed + i);
+  sensorState.timeStamp = rti1516e::Integer64(seed) << 40;
+}
+
+// The same values in a data element tree built along the fom
+static void
+createRecord(rti1516e::HLAfixedRecord& record, const DataTypes::SensorState& sensorState)
+{
+  record.appendElement(rti1516e::HLAoctet(rti1516e::Octet(sensorState.kind)));
+  rti1516e::HLAfixedRecord position;
+  position.appendElement(rti1516e::HLAfloat64BE(sensorState.position.x));
+  position.appendElement(rti1516e::HLAfloat64BE(sensorState.position.y));
+  position.appendElement(rti1516e::HLAfloat64BE(sensorState.position.z));
+  record.appendElement(position);
+  rti1516e::HLAfixedRecord orientation;
+  orientation.appendElement(rti1516e::HLAfloat32BE(sensorState.orientation.heading));
+  orientation.appendElement(rti1516e::HLAfloat32BE(sensorState.orientation.pitch));
+  orientation.appendElement(rti1516e::HLAfloat32BE(sensorState.orientation.roll));
+  orientation.appendElement(rti1516e::HLAinteger16LE(sensorState.orientation.quality));
+  record.appendElement(orientation);
+  record.appendElement(rti1516e::HLAASCIIstring(sensorState.name));
+  record.appendElement(rti1516e::HLAunicodeString(sensorState.label));
+  record.appendElement(rti1516e::HLAboolean(sensorState.active == DataTypes::HLAboolean_HLAtrue));
+  rti1516e::HLAvariableArray samples((rti1516e::HLAfloat64LE()));
+  for (unsigned i = 0; i < sensorState.samples.size(); ++i)
+    samples.addElement(rti1516e::HLAfloat64LE(sensorState.samples[i]));
+  record.appendElement(samples);
+  rti1516e::HLAfixedArray rotation(rti1516e::HLAfloat32LE(), sensorState.rotation.size());
+  for (unsigned i = 0; i < sensorState.rotation.size(); ++i)
+    rotation.set(i, rti1516e::HLAfloat32LE(sensorState.rotation[i]));
+  record.appendElement(rotation);
+  record.appendElement(rti1516e::HLAopaqueData(&sensorState.payload.front(), sensorState.payload.size()));
+  record.appendElement(rti1516e::HLAinteger64BE(sensorState.timeStamp));
+}
+
+static bool
+equal(const DataTypes::SensorState& a, const DataTypes::SensorState& b)
+{
+  if (a.kind != b.kind)
+    return false;
+  if (a.position.x != b.position.x || a.position.y != b.position.y || a.position.z != b.position.z)
+    return false;
+  if (a.orientation.heading != b.orientation.heading || a.orientation.pitch != b.orientation.pitch)
+    return false;
+  if (a.orientation.roll != b.orientation.roll || a.orientation.quality != b.orientation.quality)
+    return false;
+  if (a.name != b.name || a.label != b.label || a.active != b.active || a.samples != b.samples)
+    return false;
+  for (unsigned i = 0; i < a.rotation.size(); ++i)
+    if (a.rotation[i] != b.rotation[i])
+      return false;
+  return a.payload == b.payload && a.timeStamp == b.timeStamp;
+}
+
+// The generated codecs must produce the bytes of the data element tree
+static bool
+testRecord()
+{
+  DataTypes::SensorState sensorState;
+  createSensorState(sensorState, 3);
+  std::vector<rti1516e::Octet> buffer;
+  OpenRTI::encodeDataType<DataTypes::SensorStateCodec>(buffer, sensorState);
+
+  rti1516e::HLAfixedRecord record;
+  createRecord(record, sensorState);
+  std::vector<rti1516e::Octet> expected;
+  record.encodeInto(expected);
+  if (buffer != expected) {
+    std::cerr << "Generated codec encodes different bytes than the data elements!" << std::endl;
+    return false;
+  }
+
+  DataTypes::SensorState decoded;
+  createSensorState(decoded, 8);
+  if (OpenRTI::decodeDataType<DataTypes::SensorStateCodec>(decoded, &buffer.front(), buffer.size()) != buffer.size()) {
+    std::cerr << "Generated codec did not decode the whole buffer!" << std::endl;
+    return false;
+  }
+  if (!equal(sensorState, decoded)) {
+    std::cerr << "Record did not survive decoding!" << std::endl;
+    return false;
+  }
+
+  // Truncated data must be detected
+  try {
+    OpenRTI::decodeDataType<DataTypes::SensorStateCodec>(decoded, &buffer.front(), buffer.size() - 1);
+    std::cerr << "Decoding a truncated record did not fail!" << std::endl;
+    return false;
+  } catch (const rti1516e::EncoderException&) {
+  }
+  return true;
+}
+
+// Fixed size records are laid out at compile time, check against the data elements at an odd offset
+static bool
+testFixedSize()
+{
+  DataTypes::Orientation orientation;
+  orientation.heading = 1;
+  orientation.pitch = 2;
+  orientation.roll = 3;
+  orientation.quality = 4;
+  std::vector<rti1516e::Octet> buffer(1, 7);
+  OpenRTI::DataTypeEncoder encoder(buffer);
+  DataTypes::OrientationCodec::encode(encoder, orientation);
+  DataTypes::Vector3 vector3 = { 1, -2, 3 };
+  DataTypes::Vector3Codec::encode(encoder, vector3);
+
+  rti1516e::HLAfixedRecord record;
+  record.appendElement(rti1516e::HLAoctet(7));
+  rti1516e::HLAfixedRecord orientationRecord;
+  orientationRecord.appendElement(rti1516e::HLAfloat32BE(1));
+  orientationRecord.appendElement(rti1516e::HLAfloat32BE(2));
+  orientationRecord.appendElement(rti1516e::HLAfloat32BE(3));
+  orientationRecord.appendElement(rti1516e::HLAinteger16LE(4));
+  record.appendElement(orientationRecord);
+  rti1516e::HLAfixedRecord vector3Record;
+  vector3Record.appendElement(rti1516e::HLAfloat64BE(1));
+  vector3Record.appendElement(rti1516e::HLAfloat64BE(-2));
+  vector3Record.appendElement(rti1516e::HLAfloat64BE(3));
+  record.appendElement(vector3Record);
+  std::vector<rti1516e::Octet> expected;
+  record.encodeInto(expected);
+  if (buffer != expected) {
+    std::cerr << "Fixed size records encode different bytes than the data elements!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// The variant record has no data element counterpart yet, check the layout by hand
+static bool
+testVariant()
+{
+  DataTypes::SensorData sensorData;
+  sensorData.kind = DataTypes::SensorKind_Infrared;
+  sensorData.position.x = 1;
+  sensorData.position.y = 2;
+  sensorData.position.z = 3;
+  std::vector<rti1516e::Octet> buffer;
+  OpenRTI::encodeDataType<DataTypes::SensorDataCodec>(buffer, sensorData);
+
+  std::vector<rti1516e::Octet> expected;
+  rti1516e::HLAoctet(DataTypes::SensorKind_Infrared).encodeInto(expected);
+  rti1516e::HLAfloat64BE(1).encodeInto(expected);
+  rti1516e::HLAfloat64BE(2).encodeInto(expected);
+  rti1516e::HLAfloat64BE(3).encodeInto(expected);
+  if (buffer != expected) {
+    std::cerr << "Variant record encodes unexpected bytes!" << std::endl;
+    return false;
+  }
+
+  DataTypes::SensorData decoded;
+  decoded.kind = DataTypes::SensorKind_Radar;
+  OpenRTI::decodeDataType<DataTypes::SensorDataCodec>(decoded, &buffer.front(), buffer.size());
+  if (decoded.kind != DataTypes::SensorKind_Infrared || decoded.position.z != 3) {
+    std::cerr << "Variant record did not survive decoding!" << std::endl;
+    return false;
+  }
+
+  // Alternatives without data only encode the discriminant
+  sensorData.kind = DataTypes::SensorKind_Visual;
+  OpenRTI::encodeDataType<DataTypes::SensorDataCodec>(buffer, sensorData);
+  if (buffer.size() != 1) {
+    std::cerr << "Variant record without data encodes unexpected bytes!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Time the data element tree against the generated codecs
+static void
+benchmark(unsigned count)
+{
+  DataTypes::SensorState sensorState;
+  createSensorState(sensorState, 3);
+  rti1516e::HLAfixedRecord record;
+  createRecord(record, sensorState);
+  rti1516e::VariableLengthData variableLengthData;
+
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i)
+    record.encode(variableLengthData);
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+  std::cout << "encode data elements: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i)
+    record.decode(variableLengthData);
+  stop = OpenRTI::Clock::now();
+  std::cout << "decode data elements: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+
+  std::vector<rti1516e::Octet> buffer;
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i)
+    OpenRTI::encodeDataType<DataTypes::SensorStateCodec>(buffer, sensorState);
+  stop = OpenRTI::Clock::now();
+  std::cout << "encode generated codec: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+
+  DataTypes::SensorState decoded;
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i)
+    OpenRTI::decodeDataType<DataTypes::SensorStateCodec>(decoded, &buffer.front(), buffer.size());
+  stop = OpenRTI::Clock::now();
+  std::cout << "decode generated codec: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned count = 10000;
+  OpenRTI::Options options(argc, argv);
+  while (options.next("n:")) {
+    switch (options.getOptChar()) {
+    case 'n':
+      count = atoi(options.getArgument().c_str());
+      break;
+    }
+  }
+
+  if (!testRecord())
+    return EXIT_FAILURE;
+  if (!testFixedSize())
+    return EXIT_FAILURE;
+  if (!testVariant())
+    return EXIT_FAILURE;
+
+  benchmark(count);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,532 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include <RTI/VariableLengthData.h>
+#include <RTI/encoding/BasicDataElements.h>
+#include <RTI/encoding/EncodingExceptions.h>
+#include <RTI/encoding/HLAfixedArray.h>
+#include <RTI/encoding/HLAfixedRecord.h>
+#include <RTI/encoding/HLAopaqueData.h>
+#include <RTI/encoding/HLAvariableArray.h>
+
+#include "Clock.h"
+#include "Options.h"
+
+// Count the allocations of the whole process
+static unsigned long allocations = 0;
+
+void* operator new(std::size_t size)
+{
+  ++allocations;
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+void operator delete(void* p) throw()
+{
+  std::free(p);
+}
+void operator delete[](void* p) throw()
+{
+  std::free(p);
+}
+void operator delete(void* p, std::size_t) throw()
+{
+  std::free(p);
+}
+void operator delete[](void* p, std::size_t) throw()
+{
+  std::free(p);
+}
+
+// An application data element, that is only accessible through the standard api
+class OPENRTI_LOCAL ApplicationInteger : public rti1516e::HLAinteger32BE {
+public:
+  ApplicationInteger() :
+    _decodeCount(0)
+  { }
+  virtual RTI_UNIQUE_PTR<rti1516e::DataElement> clone() const
+  { return RTI_UNIQUE_PTR<rti1516e::DataElement>(new ApplicationInteger(*this)); }
+  virtual size_t decodeFrom(std::vector<rti1516e::Octet> const& buffer, size_t index)
+  {
+    ++_decodeCount;
+    return rti1516e::HLAinteger32BE::decodeFrom(buffer, index);
+  }
+  unsigned _decodeCount;
+};
+
+// A record of about 1KB with most kinds of data elements
+static void
+createRecord(rti1516e::HLAfixedRecord& record, unsigned seed)
+{
+  record.appendElement(rti1516e::HLAoctet(rti1516e::Octet(seed)));
+  rti1516e::HLAfixedArray fixedArray(rti1516e::HLAfloat64BE(), 120);
+  for (unsigned i = 0; i < 120; ++i)
+    fixedArray.set(i, rti1516e::HLAfloat64BE(seed + 0.5*i));
+  record.appendElement(fixedArray);
+  record.appendElement(rti1516e::HLAASCIIstring(std::string("some string")));
+  rti1516e::HLAvariableArray variableArray((rti1516e::HLAinteger16LE()));
+  for (unsigned i = 0; i < 50; ++i)
+    variableArray.addElement(rti1516e::HLAinteger16LE(rti1516e::Integer16(seed*i)));
+  record.appendElement(variableArray);
+  rti1516e::Octet opaque[64];
+  for (unsigned i = 0; i < sizeof(opaque); ++i)
+    opaque[i] = rti1516e::Octet(seed + i);
+  record.appendElement(rti1516e::HLAopaqueData(opaque, sizeof(opaque)));
+  record.appendElement(rti1516e::HLAboolean(seed & 1));
+}
+
+static bool
+equal(const rti1516e::VariableLengthData& variableLengthData, const std::vector<rti1516e::Octet>& buffer)
+{
+  if (variableLengthData.size() != buffer.size())
+    return false;
+  return buffer.empty() || 0 == std::memcmp(variableLengthData.data(), &buffer.front(), buffer.size());
+}
+
+// Encoding into a VariableLengthData must result in the same bytes as the std::vector api
+static bool
+testEncode()
+{
+  rti1516e::HLAfixedRecord record;
+  createRecord(record, 3);
+  std::vector<rti1516e::Octet> buffer;
+  record.encodeInto(buffer);
+  rti1516e::VariableLengthData variableLengthData = record.encode();
+  if (!equal(variableLengthData, buffer)) {
+    std::cerr << "Encoding into VariableLengthData differs from encodeInto!" << std::endl;
+    return false;
+  }
+  if (buffer.size() < 1024) {
+    std::cerr << "Record is smaller than expected!" << std::endl;
+    return false;
+  }
+
+  // Encoding again reuses the VariableLengthData
+  record.encode(variableLengthData);
+  if (!equal(variableLengthData, buffer)) {
+    std::cerr << "Encoding into VariableLengthData differs from encodeInto!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Decoding from a VariableLengthData must not allocate once the record has its shape
+static bool
+testDecode()
+{
+  rti1516e::HLAfixedRecord record;
+  createRecord(record, 3);
+  rti1516e::VariableLengthData variableLengthData = record.encode();
+
+  rti1516e::HLAfixedRecord decoded;
+  createRecord(decoded, 7);
+  unsigned long count = allocations;
+  decoded.decode(variableLengthData);
+  if (count != allocations) {
+    std::cerr << "Decoding allocated " << allocations - count << " times!" << std::endl;
+    return false;
+  }
+  std::vector<rti1516e::Octet> buffer;
+  decoded.encodeInto(buffer);
+  if (!equal(variableLengthData, buffer)) {
+    std::cerr << "Record did not survive decoding!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Data elements derived by the application keep being called through the standard api
+static bool
+testApplicationDataElement()
+{
+  rti1516e::HLAfixedRecord record;
+  record.appendElement(rti1516e::HLAoctet(1));
+  ApplicationInteger integer;
+  integer.set(0x12345678);
+  record.appendElement(integer);
+  std::vector<rti1516e::Octet> buffer;
+  record.encodeInto(buffer);
+  rti1516e::VariableLengthData variableLengthData = record.encode();
+  if (!equal(variableLengthData, buffer)) {
+    std::cerr << "Encoding with application data element differs from encodeInto!" << std::endl;
+    return false;
+  }
+
+  ApplicationInteger* decodedInteger = new ApplicationInteger;
+  rti1516e::HLAfixedRecord decoded;
+  decoded.appendElement(rti1516e::HLAoctet());
+  decoded.appendElementPointer(decodedInteger);
+  decoded.decode(variableLengthData);
+  if (decodedInteger->_decodeCount != 1 || decodedInteger->get() != 0x12345678) {
+    std::cerr << "Application data element was not decoded through the standard api!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Arrays of basic data elements are encoded in bulk, check the bytes against the element wise encoding
+static bool
+testArray(unsigned count)
+{
+  rti1516e::HLAvariableArray variableArray((rti1516e::HLAfloat64BE()));
+  for (unsigned i = 0; i < count; ++i)
+    variableArray.addElement(rti1516e::HLAfloat64BE(0.25*i - 3));
+  rti1516e::HLAfixedArray fixedArray(rti1516e::HLAinteger16LE(), count);
+  for (unsigned i = 0; i < count; ++i)
+    fixedArray.set(i, rti1516e::HLAinteger16LE(rti1516e::Integer16(7*i)));
+  // Start at an odd offset to see the alignment
+  rti1516e::HLAfixedRecord record;
+  record.appendElement(rti1516e::HLAoctet(1));
+  record.appendElement(fixedArray);
+  record.appendElement(rti1516e::HLAoctet(2));
+  record.appendElement(variableArray);
+
+  std::vector<rti1516e::Octet> expected;
+  rti1516e::HLAoctet(1).encodeInto(expected);
+  for (unsigned i = 0; i < count; ++i)
+    fixedArray.get(i).encodeInto(expected);
+  rti1516e::HLAoctet(2).encodeInto(expected);
+  // The variable array aligns its length to the boundary of the elements
+  while (expected.size() % 8)
+    expected.push_back(0);
+  rti1516e::HLAinteger32BE(rti1516e::Integer32(count)).encodeInto(expected);
+  for (unsigned i = 0; i < count; ++i)
+    variableArray.get(i).encodeInto(expected);
+
+  std::vector<rti1516e::Octet> buffer;
+  record.encodeInto(buffer);
+  if (buffer != expected) {
+    std::cerr << "Bulk encoded array differs from the encoding of its elements!" << std::endl;
+    return false;
+  }
+  rti1516e::VariableLengthData variableLengthData = record.encode();
+  if (!equal(variableLengthData, expected) || record.getEncodedLength() != expected.size()) {
+    std::cerr << "Bulk encoded array differs from the encoding of its elements!" << std::endl;
+    return false;
+  }
+
+  rti1516e::HLAvariableArray decodedVariableArray((rti1516e::HLAfloat64BE()));
+  rti1516e::HLAfixedArray decodedFixedArray(rti1516e::HLAinteger16LE(), count);
+  rti1516e::HLAfixedRecord decoded;
+  decoded.appendElement(rti1516e::HLAoctet());
+  decoded.appendElement(decodedFixedArray);
+  decoded.appendElement(rti1516e::HLAoctet());
+  decoded.appendElement(decodedVariableArray);
+  decoded.decode(variableLengthData);
+  buffer.clear();
+  decoded.encodeInto(buffer);
+  if (buffer != expected) {
+    std::cerr << "Bulk decoded array differs from the original!" << std::endl;
+    return false;
+  }
+
+  // Truncated data must be detected
+  expected.resize(expected.size() - 1);
+  try {
+    decoded.decodeFrom(expected, 0);
+    std::cerr << "Decoding a truncated array did not fail!" << std::endl;
+    return false;
+  } catch (const rti1516e::EncoderException&) {
+  }
+  return true;
+}
+
+// Append the encoding of a data element behind a std::vector the way the records do
+static void
+appendAligned(std::vector<rti1516e::Octet>& buffer, const rti1516e::DataElement& dataElement)
+{
+  while (buffer.size() % dataElement.getOctetBoundary())
+    buffer.push_back(0);
+  dataElement.encodeInto(buffer);
+}
+
+// A record with fields of fixed size only, some of them held by pointer
+struct FixedRecord {
+  FixedRecord() :
+    octet(new rti1516e::HLAoctet(1)),
+    x(new rti1516e::HLAfloat64BE(1)),
+    position(new rti1516e::HLAfixedRecord),
+    timeStamp(new rti1516e::HLAinteger64BE(3))
+  {
+    position->appendElementPointer(x);
+    position->appendElement(rti1516e::HLAfloat64BE(2));
+    position->appendElement(rti1516e::HLAfloat64BE(3));
+    record.appendElementPointer(octet);
+    record.appendElementPointer(position);
+    rti1516e::HLAfixedArray matrix(rti1516e::HLAfloat32LE(), 9);
+    for (unsigned i = 0; i < 9; ++i)
+      matrix.set(i, rti1516e::HLAfloat32LE(float(i)));
+    record.appendElement(matrix);
+    record.appendElement(rti1516e::HLAinteger16LE(7));
+    record.appendElementPointer(timeStamp);
+  }
+
+  // The encoding built field by field
+  std::vector<rti1516e::Octet> getExpected() const
+  {
+    std::vector<rti1516e::Octet> expected;
+    for (size_t i = 0; i < record.size(); ++i) {
+      const rti1516e::HLAfixedRecord* fixedRecord = dynamic_cast<const rti1516e::HLAfixedRecord*>(&record.get(i));
+      const rti1516e::HLAfixedArray* fixedArray = dynamic_cast<const rti1516e::HLAfixedArray*>(&record.get(i));
+      if (fixedRecord) {
+        while (expected.size() % fixedRecord->getOctetBoundary())
+          expected.push_back(0);
+        for (size_t j = 0; j < fixedRecord->size(); ++j)
+          appendAligned(expected, fixedRecord->get(j));
+      } else if (fixedArray) {
+        for (size_t j = 0; j < fixedArray->size(); ++j)
+          appendAligned(expected, fixedArray->get(j));
+      } else {
+        appendAligned(expected, record.get(i));
+      }
+    }
+    return expected;
+  }
+
+  rti1516e::HLAfixedRecord record;
+  rti1516e::HLAoctet* octet;
+  rti1516e::HLAfloat64BE* x;
+  rti1516e::HLAfixedRecord* position;
+  rti1516e::HLAinteger64BE* timeStamp;
+};
+
+// Records of fixed size fields are laid out once and encoded in place
+static bool
+testFixedLayout()
+{
+  FixedRecord fixedRecord;
+  rti1516e::VariableLengthData variableLengthData = fixedRecord.record.encode();
+  if (!equal(variableLengthData, fixedRecord.getExpected())) {
+    std::cerr << "Fixed layout encodes different bytes than the fields!" << std::endl;
+    return false;
+  }
+
+  // Values changed through the pointers of the application
+  fixedRecord.octet->set(9);
+  fixedRecord.x->set(-1e300);
+  fixedRecord.timeStamp->set(-5);
+  unsigned long count = allocations;
+  fixedRecord.record.encode(variableLengthData);
+  if (count != allocations) {
+    std::cerr << "Encoding a fixed layout into a used VariableLengthData allocated "
+              << allocations - count << " times!" << std::endl;
+    return false;
+  }
+  if (!equal(variableLengthData, fixedRecord.getExpected())) {
+    std::cerr << "Fixed layout encodes stale values!" << std::endl;
+    return false;
+  }
+
+  // A nested record changing its layout behind the back of the outer record
+  fixedRecord.position->appendElement(rti1516e::HLAoctet(2));
+  fixedRecord.record.encode(variableLengthData);
+  if (!equal(variableLengthData, fixedRecord.getExpected()) ||
+      fixedRecord.record.getEncodedLength() != variableLengthData.size()) {
+    std::cerr << "Fixed layout did not notice the change of a nested record!" << std::endl;
+    return false;
+  }
+
+  // And a field of variable size switches back to the general path
+  fixedRecord.record.appendElement(rti1516e::HLAASCIIstring("variable"));
+  fixedRecord.record.encode(variableLengthData);
+  std::vector<rti1516e::Octet> expected = fixedRecord.getExpected();
+  if (!equal(variableLengthData, expected) || fixedRecord.record.getEncodedLength() != expected.size()) {
+    std::cerr << "Record with a variable size field encodes unexpected bytes!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// The hash of DataElement as it was computed from a temporary std::vector
+static rti1516e::Integer64
+referenceHash(const rti1516e::DataElement& dataElement)
+{
+  std::vector<rti1516e::Octet> buffer;
+  dataElement.encodeInto(buffer);
+  rti1516e::Integer64 hash = 8191;
+  for (std::vector<rti1516e::Octet>::const_iterator i = buffer.begin(); i != buffer.end(); ++i)
+    hash = hash*rti1516e::Integer64(127) + rti1516e::Integer64(*i);
+  return hash;
+}
+
+// Hashing records and arrays must give the same values without allocating
+static bool
+testHash()
+{
+  rti1516e::HLAfixedRecord record;
+  createRecord(record, 3);
+  unsigned long count = allocations;
+  rti1516e::Integer64 hash = record.hash();
+  if (count != allocations) {
+    std::cerr << "Hashing allocated " << allocations - count << " times!" << std::endl;
+    return false;
+  }
+  if (hash != referenceHash(record)) {
+    std::cerr << "Hash of the record differs from the hash of its encoding!" << std::endl;
+    return false;
+  }
+
+  rti1516e::HLAvariableArray variableArray((rti1516e::HLAinteger16BE()));
+  for (unsigned i = 0; i < 99; ++i)
+    variableArray.addElement(rti1516e::HLAinteger16BE(rti1516e::Integer16(-5*int(i))));
+  if (variableArray.hash() != referenceHash(variableArray)) {
+    std::cerr << "Hash of the array differs from the hash of its encoding!" << std::endl;
+    return false;
+  }
+
+  // Data elements of the application are hashed through their encoding
+  record.appendElement(rti1516e::HLAoctet(1));
+  ApplicationInteger integer;
+  integer.set(0x12345678);
+  record.appendElement(integer);
+  if (record.hash() != referenceHash(record)) {
+    std::cerr << "Hash with application data element differs from the hash of its encoding!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Time decoding the record through a copied std::vector and directly
+static void
+benchmark(unsigned count)
+{
+  rti1516e::HLAfixedRecord record;
+  createRecord(record, 3);
+  rti1516e::VariableLengthData variableLengthData = record.encode();
+  rti1516e::HLAfixedRecord decoded;
+  createRecord(decoded, 7);
+
+  OpenRTI::Clock start = OpenRTI::Clock::now();
+  unsigned long count0 = allocations;
+  for (unsigned i = 0; i < count; ++i) {
+    std::vector<rti1516e::Octet> buffer(variableLengthData.size());
+    std::memcpy(&buffer.front(), variableLengthData.data(), variableLengthData.size());
+    decoded.decodeFrom(buffer, 0);
+  }
+  OpenRTI::Clock stop = OpenRTI::Clock::now();
+  std::cout << "decode through std::vector: " << double((stop - start).getNSec())/count << " nsec, "
+            << double(allocations - count0)/count << " allocations per record" << std::endl;
+
+  start = OpenRTI::Clock::now();
+  count0 = allocations;
+  for (unsigned i = 0; i < count; ++i)
+    decoded.decode(variableLengthData);
+  stop = OpenRTI::Clock::now();
+  std::cout << "decode from VariableLengthData: " << double((stop - start).getNSec())/count << " nsec, "
+            << double(allocations - count0)/count << " allocations per record" << std::endl;
+
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i) {
+    std::vector<rti1516e::Octet> buffer;
+    buffer.reserve(record.getEncodedLength());
+    record.encodeInto(buffer);
+    variableLengthData.setData(&buffer.front(), buffer.size());
+  }
+  stop = OpenRTI::Clock::now();
+  std::cout << "encode through std::vector: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i)
+    record.encode(variableLengthData);
+  stop = OpenRTI::Clock::now();
+  std::cout << "encode into VariableLengthData: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+
+  // A large array of floats
+  rti1516e::HLAvariableArray variableArray((rti1516e::HLAfloat64BE()));
+  for (unsigned i = 0; i < 10000; ++i)
+    variableArray.addElement(rti1516e::HLAfloat64BE(i));
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count/100; ++i)
+    variableArray.encode(variableLengthData);
+  stop = OpenRTI::Clock::now();
+  std::cout << "encode 10000 HLAfloat64BE: " << double((stop - start).getNSec())/(count/100) << " nsec" << std::endl;
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count/100; ++i)
+    variableArray.decode(variableLengthData);
+  stop = OpenRTI::Clock::now();
+  std::cout << "decode 10000 HLAfloat64BE: " << double((stop - start).getNSec())/(count/100) << " nsec" << std::endl;
+
+  FixedRecord fixedRecord;
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i) {
+    fixedRecord.x->set(i);
+    fixedRecord.record.encode(variableLengthData);
+  }
+  stop = OpenRTI::Clock::now();
+  std::cout << "encode fixed layout: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+
+  rti1516e::Integer64 hash = 0;
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i)
+    hash += referenceHash(record);
+  stop = OpenRTI::Clock::now();
+  std::cout << "hash through std::vector: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count; ++i)
+    hash -= record.hash();
+  stop = OpenRTI::Clock::now();
+  std::cout << "hash streaming: " << double((stop - start).getNSec())/count << " nsec per record" << std::endl;
+  start = OpenRTI::Clock::now();
+  for (unsigned i = 0; i < count/100; ++i)
+    hash += variableArray.hash();
+  stop = OpenRTI::Clock::now();
+  std::cout << "hash 10000 HLAfloat64BE: " << double((stop - start).getNSec())/(count/100) << " nsec" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned count = 10000;
+  OpenRTI::Options options(argc, argv);
+  while (options.next("n:")) {
+    switch (options.getOptChar()) {
+    case 'n':
+      count = atoi(options.getArgument().c_str());
+      break;
+    }
+  }
+
+  if (!testEncode())
+    return EXIT_FAILURE;
+  if (!testDecode())
+    return EXIT_FAILURE;
+  if (!testApplicationDataElement())
+    return EXIT_FAILURE;
+  if (!testArray(1000))
+    return EXIT_FAILURE;
+  if (!testHash())
+    return EXIT_FAILURE;
+  if (!testFixedLayout())
+    return EXIT_FAILURE;
+
+  benchmark(count);
+
+  return EXIT_SUCCESS;
+}
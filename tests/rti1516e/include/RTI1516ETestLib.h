@@ -787,6 +787,9 @@ public:
   const rti1516e::FederateHandle& getFederateHandle() const
   { return _federateHandle; }
 
+  rti1516e::RTIambassador& getRTIambassador()
+  { return *_ambassador; }
+
   void connect(const std::wstring& url)
   {
     rti1516e::RTIambassadorFactory factory;
@@ -940,9 +943,9 @@ public:
 
   void subscribeObjectClassAttributes(const rti1516e::ObjectClassHandle& objectClassHandle,
                                       const rti1516e::AttributeHandleSet& attributeHandleSet,
-                                      bool active = true)
+                                      bool active = true, const std::wstring& updateRateDesignator = std::wstring())
   {
-      _ambassador->subscribeObjectClassAttributes(objectClassHandle, attributeHandleSet, active);
+      _ambassador->subscribeObjectClassAttributes(objectClassHandle, attributeHandleSet, active, updateRateDesignator);
       // _subscribedObjectClassAttributeHandleSetMap[objectClassHandle].insert(attributeHandleSet.begin(), attributeHandleSet.end());
   }
 
@@ -1049,6 +1052,18 @@ public:
     _ambassador->requestInteractionTransportationTypeChange(interactionClassHandle, transportationType);
   }
 
+  void queryAttributeTransportationType(const rti1516e::ObjectInstanceHandle& objectInstanceHandle,
+                                        const rti1516e::AttributeHandle& attributeHandle)
+  {
+    _ambassador->queryAttributeTransportationType(objectInstanceHandle, attributeHandle);
+  }
+
+  void queryInteractionTransportationType(const rti1516e::FederateHandle& federateHandle,
+                                          const rti1516e::InteractionClassHandle& interactionClassHandle)
+  {
+    _ambassador->queryInteractionTransportationType(federateHandle, interactionClassHandle);
+  }
+
   void requestAttributeValueUpdate(const rti1516e::ObjectInstanceHandle& objectInstanceHandle,
                                    const rti1516e::AttributeHandleSet& attributeHandleSet,
                                    const rti1516e::VariableLengthData& tag)
@@ -0,0 +1,303 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <string>
+#include <map>
+#include <iostream>
+
+#include <RTI/RTIambassadorFactory.h>
+#include <RTI/RTIambassador.h>
+
+#include <TestLib.h>
+#include <RTI1516ETestLib.h>
+
+namespace OpenRTI {
+
+class OPENRTI_LOCAL TransportationAmbassador : public RTI1516ESimpleAmbassador {
+public:
+  TransportationAmbassador() :
+    _discovered(false),
+    _attributeConfirmCount(0),
+    _interactionConfirmCount(0),
+    _reportCount(0),
+    _reportedTransportationType(rti1516e::RELIABLE),
+    _reliableCount(0),
+    _bestEffortCount(0)
+  { }
+  virtual ~TransportationAmbassador()
+    RTI_NOEXCEPT
+  { }
+
+  virtual void discoverObjectInstance(rti1516e::ObjectInstanceHandle theObject, rti1516e::ObjectClassHandle theObjectClass,
+                                      std::wstring const & theObjectInstanceName)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    _discovered = true;
+  }
+
+  virtual void reflectAttributeValues(rti1516e::ObjectInstanceHandle theObject, rti1516e::AttributeHandleValueMap const & theAttributeValues,
+                                      rti1516e::VariableLengthData const & theUserSuppliedTag, rti1516e::OrderType sentOrder,
+                                      rti1516e::TransportationType theType, rti1516e::SupplementalReflectInfo theReflectInfo)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    count(theType);
+  }
+
+  virtual void receiveInteraction(rti1516e::InteractionClassHandle theInteraction, rti1516e::ParameterHandleValueMap const & theParameterValues,
+                                  rti1516e::VariableLengthData const & theUserSuppliedTag, rti1516e::OrderType sentOrder, rti1516e::TransportationType theType,
+                                  rti1516e::SupplementalReceiveInfo theReceiveInfo)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    count(theType);
+  }
+
+  virtual void confirmAttributeTransportationTypeChange(rti1516e::ObjectInstanceHandle theObject,
+                                                        rti1516e::AttributeHandleSet theAttributes,
+                                                        rti1516e::TransportationType theTransportation)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    ++_attributeConfirmCount;
+  }
+
+  virtual void reportAttributeTransportationType(rti1516e::ObjectInstanceHandle theObject,
+                                                 rti1516e::AttributeHandle theAttribute,
+                                                 rti1516e::TransportationType theTransportation)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    ++_reportCount;
+    _reportedTransportationType = theTransportation;
+  }
+
+  virtual void confirmInteractionTransportationTypeChange(rti1516e::InteractionClassHandle theInteraction,
+                                                          rti1516e::TransportationType theTransportation)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    ++_interactionConfirmCount;
+  }
+
+  virtual void reportInteractionTransportationType(rti1516e::FederateHandle federateHandle,
+                                                   rti1516e::InteractionClassHandle theInteraction,
+                                                   rti1516e::TransportationType theTransportation)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    ++_reportCount;
+    _reportedTransportationType = theTransportation;
+  }
+
+  void count(rti1516e::TransportationType transportationType)
+  {
+    if (transportationType == rti1516e::BEST_EFFORT)
+      ++_bestEffortCount;
+    else
+      ++_reliableCount;
+  }
+
+  // Wait for the next report and return the reported type
+  bool waitForReport(rti1516e::TransportationType& transportationType)
+  {
+    unsigned reportCount = _reportCount;
+    Clock timeout = Clock::now() + Clock::fromSeconds(10);
+    while (reportCount == _reportCount) {
+      evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for transportation type report!" << std::endl;
+        return false;
+      }
+    }
+    transportationType = _reportedTransportationType;
+    return true;
+  }
+
+  bool _discovered;
+  unsigned _attributeConfirmCount;
+  unsigned _interactionConfirmCount;
+  unsigned _reportCount;
+  rti1516e::TransportationType _reportedTransportationType;
+  unsigned _reliableCount;
+  unsigned _bestEffortCount;
+};
+
+class OPENRTI_LOCAL TestAmbassador : public RTITest::Ambassador {
+public:
+  TestAmbassador(const RTITest::ConstructorArgs& constructorArgs) :
+    RTITest::Ambassador(constructorArgs)
+  { }
+
+  virtual bool exec()
+  {
+    try {
+      return execConnected();
+    } catch (const rti1516e::Exception& e) {
+      std::wcout << L"rti1516e::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+  }
+
+  bool execConnected()
+  {
+    TransportationAmbassador publisher;
+    publisher.connect(getConnectUrl());
+    TransportationAmbassador subscriber;
+    subscriber.connect(getConnectUrl());
+
+    publisher.createFederationExecution(getFederationExecution(), getFddFile());
+    rti1516e::FederateHandle publisherHandle = publisher.joinFederationExecution(L"publisher", getFederationExecution());
+    subscriber.joinFederationExecution(L"subscriber", getFederationExecution());
+
+    rti1516e::ObjectClassHandle objectClassHandle = publisher.getObjectClassHandle(L"ObjectClass");
+    rti1516e::AttributeHandle attributeHandle0 = publisher.getAttributeHandle(objectClassHandle, L"Attribute0");
+    rti1516e::AttributeHandle attributeHandle1 = publisher.getAttributeHandle(objectClassHandle, L"Attribute1");
+    rti1516e::AttributeHandleSet attributeHandleSet;
+    attributeHandleSet.insert(attributeHandle0);
+    attributeHandleSet.insert(attributeHandle1);
+    rti1516e::InteractionClassHandle interactionClassHandle = publisher.getInteractionClassHandle(L"InteractionClass");
+    rti1516e::ParameterHandle parameterHandle = publisher.getParameterHandle(interactionClassHandle, L"Parameter0");
+
+    publisher.publishObjectClassAttributes(objectClassHandle, attributeHandleSet);
+    publisher.publishInteractionClass(interactionClassHandle);
+    subscriber.subscribeObjectClassAttributes(objectClassHandle, attributeHandleSet);
+    subscriber.subscribeInteractionClass(interactionClassHandle);
+
+    rti1516e::ObjectInstanceHandle objectInstanceHandle = publisher.registerObjectInstance(objectClassHandle);
+    Clock timeout = Clock::now() + Clock::fromSeconds(10);
+    while (!subscriber._discovered) {
+      subscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for object instance discovery!" << std::endl;
+        return false;
+      }
+    }
+
+    // Only the owner may change the transportation type
+    rti1516e::AttributeHandleSet bestEffortAttributeHandleSet;
+    bestEffortAttributeHandleSet.insert(attributeHandle0);
+    try {
+      subscriber.requestAttributeTransportationTypeChange(objectInstanceHandle, bestEffortAttributeHandleSet, rti1516e::BEST_EFFORT);
+      std::wcout << L"Transportation type change of a not owned attribute did not fail!" << std::endl;
+      return false;
+    } catch (const rti1516e::AttributeNotOwned&) {
+    }
+    try {
+      subscriber.requestInteractionTransportationTypeChange(interactionClassHandle, rti1516e::BEST_EFFORT);
+      std::wcout << L"Transportation type change of a not published interaction class did not fail!" << std::endl;
+      return false;
+    } catch (const rti1516e::InteractionClassNotPublished&) {
+    }
+
+    publisher.requestAttributeTransportationTypeChange(objectInstanceHandle, bestEffortAttributeHandleSet, rti1516e::BEST_EFFORT);
+    publisher.requestInteractionTransportationTypeChange(interactionClassHandle, rti1516e::BEST_EFFORT);
+    timeout = Clock::now() + Clock::fromSeconds(10);
+    while (publisher._attributeConfirmCount == 0 || publisher._interactionConfirmCount == 0) {
+      publisher.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for transportation type change confirmation!" << std::endl;
+        return false;
+      }
+    }
+
+    // Any federate sees the changed types from now on
+    rti1516e::TransportationType transportationType;
+    subscriber.queryAttributeTransportationType(objectInstanceHandle, attributeHandle0);
+    if (!subscriber.waitForReport(transportationType))
+      return false;
+    if (transportationType != rti1516e::BEST_EFFORT) {
+      std::wcout << L"Changed attribute transportation type is not reported!" << std::endl;
+      return false;
+    }
+    subscriber.queryAttributeTransportationType(objectInstanceHandle, attributeHandle1);
+    if (!subscriber.waitForReport(transportationType))
+      return false;
+    if (transportationType != rti1516e::RELIABLE) {
+      std::wcout << L"Unchanged attribute transportation type is not reported as reliable!" << std::endl;
+      return false;
+    }
+    subscriber.queryInteractionTransportationType(publisherHandle, interactionClassHandle);
+    if (!subscriber.waitForReport(transportationType))
+      return false;
+    if (transportationType != rti1516e::BEST_EFFORT) {
+      std::wcout << L"Changed interaction transportation type is not reported!" << std::endl;
+      return false;
+    }
+    subscriber.queryInteractionTransportationType(subscriber.getFederateHandle(), interactionClassHandle);
+    if (!subscriber.waitForReport(transportationType))
+      return false;
+    if (transportationType != rti1516e::RELIABLE) {
+      std::wcout << L"Interaction transportation type of an other federate is not the default!" << std::endl;
+      return false;
+    }
+
+    // Updates and interactions go with the new types, the reliable ones arrive in any case
+    unsigned count = 10;
+    for (unsigned i = 0; i < count; ++i) {
+      rti1516e::AttributeHandleValueMap attributeValues;
+      attributeValues[attributeHandle0] = toVariableLengthData(i);
+      publisher.updateAttributeValues(objectInstanceHandle, attributeValues, rti1516e::VariableLengthData());
+      attributeValues.clear();
+      attributeValues[attributeHandle1] = toVariableLengthData(i);
+      publisher.updateAttributeValues(objectInstanceHandle, attributeValues, rti1516e::VariableLengthData());
+      rti1516e::ParameterHandleValueMap parameterValues;
+      parameterValues[parameterHandle] = toVariableLengthData(i);
+      publisher.sendInteraction(interactionClassHandle, parameterValues, rti1516e::VariableLengthData());
+    }
+    timeout = Clock::now() + Clock::fromSeconds(10);
+    while (subscriber._reliableCount < count || subscriber._bestEffortCount < 2*count) {
+      subscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for reflections and interactions: got " << subscriber._reliableCount
+                   << L" reliable and " << subscriber._bestEffortCount << L" best effort!" << std::endl;
+        return false;
+      }
+    }
+    if (subscriber._reliableCount != count) {
+      std::wcout << L"Best effort messages are delivered as reliable!" << std::endl;
+      return false;
+    }
+
+    subscriber.resignFederationExecution(rti1516e::NO_ACTION);
+    publisher.resignFederationExecution(rti1516e::DELETE_OBJECTS);
+    publisher.destroyFederationExecution(getFederationExecution());
+
+    return true;
+  }
+};
+
+class OPENRTI_LOCAL Test : public RTITest {
+public:
+  Test(int argc, const char* const argv[]) :
+    RTITest(argc, argv, false)
+  { }
+
+  virtual Ambassador* createAmbassador(const ConstructorArgs& constructorArgs)
+  {
+    return new TestAmbassador(constructorArgs);
+  }
+};
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::Test test(argc, argv);
+  return test.exec();
+}
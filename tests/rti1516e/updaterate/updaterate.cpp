@@ -0,0 +1,196 @@
+/* -*-c++-*- OpenRTI - Copyright (C) 2009-2023 Mathias Froehlich
+ *
+ * This file is part of OpenRTI.
+ *
+ * OpenRTI is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenRTI is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with OpenRTI.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <string>
+#include <map>
+#include <iostream>
+
+#include <RTI/RTIambassadorFactory.h>
+#include <RTI/RTIambassador.h>
+
+#include <TestLib.h>
+#include <RTI1516ETestLib.h>
+
+namespace OpenRTI {
+
+class OPENRTI_LOCAL ReflectingAmbassador : public RTI1516ESimpleAmbassador {
+public:
+  ReflectingAmbassador() :
+    _discovered(false),
+    _reflectCount(0)
+  { }
+  virtual ~ReflectingAmbassador()
+    RTI_NOEXCEPT
+  { }
+
+  virtual void discoverObjectInstance(rti1516e::ObjectInstanceHandle theObject, rti1516e::ObjectClassHandle theObjectClass,
+                                      std::wstring const & theObjectInstanceName)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    _discovered = true;
+  }
+
+  virtual void reflectAttributeValues(rti1516e::ObjectInstanceHandle theObject, rti1516e::AttributeHandleValueMap const & theAttributeValues,
+                                      rti1516e::VariableLengthData const & theUserSuppliedTag, rti1516e::OrderType sentOrder,
+                                      rti1516e::TransportationType theType, rti1516e::SupplementalReflectInfo theReflectInfo)
+    RTI_THROW ((rti1516e::FederateInternalError))
+  {
+    ++_reflectCount;
+    for (rti1516e::AttributeHandleValueMap::const_iterator i = theAttributeValues.begin(); i != theAttributeValues.end(); ++i)
+      _attributeValues[i->first] = i->second;
+  }
+
+  bool _discovered;
+  unsigned _reflectCount;
+  rti1516e::AttributeHandleValueMap _attributeValues;
+};
+
+class OPENRTI_LOCAL TestAmbassador : public RTITest::Ambassador {
+public:
+  TestAmbassador(const RTITest::ConstructorArgs& constructorArgs) :
+    RTITest::Ambassador(constructorArgs)
+  { }
+
+  virtual bool exec()
+  {
+    try {
+      return execConnected();
+    } catch (const rti1516e::Exception& e) {
+      std::wcout << L"rti1516e::Exception: \"" << e.what() << L"\"" << std::endl;
+      return false;
+    } catch (...) {
+      std::wcout << L"Unknown Exception!" << std::endl;
+      return false;
+    }
+  }
+
+  bool execConnected()
+  {
+    ReflectingAmbassador publisher;
+    publisher.connect(getConnectUrl());
+    ReflectingAmbassador subscriber;
+    subscriber.connect(getConnectUrl());
+    ReflectingAmbassador reducedSubscriber;
+    reducedSubscriber.connect(getConnectUrl());
+
+    publisher.createFederationExecution(getFederationExecution(), getFddFile());
+    publisher.joinFederationExecution(L"publisher", getFederationExecution());
+    subscriber.joinFederationExecution(L"subscriber", getFederationExecution());
+    reducedSubscriber.joinFederationExecution(L"reducedSubscriber", getFederationExecution());
+
+    rti1516e::ObjectClassHandle objectClassHandle = publisher.getObjectClassHandle(L"ObjectClass");
+    rti1516e::AttributeHandle attributeHandle0 = publisher.getAttributeHandle(objectClassHandle, L"Attribute0");
+    rti1516e::AttributeHandle attributeHandle1 = publisher.getAttributeHandle(objectClassHandle, L"Attribute1");
+    rti1516e::AttributeHandleSet attributeHandleSet;
+    attributeHandleSet.insert(attributeHandle0);
+    attributeHandleSet.insert(attributeHandle1);
+
+    publisher.publishObjectClassAttributes(objectClassHandle, attributeHandleSet);
+    subscriber.subscribeObjectClassAttributes(objectClassHandle, attributeHandleSet);
+    reducedSubscriber.subscribeObjectClassAttributes(objectClassHandle, attributeHandleSet, true, L"Slow");
+
+    // Once discovered, the subscriptions are in place at the servers
+    rti1516e::ObjectInstanceHandle objectInstanceHandle = publisher.registerObjectInstance(objectClassHandle);
+    Clock timeout = Clock::now() + Clock::fromSeconds(10);
+    while (!subscriber._discovered || !reducedSubscriber._discovered) {
+      subscriber.evokeCallback(0.01);
+      reducedSubscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for object instance discovery!" << std::endl;
+        return false;
+      }
+    }
+
+    // Send a burst that is much faster than the 2Hz the reduced subscriber asked for,
+    // the last update only changes the other attribute
+    unsigned count = 100;
+    for (unsigned i = 0; i < count; ++i) {
+      rti1516e::AttributeHandleValueMap attributeValues;
+      attributeValues[attributeHandle0] = toVariableLengthData(i);
+      publisher.updateAttributeValues(objectInstanceHandle, attributeValues, rti1516e::VariableLengthData());
+    }
+    {
+      rti1516e::AttributeHandleValueMap attributeValues;
+      attributeValues[attributeHandle1] = toVariableLengthData("final");
+      publisher.updateAttributeValues(objectInstanceHandle, attributeValues, rti1516e::VariableLengthData());
+    }
+
+    // The plain subscriber gets them all
+    timeout = Clock::now() + Clock::fromSeconds(10);
+    while (subscriber._reflectCount < count + 1) {
+      subscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for attribute reflections!" << std::endl;
+        return false;
+      }
+    }
+
+    // Without any further update, the reduced subscriber must see the latest value of both attributes
+    // once the reduced update period is over, the values held back from several updates included
+    timeout = Clock::now() + Clock::fromSeconds(10);
+    while (reducedSubscriber._attributeValues.find(attributeHandle1) == reducedSubscriber._attributeValues.end()) {
+      reducedSubscriber.evokeCallback(0.01);
+      if (timeout < Clock::now()) {
+        std::wcout << L"Timeout waiting for the held back attribute values!" << std::endl;
+        return false;
+      }
+    }
+    if (count <= reducedSubscriber._reflectCount) {
+      std::wcout << L"Update rate is not reduced: got " << reducedSubscriber._reflectCount << L" reflections!" << std::endl;
+      return false;
+    }
+    if (toUnsigned(reducedSubscriber._attributeValues[attributeHandle0]) != count - 1) {
+      std::wcout << L"Latest held back attribute value is not delivered!" << std::endl;
+      return false;
+    }
+    if (toString(reducedSubscriber._attributeValues[attributeHandle1]) != "final") {
+      std::wcout << L"Latest attribute value is not delivered!" << std::endl;
+      return false;
+    }
+
+    reducedSubscriber.resignFederationExecution(rti1516e::NO_ACTION);
+    subscriber.resignFederationExecution(rti1516e::NO_ACTION);
+    publisher.resignFederationExecution(rti1516e::DELETE_OBJECTS);
+    publisher.destroyFederationExecution(getFederationExecution());
+
+    return true;
+  }
+};
+
+class OPENRTI_LOCAL Test : public RTITest {
+public:
+  Test(int argc, const char* const argv[]) :
+    RTITest(argc, argv, false)
+  { }
+
+  virtual Ambassador* createAmbassador(const ConstructorArgs& constructorArgs)
+  {
+    return new TestAmbassador(constructorArgs);
+  }
+};
+
+}
+
+int
+main(int argc, char* argv[])
+{
+  OpenRTI::Test test(argc, argv);
+  return test.exec();
+}